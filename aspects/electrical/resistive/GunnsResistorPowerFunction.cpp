@@ -8,11 +8,13 @@
 LIBRARY DEPENDENCY:
     (
      (core/GunnsBasicLink.o)
+     (core/GunnsPowerLawUtils.o)
     )
 */
 
 #include "software/exceptions/TsInitializationException.hh"
 #include "math/MsMath.hh"
+#include "core/GunnsPowerLawUtils.hh"
 #include <cfloat>
 #include "GunnsResistorPowerFunction.hh"
 
@@ -213,16 +215,13 @@ void GunnsResistorPowerFunction::step(const double dt __attribute__((unused)))
 /// @param[in] dt        (s)  Not used.
 /// @param[in] minorStep (--) Not used.
 ///
-/// @details  Updates this link's contributions to the network system of equations.
+/// @details  Updates this link's contributions to the network system of equations.  The power
+///           function is linearized at the latest potential drop, which is limited to above a
+///           minimum for stability in linearization and to avoid divide-by-zero.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsResistorPowerFunction::minorStep(const double dt        __attribute__((unused)),
                                            const int    minorStep __attribute__((unused)))
 {
-    /// - Link delta-potential is limited to above a minimum for stability in linearization and to
-    ///   avoid divide-by-zero below.
-    const double dPLimit = std::max(fabs(mPotentialVector[0] - mPotentialVector[1]),
-                                    mMinLinearizationPotential);
-
     /// - Conductance is the inverse of resistance, limited to valid ranges.  Blockage malfunction
     ///   lowers the conductance.
     double gLimit  = std::min(mConductanceLimit,
@@ -231,44 +230,20 @@ void GunnsResistorPowerFunction::minorStep(const double dt        __attribute__(
         gLimit *= MsMath::limitRange(0.0, (1.0 - mMalfBlockageValue), 1.0);
     }
 
-    /// - Exponent is limited away from zero to avoid instability.
-    const double expInv = 1.0 / MsMath::innerLimit(-0.001, mExponent, 0.001);
-    const double dPG    = dPLimit * gLimit;
-
     if (gLimit >= 1.0 / mConductanceLimit) {
-        if (mUseTangentLine) {
-            /// - Use this tangent-line approximation option with caution.  It takes a lot more
-            ///   minor steps to converge, and tends to be unstable when combined with other
-            ///   similarly-configured links.  We only included it for completeness.
-            ///
-            ///     dP = R * i^x,     G = 1/R
-            ///     linearize tangent-line to w = A * dP
-            ///     (dP*G) = i^x
-            ///     i = (dP*G)^(1/x)
-            ///     idot = (1/x)*(dP*G)^(1/x - 1) = A
-            ///     i = A*dP + w
-            ///     w = i - A*dP
-            ///
-            const double current = powf(dPG, expInv);
-            mSystemAdmittance    = expInv * powf(dPG, (expInv - 1.0));
-            mSystemSource        = current - mSystemAdmittance * dPLimit;
-
-        } else {
-            /// - The is the default, and in our opinion, far better configuration.  The
-            ///   linearization passes thru the origin instead of being tangent to the curve
-            ///   (similar to GunnsFluidConductor).  This trades accuracy for stability during
-            ///   transient events but still converges to the correct solution as the non-linear
-            ///   network converges.
-            ///
-            ///     dP = R * w^x,      G = 1/R
-            ///     linearize to w = A * dP
-            ///     dP*G = w^x
-            ///     (dP*G)^(1/x) = w = A*dP
-            ///     A = (dP*G)^(1/x) / dP
-            ///
-            mSystemAdmittance = powf(dPLimit * gLimit, expInv) / dPLimit;
-            mSystemSource     = 0.0;
-        }
+        /// - The default linearization passes thru the origin instead of being tangent to the curve
+        ///   (similar to GunnsFluidConductor).  This trades accuracy for stability during transient
+        ///   events but still converges to the correct solution as the non-linear network converges.
+        ///   The tangent-line option is the Newton-Raphson companion model, which converges in far
+        ///   fewer minor steps.  See GunnsPowerLawUtils for the derivations.
+        GunnsPowerLawUtils::linearize(mSystemAdmittance,
+                                      mSystemSource,
+                                      mPotentialVector[0] - mPotentialVector[1],
+                                      gLimit,
+                                      mExponent,
+                                      mMinLinearizationPotential,
+                                      mUseTangentLine ? GunnsPowerLawUtils::NEWTON
+                                                      : GunnsPowerLawUtils::SECANT);
     } else {
         mSystemAdmittance = 0.0;
         mSystemSource     = 0.0;
@@ -44,7 +44,7 @@ class GunnsResistorPowerFunctionConfigData : public GunnsBasicLinkConfigData
     public:
         double mResistance;     /**< (--) trick_chkpnt_io(**) Resistance to flow. */
         double mExponent;       /**< (--) trick_chkpnt_io(**) Exponent on the power function. */
-        bool   mUseTangentLine; /**< (--) trick_chkpnt_io(**) Flag to enable tangent-line approximation. */
+        bool   mUseTangentLine; /**< (--) trick_chkpnt_io(**) Flag to enable tangent-line (Newton) linearization. */
         /// @brief Default constructs this Resistor With Power Function configuration data.
         GunnsResistorPowerFunctionConfigData(const std::string& name           = "",
                                              GunnsNodeList*     nodes          = 0,
@@ -97,6 +97,11 @@ class GunnsResistorPowerFunctionInputData : public GunnsBasicLinkInputData
 ///           overhead of fluid properties and a fluid network.  More info about the Bernoulli
 ///           application can be found in this link's GunnShow link help page.
 ///
+///           The power function is linearized by GunnsPowerLawUtils, by default as a secant
+///           through the origin.  The tangent-line option stamps the Newton-Raphson companion model
+///           instead, the tangent conductance and an equivalent source, so the non-linear network
+///           converges quadratically rather than linearly.
+///
 /// @note     Because of this link's flexibility in different aspects, we declare all variables
 ///           to be unit-less.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,7 +139,7 @@ class GunnsResistorPowerFunction : public GunnsBasicLink
     protected:
         double mResistance;           /**< (--)                     Resistance to flow. */
         double mExponent;             /**< (--)                     Exponent in the power function. */
-        bool   mUseTangentLine;       /**< (--)                     Flag to enable tangent-line approximation. */
+        bool   mUseTangentLine;       /**< (--)                     Flag to enable tangent-line (Newton) linearization. */
         double mSystemAdmittance;     /**< (--) trick_chkpnt_io(**) Limited conductance for the system admittance matrix. */
         double mSystemSource;         /**< (--) trick_chkpnt_io(**) Source flux for the system source vector. */
         /// @brief Virtual method for derived links to perform their restart functions.
@@ -291,10 +291,10 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         /// - Note that even though tExponent is 2, we can't use sqrt function in this test and
-        ///   expect an exact match with the model, because the model uses the powf function and
-        ///   sqrt(X) != powf(X, 1/2).
+        ///   expect an exact match with the model, because the model uses the pow function and
+        ///   sqrt(X) != pow(X, 1/2).
         const double G         = (1.0 - tMalfBlockageValue) / tResistance;
-        const double expectedA = powf(dP * G, (1.0 / tExponent)) / dP;
+        const double expectedA = pow(dP * G, (1.0 / tExponent)) / dP;
         CPPUNIT_ASSERT_DOUBLES_EQUAL( expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedA, tArticle->mAdmittanceMatrix[1], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedA, tArticle->mAdmittanceMatrix[2], DBL_EPSILON);
@@ -318,7 +318,7 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = 1.0 / tResistance;
-        const double expectedA = powf(dP * G, (1.0 / tExponent)) / dP;
+        const double expectedA = pow(dP * G, (1.0 / tExponent)) / dP;
         CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,       tArticle->mSourceVector[1],     DBL_EPSILON);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
@@ -328,7 +328,7 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = minLinP;
         const double G         = 1.0 / tResistance;
-        const double expectedA = powf(dP * G, (1.0 / tExponent)) / dP;
+        const double expectedA = pow(dP * G, (1.0 / tExponent)) / dP;
         CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,       tArticle->mSourceVector[1],     DBL_EPSILON);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
@@ -339,8 +339,9 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = GunnsBasicLink::mConductanceLimit;
-        const double expectedA = powf(dP * G, (1.0 / tExponent)) / dP;
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
+        const double expectedA = pow(dP * G, (1.0 / tExponent)) / dP;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0],
+                                     expectedA * DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,       tArticle->mSourceVector[1],     DBL_EPSILON);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
     } {
@@ -349,13 +350,13 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = GunnsBasicLink::m100EpsilonLimit;
-        const double expectedA = powf(dP * G, (1.0 / tExponent)) / dP;
+        const double expectedA = pow(dP * G, (1.0 / tExponent)) / dP;
         CPPUNIT_ASSERT_EQUAL(0.0, tArticle->mAdmittanceMatrix[0]);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,       tArticle->mSourceVector[1],     DBL_EPSILON);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
     }
 
-    /// - Tests using the tangent-line approximation option:
+    /// - Tests using the tangent-line (Newton) linearization option:
     tArticle->mUseTangentLine = true;
     {
         /// @test    Nominal potential and resistance within limits, with blockage malfunction.
@@ -364,8 +365,9 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = (1.0 - tMalfBlockageValue) / tResistance;
-        const double expectedA = (1.0 / tExponent) * powf(dP * G, (1.0 / tExponent - 1.0));
-        const double expectedW = powf(dP * G, (1.0 / tExponent)) - expectedA * dP;
+        const double expectedI = pow(dP * G, (1.0 / tExponent));
+        const double expectedA = expectedI * (1.0 / tExponent) / dP;
+        const double expectedW = expectedI * (1.0 - 1.0 / tExponent);
         CPPUNIT_ASSERT_DOUBLES_EQUAL( expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedA, tArticle->mAdmittanceMatrix[1], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedA, tArticle->mAdmittanceMatrix[2], DBL_EPSILON);
@@ -379,19 +381,20 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = 1.0 / tResistance;
-        const double expectedA = (1.0 / tExponent) * powf(dP * G, (1.0 / tExponent - 1.0));
-        const double expectedW = powf(dP * G, (1.0 / tExponent)) - expectedA * dP;
+        const double expectedI = pow(dP * G, (1.0 / tExponent));
+        const double expectedA = expectedI * (1.0 / tExponent) / dP;
+        const double expectedW = expectedI * (1.0 - 1.0 / tExponent);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedW, tArticle->mSourceVector[1],     DBL_EPSILON);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
     } {
-        /// @test    Potential below minimum linearization.
+        /// @test    Potential below minimum linearization uses the secant.
         tArticle->mPotentialVector[tPort0] = tNodes[tPort1].getPotential() + FLT_EPSILON;
         tArticle->step(tTimeStep);
         const double dP        = minLinP;
         const double G         = 1.0 / tResistance;
-        const double expectedA = (1.0 / tExponent) * powf(dP * G, (1.0 / tExponent - 1.0));
-        const double expectedW = powf(dP * G, (1.0 / tExponent)) - expectedA * dP;
+        const double expectedA = pow(dP * G, (1.0 / tExponent)) / dP;
+        const double expectedW = 0.0;
         CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedW, tArticle->mSourceVector[1],     DBL_EPSILON);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
@@ -402,10 +405,13 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = GunnsBasicLink::mConductanceLimit;
-        const double expectedA = (1.0 / tExponent) * powf(dP * G, (1.0 / tExponent - 1.0));
-        const double expectedW = powf(dP * G, (1.0 / tExponent)) - expectedA * dP;
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedW, tArticle->mSourceVector[1],     DBL_EPSILON);
+        const double expectedI = pow(dP * G, (1.0 / tExponent));
+        const double expectedA = expectedI * (1.0 / tExponent) / dP;
+        const double expectedW = expectedI * (1.0 - 1.0 / tExponent);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedA, tArticle->mAdmittanceMatrix[0],
+                                     expectedA * DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedW, tArticle->mSourceVector[1],
+                                     expectedW * DBL_EPSILON);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
     } {
         /// @test    Resistance above maximum.
@@ -413,8 +419,9 @@ void UtGunnsResistorPowerFunction::testStep()
         tArticle->step(tTimeStep);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = GunnsBasicLink::m100EpsilonLimit;
-        const double expectedA = (1.0 / tExponent) * powf(dP * G, (1.0 / tExponent - 1.0));
-        const double expectedW = powf(dP * G, (1.0 / tExponent)) - expectedA * dP;
+        const double expectedI = pow(dP * G, (1.0 / tExponent));
+        const double expectedA = expectedI * (1.0 / tExponent) / dP;
+        const double expectedW = expectedI * (1.0 - 1.0 / tExponent);
         CPPUNIT_ASSERT_EQUAL(0.0, tArticle->mAdmittanceMatrix[0]);
         CPPUNIT_ASSERT_EQUAL(0.0, tArticle->mSourceVector[1]);
         CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
@@ -446,7 +453,7 @@ void UtGunnsResistorPowerFunction::testMinorStep()
         tArticle->minorStep(tTimeStep, 2);
         const double dP        = tNodes[0].getPotential() - tNodes[1].getPotential();
         const double G         = (1.0 - tMalfBlockageValue) / tResistance;
-        const double expectedA = powf(dP * G, (1.0 / tExponent)) / dP;
+        const double expectedA = pow(dP * G, (1.0 / tExponent)) / dP;
         CPPUNIT_ASSERT_DOUBLES_EQUAL( expectedA, tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedA, tArticle->mAdmittanceMatrix[1], DBL_EPSILON);
         CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedA, tArticle->mAdmittanceMatrix[2], DBL_EPSILON);
@@ -504,6 +511,67 @@ void UtGunnsResistorPowerFunction::testComputeFlows()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Resistor With Power Function link model convergence with the Newton
+///           linearization, in a circuit of a 100 potential source, a linear resistor, and the
+///           test article to ground.  The circuit is solved by hand for the middle node potential
+///           on each minor step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsResistorPowerFunction::testNewtonConvergence()
+{
+    UT_RESULT;
+
+    /// - Initialize default test article with nominal initialization data and no blockage.
+    tInputData->mMalfBlockageFlag = false;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+    tArticle->setMinLinearizationPotential(0.001);
+    const double sourceP = 100.0;
+    const double g1      = 0.2;
+
+    int    minorSteps[2] = {0, 0};
+    double potential[2]  = {0.0, 0.0};
+    for (int option = 0; option < 2; ++option) {
+        tArticle->mUseTangentLine = (1 == option);
+        double p = sourceP;
+        for (int minor = 1; minor <= 1000; ++minor) {
+            tArticle->mPotentialVector[tPort0] = p;
+            tArticle->mPotentialVector[tPort1] = 0.0;
+            tArticle->minorStep(tTimeStep, minor);
+            const double newP = (g1 * sourceP - tArticle->mSourceVector[1])
+                              / (g1 + tArticle->mAdmittanceMatrix[0]);
+            const double delta = fabs(newP - p);
+            p = newP;
+            if (delta < 1.0e-10) {
+                minorSteps[option] = minor;
+                break;
+            }
+        }
+        potential[option] = p;
+    }
+
+    /// @test    Both options converge to the solution of the power function.
+    for (int option = 0; option < 2; ++option) {
+        CPPUNIT_ASSERT(0 < minorSteps[option]);
+        const double current = pow(potential[option] / tResistance, 1.0 / tExponent);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(g1 * (sourceP - potential[option]), current, 1.0e-8);
+    }
+
+    /// @test    The Newton linearization converges in fewer minor steps.
+    CPPUNIT_ASSERT(minorSteps[1] <= 8);
+    CPPUNIT_ASSERT(minorSteps[1] < minorSteps[0]);
+
+    /// @test    Newton source reverses with the potential drop.
+    tArticle->mPotentialVector[tPort0] = 0.0;
+    tArticle->mPotentialVector[tPort1] = 50.0;
+    tArticle->minorStep(tTimeStep, 1);
+    const double expectedI = pow(50.0 / tResistance, 1.0 / tExponent);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedI, -50.0 * tArticle->mAdmittanceMatrix[0]
+                                             + tArticle->mSourceVector[1], 1.0e-12);
+    CPPUNIT_ASSERT(0.0 > tArticle->mSourceVector[1]);
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests for GUNNS Resistor With Power Function link model restart method.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,8 @@ class UtGunnsResistorPowerFunction: public CppUnit::TestFixture
         void testMinorStep();
         /// @brief    Tests computeFlows method.
         void testComputeFlows();
+        /// @brief    Tests convergence of the Newton linearization.
+        void testNewtonConvergence();
         /// @brief    Tests restart method.
         void testRestart();
         /// @brief    Tests initialize method exceptions.
@@ -84,6 +86,7 @@ class UtGunnsResistorPowerFunction: public CppUnit::TestFixture
         CPPUNIT_TEST(testStep);
         CPPUNIT_TEST(testMinorStep);
         CPPUNIT_TEST(testComputeFlows);
+        CPPUNIT_TEST(testNewtonConvergence);
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST(testInitializationExceptions);
         CPPUNIT_TEST_SUITE_END();
@@ -230,8 +230,8 @@ GunnsFluidAccum::GunnsFluidAccum()
     mBellowsZone(GunnsFluidAccum::MIDDLE),
     mFillModePressureThreshold(0.0),
     mEffCondScaleOneWayRate(0.0),
-    mAccelPressureHead(0.0)
-
+    mAccelPressureHead(0.0),
+    mBellowsEquilibriumFlag(false)
 {
     // Nothing to do
 }
@@ -318,6 +318,24 @@ bool GunnsFluidAccum::checkSpecificPortRules(const int port, const int node) con
     return result;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  position  (--)     Bellows position (0-1).
+/// @param[out] slope     (kPa)    Derivative of the returned pressure with bellows position.
+///
+/// @return     (kPa) Liquid chamber pressure.
+///
+/// @details    Computes the liquid chamber pressure the spring, acceleration pressure head and
+///             pressurizer would have with the bellows at the given position, and its slope.  The
+///             acceleration pressure head is held constant.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidAccum::computeBellowsPressure(const double position, double& slope)
+{
+    double pressurizerSlope = 0.0;
+    const double pressurizerPressure = computePressurizerPressure(position, pressurizerSlope);
+    slope = 2.0 * mSpringCoeff2 * position + mSpringCoeff1 + pressurizerSlope;
+    return (mSpringCoeff2 * position + mSpringCoeff1) * position + mSpringCoeff0
+         + mAccelPressureHead + pressurizerPressure;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  capacitance           (kg*mol/kPa) Fluid capacitance of the chamber.
 /// @param[in]  maxConductivity       (m2)         Max conductivity limit.
 /// @param[in]  currentConductivity   (m2)         Current conductivity.
@@ -353,6 +371,70 @@ double GunnsFluidAccum::computeConductivity(const double capacitance,
     return conductivity;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  pressure  (kPa)  Liquid chamber pressure to find the bellows position for.
+///
+/// @return     (--) Bellows position (0-1) at which the liquid chamber pressure equals the given
+///             pressure, limited to the hard stops.
+///
+/// @details    With the pressurizer pressure held at its current value, the liquid chamber pressure
+///             is the spring polynomial, and the position is its root in closed form.  The root is
+///             taken in the form that stays accurate as mSpringCoeff2 goes to zero.  If the
+///             pressurizer pressure also changes with position, as a gas pressurizer does, the root
+///             is then refined by Newton's method, falling back to bisection whenever a Newton step
+///             would leave the interval known to contain the position.  The liquid chamber pressure
+///             is assumed to rise with bellows position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidAccum::computeEquilibriumPosition(const double pressure)
+{
+    /// - Closed-form root of the spring polynomial with the current pressurizer pressure.
+    double pressurizerSlope = 0.0;
+    const double c = mSpringCoeff0 + mAccelPressureHead
+                   + computePressurizerPressure(mBellowsPosition, pressurizerSlope) - pressure;
+    const double denominator = mSpringCoeff1
+                             + std::sqrt(std::max(0.0, mSpringCoeff1 * mSpringCoeff1
+                                                     - 4.0 * mSpringCoeff2 * c));
+    double position = mBellowsPosition;
+    if (denominator > DBL_EPSILON) {
+        position = MsMath::limitRange(0.0, -2.0 * c / denominator, 1.0);
+    }
+    if (pressurizerSlope <= 0.0) {
+        return position;
+    }
+
+    /// - Return a hard stop if the pressure can't be reached between them.
+    double slope = 0.0;
+    if (computeBellowsPressure(0.0, slope) >= pressure) {
+        return 0.0;
+    }
+    if (computeBellowsPressure(1.0, slope) <= pressure) {
+        return 1.0;
+    }
+
+    /// - Refine the root with the pressurizer pressure varying with position.
+    double lower = 0.0;
+    double upper = 1.0;
+    for (int i = 0; i < 20; ++i) {
+        const double error = computeBellowsPressure(position, slope) - pressure;
+        if (error > 0.0) {
+            upper = position;
+        } else {
+            lower = position;
+        }
+        double next = 0.5 * (lower + upper);
+        if (slope > DBL_EPSILON) {
+            next = position - error / slope;
+            if (next <= lower or next >= upper) {
+                next = 0.5 * (lower + upper);
+            }
+        }
+        if (fabs(next - position) < m100EpsilonLimit) {
+            return next;
+        }
+        position = next;
+    }
+    return position;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  flux            (kg*mol/s) Molar flow rate into the chamber.
 /// @param[in]  associatedNode  (--)       Pointer to the node to compute flow for.
 /// @param[in]  accumFluid      (m2)       Pointer to the internal fluid in the chamber.
@@ -471,6 +553,22 @@ double GunnsFluidAccum::computeMass(const double dt, const double flowRate, cons
     return (std::max(newMass, DBL_EPSILON));
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  position  (--)   Bellows position (0-1, not used).
+/// @param[out] slope     (kPa)  Derivative of the returned pressure with bellows position.
+///
+/// @return     (kPa) Pressurizer pressure at the given bellows position.
+///
+/// @details    Returns the pressure from the pressurizer at the given bellows position, and its
+///             slope.  Place holder for derived class, which returns the current pressurizer
+///             pressure with zero slope.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidAccum::computePressurizerPressure(const double position __attribute__((unused)),
+                                                   double& slope)
+{
+    slope = 0.0;
+    return getPressurizerPressure();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt                  (s)    Delta time.
 /// @param[in]  flowRate            (kg/s) Flow rate.
 /// @param[in]  inSpecificEnthalpy  (J/kg) Specific enthalpy of incoming flow.
@@ -908,6 +1006,9 @@ void GunnsFluidAccum::step(const double dt)
 {
     /// - update capacitance and conductivity
     updateCapacitance();
+    if (isBellowsEquilibriumActive()) {
+        updateEquilibriumCapacitance();
+    }
     updateEffectiveConductivity(dt);
     /// - Call update state to update admittance, conductance, and potential
     updateState(dt);
@@ -1152,23 +1253,70 @@ void GunnsFluidAccum::updateEffConductivityScale(const double dt)
 /// @details    Update effective conductivity of liquid side, based on liquid capacitance and
 ///             conductivity scale. By dynamically adjusting the conductivity, stability is
 ///             provided given changing volumes.
+///
+///             In the bellows equilibrium mode, the liquid capacitance already stops the bellows at
+///             the hard stops, so the conductivity scale is still updated for the bellows zone and
+///             fill mode but not applied.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidAccum::updateEffectiveConductivity(const double dt)
 {
     /// - Compute conductivity based on liquid capacitance and conductivity scale.
     updateEffConductivityScale(dt);
-    mEffectiveConductivity = mEffConductivityScale *
-                                  computeConductivity(mLiqCapacitance,
-                                                      mMaxConductivity,
-                                                      mEffectiveConductivity,
-                                                      0.0,
-                                                      dt);
+    double scale = mEffConductivityScale;
+    if (isBellowsEquilibriumActive()) {
+        scale = 1.0;
+    }
+    mEffectiveConductivity = scale * computeConductivity(mLiqCapacitance,
+                                                         mMaxConductivity,
+                                                         mEffectiveConductivity,
+                                                         0.0,
+                                                         dt);
     /// - Limit conductivity to be between 0.0 and mMaxConductivity.
     mEffectiveConductivity = MsMath::limitRange(0.0, mEffectiveConductivity, mMaxConductivity);
     /// - call update effective conductivity for pressurizer
     updatePressurizerEffCond(dt);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return     Void
+///
+/// @details    Replaces the liquid capacitance with the secant capacitance between the current
+///             bellows position and the position at which the liquid chamber would be in
+///             equilibrium with the liquid node's last pressure.  The conductivity built from this
+///             capacitance moves exactly the liquid that puts the bellows at that position in one
+///             step, rather than the tangent capacitance, which is only exact for small steps on a
+///             linear spring.  At a hard stop with the pressure holding the bellows against it, the
+///             capacitance is zero and the liquid side is closed off.  Otherwise the tangent
+///             capacitance of the liquid chamber pressure is used, which for a gas pressurizer
+///             combines the spring and gas in series.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidAccum::updateEquilibriumCapacitance()
+{
+    const double molarDensity = mInternalFluid->getDensity() / mInternalFluid->getMWeight();
+    if (not (molarDensity > 0.0) or mActiveVolRange <= 0.0) {
+        return;
+    }
+
+    /// - Secant capacitance to the equilibrium position.
+    const double nodePressure  = mNodes[LIQUID_PORT]->getPotential();
+    const double deltaPressure = nodePressure - mInternalFluid->getPressure();
+    if (fabs(deltaPressure) > m100EpsilonLimit * std::max(1.0, fabs(nodePressure))) {
+        const double deltaPosition = computeEquilibriumPosition(nodePressure) - mBellowsPosition;
+        const double capacitance   = deltaPosition * mActiveVolRange * molarDensity / deltaPressure;
+        if (capacitance >= 0.0) {
+            mLiqCapacitance = capacitance;
+            return;
+        }
+    }
+
+    /// - Tangent capacitance in equilibrium, or if the liquid chamber pressure isn't yet consistent
+    ///   with the bellows position, as after initialization to a different pressure.
+    double slope = 0.0;
+    computeBellowsPressure(mBellowsPosition, slope);
+    if (slope > DBL_EPSILON) {
+        mLiqCapacitance = mActiveVolRange * molarDensity / slope;
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt           (s) Delta time.
 ///
 /// @return     Void
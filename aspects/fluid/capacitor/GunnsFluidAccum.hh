@@ -201,6 +201,8 @@ class GunnsFluidAccum : public GunnsFluidLink {
         void setSpringCoeffs(const double coeff0 = 0.0, const double coeff1 = 0.0, const double coeff2 = 0.0);
         /// @brief Sets extra pressure at exit due to liquid column under acceleration.
         void setAccelPressureHead(const double pressure);
+        /// @brief Sets the bellows equilibrium mode.
+        void setBellowsEquilibrium(const bool flag = false);
 
     protected:
         static const int LIQUID_PORT;        /**< (--)                      Liquid port number. */
@@ -248,6 +250,7 @@ class GunnsFluidAccum : public GunnsFluidLink {
         double mFillModePressureThreshold;   /**< (kPa) trick_chkpnt_io(**) Threshold for computing Fill Mode. Non-zero activates "one way" mEffConductivityScale ramping. */
         double mEffCondScaleOneWayRate;      /**< (--)  trick_chkpnt_io(**) Fraction/sec, "One way" mEffConductivityScale ramping. Used if mFillModePressureThreshold > 0 */
         double mAccelPressureHead;           /**< (kPa)                     Extra pressure head at exit due to liquid column under acceleration. */
+        bool   mBellowsEquilibriumFlag;      /**< (--)                      Flag to move the bellows to equilibrium with the liquid node each step. */
 
         /// @brief Updates the admittance matrix.
         void buildConductance();
@@ -255,12 +258,17 @@ class GunnsFluidAccum : public GunnsFluidLink {
         void buildPotential();
         /// @brief Checks for valid accumulator port node assignment
         bool checkSpecificPortRules(const int port, const int node) const;
+        /// @brief Computes the liquid chamber pressure and its slope at the given bellows position.
+        double computeBellowsPressure(const double position, double& slope);
         /// @brief Computes conductivity for accumulator link, Can also be used by derived class.
         double computeConductivity(const double capacitance,
                                    const double maxConductivity,
                                    const double currentConductivity,
                                    const double minConductivity,
                                    const double dt) const;
+        /// @brief Computes the bellows position at which the liquid chamber pressure equals the given
+        ///        pressure.
+        double computeEquilibriumPosition(const double pressure);
         /// @brief Computes flow rate for accumulator link, Can also be used by derived class.
         double computeFlowRate(const double admittance,
                                GunnsBasicNode* node,
@@ -278,6 +286,9 @@ class GunnsFluidAccum : public GunnsFluidLink {
         /// @brief Computes mass for either accumulator chamber using density and volume, Can also be used by derived
         ///        class.
         double computeMass(const double volume, const double density) const;
+        /// @brief Computes pressurizer pressure and its slope at the given bellows position - place
+        ///        holder for derived class.
+        virtual double computePressurizerPressure(const double position, double& slope);
         /// @brief Computes temperature for either accumulator chamber, Can also be used by derived class.
         double computeTemperature(const double dt,
                                   const double flowRate,
@@ -332,6 +343,10 @@ class GunnsFluidAccum : public GunnsFluidLink {
         void updateEffConductivityScale(const double dt);
         /// @brief Update effective conductivity for liquid side.
         void updateEffectiveConductivity(const double dt);
+        /// @brief Update liquid capacitance to move the bellows to equilibrium in one step.
+        void updateEquilibriumCapacitance();
+        /// @brief Returns whether the bellows equilibrium mode applies this step.
+        bool isBellowsEquilibriumActive() const;
         /// @brief Update pressurizer effective conductivity, Place holder for derived class.
         virtual void updatePressurizerEffCond(const double dt);
         /// @brief Update pressurizer fluid - mass, temperature, pressure, Place holder for derived class.
@@ -440,5 +455,29 @@ inline void GunnsFluidAccum::setAccelPressureHead(const double pressure)
     mAccelPressureHead = pressure;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] flag (--) True moves the bellows to equilibrium with the liquid node each step.
+///
+/// @details  Sets the mBellowsEquilibriumFlag attribute to the given value.  Calling this method with
+///           default arguments returns to the normal mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsFluidAccum::setBellowsEquilibrium(const bool flag)
+{
+    mBellowsEquilibriumFlag = flag;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the bellows equilibrium mode applies this step.
+///
+/// @details  The bellows equilibrium mode is set, and the bellows isn't being held, or forced by a
+///           malfunction, an edit or the pressurizer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidAccum::isBellowsEquilibriumActive() const
+{
+    return mBellowsEquilibriumFlag and not (mHoldAccumFlag or mMalfBellowsStickFlag or
+                                            mMalfBellowsStickToPosFlag or mEditBellowsFlag or
+                                            mPressurizerOrideBellowsFlag);
+}
+
 #endif  /* GunnsFluidAccum_EXISTS */
 
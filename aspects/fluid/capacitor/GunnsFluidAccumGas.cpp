@@ -222,6 +222,23 @@ void GunnsFluidAccumGas::computeFlows(const double dt)
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  position  (--)   Bellows position (0-1).
+/// @param[out] slope     (kPa)  Derivative of the returned pressure with bellows position.
+///
+/// @return     (kPa) Gas pressure at the given bellows position.
+///
+/// @details    Computes the gas pressure with the bellows at the given position, compressing or
+///             expanding the current gas mass isothermally as an ideal gas, and its slope.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidAccumGas::computePressurizerPressure(const double position, double& slope)
+{
+    const double volume   = std::max(mTotalVolume - mMinChamberVol - position * mActiveVolRange,
+                                     mMinChamberVol);
+    const double pressure = mGasInternalFluid->getPressure() * mPressurizerVolume / volume;
+    slope = pressure * mActiveVolRange / volume;
+    return pressure;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return         Void
 ///
 /// @details        Forces gas chamber temperature, based on base class temperature edit terms.
@@ -168,6 +168,8 @@ class GunnsFluidAccumGas : public GunnsFluidAccum {
         void buildGasConductance();
         /// @brief Updates source vector of the link.
         void buildGasPotential();
+        /// @brief Computes gas pressure and its slope at the given bellows position.
+        double computePressurizerPressure(const double position, double& slope);
         /// @brief Forces gas chamber temperature, based on base class temperature edit terms.
         void editPressurizerTemperature();
         /// @brief Forces gas chamber due to edit or malfunction.
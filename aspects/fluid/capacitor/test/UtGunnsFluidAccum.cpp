@@ -1611,6 +1611,89 @@ void UtGunnsFluidAccum::testHoldFlags()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for the bellows equilibrium mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidAccum::testBellowsEquilibrium()
+{
+    UT_RESULT;
+
+    /// - Use a quadratic spring, on which the tangent capacitance isn't exact for large steps, and
+    ///   start the liquid chamber at the spring pressure.
+    tConfigData->mSpringCoeff2 = 40.0;
+    tInputData->mLiquidFluidInputData->mPressure = 10.0;
+    tModel->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+    tModel->setBellowsEquilibrium(true);
+    CPPUNIT_ASSERT(tModel->mBellowsEquilibriumFlag);
+
+    /// @test   Closed-form equilibrium position on the spring polynomial.
+    const double position  = 0.6;
+    const double pressure  = position * position * 40.0 + position * tSpringCoeff1 + tSpringCoeff0;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(position, tModel->computeEquilibriumPosition(pressure),   tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,      tModel->computeEquilibriumPosition(1000.0),     0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,      tModel->computeEquilibriumPosition(-1000.0),    0.0);
+
+    /// @test   The bellows reaches equilibrium with the liquid node in one step.
+    tNodes[0].setPotential(pressure);
+    tNodes[0].getContent()->setPressure(pressure);
+    tNodes[0].resetFlows();
+    tModel->step(tTimeStep);
+    const double molarDensity = tModel->mInternalFluid->getDensity()
+                              / tModel->mInternalFluid->getMWeight();
+    const double expectedCap  = (position - tInitialBellowsPosition) * tModel->mActiveVolRange
+                              * molarDensity / (pressure - tModel->mInternalFluid->getPressure());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedCap, tModel->mLiqCapacitance, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedCap / tTimeStep, tModel->mAdmittanceMatrix[3], DBL_EPSILON);
+    tModel->computeFlows(tTimeStep);
+    tModel->transportFlows(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(position, tModel->mBellowsPosition,               tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(pressure, tModel->mInternalFluid->getPressure(),  tTolerance);
+
+    /// @test   In equilibrium, the tangent capacitance of the spring is used.
+    tNodes[0].resetFlows();
+    tModel->step(tTimeStep);
+    const double slope = 2.0 * 40.0 * tModel->mBellowsPosition + tSpringCoeff1;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tModel->mActiveVolRange * molarDensity / slope,
+                                 tModel->mLiqCapacitance, tTolerance);
+
+    /// @test   The bellows stops at the full hard stop and then closes off the liquid side.
+    tNodes[0].setPotential(500.0);
+    tNodes[0].getContent()->setPressure(500.0);
+    tNodes[0].resetFlows();
+    tModel->step(tTimeStep);
+    tModel->computeFlows(tTimeStep);
+    tModel->transportFlows(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tModel->mBellowsPosition, 1.0E-04);
+    tNodes[0].resetFlows();
+    tModel->step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tModel->mLiqCapacitance, tTolerance);
+
+    /// @test   The normal mode with the tangent capacitance overshoots the equilibrium.
+    tModel->setBellowsEquilibrium();
+    tModel->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+    tNodes[0].setPotential(pressure);
+    tNodes[0].getContent()->setPressure(pressure);
+    tNodes[0].resetFlows();
+    tModel->step(tTimeStep);
+    tModel->computeFlows(tTimeStep);
+    tModel->transportFlows(tTimeStep);
+    CPPUNIT_ASSERT(position + 0.001 < tModel->mBellowsPosition);
+
+    /// @test   The equilibrium mode doesn't apply while the bellows is forced.
+    tModel->setBellowsEquilibrium(true);
+    tModel->setMalfBellowsStick(true);
+    CPPUNIT_ASSERT(not tModel->isBellowsEquilibriumActive());
+    tModel->setMalfBellowsStick();
+    CPPUNIT_ASSERT(tModel->isBellowsEquilibriumActive());
+    tModel->setBellowsEquilibrium();
+    CPPUNIT_ASSERT(not tModel->isBellowsEquilibriumActive());
+
+    tNodes[0].setPotential(200.0);
+    tNodes[0].getContent()->setPressure(200.0);
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Test for testCheckSpecificPortRules
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,6 +75,7 @@ class UtGunnsFluidAccum: public CppUnit::TestFixture
         CPPUNIT_TEST(testMalfStickBellowsToPos);
         CPPUNIT_TEST(testPressurizerBellowsOride);
         CPPUNIT_TEST(testHoldFlags);
+        CPPUNIT_TEST(testBellowsEquilibrium);
         CPPUNIT_TEST(testCheckSpecificPortRules);
         CPPUNIT_TEST(testCheckSpecificPortRulesGasPort0);
         CPPUNIT_TEST(testAccessMethods);
@@ -182,6 +183,7 @@ class UtGunnsFluidAccum: public CppUnit::TestFixture
         void testMalfStickBellowsToPos();
         void testPressurizerBellowsOride();
         void testHoldFlags();
+        void testBellowsEquilibrium();
         void testCheckSpecificPortRules();
         void testCheckSpecificPortRulesGasPort0();
         void testAccessMethods();
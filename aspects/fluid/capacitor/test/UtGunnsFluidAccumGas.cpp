@@ -1084,6 +1084,53 @@ void UtGunnsFluidAccumGas::testBellowsEdit()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for the bellows equilibrium mode with the gas pressurizer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidAccumGas::testBellowsEquilibrium()
+{
+    UT_RESULT;
+
+    tModel->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+    tModel->setBellowsEquilibrium(true);
+
+    /// @test   Isothermal gas pressure and slope at a bellows position.
+    const double gasPressure = tModel->mGasInternalFluid->getPressure();
+    const double gasVolume   = tModel->mTotalVolume - tModel->mMinChamberVol
+                             - 0.6 * tModel->mActiveVolRange;
+    double slope = 0.0;
+    const double expectedGasP = gasPressure * tModel->mPressurizerVolume / gasVolume;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedGasP, tModel->computePressurizerPressure(0.6, slope), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedGasP * tModel->mActiveVolRange / gasVolume, slope, tTolerance);
+
+    /// @test   Equilibrium position with the spring and gas together.
+    const double pressure = tModel->computeBellowsPressure(0.6, slope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.6, tModel->computeEquilibriumPosition(pressure), tTolerance);
+
+    /// @test   Secant liquid capacitance to the equilibrium position.
+    tNodes[1].setPotential(pressure);
+    tNodes[1].getContent()->setPressure(pressure);
+    tModel->step(tTimeStep);
+    const double molarDensity = tModel->mInternalFluid->getDensity()
+                              / tModel->mInternalFluid->getMWeight();
+    const double expectedCap  = (0.6 - tInitialBellowsPosition) * tModel->mActiveVolRange
+                              * molarDensity / (pressure - tModel->mInternalFluid->getPressure());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedCap, tModel->mLiqCapacitance, DBL_EPSILON);
+
+    /// @test   In equilibrium, the spring and gas tangent capacitances are combined in series.
+    tNodes[1].setPotential(tModel->mInternalFluid->getPressure());
+    tModel->step(tTimeStep);
+    tModel->computeBellowsPressure(tInitialBellowsPosition, slope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tModel->mActiveVolRange * molarDensity / slope,
+                                 tModel->mLiqCapacitance, DBL_EPSILON);
+    CPPUNIT_ASSERT(tModel->mLiqCapacitance < tModel->mSpringCapacitance);
+
+    tNodes[1].setPotential(200.0);
+    tNodes[1].getContent()->setPressure(200.0);
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Test restart method.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +68,7 @@ class UtGunnsFluidAccumGas: public CppUnit::TestFixture
         CPPUNIT_TEST(testHoldAccum);
         CPPUNIT_TEST(testPressurizerOrideBellows);
         CPPUNIT_TEST(testBellowsEdit);
+        CPPUNIT_TEST(testBellowsEquilibrium);
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST_SUITE_END();
 
@@ -174,6 +175,7 @@ class UtGunnsFluidAccumGas: public CppUnit::TestFixture
         void testHoldAccum();
         void testPressurizerOrideBellows();
         void testBellowsEdit();
+        void testBellowsEquilibrium();
         void testRestart();
 };
 
@@ -3,7 +3,8 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 
 LIBRARY DEPENDENCY:
- ((aspects/fluid/conductor/GunnsFluidValve.o))
+ ((aspects/fluid/conductor/GunnsFluidValve.o)
+  (aspects/fluid/conductor/GunnsFluidValvePositionSolver.o))
 ***************************************************************************************************/
 
 #include "math/MsMath.hh"
@@ -147,7 +148,9 @@ GunnsFluidCheckValve::GunnsFluidCheckValve()
     mMalfFailToValue(0.0),
     mRateLimit(0.0),
     mClosePressure(0.0),
-    mOpenPressure(0.0)
+    mOpenPressure(0.0),
+    mImplicitPosition(false),
+    mPositionSolver()
 {
     // nothing to do
 }
@@ -235,6 +238,9 @@ void GunnsFluidCheckValve::restartModel()
 {
     /// - Reset the base class.
     GunnsFluidValve::restartModel();
+
+    /// - Reset non-config & non-checkpointed class attributes.
+    mPositionSolver.reset();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,18 +258,17 @@ void GunnsFluidCheckValve::updateState(const double dt)
         if (mMalfFailToFlag) {
             /// - Handle fail to position malfunction with range limiting.
             mPosition                     = MsMath::limitRange(0.0, mMalfFailToValue, 1.0);
+        } else if (mImplicitPosition) {
+            /// - Begin the implicit position solution, bounded by the rate limit, and take its
+            ///   first iteration from the last network solution.
+            mPositionSolver.beginStep(mPosition, mRateLimit * dt);
+            double       slope            = 0.0;
+            const double target           = computeTargetPosition(slope);
+            mPosition                     = mPositionSolver.update(mPosition, mPotentialDrop, target, slope);
         } else {
             const double previousPosition = mPosition;
-            if (mPotentialDrop >= mOpenPressure) {
-                /// - The position is fully open (1.0) if delta P across the valve is large enough.
-                mPosition                 = 1.0;
-            } else if (mPotentialDrop <= mClosePressure) {
-                /// - The position is fully closed (0.0) if delta P across the valve is small enough.
-                mPosition                 = 0.0;
-            } else {
-                /// - Otherwise the position transitions (0.0 to 1.0) linearly in delta P.
-                mPosition                 = (mPotentialDrop - mClosePressure) / (mOpenPressure - mClosePressure);
-            }
+            double       slope            = 0.0;
+            mPosition                     = computeTargetPosition(slope);
 
             /// - Apply range and rate limiting to the computed position.
             const double maxDelta         = mRateLimit * dt;
@@ -276,6 +281,78 @@ void GunnsFluidCheckValve::updateState(const double dt)
     GunnsFluidValve::updateState(dt);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]     slope  (1/kPa)  Slope of the target position with respect to delta pressure.
+///
+/// @return         double  (--)  Valve position given by the delta pressure across the valve.
+///
+/// @details        Returns this GUNNS Fluid Check Valve Link Model target valve position and its
+///                 slope with respect to the delta pressure across the valve.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidCheckValve::computeTargetPosition(double& slope) const
+{
+    slope = 0.0;
+    if (mPotentialDrop >= mOpenPressure) {
+        /// - The position is fully open (1.0) if delta P across the valve is large enough.
+        return 1.0;
+    } else if (mPotentialDrop <= mClosePressure) {
+        /// - The position is fully closed (0.0) if delta P across the valve is small enough.
+        return 0.0;
+    }
+
+    /// - Otherwise the position transitions (0.0 to 1.0) linearly in delta P.
+    slope = 1.0 / (mOpenPressure - mClosePressure);
+    return (mPotentialDrop - mClosePressure) * slope;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]      dt         (s)   Integration time step.
+/// @param[in]      minorStep  (--)  The network minor step number (not used).
+///
+/// @return         void
+///
+/// @details        When the valve position is solved implicitly, iterates the position from the
+///                 delta pressure of the latest network solution and updates the conductance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidCheckValve::minorStep(const double dt, const int minorStep __attribute__((unused)))
+{
+    if (mImplicitPosition and not mMalfStuckFlag and not mMalfFailToFlag) {
+        mPotentialDrop         = getDeltaPotential();
+        double       slope     = 0.0;
+        const double target    = computeTargetPosition(slope);
+        mPosition              = mPositionSolver.update(mPosition, mPotentialDrop, target, slope);
+
+        /// - Update the effective conductivity and admittance as in the major step.
+        GunnsFluidValve::updateState(dt);
+        updateAdmittance();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]      convergedStep  (--)  The # of minor steps since the network last converged.
+/// @param[in]      absoluteStep   (--)  The absolute minor step number that the network is on.
+///
+/// @return         SolutionResult  (--)  Whether this link confirms or rejects the network solution.
+///
+/// @details        Once the network has converged, rejects the solution if the implicit valve
+///                 position still needs to move by more than its tolerance to agree with the delta
+///                 pressure, so the network continues iterating.  Otherwise confirms.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicLink::SolutionResult GunnsFluidCheckValve::confirmSolutionAcceptable(
+        const int convergedStep,
+        const int absoluteStep __attribute__((unused)))
+{
+    if (mImplicitPosition and convergedStep > 0 and not mMalfStuckFlag and not mMalfFailToFlag) {
+        mPotentialDrop         = getDeltaPotential();
+        double       slope     = 0.0;
+        const double target    = computeTargetPosition(slope);
+        if (not mPositionSolver.isConverged(mPosition, target, slope)) {
+            return REJECT;
+        }
+    }
+    return CONFIRM;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] flag  (--) Malfunction activation flag, true activates
 ///
@@ -299,3 +376,21 @@ void GunnsFluidCheckValve::setMalfFailTo(const bool flag, const double value)
     mMalfFailToFlag  = flag;
     mMalfFailToValue = value;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] flag       (--) True solves the valve position implicitly with the network.
+/// @param[in] tolerance  (--) Position convergence tolerance (0-1).
+///
+/// @details  Enables or disables solving the valve position implicitly with the network, as a
+///           non-linear link.  This must be set before the network is initialized.  A tolerance
+///           outside (0-1) is rejected with a warning and the setting is not changed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidCheckValve::setImplicitPosition(const bool flag, const double tolerance)
+{
+    if (not MsMath::isInRange(DBL_EPSILON, tolerance, 1.0)) {
+        GUNNS_WARNING("rejected implicit position tolerance outside (0-1).");
+    } else {
+        mImplicitPosition = flag;
+        mPositionSolver.setTolerance(tolerance);
+    }
+}
@@ -30,6 +30,7 @@ PROGRAMMERS:
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
 #include "GunnsFluidValve.hh"
+#include "aspects/fluid/conductor/GunnsFluidValvePositionSolver.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Fluid Check Valve Configuration Data
@@ -154,17 +155,32 @@ class GunnsFluidCheckValve : public GunnsFluidValve
         void setMalfStuck(const bool flag = false);
         /// @brief Sets and resets the fail to position malfunction
         void setMalfFailTo(const bool flag = false, const double value = 0.0);
+        /// @brief Iterates the implicit valve position on network minor steps.
+        virtual void minorStep(const double dt, const int minorStep);
+        /// @brief Returns whether this Check Valve is non-linear.
+        virtual bool isNonLinear();
+        /// @brief Confirms the implicit valve position agrees with the network solution.
+        virtual SolutionResult confirmSolutionAcceptable(const int convergedStep,
+                                                         const int absoluteStep);
+        /// @brief Enables or disables solving the valve position implicitly with the network.
+        void setImplicitPosition(const bool flag, const double tolerance = 1.0E-6);
+        /// @brief Returns whether the valve position is solved implicitly with the network.
+        bool isImplicitPosition() const;
 
     protected:
         double        mRateLimit;          /**< (1/s)  trick_chkpnt_io(**) Position rate limit for this Check Valve. */
         double        mClosePressure;      /**< (kPa)  trick_chkpnt_io(**) Delta pressure at which this Check Valve is fully closed. */
         double        mOpenPressure;       /**< (kPa)  trick_chkpnt_io(**) Delta pressure at which this Check Valve is fully opened. */
+        bool          mImplicitPosition;   /**< (--)                       Valve position is solved implicitly with the network. */
+        GunnsFluidValvePositionSolver mPositionSolver; /**< (--)           Implicit valve position solver. */
         /// @brief    Validates the initialization of this Check Valve.
         void validate() const;
         /// @brief Virtual method for derived links to perform their restart functions.
         virtual void restartModel();
         /// @brief    Updates the state of this Check Valve.
         virtual void updateState(const double dt);
+        /// @brief    Returns the valve position given by the delta pressure, and its slope.
+        double computeTargetPosition(double& slope) const;
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -178,4 +194,25 @@ class GunnsFluidCheckValve : public GunnsFluidValve
 
 /// @}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return    bool  (--)  True if the valve position is solved implicitly with the network.
+///
+/// @details   Returns whether this GUNNS Fluid Check Valve Link Model is non-linear, which it is
+///            when its position is solved implicitly with the network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidCheckValve::isNonLinear()
+{
+    return mImplicitPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return    bool  (--)  True if the valve position is solved implicitly with the network.
+///
+/// @details   Returns whether the valve position is solved implicitly with the network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidCheckValve::isImplicitPosition() const
+{
+    return mImplicitPosition;
+}
+
 #endif
@@ -3,7 +3,8 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 
 LIBRARY DEPENDENCY:
-  ((core/GunnsFluidLink.o))
+  ((core/GunnsFluidLink.o)
+   (aspects/fluid/conductor/GunnsFluidValvePositionSolver.o))
 ***************************************************************************************************/
 
 #include "math/MsMath.hh"
@@ -183,7 +184,9 @@ GunnsFluidPressureSensitiveValve::GunnsFluidPressureSensitiveValve()
     mEffectiveConductivity(0.0),
     mSystemConductance(0.0),
     mControlPressure(0.0),
-    mWallHeatFlux(0.0)
+    mWallHeatFlux(0.0),
+    mImplicitPosition(false),
+    mPositionSolver()
 {
     // nothing to do
 }
@@ -335,6 +338,7 @@ void GunnsFluidPressureSensitiveValve::restartModel()
     mTuneVolFlow           = 0.0;
     mTuneDeltaT            = 0.0;
     mControlPressure       = 0.0;
+    mPositionSolver.reset();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,15 +384,7 @@ void GunnsFluidPressureSensitiveValve::step(const double dt)
     processUserPortCommand();
 
     /// - Valve is controlled by delta pressure across the pressure ports.
-    mControlPressure      = mPotentialVector[2] - mPotentialVector[3];
-
-    /// - Apply control pressure bias malfunction.
-    if (mMalfPressureBiasFlag) {
-        mControlPressure += mMalfPressureBiasValue;
-    }
-
-    /// - The set point pressure bias is equivalent to an opposite bias on the control pressure.
-    mControlPressure     -= mSetPointPressureBias;
+    updateControlPressure();
 
     /// - Call the virtual updateState method so a derived model can calculate a new valve position.
     updateState(dt);
@@ -424,8 +420,86 @@ void GunnsFluidPressureSensitiveValve::step(const double dt)
             break;   // mTuneMode = OFF, do nothing
     }
 
-    /// - Set the Link Effective Conductance based on the effective conductivity and the blockage
-    ///   fraction.
+    updateAdmittance();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]      dt         (s)   Integration time step.
+/// @param[in]      minorStep  (--)  The network minor step number (not used).
+///
+/// @return         void
+///
+/// @details        When the valve position is solved implicitly, iterates the position from the
+///                 control pressure of the latest network solution and updates the conductivity.
+///                 The valve state and its hysteresis are only updated in the major step, so the
+///                 position follows the same branch of the valve curve over all minor steps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPressureSensitiveValve::minorStep(const double dt,
+                                                 const int    minorStep __attribute__((unused)))
+{
+    if (mImplicitPosition and not mMalfStuckFlag and not mMalfFailToFlag) {
+        updateControlPressure();
+        updateImplicitPosition();
+
+        /// - Call this class's updateState, not the derived one, to only update the effective
+        ///   conductivity from the new position.
+        GunnsFluidPressureSensitiveValve::updateState(dt);
+        updateAdmittance();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]      convergedStep  (--)  The # of minor steps since the network last converged.
+/// @param[in]      absoluteStep   (--)  The absolute minor step number that the network is on.
+///
+/// @return         SolutionResult  (--)  Whether this link confirms or rejects the network solution.
+///
+/// @details        Once the network has converged, rejects the solution if the implicit valve
+///                 position still needs to move by more than its tolerance to agree with the
+///                 control pressure, so the network continues iterating.  Otherwise confirms.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicLink::SolutionResult GunnsFluidPressureSensitiveValve::confirmSolutionAcceptable(
+        const int convergedStep,
+        const int absoluteStep __attribute__((unused)))
+{
+    if (mImplicitPosition and convergedStep > 0 and not mMalfStuckFlag and not mMalfFailToFlag) {
+        updateControlPressure();
+        double       slope  = 0.0;
+        const double target = computeTargetPosition(slope);
+        if (not mPositionSolver.isConverged(mPosition, target, slope)) {
+            return REJECT;
+        }
+    }
+    return CONFIRM;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return         void
+///
+/// @details        Updates the control pressure from the delta pressure across the pressure ports,
+///                 the control pressure bias malfunction and the set point pressure bias.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPressureSensitiveValve::updateControlPressure()
+{
+    mControlPressure      = mPotentialVector[2] - mPotentialVector[3];
+
+    /// - Apply control pressure bias malfunction.
+    if (mMalfPressureBiasFlag) {
+        mControlPressure += mMalfPressureBiasValue;
+    }
+
+    /// - The set point pressure bias is equivalent to an opposite bias on the control pressure.
+    mControlPressure     -= mSetPointPressureBias;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return         void
+///
+/// @details        Sets the link system conductance based on the effective conductivity and the
+///                 blockage fraction, and builds the admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPressureSensitiveValve::updateAdmittance()
+{
     if (mMalfBlockageFlag) {
         mEffectiveConductivity *= (1.0 - mMalfBlockageValue);
     }
@@ -438,6 +512,49 @@ void GunnsFluidPressureSensitiveValve::step(const double dt)
     buildConductance();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]     slope  (1/kPa)  Slope of the target position with respect to control pressure.
+///
+/// @return         double  (--)  Valve position given by the control pressure.
+///
+/// @details        Returns the valve position given by the current control pressure and valve state,
+///                 and its slope with respect to control pressure, for the implicit position solver.
+///                 This base class has no position dynamics, so holds the current position.  Derived
+///                 valves override this with their valve curves.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidPressureSensitiveValve::computeTargetPosition(double& slope) const
+{
+    slope = 0.0;
+    return mPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]      dt  (s)  Integration time step.
+///
+/// @return         void
+///
+/// @details        Begins the implicit valve position solution for a major step, bounding the
+///                 position by the valve stops and the rate limit from the start of the step, then
+///                 takes the first iteration from the last network solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPressureSensitiveValve::beginImplicitPosition(const double dt)
+{
+    mPositionSolver.beginStep(mPosition, mRateLimit * dt);
+    updateImplicitPosition();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return         void
+///
+/// @details        Iterates the implicit valve position from the current control pressure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPressureSensitiveValve::updateImplicitPosition()
+{
+    double       slope  = 0.0;
+    const double target = computeTargetPosition(slope);
+    mPosition = mPositionSolver.update(mPosition, mControlPressure, target, slope);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return         void
 ///
@@ -716,3 +833,26 @@ void GunnsFluidPressureSensitiveValve::setWallTemperature(const double value)
 {
     mWallTemperature = std::max(0.0, value);
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] flag       (--) True solves the valve position implicitly with the network.
+/// @param[in] tolerance  (--) Position convergence tolerance (0-1).
+///
+/// @returns  void
+///
+/// @details  Enables or disables solving the valve position implicitly with the network.  When
+///           enabled, this link is non-linear: the valve position is iterated with the network
+///           solution over the network minor steps, instead of following the last major step's
+///           solution.  This must be set before the network is initialized, as the network checks
+///           its links for non-linearity then.  A tolerance outside (0-1) is rejected with a
+///           warning and the setting is not changed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPressureSensitiveValve::setImplicitPosition(const bool flag, const double tolerance)
+{
+    if (not MsMath::isInRange(DBL_EPSILON, tolerance, 1.0)) {
+        GUNNS_WARNING("rejected implicit position tolerance outside (0-1).");
+    } else {
+        mImplicitPosition = flag;
+        mPositionSolver.setTolerance(tolerance);
+    }
+}
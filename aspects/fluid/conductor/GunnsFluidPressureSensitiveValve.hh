@@ -31,6 +31,7 @@ PROGRAMMERS:
 
 #include "core/GunnsFluidLink.hh"
 #include "core/GunnsFluidUtils.hh"
+#include "aspects/fluid/conductor/GunnsFluidValvePositionSolver.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Fluid Pressure Sensitive Valve Configuration Data
@@ -144,6 +145,13 @@ class GunnsFluidPressureSensitiveValve : public GunnsFluidLink
                         const int                                         pressurePort1);
         /// @brief  Updates this Pressure Sensitive Valve.
         virtual void step(const double dt);
+        /// @brief  Iterates the implicit valve position on network minor steps.
+        virtual void minorStep(const double dt, const int minorStep);
+        /// @brief  Returns whether this Pressure Sensitive Valve is non-linear.
+        virtual bool isNonLinear();
+        /// @brief  Confirms the implicit valve position agrees with the network solution.
+        virtual SolutionResult confirmSolutionAcceptable(const int convergedStep,
+                                                         const int absoluteStep);
         /// @brief  Computes the flows in this Pressure Sensitive Valve.
         virtual void computeFlows(const double dt);
         /// @brief  Transports the flows in this Pressure Sensitive Valve.
@@ -164,6 +172,10 @@ class GunnsFluidPressureSensitiveValve : public GunnsFluidLink
         void   setThermalSurfaceArea(const double value);
         /// @brief    Sets the wall temperature of this Pressure Sensitive Valve.
         void   setWallTemperature(const double value);
+        /// @brief    Enables or disables solving the valve position implicitly with the network.
+        void   setImplicitPosition(const bool flag, const double tolerance = 1.0E-6);
+        /// @brief    Returns whether the valve position is solved implicitly with the network.
+        bool   isImplicitPosition() const;
     protected:
         double        mMaxConductivity;          /**< (m2)            trick_chkpnt_io(**) Link Maximum Conductivity. */
         double        mExpansionScaleFactor;     /**< (--)            trick_chkpnt_io(**) Scaling for isentropic gas cooling (0-1). */
@@ -184,6 +196,8 @@ class GunnsFluidPressureSensitiveValve : public GunnsFluidLink
         double        mSystemConductance;        /**< (kg*mol/kPa/s)  trick_chkpnt_io(**) Limited molar conductance. */
         double        mControlPressure;          /**< (kPa)           trick_chkpnt_io(**) Valve control pressure. */
         double        mWallHeatFlux;             /**< (W)                                 Convection heat flux from the fluid to the tube wall */
+        bool          mImplicitPosition;         /**< (--)                                Valve position is solved implicitly with the network. */
+        GunnsFluidValvePositionSolver mPositionSolver; /**< (--)                          Implicit valve position solver. */
         /// @brief    Updates the state of this Pressure Sensitive Valve.
         virtual void updateState(const double dt);
         /// @brief    Updates the internal fluid of this Pressure Sensitive Valve.
@@ -202,6 +216,16 @@ class GunnsFluidPressureSensitiveValve : public GunnsFluidLink
         virtual void computePower();
         /// @brief    Tunes this Pressure Sensitive Valve conductivity to create the desired flow rate.
         void tuneFlow(const double flowRate);
+        /// @brief    Updates the control pressure from the pressure ports.
+        void updateControlPressure();
+        /// @brief    Updates the link admittance from the effective conductivity.
+        void updateAdmittance();
+        /// @brief    Returns the valve position given by the control pressure, and its slope.
+        virtual double computeTargetPosition(double& slope) const;
+        /// @brief    Begins the implicit valve position solution for a major step.
+        void beginImplicitPosition(const double dt);
+        /// @brief    Iterates the implicit valve position from the latest network solution.
+        void updateImplicitPosition();
     private:
         /// @details  Define the number of ports this link class has.  All objects of the same link
         ///           class always have the same number of ports.  We use an enum rather than a
@@ -242,6 +266,27 @@ inline void GunnsFluidPressureSensitiveValve::setPosition(const double position)
     mPosition = position;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return    bool  (--)  True if the valve position is solved implicitly with the network.
+///
+/// @details   Returns whether this GUNNS Fluid Pressure Sensitive Valve Link Model is non-linear,
+///            which it is when its position is solved implicitly with the network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidPressureSensitiveValve::isNonLinear()
+{
+    return mImplicitPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return    bool  (--)  True if the valve position is solved implicitly with the network.
+///
+/// @details   Returns whether the valve position is solved implicitly with the network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidPressureSensitiveValve::isImplicitPosition() const
+{
+    return mImplicitPosition;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return    void
 ///
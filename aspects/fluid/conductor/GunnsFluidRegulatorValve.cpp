@@ -465,20 +465,57 @@ void GunnsFluidRegulatorValve::updateValveState()
 /// @return         void
 ///
 /// @details        Updates this GUNNS Fluid Pressure Regulator Valve Link Model valve position.
+///                 -# The position is moved towards the target position given by the valve state
+///                    and control pressure (see computeTargetPosition), limited by the rate limit.
+///                 -# When the position is solved implicitly, this takes the first iteration of the
+///                    major step, and the network minor steps continue it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidRegulatorValve::updatePosition(const double dt)
+{
+    if (mImplicitPosition) {
+        beginImplicitPosition(dt);
+    } else {
+        /// - Update position based on state and pressure.
+        double slope          = 0.0;
+        const double position = computeTargetPosition(slope);
+
+        /// - Apply range and rate limiting to the computed position.
+        const double maxDelta = mRateLimit * dt;
+        mPosition             = MsMath::limitRange(std::max(0.0, mPosition - maxDelta),
+                                                 position,
+                                                 std::min(1.0, mPosition + maxDelta));
+    }
+
+    /// - Check that the state is consistent with the rate limited position.
+    if (mPosition > 0.0 && GunnsFluidValve::CLOSED == mState) {
+        mState            = GunnsFluidValve::CLOSING;
+    } else if (mPosition < 1.0 && GunnsFluidValve::OPEN == mState) {
+        mState            = GunnsFluidValve::OPENING;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]     slope  (1/kPa)  Slope of the target position with respect to control pressure.
+///
+/// @return         double  (--)  Valve position given by the valve state and control pressure.
+///
+/// @details        Returns this GUNNS Fluid Pressure Regulator Valve Link Model target valve
+///                 position and its slope with respect to control pressure.
 ///                 -# In CLOSED state, position is 0.0.
 ///                 -# In OPEN state, position is 1.0.
-///                 -# In OPENING state, position is updated from appropriate increasing linear
-///                    equation evaluated at control pressure.
-///                 -# In CLOSING state, position is updated from appropriate decreasing linear
-///                    equation evaluated at control pressure.
-///                 -# In TRANSITIONING state the position is held at its previous value.
+///                 -# In OPENING state, position is from the appropriate decreasing linear equation
+///                    evaluated at control pressure.
+///                 -# In CLOSING state, position is from the appropriate increasing linear equation
+///                    evaluated at control pressure.
+///                 -# In TRANSITIONING state the position is held at its current value.
 ///                 -# For position < mPopPosition, the pop linear equations are used, otherwise
 ///                    the nominal linear equations are used.
+///                 The position is not range limited here.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void GunnsFluidRegulatorValve::updatePosition(const double dt)
+double GunnsFluidRegulatorValve::computeTargetPosition(double& slope) const
 {
-    /// - Update position based on state and pressure.
     double position;
+    slope = 0.0;
 
     switch(mState) {
         case GunnsFluidValve::CLOSED:
@@ -489,36 +526,27 @@ void GunnsFluidRegulatorValve::updatePosition(const double dt)
             break;
         case GunnsFluidValve::OPENING:
             if (mControlPressure >= mPopDecP) {
+                slope     = mPopDecM;
                 position  = mPopDecB + mPopDecM * mControlPressure;
             } else {
+                slope     = mNomDecM;
                 position  = mNomDecB + mNomDecM * mControlPressure;
             }
             break;
         case GunnsFluidValve::CLOSING:
             if (mControlPressure >= mPopIncP) {
+                slope     = mPopIncM;
                 position  = mPopIncB + mPopIncM * mControlPressure;
             } else {
+                slope     = mNomIncM;
                 position  = mNomIncB + mNomIncM * mControlPressure;
             }
             break;
         case GunnsFluidValve::TRANSITIONING:
-            position      = mPosition;
-            break;
         default:
             position      = mPosition;
             break;
     }
 
-    /// - Apply range and rate limiting to the computed position.
-    const double maxDelta = mRateLimit * dt;
-    mPosition             = MsMath::limitRange(std::max(0.0, mPosition - maxDelta),
-                                             position,
-                                             std::min(1.0, mPosition + maxDelta));
-
-    /// - Check that the state is consistent with the rate limited position.
-    if (mPosition > 0.0 && GunnsFluidValve::CLOSED == mState) {
-        mState            = GunnsFluidValve::CLOSING;
-    } else if (mPosition < 1.0 && GunnsFluidValve::OPEN == mState) {
-        mState            = GunnsFluidValve::OPENING;
-    }
+    return position;
 }
@@ -462,20 +462,57 @@ void GunnsFluidReliefValve::updateValveState()
 /// @return         void
 ///
 /// @details        Updates this this GUNNS Fluid Pressure Relief Valve Link Model valve position.
+///                 -# The position is moved towards the target position given by the valve state
+///                    and control pressure (see computeTargetPosition), limited by the rate limit.
+///                 -# When the position is solved implicitly, this takes the first iteration of the
+///                    major step, and the network minor steps continue it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidReliefValve::updatePosition(const double dt)
+{
+    if (mImplicitPosition) {
+        beginImplicitPosition(dt);
+    } else {
+        /// - Update position based on state and control pressure.
+        double slope          = 0.0;
+        const double position = computeTargetPosition(slope);
+
+        /// - Apply range and rate limiting to the computed position.
+        const double maxDelta = mRateLimit * dt;
+        mPosition             = MsMath::limitRange(std::max(0.0, mPosition - maxDelta),
+                                                 position,
+                                                 std::min(1.0, mPosition + maxDelta));
+    }
+
+    /// - Check that the state is consistent with the rate limited position.
+    if (mPosition > 0.0 && GunnsFluidValve::CLOSED == mState) {
+        mState            = GunnsFluidValve::CLOSING;
+    } else if (mPosition < 1.0 && GunnsFluidValve::OPEN == mState) {
+        mState            = GunnsFluidValve::OPENING;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]     slope  (1/kPa)  Slope of the target position with respect to control pressure.
+///
+/// @return         double  (--)  Valve position given by the valve state and control pressure.
+///
+/// @details        Returns this GUNNS Fluid Pressure Relief Valve Link Model target valve position
+///                 and its slope with respect to control pressure.
 ///                 -# In CLOSED state, position is 0.0.
 ///                 -# In OPEN state, position is 1.0.
-///                 -# In OPENING state, position is updated from appropriate increasing linear
-///                    equation evaluated at current pressure.
-///                 -# In CLOSING state, position is updated from appropriate decreasing linear
-///                    equation evaluated at current pressure.
-///                 -# In TRANSITIONING state the position is held at its previous value.
+///                 -# In OPENING state, position is from the appropriate increasing linear equation
+///                    evaluated at current pressure.
+///                 -# In CLOSING state, position is from the appropriate decreasing linear equation
+///                    evaluated at current pressure.
+///                 -# In TRANSITIONING state the position is held at its current value.
 ///                 -# For position < mPopPosition, the pop linear equations are used, otherwise
 ///                    the nominal linear equations are used.
+///                 The position is not range limited here.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void GunnsFluidReliefValve::updatePosition(const double dt)
+double GunnsFluidReliefValve::computeTargetPosition(double& slope) const
 {
-    /// - Update position based on state and control pressure.
     double position;
+    slope = 0.0;
 
     switch(mState) {
         case GunnsFluidValve::CLOSED:
@@ -486,15 +523,19 @@ void GunnsFluidReliefValve::updatePosition(const double dt)
             break;
         case GunnsFluidValve::OPENING:
             if (mControlPressure <= mPopIncP) {
+                slope     = mPopIncM;
                 position  = mPopIncB + mPopIncM * mControlPressure;
             } else {
+                slope     = mNomIncM;
                 position  = mNomIncB + mNomIncM * mControlPressure;
             }
             break;
         case GunnsFluidValve::CLOSING:
             if (mControlPressure <= mPopDecP) {
+                slope     = mPopDecM;
                 position  = mPopDecB + mPopDecM * mControlPressure;
             } else {
+                slope     = mNomDecM;
                 position  = mNomDecB + mNomDecM * mControlPressure;
             }
             break;
@@ -504,16 +545,5 @@ void GunnsFluidReliefValve::updatePosition(const double dt)
             break;
     }
 
-    /// - Apply range and rate limiting to the computed position.
-    const double maxDelta = mRateLimit * dt;
-    mPosition             = MsMath::limitRange(std::max(0.0, mPosition - maxDelta),
-                                             position,
-                                             std::min(1.0, mPosition + maxDelta));
-
-    /// - Check that the state is consistent with the rate limited position.
-    if (mPosition > 0.0 && GunnsFluidValve::CLOSED == mState) {
-        mState            = GunnsFluidValve::CLOSING;
-    } else if (mPosition < 1.0 && GunnsFluidValve::OPEN == mState) {
-        mState            = GunnsFluidValve::OPENING;
-    }
+    return position;
 }
@@ -189,6 +189,8 @@ class GunnsFluidReliefValve : public  GunnsFluidPressureSensitiveValve
         void updateValveState();
         /// @brief    Updates the valve position of this Pressure Relief Valve.
         void updatePosition(const double dt);
+        /// @brief    Returns the valve position given by the control pressure, and its slope.
+        virtual double computeTargetPosition(double& slope) const;
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
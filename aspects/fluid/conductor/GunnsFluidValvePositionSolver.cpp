@@ -0,0 +1,162 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((math/MsMath.o))
+***************************************************************************************************/
+
+#include <cfloat>
+#include <cmath>
+
+#include "math/MsMath.hh"
+
+#include "GunnsFluidValvePositionSolver.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Fluid Valve Position Solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidValvePositionSolver::GunnsFluidValvePositionSolver()
+    :
+    mTolerance(1.0E-6),
+    mLowerLimit(0.0),
+    mUpperLimit(1.0),
+    mSensitivity(0.0),
+    mLastPosition(0.0),
+    mLastPressure(0.0),
+    mHasLast(false),
+    mResidual(0.0),
+    mIterations(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Valve Position Solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidValvePositionSolver::~GunnsFluidValvePositionSolver()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] position (--) Valve position at the start of the major step.
+/// @param[in] maxDelta (--) Maximum position change allowed in the major step.
+///
+/// @details  Sets the position bounds for the major step from the valve stops and rate limit, and
+///           forgets the last update so the secant isn't taken across major steps.  The sensitivity
+///           estimate is kept from the last major step as the starting estimate for this one.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidValvePositionSolver::beginStep(const double position, const double maxDelta)
+{
+    mLowerLimit = std::max(0.0, position - maxDelta);
+    mUpperLimit = std::min(1.0, position + maxDelta);
+    mHasLast    = false;
+    mIterations = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] position (--)    Current valve position.
+/// @param[in] pressure (kPa)   Control pressure from the latest network solution.
+/// @param[in] target   (--)    Valve position given by the control pressure.
+/// @param[in] slope    (1/kPa) Slope of the target position with respect to control pressure.
+///
+/// @returns  double (--) The new valve position.
+///
+/// @details  Updates the secant estimate of the control pressure response to position from the
+///           last update in this major step, then returns the position after a bounded Newton step
+///           towards the target.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidValvePositionSolver::update(const double position,
+                                             const double pressure,
+                                             const double target,
+                                             const double slope)
+{
+    /// - Update the secant estimate when the position has moved enough to resolve it.
+    if (mHasLast) {
+        const double deltaPosition = position - mLastPosition;
+        if (std::fabs(deltaPosition) > FLT_EPSILON) {
+            mSensitivity = (pressure - mLastPressure) / deltaPosition;
+        }
+    }
+    mLastPosition = position;
+    mLastPressure = pressure;
+    mHasLast      = true;
+    ++mIterations;
+
+    return position + computeStep(mResidual, position, target, slope);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] position (--)    Current valve position.
+/// @param[in] target   (--)    Valve position given by the control pressure.
+/// @param[in] slope    (1/kPa) Slope of the target position with respect to control pressure.
+///
+/// @returns  bool (--) True if the position doesn't need to move by more than the tolerance.
+///
+/// @details  Returns whether the position agrees with the target to within the tolerance, allowing
+///           for the bounds and the network's response to the position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidValvePositionSolver::isConverged(const double position,
+                                                const double target,
+                                                const double slope) const
+{
+    double residual = 0.0;
+    return 0.0 == computeStep(residual, position, target, slope);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] residual (--)    Residual between the position and target.
+/// @param[in]  position (--)    Current valve position.
+/// @param[in]  target   (--)    Valve position given by the control pressure.
+/// @param[in]  slope    (1/kPa) Slope of the target position with respect to control pressure.
+///
+/// @returns  double (--) The position step, or zero if it is within the tolerance.
+///
+/// @details  Computes the residual and returns the Newton step to null it, with the new position
+///           projected onto the bounds.  Projecting the step rather than the target keeps the full
+///           Newton step while the solution is inside the bounds, and when the solution is beyond a
+///           bound, the projected step against the bound is zero so the position settles there.
+///           The Jacobian is not allowed below 1, the explicit update, which also covers a network
+///           response that reinforces the valve motion or has not been estimated yet.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidValvePositionSolver::computeStep(double&      residual,
+                                                  const double position,
+                                                  const double target,
+                                                  const double slope) const
+{
+    residual = position - target;
+
+    /// - Newton step with the valve slope and estimated network response.  The negated comparison
+    ///   also catches a NaN Jacobian.
+    double jacobian = 1.0 - slope * mSensitivity;
+    if (not (jacobian >= 1.0)) {
+        jacobian = 1.0;
+    }
+    const double newPosition = MsMath::limitRange(mLowerLimit,
+                                                  position - residual / jacobian,
+                                                  mUpperLimit);
+
+    /// - Don't take steps within the tolerance, so a settled valve doesn't keep changing its
+    ///   conductance.
+    const double step = newPosition - position;
+    if (std::fabs(step) <= mTolerance) {
+        return 0.0;
+    }
+    return step;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Resets the solver state, including the sensitivity estimate, for a restart.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidValvePositionSolver::reset()
+{
+    mLowerLimit   = 0.0;
+    mUpperLimit   = 1.0;
+    mSensitivity  = 0.0;
+    mLastPosition = 0.0;
+    mLastPressure = 0.0;
+    mHasLast      = false;
+    mResidual     = 0.0;
+    mIterations   = 0;
+}
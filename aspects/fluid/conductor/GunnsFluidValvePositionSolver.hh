@@ -0,0 +1,172 @@
+#ifndef GunnsFluidValvePositionSolver_EXISTS
+#define GunnsFluidValvePositionSolver_EXISTS
+
+/**
+@defgroup  TSM_GUNNS_FLUID_CONDUCTOR_VALVE_POSITION_SOLVER   Implicit Valve Position Solver
+@ingroup   TSM_GUNNS_FLUID_CONDUCTOR
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Class for the GUNNS Fluid Valve Position Solver, which iterates a pressure-driven valve position
+   to agree with the network solution over the network minor steps.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The network response of the control pressure to the valve position is estimated by secant from
+   the previous minor step, and is assumed to oppose the valve motion, as it does for regulators,
+   relief valves and check valves.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsFluidValvePositionSolver.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <algorithm>
+#include <cfloat>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Valve Position Solver
+///
+/// @details  Pressure-driven valves normally move their position towards the position given by
+///           their control pressure from the previous network solution.  When the network control
+///           pressure is sensitive to the valve position, as for a regulator controlling its own
+///           outlet pressure, this explicit update over-corrects and the valve chatters.
+///
+///           This solves the position implicitly with the network instead.  The owning valve calls
+///           update each minor step with its control pressure from the latest network solution, and
+///           its target position and the target's slope with respect to control pressure.  The
+///           residual between the position and target is driven to zero by a Newton step, whose
+///           Jacobian combines the valve's slope with a secant estimate of the network's control
+///           pressure response to position, taken from successive minor steps:
+///           \verbatim
+///               r  = x - f(p)
+///               dx = -r / (1 - f'(p) * dp/dx)
+///           \endverbatim
+///           The valve stops and the rate limit over the major step are bounds on the position,
+///           and each new position is projected onto them.  The iteration settles on either the
+///           unconstrained solution, or a bound with the residual pushing against it, as in a
+///           complementarity problem.  Steps smaller than the
+///           tolerance aren't taken, so a converged valve stops changing its conductance and
+///           causing the network to rebuild its admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidValvePositionSolver
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidValvePositionSolver);
+    public:
+        /// @brief  Default constructs this Valve Position Solver.
+        GunnsFluidValvePositionSolver();
+        /// @brief  Default destructs this Valve Position Solver.
+        virtual ~GunnsFluidValvePositionSolver();
+        /// @brief  Sets the position convergence tolerance.
+        void   setTolerance(const double tolerance);
+        /// @brief  Begins a major step, setting the position bounds from the rate limit.
+        void   beginStep(const double position, const double maxDelta);
+        /// @brief  Returns the position iterated from the latest network solution.
+        double update(const double position,
+                      const double pressure,
+                      const double target,
+                      const double slope);
+        /// @brief  Returns whether the position agrees with the target to within the tolerance.
+        bool   isConverged(const double position, const double target, const double slope) const;
+        /// @brief  Resets the solver state.
+        void   reset();
+        /// @brief  Returns the position convergence tolerance.
+        double getTolerance() const;
+        /// @brief  Returns the estimated control pressure response to position.
+        double getSensitivity() const;
+        /// @brief  Returns the last residual between the position and target.
+        double getResidual() const;
+        /// @brief  Returns the number of updates in this major step.
+        int    getIterations() const;
+
+    protected:
+        double mTolerance;    /**< (--)                     Position convergence tolerance. */
+        double mLowerLimit;   /**< (--)                     Lower position bound this major step. */
+        double mUpperLimit;   /**< (--)                     Upper position bound this major step. */
+        double mSensitivity;  /**< (kPa)                    Estimated control pressure response to position. */
+        double mLastPosition; /**< (--)  trick_chkpnt_io(**) Position at the last update. */
+        double mLastPressure; /**< (kPa) trick_chkpnt_io(**) Control pressure at the last update. */
+        bool   mHasLast;      /**< (--)  trick_chkpnt_io(**) The last update values are from this major step. */
+        double mResidual;     /**< (--)  trick_chkpnt_io(**) Last residual between the position and target. */
+        int    mIterations;   /**< (--)  trick_chkpnt_io(**) Number of updates in this major step. */
+        /// @brief  Returns the bounded Newton step from the position towards the target.
+        double computeStep(double&      residual,
+                           const double position,
+                           const double target,
+                           const double slope) const;
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsFluidValvePositionSolver(const GunnsFluidValvePositionSolver&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsFluidValvePositionSolver& operator =(const GunnsFluidValvePositionSolver&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] tolerance (--) Position convergence tolerance.
+///
+/// @details  Sets the position convergence tolerance.  Values less than DBL_EPSILON are limited to
+///           DBL_EPSILON.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsFluidValvePositionSolver::setTolerance(const double tolerance)
+{
+    mTolerance = std::max(tolerance, DBL_EPSILON);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) Position convergence tolerance.
+///
+/// @details  Returns the position convergence tolerance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsFluidValvePositionSolver::getTolerance() const
+{
+    return mTolerance;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (kPa) Estimated control pressure response to position.
+///
+/// @details  Returns the estimated change in control pressure per unit change in position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsFluidValvePositionSolver::getSensitivity() const
+{
+    return mSensitivity;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) Last residual between the position and target.
+///
+/// @details  Returns the residual between the position and target at the last update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsFluidValvePositionSolver::getResidual() const
+{
+    return mResidual;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of updates in this major step.
+///
+/// @details  Returns the number of updates since the start of the major step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsFluidValvePositionSolver::getIterations() const
+{
+    return mIterations;
+}
+
+#endif
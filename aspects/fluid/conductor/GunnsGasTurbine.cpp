@@ -7,6 +7,7 @@
 
 LIBRARY DEPENDENCY:
    ((aspects/fluid/potential/GunnsGasFanCurve.o)
+    (aspects/fluid/potential/GunnsTurbomachineMap.o)
     (software/exceptions/TsInitializationException.o))
 **************************************************************************************************/
 
@@ -51,6 +52,9 @@ LIBRARY DEPENDENCY:
 /// @param[in]     thermalLength        (m)              Impeller length for thermal convection.
 /// @param[in]     thermalDiameter      (m)              Impeller inner diameter for thermal convection.
 /// @param[in]     surfaceRoughness     (m)              Impeller wall surface roughness for convection.
+/// @param[in]     mapSpeedPoints       (--)             Number of corrected speed points in the performance map.
+/// @param[in]     mapRatioPoints       (--)             Number of pressure ratio points in the performance map.
+/// @param[in]     mapMaxRatio          (--)             Highest pressure ratio in the performance map.
 ///
 /// @details  Default constructs this GUNNS Gas Turbine link model configuration data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,7 +92,10 @@ GunnsGasTurbineConfigData::GunnsGasTurbineConfigData(const std::string& name,
                                                      const double       driveRatio,
                                                      const double       thermalLength,
                                                      const double       thermalDiameter,
-                                                     const double       surfaceRoughness)
+                                                     const double       surfaceRoughness,
+                                                     const int          mapSpeedPoints,
+                                                     const int          mapRatioPoints,
+                                                     const double       mapMaxRatio)
     :
     GunnsFluidConductorConfigData(name, nodes, maxConductivity, expansionScaleFactor),
     mReferenceTemp      (referenceTemp),
@@ -121,7 +128,10 @@ GunnsGasTurbineConfigData::GunnsGasTurbineConfigData(const std::string& name,
     mDriveRatio         (driveRatio),
     mThermalLength      (thermalLength),
     mThermalDiameter    (thermalDiameter),
-    mSurfaceRoughness   (surfaceRoughness)
+    mSurfaceRoughness   (surfaceRoughness),
+    mMapSpeedPoints     (mapSpeedPoints),
+    mMapRatioPoints     (mapRatioPoints),
+    mMapMaxRatio        (mapMaxRatio)
 {
     // nothing to do
 }
@@ -164,7 +174,10 @@ GunnsGasTurbineConfigData::GunnsGasTurbineConfigData(const GunnsGasTurbineConfig
     mDriveRatio         (that.mDriveRatio),
     mThermalLength      (that.mThermalLength),
     mThermalDiameter    (that.mThermalDiameter),
-    mSurfaceRoughness   (that.mSurfaceRoughness)
+    mSurfaceRoughness   (that.mSurfaceRoughness),
+    mMapSpeedPoints     (that.mMapSpeedPoints),
+    mMapRatioPoints     (that.mMapRatioPoints),
+    mMapMaxRatio        (that.mMapMaxRatio)
 {
     // nothing to do
 }
@@ -257,7 +270,8 @@ GunnsGasTurbine::GunnsGasTurbine()
     mWallHeatFlux(0.0),
     mImpellerTorque(0.0),
     mImpellerPower(0.0),
-    mPredictedFlowRate(0.0)
+    mPredictedFlowRate(0.0),
+    mMap()
 {
     for (int i=0; i<6; ++i) {
         mEffCoeffLowSpeed[i] = 0.0;
@@ -354,6 +368,9 @@ void GunnsGasTurbine::initialize(const GunnsGasTurbineConfigData&  configData,
     /// - Validates the link initialization.
     validate();
 
+    /// - Pre-compute the optional performance map from the validated curves.
+    buildMap(configData);
+
     /// - Set initialization status flag to indicate successful initialization.
     mInitFlag           = true;
 }
@@ -487,23 +504,18 @@ void GunnsGasTurbine::updateFluid(const double dt __attribute__((unused)), const
     const int    sourcePort = determineSourcePort(mFlux, 0, 1);
     const double sourceTemp = std::max(DBL_EPSILON, mNodes[sourcePort]->getOutflow()->getTemperature());
 
-    /// - Scale efficiency curve based on impeller speed, using interpolation
-    double scaledEffCoeffs[6];
+    /// - Scale efficiency curve based on impeller speed, using interpolation, or look up the
+    ///   efficiency in the performance map when it covers the pressure ratio.
     const double correctedSpeed = MsMath::limitRange(mCorrectedSpeedLow,
             mImpellerSpeed/(sourceTemp/mReferenceTemp), mCorrectedSpeedHigh);
-    const double frac = (correctedSpeed   - mCorrectedSpeedLow)
-                      / (mCorrectedSpeedHigh - mCorrectedSpeedLow);
-    for(int order = 0; order < 6; order ++){
-        scaledEffCoeffs[order] =  interpolate(mEffCoeffLowSpeed[order], mEffCoeffHighSpeed[order], frac);
-    }
-    const double minEffLimit = interpolate(mMinEffLimLowSpeed, mMinEffLimHighSpeed, frac);
-    const double maxEffLimit = interpolate(mMaxEffLimLowSpeed, mMaxEffLimHighSpeed, frac);
-
-    if(mPressureRatio >= minEffLimit and mPressureRatio <= maxEffLimit){
-        mCurve.setCoeffs(scaledEffCoeffs);
-        mEfficiency = MsMath::limitRange(0.0, mCurve.evaluate(mPressureRatio), 1.0);
-    } else{
-        mEfficiency = 0.0 ;
+    if (isInMap(mPressureRatio)) {
+        double flow = 0.0;
+        mMap.lookup(flow, mEfficiency, correctedSpeed, mPressureRatio);
+        mEfficiency = MsMath::limitRange(0.0, mEfficiency, 1.0);
+    } else {
+        const double frac = (correctedSpeed   - mCorrectedSpeedLow)
+                          / (mCorrectedSpeedHigh - mCorrectedSpeedLow);
+        mEfficiency = computeEfficiency(frac, mPressureRatio);
     }
 
     mImpellerPower = -UnitConversion::PA_PER_KPA * fabs(mVolFlowRate) * mPressureDrop * mEfficiency;
@@ -549,26 +561,29 @@ void GunnsGasTurbine::computeFlowRate()
 
     /// - The impeller generates no flow if there is no inlet density
     if (sourceDensity > FLT_EPSILON ) {
-        /// - Scale Turbine curve coefficients based on corrected impeller speed, using interpolation
         const double correctedSpeed = MsMath::limitRange(mCorrectedSpeedLow,
                 mImpellerSpeed/(sourceTemp/mReferenceTemp), mCorrectedSpeedHigh);
-        const double frac = (correctedSpeed   - mCorrectedSpeedLow)
-                          / (mCorrectedSpeedHigh - mCorrectedSpeedLow);
 
-        const double maxFlow =  interpolate(mLowSpeedMaxFlow, mHighSpeedMaxFlow, frac);
-        const double riseCoeff1 =  interpolate(mCoeffLowSpeed1, mCoeffHighSpeed1, frac);
-        const double riseCoeff2 =  interpolate(mCoeffLowSpeed2, mCoeffHighSpeed2, frac);
-
-        /// - Calculate flow rate based on scaled performance curve and previous pressure drop.
+        /// - Calculate pressure ratio based on previous pressure drop.
         mPressureDrop  = mFilterGain * getDeltaPotential() + (1.0 - mFilterGain) * mPressureDrop;
         mPressureRatio =  std::max(1.0, sourcePress/std::max(DBL_EPSILON, (sourcePress
                        - mPressureDrop)));
-        const double correctedMassFlow = maxFlow*((mPressureRatio - 1.0)*(mPressureRatio - 1.0)
-                                       + riseCoeff1*(mPressureRatio - 1.0))/std::max(DBL_EPSILON,
-                                               (mPressureRatio*mPressureRatio + riseCoeff2));
         const double correctionFactor = (sourcePress/mReferencePress)/sqrt(sourceTemp/mReferenceTemp);
 
-        mPredictedFlowRate =  correctedMassFlow * correctionFactor;
+        if (isInMap(mPressureRatio)) {
+            /// - Look up corrected flow in the performance map.
+            double correctedMassFlow = 0.0;
+            double efficiency        = 0.0;
+            mMap.lookup(correctedMassFlow, efficiency, correctedSpeed, mPressureRatio);
+            mPredictedFlowRate = correctedMassFlow * correctionFactor;
+        } else {
+            /// - Scale Turbine curve coefficients based on corrected impeller speed, using
+            ///   interpolation, and evaluate the scaled performance curve.  This is also used
+            ///   beyond the map's pressure ratio range, rather than freezing at the map edge.
+            const double frac = (correctedSpeed   - mCorrectedSpeedLow)
+                              / (mCorrectedSpeedHigh - mCorrectedSpeedLow);
+            mPredictedFlowRate = computeCorrectedFlow(frac, mPressureRatio) * correctionFactor;
+        }
     }else {
         mPredictedFlowRate = 0.0;
     }
@@ -583,6 +598,86 @@ double GunnsGasTurbine::interpolate(double y1, double y2, double fraction){
     return y1 + fraction*(y2 - y1);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frac          (--) Fraction (0-1) of corrected speed between the low & high curves.
+/// @param[in] pressureRatio (--) Pressure ratio (inlet/outlet) across the turbine.
+///
+/// @returns  double (kg/s) Corrected mass flow rate.
+///
+/// @details  Interpolates the flow curve coefficients between the low & high speed curves and
+///           evaluates the scaled flow curve at the given pressure ratio.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsGasTurbine::computeCorrectedFlow(const double frac, const double pressureRatio)
+{
+    const double maxFlow    = interpolate(mLowSpeedMaxFlow, mHighSpeedMaxFlow, frac);
+    const double riseCoeff1 = interpolate(mCoeffLowSpeed1, mCoeffHighSpeed1, frac);
+    const double riseCoeff2 = interpolate(mCoeffLowSpeed2, mCoeffHighSpeed2, frac);
+    return maxFlow*((pressureRatio - 1.0)*(pressureRatio - 1.0) + riseCoeff1*(pressureRatio - 1.0))
+         / std::max(DBL_EPSILON, (pressureRatio*pressureRatio + riseCoeff2));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frac          (--) Fraction (0-1) of corrected speed between the low & high curves.
+/// @param[in] pressureRatio (--) Pressure ratio (inlet/outlet) across the turbine.
+///
+/// @returns  double (--) Efficiency (0-1).
+///
+/// @details  Interpolates the efficiency curve coefficients and limits between the low & high
+///           speed curves and evaluates the scaled efficiency curve at the given pressure ratio.
+///           Efficiency is zero outside of the curve limits.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsGasTurbine::computeEfficiency(const double frac, const double pressureRatio)
+{
+    double scaledEffCoeffs[6];
+    for(int order = 0; order < 6; order ++){
+        scaledEffCoeffs[order] =  interpolate(mEffCoeffLowSpeed[order], mEffCoeffHighSpeed[order], frac);
+    }
+    const double minEffLimit = interpolate(mMinEffLimLowSpeed, mMinEffLimHighSpeed, frac);
+    const double maxEffLimit = interpolate(mMaxEffLimLowSpeed, mMaxEffLimHighSpeed, frac);
+
+    double efficiency = 0.0;
+    if(pressureRatio >= minEffLimit and pressureRatio <= maxEffLimit){
+        mCurve.setCoeffs(scaledEffCoeffs);
+        efficiency = MsMath::limitRange(0.0, mCurve.evaluate(pressureRatio), 1.0);
+        mCurve.setCoeffs(0);
+    }
+    return efficiency;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] configData (--) Configuration data.
+///
+/// @throws   TsInitializationException
+///
+/// @details  When configured, evaluates the flow and efficiency curves at every point of the
+///           performance map: corrected speed from the low to high reference speeds, and pressure
+///           ratio from 1 to the configured map max ratio, defaulting to the larger of the max
+///           efficiency limits.  Otherwise the map is left uninitialized and the curves are
+///           evaluated directly every step.  Pressure ratios beyond the map range are always
+///           evaluated directly from the curves.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsGasTurbine::buildMap(const GunnsGasTurbineConfigData& configData)
+{
+    if (configData.mMapSpeedPoints > 0) {
+        double maxRatio = configData.mMapMaxRatio;
+        if (maxRatio <= 1.0) {
+            maxRatio = std::max(mMaxEffLimLowSpeed, mMaxEffLimHighSpeed);
+        }
+        mMap.initialize(mName + ".mMap", configData.mMapSpeedPoints, mCorrectedSpeedLow,
+                        mCorrectedSpeedHigh, configData.mMapRatioPoints, 1.0, maxRatio);
+
+        for (int i = 0; i < mMap.getNumSpeeds(); ++i) {
+            const double frac = (mMap.getSpeed(i) - mCorrectedSpeedLow)
+                              / (mCorrectedSpeedHigh - mCorrectedSpeedLow);
+            for (int j = 0; j < mMap.getNumRatios(); ++j) {
+                const double ratio = mMap.getRatio(j);
+                mMap.setPoint(i, j, computeCorrectedFlow(frac, ratio),
+                                    computeEfficiency(frac, ratio));
+            }
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] value   (m2)    New Thermal Surface Area.
 ///
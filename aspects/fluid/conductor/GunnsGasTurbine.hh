@@ -32,6 +32,7 @@ PROGRAMMERS:
 
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "aspects/fluid/potential/GunnsGasFanCurve.hh"
+#include "aspects/fluid/potential/GunnsTurbomachineMap.hh"
 #include "core/GunnsFluidConductor.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,6 +76,13 @@ class GunnsGasTurbineConfigData : public GunnsFluidConductorConfigData
         double mThermalLength;     /**< (m)              trick_chkpnt_io(**) Impeller length for thermal convection                        */
         double mThermalDiameter;   /**< (m)              trick_chkpnt_io(**) Impeller inner diameter for thermal convection                */
         double mSurfaceRoughness;  /**< (m)              trick_chkpnt_io(**) Impeller wall surface roughness for thermal convection        */
+        /// @details The optional performance map replaces the per-step curve evaluations with a table
+        ///          lookup.  The default zero map speed points disables the map and evaluates the
+        ///          curves directly.
+        int    mMapSpeedPoints;    /**< (--)             trick_chkpnt_io(**) Number of corrected speed points in the performance map       */
+        int    mMapRatioPoints;    /**< (--)             trick_chkpnt_io(**) Number of pressure ratio points in the performance map        */
+        /// @details Zero defaults to the larger of the max efficiency limits.
+        double mMapMaxRatio;       /**< (--)             trick_chkpnt_io(**) Highest pressure ratio in the performance map                 */
         /// @}
         /// @brief  Default constructs this Gas Turbine configuration data.
         GunnsGasTurbineConfigData(const std::string& name                 = "",
@@ -111,7 +119,10 @@ class GunnsGasTurbineConfigData : public GunnsFluidConductorConfigData
                                   const double       driveRatio           = 1.0,
                                   const double       thermalLength        = 0.0,
                                   const double       thermalDiameter      = 0.0,
-                                  const double       surfaceRoughness     = 0.0);
+                                  const double       surfaceRoughness     = 0.0,
+                                  const int          mapSpeedPoints       = 0,
+                                  const int          mapRatioPoints       = 0,
+                                  const double       mapMaxRatio          = 0.0);
         /// @brief  Copy constructs this Gas Turbine configuration data.
         GunnsGasTurbineConfigData(const GunnsGasTurbineConfigData& that);
         /// @brief  Default destructs this Gas Turbine configuration data.
@@ -166,6 +177,13 @@ class GunnsGasTurbineInputData : public GunnsFluidConductorInputData
 ///           operating conditions of the turbine. Performance at speeds between these references are
 ///           calculated using interpolation.
 ///
+///           Optionally, the curves can be pre-computed at initialization into a performance map
+///           (GunnsTurbomachineMap) of corrected flow and efficiency vs. corrected speed and
+///           pressure ratio.  Then each step does a single table lookup instead of interpolating
+///           the curve coefficients and evaluating the polynomials.  Pressure ratios beyond the
+///           map range fall back to evaluating the curves directly, so the flow rate doesn't freeze
+///           at the map edge.  The map is only built when configured with map speed points.
+///
 ///           This model can be used by the GunnsDriveShaftSpotter model to simulate a drive shaft
 ///           connection between a compressor/fan and turbine.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +250,7 @@ class GunnsGasTurbine : public GunnsFluidConductor
         double mImpellerTorque;      /**< (N*m)                                Impeller fluid torque opposing rotation output to simbus*/
         double mImpellerPower;       /**< (W)              trick_chkpnt_io(**) Power imparted to the shaft by the fluid                */
         double mPredictedFlowRate;   /**< (kg/s)           trick_chkpnt_io(**) Predicted flow rate based on turbine map and press ratio*/
+        GunnsTurbomachineMap mMap;   /**< (--)             trick_chkpnt_io(**) Optional pre-computed performance map                   */
         /// @brief  Validates the initialization of this Gas Turbine.
         void          validate() const;
         /// @brief Virtual method for derived links to perform their restart functions.
@@ -244,6 +263,14 @@ class GunnsGasTurbine : public GunnsFluidConductor
         virtual void  computeFlowRate();
         /// @brief  Perform linear interpolation
         double        interpolate(double y1, double y2, double fraction);
+        /// @brief  Builds the performance map from the performance curves.
+        void          buildMap(const GunnsGasTurbineConfigData& configData);
+        /// @brief  Returns whether the performance map covers the given pressure ratio.
+        bool          isInMap(const double pressureRatio) const;
+        /// @brief  Evaluates the corrected flow rate curves at the given speed fraction & ratio.
+        double        computeCorrectedFlow(const double frac, const double pressureRatio);
+        /// @brief  Evaluates the efficiency curves at the given speed fraction & ratio.
+        double        computeEfficiency(const double frac, const double pressureRatio);
 
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,4 +326,18 @@ inline double GunnsGasTurbine::getImpellerPower()
     return mImpellerPower;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] pressureRatio (--) Pressure ratio (inlet/outlet) across the turbine.
+///
+/// @returns  bool (--) True if the performance map is used and covers the given pressure ratio.
+///
+/// @details  The map's pressure ratio range starts at 1, and the pressure ratio is never below 1,
+///           so only the upper end of the range is checked.  The corrected speed is always limited
+///           to the map's speed range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsGasTurbine::isInMap(const double pressureRatio) const
+{
+    return mMap.isInitialized() and pressureRatio <= mMap.getRatio(mMap.getNumRatios() - 1);
+}
+
 #endif
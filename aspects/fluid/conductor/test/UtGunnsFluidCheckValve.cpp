@@ -589,6 +589,65 @@ void UtGunnsFluidCheckValve::testUpdateStateMalfunction()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Check Valve link model implicit valve position.  The network is
+///           emulated by setting the delta pressure across the valve as a linear function of the
+///           position before each minor step, falling as the valve opens.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidCheckValve::testImplicitPosition()
+{
+    UT_RESULT;
+
+    /// - Initialize default test article with nominal initialization data.
+    mArticle->initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1);
+
+    /// @test    Explicit position by default, and invalid tolerances are rejected.
+    CPPUNIT_ASSERT(not mArticle->isNonLinear());
+    mArticle->setImplicitPosition(true, -1.0);
+    CPPUNIT_ASSERT(not mArticle->isImplicitPosition());
+
+    /// @test    Setting implicit position makes the link non-linear.
+    mArticle->setImplicitPosition(true, 1.0e-10);
+    CPPUNIT_ASSERT(mArticle->isImplicitPosition());
+    CPPUNIT_ASSERT(mArticle->isNonLinear());
+
+    /// - Closed valve with effectively no rate limit.
+    mArticle->mPosition      = 0.0;
+    mArticle->mRateLimit     = 1.0 / mTimeStep;
+    const double base        = 0.9;
+    const double response    = -0.5;
+    const double expected    = (base - mClosePressure) / (mOpenPressure - mClosePressure - response);
+    mArticle->mPotentialVector[1] = 0.0;
+
+    /// @test    The major step takes the explicit update.
+    mArticle->mPotentialDrop = base;
+    mArticle->updateState(mTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL((base - mClosePressure) / (mOpenPressure - mClosePressure),
+                                 mArticle->mPosition, mTolerance);
+
+    /// @test    Minor steps converge to the position agreeing with the network, rejecting the
+    ///          solution until they do, then confirming it.
+    int minorStep = 2;
+    for (; minorStep < 10; ++minorStep) {
+        mArticle->mPotentialVector[0] = base + response * mArticle->mPosition;
+        if (GunnsBasicLink::CONFIRM == mArticle->confirmSolutionAcceptable(1, minorStep)) {
+            break;
+        }
+        mArticle->minorStep(mTimeStep, minorStep);
+    }
+    CPPUNIT_ASSERT(minorStep < 10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, mArticle->mPosition, 1.0e-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mMaxConductivity * expected, mArticle->mEffectiveConductivity,
+                                 mTolerance);
+    CPPUNIT_ASSERT(mArticle->mAdmittanceMatrix[0] > 0.0);
+
+    /// @test    Restart resets the solver.
+    mArticle->restartModel();
+    CPPUNIT_ASSERT_EQUAL(0.0, mArticle->mPositionSolver.getSensitivity());
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests for GUNNS Fluid Check Valve link model initialization exceptions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
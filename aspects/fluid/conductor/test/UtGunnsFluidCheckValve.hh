@@ -69,6 +69,8 @@ class UtGunnsFluidCheckValve: public CppUnit::TestFixture
         void testUpdateStateNoRange();
         /// @brief    Tests update state method (malfunction).
         void testUpdateStateMalfunction();
+        /// @brief    Tests implicit valve position solution with the network minor steps.
+        void testImplicitPosition();
         /// @brief    Tests initialize method exceptions.
         void testInitializationExceptions();
     private:
@@ -82,6 +84,7 @@ class UtGunnsFluidCheckValve: public CppUnit::TestFixture
         CPPUNIT_TEST(testUpdateStateRateLimited);
         CPPUNIT_TEST(testUpdateStateNoRange);
         CPPUNIT_TEST(testUpdateStateMalfunction);
+        CPPUNIT_TEST(testImplicitPosition);
         CPPUNIT_TEST(testInitializationExceptions);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
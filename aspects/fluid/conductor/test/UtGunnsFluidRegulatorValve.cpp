@@ -899,6 +899,94 @@ void UtGunnsFluidRegulatorValve::testUpdateStateMalfunction()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Pressure Regulator Valve link model implicit valve position.  The
+///           network is emulated by setting the outlet pressure as a linear function of the position
+///           before each step and minor step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidRegulatorValve::testImplicitPosition()
+{
+    UT_RESULT;
+
+    /// - Initialize default test article with nominal initialization data.
+    mArticle->initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1, mPort2, mPort3);
+
+    /// @test    Explicit position by default.
+    CPPUNIT_ASSERT(not mArticle->isImplicitPosition());
+    CPPUNIT_ASSERT(not mArticle->isNonLinear());
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM == mArticle->confirmSolutionAcceptable(1, 1));
+
+    /// @test    Invalid tolerances are rejected.
+    mArticle->setImplicitPosition(true, 0.0);
+    CPPUNIT_ASSERT(not mArticle->isImplicitPosition());
+    mArticle->setImplicitPosition(true, 2.0);
+    CPPUNIT_ASSERT(not mArticle->isImplicitPosition());
+
+    /// @test    Setting implicit position makes the link non-linear.
+    mArticle->setImplicitPosition(true, 1.0e-10);
+    CPPUNIT_ASSERT(mArticle->isImplicitPosition());
+    CPPUNIT_ASSERT(mArticle->isNonLinear());
+    CPPUNIT_ASSERT_EQUAL(1.0e-10, mArticle->mPositionSolver.getTolerance());
+
+    /// - Opening valve, with outlet pressure rising with position.
+    mArticle->mPosition         = 0.2;
+    mArticle->mState            = GunnsFluidValve::OPENING;
+    mArticle->mPreviousPressure = mCrackPressure;
+    mArticle->mRateLimit        = 1.0 / mTimeStep;
+    const double base           = 0.5;
+    const double response       = 3.25;
+    const double expected       = (mArticle->mNomDecB + mArticle->mNomDecM * base)
+                                / (1.0 - mArticle->mNomDecM * response);
+    mArticle->mPotentialVector[3] = 0.0;
+
+    /// @test    The major step takes the explicit update.
+    mArticle->mPotentialVector[2] = base + response * mArticle->mPosition;
+    mArticle->step(mTimeStep);
+    CPPUNIT_ASSERT(GunnsFluidValve::OPENING == mArticle->mState);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mArticle->mNomDecB + mArticle->mNomDecM * (base + response * 0.2),
+                                 mArticle->mPosition, mTolerance);
+
+    /// @test    Minor steps converge to the position agreeing with the network, rejecting the
+    ///          solution until they do, then confirming it.
+    int minorStep = 2;
+    for (; minorStep < 10; ++minorStep) {
+        mArticle->mPotentialVector[2] = base + response * mArticle->mPosition;
+        if (GunnsBasicLink::CONFIRM == mArticle->confirmSolutionAcceptable(1, minorStep)) {
+            break;
+        }
+        mArticle->minorStep(mTimeStep, minorStep);
+    }
+    CPPUNIT_ASSERT(minorStep < 10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, mArticle->mPosition, 1.0e-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(response, mArticle->mPositionSolver.getSensitivity(), 1.0e-6);
+    CPPUNIT_ASSERT(GunnsFluidValve::OPENING == mArticle->mState);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mMaxConductivity * expected, mArticle->mEffectiveConductivity,
+                                 mTolerance);
+
+    /// @test    The rate limit bounds the position over the major step.
+    mArticle->mRateLimit          = 0.1;
+    const double start            = mArticle->mPosition;
+    mArticle->mPotentialVector[2] = mFullOpenPressure + 0.1;
+    mArticle->step(mTimeStep);
+    mArticle->minorStep(mTimeStep, 2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(start + mArticle->mRateLimit * mTimeStep, mArticle->mPosition,
+                                 mTolerance);
+
+    /// @test    Malfunctions override the implicit position.
+    mArticle->mMalfStuckFlag      = true;
+    mArticle->mPotentialVector[2] = mCrackPressure;
+    const double stuck            = mArticle->mPosition;
+    mArticle->minorStep(mTimeStep, 3);
+    CPPUNIT_ASSERT_EQUAL(stuck, mArticle->mPosition);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM == mArticle->confirmSolutionAcceptable(1, 3));
+
+    /// @test    Restart resets the solver.
+    mArticle->restartModel();
+    CPPUNIT_ASSERT_EQUAL(0.0, mArticle->mPositionSolver.getSensitivity());
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests for GUNNS Fluid Pressure Regulator Valve link model initialization exceptions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +91,8 @@ class UtGunnsFluidRegulatorValve: public CppUnit::TestFixture
         void testUpdateStateReverse();
         /// @brief    Tests update state method - malfunction.
         void testUpdateStateMalfunction();
+        /// @brief    Tests implicit valve position solution with the network minor steps.
+        void testImplicitPosition();
         /// @brief    Tests initialize method exceptions.
         void testInitializationExceptions();
     private:
@@ -106,6 +108,7 @@ class UtGunnsFluidRegulatorValve: public CppUnit::TestFixture
         CPPUNIT_TEST(testUpdateStateRateLimited);
         CPPUNIT_TEST(testUpdateStateReverse);
         CPPUNIT_TEST(testUpdateStateMalfunction);
+        CPPUNIT_TEST(testImplicitPosition);
         CPPUNIT_TEST(testInitializationExceptions);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
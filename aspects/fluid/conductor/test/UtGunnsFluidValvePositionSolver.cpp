@@ -0,0 +1,268 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((aspects/fluid/conductor/GunnsFluidValvePositionSolver.o))
+***************************************************************************************************/
+
+#include <cmath>
+
+#include "strings/UtResult.hh"
+
+#include "UtGunnsFluidValvePositionSolver.hh"
+
+/// @details  Test identification number.
+int UtGunnsFluidValvePositionSolver::TEST_ID = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Fluid Valve Position Solver unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidValvePositionSolver::UtGunnsFluidValvePositionSolver()
+    :
+    CppUnit::TestFixture(),
+    tArticle(0),
+    tBasePressure(0.0),
+    tResponse(0.0),
+    tIntercept(0.0),
+    tSlope(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Valve Position Solver unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidValvePositionSolver::~UtGunnsFluidValvePositionSolver()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValvePositionSolver::tearDown()
+{
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.  The emulated network and valve are a regulator whose
+///           outlet pressure rises as it opens, and whose curve closes it as the pressure rises.
+///           Their gain product is -4, so the explicit update would diverge.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValvePositionSolver::setUp()
+{
+    tArticle      = new FriendlyGunnsFluidValvePositionSolver;
+    tBasePressure = 100.0;
+    tResponse     = 40.0;
+    tIntercept    = 11.5;
+    tSlope        = -0.1;
+
+    /// - Increment the test identification number.
+    ++TEST_ID;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] position (--) Valve position.
+///
+/// @returns  double (kPa) Emulated network control pressure.
+///
+/// @details  Returns the emulated network control pressure at the given position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double UtGunnsFluidValvePositionSolver::pressure(const double position) const
+{
+    return tBasePressure + tResponse * position;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] pressure (kPa) Control pressure.
+///
+/// @returns  double (--) Emulated valve curve position.
+///
+/// @details  Returns the emulated valve curve position at the given pressure, not range limited.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double UtGunnsFluidValvePositionSolver::target(const double pressure) const
+{
+    return tIntercept + tSlope * pressure;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValvePositionSolver::testDefaultConstruction()
+{
+    UT_RESULT_FIRST;
+
+    CPPUNIT_ASSERT_EQUAL(1.0E-6, tArticle->mTolerance);
+    CPPUNIT_ASSERT_EQUAL(0.0,    tArticle->mLowerLimit);
+    CPPUNIT_ASSERT_EQUAL(1.0,    tArticle->mUpperLimit);
+    CPPUNIT_ASSERT_EQUAL(0.0,    tArticle->mSensitivity);
+    CPPUNIT_ASSERT_EQUAL(0.0,    tArticle->mLastPosition);
+    CPPUNIT_ASSERT_EQUAL(0.0,    tArticle->mLastPressure);
+    CPPUNIT_ASSERT(not           tArticle->mHasLast);
+    CPPUNIT_ASSERT_EQUAL(0.0,    tArticle->mResidual);
+    CPPUNIT_ASSERT_EQUAL(0,      tArticle->mIterations);
+
+    /// @test new/delete for code coverage.
+    GunnsFluidValvePositionSolver* article = new GunnsFluidValvePositionSolver();
+    delete article;
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the tolerance and major step bounds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValvePositionSolver::testBeginStep()
+{
+    UT_RESULT;
+
+    /// @test    Tolerance setter and its lower limit.
+    tArticle->setTolerance(1.0E-3);
+    CPPUNIT_ASSERT_EQUAL(1.0E-3, tArticle->getTolerance());
+    tArticle->setTolerance(-1.0);
+    CPPUNIT_ASSERT_EQUAL(DBL_EPSILON, tArticle->getTolerance());
+
+    /// @test    Bounds from the rate limit, inside the stops.
+    tArticle->mHasLast    = true;
+    tArticle->mIterations = 3;
+    tArticle->beginStep(0.5, 0.2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.3, tArticle->mLowerLimit, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.7, tArticle->mUpperLimit, DBL_EPSILON);
+    CPPUNIT_ASSERT(not tArticle->mHasLast);
+    CPPUNIT_ASSERT_EQUAL(0, tArticle->getIterations());
+
+    /// @test    Bounds limited to the stops.
+    tArticle->beginStep(0.1, 0.5);
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->mLowerLimit);
+    CPPUNIT_ASSERT_EQUAL(0.6, tArticle->mUpperLimit);
+    tArticle->beginStep(0.9, 0.5);
+    CPPUNIT_ASSERT_EQUAL(0.4, tArticle->mLowerLimit);
+    CPPUNIT_ASSERT_EQUAL(1.0, tArticle->mUpperLimit);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the iteration converges to the unconstrained solution, where the explicit update
+///           would diverge.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValvePositionSolver::testConvergence()
+{
+    UT_RESULT;
+
+    /// - Solution of x = f(p(x)) for the linear network and valve.
+    const double expected = (tIntercept + tSlope * tBasePressure) / (1.0 - tSlope * tResponse);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.3, expected, 1.0E-12);
+
+    /// @test    The explicit update diverges from the solution.
+    double explicitPosition = 0.25;
+    double explicitError    = std::fabs(explicitPosition - expected);
+    explicitPosition        = target(pressure(explicitPosition));
+    CPPUNIT_ASSERT(std::fabs(explicitPosition - expected) > 2.0 * explicitError);
+
+    /// @test    The first update without a sensitivity estimate is the explicit update.
+    tArticle->setTolerance(1.0E-12);
+    tArticle->beginStep(0.25, 1.0);
+    double position = tArticle->update(0.25, pressure(0.25), target(pressure(0.25)), tSlope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, position, 1.0E-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-0.25, tArticle->getResidual(), 1.0E-12);
+    CPPUNIT_ASSERT_EQUAL(1, tArticle->getIterations());
+
+    /// @test    The second update estimates the network response and lands on the solution.
+    position = tArticle->update(position, pressure(position), target(pressure(position)), tSlope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tResponse, tArticle->getSensitivity(), 1.0E-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, position, 1.0E-12);
+    CPPUNIT_ASSERT(tArticle->isConverged(position, target(pressure(position)), tSlope));
+
+    /// @test    Further updates don't move a converged position.
+    const double converged = tArticle->update(position, pressure(position),
+                                              target(pressure(position)), tSlope);
+    CPPUNIT_ASSERT_EQUAL(position, converged);
+    CPPUNIT_ASSERT_EQUAL(3, tArticle->getIterations());
+
+    /// @test    The sensitivity estimate is kept into the next major step, so a disturbance in the
+    ///          network is solved in one update.
+    tBasePressure = 95.0;
+    const double disturbed = (tIntercept + tSlope * tBasePressure) / (1.0 - tSlope * tResponse);
+    tArticle->beginStep(position, 1.0);
+    CPPUNIT_ASSERT(not tArticle->isConverged(position, target(pressure(position)), tSlope));
+    position = tArticle->update(position, pressure(position), target(pressure(position)), tSlope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(disturbed, position, 1.0E-12);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the iteration settles against the rate limit and stop bounds when the solution
+///           is beyond them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValvePositionSolver::testBounds()
+{
+    UT_RESULT;
+
+    /// @test    The rate limit bounds the position, which settles against it.
+    tArticle->setTolerance(1.0E-12);
+    tArticle->mSensitivity = tResponse;
+    tArticle->beginStep(0.1, 0.05);
+    double position = tArticle->update(0.1, pressure(0.1), target(pressure(0.1)), tSlope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.15, position, 1.0E-12);
+    CPPUNIT_ASSERT(tArticle->isConverged(position, target(pressure(position)), tSlope));
+    CPPUNIT_ASSERT(tArticle->getResidual() < 0.0);
+
+    /// @test    The stop bounds the position, which settles against it.
+    tBasePressure = 50.0;
+    tArticle->beginStep(0.9, 1.0);
+    position = tArticle->update(0.9, pressure(0.9), target(pressure(0.9)), tSlope);
+    CPPUNIT_ASSERT_EQUAL(1.0, position);
+    CPPUNIT_ASSERT(tArticle->isConverged(position, target(pressure(position)), tSlope));
+
+    /// @test    A target past the bound with no slope, as for a closed valve state, settles there.
+    tArticle->beginStep(0.3, 1.0);
+    position = tArticle->update(0.3, pressure(0.3), -1.0, 0.0);
+    CPPUNIT_ASSERT_EQUAL(0.0, position);
+    CPPUNIT_ASSERT(tArticle->isConverged(position, -1.0, 0.0));
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the Jacobian is limited to the explicit update for a reinforcing or undefined
+///           network response, and tests reset.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValvePositionSolver::testJacobianLimit()
+{
+    UT_RESULT;
+
+    /// @test    A network response reinforcing the valve motion falls back to the explicit update.
+    tArticle->setTolerance(1.0E-12);
+    tArticle->mSensitivity = -tResponse;
+    tArticle->beginStep(0.25, 1.0);
+    double position = tArticle->update(0.25, pressure(0.25), target(pressure(0.25)), tSlope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, position, 1.0E-12);
+
+    /// @test    A NaN network response falls back to the explicit update.
+    tArticle->mSensitivity = std::sqrt(-1.0);
+    tArticle->beginStep(0.25, 1.0);
+    position = tArticle->update(0.25, pressure(0.25), target(pressure(0.25)), tSlope);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, position, 1.0E-12);
+
+    /// @test    Position changes too small to resolve don't update the sensitivity.
+    tArticle->mSensitivity = tResponse;
+    tArticle->beginStep(0.3, 1.0);
+    tArticle->update(0.3, pressure(0.3), target(pressure(0.3)), tSlope);
+    tArticle->update(0.3, pressure(0.3) + 1.0, target(pressure(0.3)), tSlope);
+    CPPUNIT_ASSERT_EQUAL(tResponse, tArticle->getSensitivity());
+
+    /// @test    Reset.
+    tArticle->reset();
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->mLowerLimit);
+    CPPUNIT_ASSERT_EQUAL(1.0, tArticle->mUpperLimit);
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getSensitivity());
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getResidual());
+    CPPUNIT_ASSERT_EQUAL(0,   tArticle->getIterations());
+    CPPUNIT_ASSERT(not tArticle->mHasLast);
+
+    UT_PASS_LAST;
+}
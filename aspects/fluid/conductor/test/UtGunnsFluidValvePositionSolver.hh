@@ -0,0 +1,96 @@
+#ifndef UtGunnsFluidValvePositionSolver_EXISTS
+#define UtGunnsFluidValvePositionSolver_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_TSM_GUNNS_FLUID_CONDUCTOR_VALVE_POSITION_SOLVER    Valve Position Solver Unit Tests
+/// @ingroup  UT_TSM_GUNNS_FLUID_CONDUCTOR
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Fluid Valve Position Solver.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "aspects/fluid/conductor/GunnsFluidValvePositionSolver.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidValvePositionSolver and befriend UtGunnsFluidValvePositionSolver.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidValvePositionSolver : public GunnsFluidValvePositionSolver
+{
+    public:
+        FriendlyGunnsFluidValvePositionSolver();
+        virtual ~FriendlyGunnsFluidValvePositionSolver();
+        friend class UtGunnsFluidValvePositionSolver;
+};
+inline FriendlyGunnsFluidValvePositionSolver::FriendlyGunnsFluidValvePositionSolver()
+    : GunnsFluidValvePositionSolver() {};
+inline FriendlyGunnsFluidValvePositionSolver::~FriendlyGunnsFluidValvePositionSolver() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Valve Position Solver unit tests.
+///
+/// @details  This class provides the unit tests for the GUNNS Fluid Valve Position Solver within
+///           the CPPUnit framework.  The network is emulated by a linear control pressure response
+///           to valve position, and the valve by a linear position curve.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidValvePositionSolver: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Valve Position Solver unit test.
+        UtGunnsFluidValvePositionSolver();
+        /// @brief    Default destructs this Valve Position Solver unit test.
+        virtual ~UtGunnsFluidValvePositionSolver();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests the tolerance and major step bounds.
+        void testBeginStep();
+        /// @brief    Tests convergence to the unconstrained solution.
+        void testConvergence();
+        /// @brief    Tests settling against the bounds.
+        void testBounds();
+        /// @brief    Tests the Jacobian limit and reset.
+        void testJacobianLimit();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsFluidValvePositionSolver);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testBeginStep);
+        CPPUNIT_TEST(testConvergence);
+        CPPUNIT_TEST(testBounds);
+        CPPUNIT_TEST(testJacobianLimit);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyGunnsFluidValvePositionSolver* tArticle;      /**< (--)    Test article. */
+        double                                 tBasePressure; /**< (kPa)   Emulated network control pressure at closed position. */
+        double                                 tResponse;     /**< (kPa)   Emulated network control pressure response to position. */
+        double                                 tIntercept;    /**< (--)    Emulated valve curve position at zero pressure. */
+        double                                 tSlope;        /**< (1/kPa) Emulated valve curve slope. */
+        static int                             TEST_ID;       /**< (--)    Test identification number. */
+
+        /// @brief    Returns the emulated network control pressure at the given position.
+        double pressure(const double position) const;
+        /// @brief    Returns the emulated valve curve position at the given pressure.
+        double target(const double pressure) const;
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidValvePositionSolver(const UtGunnsFluidValvePositionSolver& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidValvePositionSolver& operator =(const UtGunnsFluidValvePositionSolver& that);
+};
+
+///@}
+
+#endif
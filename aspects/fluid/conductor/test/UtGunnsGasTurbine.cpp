@@ -312,6 +312,9 @@ void UtGunnsGasTurbine::testConfig()
     CPPUNIT_ASSERT(0.0                   == defaultConfig.mThermalLength);
     CPPUNIT_ASSERT(0.0                   == defaultConfig.mThermalDiameter);
     CPPUNIT_ASSERT(0.0                   == defaultConfig.mSurfaceRoughness);
+    CPPUNIT_ASSERT(0                     == defaultConfig.mMapSpeedPoints);
+    CPPUNIT_ASSERT(0                     == defaultConfig.mMapRatioPoints);
+    CPPUNIT_ASSERT(0.0                   == defaultConfig.mMapMaxRatio);
 
     /// @test    Configuration data copy construction.
     GunnsGasTurbineConfigData copyConfig(*tConfigData);
@@ -349,6 +352,9 @@ void UtGunnsGasTurbine::testConfig()
     CPPUNIT_ASSERT(tThermalLength        == copyConfig.mThermalLength);
     CPPUNIT_ASSERT(tThermalDiameter      == copyConfig.mThermalDiameter);
     CPPUNIT_ASSERT(tSurfaceRoughness     == copyConfig.mSurfaceRoughness);
+    CPPUNIT_ASSERT(tConfigData->mMapSpeedPoints == copyConfig.mMapSpeedPoints);
+    CPPUNIT_ASSERT(tConfigData->mMapRatioPoints == copyConfig.mMapRatioPoints);
+    CPPUNIT_ASSERT(tConfigData->mMapMaxRatio    == copyConfig.mMapMaxRatio);
 
     UT_PASS;
 }
@@ -509,6 +515,9 @@ void UtGunnsGasTurbine::testNominalInitialization()
     CPPUNIT_ASSERT(0.0 == article.mPressureRatio);
     CPPUNIT_ASSERT(0.0 == article.mPressureDrop);
 
+    /// @test    Performance map is not used by default.
+    CPPUNIT_ASSERT(not article.mMap.isInitialized());
+
     /// @test    Internal fluid initialization.
     CPPUNIT_ASSERT_DOUBLES_EQUAL(tNodes[0].getOutflow()->getTemperature(),
                                  article.getInternalFluid()->getTemperature(), DBL_EPSILON);
@@ -858,5 +867,80 @@ void UtGunnsGasTurbine::testUpdateFluid()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedPower,  tArticle->mImpellerPower,  DBL_EPSILON);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedTorque, tArticle->mImpellerTorque, DBL_EPSILON);
 
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Gas Turbine link model with the pre-computed performance map.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsGasTurbine::testPerformanceMap()
+{
+    UT_RESULT;
+
+    /// - Initialize a reference article that evaluates the curves directly, and a test article
+    ///   that uses the performance map.
+    FriendlyGunnsGasTurbine curveArticle;
+    curveArticle.initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+    tConfigData->mMapSpeedPoints = 61;
+    tConfigData->mMapRatioPoints = 461;
+    tConfigData->mMapMaxRatio    = 0.0;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+
+    /// @test    Map breakpoints span the reference speeds and 1 to the largest efficiency limit.
+    CPPUNIT_ASSERT(tArticle->mMap.isInitialized());
+    CPPUNIT_ASSERT(61 == tArticle->mMap.getNumSpeeds());
+    CPPUNIT_ASSERT(461 == tArticle->mMap.getNumRatios());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tCorrectedSpeedLow,  tArticle->mMap.getSpeed(0),   DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tCorrectedSpeedHigh, tArticle->mMap.getSpeed(60),  FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,                 tArticle->mMap.getRatio(0),   DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tMaxEffLimitHighSpeed, tArticle->mMap.getRatio(460), FLT_EPSILON);
+
+    /// @test    Predicted flow rate from the map matches the direct curve evaluation.
+    const double pressureDrop = 25.0;
+    tArticle->mPressureDrop           = pressureDrop;
+    tArticle->mPotentialVector[0]     = tNodes[0].getContent()->getPressure();
+    tArticle->mPotentialVector[1]     = tNodes[1].getContent()->getPressure();
+    curveArticle.mPressureDrop        = pressureDrop;
+    curveArticle.mPotentialVector[0]  = tNodes[0].getContent()->getPressure();
+    curveArticle.mPotentialVector[1]  = tNodes[1].getContent()->getPressure();
+    tArticle->updateState(tTimeStep);
+    curveArticle.updateState(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(curveArticle.mPressureRatio, tArticle->mPressureRatio, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(curveArticle.mPredictedFlowRate, tArticle->mPredictedFlowRate,
+                                 0.001 * curveArticle.mPredictedFlowRate);
+
+    /// @test    Efficiency from the map matches the direct curve evaluation.
+    tArticle->mVolFlowRate  = 93.0;
+    curveArticle.mVolFlowRate = 93.0;
+    tArticle->updateFluid(tTimeStep, 0.01);
+    curveArticle.updateFluid(tTimeStep, 0.01);
+    CPPUNIT_ASSERT(curveArticle.mEfficiency > 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(curveArticle.mEfficiency, tArticle->mEfficiency, 0.001);
+
+    /// @test    Pressure ratio beyond the map evaluates the curves directly instead of freezing
+    ///          the flow at the map edge.
+    const double sourcePress = tNodes[0].getOutflow()->getPressure();
+    tArticle->mPressureDrop         = 0.0;
+    tArticle->mFilterGain           = 1.0;
+    tArticle->mPotentialVector[0]   = sourcePress;
+    tArticle->mPotentialVector[1]   = 0.1 * sourcePress;
+    curveArticle.mPressureDrop       = 0.0;
+    curveArticle.mFilterGain         = 1.0;
+    curveArticle.mPotentialVector[0] = sourcePress;
+    curveArticle.mPotentialVector[1] = 0.1 * sourcePress;
+    tArticle->updateState(tTimeStep);
+    curveArticle.updateState(tTimeStep);
+    CPPUNIT_ASSERT(tArticle->mPressureRatio > tMaxEffLimitHighSpeed);
+    CPPUNIT_ASSERT(not tArticle->isInMap(tArticle->mPressureRatio));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(curveArticle.mPredictedFlowRate, tArticle->mPredictedFlowRate,
+                                 DBL_EPSILON);
+
+    /// @test    Initialization exception from the map on bad map config data.
+    FriendlyGunnsGasTurbine article;
+    tConfigData->mMapRatioPoints = 1;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(not article.mInitFlag);
+
     UT_PASS_LAST;
 }
@@ -71,6 +71,8 @@ class UtGunnsGasTurbine: public CppUnit::TestFixture
         void testUpdateState();
         /// @brief    Tests update fluid method.
         void testUpdateFluid();
+        /// @brief    Tests the pre-computed performance map.
+        void testPerformanceMap();
     private:
         CPPUNIT_TEST_SUITE(UtGunnsGasTurbine);
         CPPUNIT_TEST(testConfig);
@@ -83,6 +85,7 @@ class UtGunnsGasTurbine: public CppUnit::TestFixture
         CPPUNIT_TEST(testModifiers);
         CPPUNIT_TEST(testUpdateState);
         CPPUNIT_TEST(testUpdateFluid);
+        CPPUNIT_TEST(testPerformanceMap);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
         enum {N_NODES = 2, N_FLUIDS = 2};
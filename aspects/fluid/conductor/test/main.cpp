@@ -21,6 +21,7 @@
 #include "UtGunnsFluidReliefValve.hh"
 #include "UtGunnsFluidSensor.hh"
 #include "UtGunnsFluidValve.hh"
+#include "UtGunnsFluidValvePositionSolver.hh"
 #include "UtGunnsFluid3WayValve.hh"
 #include "UtGunnsFluid3WayCheckValve.hh"
 #include "UtGunnsFluidBalancedPrv.hh"
@@ -55,6 +56,7 @@ int main(int, char**)
     runner.addTest(UtGunnsFluidBalancedPrv::suite());
     runner.addTest(UtGunnsFluidRegulatorValve::suite());
     runner.addTest(UtGunnsFluidReliefValve::suite());
+    runner.addTest(UtGunnsFluidValvePositionSolver::suite());
     runner.addTest(UtGunnsFluidPipe::suite());
     runner.addTest(UtGunnsFluidHeatExchanger::suite());
     runner.addTest(UtGunnsFluidHxDynHtc::suite());
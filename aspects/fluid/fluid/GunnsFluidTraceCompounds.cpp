@@ -43,17 +43,17 @@ GunnsFluidTraceCompoundsConfigData::GunnsFluidTraceCompoundsConfigData(
     ///   compounds added later.
     if (types) {
 
-        /// - Create a DefineChemicalCompounds to pull data from.
-        DefinedChemicalCompounds definedCompounds;
+        /// - Get the shared DefinedChemicalCompounds to pull data from.
+        const DefinedChemicalCompounds* definedCompounds = DefinedChemicalCompounds::getInstance();
 
         /// - Create new chemical compound from defined compounds and add it to the vector.
         for(int i = 0; i < nTypes; i++){
 
             ChemicalCompound* compound =
                     new ChemicalCompound(types[i],
-                            definedCompounds.getCompound(types[i])->mName,
-                            definedCompounds.getCompound(types[i])->mFluidType,
-                            definedCompounds.getCompound(types[i])->mMWeight);
+                            definedCompounds->getCompound(types[i])->mName,
+                            definedCompounds->getCompound(types[i])->mFluidType,
+                            definedCompounds->getCompound(types[i])->mMWeight);
             mCompounds.push_back(compound);
         }
     }
@@ -166,13 +166,13 @@ void GunnsFluidTraceCompoundsConfigData::addCompound(ChemicalCompound::Type type
                     "Can't add NO_COMPOUND type.");
     }
 
-    /// - Create DefineChemicalCompounds to pull data from.
-    const DefinedChemicalCompounds definedCompounds;
+    /// - Get the shared DefinedChemicalCompounds to pull data from.
+    const DefinedChemicalCompounds* definedCompounds = DefinedChemicalCompounds::getInstance();
 
     /// - Add the compound.
-    addCompound(definedCompounds.getCompound(type)->mMWeight,
-                definedCompounds.getCompound(type)->mName,
-                definedCompounds.getCompound(type)->mFluidType,
+    addCompound(definedCompounds->getCompound(type)->mMWeight,
+                definedCompounds->getCompound(type)->mName,
+                definedCompounds->getCompound(type)->mFluidType,
                 type);
 }
 
@@ -171,7 +171,7 @@ void GunnsPumpCavitation::update(double&                           pumpSource,
 void GunnsPumpCavitation::computeVaporPressure(const FluidProperties::FluidType& liquidType,
                                                GunnsBasicNode*                   inletNode)
 {
-    mInletVaporPressure = inletNode->getFluidConfig()->mProperties->getProperties(liquidType)->getSaturationPressure(
+    mInletVaporPressure = inletNode->getFluidConfig()->mProperties->getProperties(liquidType)->lookupSaturationPressure(
                           inletNode->getContent()->getTemperature());
 }
 
@@ -0,0 +1,234 @@
+/**
+@file
+@brief     GUNNS Turbomachine Performance Map implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ((simulation/hs/TsHsMsg.o)
+    (software/exceptions/TsInitializationException.o))
+**************************************************************************************************/
+
+#include "GunnsTurbomachineMap.hh"
+
+#include "core/GunnsMacros.hh"
+#include "math/MsMath.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Turbomachine Performance Map.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsTurbomachineMap::GunnsTurbomachineMap()
+    :
+    mName(""),
+    mNumSpeeds(0),
+    mNumRatios(0),
+    mMinSpeed(0.0),
+    mMaxSpeed(0.0),
+    mMinRatio(0.0),
+    mMaxRatio(0.0),
+    mSpeedStep(0.0),
+    mRatioStep(0.0),
+    mFlow(0),
+    mEfficiency(0),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Turbomachine Performance Map.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsTurbomachineMap::~GunnsTurbomachineMap()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes the dynamic table arrays, if they exist.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsTurbomachineMap::cleanup()
+{
+    if (mEfficiency) {
+        TS_DELETE_ARRAY(mEfficiency);
+    }
+    if (mFlow) {
+        TS_DELETE_ARRAY(mFlow);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name      (--) Instance name for messages.
+/// @param[in] numSpeeds (--) Number of speed breakpoints (table rows), at least 2.
+/// @param[in] minSpeed  (--) Speed of the first table row.
+/// @param[in] maxSpeed  (--) Speed of the last table row, greater than minSpeed.
+/// @param[in] numRatios (--) Number of pressure ratio breakpoints (table columns), at least 2.
+/// @param[in] minRatio  (--) Pressure ratio of the first table column.
+/// @param[in] maxRatio  (--) Pressure ratio of the last table column, greater than minRatio.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes the breakpoints of this map and allocates the tables, with all table
+///           values zeroed.  The owning link should then fill the tables with setPoint.  This may
+///           be called again to re-size the map, which deletes the old tables.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsTurbomachineMap::initialize(const std::string& name,
+                                      const int          numSpeeds,
+                                      const double       minSpeed,
+                                      const double       maxSpeed,
+                                      const int          numRatios,
+                                      const double       minRatio,
+                                      const double       maxRatio)
+{
+    /// - Reset the init flag.
+    mInitFlag = false;
+
+    /// - Initialize & validate the breakpoints.
+    GUNNS_NAME_ERREX("GunnsTurbomachineMap", name);
+    mNumSpeeds = numSpeeds;
+    mNumRatios = numRatios;
+    mMinSpeed  = minSpeed;
+    mMaxSpeed  = maxSpeed;
+    mMinRatio  = minRatio;
+    mMaxRatio  = maxRatio;
+    validate();
+    mSpeedStep = (mMaxSpeed - mMinSpeed) / (mNumSpeeds - 1);
+    mRatioStep = (mMaxRatio - mMinRatio) / (mNumRatios - 1);
+
+    /// - Allocate and zero the tables.
+    cleanup();
+    const int size = mNumSpeeds * mNumRatios;
+    TS_NEW_PRIM_ARRAY_EXT(mFlow,       size, double, mName + ".mFlow");
+    TS_NEW_PRIM_ARRAY_EXT(mEfficiency, size, double, mName + ".mEfficiency");
+    for (int i = 0; i < size; ++i) {
+        mFlow[i]       = 0.0;
+        mEfficiency[i] = 0.0;
+    }
+
+    /// - Set the init flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Validates the breakpoints of this map.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsTurbomachineMap::validate() const
+{
+    /// - Throw an exception if there are too few breakpoints to interpolate between.
+    if (mNumSpeeds < 2 or mNumRatios < 2) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "number of map speeds or ratios < 2.");
+    }
+
+    /// - Throw an exception if the speed range is empty or reversed.
+    if (mMaxSpeed - mMinSpeed < DBL_EPSILON) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "map max speed not > min speed.");
+    }
+
+    /// - Throw an exception if the pressure ratio range is empty or reversed.
+    if (mMaxRatio - mMinRatio < DBL_EPSILON) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "map max ratio not > min ratio.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] speedIndex (--) Index of the table row.
+/// @param[in] ratioIndex (--) Index of the table column.
+/// @param[in] flow       (--) Corrected flow rate at this point.
+/// @param[in] efficiency (--) Efficiency at this point.
+///
+/// @details  Stores the given performance at the given table point.  Indexes outside of the table
+///           are ignored.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsTurbomachineMap::setPoint(const int    speedIndex,
+                                    const int    ratioIndex,
+                                    const double flow,
+                                    const double efficiency)
+{
+    if (mInitFlag and MsMath::isInRange(0, speedIndex, mNumSpeeds - 1)
+                  and MsMath::isInRange(0, ratioIndex, mNumRatios - 1)) {
+        const int index    = speedIndex * mNumRatios + ratioIndex;
+        mFlow[index]       = flow;
+        mEfficiency[index] = efficiency;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] index     (--) Index of the lower breakpoint of the cell containing the value.
+/// @param[out] fraction  (--) Fraction (0-1) of the value between the cell's breakpoints.
+/// @param[in]  value     (--) The value to find.
+/// @param[in]  minValue  (--) The first breakpoint value.
+/// @param[in]  step      (--) The uniform spacing between breakpoints.
+/// @param[in]  numPoints (--) The number of breakpoints.
+///
+/// @details  Since breakpoints are uniformly spaced, the cell is found directly from the value
+///           without searching.  Values outside of the breakpoint range are clamped to the first
+///           or last cell's outer edge.  A NaN value is clamped to the first breakpoint, so the
+///           index is always valid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsTurbomachineMap::findCell(int&         index,
+                                    double&      fraction,
+                                    const double value,
+                                    const double minValue,
+                                    const double step,
+                                    const int    numPoints)
+{
+    const double position = (value - minValue) / step;
+    /// - This test is written so that NaN positions also fail it, before they can be cast to an
+    ///   index, since all comparisons with NaN are false.
+    if (not (position > 0.0)) {
+        index    = 0;
+        fraction = 0.0;
+    } else if (position >= numPoints - 1) {
+        index    = numPoints - 2;
+        fraction = 1.0;
+    } else {
+        index    = static_cast<int>(position);
+        fraction = position - index;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] flow       (--) Interpolated corrected flow rate.
+/// @param[out] efficiency (--) Interpolated efficiency.
+/// @param[in]  speed      (--) Corrected speed to look up.
+/// @param[in]  ratio      (--) Pressure ratio to look up.
+///
+/// @details  Bilinearly interpolates the tables at the given speed and pressure ratio, clamped to
+///           the map range.  Outputs are zero if the map hasn't been initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsTurbomachineMap::lookup(double&      flow,
+                                  double&      efficiency,
+                                  const double speed,
+                                  const double ratio) const
+{
+    if (not mInitFlag) {
+        flow       = 0.0;
+        efficiency = 0.0;
+        return;
+    }
+
+    int    i  = 0;
+    int    j  = 0;
+    double fs = 0.0;
+    double fr = 0.0;
+    findCell(i, fs, speed, mMinSpeed, mSpeedStep, mNumSpeeds);
+    findCell(j, fr, ratio, mMinRatio, mRatioStep, mNumRatios);
+
+    /// - Corners of the table cell: lower speed row (0x) and upper speed row (1x).
+    const int    k00 = i * mNumRatios + j;
+    const int    k10 = k00 + mNumRatios;
+    const double ws  = 1.0 - fs;
+    const double wr  = 1.0 - fr;
+
+    const double flowLo = wr * mFlow[k00] + fr * mFlow[k00 + 1];
+    const double flowHi = wr * mFlow[k10] + fr * mFlow[k10 + 1];
+    flow       = ws * flowLo + fs * flowHi;
+    efficiency = ws * (wr * mEfficiency[k00] + fr * mEfficiency[k00 + 1])
+               + fs * (wr * mEfficiency[k10] + fr * mEfficiency[k10 + 1]);
+}
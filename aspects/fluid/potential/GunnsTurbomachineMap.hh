@@ -0,0 +1,185 @@
+#ifndef GunnsTurbomachineMap_EXISTS
+#define GunnsTurbomachineMap_EXISTS
+
+/**
+@file
+@brief    GUNNS Turbomachine Performance Map declarations
+
+@defgroup  TSM_GUNNS_FLUID_POTENTIAL_TURBOMACHINE_MAP Turbomachine Performance Map
+@ingroup   TSM_GUNNS_FLUID_POTENTIAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Implements a pre-computed 2-D performance map of corrected flow rate and efficiency vs. corrected
+   speed and pressure ratio, for use by turbomachinery link models.  GunnsGasTurbine is currently
+   the only user.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The map is sampled on uniformly-spaced breakpoints in both independent variables, and values
+   between breakpoints are bilinearly interpolated.  Accuracy between breakpoints therefore
+   depends on the number of breakpoints the owning link chooses.)
+- (Lookups outside the map range, or at NaN values, are clamped to the map edges.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsTurbomachineMap.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Turbomachine Performance Map
+///
+/// @details  This holds tables of corrected flow rate and efficiency on a uniform grid of corrected
+///           speed (rows) and pressure ratio (columns).  The owning link fills the table once at
+///           initialization from its own performance curves via setPoint, and then replaces its
+///           per-step curve evaluations and speed interpolations with a single call to lookup.
+///
+///           Because the breakpoints are uniformly spaced, the lookup finds its table cell in
+///           constant time without searching.  Bilinear interpolation between the tabulated points
+///           never overshoots the neighboring table values, so the looked-up values are monotone
+///           wherever the tabulated data are.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsTurbomachineMap
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsTurbomachineMap);
+    public:
+        /// @brief  Default constructs this Turbomachine Performance Map.
+        GunnsTurbomachineMap();
+        /// @brief  Default destructs this Turbomachine Performance Map.
+        virtual ~GunnsTurbomachineMap();
+        /// @brief  Initializes this Turbomachine Performance Map breakpoints and allocates tables.
+        void   initialize(const std::string& name,
+                          const int          numSpeeds,
+                          const double       minSpeed,
+                          const double       maxSpeed,
+                          const int          numRatios,
+                          const double       minRatio,
+                          const double       maxRatio);
+        /// @brief  Stores the performance at the given table point.
+        void   setPoint(const int    speedIndex,
+                        const int    ratioIndex,
+                        const double flow,
+                        const double efficiency);
+        /// @brief  Looks up the interpolated performance at the given speed and pressure ratio.
+        void   lookup(double&      flow,
+                      double&      efficiency,
+                      const double speed,
+                      const double ratio) const;
+        /// @brief  Returns the speed of the given table row.
+        double getSpeed(const int speedIndex) const;
+        /// @brief  Returns the pressure ratio of the given table column.
+        double getRatio(const int ratioIndex) const;
+        /// @brief  Returns the number of speed breakpoints in the table.
+        int    getNumSpeeds() const;
+        /// @brief  Returns the number of pressure ratio breakpoints in the table.
+        int    getNumRatios() const;
+        /// @brief  Returns whether this map has been successfully initialized.
+        bool   isInitialized() const;
+
+    protected:
+        std::string mName;          /**< *o (--)  trick_chkpnt_io(**) Instance name for messages.               */
+        int         mNumSpeeds;     /**<    (--)  trick_chkpnt_io(**) Number of speed breakpoints.              */
+        int         mNumRatios;     /**<    (--)  trick_chkpnt_io(**) Number of pressure ratio breakpoints.     */
+        double      mMinSpeed;      /**<    (--)  trick_chkpnt_io(**) Speed of the first table row.             */
+        double      mMaxSpeed;      /**<    (--)  trick_chkpnt_io(**) Speed of the last table row.              */
+        double      mMinRatio;      /**<    (--)  trick_chkpnt_io(**) Pressure ratio of the first table column. */
+        double      mMaxRatio;      /**<    (--)  trick_chkpnt_io(**) Pressure ratio of the last table column.  */
+        double      mSpeedStep;     /**<    (--)  trick_chkpnt_io(**) Speed spacing between table rows.         */
+        double      mRatioStep;     /**<    (--)  trick_chkpnt_io(**) Pressure ratio spacing between columns.   */
+        double*     mFlow;          /**<    (--)  trick_chkpnt_io(**) Corrected flow rate table, row-major.     */
+        double*     mEfficiency;    /**<    (--)  trick_chkpnt_io(**) Efficiency table, row-major.              */
+        bool        mInitFlag;      /**<    (--)  trick_chkpnt_io(**) Initialization complete flag.             */
+        /// @brief  Validates the initialization arguments of this Turbomachine Performance Map.
+        void   validate() const;
+        /// @brief  Deletes dynamic memory.
+        void   cleanup();
+        /// @brief  Finds the table cell and fraction within it for the given breakpoint value.
+        static void findCell(int&         index,
+                             double&      fraction,
+                             const double value,
+                             const double minValue,
+                             const double step,
+                             const int    numPoints);
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsTurbomachineMap(const GunnsTurbomachineMap&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsTurbomachineMap& operator =(const GunnsTurbomachineMap&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] speedIndex (--) Index of the table row.
+///
+/// @returns  double (--) The speed of the given table row.
+///
+/// @details  Returns the speed of the given table row.  The caller is responsible for giving a
+///           valid index.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsTurbomachineMap::getSpeed(const int speedIndex) const
+{
+    return mMinSpeed + speedIndex * mSpeedStep;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] ratioIndex (--) Index of the table column.
+///
+/// @returns  double (--) The pressure ratio of the given table column.
+///
+/// @details  Returns the pressure ratio of the given table column.  The caller is responsible for
+///           giving a valid index.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsTurbomachineMap::getRatio(const int ratioIndex) const
+{
+    return mMinRatio + ratioIndex * mRatioStep;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of speed breakpoints in the table.
+///
+/// @details  Returns the number of speed breakpoints (rows) in the table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsTurbomachineMap::getNumSpeeds() const
+{
+    return mNumSpeeds;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of pressure ratio breakpoints in the table.
+///
+/// @details  Returns the number of pressure ratio breakpoints (columns) in the table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsTurbomachineMap::getNumRatios() const
+{
+    return mNumRatios;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this map has been successfully initialized.
+///
+/// @details  Returns the initialization complete flag.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsTurbomachineMap::isInitialized() const
+{
+    return mInitFlag;
+}
+
+#endif
@@ -132,54 +132,58 @@ void UtGunnsPumpCavitation::testVaporPressure()
 {
     UT_RESULT;
 
+    /// - The vapor pressure comes from the saturation table lookup, which matches the fluid's
+    ///   saturation curve fit to within this relative tolerance.
+    const double tolerance = 1.0E-6;
+
     {
         /// - Test vapor pressure for ammonia.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_AMMONIA;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     } {
         /// - Test vapor pressure for propylene glycol 50%.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_PG50;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     } {
         /// - Test vapor pressure for propylene glycol 30%.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_PG30;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     } {
         /// - Test vapor pressure for HFE-7000.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_HFE7000;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     } {
         /// - Test vapor pressure for HFE-7100.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_HFE7100;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     } {
         /// - Test vapor pressure for water.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_WATER;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     } {
         /// - Test vapor pressure for liquid oxygen.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_OXYGEN;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     } {
         /// - Test vapor pressure for liquid methane.
         const FluidProperties::FluidType type = FluidProperties::GUNNS_METHANE;
         tArticle->computeVaporPressure(type, &tNode);
         const double expectedVp = tFluidProperties->getProperties(type)->getSaturationPressure(tNode.getContent()->getTemperature());
-        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, DBL_EPSILON);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedVp, tArticle->mInletVaporPressure, expectedVp * tolerance);
     }
 
     UT_PASS;
@@ -0,0 +1,272 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((aspects/fluid/potential/GunnsTurbomachineMap.o))
+***************************************************************************************************/
+
+#include <cfloat>
+#include <cmath>
+#include "software/exceptions/TsInitializationException.hh"
+#include "strings/UtResult.hh"
+
+#include "UtGunnsTurbomachineMap.hh"
+
+/// @details  Test identification number.
+int UtGunnsTurbomachineMap::TEST_ID = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Turbomachine Performance Map unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsTurbomachineMap::UtGunnsTurbomachineMap()
+    :
+    CppUnit::TestFixture(),
+    tArticle(0),
+    tName()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Turbomachine Performance Map unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsTurbomachineMap::~UtGunnsTurbomachineMap()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::setUp()
+{
+    tName    = "tArticle";
+    tArticle = new FriendlyGunnsTurbomachineMap();
+
+    /// - Increment the test identification number.
+    ++TEST_ID;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::tearDown()
+{
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes the test article with 5 speeds from 100 to 500 and 3 ratios from 1 to 2,
+///           and fills it with a plane that bilinear interpolation reproduces exactly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::fillPlane()
+{
+    tArticle->initialize(tName, 5, 100.0, 500.0, 3, 1.0, 2.0);
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            const double speed = tArticle->getSpeed(i);
+            const double ratio = tArticle->getRatio(j);
+            tArticle->setPoint(i, j, speed + 2.0 * ratio, 0.001 * speed);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the default construction of the GUNNS Turbomachine Performance Map class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::testDefaultConstruction()
+{
+    UT_RESULT_FIRST;
+
+    /// @test    Default values of terms.
+    CPPUNIT_ASSERT(""  == tArticle->mName);
+    CPPUNIT_ASSERT(0   == tArticle->mNumSpeeds);
+    CPPUNIT_ASSERT(0   == tArticle->mNumRatios);
+    CPPUNIT_ASSERT(0.0 == tArticle->mMinSpeed);
+    CPPUNIT_ASSERT(0.0 == tArticle->mMaxSpeed);
+    CPPUNIT_ASSERT(0.0 == tArticle->mMinRatio);
+    CPPUNIT_ASSERT(0.0 == tArticle->mMaxRatio);
+    CPPUNIT_ASSERT(0.0 == tArticle->mSpeedStep);
+    CPPUNIT_ASSERT(0.0 == tArticle->mRatioStep);
+    CPPUNIT_ASSERT(0   == tArticle->mFlow);
+    CPPUNIT_ASSERT(0   == tArticle->mEfficiency);
+    CPPUNIT_ASSERT(not tArticle->isInitialized());
+
+    /// @test    Lookup before initialization returns zeroes.
+    double flow = 1.0;
+    double eff  = 1.0;
+    tArticle->lookup(flow, eff, 1.0, 1.0);
+    CPPUNIT_ASSERT(0.0 == flow);
+    CPPUNIT_ASSERT(0.0 == eff);
+
+    /// @test    New/delete for code coverage.
+    GunnsTurbomachineMap* article = new GunnsTurbomachineMap();
+    delete article;
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the initialize method of the GUNNS Turbomachine Performance Map class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::testInitialize()
+{
+    UT_RESULT;
+
+    /// @test    Nominal initialization.
+    CPPUNIT_ASSERT_NO_THROW(tArticle->initialize(tName, 5, 100.0, 500.0, 3, 1.0, 2.0));
+    CPPUNIT_ASSERT(tName == tArticle->mName);
+    CPPUNIT_ASSERT(5     == tArticle->getNumSpeeds());
+    CPPUNIT_ASSERT(3     == tArticle->getNumRatios());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, tArticle->mSpeedStep, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5,   tArticle->mRatioStep, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(300.0, tArticle->getSpeed(2), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.5,   tArticle->getRatio(1), DBL_EPSILON);
+    CPPUNIT_ASSERT(0.0 == tArticle->mFlow[14]);
+    CPPUNIT_ASSERT(0.0 == tArticle->mEfficiency[14]);
+    CPPUNIT_ASSERT(tArticle->isInitialized());
+
+    /// @test    Re-initialization to a different size.
+    CPPUNIT_ASSERT_NO_THROW(tArticle->initialize(tName, 2, 100.0, 500.0, 2, 1.0, 2.0));
+    CPPUNIT_ASSERT(2 == tArticle->getNumSpeeds());
+    CPPUNIT_ASSERT(2 == tArticle->getNumRatios());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(400.0, tArticle->mSpeedStep, DBL_EPSILON);
+    CPPUNIT_ASSERT(tArticle->isInitialized());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the initialize method exceptions of the GUNNS Turbomachine Performance Map.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::testInitializeExceptions()
+{
+    UT_RESULT;
+
+    /// @test    Exception on empty name.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize("", 5, 100.0, 500.0, 3, 1.0, 2.0),
+                         TsInitializationException);
+
+    /// @test    Exception on too few speeds.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, 1, 100.0, 500.0, 3, 1.0, 2.0),
+                         TsInitializationException);
+
+    /// @test    Exception on too few ratios.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, 5, 100.0, 500.0, 1, 1.0, 2.0),
+                         TsInitializationException);
+
+    /// @test    Exception on empty speed range.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, 5, 500.0, 500.0, 3, 1.0, 2.0),
+                         TsInitializationException);
+
+    /// @test    Exception on reversed ratio range.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, 5, 100.0, 500.0, 3, 2.0, 1.0),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle->isInitialized());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the setPoint method of the GUNNS Turbomachine Performance Map class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::testSetPoint()
+{
+    UT_RESULT;
+
+    tArticle->initialize(tName, 5, 100.0, 500.0, 3, 1.0, 2.0);
+
+    /// @test    Storing a value in row-major order.
+    tArticle->setPoint(2, 1, 7.0, 0.8);
+    CPPUNIT_ASSERT(7.0 == tArticle->mFlow[7]);
+    CPPUNIT_ASSERT(0.8 == tArticle->mEfficiency[7]);
+
+    /// @test    Indexes outside of the table are ignored.
+    tArticle->setPoint(5, 0, 9.0, 0.9);
+    tArticle->setPoint(0, 3, 9.0, 0.9);
+    tArticle->setPoint(-1, 0, 9.0, 0.9);
+    for (int i = 0; i < 15; ++i) {
+        CPPUNIT_ASSERT(9.0 != tArticle->mFlow[i]);
+    }
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the lookup method of the GUNNS Turbomachine Performance Map class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::testLookup()
+{
+    UT_RESULT;
+
+    fillPlane();
+    double flow = 0.0;
+    double eff  = 0.0;
+
+    /// @test    Lookup at a table point.
+    tArticle->lookup(flow, eff, 300.0, 1.5);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(303.0, flow,  DBL_EPSILON * 1000.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.3,   eff,   DBL_EPSILON);
+
+    /// @test    Lookup between table points reproduces the plane.
+    tArticle->lookup(flow, eff, 234.5, 1.8);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(238.1,  flow,  FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.2345, eff,   DBL_EPSILON);
+
+    /// @test    Lookup at the upper corner of the map.
+    tArticle->lookup(flow, eff, 500.0, 2.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(504.0, flow,  FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5,   eff,   DBL_EPSILON);
+
+    /// @test    Interpolation of a non-planar cell stays within the cell's corner values.
+    tArticle->setPoint(0, 0, 0.0, 0.0);
+    tArticle->setPoint(0, 1, 1.0, 0.0);
+    tArticle->setPoint(1, 0, 4.0, 0.0);
+    tArticle->setPoint(1, 1, 2.0, 0.0);
+    tArticle->lookup(flow, eff, 150.0, 1.25);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.75, flow,  DBL_EPSILON);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the lookup method of the GUNNS Turbomachine Performance Map class outside the
+///           map range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTurbomachineMap::testLookupClamped()
+{
+    UT_RESULT;
+
+    fillPlane();
+    double flow = 0.0;
+    double eff  = 0.0;
+
+    /// @test    Speed below the map is clamped to the first row.
+    tArticle->lookup(flow, eff, 0.0, 1.5);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(103.0, flow,  FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.1,   eff,   DBL_EPSILON);
+
+    /// @test    Speed above the map is clamped to the last row.
+    tArticle->lookup(flow, eff, 1000.0, 1.5);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(503.0, flow,  FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5,   eff,   DBL_EPSILON);
+
+    /// @test    Ratio below the map is clamped to the first column.
+    tArticle->lookup(flow, eff, 300.0, 0.5);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(302.0, flow,  FLT_EPSILON);
+
+    /// @test    Ratio above the map is clamped to the last column.
+    tArticle->lookup(flow, eff, 300.0, 3.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(304.0, flow,  FLT_EPSILON);
+
+    /// @test    NaN speed and ratio are clamped to the first row and column.
+    const double nan = std::sqrt(-1.0);
+    tArticle->lookup(flow, eff, nan, 1.5);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(103.0, flow,  FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.1,   eff,   DBL_EPSILON);
+    tArticle->lookup(flow, eff, 300.0, nan);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(302.0, flow,  FLT_EPSILON);
+
+    UT_PASS_LAST;
+}
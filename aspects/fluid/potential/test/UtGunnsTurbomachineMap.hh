@@ -0,0 +1,93 @@
+#ifndef UtGunnsTurbomachineMap_EXISTS
+#define UtGunnsTurbomachineMap_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_TSM_GUNNS_FLUID_POTENTIAL_TURBOMACHINE_MAP Turbomachine Performance Map Unit Tests
+/// @ingroup  UT_TSM_GUNNS_FLUID_POTENTIAL
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Turbomachine Performance Map utility class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "aspects/fluid/potential/GunnsTurbomachineMap.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsTurbomachineMap and befriend UtGunnsTurbomachineMap.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsTurbomachineMap : public GunnsTurbomachineMap
+{
+    public:
+        FriendlyGunnsTurbomachineMap();
+        virtual ~FriendlyGunnsTurbomachineMap();
+        friend class UtGunnsTurbomachineMap;
+    private:
+        FriendlyGunnsTurbomachineMap(const FriendlyGunnsTurbomachineMap&);
+        FriendlyGunnsTurbomachineMap& operator =(const FriendlyGunnsTurbomachineMap&);
+};
+inline FriendlyGunnsTurbomachineMap::FriendlyGunnsTurbomachineMap() : GunnsTurbomachineMap() {}
+inline FriendlyGunnsTurbomachineMap::~FriendlyGunnsTurbomachineMap() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Turbomachine Performance Map unit tests.
+///
+/// @details  This class provides the unit tests for the GUNNS Turbomachine Performance Map utility
+///           class within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsTurbomachineMap : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Turbomachine Performance Map unit test.
+        UtGunnsTurbomachineMap();
+        /// @brief    Default destructs this Turbomachine Performance Map unit test.
+        virtual ~UtGunnsTurbomachineMap();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests the initialize method.
+        void testInitialize();
+        /// @brief    Tests exceptions thrown by the initialize method.
+        void testInitializeExceptions();
+        /// @brief    Tests the setPoint method.
+        void testSetPoint();
+        /// @brief    Tests the lookup method.
+        void testLookup();
+        /// @brief    Tests the lookup method outside of the map range.
+        void testLookupClamped();
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsTurbomachineMap);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testSetPoint);
+        CPPUNIT_TEST(testLookup);
+        CPPUNIT_TEST(testLookupClamped);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyGunnsTurbomachineMap* tArticle;  /**< (--) Article under test */
+        std::string                   tName;     /**< (--) Nominal instance name */
+        static int                    TEST_ID;   /**< (--) Test identification number. */
+
+        /// @brief    Fills the test article with a plane: flow = speed + 2*ratio, eff = 0.01*speed.
+        void fillPlane();
+        /// @brief    Copy constructor unavailable since declared private and not implemented.
+        UtGunnsTurbomachineMap(const UtGunnsTurbomachineMap&);
+        /// @brief    Assignment operator unavailable since declared private and not implemented.
+        UtGunnsTurbomachineMap& operator =(const UtGunnsTurbomachineMap&);
+};
+
+///@}
+
+#endif
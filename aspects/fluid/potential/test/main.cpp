@@ -9,6 +9,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "UtGunnsGasFanCurve.hh"
+#include "UtGunnsTurbomachineMap.hh"
 #include "UtGunnsGasFan.hh"
 #include "UtGunnsPumpCavitation.hh"
 #include "UtGunnsLiquidCentrifugalPump.hh"
@@ -27,6 +28,7 @@ int main(int, char**)
     CppUnit::TextTestRunner runner;
 
     runner.addTest(UtGunnsGasFanCurve::suite());
+    runner.addTest(UtGunnsTurbomachineMap::suite());
     runner.addTest(UtGunnsGasFan::suite());
     runner.addTest(UtGunnsPumpCavitation::suite());
     runner.addTest(UtGunnsLiquidCentrifugalPump::suite());
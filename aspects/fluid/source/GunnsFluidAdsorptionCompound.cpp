@@ -162,8 +162,8 @@ void GunnsFluidAdsorptionCompound::initialize(const std::string&
     mFluid             = fluid;
     mDependentCompound = dependentCompound;
 
-    DefinedChemicalCompounds definedCompounds;
-    const ChemicalCompound* compound = definedCompounds.getCompound(config.mType);
+    const ChemicalCompound* compound =
+            DefinedChemicalCompounds::getInstance()->getCompound(config.mType);
     if (!compound) {
         /// - Throw an exception if the compound type is not valid.
         GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
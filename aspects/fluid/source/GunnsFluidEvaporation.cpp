@@ -179,8 +179,7 @@ void GunnsFluidEvaporation::initialize(const GunnsFluidEvaporationConfigData& co
     validate(configData, inputData);
 
     /// - Initialize with remaining config data.
-    DefinedFluidProperties definedFluidProps;
-    mGasMWeight   = definedFluidProps.getProperties(mGasType)->getMWeight();
+    mGasMWeight   = DefinedFluidProperties::getInstance()->getProperties(mGasType)->getMWeight();
     mEvaporationCoeff = configData.mEvaporationCoeff;
     mPoolMassExponent = configData.mPoolMassExponent;
 
@@ -245,8 +244,8 @@ void GunnsFluidEvaporation::validate(const GunnsFluidEvaporationConfigData& conf
     }
 
     /// - Throw an exception if the gas type isn't a gas.
-    DefinedFluidProperties definedFluidProps;
-    if (FluidProperties::GAS != definedFluidProps.getProperties(mGasType)->getPhase()) {
+    if (FluidProperties::GAS !=
+            DefinedFluidProperties::getInstance()->getProperties(mGasType)->getPhase()) {
         GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
                     "Gas type isn't a gas.");
     }
@@ -326,7 +325,7 @@ void GunnsFluidEvaporation::updateVaporPotential()
 
         const FluidProperties* gasProps = mNodes[1]->getContent()->getProperties(mGasType);
         const double gasSaturationP =
-                gasProps->getSaturationPressure(mNodes[1]->getContent()->getTemperature());
+                gasProps->lookupSaturationPressure(mNodes[1]->getContent()->getTemperature());
 
         mPotentialDrop = gasSaturationP - gasPartialP;
     }
@@ -14,6 +14,7 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsFluidMetabolic2.hh"
+#include "GunnsFluidMetabolicPopulation.hh"
 #include "aspects/fluid/fluid/GunnsFluidTraceCompounds.hh"
 #include "properties/ChemicalCompound.hh"
 #include "math/MsMath.hh"
@@ -344,7 +345,9 @@ GunnsFluidMetabolic2::GunnsFluidMetabolic2()
     mTcNH3(-1),
     mTcCO(-1),
     mTcH2(-1),
-    mTcCH4(-1)
+    mTcCH4(-1),
+    mPopulation(0),
+    mPopulationModule(-1)
 {
     // nothing to do
 }
@@ -650,36 +653,61 @@ void GunnsFluidMetabolic2::updateState(const double dt)
        mFlowDemand = 0.0;
     } else {
 
-        /// - Compute produced/consumed metabolic rates of the primary fluids & heat.
         resetRates();
-        double totalCrew = 0.0;
-        for (int i = 0; i < GunnsFluidMetabolic2::NO_METABOLIC; ++i) {
-            totalCrew += mNCrew[i];
-            mConsumedO2   += mNCrew[i] * mO2ConsumptionRate[i];
-            mProducedHeat += mNCrew[i] * mHeatProductionRate[i];
-            mProducedCO2  += computeProductionRate(mCO2, -1, mNCrew[i], mCO2ProductionRate[i]);
-            mProducedH2O  += computeProductionRate(mH2O, -1, mNCrew[i], mH2OProductionRate[i]);
+        if (mPopulation) {
+            /// - Take the total rates of all crew from this link's module in the population.
+            typedef GunnsFluidMetabolicPopulation Pop;
+            const double* products = mPopulation->getProducts(mPopulationModule);
+            mConsumedO2     = products[Pop::CONSUMED_O2];
+            mProducedHeat   = products[Pop::PRODUCED_HEAT];
+            mProducedCO2    = computeProductionRate(mCO2, -1,        1.0, products[Pop::PRODUCED_CO2]);
+            mProducedH2O    = computeProductionRate(mH2O, -1,        1.0, products[Pop::PRODUCED_H2O]);
+            mProducedNH3    = computeProductionRate(mNH3, mTcNH3,    1.0, products[Pop::PRODUCED_NH3]);
+            mProducedCO     = computeProductionRate(mCO,  mTcCO,     1.0, products[Pop::PRODUCED_CO]);
+            mProducedH2     = computeProductionRate(mH2,  mTcH2,     1.0, products[Pop::PRODUCED_H2]);
+            mProducedCH4    = computeProductionRate(mCH4, mTcCH4,    1.0, products[Pop::PRODUCED_CH4]);
+            mProducedCH4O   = computeProductionRate(-1,   mTcCH4O,   1.0, products[Pop::PRODUCED_CH4O]);
+            mProducedC2H6O  = computeProductionRate(-1,   mTcC2H6O,  1.0, products[Pop::PRODUCED_C2H6O]);
+            mProducedC4H10O = computeProductionRate(-1,   mTcC4H10O, 1.0, products[Pop::PRODUCED_C4H10O]);
+            mProducedCH2O   = computeProductionRate(-1,   mTcCH2O,   1.0, products[Pop::PRODUCED_CH2O]);
+            mProducedC2H4O  = computeProductionRate(-1,   mTcC2H4O,  1.0, products[Pop::PRODUCED_C2H4O]);
+            mProducedC6H6   = computeProductionRate(-1,   mTcC6H6,   1.0, products[Pop::PRODUCED_C6H6]);
+            mProducedC7H8   = computeProductionRate(-1,   mTcC7H8,   1.0, products[Pop::PRODUCED_C7H8]);
+            mProducedC8H10  = computeProductionRate(-1,   mTcC8H10,  1.0, products[Pop::PRODUCED_C8H10]);
+            mProducedCH2CL2 = computeProductionRate(-1,   mTcCH2CL2, 1.0, products[Pop::PRODUCED_CH2CL2]);
+            mProducedC3H6O  = computeProductionRate(-1,   mTcC3H6O,  1.0, products[Pop::PRODUCED_C3H6O]);
+        } else {
+            /// - Compute produced/consumed metabolic rates of the primary fluids & heat.
+            double totalCrew = 0.0;
+            for (int i = 0; i < GunnsFluidMetabolic2::NO_METABOLIC; ++i) {
+                totalCrew += mNCrew[i];
+                mConsumedO2   += mNCrew[i] * mO2ConsumptionRate[i];
+                mProducedHeat += mNCrew[i] * mHeatProductionRate[i];
+                mProducedCO2  += computeProductionRate(mCO2, -1, mNCrew[i], mCO2ProductionRate[i]);
+                mProducedH2O  += computeProductionRate(mH2O, -1, mNCrew[i], mH2OProductionRate[i]);
+            }
+
+            /// - Compute produced trace contaminant metabolic rates.
+            mProducedNH3    += computeProductionRate(mNH3, mTcNH3,    totalCrew, mNH3ProductionRate);
+            mProducedCO     += computeProductionRate(mCO,  mTcCO,     totalCrew, mCOProductionRate);
+            mProducedH2     += computeProductionRate(mH2,  mTcH2,     totalCrew, mH2ProductionRate);
+            mProducedCH4    += computeProductionRate(mCH4, mTcCH4,    totalCrew, mCH4ProductionRate);
+            mProducedCH4O   += computeProductionRate(-1,   mTcCH4O,   totalCrew, mCH4OProductionRate);
+            mProducedC2H6O  += computeProductionRate(-1,   mTcC2H6O,  totalCrew, mC2H6OProductionRate);
+            mProducedC4H10O += computeProductionRate(-1,   mTcC4H10O, totalCrew, mC4H10OProductionRate);
+            mProducedCH2O   += computeProductionRate(-1,   mTcCH2O,   totalCrew, mCH2OProductionRate);
+            mProducedC2H4O  += computeProductionRate(-1,   mTcC2H4O,  totalCrew, mC2H4OProductionRate);
+            mProducedC6H6   += computeProductionRate(-1,   mTcC6H6,   totalCrew, mC6H6ProductionRate);
+            mProducedC7H8   += computeProductionRate(-1,   mTcC7H8,   totalCrew, mC7H8ProductionRate);
+            mProducedC8H10  += computeProductionRate(-1,   mTcC8H10,  totalCrew, mC8H10ProductionRate);
+            mProducedCH2CL2 += computeProductionRate(-1,   mTcCH2CL2, totalCrew, mCH2CL2ProductionRate);
+            mProducedC3H6O  += computeProductionRate(-1,   mTcC3H6O,  totalCrew, mC3H6OProductionRate);
         }
+
         /// - O2 consumption rate is limited by the O2 mass in the node.
         mConsumedO2 = fmin((mNodes[1]->getContent()->getMassFraction(mO2) *
                             mNodes[1]->getContent()->getMass()) / dt, mConsumedO2);
 
-        /// - Compute produced trace contaminant metabolic rates.
-        mProducedNH3    += computeProductionRate(mNH3, mTcNH3,    totalCrew, mNH3ProductionRate);
-        mProducedCO     += computeProductionRate(mCO,  mTcCO,     totalCrew, mCOProductionRate);
-        mProducedH2     += computeProductionRate(mH2,  mTcH2,     totalCrew, mH2ProductionRate);
-        mProducedCH4    += computeProductionRate(mCH4, mTcCH4,    totalCrew, mCH4ProductionRate);
-        mProducedCH4O   += computeProductionRate(-1,   mTcCH4O,   totalCrew, mCH4OProductionRate);
-        mProducedC2H6O  += computeProductionRate(-1,   mTcC2H6O,  totalCrew, mC2H6OProductionRate);
-        mProducedC4H10O += computeProductionRate(-1,   mTcC4H10O, totalCrew, mC4H10OProductionRate);
-        mProducedCH2O   += computeProductionRate(-1,   mTcCH2O,   totalCrew, mCH2OProductionRate);
-        mProducedC2H4O  += computeProductionRate(-1,   mTcC2H4O,  totalCrew, mC2H4OProductionRate);
-        mProducedC6H6   += computeProductionRate(-1,   mTcC6H6,   totalCrew, mC6H6ProductionRate);
-        mProducedC7H8   += computeProductionRate(-1,   mTcC7H8,   totalCrew, mC7H8ProductionRate);
-        mProducedC8H10  += computeProductionRate(-1,   mTcC8H10,  totalCrew, mC8H10ProductionRate);
-        mProducedCH2CL2 += computeProductionRate(-1,   mTcCH2CL2, totalCrew, mCH2CL2ProductionRate);
-        mProducedC3H6O  += computeProductionRate(-1,   mTcC3H6O,  totalCrew, mC3H6OProductionRate);
-
         /// - Those fluid types that can also be trace compounds are only added to the fluid flow
         ///   rate if they are present as fluid constituents in the network.
         double flowDemand = mProducedH2O + mProducedCO2 - mConsumedO2;
@@ -804,6 +832,35 @@ void GunnsFluidMetabolic2::transition(const double        number,
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    population  (--)  Pointer to the crew population, or NULL to stop using one.
+/// @param[in]    module      (--)  Index of this link's module in the crew population.
+///
+/// @returns  bool (--) True if the population was set.
+///
+/// @details  Points this link at the given module of the given crew population.  From then on,
+///           updateState takes the total crew rates from that module instead of computing them from
+///           this link's own mNCrew, which is ignored.  Passing NULL reverts to this link's own
+///           crew.  The population must be initialized and the module index valid, else a warning
+///           is issued and this link is left unchanged.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidMetabolic2::setPopulation(const GunnsFluidMetabolicPopulation* population,
+                                         const int                            module)
+{
+    if (not population) {
+        mPopulation       = 0;
+        mPopulationModule = -1;
+        return true;
+    }
+    if (not population->isInitialized() or module < 0 or module >= population->getNumModules()) {
+        GUNNS_WARNING("rejecting an uninitialized crew population or invalid module index.");
+        return false;
+    }
+    mPopulation       = population;
+    mPopulationModule = module;
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    port  (--)  The port to be assigned.
 /// @param[in]    node  (--)  The desired node to assign the port to.
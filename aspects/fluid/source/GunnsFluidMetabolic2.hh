@@ -43,6 +43,8 @@ ASSUMPTIONS AND LIMITATIONS:
 #include "core/GunnsFluidSource.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
+class GunnsFluidMetabolicPopulation;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Metabolic Configuration Data
 ///
@@ -167,6 +169,10 @@ class GunnsFluidMetabolic2InputData : public GunnsFluidSourceInputData
 ///
 ///           Fluid constituent types GUNNS_O2, GUNNS_H2O, GUNNS_CO2 are required to be in the
 ///           network.  All other fluid and trace compound types are optional.
+///
+///           Optionally, this link can be pointed at a module of a GunnsFluidMetabolicPopulation
+///           with setPopulation.  Then it takes its rates from that module instead of computing them
+///           from its own crew, and its own mNCrew is ignored.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsFluidMetabolic2 : public GunnsFluidSource
 {
@@ -203,6 +209,8 @@ class GunnsFluidMetabolic2 : public GunnsFluidSource
         void transition(const double        number,
                         const MetabolicType fromState,
                         const MetabolicType toState);
+        /// @brief    Sets the crew population module this link takes its rates from.
+        bool setPopulation(const GunnsFluidMetabolicPopulation* population, const int module);
         /// @brief    Returns a pointer to the number of crew members array.
         const double* getNCrew() const;
         /// @brief    Returns O2 consumption rate for this cycle.
@@ -279,6 +287,8 @@ class GunnsFluidMetabolic2 : public GunnsFluidSource
         int    mTcCO;                                                   /**< *o (--)   trick_chkpnt_io(**) Index of Carbon monoxide in trace compounds. */
         int    mTcH2;                                                   /**< *o (--)   trick_chkpnt_io(**) Index of Hydrogen in trace compounds. */
         int    mTcCH4;                                                  /**< *o (--)   trick_chkpnt_io(**) Index of Methane in trace compounds. */
+        const GunnsFluidMetabolicPopulation* mPopulation;               /**< ** (--)   trick_chkpnt_io(**) Optional crew population this link takes its rates from. */
+        int    mPopulationModule;                                       /**< *o (--)   trick_chkpnt_io(**) Index of this link's module in the crew population. */
         /// @brief    Validates the initialization inputs of this Metabolic model.
         void   validate(const GunnsFluidMetabolic2InputData&  inputData) const;
         /// @brief Virtual method for derived links to perform their restart functions.
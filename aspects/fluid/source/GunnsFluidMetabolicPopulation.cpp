@@ -0,0 +1,281 @@
+/**
+@file     GunnsFluidMetabolicPopulation.cpp
+@brief    GUNNS Fluid Metabolic Crew Population implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ((aspects/fluid/source/GunnsFluidMetabolic2.o)
+    (simulation/hs/TsHsMsg.o)
+    (software/exceptions/TsInitializationException.o))
+*/
+
+#include "GunnsFluidMetabolicPopulation.hh"
+#include "core/GunnsMacros.hh"
+#include "simulation/hs/TsHsMsg.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @note     This should be followed by a call to the initialize method before calling an update
+///           method.
+///
+/// @details  Default constructs this GUNNS Fluid Metabolic Crew Population.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidMetabolicPopulation::GunnsFluidMetabolicPopulation()
+    :
+    mName(),
+    mNumModules(0),
+    mRates(),
+    mNCrew(0),
+    mProducts(0),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Metabolic Crew Population.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidMetabolicPopulation::~GunnsFluidMetabolicPopulation()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes dynamic memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMetabolicPopulation::cleanup()
+{
+    TS_DELETE_ARRAY(mProducts);
+    TS_DELETE_ARRAY(mNCrew);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name        (--)  Instance name for messages.
+/// @param[in]  rates       (--)  Metabolic link config data holding the per-crew member rates.
+/// @param[in]  numModules  (--)  Number of modules.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Fluid Metabolic Crew Population with the per-crew member rates
+///           from the given GunnsFluidMetabolic2 config data, and no crew in any module.  Only the
+///           rates are used from the config data, which by default holds the baseline rates.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMetabolicPopulation::initialize(const std::string&                    name,
+                                               const GunnsFluidMetabolic2ConfigData& rates,
+                                               const int                             numModules)
+{
+    /// - Reset initialization status flag.
+    mInitFlag = false;
+
+    /// - Validate the name and number of modules.
+    if (name.empty()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "Empty object name.");
+    }
+    mName = name;
+    if (numModules < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "number of modules < 1.");
+    }
+    mNumModules = numModules;
+
+    /// - Build the per-crew member rates table.  The trace compound rates are the same in all
+    ///   states.
+    const double o2[GunnsFluidMetabolic2::NO_METABOLIC] = {
+            rates.mO2ConsumptionRate_Nominal,    rates.mO2ConsumptionRate_Sleep,
+            rates.mO2ConsumptionRate_Recovery0,  rates.mO2ConsumptionRate_Recovery1,
+            rates.mO2ConsumptionRate_Recovery2,  rates.mO2ConsumptionRate_Recovery3,
+            rates.mO2ConsumptionRate_Exercise0,  rates.mO2ConsumptionRate_Exercise1};
+    const double co2[GunnsFluidMetabolic2::NO_METABOLIC] = {
+            rates.mCO2ProductionRate_Nominal,    rates.mCO2ProductionRate_Sleep,
+            rates.mCO2ProductionRate_Recovery0,  rates.mCO2ProductionRate_Recovery1,
+            rates.mCO2ProductionRate_Recovery2,  rates.mCO2ProductionRate_Recovery3,
+            rates.mCO2ProductionRate_Exercise0,  rates.mCO2ProductionRate_Exercise1};
+    const double h2o[GunnsFluidMetabolic2::NO_METABOLIC] = {
+            rates.mH2OProductionRate_Nominal,    rates.mH2OProductionRate_Sleep,
+            rates.mH2OProductionRate_Recovery0,  rates.mH2OProductionRate_Recovery1,
+            rates.mH2OProductionRate_Recovery2,  rates.mH2OProductionRate_Recovery3,
+            rates.mH2OProductionRate_Exercise0,  rates.mH2OProductionRate_Exercise1};
+    const double heat[GunnsFluidMetabolic2::NO_METABOLIC] = {
+            rates.mHeatProductionRate_Nominal,   rates.mHeatProductionRate_Sleep,
+            rates.mHeatProductionRate_Recovery0, rates.mHeatProductionRate_Recovery1,
+            rates.mHeatProductionRate_Recovery2, rates.mHeatProductionRate_Recovery3,
+            rates.mHeatProductionRate_Exercise0, rates.mHeatProductionRate_Exercise1};
+    for (int state = 0; state < GunnsFluidMetabolic2::NO_METABOLIC; ++state) {
+        double* row = &mRates[state * NUM_PRODUCTS];
+        row[CONSUMED_O2]     = o2[state];
+        row[PRODUCED_CO2]    = co2[state];
+        row[PRODUCED_H2O]    = h2o[state];
+        row[PRODUCED_HEAT]   = heat[state];
+        row[PRODUCED_NH3]    = rates.mNH3ProductionRate;
+        row[PRODUCED_CO]     = rates.mCOProductionRate;
+        row[PRODUCED_H2]     = rates.mH2ProductionRate;
+        row[PRODUCED_CH4]    = rates.mCH4ProductionRate;
+        row[PRODUCED_CH4O]   = rates.mCH4OProductionRate;
+        row[PRODUCED_C2H6O]  = rates.mC2H6OProductionRate;
+        row[PRODUCED_C4H10O] = rates.mC4H10OProductionRate;
+        row[PRODUCED_CH2O]   = rates.mCH2OProductionRate;
+        row[PRODUCED_C2H4O]  = rates.mC2H4OProductionRate;
+        row[PRODUCED_C6H6]   = rates.mC6H6ProductionRate;
+        row[PRODUCED_C7H8]   = rates.mC7H8ProductionRate;
+        row[PRODUCED_C8H10]  = rates.mC8H10ProductionRate;
+        row[PRODUCED_CH2CL2] = rates.mCH2CL2ProductionRate;
+        row[PRODUCED_C3H6O]  = rates.mC3H6OProductionRate;
+    }
+
+    /// - Allocate and zero the crew and product arrays.
+    cleanup();
+    const int numCrew     = mNumModules * GunnsFluidMetabolic2::NO_METABOLIC;
+    const int numProducts = mNumModules * NUM_PRODUCTS;
+    TS_NEW_PRIM_ARRAY_EXT(mNCrew,    numCrew,     double, mName + ".mNCrew");
+    TS_NEW_PRIM_ARRAY_EXT(mProducts, numProducts, double, mName + ".mProducts");
+    for (int i = 0; i < numCrew; ++i) {
+        mNCrew[i] = 0.0;
+    }
+    for (int i = 0; i < numProducts; ++i) {
+        mProducts[i] = 0.0;
+    }
+
+    /// - Set initialization status flag to indicate successful initialization.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Computes the metabolic product rates of all modules, as each module's crew counts in
+///           each state times the per-crew member rates in that state, summed over the states.
+///           The inner loop runs over the contiguous products of one state, with no branches.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMetabolicPopulation::update()
+{
+    for (int module = 0; module < mNumModules; ++module) {
+        const double* crew     = &mNCrew[module * GunnsFluidMetabolic2::NO_METABOLIC];
+        double*       products = &mProducts[module * NUM_PRODUCTS];
+        for (int product = 0; product < NUM_PRODUCTS; ++product) {
+            products[product] = 0.0;
+        }
+        for (int state = 0; state < GunnsFluidMetabolic2::NO_METABOLIC; ++state) {
+            const double  n    = crew[state];
+            const double* rate = &mRates[state * NUM_PRODUCTS];
+            for (int product = 0; product < NUM_PRODUCTS; ++product) {
+                products[product] += n * rate[product];
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  module  (--)  Index of the module.
+///
+/// @return   bool  (--)  True if the module index is valid.
+///
+/// @details  Returns whether the given module index is valid, issuing a warning if not.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidMetabolicPopulation::checkModule(const int module) const
+{
+    if (module < 0 or module >= mNumModules) {
+        GUNNS_WARNING("rejecting request for an invalid module index.");
+        return false;
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  module  (--)  Index of the module.
+/// @param[in]  state   (--)  The metabolic state.
+/// @param[in]  number  (--)  Number of crew members (>= 0).
+///
+/// @details  Sets the number of crew members in the given module in the given metabolic state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMetabolicPopulation::setNCrew(const int                                 module,
+                                             const GunnsFluidMetabolic2::MetabolicType state,
+                                             const double                              number)
+{
+    if (number < 0.0 or state < 0 or state >= GunnsFluidMetabolic2::NO_METABOLIC) {
+        GUNNS_WARNING("rejecting request to set a negative number of crew members or invalid state.");
+    } else if (checkModule(module)) {
+        mNCrew[module * GunnsFluidMetabolic2::NO_METABOLIC + state] = number;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  module     (--)  Index of the module.
+/// @param[in]  total      (--)  Total number of crew members (>= 0) in the module.
+/// @param[in]  fractions  (--)  Fraction of the crew in each metabolic state, NO_METABOLIC long.
+///
+/// @details  Sets the crew of the given module as the given total, split among the metabolic
+///           states by the given fractions.  The fractions are normalized so they needn't sum to 1,
+///           but must not be negative or all zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMetabolicPopulation::setActivityProfile(const int     module,
+                                                       const double  total,
+                                                       const double* fractions)
+{
+    double sum = 0.0;
+    bool   negative = false;
+    for (int state = 0; state < GunnsFluidMetabolic2::NO_METABOLIC; ++state) {
+        sum += fractions[state];
+        negative = negative or fractions[state] < 0.0;
+    }
+    if (total < 0.0 or negative or sum <= 0.0) {
+        GUNNS_WARNING("rejecting request to set an invalid activity profile.");
+    } else if (checkModule(module)) {
+        double* crew = &mNCrew[module * GunnsFluidMetabolic2::NO_METABOLIC];
+        for (int state = 0; state < GunnsFluidMetabolic2::NO_METABOLIC; ++state) {
+            crew[state] = total * fractions[state] / sum;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  module     (--)  Index of the module.
+/// @param[in]  number     (--)  Number of crew members (> 0) to transition.
+/// @param[in]  fromState  (--)  Initial metabolic state.
+/// @param[in]  toState    (--)  Final metabolic state.
+///
+/// @details  Transitions crew members in the given module between metabolic states, the same as
+///           GunnsFluidMetabolic2::transition: the number in any state can't go negative, and
+///           NO_METABOLIC as the from or to state adds crew to or removes crew from the module.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMetabolicPopulation::transition(const int                                 module,
+                                               const double                              number,
+                                               const GunnsFluidMetabolic2::MetabolicType fromState,
+                                               const GunnsFluidMetabolic2::MetabolicType toState)
+{
+    if (number < 0) {
+        /// - Do nothing on negative number of crew members.
+        GUNNS_WARNING("rejecting request to transition a negative number of crew members.");
+    } else if (checkModule(module)) {
+        /// - Transition as many as requested or are available.
+        double* crew = &mNCrew[module * GunnsFluidMetabolic2::NO_METABOLIC];
+        double  n    = number;
+        if (GunnsFluidMetabolic2::NO_METABOLIC != fromState) {
+            n = fmin(number, crew[fromState]);
+            crew[fromState] -= n;
+        }
+        if (GunnsFluidMetabolic2::NO_METABOLIC != toState) {
+            crew[toState]   += n;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  module  (--)  Index of the module.
+///
+/// @return   double  (--)  Total number of crew members in the module.
+///
+/// @details  Returns the total number of crew members in all metabolic states in the given module.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidMetabolicPopulation::getTotalCrew(const int module) const
+{
+    double result = 0.0;
+    if (checkModule(module)) {
+        const double* crew = &mNCrew[module * GunnsFluidMetabolic2::NO_METABOLIC];
+        for (int state = 0; state < GunnsFluidMetabolic2::NO_METABOLIC; ++state) {
+            result += crew[state];
+        }
+    }
+    return result;
+}
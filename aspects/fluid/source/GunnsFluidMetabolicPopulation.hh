@@ -0,0 +1,193 @@
+#ifndef GunnsFluidMetabolicPopulation_EXISTS
+#define GunnsFluidMetabolicPopulation_EXISTS
+
+/**
+@file     GunnsFluidMetabolicPopulation.hh
+@brief    GUNNS Fluid Metabolic Crew Population declarations
+
+@defgroup  TSM_GUNNS_FLUID_SOURCE_METABOLIC_POPULATION  GUNNS Fluid Metabolic Crew Population
+@ingroup   TSM_GUNNS_FLUID_SOURCE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Holds the crew counts in each metabolic state for all modules of a habitat, and computes the
+   metabolic consumption & production rates of all modules together, for GunnsFluidMetabolic2
+   links to apply to their nodes.)
+
+REQUIREMENTS:
+- (NASA/TP-2015-218570 "Life Support Baseline Values and Assumptions Document",
+   M.S. Anderson, et al., March 2015)
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The per-crew member rates in each metabolic state are the same for all modules.)
+
+ LIBRARY DEPENDENCY:
+- ((GunnsFluidMetabolicPopulation.o))
+
+ PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "GunnsFluidMetabolic2.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Metabolic Crew Population
+///
+/// @details  Models the metabolic consumption & production of the crew in many modules at once.
+///           Each module has its own count of crew members in each of the GunnsFluidMetabolic2
+///           metabolic states, its activity profile, stored together in one array.  The per-crew
+///           member rates of each product in each state are stored in a table, built once from a
+///           GunnsFluidMetabolic2ConfigData at initialization.
+///
+///           The update method computes every product rate of every module in one pass over the
+///           arrays, as the crew counts times the rate table.  GunnsFluidMetabolic2 links are
+///           pointed at their module with GunnsFluidMetabolic2::setPopulation, after which they take
+///           their rates from here instead of computing them from their own crew, and just apply
+///           them to their node.  So the cost per crew member is only a few multiply-adds, and
+///           large crews and frequent transitions between states add no per-link work.
+///
+///           The population must be updated before the links' updateState each pass, such as from
+///           the network's pre-solver spotter step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidMetabolicPopulation
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidMetabolicPopulation);
+    public:
+        /// @brief    Enumeration of the metabolic products, in the order stored per module.
+        enum ProductType {
+            CONSUMED_O2     =  0, ///< Consumed oxygen (kg/s).
+            PRODUCED_CO2    =  1, ///< Produced carbon dioxide (kg/s).
+            PRODUCED_H2O    =  2, ///< Produced water (kg/s).
+            PRODUCED_HEAT   =  3, ///< Produced heat (W).
+            PRODUCED_NH3    =  4, ///< Produced ammonia (kg/s).
+            PRODUCED_CO     =  5, ///< Produced carbon monoxide (kg/s).
+            PRODUCED_H2     =  6, ///< Produced hydrogen (kg/s).
+            PRODUCED_CH4    =  7, ///< Produced methane (kg/s).
+            PRODUCED_CH4O   =  8, ///< Produced methanol (kg/s).
+            PRODUCED_C2H6O  =  9, ///< Produced ethanol (kg/s).
+            PRODUCED_C4H10O = 10, ///< Produced 1-butanol (kg/s).
+            PRODUCED_CH2O   = 11, ///< Produced formaldehyde (kg/s).
+            PRODUCED_C2H4O  = 12, ///< Produced acetaldehyde (kg/s).
+            PRODUCED_C6H6   = 13, ///< Produced benzene (kg/s).
+            PRODUCED_C7H8   = 14, ///< Produced toluene (kg/s).
+            PRODUCED_C8H10  = 15, ///< Produced o-xylene (kg/s).
+            PRODUCED_CH2CL2 = 16, ///< Produced dichloromethane (kg/s).
+            PRODUCED_C3H6O  = 17, ///< Produced acetone (kg/s).
+            NUM_PRODUCTS    = 18  ///< Number of products - keep this last!
+        };
+        /// @brief    Default constructs this Metabolic Crew Population.
+        GunnsFluidMetabolicPopulation();
+        /// @brief    Default destructs this Metabolic Crew Population.
+        virtual ~GunnsFluidMetabolicPopulation();
+        /// @brief    Initializes this Metabolic Crew Population.
+        void          initialize(const std::string&                    name,
+                                 const GunnsFluidMetabolic2ConfigData& rates,
+                                 const int                             numModules);
+        /// @brief    Computes the metabolic product rates of all modules.
+        void          update();
+        /// @brief    Sets the number of crew members in a module in a metabolic state.
+        void          setNCrew(const int                                 module,
+                               const GunnsFluidMetabolic2::MetabolicType state,
+                               const double                              number);
+        /// @brief    Sets a module's crew as a total number split among the states by fractions.
+        void          setActivityProfile(const int module, const double total, const double* fractions);
+        /// @brief    Transitions crew members in a module between metabolic states.
+        void          transition(const int                                 module,
+                                 const double                              number,
+                                 const GunnsFluidMetabolic2::MetabolicType fromState,
+                                 const GunnsFluidMetabolic2::MetabolicType toState);
+        /// @brief    Returns the number of crew members in a module in a metabolic state.
+        double        getNCrew(const int module, const GunnsFluidMetabolic2::MetabolicType state) const;
+        /// @brief    Returns the total number of crew members in a module.
+        double        getTotalCrew(const int module) const;
+        /// @brief    Returns the metabolic product rates of a module.
+        const double* getProducts(const int module) const;
+        /// @brief    Returns the number of modules.
+        int           getNumModules() const;
+        /// @brief    Returns whether this Metabolic Crew Population is initialized.
+        bool          isInitialized() const;
+
+    protected:
+        std::string mName;       /**< ** (--) trick_chkpnt_io(**) Instance name for messages. */
+        int         mNumModules; /**< *o (--) trick_chkpnt_io(**) Number of modules. */
+        double      mRates[GunnsFluidMetabolic2::NO_METABOLIC * NUM_PRODUCTS]; /**< (--) trick_chkpnt_io(**) Per-crew member rates of each product (kg/s or W), by state then product. */
+        double*     mNCrew;      /**<    (--)                     Number of crew members in each module in each metabolic state, by module then state. */
+        double*     mProducts;   /**<    (--) trick_chkpnt_io(**) Metabolic product rates (kg/s or W) of each module, by module then product. */
+        bool        mInitFlag;   /**< *o (--) trick_chkpnt_io(**) Initialization complete flag. */
+        /// @brief    Returns whether the module index is valid, with a warning if not.
+        bool          checkModule(const int module) const;
+        /// @brief    Deletes dynamic memory.
+        void          cleanup();
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsFluidMetabolicPopulation(const GunnsFluidMetabolicPopulation&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsFluidMetabolicPopulation& operator =(const GunnsFluidMetabolicPopulation&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  module  (--)  Index of the module.
+/// @param[in]  state   (--)  The metabolic state.
+///
+/// @return   double  (--)  Number of crew members in the module in the state.
+///
+/// @details  Returns the number of crew members in the given module in the given metabolic state.
+///           The module index is not checked.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsFluidMetabolicPopulation::getNCrew(
+        const int module, const GunnsFluidMetabolic2::MetabolicType state) const
+{
+    return mNCrew[module * GunnsFluidMetabolic2::NO_METABOLIC + state];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  module  (--)  Index of the module.
+///
+/// @return   const double*  (--)  The module's product rates, indexed by ProductType.
+///
+/// @details  Returns the metabolic product rates of the given module from the last update.  The
+///           module index is not checked.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* GunnsFluidMetabolicPopulation::getProducts(const int module) const
+{
+    return &mProducts[module * NUM_PRODUCTS];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int  (--)  Number of modules.
+///
+/// @details  Returns the number of modules.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsFluidMetabolicPopulation::getNumModules() const
+{
+    return mNumModules;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool  (--)  True if initialization completed successfully.
+///
+/// @details  Returns whether this Metabolic Crew Population is initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidMetabolicPopulation::isInitialized() const
+{
+    return mInitFlag;
+}
+
+#endif
@@ -9,11 +9,13 @@ LIBRARY DEPENDENCY:
    ((core/GunnsFluidConductor.o)
     (software/exceptions/TsInitializationException.o)
     (software/exceptions/TsOutOfBoundsException.o)
-    (core/GunnsFluidUtils.o))
+    (core/GunnsFluidUtils.o)
+    (aspects/fluid/source/GunnsFluidSeparationKernel.o))
 
 */
 
 #include "GunnsFluidMultiSeparator.hh"
+#include "GunnsFluidSeparationKernel.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
@@ -635,9 +637,13 @@ void GunnsFluidMultiSeparator::computeFlows(const double dt __attribute__((unuse
     ///   next pass.
     /// - mSepBufferExit is the flow that was removed from the bulk flow last pass, reflected
     ///   in the source vector this pass, and added to the exit ports this pass.
+    GunnsFluidSeparationKernel::gatherMoleFractions(mWorkMoleFractions,
+                                                    mNodes[upstreamPort]->getOutflow(),
+                                                    mSepIndex, mNumSepTypes);
+    GunnsFluidSeparationKernel::computeSeparationRates(mSepBufferThru, mSepFraction, mSepIndex,
+                                                       mWorkMoleFractions, fabs(mFlux),
+                                                       mNumSepTypes);
     for (int i=0; i<mNumSepTypes; ++i) {
-        mSepBufferThru[i] = mSepFraction[i] * fabs(mFlux)
-                * mNodes[upstreamPort]->getOutflow()->getMoleFraction(mSepIndex[i]);
         if (mSepBufferExit[i] > DBL_EPSILON) {
             mPortDirections[mSepPort[i]] = SOURCE;
         } else {
@@ -714,22 +720,13 @@ void GunnsFluidMultiSeparator::transportFlows(const double dt __attribute__((unu
         ///   the downstream node, using the separation flow rates from this pass, which will be
         ///   reflected in the link admittance matrix next pass.  This creates state error in the
         ///   downstream node this pass, but this error is corrected later.
-        int nConstituents = mNodes[0]->getContent()->getNConstituents();
         double exitFlux = flux;
         if (mNumSepTypes > 0) {
-            for (int i=0; i<nConstituents; ++i) {
-                /// - At this point moleFractions is molar flow rate, not fractions yet.
-                mWorkMoleFractions[i] = flux * mInternalFluid->getMoleFraction(i);
-            }
-            for (int i=0; i<mNumSepTypes; ++i) {
-                mWorkMoleFractions[mSepIndex[i]] -= mSepBufferThru[i];
-                exitFlux                         -= mSepBufferThru[i];
-            }
+            GunnsFluidSeparationKernel::gatherMoleFractions(mWorkMoleFractions, mInternalFluid);
+            exitFlux = GunnsFluidSeparationKernel::removeSeparated(
+                    mWorkMoleFractions, mWorkMoleFractions, mInternalFluid->getNConstituents(),
+                    flux, mSepIndex, mSepBufferThru, mNumSepTypes);
             if (exitFlux > DBL_EPSILON) {
-                /// - Now moleFractions is normalized back into fractions.
-                for (int i=0; i<nConstituents; ++i) {
-                    mWorkMoleFractions[i] /= exitFlux;
-                }
                 mInternalFluid->setMoleAndMoleFractions(exitFlux, mWorkMoleFractions);
                 mInternalFluid->setTemperature(temperature);
             }
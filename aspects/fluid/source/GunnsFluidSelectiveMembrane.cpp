@@ -115,6 +115,8 @@ GunnsFluidSelectiveMembrane::GunnsFluidSelectiveMembrane()
     mAbsorptionCoeff         (0.0),
     mExternalType            (FluidProperties::NO_FLUID),
     mInternalType            (FluidProperties::NO_FLUID),
+    mExternalIndex           (0),
+    mInternalIndex           (0),
     mEffectiveConductance    (0.0),
     mSystemConductance       (0.0),
     mExternalPartialP        (0.0),
@@ -178,6 +180,11 @@ void GunnsFluidSelectiveMembrane::initialize(const GunnsFluidSelectiveMembraneCo
     int ports[3] = {port0, port1, port2};
     GunnsFluidLink::initialize(configData, inputData, links, ports);
 
+    /// - Look up the absorbed fluid constituent indexes once, so the step doesn't have to search
+    ///   the node fluids for them.
+    mExternalIndex   = mNodes[0]->getContent()->find(mExternalType);
+    mInternalIndex   = mNodes[0]->getContent()->find(mInternalType);
+
     /// - Reset initialization status flag.
     mInitFlag = false;
 
@@ -331,9 +338,9 @@ void GunnsFluidSelectiveMembrane::step(const double dt __attribute__((unused)))
     /// - Compute partial pressure of the absorbed fluid in the internal and external streams.
     const int upstreamPort   = determineSourcePort(mFlux, 0, 1);
     const int downstreamPort = 1 - upstreamPort;
-    mInternalPartialP[upstreamPort]   = computePortPartialP(upstreamPort,   mInternalType);
-    mInternalPartialP[downstreamPort] = computePortPartialP(downstreamPort, mInternalType);
-    mExternalPartialP                 = computePortPartialP(2,              mExternalType);
+    mInternalPartialP[upstreamPort]   = computePortPartialP(upstreamPort,   mInternalIndex);
+    mInternalPartialP[downstreamPort] = computePortPartialP(downstreamPort, mInternalIndex);
+    mExternalPartialP                 = computePortPartialP(2,              mExternalIndex);
 
     /// - Compute saturation state of the absorbed fluid in the external stream.
     const FluidProperties* intProps = mNodes[0]->getContent()->getProperties(mInternalType);
@@ -359,7 +366,7 @@ void GunnsFluidSelectiveMembrane::step(const double dt __attribute__((unused)))
         ///   whether phase change is occurring.
         if (mMembraneDeltaP[upstreamPort] > 0.0) {
             const double availableSource = 0.99 * fabs(mFlowRate)
-                                         * mNodes[upstreamPort]->getContent()->getMassFraction(mInternalType);
+                                         * mNodes[upstreamPort]->getContent()->getMassFraction(mInternalIndex);
             mMembraneFlowRate    = std::min(mMembraneDeltaP[upstreamPort] * mAbsorptionCoeff, availableSource);
             mInternalSaturationP = intProps->getSaturationPressure(mNodes[upstreamPort]->getContent()->getTemperature());
             mInternalSaturated   = (mInternalPartialP[upstreamPort] > mInternalSaturationP);
@@ -443,8 +450,8 @@ void GunnsFluidSelectiveMembrane::computeFlows(const double dt __attribute__((un
     /// - Port and pure fluid determinations.
     const int  upstreamPort      = determineSourcePort(mFlux, 0, 1);
     const int  downstreamPort    = 1 - upstreamPort;
-    const bool pureUpstreamFluid = (1.0 == mNodes[upstreamPort]->getContent()->getMassFraction(mInternalType));
-    const bool pureVentFluid     = (1.0 == mNodes[2]->getContent()->getMassFraction(mExternalType));
+    const bool pureUpstreamFluid = (1.0 == mNodes[upstreamPort]->getContent()->getMassFraction(mInternalIndex));
+    const bool pureVentFluid     = (1.0 == mNodes[2]->getContent()->getMassFraction(mExternalIndex));
 
     /// - Set port flow directions and schedule flow from source nodes.
     mPortDirections[0] = NONE;
@@ -519,7 +526,7 @@ void GunnsFluidSelectiveMembrane::transportFlows(const double dt __attribute__((
         ///   then we have to pull only that type out of the source node by using the node's
         ///   collectInflux method with a negative rate.  Otherwise we use the regular
         ///   collectOutflux method.
-        if (mNodes[2]->getOutflow()->getMassFraction(mExternalType) < 1.0) {
+        if (mNodes[2]->getOutflow()->getMassFraction(mExternalIndex) < 1.0) {
             mExternalMembraneFluid->setTemperature(mNodes[2]->getOutflow()->getTemperature());
             mNodes[2]->collectInflux(mMembraneFlowRate, mExternalMembraneFluid);
         } else {
@@ -531,7 +538,7 @@ void GunnsFluidSelectiveMembrane::transportFlows(const double dt __attribute__((
     ///   flow to the downstream node.
     if (mMembraneFlowRate > m100EpsilonLimit) {
         mInternalMembraneFluid->setTemperature(mNodes[upstreamPort]->getOutflow()->getTemperature());
-        if (mNodes[upstreamPort]->getOutflow()->getMassFraction(mInternalType) < 1.0) {
+        if (mNodes[upstreamPort]->getOutflow()->getMassFraction(mInternalIndex) < 1.0) {
             mNodes[upstreamPort]->collectInflux(-mMembraneFlowRate, mInternalMembraneFluid);
         } else {
             mNodes[upstreamPort]->collectOutflux(mMembraneFlowRate);
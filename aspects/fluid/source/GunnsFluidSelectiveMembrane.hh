@@ -141,6 +141,8 @@ class GunnsFluidSelectiveMembrane : public GunnsFluidLink
         double                     mAbsorptionCoeff;       /**<    (kg/s/kPa)     trick_chkpnt_io(**) Absorption coefficient of the membrane. */
         FluidProperties::FluidType mExternalType;          /**< *o (--)           trick_chkpnt_io(**) Membrane absorbed fluid type in the external vent. */
         FluidProperties::FluidType mInternalType;          /**< *o (--)           trick_chkpnt_io(**) Membrane absorbed fluid type in the internal bulk flow. */
+        int                        mExternalIndex;         /**< *o (--)           trick_chkpnt_io(**) Index of the external absorbed fluid type in the network fluids. */
+        int                        mInternalIndex;         /**< *o (--)           trick_chkpnt_io(**) Index of the internal absorbed fluid type in the network fluids. */
         double                     mEffectiveConductance;  /**< *o (m2)           trick_chkpnt_io(**) Effective conductance of the flow-thru path. */
         double                     mSystemConductance;     /**< *o (kg*mol/s/kPa) trick_chkpnt_io(**) Limited molar conductance of the flow-thru path. */
         double                     mExternalPartialP;      /**< *o (kPa)          trick_chkpnt_io(**) Partial pressure of the absorbed fluid in the external vent. */
@@ -169,8 +171,8 @@ class GunnsFluidSelectiveMembrane : public GunnsFluidLink
         virtual void computePower();
         /// @brief  Checks for valid implementation-specific port node assignment.
         virtual bool checkSpecificPortRules(const int port, const int node) const;
-        /// @brief  Returns the partial pressure of the given fluid type at the given port.
-        double       computePortPartialP(const int port, const FluidProperties::FluidType type) const;
+        /// @brief  Returns the partial pressure of the given fluid constituent at the given port.
+        double       computePortPartialP(const int port, const int index) const;
 
     private:
         /// @details Define the number of ports this link class has.  All objects of the same link
@@ -214,16 +216,16 @@ inline void GunnsFluidSelectiveMembrane::buildAdmittance()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  port  (--)  Link port number to evaluate
-/// @param[in]  type  (--)  Fluid type to evaluate
+/// @param[in]  port   (--)  Link port number to evaluate
+/// @param[in]  index  (--)  Index of the fluid constituent to evaluate
 ///
-/// @returns  double  (kPa)  Partial pressure of the given fluid type at the given port.
+/// @returns  double  (kPa)  Partial pressure of the given fluid constituent at the given port.
 ///
-/// @details  Returns the partial pressure of the given fluid type at the given port.
+/// @details  Returns the partial pressure of the given fluid constituent at the given port.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-inline double GunnsFluidSelectiveMembrane::computePortPartialP(const int port, const FluidProperties::FluidType type) const
+inline double GunnsFluidSelectiveMembrane::computePortPartialP(const int port, const int index) const
 {
-    return mPotentialVector[port] * mNodes[port]->getContent()->getMoleFraction(type);
+    return mPotentialVector[port] * mNodes[port]->getContent()->getMoleFraction(index);
 }
 
 #endif
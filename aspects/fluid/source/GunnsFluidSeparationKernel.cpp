@@ -0,0 +1,126 @@
+/*
+@file     GunnsFluidSeparationKernel.cpp
+@brief    GUNNS Fluid Species Separation Kernel implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ((aspects/fluid/fluid/PolyFluid.o))
+*/
+
+#include "GunnsFluidSeparationKernel.hh"
+#include <cfloat>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Although never instantiated, Trick 10 requires a public destructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidSeparationKernel::~GunnsFluidSeparationKernel()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] moleFractions (--) Array to receive the mole fractions, sized to the number of
+///                                constituents in the fluid.
+/// @param[in]  fluid         (--) Pointer to the fluid to gather from.
+///
+/// @details  Copies the fluid's constituent mole fractions into the given contiguous array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidSeparationKernel::gatherMoleFractions(double* moleFractions, const PolyFluid* fluid)
+{
+    const int nConstituents = fluid->getNConstituents();
+    for (int i=0; i<nConstituents; ++i) {
+        moleFractions[i] = fluid->getMoleFraction(i);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] moleFractions (--) Array to receive the mole fractions, sized to the number of
+///                                constituents in the fluid.
+/// @param[in]  fluid         (--) Pointer to the fluid to gather from.
+/// @param[in]  sepIndex      (--) Constituent index of each separated type.
+/// @param[in]  nSep          (--) Number of separated types.
+///
+/// @details  Copies only the separated constituents' mole fractions into the given contiguous array,
+///           at their constituent indexes, for computeSeparationRates.  The other elements of the
+///           array are not changed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidSeparationKernel::gatherMoleFractions(double*          moleFractions,
+                                                     const PolyFluid* fluid,
+                                                     const int*       sepIndex,
+                                                     const int        nSep)
+{
+    for (int i=0; i<nSep; ++i) {
+        moleFractions[sepIndex[i]] = fluid->getMoleFraction(sepIndex[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] sepRates      (kg*mol/s) Array to receive the separated molar flow rates, sized to
+///                                      nSep.
+/// @param[in]  sepFractions  (--)       Fraction of each separated constituent that is removed.
+/// @param[in]  sepIndex      (--)       Constituent index of each separated type.
+/// @param[in]  moleFractions (--)       Array of bulk flow constituent mole fractions.
+/// @param[in]  flux          (kg*mol/s) Bulk molar flow rate magnitude.
+/// @param[in]  nSep          (--)       Number of separated types.
+///
+/// @details  Computes the molar flow rate of each separated constituent removed from the bulk flow,
+///           as the given fraction of that constituent's molar flow in the bulk flow.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidSeparationKernel::computeSeparationRates(double*       sepRates,
+                                                        const double* sepFractions,
+                                                        const int*    sepIndex,
+                                                        const double* moleFractions,
+                                                        const double  flux,
+                                                        const int     nSep)
+{
+    for (int i=0; i<nSep; ++i) {
+        sepRates[i] = sepFractions[i] * flux * moleFractions[sepIndex[i]];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] exitMoleFractions (--)       Array to receive the exit flow mole fractions, sized to
+///                                          nConstituents.  May be the same array as
+///                                          moleFractions.
+/// @param[in]  moleFractions     (--)       Array of bulk flow constituent mole fractions.
+/// @param[in]  nConstituents     (--)       Number of constituents in the bulk flow.
+/// @param[in]  flux              (kg*mol/s) Bulk molar flow rate magnitude.
+/// @param[in]  sepIndex          (--)       Constituent index of each separated type.
+/// @param[in]  sepRates          (kg*mol/s) Separated molar flow rate of each separated type.
+/// @param[in]  nSep              (--)       Number of separated types.
+///
+/// @returns  double (kg*mol/s) Remaining molar flow rate of the exit flow.
+///
+/// @details  Subtracts the separated molar flows from the bulk flow and normalizes the remainder
+///           back into the exit flow mole fractions.  If there is no remaining exit flow, then the
+///           output array is left holding the remaining constituent molar flow rates and is not
+///           normalized; the caller should not use it in that case.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidSeparationKernel::removeSeparated(double*       exitMoleFractions,
+                                                   const double* moleFractions,
+                                                   const int     nConstituents,
+                                                   const double  flux,
+                                                   const int*    sepIndex,
+                                                   const double* sepRates,
+                                                   const int     nSep)
+{
+    /// - At this point the output is molar flow rate, not fractions yet.
+    double exitFlux = flux;
+    for (int i=0; i<nConstituents; ++i) {
+        exitMoleFractions[i] = flux * moleFractions[i];
+    }
+    for (int i=0; i<nSep; ++i) {
+        exitMoleFractions[sepIndex[i]] -= sepRates[i];
+        exitFlux                       -= sepRates[i];
+    }
+
+    /// - Now the output is normalized back into fractions.
+    if (exitFlux > DBL_EPSILON) {
+        for (int i=0; i<nConstituents; ++i) {
+            exitMoleFractions[i] /= exitFlux;
+        }
+    }
+    return exitFlux;
+}
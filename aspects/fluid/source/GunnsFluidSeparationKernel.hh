@@ -0,0 +1,103 @@
+#ifndef GunnsFluidSeparationKernel_EXISTS
+#define GunnsFluidSeparationKernel_EXISTS
+
+/**
+@file     GunnsFluidSeparationKernel.hh
+@brief    GUNNS Fluid Species Separation Kernel declarations
+
+@defgroup  TSM_GUNNS_FLUID_SOURCE_SEPARATION_KERNEL  Fluid Species Separation Kernel
+@ingroup   TSM_GUNNS_FLUID_SOURCE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Shared species-separation math for the separator & membrane link models, operating on
+   contiguous arrays of constituent mole fractions and separation rates.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The caller owns all array arguments and sizes them to the network's number of constituents or
+   number of separated types, as documented for each method.  The kernel never allocates.)
+- (Separation index arrays are assumed to contain valid, unique constituent indexes.)
+- (Each call operates on the flow through one separator.)
+
+ LIBRARY DEPENDENCY:
+- ((GunnsFluidSeparationKernel.o))
+
+ PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "aspects/fluid/fluid/PolyFluid.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Species Separation Kernel
+///
+/// @details  A collection of methods for removing selected constituents from a bulk flow, shared by
+///           the separator and membrane links.  PolyFluid stores its constituent fractions inside
+///           per-constituent objects, so the link first gathers the fractions it needs once into a
+///           contiguous working array with gatherMoleFractions, either all of them or only those of
+///           the separated constituents, and the remaining methods then run simple loops over plain
+///           arrays without further PolyFluid accessor calls or lookups.  All working arrays are
+///           owned by the calling link and allocated at initialization, so nothing is allocated
+///           during the step.
+///
+///           Each call processes the flow through a single separator: the separation rates and the
+///           exit flow are relative to that one bulk flow rate, so separators can't be batched into
+///           one call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidSeparationKernel
+{
+    public:
+        /// @brief  Copies the fluid's constituent mole fractions into the given array.
+        static void   gatherMoleFractions(double* moleFractions, const PolyFluid* fluid);
+        /// @brief  Copies the fluid's separated constituent mole fractions into the given array.
+        static void   gatherMoleFractions(double*          moleFractions,
+                                          const PolyFluid* fluid,
+                                          const int*       sepIndex,
+                                          const int        nSep);
+        /// @brief  Computes the separated molar flow rates of the separated constituents.
+        static void   computeSeparationRates(double*       sepRates,
+                                             const double* sepFractions,
+                                             const int*    sepIndex,
+                                             const double* moleFractions,
+                                             const double  flux,
+                                             const int     nSep);
+        /// @brief  Removes separated flows from a bulk flow and returns the remaining exit flow.
+        static double removeSeparated(double*       exitMoleFractions,
+                                      const double* moleFractions,
+                                      const int     nConstituents,
+                                      const double  flux,
+                                      const int*    sepIndex,
+                                      const double* sepRates,
+                                      const int     nSep);
+        /// @brief  Although never instantiated, Trick 10 requires a public destructor.
+        virtual ~GunnsFluidSeparationKernel();
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Default constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsFluidSeparationKernel();
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsFluidSeparationKernel(const GunnsFluidSeparationKernel&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsFluidSeparationKernel& operator =(const GunnsFluidSeparationKernel&);
+};
+
+/// @}
+
+#endif
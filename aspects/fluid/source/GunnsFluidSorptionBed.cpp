@@ -103,9 +103,9 @@ void GunnsFluidSorptionBedSorbate::init(const SorbateProperties* properties,
     /// - Store the fluid indexes for the offgas compounds.
     const std::vector<SorbateInteractingCompounds>* sorbateOffgasCompounds = mProperties->getOffgasCompounds();
     if (sorbateOffgasCompounds->size() > 0) {
-        DefinedChemicalCompounds definedChems;
+        const DefinedChemicalCompounds* definedChems = DefinedChemicalCompounds::getInstance();
         for (unsigned int i=0; i<sorbateOffgasCompounds->size(); ++i) {
-            const ChemicalCompound* chemProps = definedChems.getCompound(sorbateOffgasCompounds->at(i).mCompound);
+            const ChemicalCompound* chemProps = definedChems->getCompound(sorbateOffgasCompounds->at(i).mCompound);
             mOffgasIndexes.push_back(GunnsFluidSorptionBedFluidIndex());
             fluid->findCompound(mOffgasIndexes.back().mFluid,
                                 mOffgasIndexes.back().mTc, chemProps);
@@ -90,6 +90,7 @@ class UtGunnsFluidEvaporation: public CppUnit::TestFixture
         PolyFluidInputData*              tFluidInput1;       /**< (--)      Nominal input data */
         PolyFluidInputData*              tFluidInput2;       /**< (--)      Nominal input data */
         double*                          tFractions;         /**< (--)      Nominal input data */
+        static const double              SAT_TOLERANCE;      /**< (--)      Saturation table relative tolerance */
 
     public:
         UtGunnsFluidEvaporation();
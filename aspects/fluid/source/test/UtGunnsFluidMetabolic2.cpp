@@ -10,6 +10,7 @@
 #include "software/exceptions/TsOutOfBoundsException.hh"
 #include "strings/UtResult.hh"
 
+#include "aspects/fluid/source/GunnsFluidMetabolicPopulation.hh"
 #include "UtGunnsFluidMetabolic2.hh"
 
 /// @details  Test identification number.
@@ -1084,5 +1085,79 @@ void UtGunnsFluidMetabolic2::testRestart()
     CPPUNIT_ASSERT(0.0 == tArticle->mProducedH2);
     CPPUNIT_ASSERT(0.0 == tArticle->mProducedCH4);
 
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic link model taking its rates from a crew population.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolic2::testPopulation()
+{
+    UT_RESULT;
+
+    /// - Initialize the nominal article with its own crew, and a second article with no crew.
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, 2, 1);
+    GunnsFluidMetabolic2InputData emptyInput;
+    FriendlyGunnsFluidMetabolic2 article;
+    article.initialize(*tConfigData, emptyInput, tLinks, 2, 1);
+
+    /// - Put the nominal crew in module 1 of a population.
+    GunnsFluidMetabolicPopulation population;
+
+    /// @test setPopulation rejects an uninitialized population.
+    CPPUNIT_ASSERT(not article.setPopulation(&population, 0));
+    CPPUNIT_ASSERT(0 == article.mPopulation);
+
+    population.initialize("population", *tConfigData, 2);
+    for (int i = 0; i < GunnsFluidMetabolic2::NO_METABOLIC; ++i) {
+        population.setNCrew(1, static_cast<GunnsFluidMetabolic2::MetabolicType>(i),
+                            tArticle->mNCrew[i]);
+    }
+    population.update();
+
+    /// @test setPopulation rejects invalid module indexes.
+    CPPUNIT_ASSERT(not article.setPopulation(&population, -1));
+    CPPUNIT_ASSERT(not article.setPopulation(&population,  2));
+    CPPUNIT_ASSERT(0  == article.mPopulation);
+    CPPUNIT_ASSERT(-1 == article.mPopulationModule);
+
+    /// @test setPopulation with valid arguments.
+    CPPUNIT_ASSERT(article.setPopulation(&population, 1));
+    CPPUNIT_ASSERT(&population == article.mPopulation);
+    CPPUNIT_ASSERT(1           == article.mPopulationModule);
+
+    /// @test the population link's rates match the same crew held in the link.
+    tArticle->updateState(0.1);
+    article.updateState(0.1);
+    const double tol = 1.0e-15;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mConsumedO2,     article.mConsumedO2,     tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedCO2,    article.mProducedCO2,    tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedH2O,    article.mProducedH2O,    tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedHeat,   article.mProducedHeat,   1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedCH4O,   article.mProducedCH4O,   tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedC2H6O,  article.mProducedC2H6O,  tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedC4H10O, article.mProducedC4H10O, tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedCH2O,   article.mProducedCH2O,   tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedC2H4O,  article.mProducedC2H4O,  tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedC6H6,   article.mProducedC6H6,   tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedC7H8,   article.mProducedC7H8,   tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedC8H10,  article.mProducedC8H10,  tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedCH2CL2, article.mProducedCH2CL2, tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedC3H6O,  article.mProducedC3H6O,  tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedNH3,    article.mProducedNH3,    tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedCO,     article.mProducedCO,     tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedH2,     article.mProducedH2,     tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mProducedCH4,    article.mProducedCH4,    tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mFlowDemand,     article.mFlowDemand,     tol);
+    CPPUNIT_ASSERT(0.0 < article.mFlowDemand);
+
+    /// @test a NULL population reverts to the link's own (empty) crew.
+    CPPUNIT_ASSERT(article.setPopulation(0, 1));
+    CPPUNIT_ASSERT(0  == article.mPopulation);
+    CPPUNIT_ASSERT(-1 == article.mPopulationModule);
+    article.updateState(0.1);
+    CPPUNIT_ASSERT(0.0 == article.mConsumedO2);
+    CPPUNIT_ASSERT(0.0 == article.mFlowDemand);
+
     UT_PASS_LAST;
 }
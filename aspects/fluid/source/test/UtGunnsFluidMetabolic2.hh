@@ -90,6 +90,8 @@ class UtGunnsFluidMetabolic2: public CppUnit::TestFixture
         void testInitializationExceptions();
         /// @brief    Tests restart method.
         void testRestart();
+        /// @brief    Tests taking rates from a crew population.
+        void testPopulation();
    private:
         CPPUNIT_TEST_SUITE(UtGunnsFluidMetabolic2);
         CPPUNIT_TEST(testConfigAndInput);
@@ -104,6 +106,7 @@ class UtGunnsFluidMetabolic2: public CppUnit::TestFixture
         CPPUNIT_TEST(testPortMapping);
         CPPUNIT_TEST(testInitializationExceptions);
         CPPUNIT_TEST(testRestart);
+        CPPUNIT_TEST(testPopulation);
         CPPUNIT_TEST_SUITE_END();
         enum { N_CONSTITUENTS = 4, N_TC = 14 };
         DefinedFluidProperties*             tFluidProperties;    /**< (--) Defined fluid properties. */
@@ -0,0 +1,317 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((aspects/fluid/source/GunnsFluidMetabolicPopulation.o))
+***************************************************************************************************/
+
+#include "software/exceptions/TsInitializationException.hh"
+#include "strings/UtResult.hh"
+
+#include "UtGunnsFluidMetabolicPopulation.hh"
+
+/// @details  Test identification number.
+int UtGunnsFluidMetabolicPopulation::TEST_ID = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructor for the UtGunnsFluidMetabolicPopulation test class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidMetabolicPopulation::UtGunnsFluidMetabolicPopulation()
+    :
+    tConfigData(),
+    tName(),
+    tNumModules(),
+    tArticle()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructor for the UtGunnsFluidMetabolicPopulation test class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidMetabolicPopulation::~UtGunnsFluidMetabolicPopulation()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::setUp()
+{
+    /// - Define the nominal rates config data, with the baseline rates.
+    tName       = "nominal";
+    tConfigData = new GunnsFluidMetabolic2ConfigData(tName, 0);
+    tNumModules = 3;
+
+    /// - Create the nominal test article.
+    tArticle = new FriendlyGunnsFluidMetabolicPopulation();
+
+    /// - Increment the test identification number.
+    ++TEST_ID;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::tearDown()
+{
+    delete tArticle;
+    delete tConfigData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic Crew Population default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::testDefaultConstruction()
+{
+    UT_RESULT_FIRST;
+
+    /// @test default construction values.
+    CPPUNIT_ASSERT(""    == tArticle->mName);
+    CPPUNIT_ASSERT(0     == tArticle->mNumModules);
+    CPPUNIT_ASSERT(0.0   == tArticle->mRates[0]);
+    CPPUNIT_ASSERT(0     == tArticle->mNCrew);
+    CPPUNIT_ASSERT(0     == tArticle->mProducts);
+    CPPUNIT_ASSERT(false == tArticle->isInitialized());
+
+    /// @test new/delete for code coverage.
+    GunnsFluidMetabolicPopulation* article = new GunnsFluidMetabolicPopulation();
+    delete article;
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic Crew Population nominal initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::testNominalInitialization()
+{
+    UT_RESULT;
+
+    tArticle->initialize(tName, *tConfigData, tNumModules);
+
+    /// @test initialized state.
+    CPPUNIT_ASSERT(tName       == tArticle->mName);
+    CPPUNIT_ASSERT(tNumModules == tArticle->getNumModules());
+    CPPUNIT_ASSERT(tArticle->isInitialized());
+    for (int i = 0; i < tNumModules * GunnsFluidMetabolic2::NO_METABOLIC; ++i) {
+        CPPUNIT_ASSERT(0.0 == tArticle->mNCrew[i]);
+    }
+    for (int i = 0; i < tNumModules * GunnsFluidMetabolicPopulation::NUM_PRODUCTS; ++i) {
+        CPPUNIT_ASSERT(0.0 == tArticle->mProducts[i]);
+    }
+
+    /// @test the rates table holds the config rates by state then product.
+    const int n = GunnsFluidMetabolicPopulation::NUM_PRODUCTS;
+    const double* sleep    = &tArticle->mRates[GunnsFluidMetabolic2::SLEEP      * n];
+    const double* exercise = &tArticle->mRates[GunnsFluidMetabolic2::EXERCISE_1 * n];
+    CPPUNIT_ASSERT(tConfigData->mO2ConsumptionRate_Sleep      == sleep[GunnsFluidMetabolicPopulation::CONSUMED_O2]);
+    CPPUNIT_ASSERT(tConfigData->mCO2ProductionRate_Sleep      == sleep[GunnsFluidMetabolicPopulation::PRODUCED_CO2]);
+    CPPUNIT_ASSERT(tConfigData->mH2OProductionRate_Sleep      == sleep[GunnsFluidMetabolicPopulation::PRODUCED_H2O]);
+    CPPUNIT_ASSERT(tConfigData->mHeatProductionRate_Sleep     == sleep[GunnsFluidMetabolicPopulation::PRODUCED_HEAT]);
+    CPPUNIT_ASSERT(tConfigData->mO2ConsumptionRate_Exercise1  == exercise[GunnsFluidMetabolicPopulation::CONSUMED_O2]);
+    CPPUNIT_ASSERT(tConfigData->mHeatProductionRate_Exercise1 == exercise[GunnsFluidMetabolicPopulation::PRODUCED_HEAT]);
+    CPPUNIT_ASSERT(tConfigData->mNH3ProductionRate            == sleep[GunnsFluidMetabolicPopulation::PRODUCED_NH3]);
+    CPPUNIT_ASSERT(tConfigData->mNH3ProductionRate            == exercise[GunnsFluidMetabolicPopulation::PRODUCED_NH3]);
+    CPPUNIT_ASSERT(tConfigData->mC3H6OProductionRate          == exercise[GunnsFluidMetabolicPopulation::PRODUCED_C3H6O]);
+
+    /// @test re-initialization.
+    tArticle->initialize(tName, *tConfigData, 1);
+    CPPUNIT_ASSERT(1 == tArticle->getNumModules());
+    CPPUNIT_ASSERT(tArticle->isInitialized());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic Crew Population initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::testInitializationExceptions()
+{
+    UT_RESULT;
+
+    /// @test for exception on empty name.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize("", *tConfigData, tNumModules),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle->isInitialized());
+
+    /// @test for exception on no modules.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, *tConfigData, 0),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle->isInitialized());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic Crew Population crew setter and getter methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::testAccess()
+{
+    UT_RESULT;
+
+    tArticle->initialize(tName, *tConfigData, tNumModules);
+
+    /// @test setNCrew and getters.
+    tArticle->setNCrew(1, GunnsFluidMetabolic2::SLEEP,      2.0);
+    tArticle->setNCrew(1, GunnsFluidMetabolic2::EXERCISE_0, 0.5);
+    tArticle->setNCrew(2, GunnsFluidMetabolic2::NOMINAL,    4.0);
+    CPPUNIT_ASSERT(2.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::SLEEP));
+    CPPUNIT_ASSERT(0.5 == tArticle->getNCrew(1, GunnsFluidMetabolic2::EXERCISE_0));
+    CPPUNIT_ASSERT(0.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::NOMINAL));
+    CPPUNIT_ASSERT(4.0 == tArticle->getNCrew(2, GunnsFluidMetabolic2::NOMINAL));
+    CPPUNIT_ASSERT(0.0 == tArticle->getTotalCrew(0));
+    CPPUNIT_ASSERT(2.5 == tArticle->getTotalCrew(1));
+    CPPUNIT_ASSERT(4.0 == tArticle->getTotalCrew(2));
+
+    /// @test setNCrew rejects a negative number, invalid state and invalid modules.
+    tArticle->setNCrew(1, GunnsFluidMetabolic2::SLEEP, -1.0);
+    tArticle->setNCrew(1, GunnsFluidMetabolic2::NO_METABOLIC, 1.0);
+    tArticle->setNCrew(-1, GunnsFluidMetabolic2::SLEEP, 1.0);
+    tArticle->setNCrew(tNumModules, GunnsFluidMetabolic2::SLEEP, 1.0);
+    CPPUNIT_ASSERT(2.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::SLEEP));
+    CPPUNIT_ASSERT(2.5 == tArticle->getTotalCrew(1));
+
+    /// @test getTotalCrew with invalid module.
+    CPPUNIT_ASSERT(0.0 == tArticle->getTotalCrew(tNumModules));
+
+    /// @test getProducts points into the products array by module.
+    CPPUNIT_ASSERT(&tArticle->mProducts[2 * GunnsFluidMetabolicPopulation::NUM_PRODUCTS]
+                   == tArticle->getProducts(2));
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic Crew Population update method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::testUpdate()
+{
+    UT_RESULT;
+
+    tArticle->initialize(tName, *tConfigData, tNumModules);
+    tArticle->setNCrew(0, GunnsFluidMetabolic2::NOMINAL,    3.0);
+    tArticle->setNCrew(0, GunnsFluidMetabolic2::SLEEP,      2.0);
+    tArticle->setNCrew(0, GunnsFluidMetabolic2::RECOVERY_2, 0.25);
+    tArticle->setNCrew(0, GunnsFluidMetabolic2::EXERCISE_0, 4.0);
+    tArticle->setNCrew(2, GunnsFluidMetabolic2::EXERCISE_1, 1.0);
+    tArticle->update();
+
+    /// @test module 0 products.
+    const double* products = tArticle->getProducts(0);
+    const double expectedO2  = 3.0  * tConfigData->mO2ConsumptionRate_Nominal
+                             + 2.0  * tConfigData->mO2ConsumptionRate_Sleep
+                             + 0.25 * tConfigData->mO2ConsumptionRate_Recovery2
+                             + 4.0  * tConfigData->mO2ConsumptionRate_Exercise0;
+    const double expectedCO2 = 3.0  * tConfigData->mCO2ProductionRate_Nominal
+                             + 2.0  * tConfigData->mCO2ProductionRate_Sleep
+                             + 0.25 * tConfigData->mCO2ProductionRate_Recovery2
+                             + 4.0  * tConfigData->mCO2ProductionRate_Exercise0;
+    const double expectedH2O = 3.0  * tConfigData->mH2OProductionRate_Nominal
+                             + 2.0  * tConfigData->mH2OProductionRate_Sleep
+                             + 0.25 * tConfigData->mH2OProductionRate_Recovery2
+                             + 4.0  * tConfigData->mH2OProductionRate_Exercise0;
+    const double expectedQ   = 3.0  * tConfigData->mHeatProductionRate_Nominal
+                             + 2.0  * tConfigData->mHeatProductionRate_Sleep
+                             + 0.25 * tConfigData->mHeatProductionRate_Recovery2
+                             + 4.0  * tConfigData->mHeatProductionRate_Exercise0;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedO2,  products[GunnsFluidMetabolicPopulation::CONSUMED_O2],   1.0e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedCO2, products[GunnsFluidMetabolicPopulation::PRODUCED_CO2],  1.0e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedH2O, products[GunnsFluidMetabolicPopulation::PRODUCED_H2O],  1.0e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedQ,   products[GunnsFluidMetabolicPopulation::PRODUCED_HEAT], 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(9.25 * tConfigData->mNH3ProductionRate,
+                                 products[GunnsFluidMetabolicPopulation::PRODUCED_NH3],  1.0e-20);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(9.25 * tConfigData->mC6H6ProductionRate,
+                                 products[GunnsFluidMetabolicPopulation::PRODUCED_C6H6], 1.0e-20);
+
+    /// @test module 1 has no crew and no products.
+    for (int i = 0; i < GunnsFluidMetabolicPopulation::NUM_PRODUCTS; ++i) {
+        CPPUNIT_ASSERT(0.0 == tArticle->getProducts(1)[i]);
+    }
+
+    /// @test module 2 products.
+    products = tArticle->getProducts(2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tConfigData->mO2ConsumptionRate_Exercise1,
+                                 products[GunnsFluidMetabolicPopulation::CONSUMED_O2],    1.0e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tConfigData->mCH2CL2ProductionRate,
+                                 products[GunnsFluidMetabolicPopulation::PRODUCED_CH2CL2], 1.0e-20);
+
+    /// @test products are recomputed, not accumulated, on the next update.
+    tArticle->setNCrew(2, GunnsFluidMetabolic2::EXERCISE_1, 0.0);
+    tArticle->update();
+    for (int i = 0; i < GunnsFluidMetabolicPopulation::NUM_PRODUCTS; ++i) {
+        CPPUNIT_ASSERT(0.0 == tArticle->getProducts(2)[i]);
+    }
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic Crew Population transition method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::testTransition()
+{
+    UT_RESULT;
+
+    tArticle->initialize(tName, *tConfigData, tNumModules);
+
+    /// @test adding crew to a module.
+    tArticle->transition(1, 4.0, GunnsFluidMetabolic2::NO_METABOLIC, GunnsFluidMetabolic2::NOMINAL);
+    CPPUNIT_ASSERT(4.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::NOMINAL));
+    CPPUNIT_ASSERT(0.0 == tArticle->getTotalCrew(0));
+
+    /// @test transition between states.
+    tArticle->transition(1, 1.0, GunnsFluidMetabolic2::NOMINAL, GunnsFluidMetabolic2::EXERCISE_0);
+    CPPUNIT_ASSERT(3.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::NOMINAL));
+    CPPUNIT_ASSERT(1.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::EXERCISE_0));
+
+    /// @test transition limited to the number available.
+    tArticle->transition(1, 2.0, GunnsFluidMetabolic2::EXERCISE_0, GunnsFluidMetabolic2::RECOVERY_0);
+    CPPUNIT_ASSERT(0.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::EXERCISE_0));
+    CPPUNIT_ASSERT(1.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::RECOVERY_0));
+
+    /// @test removing crew from a module.
+    tArticle->transition(1, 1.0, GunnsFluidMetabolic2::NOMINAL, GunnsFluidMetabolic2::NO_METABOLIC);
+    CPPUNIT_ASSERT(2.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::NOMINAL));
+    CPPUNIT_ASSERT(3.0 == tArticle->getTotalCrew(1));
+
+    /// @test rejects negative number and invalid module.
+    tArticle->transition(1, -1.0, GunnsFluidMetabolic2::NOMINAL, GunnsFluidMetabolic2::SLEEP);
+    tArticle->transition(3,  1.0, GunnsFluidMetabolic2::NOMINAL, GunnsFluidMetabolic2::SLEEP);
+    CPPUNIT_ASSERT(2.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::NOMINAL));
+    CPPUNIT_ASSERT(0.0 == tArticle->getNCrew(1, GunnsFluidMetabolic2::SLEEP));
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Metabolic Crew Population setActivityProfile method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidMetabolicPopulation::testActivityProfile()
+{
+    UT_RESULT;
+
+    tArticle->initialize(tName, *tConfigData, tNumModules);
+
+    /// @test nominal profile, normalized from fractions that don't sum to 1.
+    double fractions[GunnsFluidMetabolic2::NO_METABOLIC] = {2.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+    tArticle->setActivityProfile(0, 100.0, fractions);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(50.0, tArticle->getNCrew(0, GunnsFluidMetabolic2::NOMINAL),    1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(25.0, tArticle->getNCrew(0, GunnsFluidMetabolic2::SLEEP),      1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(25.0, tArticle->getNCrew(0, GunnsFluidMetabolic2::EXERCISE_0), 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, tArticle->getTotalCrew(0), 1.0e-12);
+
+    /// @test rejects negative total, negative or all-zero fractions, and invalid module.
+    tArticle->setActivityProfile(0, -1.0, fractions);
+    tArticle->setActivityProfile(4, 10.0, fractions);
+    fractions[1] = -1.0;
+    tArticle->setActivityProfile(0, 10.0, fractions);
+    const double zeros[GunnsFluidMetabolic2::NO_METABOLIC] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    tArticle->setActivityProfile(0, 10.0, zeros);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, tArticle->getTotalCrew(0), 1.0e-12);
+    CPPUNIT_ASSERT(0.0 == tArticle->getTotalCrew(1));
+
+    UT_PASS_LAST;
+}
@@ -0,0 +1,95 @@
+#ifndef UtGunnsFluidMetabolicPopulation_EXISTS
+#define UtGunnsFluidMetabolicPopulation_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_TSM_GUNNS_FLUID_SOURCE_METABOLIC_POPULATION   Metabolic Crew Population Unit Tests
+/// @ingroup  UT_TSM_GUNNS_FLUID_SOURCE
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Fluid Metabolic Crew Population.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "aspects/fluid/source/GunnsFluidMetabolicPopulation.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidMetabolicPopulation and befriend UtGunnsFluidMetabolicPopulation.
+///
+/// @details  Class derived from the unit under test. It just has a default constructor and
+///           destructor, but it befriends the unit test case driver to allow it access to protected
+///           data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidMetabolicPopulation : public GunnsFluidMetabolicPopulation {
+    public:
+        FriendlyGunnsFluidMetabolicPopulation();
+        virtual ~FriendlyGunnsFluidMetabolicPopulation();
+        friend class UtGunnsFluidMetabolicPopulation;
+};
+inline FriendlyGunnsFluidMetabolicPopulation::FriendlyGunnsFluidMetabolicPopulation()
+    : GunnsFluidMetabolicPopulation() {}
+inline FriendlyGunnsFluidMetabolicPopulation::~FriendlyGunnsFluidMetabolicPopulation() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Metabolic Crew Population unit tests.
+///
+/// @details  This class provides the unit tests for the GUNNS Fluid Metabolic Crew Population
+///           within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidMetabolicPopulation: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Metabolic Crew Population unit test.
+        UtGunnsFluidMetabolicPopulation();
+        /// @brief    Default destructs this Metabolic Crew Population unit test.
+        virtual ~UtGunnsFluidMetabolicPopulation();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests nominal initialization.
+        void testNominalInitialization();
+        /// @brief    Tests initialization exceptions.
+        void testInitializationExceptions();
+        /// @brief    Tests the crew setter and getter methods.
+        void testAccess();
+        /// @brief    Tests the update method.
+        void testUpdate();
+        /// @brief    Tests the transition method.
+        void testTransition();
+        /// @brief    Tests the setActivityProfile method.
+        void testActivityProfile();
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsFluidMetabolicPopulation);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testNominalInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testAccess);
+        CPPUNIT_TEST(testUpdate);
+        CPPUNIT_TEST(testTransition);
+        CPPUNIT_TEST(testActivityProfile);
+        CPPUNIT_TEST_SUITE_END();
+        GunnsFluidMetabolic2ConfigData*        tConfigData;  /**< (--) Nominal rates config data. */
+        std::string                            tName;        /**< (--) Nominal name. */
+        int                                    tNumModules;  /**< (--) Nominal number of modules. */
+        FriendlyGunnsFluidMetabolicPopulation* tArticle;     /**< (--) Article under test. */
+        static int                             TEST_ID;      /**< (--) Test identification number. */
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtGunnsFluidMetabolicPopulation(const UtGunnsFluidMetabolicPopulation&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtGunnsFluidMetabolicPopulation& operator =(const UtGunnsFluidMetabolicPopulation&);
+};
+
+///@}
+
+#endif
@@ -732,8 +732,19 @@ void UtGunnsFluidMultiSeparator::testComputeFlows()
     tArticle->mSepBufferExit[0] = expectedSepH2O;
     tArticle->mSepBufferExit[1] = expectedSepH2;
 
-    /// @test forward bulk flow.
+    /// @test forward bulk flow, gathering only the separated constituents' mole fractions.
+    for (int i = 0; i < tNodes[0].getContent()->getNConstituents(); ++i) {
+        tArticle->mWorkMoleFractions[i] = -1.0;
+    }
     tArticle->computeFlows(tTimeStep);
+    for (int i = 0; i < tNodes[0].getContent()->getNConstituents(); ++i) {
+        if (i == tArticle->mSepIndex[0] or i == tArticle->mSepIndex[1]) {
+            CPPUNIT_ASSERT(tNodes[0].getOutflow()->getMoleFraction(i)
+                           == tArticle->mWorkMoleFractions[i]);
+        } else {
+            CPPUNIT_ASSERT(-1.0 == tArticle->mWorkMoleFractions[i]);
+        }
+    }
 
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDp,     tArticle->mPotentialDrop,        DBL_EPSILON);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux,   tArticle->mFlux,                 DBL_EPSILON);
@@ -216,6 +216,8 @@ void UtGunnsFluidSelectiveMembrane::testDefaultConstruction()
     CPPUNIT_ASSERT(0.0                       == tArticle->mAbsorptionCoeff);
     CPPUNIT_ASSERT(FluidProperties::NO_FLUID == tArticle->mExternalType);
     CPPUNIT_ASSERT(FluidProperties::NO_FLUID == tArticle->mInternalType);
+    CPPUNIT_ASSERT(0                         == tArticle->mExternalIndex);
+    CPPUNIT_ASSERT(0                         == tArticle->mInternalIndex);
     CPPUNIT_ASSERT(0.0                       == tArticle->mEffectiveConductance);
     CPPUNIT_ASSERT(0.0                       == tArticle->mSystemConductance);
     CPPUNIT_ASSERT(0.0                       == tArticle->mExternalPartialP);
@@ -263,6 +265,8 @@ void UtGunnsFluidSelectiveMembrane::testNominalInitialization()
     CPPUNIT_ASSERT(tAbsorptionCoeff   == article.mAbsorptionCoeff);
     CPPUNIT_ASSERT(tInternalType      == article.mInternalType);
     CPPUNIT_ASSERT(tExternalType      == article.mExternalType);
+    CPPUNIT_ASSERT(1                  == article.mExternalIndex);
+    CPPUNIT_ASSERT(2                  == article.mInternalIndex);
     CPPUNIT_ASSERT(0.0                == article.mEffectiveConductance);
     CPPUNIT_ASSERT(0.0                == article.mSystemConductance);
     CPPUNIT_ASSERT(0.0                == article.mInternalPartialP[0]);
@@ -0,0 +1,192 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsFluidSeparationKernel.hh"
+#include "strings/UtResult.hh"
+
+/// @details  Test identification number.
+int UtGunnsFluidSeparationKernel::TEST_ID = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsFluidSeparationKernel class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidSeparationKernel::UtGunnsFluidSeparationKernel()
+    :
+    tFluidProperties(),
+    tFluidConfig(),
+    tFluidInput(),
+    tFluid(),
+    tMassFractions()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsFluidSeparationKernel class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidSeparationKernel::~UtGunnsFluidSeparationKernel()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidSeparationKernel::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tFluid;
+    delete tFluidInput;
+    delete tFluidConfig;
+    delete tFluidProperties;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidSeparationKernel::setUp()
+{
+    tFluidProperties = new DefinedFluidProperties();
+    FluidProperties::FluidType types[N_FLUIDS] = {FluidProperties::GUNNS_N2,
+                                                  FluidProperties::GUNNS_O2,
+                                                  FluidProperties::GUNNS_H2O,
+                                                  FluidProperties::GUNNS_CO2};
+    tFluidConfig = new PolyFluidConfigData(tFluidProperties, types, N_FLUIDS);
+
+    tMassFractions[0] = 0.75;
+    tMassFractions[1] = 0.20;
+    tMassFractions[2] = 0.04;
+    tMassFractions[3] = 0.01;
+    tFluidInput = new PolyFluidInputData(294.261,         //temperature
+                                         101.325,         //pressure
+                                         0.0,             //flowRate
+                                         0.0,             //mass
+                                         tMassFractions); //massFractions
+    tFluid = new PolyFluid(*tFluidConfig, *tFluidInput);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the gatherMoleFractions method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidSeparationKernel::testGatherMoleFractions()
+{
+    UT_RESULT_FIRST;
+
+    /// - Verify the fluid mole fractions are copied to the contiguous array.
+    double moleFractions[N_FLUIDS] = {0.0, 0.0, 0.0, 0.0};
+    GunnsFluidSeparationKernel::gatherMoleFractions(moleFractions, tFluid);
+    for (int i=0; i<N_FLUIDS; ++i) {
+        CPPUNIT_ASSERT(tFluid->getMoleFraction(i) == moleFractions[i]);
+    }
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the gatherMoleFractions method for only the separated constituents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidSeparationKernel::testGatherSepMoleFractions()
+{
+    UT_RESULT;
+
+    /// - Verify only the separated constituents' mole fractions are copied to the array.
+    double    moleFractions[N_FLUIDS] = {-1.0, -1.0, -1.0, -1.0};
+    const int sepIndex[2]             = {3, 1};
+    GunnsFluidSeparationKernel::gatherMoleFractions(moleFractions, tFluid, sepIndex, 2);
+    CPPUNIT_ASSERT(-1.0                       == moleFractions[0]);
+    CPPUNIT_ASSERT(tFluid->getMoleFraction(1) == moleFractions[1]);
+    CPPUNIT_ASSERT(-1.0                       == moleFractions[2]);
+    CPPUNIT_ASSERT(tFluid->getMoleFraction(3) == moleFractions[3]);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the computeSeparationRates method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidSeparationKernel::testSeparationRates()
+{
+    UT_RESULT;
+
+    /// - Separate H2O and CO2 at different fractions.
+    double       moleFractions[N_FLUIDS];
+    const int    sepIndex[2]     = {2, 3};
+    const double sepFractions[2] = {0.5, 1.0};
+    double       sepRates[2]     = {0.0, 0.0};
+    const double flux            = 0.01;
+    GunnsFluidSeparationKernel::gatherMoleFractions(moleFractions, tFluid);
+    GunnsFluidSeparationKernel::computeSeparationRates(sepRates, sepFractions, sepIndex,
+                                                       moleFractions, flux, 2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5 * flux * moleFractions[2], sepRates[0], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0 * flux * moleFractions[3], sepRates[1], DBL_EPSILON);
+
+    /// - Verify zero rates for zero flux.
+    GunnsFluidSeparationKernel::computeSeparationRates(sepRates, sepFractions, sepIndex,
+                                                       moleFractions, 0.0, 2);
+    CPPUNIT_ASSERT(0.0 == sepRates[0]);
+    CPPUNIT_ASSERT(0.0 == sepRates[1]);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the removeSeparated method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidSeparationKernel::testRemoveSeparated()
+{
+    UT_RESULT;
+
+    /// - Remove all of the CO2 and half of the H2O, in place.
+    double       moleFractions[N_FLUIDS];
+    double       exitFractions[N_FLUIDS];
+    const int    sepIndex[2]     = {2, 3};
+    const double sepFractions[2] = {0.5, 1.0};
+    double       sepRates[2];
+    const double flux            = 0.01;
+    GunnsFluidSeparationKernel::gatherMoleFractions(moleFractions, tFluid);
+    GunnsFluidSeparationKernel::computeSeparationRates(sepRates, sepFractions, sepIndex,
+                                                       moleFractions, flux, 2);
+    double exitFlux = GunnsFluidSeparationKernel::removeSeparated(
+            exitFractions, moleFractions, N_FLUIDS, flux, sepIndex, sepRates, 2);
+
+    /// - Verify exit flux and mole conservation of each constituent.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(flux - sepRates[0] - sepRates[1], exitFlux, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(flux * moleFractions[0], exitFlux * exitFractions[0], 1.0e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(flux * moleFractions[1], exitFlux * exitFractions[1], 1.0e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(flux * moleFractions[2] - sepRates[0],
+                                 exitFlux * exitFractions[2], 1.0e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, exitFractions[3], DBL_EPSILON);
+    double sum = 0.0;
+    for (int i=0; i<N_FLUIDS; ++i) {
+        sum += exitFractions[i];
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, sum, DBL_EPSILON);
+
+    /// - Verify the output may be the same array as the input.
+    double inPlace[N_FLUIDS];
+    for (int i=0; i<N_FLUIDS; ++i) {
+        inPlace[i] = moleFractions[i];
+    }
+    exitFlux = GunnsFluidSeparationKernel::removeSeparated(
+            inPlace, inPlace, N_FLUIDS, flux, sepIndex, sepRates, 2);
+    for (int i=0; i<N_FLUIDS; ++i) {
+        CPPUNIT_ASSERT(exitFractions[i] == inPlace[i]);
+    }
+
+    /// - Verify no normalization and zero exit flux when everything is separated.
+    const int    allIndex[N_FLUIDS] = {0, 1, 2, 3};
+    const double allFractions[N_FLUIDS] = {1.0, 1.0, 1.0, 1.0};
+    double       allRates[N_FLUIDS];
+    GunnsFluidSeparationKernel::computeSeparationRates(allRates, allFractions, allIndex,
+                                                       moleFractions, flux, N_FLUIDS);
+    exitFlux = GunnsFluidSeparationKernel::removeSeparated(
+            exitFractions, moleFractions, N_FLUIDS, flux, allIndex, allRates, N_FLUIDS);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, exitFlux, DBL_EPSILON);
+    for (int i=0; i<N_FLUIDS; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, exitFractions[i], DBL_EPSILON);
+    }
+
+    UT_PASS_LAST;
+}
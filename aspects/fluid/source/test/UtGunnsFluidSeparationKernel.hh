@@ -0,0 +1,62 @@
+#ifndef UtGunnsFluidSeparationKernel_EXISTS
+#define UtGunnsFluidSeparationKernel_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_FLUID_SEPARATION_KERNEL    Gunns Fluid Species Separation Kernel Unit Test
+/// @ingroup  UT_GUNNS_FLUID
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Fluid Species Separation Kernel
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "aspects/fluid/source/GunnsFluidSeparationKernel.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns fluid species separation kernel unit tests.
+///
+/// @details  This class provides unit tests within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidSeparationKernel: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidSeparationKernel(const UtGunnsFluidSeparationKernel& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidSeparationKernel& operator =(const UtGunnsFluidSeparationKernel& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsFluidSeparationKernel);
+        CPPUNIT_TEST(testGatherMoleFractions);
+        CPPUNIT_TEST(testGatherSepMoleFractions);
+        CPPUNIT_TEST(testSeparationRates);
+        CPPUNIT_TEST(testRemoveSeparated);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief Enumeration of the number of fluid constituents in the test.
+        enum {N_FLUIDS = 4};
+        DefinedFluidProperties* tFluidProperties; /**< (--) Nominal config data */
+        PolyFluidConfigData*    tFluidConfig;     /**< (--) Nominal config data */
+        PolyFluidInputData*     tFluidInput;      /**< (--) Nominal input data */
+        PolyFluid*              tFluid;           /**< (--) Test fluid */
+        double                  tMassFractions[N_FLUIDS]; /**< (--) Nominal input data */
+        static int              TEST_ID;          /**< (--) Test identification number. */
+
+    public:
+        UtGunnsFluidSeparationKernel();
+        virtual ~UtGunnsFluidSeparationKernel();
+        void tearDown();
+        void setUp();
+        void testGatherMoleFractions();
+        void testGatherSepMoleFractions();
+        void testSeparationRates();
+        void testRemoveSeparated();
+};
+
+///@}
+
+#endif
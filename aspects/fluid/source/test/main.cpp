@@ -17,11 +17,13 @@
 #include "UtGunnsFluidFireSource.hh"
 #include "UtGunnsFluidMetabolic.hh"
 #include "UtGunnsFluidMetabolic2.hh"
+#include "UtGunnsFluidMetabolicPopulation.hh"
 #include "UtGunnsFluidMultiAdsorber.hh"
 #include "UtGunnsFluidMultiSeparator.hh"
 #include "UtGunnsFluidReactor.hh"
 #include "UtGunnsFluidPhaseChangeSource.hh"
 #include "UtGunnsFluidSeparatorGas.hh"
+#include "UtGunnsFluidSeparationKernel.hh"
 #include "UtGunnsFluidSeparatorLiquid.hh"
 #include "UtGunnsFluidSimpleH2Redox.hh"
 #include "UtGunnsFluidSublimator.hh"
@@ -52,11 +54,13 @@ int main(int, char**) {
     runner.addTest(UtGunnsFluidFireSource::suite());
     runner.addTest(UtGunnsFluidMetabolic::suite());
     runner.addTest(UtGunnsFluidMetabolic2::suite());
+    runner.addTest(UtGunnsFluidMetabolicPopulation::suite());
     runner.addTest(UtGunnsFluidMultiAdsorber::suite());
     runner.addTest(UtGunnsFluidMultiSeparator::suite());
     runner.addTest(UtGunnsFluidPhaseChangeSource::suite());
     runner.addTest(UtGunnsFluidSeparatorGas::suite());
     runner.addTest(UtGunnsFluidSeparatorLiquid::suite());
+    runner.addTest(UtGunnsFluidSeparationKernel::suite());
     runner.addTest(UtGunnsFluidSimpleH2Redox::suite());
     runner.addTest(UtGunnsFluidSublimator::suite());
     runner.addTest(UtGunnsFluidHeater::suite());
@@ -0,0 +1,124 @@
+/**
+@file
+@brief    GUNNS Thermal Property Lookup implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((properties/SolidProperties.o))
+*/
+
+#include "GunnsThermalPropertyLookup.hh"
+#include <algorithm>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Thermal Property Lookup.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalPropertyLookup::GunnsThermalPropertyLookup()
+    :
+    mMaterial(0),
+    mProperty(SPECIFIC_HEAT),
+    mTolerance(0.0),
+    mNominal(0.0),
+    mEvaluated(false),
+    mTemperature(0.0),
+    mBin(0),
+    mScale(1.0),
+    mRatio(1.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Thermal Property Lookup.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalPropertyLookup::~GunnsThermalPropertyLookup()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] material  (--) The solid material, or null for none.
+/// @param[in] property  (--) The material property to look up.
+/// @param[in] tolerance (K)  Temperature change to re-evaluate the property.
+///
+/// @details  Initializes this Thermal Property Lookup with the material and property, and resets
+///           the scale to 1.  The nominal property is set by the first update.  Negative tolerances
+///           are limited to zero, which re-evaluates the property on every temperature change.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalPropertyLookup::initialize(const SolidProperties* material,
+                                            const PropertyType     property,
+                                            const double           tolerance)
+{
+    mMaterial    = material;
+    mProperty    = property;
+    mTolerance   = std::max(0.0, tolerance);
+    mNominal     = 0.0;
+    mEvaluated   = false;
+    mTemperature = 0.0;
+    mBin         = 0;
+    mScale       = 1.0;
+    mRatio       = 1.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] temperature (K) Current temperature of the link.
+///
+/// @returns  bool (--) True if the scale changed, and the owner should apply getRatio.
+///
+/// @details  Re-evaluates the property scale at the given temperature if it hasn't been evaluated
+///           yet, or if the temperature has moved by more than the tolerance or into a different
+///           bin of the material's property table since the last evaluation.  Otherwise the scale
+///           is held, so the owner's admittance doesn't change.
+///
+///           The first update takes the property at its temperature, normally the link's initial
+///           temperature, as the nominal property, since the link's configured value is for that
+///           temperature.  The material's constant properties don't always match its table there,
+///           so normalizing to them would step the link's value on the first update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalPropertyLookup::update(const double temperature)
+{
+    if (not isActive()) {
+        return false;
+    }
+
+    const int bin = mMaterial->getTableBin(temperature);
+    if (mEvaluated and bin == mBin and std::fabs(temperature - mTemperature) <= mTolerance) {
+        return false;
+    }
+
+    const double property = lookup(temperature);
+    if (not mEvaluated) {
+        if (property <= 0.0) {
+            return false;
+        }
+        mNominal = property;
+    }
+    mEvaluated   = true;
+    mTemperature = temperature;
+    mBin         = bin;
+    const double scale = property / mNominal;
+    if (scale == mScale or scale <= 0.0) {
+        return false;
+    }
+    mRatio = scale / mScale;
+    mScale = scale;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] temperature (K) Temperature to evaluate the property at.
+///
+/// @returns  double (--) The material property at the temperature.
+///
+/// @details  Returns the material's specific heat or thermal conductivity at the temperature.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsThermalPropertyLookup::lookup(const double temperature) const
+{
+    if (SPECIFIC_HEAT == mProperty) {
+        return mMaterial->getSpecificHeat(temperature);
+    }
+    return mMaterial->getThermalConductivity(temperature);
+}
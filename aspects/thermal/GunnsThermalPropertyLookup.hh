@@ -0,0 +1,144 @@
+#ifndef GunnsThermalPropertyLookup_EXISTS
+#define GunnsThermalPropertyLookup_EXISTS
+
+/**
+@file
+@brief    GUNNS Thermal Property Lookup declarations
+
+@defgroup  TSM_GUNNS_THERMAL_PROPERTY_LOOKUP    GUNNS Thermal Property Lookup
+@ingroup   TSM_GUNNS_THERMAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+  (This is a utility class for scaling a thermal link's capacitance or conductance with the
+   temperature-dependent specific heat or thermal conductivity of its solid material.  The property
+   is only re-evaluated when the temperature moves by more than a tolerance or into a different bin
+   of the material's property table, so links don't change their admittance every frame.)
+
+REQUIREMENTS:
+  ()
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((The link's configured capacitance or conductance is assumed to be for the material's property
+    at the temperature of the first update, normally the link's initial temperature, so the scale
+    is the property at temperature over the property at that temperature.)
+   (The capacitance or conductance is assumed proportional to the property, i.e. the link's mass
+    and geometry don't change with temperature.))
+
+LIBRARY DEPENDENCY:
+  ((GunnsThermalPropertyLookup.o))
+
+PROGRAMMERS:
+  ((CACI) (Install) (2026-10))
+@{
+*/
+
+#include "properties/SolidProperties.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Thermal Property Lookup.
+///
+/// @details  Owners call update with the link's temperature, and when it returns true, multiply
+///           the link's capacitance or conductance by getRatio.  Scaling by the ratio of successive
+///           scales, rather than setting a value, preserves any other edits to the link's value,
+///           such as the thermal network's capacitance edit groups.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalPropertyLookup
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsThermalPropertyLookup);
+    public:
+        /// @brief  Enumeration of the material properties that can be looked up.
+        enum PropertyType {
+            SPECIFIC_HEAT        = 0, ///< Specific heat, for capacitance.
+            THERMAL_CONDUCTIVITY = 1  ///< Thermal conductivity, for conductance.
+        };
+        /// @brief  Default constructs this Thermal Property Lookup.
+        GunnsThermalPropertyLookup();
+        /// @brief  Default destructs this Thermal Property Lookup.
+        virtual ~GunnsThermalPropertyLookup();
+        /// @brief  Initializes this Thermal Property Lookup with the material and property.
+        void   initialize(const SolidProperties* material,
+                          const PropertyType     property,
+                          const double           tolerance);
+        /// @brief  Returns whether this has a temperature-dependent material to look up.
+        bool   isActive() const;
+        /// @brief  Re-evaluates the scale if the temperature has moved enough, and returns whether it changed.
+        bool   update(const double temperature);
+        /// @brief  Returns the property scale relative to the nominal property.
+        double getScale() const;
+        /// @brief  Returns the ratio of the new scale to the previous scale from the last change.
+        double getRatio() const;
+        /// @brief  Returns the temperature the scale was last evaluated at.
+        double getTemperature() const;
+
+    protected:
+        const SolidProperties* mMaterial;    /**< ** (--) trick_chkpnt_io(**) The solid material, or null. */
+        PropertyType           mProperty;    /**<    (--) trick_chkpnt_io(**) The material property to look up. */
+        double                 mTolerance;   /**<    (K)                      Temperature change to re-evaluate the property. */
+        double                 mNominal;     /**<    (--) trick_chkpnt_io(**) Material property at the first update temperature. */
+        bool                   mEvaluated;   /**<    (--) trick_chkpnt_io(**) The scale has been evaluated. */
+        double                 mTemperature; /**<    (K)  trick_chkpnt_io(**) Temperature of the last evaluation. */
+        int                    mBin;         /**<    (--) trick_chkpnt_io(**) Property table bin of the last evaluation. */
+        double                 mScale;       /**<    (--) trick_chkpnt_io(**) Property scale relative to the nominal property. */
+        double                 mRatio;       /**<    (--) trick_chkpnt_io(**) Ratio of the new scale to the previous scale from the last change. */
+        /// @brief  Returns the material property at the given temperature.
+        double lookup(const double temperature) const;
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalPropertyLookup(const GunnsThermalPropertyLookup& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalPropertyLookup& operator =(const GunnsThermalPropertyLookup& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the material has temperature-dependent properties.
+///
+/// @details  Returns whether this has a temperature-dependent material to look up.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsThermalPropertyLookup::isActive() const
+{
+    return mMaterial and mMaterial->isTemperatureDependent();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) Property scale relative to the nominal property.
+///
+/// @details  Returns the property scale relative to the material's nominal property.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsThermalPropertyLookup::getScale() const
+{
+    return mScale;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) Ratio of the new scale to the previous scale.
+///
+/// @details  Returns the ratio of the new scale to the previous scale from the last change, for
+///           owners to multiply their capacitance or conductance by.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsThermalPropertyLookup::getRatio() const
+{
+    return mRatio;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (K) Temperature of the last evaluation.
+///
+/// @details  Returns the temperature the scale was last evaluated at.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsThermalPropertyLookup::getTemperature() const
+{
+    return mTemperature;
+}
+
+#endif
@@ -5,6 +5,7 @@
 LIBRARY DEPENDENCY:
    (
     (parsing/ParseTool.o)
+    (parsing/XmlDocumentCache.o)
     (parsing/tinyxml/tinyxml.o)
     (software/exceptions/TsInitializationException.o)
     (software/exceptions/TsParseException.o)
@@ -51,11 +52,13 @@ ThermFileParser::ThermFileParser(const std::string name)
     vCapTemperatures(0),
     vCapCapacitances(0),
     vCapEditGroupIdentifiers(0),
+    vCapMaterials(0),
     numLinksCond(0),
     vCondNames(0),
     vCondPorts0(0),
     vCondPorts1(0),
     vCondConductivities(0),
+    vCondMaterials(0),
     numLinksRad(0),
     numInputEntriesRad(0),
     vRadNames(0),
@@ -84,7 +87,8 @@ ThermFileParser::ThermFileParser(const std::string name)
     vSrcInits(0),
     vSrcScalars(0),
     vSrcPorts(0),
-    vSrcFracs(0)
+    vSrcFracs(0),
+    mDocCache()
 {
     // nothing to do
 }
@@ -137,7 +141,8 @@ void ThermFileParser::initialize(const std::string& name)
             TS_PTCS_ERREX(TsInitializationException, "initialization error", "a ThermFileParser has empty object name.")
         }
 
-        /// - Read each file and build data vectors.
+        /// - Parse the files in parallel, then read each file and build data vectors.
+        preloadFiles();
         readNodeFile();
         readCondFile();
         readRadFile();
@@ -529,20 +534,17 @@ void ThermFileParser::readThermInputFileRad()
 ///           the list and calls the register() method given by the function pointer argument.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermFileParser::readFile(std::string& xmlFile, const char* linkTag,
-        void (ThermFileParser::*registerLink)(TiXmlElement*))
+        void (ThermFileParser::*registerLink)(const TiXmlElement*))
 {
     try
     {
-        /// - Instantiate a TiXmlDocument for loading data from the file.
-        TiXmlDocument doc;
-
-        /// - Validate file accessibility and load XML data.
-        openFile(doc, xmlFile);
+        /// - Validate file accessibility and get the parsed XML data.
+        const TiXmlDocument* doc = openFile(xmlFile);
 
         /// - Get the element data from the <list> tag. Raise an error if not found.
-        TiXmlElement* list = getElement(&doc, "list", true);
+        const TiXmlElement* list = getElement(doc, "list", true);
         /// - Get the element data from the <linkTag> tag. Don't raise an error if not found.
-        TiXmlElement* elem = getElement(list, linkTag, false);
+        const TiXmlElement* elem = getElement(list, linkTag, false);
 
         /// - Loop through all relevant elements listed in the XML file.
         while (0 != elem)
@@ -561,14 +563,17 @@ void ThermFileParser::readFile(std::string& xmlFile, const char* linkTag,
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in,out]  doc      (--) TiXmlDocument object to load XML file data into
 /// @param[in]      xmlFile  (--) path and name of XML file
 ///
+/// @return     const TiXmlDocument*  (--) The parsed XML document.
+///
 /// @throw      TsParseException if unable to access file or if XML load fails
 ///
-/// @details    Loads given xml file into TiXmlDocument member.
+/// @details    Loads given xml file into the document cache, and returns the cached document.  The
+///             file is only parsed again if it has changed since it was last loaded, so reading the
+///             same file for different link tags, or on re-initialization, doesn't repeat the parse.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::openFile(TiXmlDocument& doc, std::string& xmlFile)
+const TiXmlDocument* ThermFileParser::openFile(std::string& xmlFile)
 {
     try
     {
@@ -581,14 +586,36 @@ void ThermFileParser::openFile(TiXmlDocument& doc, std::string& xmlFile)
         TS_PTCS_ERREX(TsParseException, "file accessibility error", "Cannot open file for parsing.")
     }
 
-    /// - Call TinyXml LoadFile().
-    doc.LoadFile(xmlFile);
+    /// - Load the file into the cache, or skip it if unchanged.
+    mDocCache.load(xmlFile);
 
     /// - Throw an exception if document was not able to load.
-    if( !doc.LoadFile() )
+    const TiXmlDocument* doc = mDocCache.find(xmlFile);
+    if (0 == doc)
     {
         TS_PTCS_ERREX(TsParseException, "invalid XML format", xmlFile)
     }
+    return doc;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Loads all of the configured XML files into the document cache at once, so that the
+///           changed files are parsed in parallel.  The files are then read and their data
+///           registered one at a time, in a fixed order, so the results don't depend on which file
+///           finishes parsing first.  Errors are ignored here; they are reported when each file is
+///           read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::preloadFiles()
+{
+    std::vector<std::string> files;
+    files.push_back(mNodeFile);
+    files.push_back(mCondFile);
+    files.push_back(mRadFile);
+    files.push_back(mHtrFile);
+    files.push_back(mPanFile);
+    files.push_back(mEtcFile);
+    files.push_back(mThermInputFile);
+    files.push_back(mThermInputFileRad);
+    mDocCache.load(files);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Clears Node name vector and map object. Resets the number of Nodes count.
@@ -612,6 +639,7 @@ void ThermFileParser::clearCap()
     vCapPorts.clear();
     vCapTemperatures.clear();
     vCapCapacitances.clear();
+    vCapMaterials.clear();
     /// - Clear the number of capacitance links.
     numLinksCap = 0;
 }
@@ -626,6 +654,7 @@ void ThermFileParser::clearCond()
     vCondPorts0.clear();
     vCondPorts1.clear();
     vCondConductivities.clear();
+    vCondMaterials.clear();
     /// - Clear the number of conduction links.
     numLinksCond = 0;
 }
@@ -708,10 +737,10 @@ void ThermFileParser::clearSrc()
 ///           Populates Capacitance link vectors with the strings stored in the tags
 ///           from the node-file. The Capacitance links count is then incremented as well.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerCapEditGroups(TiXmlElement* capEditing)
+void ThermFileParser::registerCapEditGroups(const TiXmlElement* capEditing)
 {
     /// - Get the element data from the <linkTag> tag.
-    TiXmlElement* elem = getElement(capEditing, "group", true);
+    const TiXmlElement* elem = getElement(capEditing, "group", true);
 
     /// - Loop through all relevant elements listed in the XML file.
     while (0 != elem)
@@ -731,7 +760,7 @@ void ThermFileParser::registerCapEditGroups(TiXmlElement* capEditing)
 ///           here but provides the function signature needed to be used as a function pointer in
 ///           the readFile method.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::countNode(TiXmlElement* node __attribute__((unused)))
+void ThermFileParser::countNode(const TiXmlElement* node __attribute__((unused)))
 {
     numNodes++;
 }
@@ -743,7 +772,7 @@ void ThermFileParser::countNode(TiXmlElement* node __attribute__((unused)))
 ///           Populates Capacitance link vectors with the strings stored in the tags
 ///           from the node-file. The Capacitance links count is then incremented as well.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerNode(TiXmlElement* node)
+void ThermFileParser::registerNode(const TiXmlElement* node)
 {
     /// Create a baseline nodeName.
     std::string nodeName = "(error setting name)";
@@ -761,6 +790,8 @@ void ThermFileParser::registerNode(TiXmlElement* node)
                                                                "Thermal cap link: " + nodeName + ".");
         /// - Get cap-edit-group identifier.
         const int groupId = getCapEditGroupId(node);
+        /// - Get the optional solid material.
+        const SolidProperties::SolidType material = getMaterial(node);
 
         /// - If everything above was successful, store
         ///   Node/Capacitance Link data into their corresponding vectors.
@@ -770,6 +801,7 @@ void ThermFileParser::registerNode(TiXmlElement* node)
         vCapTemperatures.push_back(temperature);
         vCapCapacitances.push_back(capacitance);
         vCapEditGroupIdentifiers.push_back(groupId);
+        vCapMaterials.push_back(material);
 
         /// - Populate the NodeMap and increment the counts.
         mNodeMap[nodeName] = numNodes;
@@ -788,7 +820,7 @@ void ThermFileParser::registerNode(TiXmlElement* node)
 /// @details  Populates conduction link vectors with the strings stored in the tags
 ///           from the cond-file. The conduction links count is then incremented.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerCond(TiXmlElement* conduction)
+void ThermFileParser::registerCond(const TiXmlElement* conduction)
 {
     /// Create a baseline linkName.
     std::string linkName = "(error setting name)";
@@ -818,12 +850,14 @@ void ThermFileParser::registerCond(TiXmlElement* conduction)
         /// - Get remaining data.
         const double conduct = ParseTool::convertToDouble( getText(conduction, "conductivity"), TS_HS_PTCS,
                                                            "Thermal cond link: " + linkName + ".");
+        const SolidProperties::SolidType material = getMaterial(conduction);
         /// - If everything above was successful,
         ///   store conduction link data into their corresponding vectors.
         vCondNames.push_back(linkName);
         vCondPorts0.push_back( nodeIndex0 );
         vCondPorts1.push_back( nodeIndex1 );
         vCondConductivities.push_back(conduct);
+        vCondMaterials.push_back(material);
 
         /// - Increment the count.
         numLinksCond++;
@@ -840,7 +874,7 @@ void ThermFileParser::registerCond(TiXmlElement* conduction)
 /// @details  Populates radiation link vectors with the strings stored in the tags
 ///           from the rad-file. The radiation links count is then incremented.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerRad(TiXmlElement* radiation)
+void ThermFileParser::registerRad(const TiXmlElement* radiation)
 {
     /// Create a baseline linkName.
     std::string linkName = "(error setting name)";
@@ -892,7 +926,7 @@ void ThermFileParser::registerRad(TiXmlElement* radiation)
 /// @details  Populates heater link vectors with the strings stored in the tags
 ///           from the htr-file. The heater links count is then incremented.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerHtr(TiXmlElement* heater)
+void ThermFileParser::registerHtr(const TiXmlElement* heater)
 {
     /// - Get link's name attribute.
     std::string linkName = getName(heater, "heater");
@@ -939,7 +973,7 @@ void ThermFileParser::registerHtr(TiXmlElement* heater)
 /// @details  Populates panel link vectors with the strings stored in the tags
 ///           from the pan-file. The panel links count is then incremented.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerPan(TiXmlElement* panel)
+void ThermFileParser::registerPan(const TiXmlElement* panel)
 {
     /// - Get link's name attribute.
     std::string linkName = getName(panel, "panel");
@@ -982,7 +1016,7 @@ void ThermFileParser::registerPan(TiXmlElement* panel)
 /// @details  Populates potential link vectors with the strings stored in the tags
 ///           from the etc-file. The potential links count is then incremented.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerPot(TiXmlElement* potential)
+void ThermFileParser::registerPot(const TiXmlElement* potential)
 {
     /// Create a baseline linkName.
     std::string linkName = "(error setting name)";
@@ -1023,7 +1057,7 @@ void ThermFileParser::registerPot(TiXmlElement* potential)
 /// @details  Populates source link vectors with the strings stored in the tags
 ///           from the etc-file. The source links count is then incremented.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerSrc(TiXmlElement* source)
+void ThermFileParser::registerSrc(const TiXmlElement* source)
 {
     /// - Get link's name attribute.
     std::string linkName = getName(source, "source");
@@ -1078,7 +1112,7 @@ void ThermFileParser::registerSrc(TiXmlElement* source)
 ///
 /// @details  Edits data on the previously registered node.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerInput(TiXmlElement* node)
+void ThermFileParser::registerInput(const TiXmlElement* node)
 {
     /// - Get node's name attribute.
     std::string nodeName = getName(node, "node");
@@ -1110,7 +1144,7 @@ void ThermFileParser::registerInput(TiXmlElement* node)
 ///
 /// @details  Edits data on the previously registered radiation link object.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::registerInputRad(TiXmlElement* radiation)
+void ThermFileParser::registerInputRad(const TiXmlElement* radiation)
 {
     /// Create a baseline linkName.
     std::string linkName = "(error setting name)";
@@ -1164,7 +1198,7 @@ void ThermFileParser::registerInputRad(TiXmlElement* radiation)
 ///
 /// @details  Private method used to get the name attribute of a TinyXML element.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-const std::string ThermFileParser::getName(TiXmlElement* parent, const char* linkType)
+const std::string ThermFileParser::getName(const TiXmlElement* parent, const char* linkType)
 {
     /// Create a baseline linkName.
     std::string name = "(error setting name)";
@@ -1191,11 +1225,11 @@ const std::string ThermFileParser::getName(TiXmlElement* parent, const char* lin
 ///
 /// @details  Private method used to safely get the text from a tag in an XML element.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-const char* ThermFileParser::getText(TiXmlElement* parent, const char* tag,
+const char* ThermFileParser::getText(const TiXmlElement* parent, const char* tag,
         const bool raiseErrorIfNotFound)
 {
     /// - Instantiate an element pointer.
-    TiXmlElement* child = parent;
+    const TiXmlElement* child = parent;
 
     if (0 != tag)
     {
@@ -1228,10 +1262,10 @@ const char* ThermFileParser::getText(TiXmlElement* parent, const char* tag,
 ///
 /// @details  Private method used to return an element in an XML tree.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-TiXmlElement* ThermFileParser::getElement(TiXmlNode* parent, const char* tag,
+const TiXmlElement* ThermFileParser::getElement(const TiXmlNode* parent, const char* tag,
         const bool raiseErrorIfNotFound)
 {
-    TiXmlElement* child = parent->FirstChildElement(tag);
+    const TiXmlElement* child = parent->FirstChildElement(tag);
 
     /// - If desired, report error if element pointer returns null.
     TS_PTCS_IF_ERREX(0 == child && true == raiseErrorIfNotFound, TsParseException,
@@ -1245,16 +1279,46 @@ TiXmlElement* ThermFileParser::getElement(TiXmlNode* parent, const char* tag,
 ///
 /// @details  Private method used to count elements.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-int ThermFileParser::countElement(TiXmlNode* parent, const char* tag)
+int ThermFileParser::countElement(const TiXmlNode* parent, const char* tag)
 {
     int count = 0;
-    for(TiXmlNode* child = parent->FirstChild(tag); child; child = child->NextSiblingElement(tag))
+    for(const TiXmlNode* child = parent->FirstChild(tag); child; child = child->NextSiblingElement(tag))
     {
         count++;
     }
     return count;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  link  (--)  TiXmlElement pointer to a set of <node> or <conduction> config data
+///
+/// @throw    TsParseException if the material name is not a defined solid
+///
+/// @return   material (--)  the solid material type, or NO_SOLID if no material is given
+///
+/// @details  Private method used to get the optional solid material of a capacitance or
+///           conduction link from its <material> tag, by the name of the defined solid type.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SolidProperties::SolidType ThermFileParser::getMaterial(const TiXmlElement* link)
+{
+    /// - Get material text from XML if provided.
+    const char* material = getText(link, "material", false);
+
+    if (0 == material)
+    {
+        return SolidProperties::NO_SOLID;
+    }
+
+    const std::string name(material);
+    if ("STEEL_304" == name)
+    {
+        return SolidProperties::STEEL_304;
+    } else if ("ALUMINUM_6061" == name)
+    {
+        return SolidProperties::ALUMINUM_6061;
+    }
+    TS_PTCS_ERREX(TsParseException, "invalid material,", name);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  node  (--)  TiXmlElement pointer to a set of <node> config data
 ///
 /// @return   groupId (--)  integer identifying the capacitance-edit-group identifier
@@ -1262,7 +1326,7 @@ int ThermFileParser::countElement(TiXmlNode* parent, const char* tag)
 /// @details  Private method used to determine the index of a cap-edit-group name within the
 ///           vCapEditGroupList vector.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-int ThermFileParser::getCapEditGroupId(TiXmlElement* node)
+int ThermFileParser::getCapEditGroupId(const TiXmlElement* node)
 {
     /// - Get editGroup text from XML if provided.
     const char* editGroup = getText(node, "editGroup", false);
@@ -1296,13 +1360,13 @@ int ThermFileParser::getCapEditGroupId(TiXmlElement* node)
 void ThermFileParser::buildMultiPortVectors(
         std::vector<int>& vectorInt,
         std::vector<double>& vectorDouble,
-        TiXmlNode* parent,
+        const TiXmlNode* parent,
         const std::string& linkType,
         const std::string& name)
 {
     /// - Count the nodes and get the first one.
     const int numPorts = countElement(parent, "node");
-    TiXmlElement* node = getElement(parent, "node");
+    const TiXmlElement* node = getElement(parent, "node");
 
     /// - Loop through all <node> elements.
     while (0 != node)
@@ -1418,6 +1482,7 @@ void ThermFileParser::confirmNodeBuild()
         vCapNames.pop_back();
         vCapTemperatures.pop_back();
         vCapCapacitances.pop_back();
+        vCapMaterials.pop_back();
         numLinksCap--;
 
     } else
@@ -18,6 +18,9 @@ PURPOSE:
           - htr-file:  Heater links, <heater>
           - pan-file:  ThermalPanel links, <panel>
           - etc-file:  et.cetera; Other link types, namely <potential> and <source>
+    Capacitance and conduction links may give an optional <material> tag naming a defined solid
+    (e.g. STEEL_304), whose temperature-dependent specific heat or thermal conductivity then
+    scales the link's capacitance or conductivity.
     ThermalNetwork calls the ThermFileParser's initialize() method, which parses each file's
     specific XML tag structure, and stores the relevant data into its link-specific vectors.
     ThermalNetwork accesses these vectors and uses their data to construct a GUNNS network.)
@@ -35,7 +38,9 @@ PROGRAMMERS:
    ((Joe Valerioti) (L3) (Dec 2012)))
 @{
 ***************************************************************************************************/
+#include "parsing/XmlDocumentCache.hh"
 #include "parsing/tinyxml/tinyxml.hh"
+#include "properties/SolidProperties.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include <string>
 #include <vector>
@@ -47,6 +52,8 @@ PROGRAMMERS:
 ///           class. It is ThermalNetwork's tool for parsing the six different thermal XML
 ///           configuration files (node, cond, rad, htr, pan, etc). ThermalNetwork calls the
 ///           initialize() method, which stores the thermal data from these files into vectors.
+///           The files are first parsed in parallel into a document cache, which also keeps files
+///           from being parsed again when they are read for more than one tag or re-initialized.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class ThermFileParser
 {
@@ -90,6 +97,7 @@ class ThermFileParser
         std::vector<double>                vCapTemperatures;         /**< ** (K)                       vector of cap-link temperature values */
         std::vector<double>                vCapCapacitances;         /**< ** (J/K)                     vector of cap-link capacitance values */
         std::vector<int>                   vCapEditGroupIdentifiers; /**< ** (--)                      vector of cap-link edit group identifiers */
+        std::vector<int>                   vCapMaterials;            /**< ** (--)                      vector of cap-link solid material types */
 
         // Conduction Link attributes //////////////////////////////////////////////////////////////////////////////
         int                                numLinksCond;             /**<    (--)                      number of conduction links in the network */
@@ -97,6 +105,7 @@ class ThermFileParser
         std::vector<int>                   vCondPorts0;              /**< ** (--)                      vector of cond-link port0 nodes */
         std::vector<int>                   vCondPorts1;              /**< ** (--)                      vector of cond-link port1 nodes */
         std::vector<double>                vCondConductivities;      /**< ** (W/K)                     vector of cond-link conductivities */
+        std::vector<int>                   vCondMaterials;           /**< ** (--)                      vector of cond-link solid material types */
 
         // Radiation Link attributes ///////////////////////////////////////////////////////////////////////////////
         int                                numLinksRad;              /**<    (--)                      number of radiation links in the network */
@@ -137,6 +146,9 @@ class ThermFileParser
         std::vector< std::vector<int> >    vSrcPorts;                /**< ** (--)                      vector of src port number vectors */
         std::vector< std::vector<double> > vSrcFracs;                /**< ** (--)                      vector of src flux-application-fraction vectors */
 
+        // Parsed files /////////////////////////////////////////////////////////////////////////////
+        XmlDocumentCache                   mDocCache;                /**< ** (--)  trick_chkpnt_io(**) cache of parsed XML files */
+
         /// @brief  Parses the node xml file and counts the number of node elements in it.
         void preCountNodes();
         /// @brief  Parses thermal xml files and builds data vectors. Only ThermalNetwork may call this
@@ -162,9 +174,11 @@ class ThermFileParser
         void readThermInputFileRad();
 
         /// @brief  Private method used to generically ready any of the thermal XML files.
-        void readFile(std::string& xmlFile, const char* linkTag, void (ThermFileParser::*registerLink)(TiXmlElement*));
-        /// @brief  Private method used to validate file accessibility and set doc member.
-        void openFile(TiXmlDocument& doc, std::string& xmlFile);
+        void readFile(std::string& xmlFile, const char* linkTag, void (ThermFileParser::*registerLink)(const TiXmlElement*));
+        /// @brief  Private method used to validate file accessibility and get the cached document.
+        const TiXmlDocument* openFile(std::string& xmlFile);
+        /// @brief  Parses all of the configured files in parallel into the document cache.
+        void preloadFiles();
 
         /// @brief  Clears Node data vectors.
         void clearNode();
@@ -184,47 +198,49 @@ class ThermFileParser
         void clearSrc();
 
         /// @brief  Populates vector of cap-edit group names.
-        void registerCapEditGroups(TiXmlElement* capEditing);
+        void registerCapEditGroups(const TiXmlElement* capEditing);
         /// @brief  Counts the nodes.
-        void countNode(TiXmlElement* node);
+        void countNode(const TiXmlElement* node);
         /// @brief  Populates Node & Capacitance link data vectors.
-        void registerNode(TiXmlElement* node);
+        void registerNode(const TiXmlElement* node);
         /// @brief  Populates Conduction link data vectors.
-        void registerCond(TiXmlElement* conduction);
+        void registerCond(const TiXmlElement* conduction);
         /// @brief  Populates Radiation link data vectors.
-        void registerRad(TiXmlElement* radiation);
+        void registerRad(const TiXmlElement* radiation);
         /// @brief  Populates Heater link data vectors.
-        void registerHtr(TiXmlElement* heater);
+        void registerHtr(const TiXmlElement* heater);
         /// @brief  Populates Panel link data vectors.
-        void registerPan(TiXmlElement* panel);
+        void registerPan(const TiXmlElement* panel);
         /// @brief  Populates Potential link data vectors.
-        void registerPot(TiXmlElement* potential);
+        void registerPot(const TiXmlElement* potential);
         /// @brief  Populates Source link data vectors.
-        void registerSrc(TiXmlElement* source);
+        void registerSrc(const TiXmlElement* source);
 
         /// @brief  Populates Source link data vectors.
-        void registerInput(TiXmlElement* node);
+        void registerInput(const TiXmlElement* node);
         /// @brief  Populates Radiation link data vectors.
-        void registerInputRad(TiXmlElement* radiation);
+        void registerInputRad(const TiXmlElement* radiation);
 
         /// @brief  Private method used to get the name attribute of a TinyXML element.
-        const std::string getName(TiXmlElement* parent, const char* linkType);
+        const std::string getName(const TiXmlElement* parent, const char* linkType);
         /// @brief  Private method used to get and verify the text of TinyXML element.
-        const char* getText(TiXmlElement* parent, const char* tag,
+        const char* getText(const TiXmlElement* parent, const char* tag,
                 const bool raiseErrorIfNotFound = true);
         /// @brief  Private method used to check the existence of and return an element.
-        TiXmlElement* getElement(TiXmlNode* parent, const char* tag,
+        const TiXmlElement* getElement(const TiXmlNode* parent, const char* tag,
                 const bool raiseErrorIfNotFound = true);
         /// @brief  Private method used to count elements.
-        int countElement(TiXmlNode* parent, const char* tag);
+        int countElement(const TiXmlNode* parent, const char* tag);
         /// @brief  Get cap-edit group identifier based on editGroup name provided in XML.
-        int getCapEditGroupId(TiXmlElement* node);
+        int getCapEditGroupId(const TiXmlElement* node);
+        /// @brief  Get the solid material type based on the material name provided in XML.
+        SolidProperties::SolidType getMaterial(const TiXmlElement* link);
 
         /// @brief  Builds ports and fractions vectors for multi-port links.
         void buildMultiPortVectors(
                 std::vector<int>& vectorInt,
                 std::vector<double>& vectorDouble,
-                TiXmlNode* parent,
+                const TiXmlNode* parent,
                 const std::string& linkType,
                 const std::string& name);
 
@@ -141,6 +141,12 @@ ThermalNetwork::ThermalNetwork(const std::string& name)
     numCapEditGroups(0),
     mCapEditScaleFactor(0),
     mCapEditScalePrev(0),
+    mSolidProperties(),
+    mCapMaterialLookups(0),
+    mCondMaterialLookups(0),
+    mMaterialTolerance(1.0),
+    mMaterialUpdatePeriod(1),
+    mMaterialUpdateCounter(0),
     pNodes(0),
     indexSpaceNode(0),
     numLinksCap(0),
@@ -232,6 +238,10 @@ void ThermalNetwork::initNetwork()
     /// - Initialize the link objects at their ports with correct config/input data.
     buildLinks();
 
+    /// - Normalize the links' material lookups to their properties at the initial temperatures.
+    mMaterialUpdateCounter = 0;
+    updateMaterialProperties();
+
     /// - Initialize the island analyzer spotter.
     GunnsBasicIslandAnalyzerConfigData config(mName + ".netIslandAnalyzer");
     GunnsBasicIslandAnalyzerInputData input;
@@ -299,7 +309,7 @@ void ThermalNetwork::restart()
 /// @param[in]  timeStep  (s)  integration time step
 ///
 /// @details    Updates the pre-solution functions including heater power, capacitor group edits,
-///             and spotters.
+///             material properties and spotters.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermalNetwork::stepSpottersPre(const double timeStep)
 {
@@ -309,6 +319,12 @@ void ThermalNetwork::stepSpottersPre(const double timeStep)
     /// - Perform capacitor group edits.
     editCapacitanceGroups();
 
+    /// - Update link material properties every material update period.
+    if (++mMaterialUpdateCounter >= mMaterialUpdatePeriod) {
+        mMaterialUpdateCounter = 0;
+        updateMaterialProperties();
+    }
+
     /// - Call the island analyzer pre-solultion update.
     netIslandAnalyzer.stepPreSolver(timeStep);
 }
@@ -370,6 +386,10 @@ void ThermalNetwork::allocate()
         TS_NEW_CLASS_ARRAY_EXT(mCapacitanceLinks, numLinksCap, GunnsThermalCapacitor, (),
                                std::string(mName) + ".mCapacitanceLinks");
 
+        /// - Allocate material property lookups array.
+        TS_NEW_CLASS_ARRAY_EXT(mCapMaterialLookups, numLinksCap, GunnsThermalPropertyLookup, (),
+                               std::string(mName) + ".mCapMaterialLookups");
+
         /// - Allocate ConfigData pointer array.
         mCapacitanceConfigData = new GunnsThermalCapacitorConfigData*[numLinksCap];
 
@@ -414,6 +434,10 @@ void ThermalNetwork::allocate()
         TS_NEW_CLASS_ARRAY_EXT(mConductionLinks, numLinksCond, GunnsBasicConductor, (),
                                std::string(mName) + ".mConductionLinks");
 
+        /// - Allocate material property lookups array.
+        TS_NEW_CLASS_ARRAY_EXT(mCondMaterialLookups, numLinksCond, GunnsThermalPropertyLookup, (),
+                               std::string(mName) + ".mCondMaterialLookups");
+
         /// - Allocate ConfigData array.
         mConductionConfigData = new GunnsBasicConductorConfigData*[numLinksCond];
 
@@ -871,6 +895,12 @@ void ThermalNetwork::initializeCap(int i)
                                     netLinks,
                                     port0,
                                     port1);
+
+    /// - Initialize the link's specific heat lookup with its material, if any.
+    mCapMaterialLookups[i].initialize(
+            mSolidProperties.getProperties(
+                    static_cast<SolidProperties::SolidType>(parser.vCapMaterials.at(i))),
+            GunnsThermalPropertyLookup::SPECIFIC_HEAT, mMaterialTolerance);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  i  (--)  index of specific link within Conduction arrays
@@ -889,6 +919,12 @@ void ThermalNetwork::initializeCond(int i)
                                    netLinks,
                                    port0,
                                    port1);
+
+    /// - Initialize the link's thermal conductivity lookup with its material, if any.
+    mCondMaterialLookups[i].initialize(
+            mSolidProperties.getProperties(
+                    static_cast<SolidProperties::SolidType>(parser.vCondMaterials.at(i))),
+            GunnsThermalPropertyLookup::THERMAL_CONDUCTIVITY, mMaterialTolerance);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  i  (--)  index of specific link within Radiation arrays
@@ -1111,6 +1147,44 @@ void ThermalNetwork::applyCapacitanceGroups(int group, double ratio)
         }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  For each Capacitance and Conduction link with a temperature-dependent material, looks
+///           up its specific heat or thermal conductivity at its node temperature, and scales its
+///           capacitance or conductivity by the change.  Conduction links use the average of their
+///           two node temperatures.  The lookups only report a change when the temperature has
+///           moved by more than the material tolerance or into a different property table bin, so
+///           most links are left alone and don't cause the admittance matrix to be rebuilt.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermalNetwork::updateMaterialProperties()
+{
+    for (int i = 0; i < numLinksCap; ++i)
+    {
+        if (mCapMaterialLookups[i].isActive())
+        {
+            const double temperature = netNodeList.mNodes[mCapacitanceLinks[i].getNodeMap()[0]].getPotential();
+            if (mCapMaterialLookups[i].update(temperature))
+            {
+                mCapacitanceLinks[i].setCapacitance(mCapMaterialLookups[i].getRatio()
+                                                  * mCapacitanceLinks[i].getCapacitance());
+            }
+        }
+    }
+
+    for (int i = 0; i < numLinksCond; ++i)
+    {
+        if (mCondMaterialLookups[i].isActive())
+        {
+            const int* map           = mConductionLinks[i].getNodeMap();
+            const double temperature = 0.5 * (netNodeList.mNodes[map[0]].getPotential()
+                                            + netNodeList.mNodes[map[1]].getPotential());
+            if (mCondMaterialLookups[i].update(temperature))
+            {
+                mConductionLinks[i].setDefaultConductivity(mCondMaterialLookups[i].getRatio()
+                                                         * mConductionLinks[i].getDefaultConductivity());
+            }
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Deletes allocated arrays and config/input objects
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermalNetwork::cleanUp()
@@ -1199,6 +1273,7 @@ void ThermalNetwork::cleanUp()
     mConductionInputData = 0;
     delete[] mConductionConfigData;
     mConductionConfigData = 0;
+    TS_DELETE_ARRAY(mCondMaterialLookups);
     TS_DELETE_ARRAY(mConductionLinks);
 
     /// - Delete Capacitance links.
@@ -1215,6 +1290,7 @@ void ThermalNetwork::cleanUp()
     mCapacitanceInputData = 0;
     delete[] mCapacitanceConfigData;
     mCapacitanceConfigData = 0;
+    TS_DELETE_ARRAY(mCapMaterialLookups);
     TS_DELETE_ARRAY(mCapacitanceLinks);
 
     /// - Delete nodes pointer.
@@ -1247,6 +1323,21 @@ void ThermalNetwork::setMalfHtrMiswire(const bool flag, const int* index)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] tolerance (K)  Temperature change to re-evaluate link material properties.
+/// @param[in] period    (--) Number of major steps between material property checks.
+///
+/// @details  Sets the temperature tolerance and period for updating the links' material properties.
+///           A larger tolerance or period trades property fidelity for fewer admittance matrix
+///           rebuilds.  The tolerance takes effect at the next network initialization.  Periods
+///           less than 1 are limited to 1.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermalNetwork::setMaterialUpdate(const double tolerance, const int period)
+{
+    mMaterialTolerance    = tolerance;
+    mMaterialUpdatePeriod = std::max(1, period);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsParseException
 ///
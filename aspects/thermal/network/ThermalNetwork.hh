@@ -60,6 +60,7 @@ PROGRAMMERS:
 #include "aspects/thermal/GunnsThermalHeater.hh"
 #include "aspects/thermal/GunnsThermalPanel.hh"
 #include "aspects/thermal/GunnsThermalPotential.hh"
+#include "aspects/thermal/GunnsThermalPropertyLookup.hh"
 #include "aspects/thermal/GunnsThermalSource.hh"
 #include "core/GunnsBasicIslandAnalyzer.hh"
 #include "core/network/GunnsNetworkBase.hh"
@@ -135,6 +136,15 @@ class ThermalNetworkInputData
 ///           class can support any number of each link-type. ThermalNetwork initializes the links
 ///           with their Config/Input data and connects them to their respective nodes in the
 ///           GUNNS network.
+///
+///           Capacitance and Conduction links configured with a solid material have their
+///           capacitance and conductivity scaled by the material's temperature-dependent specific
+///           heat and thermal conductivity, relative to the property at the link's initial
+///           temperature, for which its configured value is assumed.  These are checked together
+///           every material update period, and each link only changes when its temperature has
+///           moved by more than the material tolerance or into a different bin of the material's
+///           property table, so the admittance matrix is rebuilt for batches of changes rather
+///           than every frame.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class ThermalNetwork : public GunnsNetworkBase
 {
@@ -197,6 +207,8 @@ class ThermalNetwork : public GunnsNetworkBase
         void setIslandMode(const Gunns::IslandMode mode);
         /// @brief Sets and resets the heater miswire malfunction.
         void setMalfHtrMiswire(const bool flag = false, const int* index = 0);
+        /// @brief Sets the temperature tolerance and period for updating material properties.
+        void setMaterialUpdate(const double tolerance, const int period = 1);
 
    protected:
         /// @details  The mHtrPowerElectrical array will be set by the simbus with values from EPS.
@@ -214,6 +226,15 @@ class ThermalNetwork : public GunnsNetworkBase
         double* mCapEditScaleFactor;         /**<    (--) trick_chkpnt_io(**) Capacitance edit scale factor control by edit group */
         double* mCapEditScalePrev;           /**<    (--) trick_chkpnt_io(**) Previous capacitance edit scale factor control      */
 
+        /// - Temperature-dependent material properties
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        DefinedSolidProperties      mSolidProperties;       /**< ** (--) trick_chkpnt_io(**) Defined solid material properties */
+        GunnsThermalPropertyLookup* mCapMaterialLookups;    /**<    (--) trick_chkpnt_io(**) Capacitance link specific heat lookups */
+        GunnsThermalPropertyLookup* mCondMaterialLookups;   /**<    (--) trick_chkpnt_io(**) Conduction link thermal conductivity lookups */
+        double  mMaterialTolerance;          /**<    (K)                      Temperature change to re-evaluate link material properties */
+        int     mMaterialUpdatePeriod;       /**<    (--)                     Number of major steps between material property checks */
+        int     mMaterialUpdateCounter;      /**<    (--) trick_chkpnt_io(**) Major steps since the last material property check */
+
         /// - GUNNS core network objects
         /////////////////////////////////////////////////////////////////////////////////////////////
         GunnsBasicNode* pNodes;              /**<    (--) trick_chkpnt_io(**) array of nodes for this network */
@@ -289,6 +310,8 @@ class ThermalNetwork : public GunnsNetworkBase
         void restartCapacitanceGroups();
         /// @brief  Applies link capacitance scales.
         void applyCapacitanceGroups(int group, double ratio);
+        /// @brief  Updates link capacitances and conductivities from their material properties.
+        void updateMaterialProperties();
         /// @brief  Deletes allocated arrays and config/input objects.
         void cleanUp();
 
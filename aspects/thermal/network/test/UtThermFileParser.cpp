@@ -337,19 +337,16 @@ void UtThermFileParser::testParseErrorHandling()
     /// - Default construct an un-initialized test article.
     FriendlyThermFileParser article;
 
-    /// - Create a dummy TiXmlDocument.
-    TiXmlDocument doc;
-
     std::string noFile = "no_file.net";
     std::string nonXmlFile = "main.cpp";
     std::string illFormedXml = "ThermNodes_illformed.xml";
 
     /// @test  Exception thrown on attempt to build links before nodes.
-    CPPUNIT_ASSERT_THROW_MESSAGE("file doesn't exist", article.openFile(doc, noFile), TsParseException);
+    CPPUNIT_ASSERT_THROW_MESSAGE("file doesn't exist", article.openFile(noFile), TsParseException);
     /// @test  Exception thrown on article given a random file that has no thermal link info.
-    CPPUNIT_ASSERT_THROW_MESSAGE("non-XML file",  article.openFile(doc, nonXmlFile), TsParseException);
+    CPPUNIT_ASSERT_THROW_MESSAGE("non-XML file",  article.openFile(nonXmlFile), TsParseException);
     /// @test  Exception thrown on article with ill-formed XML
-    CPPUNIT_ASSERT_THROW_MESSAGE("ill-formed XML", article.openFile(doc, illFormedXml), TsParseException);
+    CPPUNIT_ASSERT_THROW_MESSAGE("ill-formed XML", article.openFile(illFormedXml), TsParseException);
 
     /// @test  Exception thrown on article with invalid tags
     article.mNodeFile = "ThermNodes_nolist.xml";
@@ -373,6 +370,22 @@ void UtThermFileParser::testParseErrorHandling()
     ///        value should default to 0.0.
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, article.vCapCapacitances.at(0), tTol);
 
+    /// @test  Exception NOT thrown on article with an invalid <material> tag (just warning), and
+    ///        the node is skipped.
+    article.mNodeFile = "ThermNodes_badMaterial.xml";
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("invalid material", article.readNodeFile() );
+    CPPUNIT_ASSERT_EQUAL(ThermFileParser::NOT_FOUND, article.getMapLocation("STEEL_1"));
+
+    /// @test  Valid <material> tags are read.
+    article.mNodeFile = "ThermNodes_material.xml";
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("valid materials", article.readNodeFile() );
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(SolidProperties::STEEL_304),     article.vCapMaterials.at(0));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(SolidProperties::ALUMINUM_6061), article.vCapMaterials.at(2));
+    article.mCondFile = "ThermLinksCond_material.xml";
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("valid materials", article.readCondFile() );
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(SolidProperties::STEEL_304),     article.vCondMaterials.at(0));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(SolidProperties::NO_SOLID),      article.vCondMaterials.at(1));
+
     /// - Successfully read node-file first before executing remaining tests.
     article.mNodeFile = tNodeFile;
     article.readNodeFile();
@@ -442,6 +455,7 @@ void UtThermFileParser::testCap()
     CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Cap capacitance", tCapCapacitance, tArticle->vCapCapacitances.at(tCap), tTol);
     CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Cap temperature", tCapTemperature, tArticle->vCapTemperatures.at(tCap), tTol);
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Cap group id", tCapGroup, tArticle->vCapEditGroupIdentifiers.at(tCap) );
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cap material", static_cast<int>(SolidProperties::NO_SOLID), tArticle->vCapMaterials.at(tCap));
 
     std::cout << " Pass";
 }
@@ -461,6 +475,7 @@ void UtThermFileParser::testCond()
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Cond Port 0", tArticle->getMapLocation(tCondNode0), tArticle->vCondPorts0.at(tCond));
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Cond Port 1", tArticle->getMapLocation(tCondNode1), tArticle->vCondPorts1.at(tCond));
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Cond generic name", tCond2Name, tArticle->vCondNames.at(tCond2) );
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cond material", static_cast<int>(SolidProperties::NO_SOLID), tArticle->vCondMaterials.at(tCond));
 
     std::cout << " Pass";
 }
@@ -623,3 +638,39 @@ void UtThermFileParser::testThermInput()
 
     std::cout << " Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that config-files are parsed once, and re-used on re-initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermFileParser::testDocumentCache()
+{
+    std::cout << "\n ThermFileParser 13: Testing caching of parsed config-files.....";
+
+    /// @test  Each of the six config-files was parsed once, even though some are read for more than
+    ///        one tag.
+    CPPUNIT_ASSERT_EQUAL(6u, tArticle->mDocCache.getParseCount());
+    CPPUNIT_ASSERT(tArticle->mDocCache.getSkipCount() >= 6u);
+    const TiXmlDocument* nodeDoc = tArticle->mDocCache.find(tNodeFile);
+    CPPUNIT_ASSERT(0 != nodeDoc);
+    CPPUNIT_ASSERT(0 != tArticle->mDocCache.find(tEtcFile));
+
+    /// @test  Re-initialization doesn't parse the unchanged files again, and gives the same data.
+    const int numNodes    = tArticle->numNodes;
+    const int numLinksRad = tArticle->numLinksRad;
+    const int numLinksSrc = tArticle->numLinksSrc;
+    tArticle->initialize("article_nominal");
+    CPPUNIT_ASSERT_EQUAL(6u, tArticle->mDocCache.getParseCount());
+    CPPUNIT_ASSERT(nodeDoc == tArticle->mDocCache.find(tNodeFile));
+    CPPUNIT_ASSERT_EQUAL(numNodes,    tArticle->numNodes);
+    CPPUNIT_ASSERT_EQUAL(numLinksRad, tArticle->numLinksRad);
+    CPPUNIT_ASSERT_EQUAL(numLinksSrc, tArticle->numLinksSrc);
+    CPPUNIT_ASSERT_EQUAL(tNodeName, tArticle->vNodeNames.at(tNode));
+
+    /// @test  Adding the input file only parses the new file.
+    tArticle->mThermInputFile = tThermInputFile;
+    tArticle->initialize("article_nominal");
+    CPPUNIT_ASSERT_EQUAL(7u, tArticle->mDocCache.getParseCount());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(12.34, tArticle->vCapTemperatures.at(0), tTol);
+
+    std::cout << " Pass";
+}
@@ -1241,3 +1241,72 @@ void UtThermalNetwork::testSuperNetwork()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests scaling of links by their temperature-dependent material properties.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermalNetwork::testMaterialProperties()
+{
+    const char* test = "ThermalNetwork 14: Test material properties.......................";
+    std::cout << "\n " << test;
+    TEST_HS(test);
+
+    /// - Configure a network with steel and aluminum links.
+    FriendlyThermalNetwork article("material");
+    article.mConfig.cNodeFile = "ThermNodes_material.xml";
+    article.mConfig.cCondFile = "ThermLinksCond_material.xml";
+    article.setMaterialUpdate(10.0, 2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(10.0, article.mMaterialTolerance, 0.0);
+    CPPUNIT_ASSERT_EQUAL(2, article.mMaterialUpdatePeriod);
+
+    /// @test  Links keep their configured values at the initial temperatures, and their lookups are
+    ///        normalized to the material properties there.
+    article.initialize();
+    const SolidProperties* steel = article.mSolidProperties.getProperties(SolidProperties::STEEL_304);
+    CPPUNIT_ASSERT(article.mCapMaterialLookups[0].isActive());
+    CPPUNIT_ASSERT(article.mCapMaterialLookups[1].isActive());
+    CPPUNIT_ASSERT(!article.mCapMaterialLookups[2].isActive());
+    CPPUNIT_ASSERT(article.mCondMaterialLookups[0].isActive());
+    CPPUNIT_ASSERT(!article.mCondMaterialLookups[1].isActive());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1000.0, article.mCapacitanceLinks[0].getCapacitance(), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1000.0, article.mCapacitanceLinks[1].getCapacitance(), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(500.0,  article.mCapacitanceLinks[2].getCapacitance(), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, article.mConductionLinks[0].getDefaultConductivity(), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, article.mConductionLinks[1].getDefaultConductivity(), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, article.mCapMaterialLookups[0].getScale(),  0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, article.mCapMaterialLookups[1].getScale(),  0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, article.mCondMaterialLookups[0].getScale(), 0.0);
+
+    /// @test  Links are not rescaled within the tolerance, and only every update period.
+    const int node0 = article.mCapacitanceLinks[0].getNodeMap()[0];
+    article.netNodeList.mNodes[node0].setPotential(405.0);
+    article.stepSpottersPre(tTimeStep);
+    article.stepSpottersPre(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(400.0, article.mCapMaterialLookups[0].getTemperature(), 0.0);
+    article.netNodeList.mNodes[node0].setPotential(450.0);
+    article.stepSpottersPre(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(400.0, article.mCapMaterialLookups[0].getTemperature(), 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1000.0, article.mCapacitanceLinks[0].getCapacitance(), tTolerance);
+
+    /// @test  Links are rescaled beyond the tolerance on the update period.
+    article.stepSpottersPre(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(450.0, article.mCapMaterialLookups[0].getTemperature(), 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1000.0 * steel->getSpecificHeat(450.0)
+                                        / steel->getSpecificHeat(400.0),
+                                 article.mCapacitanceLinks[0].getCapacitance(), tTolerance);
+
+    /// @test  Material scaling composes with capacitance edit groups.
+    article.mCapacitanceLinks[0].setCapacitance(2.0 * article.mCapacitanceLinks[0].getCapacitance());
+    article.netNodeList.mNodes[node0].setPotential(500.0);
+    article.stepSpottersPre(tTimeStep);
+    article.stepSpottersPre(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2000.0 * steel->getSpecificHeat(500.0)
+                                        / steel->getSpecificHeat(400.0),
+                                 article.mCapacitanceLinks[0].getCapacitance(), tTolerance);
+
+    /// @test  Update periods less than 1 are limited to 1.
+    article.setMaterialUpdate(1.0, 0);
+    CPPUNIT_ASSERT_EQUAL(1, article.mMaterialUpdatePeriod);
+
+    std::cout << "... Pass";
+}
@@ -91,6 +91,8 @@ class UtThermalNetwork: public CppUnit::TestFixture
         void testCapacitanceEdit();
         /// @brief  Tests the network in a super-network.
         void testSuperNetwork();
+        /// @brief  Tests temperature-dependent material properties.
+        void testMaterialProperties();
 
     private:
         CPPUNIT_TEST_SUITE(UtThermalNetwork);
@@ -107,6 +109,7 @@ class UtThermalNetwork: public CppUnit::TestFixture
         CPPUNIT_TEST(testAccess);
         CPPUNIT_TEST(testCapacitanceEdit);
         CPPUNIT_TEST(testSuperNetwork);
+        CPPUNIT_TEST(testMaterialProperties);
         CPPUNIT_TEST_SUITE_END();
 
         FriendlyThermalNetwork*  tArticle; /**< (--)  pointer to test article */
@@ -0,0 +1,183 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    (
+        (aspects/thermal/GunnsThermalPropertyLookup.o)
+    )
+***************************************************************************************************/
+
+#include "UtGunnsThermalPropertyLookup.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsThermalPropertyLookup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalPropertyLookup::UtGunnsThermalPropertyLookup()
+    :
+    tSolids(),
+    tSteel(),
+    tThreshold(),
+    tArticle(),
+    tTolerance()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsThermalPropertyLookup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalPropertyLookup::~UtGunnsThermalPropertyLookup()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPropertyLookup::tearDown()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPropertyLookup::setUp()
+{
+    /// - Declare the nominal test data.
+    tSteel     = tSolids.getProperties(SolidProperties::STEEL_304);
+    tThreshold = 5.0;
+    tTolerance = 1.0e-8;
+
+    /// - Initialize the test article.
+    tArticle.initialize(tSteel, GunnsThermalPropertyLookup::SPECIFIC_HEAT, tThreshold);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPropertyLookup::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsThermalPropertyLookup 01: testDefaultConstruction ........";
+
+    /// - Check default values.
+    FriendlyGunnsThermalPropertyLookup article;
+    CPPUNIT_ASSERT(0 == article.mMaterial);
+    CPPUNIT_ASSERT(GunnsThermalPropertyLookup::SPECIFIC_HEAT == article.mProperty);
+    CPPUNIT_ASSERT(0.0 == article.mTolerance);
+    CPPUNIT_ASSERT(0.0 == article.mNominal);
+    CPPUNIT_ASSERT(!article.mEvaluated);
+    CPPUNIT_ASSERT(0.0 == article.mTemperature);
+    CPPUNIT_ASSERT(0   == article.mBin);
+    CPPUNIT_ASSERT(1.0 == article.getScale());
+    CPPUNIT_ASSERT(1.0 == article.getRatio());
+    CPPUNIT_ASSERT(!article.isActive());
+
+    /// - Check new/delete for code coverage.
+    GunnsThermalPropertyLookup* article2 = new GunnsThermalPropertyLookup();
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the initialize method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPropertyLookup::testInitialization()
+{
+    std::cout << "\n UtGunnsThermalPropertyLookup 02: testInitialization .............";
+
+    /// - Check nominal initialization of specific heat.
+    CPPUNIT_ASSERT(tSteel == tArticle.mMaterial);
+    CPPUNIT_ASSERT(GunnsThermalPropertyLookup::SPECIFIC_HEAT == tArticle.mProperty);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tThreshold, tArticle.mTolerance, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,        tArticle.mNominal,   0.0);
+    CPPUNIT_ASSERT(!tArticle.mEvaluated);
+    CPPUNIT_ASSERT(tArticle.isActive());
+
+    /// - Check initialization of thermal conductivity, and negative tolerance is limited to zero.
+    tArticle.update(400.0);
+    tArticle.initialize(tSteel, GunnsThermalPropertyLookup::THERMAL_CONDUCTIVITY, -1.0);
+    CPPUNIT_ASSERT(GunnsThermalPropertyLookup::THERMAL_CONDUCTIVITY == tArticle.mProperty);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle.mTolerance, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle.mNominal,   0.0);
+    CPPUNIT_ASSERT(!tArticle.mEvaluated);
+    CPPUNIT_ASSERT(1.0 == tArticle.getScale());
+    CPPUNIT_ASSERT(1.0 == tArticle.getRatio());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the update method re-evaluation, scale and ratio.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPropertyLookup::testUpdate()
+{
+    std::cout << "\n UtGunnsThermalPropertyLookup 03: testUpdate .....................";
+
+    /// - Check the first update normalizes to the property at its temperature, rather than the
+    ///   material's constant property, so the scale is unchanged.
+    const double nominal = tSteel->getSpecificHeat(250.0);
+    CPPUNIT_ASSERT(!tArticle.update(250.0));
+    double expectedScale = 1.0;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(nominal,       tArticle.mNominal,         0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedScale, tArticle.getScale(),       0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedScale, tArticle.getRatio(),       0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(250.0,         tArticle.getTemperature(), 0.0);
+    CPPUNIT_ASSERT(tArticle.mEvaluated);
+    CPPUNIT_ASSERT_EQUAL(tSteel->getTableBin(250.0), tArticle.mBin);
+
+    /// - Check the scale is held for changes within the tolerance in the same table bin.
+    CPPUNIT_ASSERT(!tArticle.update(250.0 + tThreshold));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedScale, tArticle.getScale(),       tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(250.0,         tArticle.getTemperature(), 0.0);
+
+    /// - Check re-evaluation for changes beyond the tolerance, and the ratio of successive scales.
+    double lastScale = expectedScale;
+    CPPUNIT_ASSERT(tArticle.update(260.0));
+    expectedScale = tSteel->getSpecificHeat(260.0) / nominal;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedScale,             tArticle.getScale(), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedScale / lastScale, tArticle.getRatio(), tTolerance);
+
+    /// - Check re-evaluation for changes within the tolerance that cross a table bin.
+    tArticle.update(198.0);
+    lastScale = tArticle.getScale();
+    CPPUNIT_ASSERT(tArticle.update(201.0));
+    expectedScale = tSteel->getSpecificHeat(201.0) / nominal;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedScale,             tArticle.getScale(), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedScale / lastScale, tArticle.getRatio(), tTolerance);
+
+    /// - Check no change is reported when the re-evaluated scale is unchanged, beyond the table.
+    tArticle.update(1300.0);
+    CPPUNIT_ASSERT(!tArticle.update(1400.0));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(640.0 / nominal, tArticle.getScale(),       tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1400.0,          tArticle.getTemperature(), 0.0);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the update method with no material or a constant-property material.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPropertyLookup::testInactive()
+{
+    std::cout << "\n UtGunnsThermalPropertyLookup 04: testInactive ...................";
+
+    /// - Check no material.
+    tArticle.initialize(0, GunnsThermalPropertyLookup::SPECIFIC_HEAT, tThreshold);
+    CPPUNIT_ASSERT(!tArticle.isActive());
+    CPPUNIT_ASSERT(!tArticle.update(500.0));
+    CPPUNIT_ASSERT(1.0 == tArticle.getScale());
+
+    /// - Check a material without temperature-dependent properties.
+    tArticle.initialize(tSolids.getProperties(SolidProperties::ALUMINUM_6061),
+                        GunnsThermalPropertyLookup::THERMAL_CONDUCTIVITY, tThreshold);
+    CPPUNIT_ASSERT(!tArticle.isActive());
+    CPPUNIT_ASSERT(!tArticle.update(500.0));
+    CPPUNIT_ASSERT(1.0 == tArticle.getScale());
+    CPPUNIT_ASSERT(!tArticle.mEvaluated);
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,95 @@
+#ifndef UTGUNNSTHERMALPROPERTYLOOKUP_EXISTS
+#define UTGUNNSTHERMALPROPERTYLOOKUP_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup    UT_GUNNS_THERMAL_PROPERTY_LOOKUP  Gunns Thermal Property Lookup Unit test
+/// @ingroup     UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details     Unit Tests for Gunns Thermal Property Lookup
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "aspects/thermal/GunnsThermalPropertyLookup.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalPropertyLookup and befriend UtGunnsThermalPropertyLookup
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalPropertyLookup : public GunnsThermalPropertyLookup
+{
+    public:
+        FriendlyGunnsThermalPropertyLookup();
+        virtual ~FriendlyGunnsThermalPropertyLookup();
+        friend class UtGunnsThermalPropertyLookup;
+};
+inline FriendlyGunnsThermalPropertyLookup::FriendlyGunnsThermalPropertyLookup()
+    : GunnsThermalPropertyLookup() {};
+inline FriendlyGunnsThermalPropertyLookup::~FriendlyGunnsThermalPropertyLookup() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Thermal Property Lookup unit tests.
+///
+/// @details  This class provides unit tests for the Thermal Property Lookup within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThermalPropertyLookup: public CppUnit::TestFixture
+{
+
+    public:
+        /// @brief    Default Constructor.
+        UtGunnsThermalPropertyLookup();
+
+        /// @brief    Default Destructor.
+        virtual ~UtGunnsThermalPropertyLookup();
+
+        /// @brief    Executes before each test.
+        void setUp();
+
+        /// @brief    Executes after each test.
+        void tearDown();
+
+        /// @brief    Tests Default Construction
+        void testDefaultConstruction();
+
+        /// @brief    Tests initialize method
+        void testInitialization();
+
+        /// @brief    Tests update method re-evaluation and ratio
+        void testUpdate();
+
+        /// @brief    Tests update method with inactive materials
+        void testInactive();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThermalPropertyLookup);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testUpdate);
+        CPPUNIT_TEST(testInactive);
+        CPPUNIT_TEST_SUITE_END();
+
+        DefinedSolidProperties             tSolids;     /**< (--) Defined solid properties */
+        const SolidProperties*             tSteel;      /**< (--) Steel 304 properties */
+        double                             tThreshold;  /**< (K)  Nominal temperature tolerance */
+        FriendlyGunnsThermalPropertyLookup tArticle;    /**< (--) Test Article */
+        double                             tTolerance;  /**< (--) Nominal tolerance for comparison
+                                                                  of expected and returned values */
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThermalPropertyLookup(const UtGunnsThermalPropertyLookup& that);
+
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThermalPropertyLookup& operator =(const UtGunnsThermalPropertyLookup& that);
+};
+
+/// @}
+
+#endif
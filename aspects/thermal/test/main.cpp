@@ -16,6 +16,7 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsThermalPanel.hh"
 #include "UtGunnsThermalMultiPanel.hh"
 #include "UtGunnsThermalPotential.hh"
+#include "UtGunnsThermalPropertyLookup.hh"
 #include "UtGunnsThermalSource.hh"
 #include "UtGunnsThermalPhaseChangeBattery.hh"
 #include "UtGunnsThermoelectricEffect.hh"
@@ -43,6 +44,7 @@ int main(int argc, char** argv)
     runner.addTest( UtGunnsThermalPhaseChangeBattery::suite() );
     runner.addTest( UtGunnsThermoelectricEffect::suite() );
     runner.addTest( UtGunnsThermoelectricDevice::suite() );
+    runner.addTest( UtGunnsThermalPropertyLookup::suite() );
     runner.run();
     return 0;
 }
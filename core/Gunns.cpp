@@ -22,12 +22,19 @@ LIBRARY DEPENDENCY:
     (core/GunnsBasicLink.o)
     (core/GunnsFluidNode.o)
     (core/GunnsFluidFlowOrchestrator.o)
+    (core/GunnsLinkProfiler.o)
     (core/GunnsMinorStepLog.o)
+    (core/GunnsPortReduction.o)
+    (math/MsMath.o)
     (math/linear_algebra/Sor.o)
     (math/linear_algebra/CholeskyLdu.o)
+    (simulation/timer/TsTimingService.o)
 #ifdef GUNNS_CUDA_ENABLE
     (math/linear_algebra/cuda/CudaDenseDecomp.o)
     (math/linear_algebra/cuda/CudaSparseSolve.o)
+#else
+    (math/linear_algebra/CpuDenseDecomp.o)
+    (math/linear_algebra/CpuSparseSolve.o)
 #endif
     (software/exceptions/TsInitializationException.o)
     (software/exceptions/TsOutOfBoundsException.o)
@@ -42,6 +49,7 @@ LIBRARY DEPENDENCY:
    )
 */
 
+#include <algorithm>
 #include <cmath>
 #include <cfloat>
 #include <cstdio>
@@ -51,8 +59,11 @@ LIBRARY DEPENDENCY:
 #include "core/GunnsFluidNode.hh"
 #include "core/GunnsInfraMacros.hh"
 #include "core/GunnsFluidFlowOrchestrator.hh"
+#include "core/GunnsPortReduction.hh"
+#include "math/MsMath.hh"
 #include "math/linear_algebra/Sor.hh"
 #include "math/linear_algebra/CholeskyLdu.hh"
+#include "simulation/timer/TsTimingService.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 #include "software/exceptions/TsNumericalException.hh"
@@ -60,8 +71,16 @@ LIBRARY DEPENDENCY:
 #ifdef GUNNS_CUDA_ENABLE
 #include "math/linear_algebra/cuda/CudaDenseDecomp.hh"
 #include "math/linear_algebra/cuda/CudaSparseSolve.hh"
+#else
+#include "math/linear_algebra/CpuDenseDecomp.hh"
+#include "math/linear_algebra/CpuSparseSolve.hh"
 #endif
 
+/// @details  Timing service regions of all Gunns objects' major steps and decompositions, for
+///           frame-overrun diagnostics.
+static const int GUNNS_STEP_TIMING      = TsTimingService::addRegion("Gunns::step");
+static const int GUNNS_DECOMPOSE_TIMING = TsTimingService::addRegion("Gunns::decompose");
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                 (--) Name of the Gunns object for fault messaging
 /// @param[in] convergenceTolerance (--) Error tolerance for minor step convergence
@@ -133,6 +152,9 @@ Gunns::Gunns()
     mMajorPotentialVector  (0),
     mSlavePotentialVector  (0),
     mNetCapDeltaPotential  (0),
+    mPortReductions        (),
+    mPortReductionPotential(0),
+    mPortReductionSource   (0),
     mIslandVectors         (),
     mNodeIslandNumbers     (0),
     mIslandCount           (0),
@@ -142,8 +164,10 @@ Gunns::Gunns()
     mSolverGpuDense        (0),
     mSolverGpuSparse       (0),
     mGpuEnabled            (false),
+    mGpuFallbackEnabled    (true),
     mGpuMode               (NO_GPU),
     mGpuSizeThreshold      (9999999),
+    mGpuNumThreads         (1),
     mConvergenceTolerance  (1.0),
     mNetworkSize           (0),
     mMinorStepLimit        (1),
@@ -189,12 +213,46 @@ Gunns::Gunns()
     mSorTolerance          (1.0E-12),
     mSorLastIteration      (-1),
     mSorFailCount          (0),
+    mAdaptiveStepping      (false),
+    mAdaptiveTolerance     (0.0),
+    mAdaptiveMaxSubSteps   (1),
+    mAdaptiveSubSteps      (1),
+    mAdaptiveLastSubSteps  (1),
+    mAdaptiveErrorRatio    (0.0),
+    mAdaptiveLastSubStep   (0.0),
+    mAdaptiveLastDelta     (0),
+    mAdaptiveInflux        (0),
+    mAdaptiveOutflux       (0),
+    mAdaptiveScheduledOutflux(0),
+    mEquilibrate           (false),
+    mConditionLimit        (0.0),
+    mEquilibrated          (false),
+    mEquilibrationScale    (0),
+    mEquilibrationSource   (0),
+    mConditionEstimate     (0.0),
+    mMaxConditionEstimate  (0.0),
+    mConditionPivotNode    (-1),
+    mConditionStiffNode    (-1),
+    mConditionWarned       (false),
+    mMixedPrecision        (false),
+    mMixedThreshold        (1),
+    mMixedMaxRefinements   (1),
+    mMixedDecomposed       (false),
+    mMixedBackwardError    (0.0),
+    mMixedLastRefinements  (0),
+    mMixedFallbackCount    (0),
+    mMixedLdu              (0),
+    mMixedLduIsland        (0),
+    mMixedSource           (0),
+    mMixedCorrection       (0),
+    mMixedResidual         (0),
     mLastSolverMode        (NORMAL),
     mLastIslandMode        (OFF),
     mLastRunMode           (RUN)
 {
 #ifdef GUNNS_CUDA_ENABLE
-    mGpuEnabled      = true;
+    mGpuEnabled         = true;
+    mGpuFallbackEnabled = false;
 #endif
 }
 
@@ -260,12 +318,25 @@ void Gunns::cleanup()
     TS_DELETE_ARRAY(mDebugSavedNode);
     TS_DELETE_ARRAY(mDebugSavedSlice);
     TS_DELETE_ARRAY(mNodeIslandNumbers);
+    TS_DELETE_ARRAY(mEquilibrationSource);
+    TS_DELETE_ARRAY(mEquilibrationScale);
+    TS_DELETE_ARRAY(mAdaptiveScheduledOutflux);
+    TS_DELETE_ARRAY(mAdaptiveOutflux);
+    TS_DELETE_ARRAY(mAdaptiveInflux);
+    TS_DELETE_ARRAY(mAdaptiveLastDelta);
+    TS_DELETE_ARRAY(mPortReductionSource);
+    TS_DELETE_ARRAY(mPortReductionPotential);
     TS_DELETE_ARRAY(mNetCapDeltaPotential);
     TS_DELETE_ARRAY(mSlavePotentialVector);
     TS_DELETE_ARRAY(mMajorPotentialVector);
     TS_DELETE_ARRAY(mMinorPotentialVector);
     TS_DELETE_ARRAY(mPotentialVector);
     TS_DELETE_ARRAY(mSourceVector);
+    TS_DELETE_ARRAY(mMixedResidual);
+    TS_DELETE_ARRAY(mMixedCorrection);
+    TS_DELETE_ARRAY(mMixedSource);
+    TS_DELETE_ARRAY(mMixedLduIsland);
+    TS_DELETE_ARRAY(mMixedLdu);
     {
         delete [] mPotentialVectorIsland;
         mPotentialVectorIsland = 0;
@@ -284,19 +355,93 @@ void Gunns::cleanup()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  mode       (--)  GpuMode enumeration value to take.
 /// @param[in]  threshold  (--)  Network/island size threshold value to take.
+/// @param[in]  numThreads (--)  Number of CPU fallback threads for GPU_DENSE, < 1 for all processors.
 ///
-/// @details  Rejects any GPU modes and outputs an H&S warning if the compilation is not GPU
-///           enabled.
+/// @details  Rejects any GPU modes and outputs an H&S warning if neither the GPU nor the CPU
+///           fallback solvers are enabled.  When the compilation is not GPU enabled, the GPU modes
+///           run on the CPU fallback solvers instead, and GPU_DENSE decomposes on the given number
+///           of threads.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void Gunns::setGpuOptions(const GpuMode mode, const int threshold)
+void Gunns::setGpuOptions(const GpuMode mode, const int threshold, const int numThreads)
 {
     mGpuSizeThreshold = threshold;
-    if (NO_GPU != mode and not mGpuEnabled) {
+    mGpuNumThreads    = numThreads;
+    if (NO_GPU != mode and not (mGpuEnabled or mGpuFallbackEnabled)) {
         mGpuMode = NO_GPU;
         GUNNS_WARNING("GPU mode rejected because the solver compilation is not GPU compatible.");
     } else {
         mGpuMode = mode;
     }
+#ifndef GUNNS_CUDA_ENABLE
+    if (mSolverGpuDense) {
+        static_cast<CpuDenseDecomp*>(mSolverGpuDense)->setNumThreads(mGpuNumThreads);
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  enable      (--)  Enables adaptive sub-stepping when true.
+/// @param[in]  tolerance   (--)  Allowed local error in node potentials per sub-step (> 0).
+/// @param[in]  maxSubSteps (--)  Maximum number of sub-steps per major step (>= 1).
+///
+/// @details  Sets the adaptive sub-stepping options.  Invalid values of tolerance or maximum
+///           sub-steps are rejected with an H&S warning and adaptive sub-stepping is disabled.
+///           Either way, the sub-step history is reset so that the next major step starts over
+///           with one sub-step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setAdaptiveStepOptions(const bool enable, const double tolerance, const int maxSubSteps)
+{
+    mAdaptiveSubSteps    = 1;
+    mAdaptiveLastSubStep = 0.0;
+    if (enable and (tolerance <= 0.0 or maxSubSteps < 1)) {
+        mAdaptiveStepping = false;
+        GUNNS_WARNING("adaptive sub-stepping rejected because of invalid tolerance or sub-step limit.");
+    } else {
+        mAdaptiveStepping    = enable;
+        mAdaptiveTolerance   = tolerance;
+        mAdaptiveMaxSubSteps = maxSubSteps;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  equilibrate    (--)  Equilibrates the admittance matrix before decomposition when true.
+/// @param[in]  conditionLimit (--)  Condition estimate above which to warn (> 1), or zero for none.
+///
+/// @details  Sets the admittance matrix equilibration and condition monitor options.  An invalid
+///           condition limit is rejected with an H&S warning and the condition warnings disabled.
+///           The equilibration option takes effect at the next decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setConditioningOptions(const bool equilibrate, const double conditionLimit)
+{
+    mEquilibrate     = equilibrate;
+    mConditionWarned = false;
+    if (conditionLimit != 0.0 and conditionLimit <= 1.0) {
+        mConditionLimit = 0.0;
+        GUNNS_WARNING("condition limit rejected because it is not greater than 1.");
+    } else {
+        mConditionLimit = conditionLimit;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  enable         (--)  Decomposes large networks in mixed precision when true.
+/// @param[in]  threshold      (--)  Network size at or above which to use mixed precision (> 0).
+/// @param[in]  maxRefinements (--)  Maximum refinements of each solution before falling back (> 0).
+///
+/// @details  Sets the mixed-precision decomposition options.  Invalid options are rejected with an
+///           H&S warning and mixed precision disabled.  Mixed precision is only used with the CPU
+///           solver, and takes effect at the next decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setMixedPrecisionOptions(const bool enable, const int threshold, const int maxRefinements)
+{
+    if (enable and (threshold < 1 or maxRefinements < 1)) {
+        mMixedPrecision = false;
+        GUNNS_WARNING("mixed precision rejected because of invalid size threshold or refinement limit.");
+    } else {
+        mMixedPrecision      = enable;
+        mMixedThreshold      = threshold;
+        mMixedMaxRefinements = maxRefinements;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -338,6 +483,9 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
 #ifdef GUNNS_CUDA_ENABLE
     mSolverGpuDense  = new CudaDenseDecomp();
     mSolverGpuSparse = new CudaSparseSolve();
+#else
+    mSolverGpuDense  = new CpuDenseDecomp(mGpuNumThreads);
+    mSolverGpuSparse = new CpuSparseSolve();
 #endif
 
     /// - Allocate system arrays based on network size.
@@ -352,6 +500,14 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
     TS_NEW_PRIM_ARRAY_EXT(mMajorPotentialVector, mNetworkSize,       double, configData.mName + ".mMajorPotentialVector");
     TS_NEW_PRIM_ARRAY_EXT(mSlavePotentialVector, mNetworkSize,       double, configData.mName + ".mSlavePotentialVector");
     TS_NEW_PRIM_ARRAY_EXT(mNetCapDeltaPotential, matrixSize,         double, configData.mName + ".mNetCapDeltaPotential");
+    TS_NEW_PRIM_ARRAY_EXT(mPortReductionPotential, mNetworkSize,     double, configData.mName + ".mPortReductionPotential");
+    TS_NEW_PRIM_ARRAY_EXT(mPortReductionSource,  mNetworkSize,       double, configData.mName + ".mPortReductionSource");
+    TS_NEW_PRIM_ARRAY_EXT(mAdaptiveLastDelta,    mNetworkSize,       double, configData.mName + ".mAdaptiveLastDelta");
+    TS_NEW_PRIM_ARRAY_EXT(mAdaptiveInflux,       mNetworkSize,       double, configData.mName + ".mAdaptiveInflux");
+    TS_NEW_PRIM_ARRAY_EXT(mAdaptiveOutflux,      mNetworkSize,       double, configData.mName + ".mAdaptiveOutflux");
+    TS_NEW_PRIM_ARRAY_EXT(mAdaptiveScheduledOutflux, mNetworkSize,   double, configData.mName + ".mAdaptiveScheduledOutflux");
+    TS_NEW_PRIM_ARRAY_EXT(mEquilibrationScale,   mNetworkSize,       double, configData.mName + ".mEquilibrationScale");
+    TS_NEW_PRIM_ARRAY_EXT(mEquilibrationSource,  mNetworkSize,       double, configData.mName + ".mEquilibrationSource");
     TS_NEW_PRIM_ARRAY_EXT(mNodeIslandNumbers,    mNetworkSize,       int,    configData.mName + ".mNodeIslandNumbers");
     TS_NEW_PRIM_ARRAY_EXT(mDebugSavedSlice,      mNetworkSize,       double, configData.mName + ".mDebugSavedSlice");
     TS_NEW_PRIM_ARRAY_EXT(mDebugSavedNode,      (mMinorStepLimit+1), double, configData.mName + ".mDebugSavedNode");
@@ -365,6 +521,14 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
         mMinorPotentialVector[i]  = 0.0;
         mMajorPotentialVector[i]  = 0.0;
         mSlavePotentialVector[i]  = 0.0;
+        mPortReductionPotential[i] = 0.0;
+        mPortReductionSource[i]   = 0.0;
+        mAdaptiveLastDelta[i]     = 0.0;
+        mAdaptiveInflux[i]        = 0.0;
+        mAdaptiveOutflux[i]       = 0.0;
+        mAdaptiveScheduledOutflux[i] = 0.0;
+        mEquilibrationScale[i]    = 1.0;
+        mEquilibrationSource[i]   = 0.0;
         mNodeIslandNumbers[i]     = i;
         mDebugSavedSlice[i]       = 0.0;
 
@@ -447,6 +611,7 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
     }
 
     verifyNodeInitialization();
+    mFlowOrchestrator->setLinkProfiler(&mLinkProfiler);
     mFlowOrchestrator->initialize(mName + ".mFlowOrchestrator", mLinks, mNodes);
 
     /// - Zero the potential and reset the state of the vacuum/ground boundary node.  This node is
@@ -465,8 +630,9 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
         mLinks[link]->processOutputs();
     }
 
-    /// - Initialize the minor step log.
+    /// - Initialize the minor step log and the link profiler.
     mStepLog.initialize(mName + ".mStepLog", mNetworkSize, mNumLinks, mLinks);
+    mLinkProfiler.initialize(mName + ".mLinkProfiler", mNumLinks, mLinks);
 
     /// - Perform functions common to initialization and restart.
     initializeRestartCommonFunctions();
@@ -645,6 +811,24 @@ void Gunns::setFlowOrchestrator(GunnsBasicFlowOrchestrator* orchestrator)
     mOwnsFlowOrchestrator = false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] reduction (--) Pointer to the port reduction object to add.
+///
+/// @details  Adds the given port reduction to the list to be computed after each converged major
+///           step.  Null pointers and repeated additions of the same object are ignored.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::addPortReduction(GunnsPortReduction* reduction)
+{
+    if (reduction) {
+        for (unsigned int i = 0; i < mPortReductions.size(); ++i) {
+            if (reduction == mPortReductions[i]) {
+                return;
+            }
+        }
+        mPortReductions.push_back(reduction);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsInitializationException
 ///
@@ -701,6 +885,24 @@ inline void Gunns::initializeRestartCommonFunctions()
     /// - Reset the worst-case timing mode flag.
     mWorstCaseTiming        = false;   
 
+    /// - Reset the adaptive sub-stepping history, so that it starts over with one sub-step.
+    mAdaptiveSubSteps       = 1;
+    mAdaptiveLastSubSteps   = 1;
+    mAdaptiveErrorRatio     = 0.0;
+    mAdaptiveLastSubStep    = 0.0;
+
+    /// - Reset the condition monitor.
+    mConditionEstimate      = 0.0;
+    mMaxConditionEstimate   = 0.0;
+    mConditionPivotNode     = -1;
+    mConditionStiffNode     = -1;
+    mConditionWarned        = false;
+
+    /// - Reset the mixed-precision history, so that it starts over with the next decomposition.
+    mMixedDecomposed        = false;
+    mMixedLastRefinements   = 0;
+    mMixedFallbackCount     = 0;
+
     /// - Reset last-pass mode stats.
     mLastSolverMode         = mSolverMode;
     mLastIslandMode         = mIslandMode;
@@ -727,6 +929,7 @@ inline void Gunns::initializeRestartCommonFunctions()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::step(const double timeStep)
 {
+    TS_TIMING_SCOPE(timingScope, GUNNS_STEP_TIMING);
     double startTime = CLOCK_TIME;
 
     /// - Check for proper initialization and run-time mode settings.
@@ -734,22 +937,30 @@ void Gunns::step(const double timeStep)
     if (PAUSE == mRunMode) return;
     ++mMajorStepCount;
     mStepLog.beginMajorStep();
+    mLinkProfiler.beginMajorStep();
 
     /// - Call the links to process special read data from the sim bus.
     for (int link = 0; link < mNumLinks; ++link) {
         mLinks[link]->processInputs();
     }
 
-    /// - Reset the fluxes into and out of the nodes so that they can properly integrate new flows
-    ///   this pass.
-    for (int node = 0; node < mNumNodes; ++node) {
-        mNodes[node]->resetFlows();
-    }
-
-    /// - Build & solve the system of equations.
+    /// - Build & solve the system of equations, over adaptive sub-steps in NORMAL mode if enabled.
+    ///   Otherwise reset the fluxes into and out of the nodes so that they can properly integrate
+    ///   new flows this pass.
+    const bool isAdaptive = mAdaptiveStepping and (NORMAL == mSolverMode);
     bool isConverged = false;
     try {
-        isConverged = iterateMinorSteps(timeStep);
+        if (isAdaptive) {
+            isConverged = iterateSubSteps(timeStep);
+        } else {
+            mAdaptiveSubSteps     = 1;
+            mAdaptiveLastSubSteps = 1;
+            mAdaptiveLastSubStep  = 0.0;
+            for (int node = 0; node < mNumNodes; ++node) {
+                mNodes[node]->resetFlows();
+            }
+            isConverged = iterateMinorSteps(timeStep);
+        }
     } catch (TsNumericalException& e) {
         mStepLog.recordStepResult(mLastDecomposition, GunnsMinorStepData::MATH_FAIL);
         mStepLog.endMajorStep();
@@ -764,9 +975,14 @@ void Gunns::step(const double timeStep)
     }
 
     if (isConverged) {
-        /// - Compute & transport flows.
-        mFlowOrchestrator->setVerbose(mVerbose);
-        mFlowOrchestrator->update(timeStep);
+        /// - Compute & transport flows.  Sub-stepping has already done this for each sub-step.
+        if (not isAdaptive) {
+            mFlowOrchestrator->setVerbose(mVerbose);
+            mFlowOrchestrator->update(timeStep);
+        }
+
+        /// - Compute the port reductions for partner networks before the links output them.
+        computePortReductions();
 
         /// - Once the nodes have been updated, call the links to process final outputs.
         for (int link = mNumLinks-1; link >= 0; --link) {
@@ -781,6 +997,9 @@ void Gunns::step(const double timeStep)
         overridePotential();
         outputPotentialVector();
         mStepLog.recordPotential(mPotentialVector);
+        for (unsigned int i = 0; i < mPortReductions.size(); ++i) {
+            mPortReductions[i]->invalidate();
+        }
         GUNNS_WARNING("failed to converge.");
     }
 
@@ -851,11 +1070,15 @@ bool Gunns::iterateMinorSteps(const double timeStep)
             for (int link = 0; link < mNumLinks; ++link) {
 
                 if (1 == mLastMinorStep) {
+                    const uint64_t start = mLinkProfiler.start();
                     mLinks[link]->step(timeStep);
+                    mLinkProfiler.stop(link, GunnsLinkProfiler::STEP, start);
                 }
 
                 else if(mLinks[link]->isNonLinear()) {
+                    const uint64_t start = mLinkProfiler.start();
                     mLinks[link]->minorStep(timeStep, mLastMinorStep);
+                    mLinkProfiler.stop(link, GunnsLinkProfiler::MINOR_STEP, start);
                 }
 
                 /// - Rebuild the system if any link declares it is changing the admittance matrix.
@@ -940,6 +1163,140 @@ bool Gunns::iterateMinorSteps(const double timeStep)
     return networkConverged;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  timeStep (s) The time step of the major frame
+///
+/// @return   bool (--) Returns true if the network converged on every sub-step, false otherwise
+///
+/// @throws   TsNumericalException
+///
+/// @details  This method divides the major step into the planned number of sub-steps.  Each
+///           sub-step iterates the minor steps to a converged solution and transports the flows
+///           over the sub-step, so node contents integrate at the sub-step size.  The local error of
+///           each sub-step is estimated from its node potential changes, and if it exceeds the
+///           tolerance the remaining sub-steps are shortened.  Sub-steps are not repeated, since
+///           their flows have already been integrated into the nodes.
+///
+///           Afterwards, basic node fluxes are replaced with their average over the sub-steps so the
+///           major step outputs are consistent with the whole time step.  The number of sub-steps
+///           for the next major step is planned from the last error estimate, and is allowed to
+///           shrink by up to half each major step, to avoid chattering on and off.
+///
+///           If a sub-step fails to converge, we stop there and return false.  The network state
+///           is left at the last converged sub-step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::iterateSubSteps(const double timeStep)
+{
+    /// - Reset the sub-step flux accumulators.
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mAdaptiveInflux[node]           = 0.0;
+        mAdaptiveOutflux[node]          = 0.0;
+        mAdaptiveScheduledOutflux[node] = 0.0;
+    }
+
+    int    subSteps    = std::min(mAdaptiveSubSteps, mAdaptiveMaxSubSteps);
+    double subStep     = timeStep / subSteps;
+    double elapsed     = 0.0;
+    double recommended = timeStep;
+    mAdaptiveLastSubSteps = 0;
+    mAdaptiveErrorRatio   = 0.0;
+    mFlowOrchestrator->setVerbose(mVerbose);
+
+    while (mAdaptiveLastSubSteps < subSteps) {
+        ++mAdaptiveLastSubSteps;
+
+        /// - Solve and transport flows over the sub-step.  The last sub-step takes up any round-off
+        ///   remaining in the major step.
+        if (mAdaptiveLastSubSteps == subSteps) {
+            subStep = timeStep - elapsed;
+        }
+        for (int node = 0; node < mNumNodes; ++node) {
+            mNodes[node]->resetFlows();
+        }
+        if (not iterateMinorSteps(subStep)) {
+            return false;
+        }
+        mFlowOrchestrator->update(subStep);
+        elapsed += subStep;
+
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mAdaptiveInflux[node]           += mNodes[node]->getInflux()           * subStep;
+            mAdaptiveOutflux[node]          += mNodes[node]->getOutflux()          * subStep;
+            mAdaptiveScheduledOutflux[node] += mNodes[node]->getScheduledOutflux() * subStep;
+        }
+
+        /// - Estimate the sub-step error, and the sub-step size that would meet the tolerance with a
+        ///   safety margin.  Backward Euler local error goes with the square of the step size.
+        const double ratio = estimateSubStepError(subStep) / mAdaptiveTolerance;
+        saveMajorPotentialVector();
+        mAdaptiveErrorRatio = std::max(mAdaptiveErrorRatio, ratio);
+        recommended = timeStep;
+        if (ratio > 0.0) {
+            recommended = std::min(timeStep, 0.9 * subStep / std::sqrt(ratio));
+        }
+
+        /// - Shorten the remaining sub-steps if this one exceeded the tolerance.
+        const double remaining = timeStep - elapsed;
+        if (ratio > 1.0 and remaining > 0.0) {
+            const int moreSubSteps = static_cast<int>(std::min(
+                    static_cast<double>(mAdaptiveMaxSubSteps - mAdaptiveLastSubSteps),
+                    std::ceil(remaining / recommended)));
+            if (moreSubSteps > subSteps - mAdaptiveLastSubSteps) {
+                subSteps = mAdaptiveLastSubSteps + moreSubSteps;
+                subStep  = remaining / moreSubSteps;
+            }
+        }
+    }
+
+    /// - Replace the basic node fluxes with their averages over the major step.  Fluid nodes have
+    ///   integrated their contents each sub-step and their fluxes can't be re-collected without
+    ///   fluid properties, so they keep the last sub-step.
+    for (int node = 0; node < mNetworkSize; ++node) {
+        if (0 == mNodes[node]->getContent()) {
+            mNodes[node]->resetFlows();
+            mNodes[node]->collectInflux  (mAdaptiveInflux[node]           / timeStep);
+            mNodes[node]->collectOutflux (mAdaptiveOutflux[node]          / timeStep);
+            mNodes[node]->scheduleOutflux(mAdaptiveScheduledOutflux[node] / timeStep);
+            mNodes[node]->integrateFlows(timeStep);
+        }
+    }
+
+    /// - Plan the sub-steps for the next major step.
+    const double planned = std::min(static_cast<double>(mAdaptiveMaxSubSteps),
+                                    std::ceil(timeStep / recommended));
+    mAdaptiveSubSteps = MsMath::limitRange(std::max(1, mAdaptiveLastSubSteps / 2),
+                                           static_cast<int>(planned), mAdaptiveMaxSubSteps);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  subStep (s) The duration of the sub-step just solved
+///
+/// @return   double (--) Largest estimated local error in node potential over the sub-step.
+///
+/// @details  The backward Euler solution is compared to a linear prediction from the previous
+///           sub-step's node potential changes.  The local truncation error of the solution is
+///           estimated as the fraction h / (h + h_prev) of their difference.  With no history, such
+///           as the first sub-step after init, restart or an option change, the error is zero.
+///           This is done for all nodes: nodes without capacitance follow the capacitive nodes they
+///           are connected to, so their changes carry the same error.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double Gunns::estimateSubStepError(const double subStep)
+{
+    double error = 0.0;
+    for (int node = 0; node < mNetworkSize; ++node) {
+        const double delta = mPotentialVector[node] - mMajorPotentialVector[node];
+        if (mAdaptiveLastSubStep > 0.0) {
+            const double predicted = mAdaptiveLastDelta[node] * subStep / mAdaptiveLastSubStep;
+            error = std::max(error, std::fabs(delta - predicted) * subStep
+                                    / (subStep + mAdaptiveLastSubStep));
+        }
+        mAdaptiveLastDelta[node] = delta;
+    }
+    mAdaptiveLastSubStep = subStep;
+    return error;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] minorStep (--) The absolute minor step # that the network is on
 /// @param[in] timeStep  (s)  Execution time step
@@ -993,42 +1350,21 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
                     result = 1;
                     mLastDecomposition++;
                     mDecompositionCount++;
-
-                    /// - Decompose admittance matrix by islands.  This builds a new sub-matrix for
-                    ///   each island, then copies the decomposed values back into the main
-                    ///   admittance matrix.
-                    if (SOLVE == mIslandMode) {
-                        /// - Loop over all islands, form a sub-matrix for each island and condition
-                        ///   it.  Only decompose islands that contain >1 nodes.
-                        for (int island = 0; island < mNetworkSize; ++island) {
-                            const int n = mIslandVectors[island].size();
-                            if ( (0 < n) and (GPU_SPARSE != mGpuMode) ) {
-                                /// - Form sub-matrix for island from the main matrix.
-                                for (int i=0, ij=0; i<n; ++i) {
-                                    const int in = mIslandVectors[island][i]*mNetworkSize;
-                                    for (int j=0; j<n; ++j, ++ij) {
-                                        mAdmittanceMatrixIsland[ij] =
-                                                mAdmittanceMatrix[in + mIslandVectors[island][j]];
-                                    }
-                                }
-                                if (1 < n) {
-                                    decompose(mAdmittanceMatrixIsland, n, island);
-                                }
-                                /// - Copy decomposed sub-matrix back into main matrix.
-                                for (int i=0, ij=0; i<n; ++i) {
-                                    const int in = mIslandVectors[island][i]*mNetworkSize;
-                                    for (int j=0; j<n; ++j, ++ij) {
-                                        mAdmittanceMatrix[in + mIslandVectors[island][j]] =
-                                                mAdmittanceMatrixIsland[ij];
-                                    }
-                                }
-                            }
+                    equilibrateAdmittanceMatrix();
+
+                    /// - Decompose in mixed precision for large networks when enabled, else or if
+                    ///   that fails, in double precision.
+                    mMixedDecomposed = false;
+                    if (mMixedPrecision and (NO_GPU == mGpuMode) and (mNetworkSize >= mMixedThreshold)) {
+                        mMixedDecomposed = decomposeMixedPrecision();
+                        if (not mMixedDecomposed) {
+                            mMixedFallbackCount++;
                         }
-
-                    /// - Decompose the full matrix without islands.
-                    } else {
-                        decompose(mAdmittanceMatrix, mNetworkSize);
                     }
+                    if (not mMixedDecomposed) {
+                        decomposeAdmittanceMatrix();
+                    }
+                    estimateCondition();
 
                     /// - Initial node network capacitance calculations immediately following the
                     ///   matrix decomposition.
@@ -1067,6 +1403,7 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::decompose(double *A, const int size, const int island)
 {
+    TS_TIMING_SCOPE(timingScope, GUNNS_DECOMPOSE_TIMING);
     double startTime = CLOCK_TIME;
     if ( (size >= mGpuSizeThreshold) and (GPU_DENSE == mGpuMode) ) {
         handleDecompose(mSolverGpuDense, A, size, island);
@@ -1085,6 +1422,353 @@ void Gunns::decompose(double *A, const int size, const int island)
     mSolveTimeWorking += CLOCK_TIME - startTime;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Decomposes the system admittance matrix in double precision, in place.  In island
+///           SOLVE mode, each island is decomposed separately, else the full matrix is.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeAdmittanceMatrix()
+{
+    /// - Decompose admittance matrix by islands.  This builds a new sub-matrix for
+    ///   each island, then copies the decomposed values back into the main
+    ///   admittance matrix.
+    if (SOLVE == mIslandMode) {
+        /// - Loop over all islands, form a sub-matrix for each island and condition
+        ///   it.  Only decompose islands that contain >1 nodes.
+        for (int island = 0; island < mNetworkSize; ++island) {
+            const int n = mIslandVectors[island].size();
+            if ( (0 < n) and (GPU_SPARSE != mGpuMode) ) {
+                /// - Form sub-matrix for island from the main matrix.
+                for (int i=0, ij=0; i<n; ++i) {
+                    const int in = mIslandVectors[island][i]*mNetworkSize;
+                    for (int j=0; j<n; ++j, ++ij) {
+                        mAdmittanceMatrixIsland[ij] =
+                                mAdmittanceMatrix[in + mIslandVectors[island][j]];
+                    }
+                }
+                if (1 < n) {
+                    decompose(mAdmittanceMatrixIsland, n, island);
+                }
+                /// - Copy decomposed sub-matrix back into main matrix.
+                for (int i=0, ij=0; i<n; ++i) {
+                    const int in = mIslandVectors[island][i]*mNetworkSize;
+                    for (int j=0; j<n; ++j, ++ij) {
+                        mAdmittanceMatrix[in + mIslandVectors[island][j]] =
+                                mAdmittanceMatrixIsland[ij];
+                    }
+                }
+            }
+        }
+
+    /// - Decompose the full matrix without islands.
+    } else {
+        decompose(mAdmittanceMatrix, mNetworkSize);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Allocates and zeroes the mixed-precision working arrays, if they haven't already been.
+///           These are only allocated when mixed precision is first used, since the single-precision
+///           matrices are as large as the admittance matrix.  They are deleted in cleanup.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::allocateMixedPrecision()
+{
+    if (not mMixedLdu) {
+        const int matrixSize = mNetworkSize * mNetworkSize;
+        TS_NEW_PRIM_ARRAY_EXT(mMixedLdu,        matrixSize,   float,  mName + ".mMixedLdu");
+        TS_NEW_PRIM_ARRAY_EXT(mMixedLduIsland,  matrixSize,   float,  mName + ".mMixedLduIsland");
+        TS_NEW_PRIM_ARRAY_EXT(mMixedSource,     mNetworkSize, float,  mName + ".mMixedSource");
+        TS_NEW_PRIM_ARRAY_EXT(mMixedCorrection, mNetworkSize, float,  mName + ".mMixedCorrection");
+        TS_NEW_PRIM_ARRAY_EXT(mMixedResidual,   mNetworkSize, double, mName + ".mMixedResidual");
+        for (int i = 0; i < matrixSize; ++i) {
+            mMixedLdu[i]       = 0.0F;
+            mMixedLduIsland[i] = 0.0F;
+        }
+        for (int i = 0; i < mNetworkSize; ++i) {
+            mMixedSource[i]     = 0.0F;
+            mMixedCorrection[i] = 0.0F;
+            mMixedResidual[i]   = 0.0;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the single-precision decomposition succeeded.
+///
+/// @details  Converts the system admittance matrix to single precision and decomposes it, by islands
+///           in island SOLVE mode, else the full matrix.  The single-precision decomposition moves
+///           half the memory of the double-precision one and its loops vectorize to twice the
+///           width, which dominates the solver's time for large networks.  The double-precision
+///           matrix is left undecomposed, for the residuals of the iterative refinement in
+///           solveMixedPrecision.
+///
+///           Returns false, for the caller to fall back to the double-precision decomposition,
+///           when the matrix has elements beyond the single-precision range or its single-precision
+///           decomposition fails.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::decomposeMixedPrecision()
+{
+    TS_TIMING_SCOPE(timingScope, GUNNS_DECOMPOSE_TIMING);
+    double startTime = CLOCK_TIME;
+
+    /// - Allocate the single-precision arrays on first use, so that networks not using mixed
+    ///   precision don't carry them.
+    allocateMixedPrecision();
+
+    /// - Convert the matrix to single precision.
+    double maxElement = 0.0;
+    const int matrixSize = mNetworkSize * mNetworkSize;
+    for (int index = 0; index < matrixSize; ++index) {
+        maxElement       = std::max(maxElement, fabs(mAdmittanceMatrix[index]));
+        mMixedLdu[index] = static_cast<float>(mAdmittanceMatrix[index]);
+    }
+
+    /// - Decompose by islands, the same as decomposeAdmittanceMatrix, or the full matrix.
+    bool success = (maxElement <= FLT_MAX);
+    if (success) {
+        try {
+            if (SOLVE == mIslandMode) {
+                for (int island = 0; island < mNetworkSize; ++island) {
+                    const int n = mIslandVectors[island].size();
+                    if (1 < n) {
+                        for (int i=0, ij=0; i<n; ++i) {
+                            const int in = mIslandVectors[island][i]*mNetworkSize;
+                            for (int j=0; j<n; ++j, ++ij) {
+                                mMixedLduIsland[ij] = mMixedLdu[in + mIslandVectors[island][j]];
+                            }
+                        }
+                        mSolverCpu->DecomposeSingle(mMixedLduIsland, n);
+                        for (int i=0, ij=0; i<n; ++i) {
+                            const int in = mIslandVectors[island][i]*mNetworkSize;
+                            for (int j=0; j<n; ++j, ++ij) {
+                                mMixedLdu[in + mIslandVectors[island][j]] = mMixedLduIsland[ij];
+                            }
+                        }
+                    }
+                }
+            } else {
+                mSolverCpu->DecomposeSingle(mMixedLdu, mNetworkSize);
+            }
+        } catch (TsNumericalException&) {
+            success = false;
+        }
+    }
+    mSolveTimeWorking += CLOCK_TIME - startTime;
+    return success;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the refinement converged.
+///
+/// @details  Solves [A]{x} = {b} for the potential vector {x} from the single-precision
+///           decomposition of [A], then iteratively refines it to double precision:
+///               {r} = {b} - [A]{x}, with the double-precision [A],
+///               solve [A]{d} = {r} from the single-precision decomposition,
+///               {x} = {x} + {d},
+///           until the componentwise backward error is within double-precision round-off:
+///               max(|r[i]| / (|A||x| + |b|)[i]) <= sqrt(n) DBL_EPSILON,
+///           as in the LAPACK DGERFS routine.  A componentwise test is used rather than a normwise
+///           one, since network potentials can span many orders of magnitude and a normwise test
+///           would leave the small ones at single-precision accuracy.  Each refinement costs one
+///           matrix-vector product and one single-precision solution, which is far less than a
+///           double-precision decomposition for large networks.  The refinement converges in a few
+///           iterations when the matrix condition is well within the inverse of the
+///           single-precision epsilon.  The residual is normalized before its conversion to single
+///           precision, so it doesn't underflow.
+///
+///           Returns false, for the caller to fall back to double precision, when the refinement
+///           doesn't converge within the refinement limit.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::solveMixedPrecision()
+{
+    const double tolerance = sqrt(static_cast<double>(mNetworkSize)) * DBL_EPSILON;
+
+    try {
+        /// - Initial solution from the single-precision decomposition.
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mMixedSource[node] = static_cast<float>(mSourceVector[node]);
+        }
+        mSolverCpu->SolveSingle(mMixedLdu, mMixedSource, mMixedCorrection, mNetworkSize);
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mPotentialVector[node] = mMixedCorrection[node];
+        }
+
+        for (int refinement = 0; ; ++refinement) {
+            /// - Double-precision residual of the current solution, and its componentwise backward
+            ///   error.  A row with a zero residual and denominator has no error.
+            double residualNorm = 0.0;
+            mMixedBackwardError = 0.0;
+            for (int row = 0, index = 0; row < mNetworkSize; ++row) {
+                double residual = mSourceVector[row];
+                double scale    = fabs(mSourceVector[row]);
+                for (int col = 0; col < mNetworkSize; ++col, ++index) {
+                    const double product = mAdmittanceMatrix[index] * mPotentialVector[col];
+                    residual -= product;
+                    scale    += fabs(product);
+                }
+                /// - These comparisons let a NaN through to fail the convergence test.
+                mMixedResidual[row] = residual;
+                if (not (fabs(residual) <= residualNorm)) {
+                    residualNorm = fabs(residual);
+                }
+                if (0.0 != residual and not (fabs(residual) / scale <= mMixedBackwardError)) {
+                    mMixedBackwardError = fabs(residual) / scale;
+                }
+            }
+            if (mMixedBackwardError <= tolerance) {
+                mMixedLastRefinements = refinement;
+                return true;
+            }
+            if (refinement >= mMixedMaxRefinements or not (residualNorm < FLT_MAX)) {
+                break;
+            }
+
+            /// - Correct the solution by the single-precision solution of the normalized residual.
+            for (int node = 0; node < mNetworkSize; ++node) {
+                mMixedSource[node] = static_cast<float>(mMixedResidual[node] / residualNorm);
+            }
+            mSolverCpu->SolveSingle(mMixedLdu, mMixedSource, mMixedCorrection, mNetworkSize);
+            for (int node = 0; node < mNetworkSize; ++node) {
+                mPotentialVector[node] += mMixedCorrection[node] * residualNorm;
+            }
+        }
+    } catch (TsNumericalException&) {
+        // fall through to failure
+    }
+    mMixedLastRefinements = mMixedMaxRefinements;
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  When equilibration is enabled, scales the admittance matrix [A] to S[A]S, where S is
+///           the diagonal matrix of 1/sqrt(A[i][i]), so the scaled matrix has a unit diagonal.
+///           This is the optimal diagonal scaling of a symmetric positive definite matrix to within
+///           a factor of the matrix size, and it removes the spread between ideal or very large
+///           admittances and tiny leak conductances from the decomposition's pivots.  The scaling
+///           preserves the matrix symmetry and the signs of its elements, so it doesn't change the
+///           decomposition's skipping of zero terms, nor the island structure.
+///
+///           Also records the node with the largest diagonal admittance for the condition monitor,
+///           since the scaling hides it from the decomposed matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::equilibrateAdmittanceMatrix()
+{
+    double maxDiagonal  = 0.0;
+    mConditionStiffNode = -1;
+    for (int node = 0; node < mNetworkSize; ++node) {
+        const double diagonal = mAdmittanceMatrix[node * mNetworkSize + node];
+        if (diagonal > maxDiagonal) {
+            maxDiagonal         = diagonal;
+            mConditionStiffNode = node;
+        }
+        if (mEquilibrate and diagonal > 0.0) {
+            mEquilibrationScale[node] = 1.0 / sqrt(diagonal);
+        } else {
+            mEquilibrationScale[node] = 1.0;
+        }
+    }
+
+    mEquilibrated = mEquilibrate;
+    if (mEquilibrated) {
+        for (int row = 0, index = 0; row < mNetworkSize; ++row) {
+            const double rowScale = mEquilibrationScale[row];
+            for (int col = 0; col < mNetworkSize; ++col, ++index) {
+                if (0.0 != mAdmittanceMatrix[index]) {
+                    mAdmittanceMatrix[index] *= rowScale * mEquilibrationScale[col];
+                }
+            }
+        }
+
+        /// - Set the scaled diagonal exactly to one, removing round-off.
+        for (int node = 0; node < mNetworkSize; ++node) {
+            double& diagonal = mAdmittanceMatrix[node * mNetworkSize + node];
+            if (diagonal > 0.0) {
+                diagonal = 1.0;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Estimates the condition number of the admittance matrix from the pivots (the diagonal
+///           D of the LDU decomposition), as the ratio of the largest to the smallest pivot.  This
+///           costs one pass over the diagonal, and is a lower bound on the true condition number
+///           that grows with it when a node's row is nearly dependent on the others, such as a
+///           node tied to a neighbor by an ideal admittance but only to the rest of the network by
+///           tiny conductances.
+///
+///           When the estimate exceeds the condition limit, a warning is issued naming the node
+///           with the smallest pivot and the node with the largest admittance, and the links with
+///           the largest admittance on each.  The warning is latched until the estimate drops back
+///           below the limit, so it isn't repeated every decomposition.  There is no decomposed
+///           matrix to estimate in GPU_SPARSE mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::estimateCondition()
+{
+    if (GPU_SPARSE == mGpuMode) {
+        return;
+    }
+
+    double minPivot = 0.0;
+    double maxPivot = 0.0;
+    mConditionPivotNode = -1;
+    for (int node = 0; node < mNetworkSize; ++node) {
+        const int    index = node * mNetworkSize + node;
+        const double pivot = mMixedDecomposed ? mMixedLdu[index] : mAdmittanceMatrix[index];
+        if (pivot > 0.0) {
+            if (mConditionPivotNode < 0 or pivot < minPivot) {
+                minPivot            = pivot;
+                mConditionPivotNode = node;
+            }
+            maxPivot = std::max(maxPivot, pivot);
+        }
+    }
+    mConditionEstimate    = (minPivot > 0.0) ? maxPivot / minPivot : 0.0;
+    mMaxConditionEstimate = std::max(mMaxConditionEstimate, mConditionEstimate);
+
+    if (mConditionLimit > 0.0) {
+        if (mConditionEstimate > mConditionLimit) {
+            if (not mConditionWarned) {
+                mConditionWarned = true;
+                GUNNS_WARNING("ill-conditioned admittance matrix, condition estimate "
+                              << mConditionEstimate << ": smallest pivot at node "
+                              << mConditionPivotNode << " (" << findStiffestLink(mConditionPivotNode)
+                              << "), largest admittance at node " << mConditionStiffNode << " ("
+                              << findStiffestLink(mConditionStiffNode) << ").");
+            }
+        } else {
+            mConditionWarned = false;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] node (--) The node of interest.
+///
+/// @returns  std::string (--) Name of the link, or "no links" if none.
+///
+/// @details  Returns the name of the link contributing the largest admittance to the given node's
+///           diagonal in the admittance matrix.  This is only called when issuing a warning, so its
+///           search of all links doesn't cost run-time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string Gunns::findStiffestLink(const int node) const
+{
+    std::string result    = "no links";
+    double      admittance = 0.0;
+    for (int link = 0; link < mNumLinks; ++link) {
+        const int numPorts = mLinkNumPorts[link];
+        for (int port = 0; port < numPorts; ++port) {
+            const double diagonal = mLinkAdmittanceMatrices[link][port * numPorts + port];
+            if (node == mLinkNodeMaps[link][port] and diagonal > admittance) {
+                admittance = diagonal;
+                result     = mLinks[link]->getName();
+            }
+        }
+    }
+    return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsInitializationException
 ///
@@ -1112,7 +1796,7 @@ void Gunns::checkStepInputs()
 
     /// - Prevent invalid GPU modes.
     if (NO_GPU != mGpuMode) {
-        if (not mGpuEnabled) {
+        if (not (mGpuEnabled or mGpuFallbackEnabled)) {
             mGpuMode = NO_GPU;
             GUNNS_WARNING("mGpuMode downmoded to NO_GPU because this solver isn't GPU enabled.");
         } else if (mGpuSizeThreshold > mNetworkSize) {
@@ -1366,6 +2050,16 @@ void Gunns::buildSourceVector()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::solveCholesky()
 {
+    /// - When the decomposition is of the equilibrated matrix S[A]S, solve S[A]S{y} = S{b} and
+    ///   then {x} = S{y}.  The source vector is restored exactly afterwards, since callers perturb
+    ///   and restore it between solutions.
+    if (mEquilibrated) {
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mEquilibrationSource[node] = mSourceVector[node];
+            mSourceVector[node]       *= mEquilibrationScale[node];
+        }
+    }
+
     /// - In GPU_SPARSE, the mSolverGpuSparse->decompose doesn't actually decompose [A], but is
     ///   only used to compress [A] into the format needed by the GPU sparse solver.  The sparse
     ///   solver mSolverGpuSparse->solve does the decomposition and solving on the GPU in one go,
@@ -1420,9 +2114,33 @@ void Gunns::solveCholesky()
             mSolveTimeWorking += CLOCK_TIME - startTime;
         }
     } else {
-        double startTime = CLOCK_TIME;
-        handleSolve(mSolverCpu, mAdmittanceMatrix, mSourceVector, mPotentialVector, mNetworkSize);
-        mSolveTimeWorking += CLOCK_TIME - startTime;
+        /// - Solve from the mixed-precision decomposition.  If its refinement doesn't converge,
+        ///   fall back to the double-precision decomposition of the same matrix, which is then
+        ///   re-used until the next decomposition.
+        if (mMixedDecomposed) {
+            double startTime = CLOCK_TIME;
+            const bool converged = solveMixedPrecision();
+            mSolveTimeWorking += CLOCK_TIME - startTime;
+            if (not converged) {
+                mMixedDecomposed = false;
+                mMixedFallbackCount++;
+                mDecompositionCount++;
+                mLastDecomposition++;
+                decomposeAdmittanceMatrix();
+            }
+        }
+        if (not mMixedDecomposed) {
+            double startTime = CLOCK_TIME;
+            handleSolve(mSolverCpu, mAdmittanceMatrix, mSourceVector, mPotentialVector, mNetworkSize);
+            mSolveTimeWorking += CLOCK_TIME - startTime;
+        }
+    }
+
+    if (mEquilibrated) {
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mSourceVector[node]     = mEquilibrationSource[node];
+            mPotentialVector[node] *= mEquilibrationScale[node];
+        }
     }
 }
 
@@ -1527,6 +2245,69 @@ void Gunns::perturbNetworkCapacitances()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Computes each registered port reduction from the converged solution.  For each port
+///           node, the system is solved for a source vector of a unit flux at that node and zero
+///           elsewhere, with one back-substitution of the recent matrix decomposition.  The solution
+///           is a column of the inverse admittance matrix, whose port node rows are one column of
+///           the port Thevenin impedance matrix.  The reductions are invalidated when the network isn't
+///           solved by matrix decomposition (SOR, DUMMY & SLAVE modes) or the GPU_SPARSE mode,
+///           which doesn't retain its decomposition, and when the major step was divided into
+///           adaptive sub-steps, since the decomposition reflects the capacitance admittance of the
+///           last sub-step rather than the major step.  The source and potential vectors are restored
+///           afterwards so the links see the actual solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::computePortReductions()
+{
+    if (mPortReductions.empty()) {
+        return;
+    }
+
+    if (NORMAL != mSolverMode or mSorActive or mAdaptiveLastSubSteps > 1 or GPU_SPARSE == mGpuMode) {
+        for (unsigned int i = 0; i < mPortReductions.size(); ++i) {
+            mPortReductions[i]->invalidate();
+        }
+        return;
+    }
+
+    /// - Save the actual solution and source vector, and clear the source vector for the unit flux
+    ///   solutions.
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mPortReductionPotential[node] = mPotentialVector[node];
+        mPortReductionSource[node]    = mSourceVector[node];
+        mSourceVector[node]           = 0.0;
+    }
+
+    for (unsigned int i = 0; i < mPortReductions.size(); ++i) {
+        GunnsPortReduction* reduction = mPortReductions[i];
+        bool onGround = false;
+        for (int port = 0; port < reduction->getNumPorts(); ++port) {
+            const int node = reduction->getNode(port);
+            if (node < 0 or node >= mNetworkSize) {
+                onGround = true;
+                break;
+            }
+            mSourceVector[node] = 1.0;
+            solveCholesky();
+            mSourceVector[node] = 0.0;
+            reduction->loadImpedanceColumn(port, mPotentialVector);
+        }
+        if (onGround) {
+            reduction->invalidate();
+        } else {
+            reduction->computeNorton(mPortReductionPotential);
+        }
+    }
+
+    /// - Restore the actual solution and source vector.
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mPotentialVector[node] = mPortReductionPotential[node];
+        mSourceVector[node]    = mPortReductionSource[node];
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  timeStep  (s)  Execution time step.
 ///
@@ -41,7 +41,16 @@ REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (Adaptive sub-stepping is only active in NORMAL solver mode.  Sub-steps are not rejected and
+   repeated: a sub-step whose error exceeds the tolerance shortens the remaining sub-steps of the
+   major step and the planned sub-steps of the next major step.)
+- (With adaptive sub-stepping, basic node fluxes are averaged over the sub-steps of the major step,
+   but fluid nodes and all link fluxes reflect the last sub-step.)
+- (The condition estimate is the ratio of the largest to smallest pivot of the decomposition.  It
+   is a cheap lower bound on the true condition number, and isn't available in GPU_SPARSE mode.)
+- (Without GUNNS_CUDA_ENABLE, the GPU modes run on the CPU fallback solvers: GPU_DENSE decomposes
+   on the number of threads given to setGpuOptions, default 1, and GPU_SPARSE reorders and solves
+   within the matrix envelope on the calling thread.)
 
 LIBRARY DEPENDENCY:
 - ((core/Gunns.o))
@@ -58,11 +67,13 @@ PROGRAMMERS:
 #include <vector>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "core/GunnsBasicLink.hh"
+#include "core/GunnsLinkProfiler.hh"
 #include "core/GunnsMinorStepLog.hh"
 
 /// - Forward declare classes used for pointer attributes and method arguments.
 class  GunnsBasicNode;
 class  GunnsBasicFlowOrchestrator;
+class  GunnsPortReduction;
 struct GunnsNodeList;
 class  PolyFluidConfigData;
 class  CholeskyLdu;
@@ -132,8 +143,8 @@ class Gunns
         /// @brief Enumeration of the valid GPU modes.
         enum GpuMode {
             NO_GPU     = 0,   ///< CPU only, doesn't use GPU at all.
-            GPU_DENSE  = 1,   ///< Uses GPU dense matrix math for decomposition.
-            GPU_SPARSE = 2    ///< Uses GPU sparse matrix math for decomposition & solution.
+            GPU_DENSE  = 1,   ///< Uses GPU dense matrix math for decomposition, or CPU threads.
+            GPU_SPARSE = 2    ///< Uses GPU sparse matrix math for decomposition & solution, or CPU.
         };
 
         /// @name     Step data logger.
@@ -142,6 +153,13 @@ class Gunns
         GunnsMinorStepLog mStepLog;  /**< (--) trick_chkpnt_io(**) Step data logger for debugging */
         /// @}
 
+        /// @name     Link profiler.
+        /// @{
+        /// @details  This is public to allow Trick jobs and the input file to directly enable it and
+        ///           call its report functions.
+        GunnsLinkProfiler mLinkProfiler; /**< (--) trick_chkpnt_io(**) Link cost profiler for performance analysis */
+        /// @}
+
         /// @brief Default constructs this Gunns object.
         Gunns();
 
@@ -176,8 +194,8 @@ class Gunns
         /// @brief Sets the solver Island mode to the given value.
         void setIslandMode(const Gunns::IslandMode mode);
 
-        /// @brief Sets the solver GPU mode and size threshold.
-        void setGpuOptions(const Gunns::GpuMode mode, const int threshold);
+        /// @brief Sets the solver GPU mode, size threshold and CPU fallback threads.
+        void setGpuOptions(const Gunns::GpuMode mode, const int threshold, const int numThreads = 1);
 
         /// @brief Sets the solver run mode to RUN.
         void setRunMode();
@@ -188,9 +206,21 @@ class Gunns
         /// @brief Sets the solver worst-case timing flag.
         void setWorstCaseTiming(const bool flag);
 
+        /// @brief Sets the adaptive sub-stepping options.
+        void setAdaptiveStepOptions(const bool enable, const double tolerance, const int maxSubSteps);
+
+        /// @brief Sets the admittance matrix equilibration and condition monitor options.
+        void setConditioningOptions(const bool equilibrate, const double conditionLimit);
+
+        /// @brief Sets the mixed-precision decomposition options.
+        void setMixedPrecisionOptions(const bool enable, const int threshold, const int maxRefinements);
+
         /// @brief Points the solver to use the given flow orchestrator.
         void setFlowOrchestrator(GunnsBasicFlowOrchestrator* orchestrator);
 
+        /// @brief Adds a port reduction to be computed from this network's solution.
+        void addPortReduction(GunnsPortReduction* reduction);
+
         /// @brief Sets the slave potential vector values to the given array values.
         void setSlavePotentialVector(const double* potentials);
 
@@ -230,9 +260,33 @@ class Gunns
         /// @brief Gets the most recent step time value.
         double getStepTime() const;
 
+        /// @brief Gets the number of sub-steps taken in the last major step.
+        int getAdaptiveSubSteps() const;
+
+        /// @brief Gets the largest sub-step error to tolerance ratio in the last major step.
+        double getAdaptiveErrorRatio() const;
+
+        /// @brief Gets the condition estimate of the last admittance matrix decomposition.
+        double getConditionEstimate() const;
+
+        /// @brief Gets the highest condition estimate since restart.
+        double getMaxConditionEstimate() const;
+
+        /// @brief Returns whether the current decomposition is in mixed precision.
+        bool isMixedDecomposed() const;
+
+        /// @brief Gets the number of refinements in the last mixed-precision solution.
+        int getMixedRefinements() const;
+
+        /// @brief Gets the number of fall-backs from mixed to double precision since restart.
+        int getMixedFallbackCount() const;
+
         /// @brief Returns whether GPU solving is enabled.
         bool isGpuEnabled() const;
 
+        /// @brief Returns whether the GPU modes run on the CPU fallback solvers.
+        bool isGpuFallbackEnabled() const;
+
         /// @brief Gets the number of links orchestrated by this solver.
         int getNumLinks() const;
 
@@ -285,6 +339,13 @@ class Gunns
         double* mSlavePotentialVector;    /**<    (--) trick_chkpnt_io(**) Input potential vector for SLAVE mode */
         double* mNetCapDeltaPotential;    /**<    (--) trick_chkpnt_io(**) Network capacitance delta-potential arrays for each node */
 
+        /// @details  Port reductions export this network's Norton equivalent at sets of interface
+        ///           nodes to partner networks.  They are registered by the interface links' owners
+        ///           and computed after each converged major step.
+        std::vector<GunnsPortReduction*> mPortReductions; /**< ** (--) trick_chkpnt_io(**) Port reductions computed from this network's solution */
+        double* mPortReductionPotential;  /**< ** (--) trick_chkpnt_io(**) Saved network solution during the port reduction solutions */
+        double* mPortReductionSource;     /**< ** (--) trick_chkpnt_io(**) Saved source vector during the port reduction solutions */
+
         // I will surely be yelled at for this...
         // don't bother checkpoint/restarting these because they're rebuilt every pass anyway
         // TV won't view vectors anyway unless we use TS_NEW_STL_OBJECT macro, but this probably
@@ -300,8 +361,10 @@ class Gunns
         CholeskyLdu* mSolverGpuDense;     /**< ** (--) trick_chkpnt_io(**) GPU-based dense matrix decomposition. */
         CholeskyLdu* mSolverGpuSparse;    /**< ** (--) trick_chkpnt_io(**) GPU-based sparse matrix decomposition and system solution. */
         bool         mGpuEnabled;         /**< *o (--) trick_chkpnt_io(**) True if GPU solvers are enabled. */
+        bool         mGpuFallbackEnabled; /**< *o (--) trick_chkpnt_io(**) True if the GPU modes run on the CPU fallback solvers. */
         GpuMode      mGpuMode;            /**<    (--) trick_chkpnt_io(**) GPU or CPU solution method being used. */
         int          mGpuSizeThreshold;   /**<    (--) trick_chkpnt_io(**) Only network islands at least this size are decomposed/solved on the GPU. */
+        int          mGpuNumThreads;      /**<    (--) trick_chkpnt_io(**) Number of threads for the CPU fallback of GPU_DENSE, < 1 for all processors. */
 
         /// @details  The tolerance for potential error for considering the network to be solved.
         ///           This is used in non-linear networks between minor steps.  The network is
@@ -416,6 +479,66 @@ class Gunns
         int     mSorFailCount;            /**<    (--)                     SOR number of convergence failures */
         /// @}
 
+        /// @name     Adaptive sub-stepping attributes.
+        /// @{
+        /// @details  When enabled, each major step is divided into sub-steps, with a full network
+        ///           solution and flow transport each sub-step.  The number of sub-steps is chosen
+        ///           from an estimate of the local truncation error in the node potentials, which
+        ///           is the difference between each sub-step solution and a linear prediction from
+        ///           the previous sub-step.
+        bool    mAdaptiveStepping;        /**<    (--)                     Adaptive sub-stepping is enabled */
+        double  mAdaptiveTolerance;       /**<    (--)                     Allowed local error in node potentials per sub-step */
+        int     mAdaptiveMaxSubSteps;     /**<    (--)                     Maximum number of sub-steps per major step */
+        int     mAdaptiveSubSteps;        /**<    (--) trick_chkpnt_io(**) Number of sub-steps planned for the next major step */
+        int     mAdaptiveLastSubSteps;    /**<    (--) trick_chkpnt_io(**) Number of sub-steps taken in the last major step */
+        double  mAdaptiveErrorRatio;      /**<    (--) trick_chkpnt_io(**) Largest sub-step error to tolerance ratio in the last major step */
+        double  mAdaptiveLastSubStep;     /**<    (s)  trick_chkpnt_io(**) Duration of the last sub-step, zero when there is no history */
+        double* mAdaptiveLastDelta;       /**< ** (--) trick_chkpnt_io(**) Node potential changes over the last sub-step */
+        double* mAdaptiveInflux;          /**< ** (--) trick_chkpnt_io(**) Node influx accumulated over the sub-steps */
+        double* mAdaptiveOutflux;         /**< ** (--) trick_chkpnt_io(**) Node outflux accumulated over the sub-steps */
+        double* mAdaptiveScheduledOutflux;/**< ** (--) trick_chkpnt_io(**) Node scheduled outflux accumulated over the sub-steps */
+        /// @}
+
+        /// @name     Matrix conditioning attributes.
+        /// @{
+        /// @details  When enabled, the admittance matrix is symmetrically scaled to a unit diagonal
+        ///           before decomposition, and the scaling is reversed on the solution.  This keeps
+        ///           ideal or very large admittances from swamping small ones in the decomposition.
+        ///           The condition monitor estimates the condition of each decomposition and warns
+        ///           of the nodes & links responsible when it exceeds the limit.
+        bool    mEquilibrate;             /**<    (--)                     Equilibrate the admittance matrix before decomposition */
+        double  mConditionLimit;          /**<    (--)                     Condition estimate above which to warn, or zero for no warnings */
+        bool    mEquilibrated;            /**< *o (--) trick_chkpnt_io(**) The current decomposition is of the equilibrated matrix */
+        double* mEquilibrationScale;      /**< ** (--) trick_chkpnt_io(**) Node scale factors of the current decomposition */
+        double* mEquilibrationSource;     /**< ** (--) trick_chkpnt_io(**) Saved unscaled source vector during the solution */
+        double  mConditionEstimate;       /**<    (--) trick_chkpnt_io(**) Condition estimate of the last decomposition */
+        double  mMaxConditionEstimate;    /**<    (--) trick_chkpnt_io(**) Highest condition estimate since restart */
+        int     mConditionPivotNode;      /**<    (--) trick_chkpnt_io(**) Node with the smallest pivot in the last decomposition */
+        int     mConditionStiffNode;      /**<    (--) trick_chkpnt_io(**) Node with the largest admittance in the last decomposition */
+        bool    mConditionWarned;         /**< *o (--) trick_chkpnt_io(**) The condition limit warning has been issued */
+        /// @}
+
+        /// @name     Mixed-precision attributes.
+        /// @{
+        /// @details  When enabled for large networks, the admittance matrix is decomposed in single
+        ///           precision, and each solution is iteratively refined to double precision against
+        ///           the double-precision matrix, which is left undecomposed for the residuals.  When
+        ///           the single-precision decomposition fails or the refinement doesn't converge, the
+        ///           solver falls back to the double-precision decomposition until the next one.
+        bool    mMixedPrecision;          /**<    (--)                     Decompose in mixed precision for large networks */
+        int     mMixedThreshold;          /**<    (--)                     Network size at or above which to use mixed precision */
+        int     mMixedMaxRefinements;     /**<    (--)                     Maximum refinements of each mixed-precision solution */
+        bool    mMixedDecomposed;         /**< *o (--) trick_chkpnt_io(**) The current decomposition is in mixed precision */
+        double  mMixedBackwardError;      /**<    (--) trick_chkpnt_io(**) Componentwise backward error of the last mixed-precision solution */
+        int     mMixedLastRefinements;    /**<    (--) trick_chkpnt_io(**) Number of refinements in the last mixed-precision solution */
+        int     mMixedFallbackCount;      /**<    (--) trick_chkpnt_io(**) Number of fall-backs to double precision since restart */
+        float*  mMixedLdu;                /**< ** (--) trick_chkpnt_io(**) Single-precision decomposed admittance matrix */
+        float*  mMixedLduIsland;          /**< ** (--) trick_chkpnt_io(**) Working array for islands single-precision decompositions */
+        float*  mMixedSource;             /**< ** (--) trick_chkpnt_io(**) Working single-precision source or residual vector */
+        float*  mMixedCorrection;         /**< ** (--) trick_chkpnt_io(**) Working single-precision solution or correction vector */
+        double* mMixedResidual;           /**< ** (--) trick_chkpnt_io(**) Working double-precision residual vector */
+        /// @}
+
         /// @name     Last-pass states.
         /// @{
         /// @details  Some last-pass values are saved for responding to state changes.
@@ -446,12 +569,30 @@ class Gunns
         /// @brief Decomposes an admittance matrix based on size and GPU options.
         void       decompose(double *A, const int size, const int island = -1);
 
+        /// @brief Decomposes the system admittance matrix in double precision, by islands if enabled.
+        void       decomposeAdmittanceMatrix();
+
+        /// @brief Allocates the mixed-precision working arrays on first use.
+        void       allocateMixedPrecision();
+
+        /// @brief Decomposes the system admittance matrix in single precision, by islands if enabled.
+        bool       decomposeMixedPrecision();
+
+        /// @brief Solves the system from the single-precision decomposition with iterative refinement.
+        bool       solveMixedPrecision();
+
         /// @brief Verifies network initialization and step method arguments.
         void       checkStepInputs();
 
         /// @brief Iterates through minor steps for network solution convergence.
         bool       iterateMinorSteps(const double timeStep);
 
+        /// @brief Solves and transports flows over adaptively sized sub-steps of the major step.
+        bool       iterateSubSteps(const double timeStep);
+
+        /// @brief Estimates the local error in node potentials over the last sub-step.
+        double     estimateSubStepError(const double subStep);
+
         /// @brief Builds and solves the system of equations.
         int        buildAndSolveSystem(const int minorStep, const double timeStep);
 
@@ -479,12 +620,24 @@ class Gunns
         /// @brief Updates the node network capacitances.
         void       computeNetworkCapacitances(const double timeStep);
 
+        /// @brief Computes the registered port reductions from the network solution.
+        void       computePortReductions();
+
         /// @brief Overrides the system potential vector.
         void       overridePotential();
 
         /// @brief Corrects some causes of an ill-conditioned admittance matrix.
         void       conditionAdmittanceMatrix();
 
+        /// @brief Scales the admittance matrix to a unit diagonal prior to decomposition.
+        void       equilibrateAdmittanceMatrix();
+
+        /// @brief Estimates the condition of the decomposed admittance matrix.
+        void       estimateCondition();
+
+        /// @brief Returns the name of the link with the largest admittance on the given node.
+        std::string findStiffestLink(const int node) const;
+
         /// @brief Outputs the potential solution to the network links.
         void       outputPotentialVector();
 
@@ -749,6 +902,77 @@ inline double Gunns::getStepTime() const
     return mStepTime;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of sub-steps taken in the last major step.
+///
+/// @details  Returns the mAdaptiveLastSubSteps value.  This is 1 when adaptive sub-stepping is not
+///           active.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getAdaptiveSubSteps() const
+{
+    return mAdaptiveLastSubSteps;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double (--) Largest sub-step error to tolerance ratio in the last major step.
+///
+/// @details  Returns the mAdaptiveErrorRatio value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Gunns::getAdaptiveErrorRatio() const
+{
+    return mAdaptiveErrorRatio;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double (--) Condition estimate of the last admittance matrix decomposition.
+///
+/// @details  Returns the mConditionEstimate value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Gunns::getConditionEstimate() const
+{
+    return mConditionEstimate;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double (--) Highest condition estimate since restart.
+///
+/// @details  Returns the mMaxConditionEstimate value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Gunns::getMaxConditionEstimate() const
+{
+    return mMaxConditionEstimate;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool (--) True if the current decomposition is in mixed precision.
+///
+/// @details  Returns the mMixedDecomposed value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool Gunns::isMixedDecomposed() const
+{
+    return mMixedDecomposed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of refinements in the last mixed-precision solution.
+///
+/// @details  Returns the mMixedLastRefinements value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getMixedRefinements() const
+{
+    return mMixedLastRefinements;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of fall-backs from mixed to double precision since restart.
+///
+/// @details  Returns the mMixedFallbackCount value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getMixedFallbackCount() const
+{
+    return mMixedFallbackCount;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   bool (--) True if GPU solving is enabled, false otherwise.
 ///
@@ -759,6 +983,17 @@ inline bool Gunns::isGpuEnabled() const
     return mGpuEnabled;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool (--) True if the GPU modes run on the CPU fallback solvers, false otherwise.
+///
+/// @details  Returns the value of the mGpuFallbackEnabled attribute.  This is true when the
+///           compilation is not GPU enabled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool Gunns::isGpuFallbackEnabled() const
+{
+    return mGpuFallbackEnabled;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return  int (--) The number of links orchestrated by this solver.
 ///
@@ -119,6 +119,9 @@ class GunnsBasicConductor : public GunnsBasicLink
         /// @brief Sets the default conductivity of the link
         void   setDefaultConductivity(const double conductivity);
 
+        /// @brief Returns the default conductivity of the link
+        double getDefaultConductivity() const;
+
         /// @brief Returns the effective conductivity of the link
         double getEffectiveConductivity() const;
 
@@ -165,6 +168,16 @@ inline void GunnsBasicConductor::setDefaultConductivity(const double conductivit
     mDefaultConductivity = conductivity;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double -- The default conductivity of the Link
+///
+/// @details  Returns the default conductivity of the link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsBasicConductor::getDefaultConductivity() const
+{
+    return mDefaultConductivity;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   double -- The effective conductivity of the Link
 ///
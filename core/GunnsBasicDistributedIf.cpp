@@ -0,0 +1,620 @@
+/**
+@file
+@brief    GUNNS Basic Distributed Interface Link implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (GunnsBasicCapacitor.o)
+    (GunnsBasicLink.o)
+   )
+*/
+
+#include "GunnsBasicDistributedIf.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "math/MsMath.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Basic Distributed Interface data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIfData::GunnsBasicDistributedIfData()
+    :
+    mFrameCount(0),
+    mFrameLoopback(0),
+    mDemandMode(false),
+    mCapacitance(0.0),
+    mSource(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Basic Distributed Interface data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIfData::~GunnsBasicDistributedIfData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  that  (--)  Object to be copied.
+///
+/// @details  Assigns values of this object's attributes to the given object's values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIfData& GunnsBasicDistributedIfData::operator =(const GunnsBasicDistributedIfData& that)
+{
+    if (this != &that) {
+        mFrameCount    = that.mFrameCount;
+        mFrameLoopback = that.mFrameLoopback;
+        mDemandMode    = that.mDemandMode;
+        mCapacitance   = that.mCapacitance;
+        mSource        = that.mSource;
+    }
+    return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  (--)  True if all data validation checks passed.
+///
+/// @details  Checks for all of the following conditions to be met:  Frame count > 0 and
+///           capacitance >= 0.  Unlike the fluid interface, the source term may be negative in
+///           either mode, since electrical potentials can be.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicDistributedIfData::hasValidData() const
+{
+    return (mFrameCount > 0 and mCapacitance >= 0.0);
+}
+
+/// @details  This value is chosen to get reliable network capacitance calculations from the solver
+///           for typical electrical and thermal nodes.
+const double GunnsBasicDistributedIf::mNetworkCapacitanceFlux = 1.0E-6;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name          (--)  Link name.
+/// @param[in] nodes         (--)  Network nodes array.
+/// @param[in] isPairMaster  (--)  This is the master of the pair.
+/// @param[in] demandOption  (--)  Demand mode option to trade stability for less restriction on flux.
+/// @param[in] capacitorLink (--)  Pointer to the node capacitor link.
+///
+/// @details  Default GUNNS Basic Distributed Interface Link Config Data Constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIfConfigData::GunnsBasicDistributedIfConfigData(
+        const std::string&   name,
+        GunnsNodeList*       nodes,
+        const bool           isPairMaster,
+        const bool           demandOption,
+        GunnsBasicCapacitor* capacitorLink)
+    :
+    GunnsBasicLinkConfigData(name, nodes),
+    mIsPairMaster(isPairMaster),
+    mDemandOption(demandOption),
+    mCapacitorLink(capacitorLink),
+    mModingCapacitanceRatio(1.25),
+    mDemandFilterConstA(1.5),
+    mDemandFilterConstB(0.75)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default GUNNS Basic Distributed Interface Link Config Data Destructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIfConfigData::~GunnsBasicDistributedIfConfigData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] malfBlockageFlag   (--)  Blockage malfunction flag.
+/// @param[in] malfBlockageValue  (--)  Blockage malfunction fractional value (0-1).
+/// @param[in] forceDemandMode    (--)  Forces the link to always be in Demand mode.
+/// @param[in] forceSupplyMode    (--)  Forces the link to always be in Supply mode.
+///
+/// @details  Default GUNNS Basic Distributed Interface Link Input Data Constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIfInputData::GunnsBasicDistributedIfInputData(
+        const bool   malfBlockageFlag,
+        const double malfBlockageValue,
+        const bool   forceDemandMode,
+        const bool   forceSupplyMode)
+    :
+    GunnsBasicLinkInputData(malfBlockageFlag, malfBlockageValue),
+    mForceDemandMode(forceDemandMode),
+    mForceSupplyMode(forceSupplyMode)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default GUNNS Basic Distributed Interface Link Input Data Destructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIfInputData::~GunnsBasicDistributedIfInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default GUNNS Basic Distributed Interface Link Constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIf::GunnsBasicDistributedIf()
+    :
+    GunnsBasicLink(NPORTS),
+    mInData                (),
+    mOutData               (),
+    mIsPairMaster          (false),
+    mDemandOption          (false),
+    mCapacitorLink         (0),
+    mModingCapacitanceRatio(0.0),
+    mDemandFilterConstA    (0.0),
+    mDemandFilterConstB    (0.0),
+    mForceDemandMode       (false),
+    mForceSupplyMode       (false),
+    mInDataLastDemandMode  (false),
+    mFramesSinceFlip       (0),
+    mSupplyCapacitance     (0.0),
+    mEffectiveConductivity (0.0),
+    mSourcePotential       (0.0),
+    mDemandFlux            (0.0),
+    mLoopLatency           (0),
+    mDemandFluxGain        (0.0),
+    mSuppliedCapacitance   (0.0),
+    mOtherIfs              ()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default GUNNS Basic Distributed Interface Link Destructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicDistributedIf::~GunnsBasicDistributedIf()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     configData   (--) Reference to link Config Data.
+/// @param[in]     inputData    (--) Reference to link Input Data.
+/// @param[in,out] networkLinks (--) Network links vector.
+/// @param[in]     port0        (--) Network port 0.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this Basic Distributed Interface link with configuration and input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::initialize(const GunnsBasicDistributedIfConfigData& configData,
+                                         const GunnsBasicDistributedIfInputData&  inputData,
+                                         std::vector<GunnsBasicLink*>&            networkLinks,
+                                         const int                                port0)
+{
+    /// - Initialize & validate parent.
+    int ports[1] = {port0};
+    GunnsBasicLink::initialize(configData, inputData, networkLinks, ports);
+
+    /// - Reset init flag
+    mInitFlag = false;
+
+    /// - Initialize from config data.
+    mIsPairMaster           = configData.mIsPairMaster;
+    mDemandOption           = configData.mDemandOption;
+    mCapacitorLink          = configData.mCapacitorLink;
+    mModingCapacitanceRatio = configData.mModingCapacitanceRatio;
+    mDemandFilterConstA     = configData.mDemandFilterConstA;
+    mDemandFilterConstB     = configData.mDemandFilterConstB;
+
+    /// - Initialize from input data.
+    mForceDemandMode = inputData.mForceDemandMode;
+    mForceSupplyMode = inputData.mForceSupplyMode;
+
+    /// - Both sides start out in Supply mode by default.
+    mOutData.mDemandMode = false;
+
+    /// - Initialize remaining state variables.
+    mSupplyCapacitance     = 0.0;
+    mEffectiveConductivity = 0.0;
+    mSourcePotential       = 0.0;
+    mDemandFlux            = 0.0;
+    mLoopLatency           = 0;
+    mDemandFluxGain        = 1.0;
+    mSuppliedCapacitance   = 0.0;
+
+    /// - Validate initialization.
+    validate();
+
+    /// - Set init flag on successful validation.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Validates this GUNNS Basic Distributed Interface initial state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::validate() const
+{
+    /// - Throw on null pointer to the node capacitor link.
+    if (not mCapacitorLink) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "Missing pointer to the node capacitor link.");
+    }
+
+    /// - Throw on invalid moding capacitance ratio range.
+    if (mModingCapacitanceRatio <= 1.0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "moding capacitance ratio <= 1.");
+    }
+
+    /// - Throw if conflicting mode force flags.
+    if (mForceDemandMode and mForceSupplyMode) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
+                    "both mode force flags are set.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  otherIf  (--)  Address of another GunnsBasicDistributedIf link to store.
+///
+/// @details  Pushes the given GunnsBasicDistributedIf link pointer onto the mOtherIfs vector.
+///           Duplicate objects, including this, are quietly ignored.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::addOtherIf(GunnsBasicDistributedIf* otherIf)
+{
+    bool duplicate = (otherIf == this);
+    for (unsigned int i=0; i<mOtherIfs.size(); ++i) {
+        if (otherIf == mOtherIfs[i]) {
+            duplicate = true;
+        }
+    }
+    if (not duplicate) {
+        mOtherIfs.push_back(otherIf);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Derived classes should call their base class implementation too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::restartModel()
+{
+    /// - Reset the base class.
+    GunnsBasicLink::restartModel();
+
+    /// - Reset non-config & non-checkpointed class attributes.
+    mEffectiveConductivity = 0.0;
+    mSourcePotential       = 0.0;
+    mDemandFlux            = 0.0;
+    mLoopLatency           = 0;
+    mDemandFluxGain        = 1.0;
+    mSuppliedCapacitance   = 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Pre-network step calculations.  Processes the incoming data from the external
+///           interface, flips modes and updates frame counters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::processInputs()
+{
+    /// - Mode changes and associated node capacitance update in response to incoming data.
+    flipModesOnInput();
+
+    /// - More processing of incoming data for resulting pairing mode.
+    processInputsDemand();
+    processInputsSupply();
+
+    /// - Update frame counters and loop latency measurement.
+    mOutData.mFrameCount   += 1;
+    mLoopLatency            = mOutData.mFrameCount - mInData.mFrameLoopback;
+    mOutData.mFrameLoopback = mInData.mFrameCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Processes inputs from the other side of the interface when in supply mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::processInputsSupply()
+{
+    /// - When we are Supply mode but have not yet received Demand data from the other side, we set
+    ///   the demand flux to zero.
+    /// - When in Demand mode, zero the demand flux.
+    /// - When in Supply mode, zero the source potential.
+    mDemandFlux = 0.0;
+    if (not mOutData.mDemandMode) {
+        mSourcePotential = 0.0;
+        if (mInData.hasValidData() and mInData.mDemandMode) {
+            /// - Flux into the demand node is flux out of our node.
+            mDemandFlux = -mInData.mSource;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Processes inputs from the other side of the interface when in demand mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::processInputsDemand()
+{
+    if (mOutData.mDemandMode) {
+        if (mInData.hasValidData() and not mInData.mDemandMode) {
+            mSourcePotential = mInData.mSource;
+        } else {
+            /// - When we are in Demand mode but have not yet received Supply data from the other
+            ///   side, we hold the node at its initial potential.
+            mSourcePotential = mNodes[0]->getPotential();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Handles mode flips in response to incoming data, and the initial mode flip at run
+///           start.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::flipModesOnInput()
+{
+    /// - Force mode swap based on the mode force flags.
+    if (mForceDemandMode and not mOutData.mDemandMode) {
+        flipToDemandMode();
+    } else if (mForceSupplyMode and mOutData.mDemandMode) {
+        flipToSupplyMode();
+    } else if (mInData.hasValidData()) {
+        /// - If in demand mode and the incoming data is also demand, then the other side has
+        ///   initialized the demand/supply swap, so we flip to supply.
+        if (mOutData.mDemandMode and mInData.mDemandMode and not mInDataLastDemandMode) {
+            flipToSupplyMode();
+        } else if (not mInData.mDemandMode and not mOutData.mDemandMode) {
+            if ( (mOutData.mCapacitance < mInData.mCapacitance) or
+                    (mIsPairMaster and mOutData.mCapacitance == mInData.mCapacitance) ) {
+                /// - If in supply mode and the incoming data is also supply, then this is the start
+                ///   of the run and the side with the smaller capacitance switches to demand mode,
+                ///   and the master side is the tie-breaker.
+                flipToDemandMode();
+            }
+        }
+        mInDataLastDemandMode = mInData.mDemandMode;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Flips from supply to demand mode whenever the supply network capacitance drops below
+///           some fraction of the demand side's capacitance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::flipModesOnCapacitance()
+{
+    /// - We do not check until we've been in supply mode for at least one full lag cycle.  This
+    ///   prevents unwanted extra mode flips during large transients.
+    if (mFramesSinceFlip > mLoopLatency and
+            mOutData.mCapacitance * mModingCapacitanceRatio < mInData.mCapacitance) {
+        flipToDemandMode();
+        /// - Zero the output potential/flux source term so the other side doesn't interpret our old
+        ///   potential value as a demand flux.  This will be set to a demand flux on the next full
+        ///   pass in demand mode.
+        mOutData.mSource = 0.0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Processes flipping to Demand mode.  Since in Demand mode the node must have no
+///           capacitance on its own, we zero it with the node's capacitor link's edit controls, and
+///           save the capacitance value for restoration later.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::flipToDemandMode()
+{
+    if (not mForceSupplyMode) {
+        mOutData.mDemandMode = true;
+        mSupplyCapacitance = mCapacitorLink->getCapacitance();
+        mCapacitorLink->editCapacitance(true, 0.0);
+        mFramesSinceFlip = 0;
+        GUNNS_INFO("switched to Demand mode.")
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Processes flipping to Supply mode.  Since in Demand mode the node's capacitance is
+///           zeroed, we restore the original capacitance when entering Supply mode via the node's
+///           capacitor link's edit controls.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::flipToSupplyMode()
+{
+    if (not mForceDemandMode) {
+        mOutData.mDemandMode = false;
+        mCapacitorLink->editCapacitance(true, mSupplyCapacitance);
+        mSupplyCapacitance = 0.0;
+        mFramesSinceFlip = 0;
+        GUNNS_INFO("switched to Supply mode.")
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  End-of-network calculations.  Sets outputs data based on our current mode.  Calls to
+///           check if its time to flip to Demand node from Supply mode based on relative
+///           capacitance, and updates the count of frames since the last mode flip.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::processOutputs()
+{
+    if (mOutData.mDemandMode) {
+        processOutputsDemand();
+    } else {
+        processOutputsSupply();
+        flipModesOnCapacitance();
+    }
+    mFramesSinceFlip++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  End-of-network calculation of outputs to the other side of the interface when this
+///           side is in Supply mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::processOutputsSupply()
+{
+    outputCapacitance();
+    mOutData.mSource = mNodes[0]->getPotential();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  End-of-network calculation of outputs to the other side of the interface when this
+///           side is in Demand mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::processOutputsDemand()
+{
+    outputCapacitance();
+    mOutData.mSource = mFlux;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Calculates and sets the outgoing capacitance value.  This is the network capacitance
+///           of the node, minus the effective capacitance added by this link in Demand mode (the
+///           mSuppliedCapacitance), and minus the effective capacitance at our node added by other
+///           links in Demand mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::outputCapacitance()
+{
+    /// - Subtract the capacitance we supply in Demand mode.
+    double capacitance = mNodes[0]->getNetworkCapacitance() - mSuppliedCapacitance;
+
+    /// - For each other interface link that we know about, calculate and subtract its effective
+    ///   capacitance at our node.  This is the capacitance that it supplied to its own node,
+    ///   reduced at our node by the conductances and capacitances in the network between the nodes,
+    ///   from the intermediate values output by the solver to the nodes in its network capacitance
+    ///   calculation.
+    for (unsigned int i=0; i<mOtherIfs.size(); ++i) {
+        const double otherSuppliedCap = mOtherIfs[i]->getSuppliedCapacitance();
+        if (otherSuppliedCap > DBL_EPSILON) {    // they are in Demand mode
+            const double* ourNetCapDp = getNetCapDeltaPotential();
+            const double  otherDp     = ourNetCapDp[mOtherIfs[i]->getNodeMap()[0]];
+            if (otherDp > DBL_EPSILON) {         // they affect us thru the conductive network
+                const double ourDp = ourNetCapDp[mNodeMap[0]];
+                const double ratio = otherDp / std::max(ourDp, DBL_EPSILON);
+                capacitance       -= (otherSuppliedCap * ratio);
+            }
+        }
+    }
+
+    /// - Limit the outgoing capacitance to positive values, just in case something goes wrong
+    ///   in our calculation.
+    mOutData.mCapacitance = std::max(0.0, capacitance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Integration time step.
+///
+/// @details  Calculates this link's contributions to the network system of equations.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::step(const double dt)
+{
+    /// - In Demand mode, conductance mirrors the Supply network capacitance: G = C/dt.  In Supply
+    ///   mode, zero conductance blocks the Demand mode potential source effect.
+    if (mOutData.mDemandMode and dt > DBL_EPSILON) {
+        /// - Comparison to FLT_EPSILON avoids chatter caused by mSuppliedCapacitance not exactly
+        ///   equaling network capacitance.
+        if (mOutData.mCapacitance > FLT_EPSILON and mInData.mCapacitance > FLT_EPSILON) {
+            /// - In Demand mode, update demand flux gain as a function of Cs/Cd.  For Cs/Cd < 1,
+            ///   lower gain based on latency.  For > 1, approach gain of 1.
+            const double csOverCd  = MsMath::limitRange(1.0, mInData.mCapacitance / mOutData.mCapacitance, mModingCapacitanceRatio);
+            const int    exponent  = MsMath::limitRange(1, mLoopLatency, 100);
+            const double gainLimit = std::min(1.0, mDemandFilterConstA * powf(mDemandFilterConstB, exponent));
+            mDemandFluxGain = gainLimit + (1.0 - gainLimit) * (csOverCd - 1.0) * 4.0;
+            const double conductance = mDemandFluxGain * mInData.mCapacitance / dt;
+            /// - See GunnsFluidDistributedIf for the trade made by this option.
+            if (mDemandOption) {
+                mEffectiveConductivity = conductance;
+            } else {
+                mEffectiveConductivity = 1.0 / std::max(1.0/conductance + dt/mOutData.mCapacitance, DBL_EPSILON);
+            }
+        } else {
+            mDemandFluxGain = 1.0;
+            mEffectiveConductivity = mDemandFluxGain * mInData.mCapacitance / dt;
+        }
+        /// - Reduce the effective conductance from the blockage malfunction.
+        if (mMalfBlockageFlag) {
+            mEffectiveConductivity *= (1.0 - mMalfBlockageValue);
+        }
+    } else {
+        mEffectiveConductivity = 0.0;
+    }
+
+    /// - Build admittance matrix.
+    const double systemConductance = MsMath::limitRange(0.0, mEffectiveConductivity, mConductanceLimit);
+    if (fabs(mAdmittanceMatrix[0] - systemConductance) > 0.0) {
+        mAdmittanceMatrix[0] = systemConductance;
+        mAdmittanceUpdate    = true;
+    }
+
+    if (mOutData.mDemandMode) {
+        mSuppliedCapacitance = mAdmittanceMatrix[0] * dt;
+    } else {
+        mSuppliedCapacitance = 0.0;
+    }
+
+    /// - Build source vector, including the potential source effect in Demand mode, and the flux
+    ///   source effect to the demand side in Supply mode.
+    mSourceVector[0] = mSourcePotential * mAdmittanceMatrix[0] + mDemandFlux;
+
+    /// - Flag the node to have its network capacitance calculated by the solver.
+    mNodes[0]->setNetworkCapacitanceRequest(mNetworkCapacitanceFlux);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Integration time step (not used).
+///
+/// @details  Computes the flux across the link and the power added to the node, sets port flow
+///           directions, schedules outflux from the node and transports the flux to the node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::computeFlows(const double dt __attribute__((unused)))
+{
+    mPotentialDrop = -mPotentialVector[0];
+    computeFlux();
+    mPower = mFlux * mPotentialVector[0];
+
+    /// - Set port flow directions and schedule flow from source nodes.
+    if (mFlux > DBL_EPSILON) {
+        mPortDirections[0] = SINK;
+    } else if (mFlux < -DBL_EPSILON) {
+        if (mOutData.mDemandMode) {
+            mPortDirections[0] = SOURCE;
+            mNodes[0]->scheduleOutflux(-mFlux);
+        } else {
+            mPortDirections[0] = SINK;
+        }
+    } else {
+        mPortDirections[0] = NONE;
+    }
+    transportFlux();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] fromPort (--) Not used, this link only has port 0.
+/// @param[in] toPort   (--) Not used, this link only has port 0.
+///
+/// @details  Transports the flux to or from the node, as the other side of the interface is
+///           outside of this network.  This is only called from computeFlows, so the flux is only
+///           collected once per pass.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicDistributedIf::transportFlux(const int fromPort __attribute__((unused)),
+                                            const int toPort   __attribute__((unused)))
+{
+    if (mFlux > 0.0) {
+        mNodes[0]->collectInflux(mFlux);
+    } else if (mFlux < 0.0) {
+        mNodes[0]->collectOutflux(-mFlux);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] port (--) The port to be assigned.
+/// @param[in] node (--) The desired node to assign the port to.
+///
+/// @returns  bool  (--) Returns true if all rules checks pass
+///
+/// @details  Checks the requested port & node arguments for validity against rules that apply to
+///           this specific class.  These are:
+///           - A GunnsBasicDistributedIf must not map port 0 to the network ground node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicDistributedIf::checkSpecificPortRules(const int port, const int node) const
+{
+    bool result = true;
+
+    /// - Fail if port 0 is the ground node.
+    if ((0 == port) && (node == getGroundNodeIndex())) {
+        GUNNS_WARNING("aborted setting a port: cannot assign port 0 to the boundary node.");
+        result = false;
+    }
+    return result;
+}
@@ -0,0 +1,282 @@
+#ifndef GunnsBasicDistributedIf_EXISTS
+#define GunnsBasicDistributedIf_EXISTS
+
+/**
+@file
+@brief    GUNNS Basic Distributed Interface Link declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_BASIC_DISTRIBUTED_IF    GUNNS Basic Distributed Interface Link
+@ingroup   TSM_GUNNS_CORE_LINK_BASIC
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Classes for the GUNNS Basic Distributed Interface link, for electrical and thermal networks.)
+
+REFERENCE:
+- ("Distributed Fluid Simulation Interface Standard", J.Harvey, Draft, June 2019)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The potential, capacitance and flux units are the same on both sides of the interface.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsBasicDistributedIf.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "GunnsBasicLink.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Basic Distributed Interface Data
+///
+/// @details  This class provides a data structure for the data shared between a pair of Basic
+///           Distributed Interface links that allows flux between separate basic networks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBasicDistributedIfData
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsBasicDistributedIfData);
+    public:
+        unsigned int mFrameCount;    /**< (--) Frame count driven by this side. */
+        unsigned int mFrameLoopback; /**< (--) Frame count driven by other side, echoed back. */
+        bool         mDemandMode;    /**< (--) Demand mode flag. */
+        double       mCapacitance;   /**< (--) Network capacitance. */
+        double       mSource;        /**< (--) Node potential in Supply mode or flux in Demand mode. */
+        /// @brief  Default constructs this Basic Distributed Interface interface data.
+        GunnsBasicDistributedIfData();
+        /// @brief  Default destructs this Basic Distributed Interface interface data.
+        virtual ~GunnsBasicDistributedIfData();
+        /// @brief  Returns whether this object has received valid data.
+        bool hasValidData() const;
+        /// @brief Assignment operator for this Basic Distributed Interface interface data.
+        GunnsBasicDistributedIfData& operator =(const GunnsBasicDistributedIfData& that);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsBasicDistributedIfData(const GunnsBasicDistributedIfData&);
+};
+
+// Forward declarations for pointer types
+class GunnsBasicCapacitor;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Basic Distributed Interface Configuration Data
+///
+/// @details  This class provides a data structure for the Basic Distributed Interface link
+///           configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBasicDistributedIfConfigData : public GunnsBasicLinkConfigData
+{
+    public:
+        bool                 mIsPairMaster;           /**< (--) trick_chkpnt_io(**) This is the master of the pair. */
+        bool                 mDemandOption;           /**< (--) trick_chkpnt_io(**) Demand mode option to trade stability for less restriction on flux. */
+        GunnsBasicCapacitor* mCapacitorLink;          /**< (--) trick_chkpnt_io(**) Pointer to the node capacitor link. */
+        double               mModingCapacitanceRatio; /**< (--) trick_chkpnt_io(**) Supply over Demand capacitance ratio for triggering mode flip. */
+        double               mDemandFilterConstA;     /**< (--) trick_chkpnt_io(**) Demand filter gain constant A. */
+        double               mDemandFilterConstB;     /**< (--) trick_chkpnt_io(**) Demand filter gain constant B. */
+        /// @brief Default constructs this Basic Distributed Interface configuration data.
+        GunnsBasicDistributedIfConfigData(
+                const std::string&   name           = "",
+                GunnsNodeList*       nodes          = 0,
+                const bool           isPairMaster   = false,
+                const bool           demandOption   = false,
+                GunnsBasicCapacitor* capacitorLink  = 0);
+        /// @brief Default destructs this Basic Distributed Interface configuration data.
+        virtual ~GunnsBasicDistributedIfConfigData();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsBasicDistributedIfConfigData(const GunnsBasicDistributedIfConfigData&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsBasicDistributedIfConfigData& operator =(const GunnsBasicDistributedIfConfigData&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Basic Distributed Interface Input Data
+///
+/// @details  This class provides a data structure for the Basic Distributed Interface link input
+///           data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBasicDistributedIfInputData : public GunnsBasicLinkInputData
+{
+    public:
+        bool mForceDemandMode; /**< (--) trick_chkpnt_io(**) Forces the link to always be in Demand mode. */
+        bool mForceSupplyMode; /**< (--) trick_chkpnt_io(**) Forces the link to always be in Supply mode. */
+        /// @brief Default constructs this Basic Distributed Interface input data.
+        GunnsBasicDistributedIfInputData(const bool   malfBlockageFlag  = false,
+                                         const double malfBlockageValue = 0.0,
+                                         const bool   forceDemandMode   = false,
+                                         const bool   forceSupplyMode   = false);
+        /// @brief Default destructs this Basic Distributed Interface input data.
+        virtual ~GunnsBasicDistributedIfInputData();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsBasicDistributedIfInputData(const GunnsBasicDistributedIfInputData&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsBasicDistributedIfInputData& operator =(const GunnsBasicDistributedIfInputData&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Basic Distributed Interface class
+///
+/// @details  This is the basic network (electrical, thermal) counterpart of
+///           GunnsFluidDistributedIf, and works the same way minus the fluid mixture.  Two of these,
+///           in separate networks, interface with each other.  One link in the pair takes the
+///           Demand role and the other Supply.  The links swap these roles automatically to keep the
+///           Supply role on the side with the higher network capacitance.  This promotes stability
+///           in high-latency, tightly coupled interfaces.
+///
+///           In Supply mode, this link applies the flux demanded by the other side as a flux source
+///           to the node, and outputs the node potential.  In Demand mode, this link applies the
+///           potential supplied by the other side through a conductance that mirrors the supply
+///           network capacitance (G = C/dt), filtered for loop latency, and outputs the resulting
+///           flux.
+///
+///           Because the Demand effect cannot be applied to a node with capacitance, this link
+///           edits the node's attached capacitor link to zero capacitance when entering Demand mode,
+///           and restores its capacitance when returning to Supply mode.  The nodes in both networks
+///           should default to the same capacitance.
+///
+///           The conserved quantity (charge, thermal energy) is not conserved when the Supply/Demand
+///           sides flip.  The error is proportional to the loop data lag and the flux through the
+///           path during the flip.
+///
+///           This is a one-port link and we do away with the assumed Ground node.  In both Supply
+///           and Demand roles, this link treats positive flux direction as flux into the node.  So a
+///           negative flux out of the supply node will match a positive flux value into the demand
+///           node.
+///
+///           These links need to know about other similar links in the same network to avoid
+///           interfering with each other's network capacitance.  Use the addOtherIf method to
+///           register links with each other.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBasicDistributedIf : public GunnsBasicLink
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsBasicDistributedIf);
+    public:
+        GunnsBasicDistributedIfData mInData;  /**< (--) Data from the other paired link input from the interface. */
+        GunnsBasicDistributedIfData mOutData; /**< (--) Data to the other paired link output to the interface. */
+        /// @brief Default Constructor.
+        GunnsBasicDistributedIf();
+        /// @brief Default Destructor.
+        virtual ~GunnsBasicDistributedIf();
+        /// @brief Initializes the link, with input data.
+        void initialize(const GunnsBasicDistributedIfConfigData& configData,
+                        const GunnsBasicDistributedIfInputData&  inputData,
+                        std::vector<GunnsBasicLink*>&            networkLinks,
+                        const int                                port0);
+        /// @brief Step method for updating the link.
+        virtual void step(const double dt);
+        /// @brief Method for computing the flows across the link.
+        virtual void computeFlows(const double dt);
+        /// @brief Special processing of data inputs to the model prior to the network update.
+        virtual void processInputs();
+        /// @brief Special processing of data outputs from the model after the network update.
+        virtual void processOutputs();
+        /// @brief Registers another GunnsBasicDistributedIf link with this one.
+        void addOtherIf(GunnsBasicDistributedIf* otherIf);
+        /// @brief Returns the capacitance this link adds to the node in Demand mode.
+        double getSuppliedCapacitance() const;
+        /// @brief Returns the node's network capacitance delta-potentials array.
+        const double* getNetCapDeltaPotential() const;
+
+    protected:
+        bool                        mIsPairMaster;           /**<    (--) trick_chkpnt_io(**) This is the master of the link pair. */
+        bool                        mDemandOption;           /**<    (--) trick_chkpnt_io(**) Demand mode option to trade stability for less restriction on flux. */
+        GunnsBasicCapacitor*        mCapacitorLink;          /**< ** (--) trick_chkpnt_io(**) Pointer to the node capacitor link. */
+        double                      mModingCapacitanceRatio; /**<    (--) trick_chkpnt_io(**) Supply over Demand capacitance ratio for triggering mode flip. */
+        double                      mDemandFilterConstA;     /**<    (--) trick_chkpnt_io(**) Demand filter gain constant A. */
+        double                      mDemandFilterConstB;     /**<    (--) trick_chkpnt_io(**) Demand filter gain constant B. */
+        bool                        mForceDemandMode;        /**<    (--)                     Forces the link to always be in Demand mode. */
+        bool                        mForceSupplyMode;        /**<    (--)                     Forces the link to always be in Supply mode. */
+        bool                        mInDataLastDemandMode;   /**<    (--)                     Last-pass demand mode from the other paired link. */
+        int                         mFramesSinceFlip;        /**<    (--)                     Number of frames since the last mode flip. */
+        double                      mSupplyCapacitance;      /**<    (--)                     Stored capacitance of the node capacitor link when in Demand mode. */
+        double                      mEffectiveConductivity;  /**<    (--) trick_chkpnt_io(**) Effective conductivity of the link in Demand mode. */
+        double                      mSourcePotential;        /**<    (--) trick_chkpnt_io(**) Source potential created in the node in Demand mode. */
+        double                      mDemandFlux;             /**<    (--) trick_chkpnt_io(**) Source flux added to the node in Supply mode. */
+        int                         mLoopLatency;            /**<    (--) trick_chkpnt_io(**) Round-trip loop data lag measured by the Master of the pair. */
+        double                      mDemandFluxGain;         /**<    (--) trick_chkpnt_io(**) Demand mode flux factor due to lag frames. */
+        double                      mSuppliedCapacitance;    /**<    (--) trick_chkpnt_io(**) Network capacitance applied to the Demand node from the Supply side. */
+        std::vector<GunnsBasicDistributedIf*> mOtherIfs;     /**< ** (--) trick_chkpnt_io(**) Vector of other similar links to avoid capacitance interference with. */
+        static const double         mNetworkCapacitanceFlux; /**< ** (--) trick_chkpnt_io(**) Flux value to use in network node capacitance calculations. */
+        /// @brief Validates the initialization of this Gunns Basic Distributed Interface.
+        void validate() const;
+        /// @brief Virtual method for derived links to perform their restart functions.
+        virtual void restartModel();
+        /// @brief Checks for valid implementation-specific port node assignment.
+        virtual bool checkSpecificPortRules(const int port, const int node) const;
+        /// @brief Computes flux through the link.
+        void computeFlux();
+        /// @brief Transports the flux to or from the node.
+        virtual void transportFlux(const int fromPort = 0, const int toPort = 0);
+        /// @brief Special processing of Supply mode data output.
+        void processOutputsSupply();
+        /// @brief Special processing of Demand mode data output.
+        void processOutputsDemand();
+        /// @brief Special processing of Supply mode data input.
+        void processInputsSupply();
+        /// @brief Special processing of Demand mode data input.
+        void processInputsDemand();
+        /// @brief Handles several mode flip cases based on input data.
+        void flipModesOnInput();
+        /// @brief Flips to the Demand mode based on capacitances.
+        void flipModesOnCapacitance();
+        /// @brief Flips to the Demand mode.
+        void flipToDemandMode();
+        /// @brief Flips to the Supply mode.
+        void flipToSupplyMode();
+        /// @brief Computes and outputs capacitance.
+        void outputCapacitance();
+
+    private:
+        /// @details Define the number of ports this link class has.  All objects of the same link
+        ///          class always have the same number of ports.  We use an enum rather than a
+        ///          static const int so that we can reuse the NPORTS name and allow each class to
+        ///          define its own value.
+        enum {NPORTS = 1};
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsBasicDistributedIf(const GunnsBasicDistributedIf& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsBasicDistributedIf& operator =(const GunnsBasicDistributedIf& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Computes the flux through the link, positive into the node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsBasicDistributedIf::computeFlux()
+{
+    mFlux = mPotentialDrop * mAdmittanceMatrix[0] + mSourceVector[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  (--)  Effective capacitance added to the node in Demand mode.
+///
+/// @details  Returns the value of mSuppliedCapacitance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsBasicDistributedIf::getSuppliedCapacitance() const
+{
+    return mSuppliedCapacitance;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  const double*  (--)  The node's network capacitance delta-potentials array.
+///
+/// @details  Returns the node's network capacitance delta-potentials array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* GunnsBasicDistributedIf::getNetCapDeltaPotential() const
+{
+    return mNodes[0]->getNetCapDeltaPotential();
+}
+
+#endif
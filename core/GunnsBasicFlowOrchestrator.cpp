@@ -7,7 +7,8 @@
 
 LIBRARY DEPENDENCY:
   ((core/GunnsBasicLink.o)
-   (core/GunnsBasicNode.o))
+   (core/GunnsBasicNode.o)
+   (core/GunnsLinkProfiler.o))
 */
 
 #include "GunnsBasicFlowOrchestrator.hh"
@@ -30,7 +31,8 @@ GunnsBasicFlowOrchestrator::GunnsBasicFlowOrchestrator(const int& numLinks, cons
     mNodes   (0),
     mName    (),
     mInitFlag(false),
-    mVerbose (false)
+    mVerbose (false),
+    mLinkProfiler(0)
 {
     // nothing to do
 }
@@ -115,7 +117,9 @@ void GunnsBasicFlowOrchestrator::update(const double dt)
     /// - Links loop in reverse order from the step loop to support composite links dependencies
     ///   with their child links.
     for (int link = mNumLinks-1; link >= 0; --link) {
+        const uint64_t start = startProfile();
         mLinks[link]->computeFlows(dt);
+        stopProfile(link, GunnsLinkProfiler::COMPUTE_FLOWS, start);
     }
 
     for (int node = 0; node < mNumNodes-1; ++node) {
@@ -30,6 +30,7 @@ PROGRAMMERS:
 */
 
 #include <string>
+#include "core/GunnsLinkProfiler.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
 // Forward-declare pointer types
@@ -59,19 +60,26 @@ class GunnsBasicFlowOrchestrator
         virtual void update(const double dt);
         /// @brief  Returns whether this GUNNS Basic Flow Orchestrator has been successfully initialized & validated.
         bool         isInitialized() const;
+        /// @brief  Points this orchestrator to the link profiler to time its link calls with.
+        void         setLinkProfiler(GunnsLinkProfiler* profiler);
         //TODO delete when #98 is completed
         void         setVerbose(const bool verbose);
 
     protected:
-        const int&       mNumLinks; /**< ** (--) trick_chkpnt_io(**) Number of links in the network. */
-        const int&       mNumNodes; /**< ** (--) trick_chkpnt_io(**) The number of nodes in the netowrk, including Ground. */
-        GunnsBasicLink** mLinks;    /**< ** (--) trick_chkpnt_io(**) Array of pointers to the network links. */
-        GunnsBasicNode** mNodes;    /**< ** (--) trick_chkpnt_io(**) Array of pointers to the network nodes. */
-        std::string      mName;     /**< *o (--) trick_chkpnt_io(**) Instance name for self-identification in messages. */
-        bool             mInitFlag; /**< *o (--) trick_chkpnt_io(**) Initialization status flag (T is good). */
-        bool             mVerbose;  /**<    (--) TODO delete when #98 is completed */
+        const int&         mNumLinks;     /**< ** (--) trick_chkpnt_io(**) Number of links in the network. */
+        const int&         mNumNodes;     /**< ** (--) trick_chkpnt_io(**) The number of nodes in the netowrk, including Ground. */
+        GunnsBasicLink**   mLinks;        /**< ** (--) trick_chkpnt_io(**) Array of pointers to the network links. */
+        GunnsBasicNode**   mNodes;        /**< ** (--) trick_chkpnt_io(**) Array of pointers to the network nodes. */
+        std::string        mName;         /**< *o (--) trick_chkpnt_io(**) Instance name for self-identification in messages. */
+        bool               mInitFlag;     /**< *o (--) trick_chkpnt_io(**) Initialization status flag (T is good). */
+        bool               mVerbose;      /**<    (--) TODO delete when #98 is completed */
+        GunnsLinkProfiler* mLinkProfiler; /**< ** (--) trick_chkpnt_io(**) The network's link profiler, or null. */
         /// @brief  Validates the initialization of this GUNNS Basic Flow Orchestrator.
         void         validate();
+        /// @brief  Returns the start time of a link call for the link profiler.
+        uint64_t     startProfile() const;
+        /// @brief  Records the duration of a link call to the link profiler.
+        void         stopProfile(const int link, const GunnsLinkProfiler::CallType call, const uint64_t start);
 
     private:
         /// @brief  Copy constructor unavailable since declared private and not implemented.
@@ -98,4 +106,41 @@ inline bool GunnsBasicFlowOrchestrator::isInitialized() const
     return mInitFlag;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  profiler  (--)  Pointer to the network's link profiler, or null for none.
+///
+/// @details  Points this orchestrator to the link profiler to time its link calls with.  The network
+///           solver does this before initializing the orchestrator.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsBasicFlowOrchestrator::setLinkProfiler(GunnsLinkProfiler* profiler)
+{
+    mLinkProfiler = profiler;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   uint64_t  (--)  Start time of the link call, or zero if not profiling.
+///
+/// @details  Returns the start time of a link call from the link profiler, if there is one.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint64_t GunnsBasicFlowOrchestrator::startProfile() const
+{
+    return mLinkProfiler ? mLinkProfiler->start() : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  link   (--)  Index of the link in the network links array.
+/// @param[in]  call   (--)  The link method called.
+/// @param[in]  start  (--)  Start time of the call from startProfile.
+///
+/// @details  Records the duration of a link call to the link profiler, if there is one.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsBasicFlowOrchestrator::stopProfile(const int                         link,
+                                                    const GunnsLinkProfiler::CallType call,
+                                                    const uint64_t                    start)
+{
+    if (mLinkProfiler) {
+        mLinkProfiler->stop(link, call, start);
+    }
+}
+
 #endif
@@ -0,0 +1,410 @@
+/**
+@file
+@brief    GUNNS Basic Reduced Interface Link implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (GunnsBasicLink.o)
+    (GunnsPortReduction.o)
+   )
+*/
+
+#include "GunnsBasicReducedIf.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Basic Reduced Interface data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicReducedIfData::GunnsBasicReducedIfData()
+    :
+    mFrameCount(0),
+    mFrameLoopback(0),
+    mAdmittance(0),
+    mSource(0),
+    mFlux(0),
+    mNumPorts(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Basic Reduced Interface data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicReducedIfData::~GunnsBasicReducedIfData()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes dynamic memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIfData::cleanup()
+{
+    TS_DELETE_ARRAY(mFlux);
+    TS_DELETE_ARRAY(mSource);
+    TS_DELETE_ARRAY(mAdmittance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name     (--) Name of the instance for dynamic memory names for Trick MM.
+/// @param[in] numPorts (--) Number of interface ports.
+///
+/// @details  Allocates and zeroes the dynamic arrays.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIfData::initialize(const std::string& name, const int numPorts)
+{
+    cleanup();
+    mNumPorts = numPorts;
+    if (mNumPorts > 0) {
+        TS_NEW_PRIM_ARRAY_EXT(mAdmittance, mNumPorts * mNumPorts, double, name + ".mAdmittance");
+        TS_NEW_PRIM_ARRAY_EXT(mSource,     mNumPorts,             double, name + ".mSource");
+        TS_NEW_PRIM_ARRAY_EXT(mFlux,       mNumPorts,             double, name + ".mFlux");
+        for (int i = 0; i < mNumPorts; ++i) {
+            mSource[i] = 0.0;
+            mFlux[i]   = 0.0;
+            for (int j = 0; j < mNumPorts; ++j) {
+                mAdmittance[i*mNumPorts + j] = 0.0;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  (--)  True if all data validation checks passed.
+///
+/// @details  Checks for all of the following conditions to be met:  Frame count > 0, arrays are
+///           allocated, and the admittance matrix diagonal is not negative.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicReducedIfData::hasValidData() const
+{
+    if (mFrameCount < 1 or mNumPorts < 1 or not mAdmittance) {
+        return false;
+    }
+    for (int i = 0; i < mNumPorts; ++i) {
+        if (mAdmittance[i*mNumPorts + i] < 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  that  (--)  Object to be copied.
+///
+/// @details  Assigns values of this object's attributes to the given object's values.  The
+///           mNumPorts term is not changed, and we assume that the two objects were initialized
+///           identically; the array sizes are the same.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicReducedIfData& GunnsBasicReducedIfData::operator =(const GunnsBasicReducedIfData& that)
+{
+    if (this != &that) {
+        mFrameCount    = that.mFrameCount;
+        mFrameLoopback = that.mFrameLoopback;
+        for (int i = 0; i < mNumPorts; ++i) {
+            mSource[i] = that.mSource[i];
+            mFlux[i]   = that.mFlux[i];
+            for (int j = 0; j < mNumPorts; ++j) {
+                mAdmittance[i*mNumPorts + j] = that.mAdmittance[i*mNumPorts + j];
+            }
+        }
+    }
+    return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name     (--)  Link name.
+/// @param[in] nodes    (--)  Network nodes array.
+/// @param[in] isSupply (--)  This link is the Supply side of the pair.
+///
+/// @details  Default GUNNS Basic Reduced Interface Link Config Data Constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicReducedIfConfigData::GunnsBasicReducedIfConfigData(const std::string& name,
+                                                             GunnsNodeList*     nodes,
+                                                             const bool         isSupply)
+    :
+    GunnsBasicLinkConfigData(name, nodes),
+    mIsSupply(isSupply)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default GUNNS Basic Reduced Interface Link Config Data Destructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicReducedIfConfigData::~GunnsBasicReducedIfConfigData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default GUNNS Basic Reduced Interface Link Constructor.  The number of ports is set at
+///           initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicReducedIf::GunnsBasicReducedIf()
+    :
+    GunnsBasicLink(0),
+    mInData   (),
+    mOutData  (),
+    mReduction(),
+    mIsSupply (false),
+    mPortFlux (0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default GUNNS Basic Reduced Interface Link Destructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicReducedIf::~GunnsBasicReducedIf()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes dynamic memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::cleanup()
+{
+    TS_DELETE_ARRAY(mPortFlux);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     configData   (--) Reference to link Config Data.
+/// @param[in]     inputData    (--) Reference to link Input Data.
+/// @param[in,out] networkLinks (--) Network links vector.
+/// @param[in]     portsVector  (--) Vector of node numbers the link ports connect to.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this Basic Reduced Interface link with configuration and input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::initialize(const GunnsBasicReducedIfConfigData& configData,
+                                     const GunnsBasicLinkInputData&       inputData,
+                                     std::vector<GunnsBasicLink*>&        networkLinks,
+                                     std::vector<int>*                    portsVector)
+{
+    mInitFlag = false;
+    validate(configData, portsVector);
+
+    /// - Initialize the base class with initial node map from ports vector.
+    mNumPorts = portsVector->size();
+    int ports[mNumPorts];
+    for (int i = 0; i < mNumPorts; ++i) {
+        ports[i] = portsVector->at(i);
+    }
+    GunnsBasicLink::initialize(configData, inputData, networkLinks, ports);
+
+    /// - Initialize from config data.
+    mIsSupply = configData.mIsSupply;
+
+    /// - Allocate & initialize the port fluxes, interface data and port reduction.
+    cleanup();
+    TS_NEW_PRIM_ARRAY_EXT(mPortFlux, mNumPorts, double, mName + ".mPortFlux");
+    for (int i = 0; i < mNumPorts; ++i) {
+        mPortFlux[i] = 0.0;
+    }
+    mInData.initialize (mName + ".mInData",  mNumPorts);
+    mOutData.initialize(mName + ".mOutData", mNumPorts);
+    mReduction.initialize(mName + ".mReduction", mNumPorts, mNodeMap);
+
+    /// - Set init flag on successful initialization.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData   (--) Reference to Link Config Data.
+/// @param[in]  portsVector  (--) Vector of node numbers the link ports connect to.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Validates the link initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::validate(const GunnsBasicReducedIfConfigData& configData __attribute__((unused)),
+                                   std::vector<int>*                    portsVector) const
+{
+    /// - Throw an exception on missing ports vector.
+    if (not portsVector) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "null ports vector.");
+    }
+
+    /// - Throw an exception on # ports < 1.
+    if (portsVector->size() < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "Number of link ports < 1.");
+    }
+
+    /// - Throw an exception on duplicate port nodes, since they would make the Supply network
+    ///   equivalent singular.
+    for (unsigned int i = 0; i < portsVector->size(); ++i) {
+        for (unsigned int j = i + 1; j < portsVector->size(); ++j) {
+            if (portsVector->at(i) == portsVector->at(j)) {
+                GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                            "duplicate port nodes.");
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Derived classes should call their base class implementation too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::restartModel()
+{
+    /// - Reset the base class.
+    GunnsBasicLink::restartModel();
+
+    /// - Reset non-config & non-checkpointed class attributes.  The Supply network will recompute
+    ///   its equivalent on its next pass.
+    mReduction.invalidate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step (not used).
+///
+/// @details  Builds this link's contributions to the network system of equations for its role.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::step(const double dt __attribute__((unused)))
+{
+    /// - Process user commands to dynamically re-map ports.
+    processUserPortCommand();
+
+    if (mIsSupply) {
+        stepSupply();
+    } else {
+        stepDemand();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  In the Supply role this link adds no admittance, and applies the fluxes demanded by the
+///           Demand side as flux sources out of the nodes.  These contributions are excluded from
+///           the network equivalent output to the Demand side, since the Demand side models them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::stepSupply()
+{
+    const bool valid = mInData.hasValidData() and mInData.getNumPorts() == mNumPorts;
+    for (int i = 0; i < mNumPorts; ++i) {
+        for (int j = 0; j < mNumPorts; ++j) {
+            if (0.0 != mAdmittanceMatrix[i*mNumPorts + j]) {
+                mAdmittanceMatrix[i*mNumPorts + j] = 0.0;
+                mAdmittanceUpdate = true;
+            }
+        }
+        mSourceVector[i] = valid ? -mInData.mFlux[i] : 0.0;
+    }
+    mReduction.setExcludedContributions(0, mSourceVector);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  In the Demand role this link stamps the Supply network's Norton equivalent admittance
+///           matrix and source vector onto its nodes.  Until valid data is received from the Supply
+///           side, the link contributes nothing.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::stepDemand()
+{
+    const bool valid = mInData.hasValidData() and mInData.getNumPorts() == mNumPorts;
+    for (int i = 0; i < mNumPorts; ++i) {
+        for (int j = 0; j < mNumPorts; ++j) {
+            const double admittance = valid ? mInData.mAdmittance[i*mNumPorts + j] : 0.0;
+            if (admittance != mAdmittanceMatrix[i*mNumPorts + j]) {
+                mAdmittanceMatrix[i*mNumPorts + j] = admittance;
+                mAdmittanceUpdate = true;
+            }
+        }
+        mSourceVector[i] = valid ? mInData.mSource[i] : 0.0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step.
+///
+/// @details  Computes the flux into each node from the link contributions and the solved
+///           potentials, and transports them to the nodes.  The net flux into the network is stored
+///           in mFlux and the net power into the network in mPower.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::computeFlows(const double dt)
+{
+    mFlux  = 0.0;
+    mPower = 0.0;
+    for (int i = 0; i < mNumPorts; ++i) {
+        mPortFlux[i] = mSourceVector[i];
+        for (int j = 0; j < mNumPorts; ++j) {
+            mPortFlux[i] -= mAdmittanceMatrix[i*mNumPorts + j] * mPotentialVector[j];
+        }
+        mFlux  += mPortFlux[i];
+        mPower += mPortFlux[i] * mPotentialVector[i];
+    }
+    transportFlows(dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step (not used).
+///
+/// @details  Transports the flux at each port to or from its node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::transportFlows(const double dt __attribute__((unused)))
+{
+    for (int i = 0; i < mNumPorts; ++i) {
+        if (mPortFlux[i] > 0.0) {
+            mNodes[i]->collectInflux(mPortFlux[i]);
+        } else if (mPortFlux[i] < 0.0) {
+            mNodes[i]->collectOutflux(-mPortFlux[i]);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Post-network step outputs to the interface.  The Supply side outputs the network
+///           equivalent from its port reduction.  If the reduction isn't valid on this pass, such as
+///           when the network failed to converge, the last valid equivalent is held.  The Demand
+///           side outputs the fluxes into its nodes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicReducedIf::processOutputs()
+{
+    mOutData.mFrameCount   += 1;
+    mOutData.mFrameLoopback = mInData.mFrameCount;
+
+    if (mIsSupply) {
+        if (mReduction.isValid()) {
+            const double* admittance = mReduction.getAdmittance();
+            const double* source     = mReduction.getSource();
+            for (int i = 0; i < mNumPorts; ++i) {
+                mOutData.mSource[i] = source[i];
+                mOutData.mFlux[i]   = 0.0;
+                for (int j = 0; j < mNumPorts; ++j) {
+                    mOutData.mAdmittance[i*mNumPorts + j] = admittance[i*mNumPorts + j];
+                }
+            }
+        }
+    } else {
+        for (int i = 0; i < mNumPorts; ++i) {
+            mOutData.mFlux[i] = mPortFlux[i];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] port (--) The port to be assigned.
+/// @param[in] node (--) The desired node to assign the port to.
+///
+/// @returns  bool  (--) Returns true if all rules checks pass.
+///
+/// @details  Checks the requested port & node arguments for validity against rules that apply to
+///           this specific class.  These are:
+///           - No port may be assigned to the ground node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicReducedIf::checkSpecificPortRules(const int port __attribute__((unused)),
+                                                 const int node) const
+{
+    bool result = true;
+
+    if (node == getGroundNodeIndex()) {
+        GUNNS_WARNING("aborted setting a port: cannot assign any port to the boundary node.");
+        result = false;
+    }
+    return result;
+}
@@ -0,0 +1,218 @@
+#ifndef GunnsBasicReducedIf_EXISTS
+#define GunnsBasicReducedIf_EXISTS
+
+/**
+@file
+@brief    GUNNS Basic Reduced Interface Link declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_BASIC_REDUCED_IF    GUNNS Basic Reduced Interface Link
+@ingroup   TSM_GUNNS_CORE_LINK_BASIC
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Classes for the GUNNS Basic Reduced Interface link, a multi-port interface between separate
+   basic networks, coupled by the Norton equivalent of the Supply network at its interface nodes.)
+
+REFERENCE:
+- (Schur complement reduction of the admittance matrix onto a subset of nodes.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The potential and flux units are the same on both sides of the interface.)
+- (The Supply and Demand roles are fixed by configuration and do not flip.)
+- (The Supply network must be solved by Cholesky decomposition in NORMAL mode.)
+- (The Supply side equivalent is lagged by the interface data transport delay.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsBasicReducedIf.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "GunnsBasicLink.hh"
+#include "GunnsPortReduction.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Basic Reduced Interface Data
+///
+/// @details  This class provides a data structure for the data shared between a pair of Basic
+///           Reduced Interface links.  The Supply side fills in its Norton equivalent admittance
+///           matrix and source vector, and the Demand side fills in the fluxes into its network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBasicReducedIfData
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsBasicReducedIfData);
+    public:
+        unsigned int mFrameCount;    /**< (--)                     Frame count driven by this side. */
+        unsigned int mFrameLoopback; /**< (--)                     Frame count driven by other side, echoed back. */
+        double*      mAdmittance;    /**< (--) trick_chkpnt_io(**) Supply network Norton admittance matrix at the ports. */
+        double*      mSource;        /**< (--) trick_chkpnt_io(**) Supply network Norton source vector at the ports. */
+        double*      mFlux;          /**< (--) trick_chkpnt_io(**) Flux into the Demand network at each port. */
+        /// @brief  Default constructs this Basic Reduced Interface data.
+        GunnsBasicReducedIfData();
+        /// @brief  Default destructs this Basic Reduced Interface data.
+        virtual ~GunnsBasicReducedIfData();
+        /// @brief  Allocates the dynamic arrays.
+        void initialize(const std::string& name, const int numPorts);
+        /// @brief  Returns whether this object has received valid data.
+        bool hasValidData() const;
+        /// @brief  Returns the number of ports.
+        int  getNumPorts() const;
+        /// @brief Assignment operator for this Basic Reduced Interface data.
+        GunnsBasicReducedIfData& operator =(const GunnsBasicReducedIfData& that);
+
+    protected:
+        int mNumPorts;               /**< *o (--) trick_chkpnt_io(**) Number of interface ports. */
+        /// @brief  Deletes dynamic memory.
+        void cleanup();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsBasicReducedIfData(const GunnsBasicReducedIfData&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Basic Reduced Interface Configuration Data
+///
+/// @details  This class provides a data structure for the Basic Reduced Interface link
+///           configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBasicReducedIfConfigData : public GunnsBasicLinkConfigData
+{
+    public:
+        bool mIsSupply; /**< (--) trick_chkpnt_io(**) This link is the Supply side of the pair. */
+        /// @brief Default constructs this Basic Reduced Interface configuration data.
+        GunnsBasicReducedIfConfigData(const std::string& name     = "",
+                                      GunnsNodeList*     nodes    = 0,
+                                      const bool         isSupply = false);
+        /// @brief Default destructs this Basic Reduced Interface configuration data.
+        virtual ~GunnsBasicReducedIfConfigData();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsBasicReducedIfConfigData(const GunnsBasicReducedIfConfigData&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsBasicReducedIfConfigData& operator =(const GunnsBasicReducedIfConfigData&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Basic Reduced Interface class
+///
+/// @details  Two of these, in separate networks, interface with each other across any number of
+///           node pairs (ports) at once.  Unlike pairs of single-port distributed interfaces, the
+///           cross-coupling between the ports through the Supply network is modeled, so several
+///           tightly coupled paths between the same two networks don't oscillate against each other.
+///
+///           The Supply side link owns a GunnsPortReduction, which must be registered with the
+///           Supply network with Gunns::addPortReduction.  After each Supply network solution, the
+///           reduction holds the Norton equivalent of the Supply network at the interface nodes:
+///           admittance matrix [Y] and source vector {J}, which is the Schur complement of the
+///           Supply network admittance matrix onto the interface nodes, computed from its own
+///           matrix decomposition.  The Supply link outputs these to the Demand link, and applies
+///           the fluxes demanded by the Demand side as flux sources to its nodes.
+///
+///           The Demand side link stamps the Supply equivalent into the Demand network as an
+///           implicit boundary: admittance matrix [Y] and source vector {J} on its own nodes, so the
+///           flux into the Demand network at the ports is {J} - [Y]{p}.  It outputs these resulting
+///           fluxes to the Supply side.
+///
+///           Node capacitance in the Supply network is included in the equivalent as its C/dt
+///           admittance & source terms.  The Demand side nodes should have no capacitance of their
+///           own, as the Supply side represents it.
+///
+///           This is a multi-port link and we do away with the assumed Ground node.  In both roles,
+///           this link treats positive flux direction as flux into the node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBasicReducedIf : public GunnsBasicLink
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsBasicReducedIf);
+    public:
+        GunnsBasicReducedIfData mInData;    /**<    (--)                     Data from the other paired link input from the interface. */
+        GunnsBasicReducedIfData mOutData;   /**<    (--)                     Data to the other paired link output to the interface. */
+        GunnsPortReduction      mReduction; /**<    (--)                     Supply network equivalent at this link's ports. */
+        /// @brief Default Constructor.
+        GunnsBasicReducedIf();
+        /// @brief Default Destructor.
+        virtual ~GunnsBasicReducedIf();
+        /// @brief Initializes the link.
+        void initialize(const GunnsBasicReducedIfConfigData& configData,
+                        const GunnsBasicLinkInputData&       inputData,
+                        std::vector<GunnsBasicLink*>&        networkLinks,
+                        std::vector<int>*                    portsVector);
+        /// @brief Step method for updating the link.
+        virtual void step(const double dt);
+        /// @brief Method for computing the flows across the link.
+        virtual void computeFlows(const double dt);
+        /// @brief Transports the flows to and from the nodes.
+        virtual void transportFlows(const double dt);
+        /// @brief Special processing of data outputs from the model after the network update.
+        virtual void processOutputs();
+        /// @brief Returns whether this is the Supply side of the pair.
+        bool          isSupply() const;
+        /// @brief Returns the flux into the node at each port.
+        const double* getPortFlux() const;
+
+    protected:
+        bool    mIsSupply;  /**<    (--) trick_chkpnt_io(**) This link is the Supply side of the pair. */
+        double* mPortFlux;  /**<    (--) trick_chkpnt_io(**) Flux into the node at each port. */
+        /// @brief Validates the initialization of this Gunns Basic Reduced Interface.
+        void validate(const GunnsBasicReducedIfConfigData& configData,
+                      std::vector<int>*                    portsVector) const;
+        /// @brief Virtual method for derived links to perform their restart functions.
+        virtual void restartModel();
+        /// @brief Checks for valid implementation-specific port node assignment.
+        virtual bool checkSpecificPortRules(const int port, const int node) const;
+        /// @brief Builds the Supply side link contributions.
+        void stepSupply();
+        /// @brief Builds the Demand side link contributions.
+        void stepDemand();
+        /// @brief Deletes dynamic memory.
+        void cleanup();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsBasicReducedIf(const GunnsBasicReducedIf& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsBasicReducedIf& operator =(const GunnsBasicReducedIf& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of interface ports.
+///
+/// @details  Returns the number of interface ports.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsBasicReducedIfData::getNumPorts() const
+{
+    return mNumPorts;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this is the Supply side of the pair.
+///
+/// @details  Returns whether this is the Supply side of the pair.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsBasicReducedIf::isSupply() const
+{
+    return mIsSupply;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  const double* (--) Flux into the node at each port.
+///
+/// @details  Returns the flux into the node at each port.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* GunnsBasicReducedIf::getPortFlux() const
+{
+    return mPortFlux;
+}
+
+#endif
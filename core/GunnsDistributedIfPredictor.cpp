@@ -0,0 +1,201 @@
+/**
+@file
+@brief    GUNNS Distributed Interface Lag Predictor implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (software/exceptions/TsInitializationException.o)
+   )
+*/
+
+#include "GunnsDistributedIfPredictor.hh"
+#include "core/GunnsMacros.hh"
+#include "math/MsMath.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Distributed Interface Lag Predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsDistributedIfPredictor::GunnsDistributedIfPredictor()
+    :
+    mName(),
+    mMaxHorizon(0.0),
+    mMaxDeltaFraction(0.0),
+    mNumSamples(0),
+    mSampleFrame(),
+    mSampleValue(),
+    mRate(0.0),
+    mFramesSinceSample(0),
+    mHorizon(0.0),
+    mPrediction(0.0),
+    mPredicting(false),
+    mFallbackCount(0),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Distributed Interface Lag Predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsDistributedIfPredictor::~GunnsDistributedIfPredictor()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name             (--) Instance name for messages.
+/// @param[in] maxHorizon       (--) Maximum number of frames to extrapolate ahead.
+/// @param[in] maxDeltaFraction (--) Maximum extrapolated change as a fraction of the received value.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Distributed Interface Lag Predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsDistributedIfPredictor::initialize(const std::string& name,
+                                             const double       maxHorizon,
+                                             const double       maxDeltaFraction)
+{
+    /// - Reset the init flag.
+    mInitFlag = false;
+
+    /// - Initialize & validate the instance name.
+    GUNNS_NAME_ERREX("GunnsDistributedIfPredictor", name);
+
+    /// - Throw an exception on maximum horizon < 0.
+    if (maxHorizon < 0.0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "maximum horizon < 0.");
+    }
+
+    /// - Throw an exception on maximum delta fraction not in [0, 1).
+    if (maxDeltaFraction < 0.0 or maxDeltaFraction >= 1.0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "maximum delta fraction not in [0, 1).");
+    }
+
+    mMaxHorizon       = maxHorizon;
+    mMaxDeltaFraction = maxDeltaFraction;
+    mFallbackCount    = 0;
+    reset();
+
+    /// - Set the init flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Discards the sample history, so the output holds the received value until a full
+///           history has been rebuilt.  Owners call this when the meaning of the received data
+///           changes, such as on a mode flip or a restart.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsDistributedIfPredictor::reset()
+{
+    mNumSamples        = 0;
+    for (unsigned int i = 0; i < NSAMPLES; ++i) {
+        mSampleFrame[i] = 0;
+        mSampleValue[i] = 0.0;
+    }
+    mRate              = 0.0;
+    mFramesSinceSample = 0;
+    mHorizon           = 0.0;
+    mPredicting        = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] sampleFrame (--) Sender's frame count of the received value.
+/// @param[in] value       (--) Received value.
+/// @param[in] lagFrames   (--) One-way data lag from the sender, in frames.
+///
+/// @returns  double (--) The received value extrapolated to the current frame.
+///
+/// @details  This is called once per frame with the latest received data.  A sample is only added
+///           to the history when the sender's frame count advances, otherwise the count of frames
+///           since the last sample grows, and adds to the extrapolation horizon.  A sender frame
+///           count that goes backwards means the other side has restarted, so the history is
+///           discarded.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsDistributedIfPredictor::predict(const unsigned int sampleFrame,
+                                            const double       value,
+                                            const double       lagFrames)
+{
+    /// - Update the history when a new sample arrives, discarding it first if the new sample
+    ///   diverges from what the history predicted for it.
+    if (0 == mNumSamples or sampleFrame != mSampleFrame[0]) {
+        if (mNumSamples > 0 and sampleFrame < mSampleFrame[0]) {
+            reset();
+        } else if (isDiverging(sampleFrame, value)) {
+            reset();
+            ++mFallbackCount;
+        }
+        addSample(sampleFrame, value);
+        mFramesSinceSample = 0;
+    } else {
+        ++mFramesSinceSample;
+    }
+
+    /// - Extrapolate from the received value along the history slope, limited in horizon and in
+    ///   fraction of the received value.  Hold the received value until there is a full history.
+    mPredicting = mInitFlag and (NSAMPLES == mNumSamples);
+    mHorizon    = 0.0;
+    mPrediction = value;
+    if (mPredicting) {
+        mHorizon = MsMath::limitRange(0.0, lagFrames + mFramesSinceSample, mMaxHorizon);
+        const double maxDelta = mMaxDeltaFraction * std::fabs(value);
+        mPrediction += MsMath::limitRange(-maxDelta, mRate * mHorizon, maxDelta);
+    }
+    return mPrediction;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] sampleFrame (--) Sender's frame count of the new sample.
+/// @param[in] value       (--) Value of the new sample.
+///
+/// @details  Pushes the new sample onto the front of the history and updates the history slope,
+///           taken between the newest and oldest samples to reduce sensitivity to noise.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsDistributedIfPredictor::addSample(const unsigned int sampleFrame, const double value)
+{
+    for (unsigned int i = NSAMPLES - 1; i > 0; --i) {
+        mSampleFrame[i] = mSampleFrame[i-1];
+        mSampleValue[i] = mSampleValue[i-1];
+    }
+    mSampleFrame[0] = sampleFrame;
+    mSampleValue[0] = value;
+    if (mNumSamples < NSAMPLES) {
+        ++mNumSamples;
+    }
+
+    mRate = 0.0;
+    if (mNumSamples > 1) {
+        const unsigned int oldest = mNumSamples - 1;
+        mRate = (mSampleValue[0] - mSampleValue[oldest])
+              / static_cast<double>(mSampleFrame[0] - mSampleFrame[oldest]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] sampleFrame (--) Sender's frame count of the new sample.
+/// @param[in] value       (--) Value of the new sample.
+///
+/// @returns  bool (--) True if the history's prediction of the new sample is worse than holding.
+///
+/// @details  Compares the new sample to the history's extrapolation to its frame, and to the newest
+///           sample held.  If extrapolating would have been worse than holding, the signal isn't
+///           following the linear model.  This is only checked with a full history, since that's
+///           when the history is used for predictions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsDistributedIfPredictor::isDiverging(const unsigned int sampleFrame,
+                                              const double       value) const
+{
+    if (NSAMPLES != mNumSamples) {
+        return false;
+    }
+    const double expected  = mSampleValue[0]
+                           + mRate * static_cast<double>(sampleFrame - mSampleFrame[0]);
+    const double holdError = std::fabs(value - mSampleValue[0]);
+    return std::fabs(value - expected) > holdError;
+}
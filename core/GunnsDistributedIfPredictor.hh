@@ -0,0 +1,158 @@
+#ifndef GunnsDistributedIfPredictor_EXISTS
+#define GunnsDistributedIfPredictor_EXISTS
+
+/**
+@file
+@brief    GUNNS Distributed Interface Lag Predictor declarations
+
+@defgroup  TSM_GUNNS_CORE_DISTRIBUTED_IF_PREDICTOR    GUNNS Distributed Interface Lag Predictor
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Extrapolates a scalar value received over a lagged distributed interface to the current frame.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Both sides of the interface run at the same frame rate, so the sender's frame count is a valid
+   time base for the received samples.)
+- (Extrapolation is linear in the sender's frame count.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsDistributedIfPredictor.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Distributed Interface Lag Predictor
+///
+/// @details  Data received over a distributed interface is old by the time it is used: it left the
+///           other side about half a round-trip loop lag ago, and may have been repeated for several
+///           of our frames since it last changed.  This keeps a short history of the received values,
+///           keyed by the sender's frame count, and extrapolates the latest value along the slope of
+///           that history to the current frame.
+///
+///           The extrapolation is bounded in two ways: the horizon is limited to a maximum number of
+///           frames, and the extrapolated change is limited to a fraction of the received value.  The
+///           fraction limit must be < 1 so that the prediction never changes sign from the received
+///           value, which keeps predicted pressures and temperatures physical.
+///
+///           When a new sample arrives, it is compared to what the history's slope would have
+///           predicted for it.  If that prediction is worse than simply holding the last value, the
+///           signal isn't following the linear model (a step, an oscillation or noise), so the
+///           history is discarded and the output falls back to the received value until a full
+///           history has been rebuilt.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsDistributedIfPredictor
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsDistributedIfPredictor);
+    public:
+        /// @brief  Enumeration of the sample history size.
+        enum {NSAMPLES = 3};
+        /// @brief  Default constructs this GUNNS Distributed Interface Lag Predictor.
+        GunnsDistributedIfPredictor();
+        /// @brief  Default destructs this GUNNS Distributed Interface Lag Predictor.
+        virtual ~GunnsDistributedIfPredictor();
+        /// @brief  Initializes this GUNNS Distributed Interface Lag Predictor.
+        void         initialize(const std::string& name,
+                                const double       maxHorizon,
+                                const double       maxDeltaFraction);
+        /// @brief  Updates the history with the received value and returns the prediction.
+        double       predict(const unsigned int sampleFrame, const double value, const double lagFrames);
+        /// @brief  Discards the sample history.
+        void         reset();
+        /// @brief  Returns whether the output is currently the extrapolated value.
+        bool         isPredicting() const;
+        /// @brief  Returns the last output value.
+        double       getPrediction() const;
+        /// @brief  Returns the slope of the sample history.
+        double       getRate() const;
+        /// @brief  Returns the number of times the predictor has fallen back on divergence.
+        unsigned int getFallbackCount() const;
+
+    protected:
+        std::string  mName;                  /**< *o (--) trick_chkpnt_io(**) Instance name for messages. */
+        double       mMaxHorizon;            /**<    (--) trick_chkpnt_io(**) Maximum number of frames to extrapolate ahead. */
+        double       mMaxDeltaFraction;      /**<    (--) trick_chkpnt_io(**) Maximum extrapolated change as a fraction of the received value. */
+        unsigned int mNumSamples;            /**<    (--)                     Number of valid samples in the history. */
+        unsigned int mSampleFrame[NSAMPLES]; /**<    (--)                     Sender frame count of the history samples, newest first. */
+        double       mSampleValue[NSAMPLES]; /**<    (--)                     Values of the history samples, newest first. */
+        double       mRate;                  /**<    (--)                     Slope of the history, per sender frame. */
+        int          mFramesSinceSample;     /**<    (--)                     Number of our frames since the newest sample arrived. */
+        double       mHorizon;               /**<    (--) trick_chkpnt_io(**) Number of frames extrapolated ahead on the last pass. */
+        double       mPrediction;            /**<    (--) trick_chkpnt_io(**) Output value on the last pass. */
+        bool         mPredicting;            /**<    (--) trick_chkpnt_io(**) The output was extrapolated on the last pass. */
+        unsigned int mFallbackCount;         /**<    (--)                     Number of times the history was discarded on divergence. */
+        bool         mInitFlag;              /**< *o (--) trick_chkpnt_io(**) Initialization complete flag. */
+        /// @brief  Adds a new sample to the history.
+        void addSample(const unsigned int sampleFrame, const double value);
+        /// @brief  Returns whether the new sample diverges from the history's prediction of it.
+        bool isDiverging(const unsigned int sampleFrame, const double value) const;
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsDistributedIfPredictor(const GunnsDistributedIfPredictor&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsDistributedIfPredictor& operator =(const GunnsDistributedIfPredictor&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the last output was extrapolated from the history.
+///
+/// @details  Returns whether the output is currently the extrapolated value, rather than the
+///           received value held.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsDistributedIfPredictor::isPredicting() const
+{
+    return mPredicting;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) The last output value.
+///
+/// @details  Returns the last output value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsDistributedIfPredictor::getPrediction() const
+{
+    return mPrediction;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) Slope of the sample history, per sender frame.
+///
+/// @details  Returns the slope of the sample history.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsDistributedIfPredictor::getRate() const
+{
+    return mRate;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int (--) Number of times the history was discarded on divergence.
+///
+/// @details  Returns the number of times the predictor has fallen back on divergence.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsDistributedIfPredictor::getFallbackCount() const
+{
+    return mFallbackCount;
+}
+
+#endif
@@ -267,6 +267,17 @@ void GunnsFluidConductor::step(const double dt)
             break;   // mTuneMode = OFF, do nothing
     }
 
+    updateAdmittance();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Sets the link system conductance based on the effective conductivity and the blockage
+///           fraction, and builds the admittance matrix.  Derived links that update their
+///           effective conductivity outside of the step method, such as in minor steps, can call
+///           this to update their admittance the same way.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidConductor::updateAdmittance()
+{
     /// - Set the Link Effective Conductance based on the effective conductivity and the blockage
     ///   fraction.
     if (mMalfBlockageFlag) {
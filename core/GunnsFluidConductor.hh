@@ -148,6 +148,9 @@ class GunnsFluidConductor : public GunnsFluidLink
         /// @brief Applies an optional linearization for the admittance matrix.
         virtual double linearizeConductance();
 
+        /// @brief Updates the link conductance and admittance from the effective conductivity.
+        void updateAdmittance();
+
         /// @brief Updates the admittance and source terms of the link
         virtual void buildConductance();
 
@@ -7,6 +7,7 @@
 
 LIBRARY DEPENDENCY:
    (
+    (GunnsDistributedIfPredictor.o)
     (GunnsFluidCapacitor.o)
    )
 */
@@ -246,7 +247,10 @@ GunnsFluidDistributedIfConfigData::GunnsFluidDistributedIfConfigData(
     mDemandFilterConstB(0.75),
     mFluidSizesOverride(false),
     mNumFluidOverride(0),
-    mNumTcOverride(0)
+    mNumTcOverride(0),
+    mPredictorOption(false),
+    mPredictorMaxHorizon(10.0),
+    mPredictorMaxFraction(0.05)
 {
     // nothing to do
 }
@@ -334,7 +338,10 @@ GunnsFluidDistributedIf::GunnsFluidDistributedIf()
     mTempMoleFractions     (0),
     mTempTcMoleFractions   (0),
     mOtherIfs              (),
-    mFluidState            ()
+    mFluidState            (),
+    mPredictorOption       (false),
+    mPressurePredictor     (),
+    mEnergyPredictor       ()
 {
     // nothing to do
 }
@@ -384,6 +391,7 @@ void GunnsFluidDistributedIf::initialize(const GunnsFluidDistributedIfConfigData
     mModingCapacitanceRatio = configData.mModingCapacitanceRatio;
     mDemandFilterConstA     = configData.mDemandFilterConstA;
     mDemandFilterConstB     = configData.mDemandFilterConstB;
+    mPredictorOption        = configData.mPredictorOption;
 
     /// - Initialize from input data.
     mForceDemandMode = inputData.mForceDemandMode;
@@ -449,6 +457,12 @@ void GunnsFluidDistributedIf::initialize(const GunnsFluidDistributedIfConfigData
                 "Caught exception from mFluidState initialization.");
     }
 
+    /// - Initialize the incoming Supply state predictors, which validate their own limits.
+    mPressurePredictor.initialize(mName + ".mPressurePredictor",
+                                  configData.mPredictorMaxHorizon, configData.mPredictorMaxFraction);
+    mEnergyPredictor  .initialize(mName + ".mEnergyPredictor",
+                                  configData.mPredictorMaxHorizon, configData.mPredictorMaxFraction);
+
     /// - Validate initialization.
     validate();
 
@@ -520,6 +534,8 @@ void GunnsFluidDistributedIf::restartModel()
     for (int i = 0; i < mNodes[0]->getFluidConfig()->mNTypes; ++i) {
         mTempMassFractions[i] = 0.0;
     }
+    mPressurePredictor.reset();
+    mEnergyPredictor.reset();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -543,14 +559,16 @@ void GunnsFluidDistributedIf::processInputs()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]      pressure  (kPa)  Pressure to set the fluid to.
+/// @param[in]      energy    (--)   Temperature (K) or specific enthalpy (J/kg) to set the fluid to.
 /// @param[in,out]  fluid     (--)   Pointer to the PolyFluid object to be set.
 ///
 /// @returns  double (--) Sum of input bulk compound mole fractions, <= 1.
 ///
-/// @details  Copies the incoming fluid state from the other side of the interface (mInData) into
-///           the given fluid object and sets it to the given pressure.
+/// @details  Copies the incoming fluid mixture from the other side of the interface (mInData) into
+///           the given fluid object and sets it to the given pressure and energy.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-double GunnsFluidDistributedIf::inputFluid(const double pressure, PolyFluid* fluid)
+double GunnsFluidDistributedIf::inputFluid(const double pressure, const double energy,
+                                           PolyFluid* fluid)
 {
     /// - Normalize the incoming bulk mole fractions to sum to 1.  Internally, GUNNS sums the bulk
     ///   mole fractions to 1, and this doesn't include the trace compounds.  But the interface
@@ -578,9 +596,9 @@ double GunnsFluidDistributedIf::inputFluid(const double pressure, PolyFluid* flu
     fluid->setPressure(pressure);
 
     if (mUseEnthalpy) {
-        fluid->setTemperature(fluid->computeTemperature(mInData.mEnergy));
+        fluid->setTemperature(fluid->computeTemperature(energy));
     } else {
-        fluid->setTemperature(mInData.mEnergy);
+        fluid->setTemperature(energy);
     }
 
     if (mInData.mTcMoleFractions) {
@@ -619,7 +637,7 @@ void GunnsFluidDistributedIf::processInputsSupply()
             ///   inputFluid function returns the fraction of the bulk fluid compunds in the total,
             ///   which is our adjustment.
             mDemandFlux = -mInData.mSource * UnitConversion::KILO_PER_UNIT
-                        * inputFluid(1.0, mInternalFluid);
+                        * inputFluid(1.0, mInData.mEnergy, mInternalFluid);
         }
     }
 }
@@ -631,9 +649,18 @@ void GunnsFluidDistributedIf::processInputsDemand()
 {
     if (mOutData.mDemandMode) {
         if (mInData.hasValidData() and not mInData.mDemandMode) {
+            /// - With the predictor option, extrapolate the incoming pressure & energy over the
+            ///   one-way data lag, taken as half of the last measured loop lag.
+            double pressure = mInData.mSource;
+            double energy   = mInData.mEnergy;
+            if (mPredictorOption) {
+                const double lagFrames = 0.5 * mLoopLatency;
+                pressure = mPressurePredictor.predict(mInData.mFrameCount, pressure, lagFrames);
+                energy   = mEnergyPredictor  .predict(mInData.mFrameCount, energy,   lagFrames);
+            }
             /// - Convert (Pa) to (kPa).
-            mSourcePressure = mInData.mSource * UnitConversion::KILO_PER_UNIT;
-            inputFluid(mSourcePressure, mNodes[0]->getContent());
+            mSourcePressure = pressure * UnitConversion::KILO_PER_UNIT;
+            inputFluid(mSourcePressure, energy, mNodes[0]->getContent());
             mFluidState.setState(mNodes[0]->getContent());
         } else {
             /// - When we are in Demand mode but have not yet received Supply data from the other
@@ -703,6 +730,8 @@ void GunnsFluidDistributedIf::flipToDemandMode()
         mSupplyVolume = mNodes[0]->getVolume();
         mCapacitorLink->editVolume(true, 0.0);
         mFramesSinceFlip = 0;
+        mPressurePredictor.reset();
+        mEnergyPredictor.reset();
         GUNNS_INFO("switched to Demand mode.")
     }
 }
@@ -719,6 +748,8 @@ void GunnsFluidDistributedIf::flipToSupplyMode()
         mCapacitorLink->editVolume(true, mSupplyVolume);
         mSupplyVolume = 0.0;
         mFramesSinceFlip = 0;
+        mPressurePredictor.reset();
+        mEnergyPredictor.reset();
         GUNNS_INFO("switched to Supply mode.")
     }
 }
@@ -30,6 +30,7 @@ PROGRAMMERS:
 @{
 */
 
+#include "GunnsDistributedIfPredictor.hh"
 #include "GunnsFluidLink.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include <vector>
@@ -111,6 +112,9 @@ class GunnsFluidDistributedIfConfigData : public GunnsFluidLinkConfigData
         bool                 mFluidSizesOverride;     /**< (--) trick_chkpnt_io(**) Override of fluid mixture sizes is active. */
         unsigned int         mNumFluidOverride;       /**< (--) trick_chkpnt_io(**) Number of primary fluid compounds override value. */
         unsigned int         mNumTcOverride;          /**< (--) trick_chkpnt_io(**) Number of trace compounds override value. */
+        bool                 mPredictorOption;        /**< (--) trick_chkpnt_io(**) Extrapolate incoming Supply state over the loop lag in Demand mode. */
+        double               mPredictorMaxHorizon;    /**< (--) trick_chkpnt_io(**) Maximum number of frames to extrapolate incoming Supply state ahead. */
+        double               mPredictorMaxFraction;   /**< (--) trick_chkpnt_io(**) Maximum extrapolated change as a fraction of the incoming Supply state. */
         /// @brief Default constructs this Fluid Distributed Interface configuration data.
         GunnsFluidDistributedIfConfigData(
                 const std::string&   name           = "",
@@ -195,6 +199,12 @@ class GunnsFluidDistributedIfInputData : public GunnsFluidLinkInputData
 ///
 ///           Note that in interfaces with a large conductance, such as hatches, this works best
 ///           with a minLinearizationPotential of 1e-8 or less.
+///
+///           With the predictor option, the Demand side extrapolates the incoming Supply pressure
+///           and energy over the measured loop lag, from their recent history, before applying
+///           them to the node (see GunnsDistributedIfPredictor).  The mole fractions and the Supply
+///           side's demanded flux are never extrapolated, so the mass that leaves the Supply side is
+///           still exactly what the Demand side took.
 ///           \verbatim
 ///
 ///              Master-Side Network                                          Slave-Side Network
@@ -267,6 +277,9 @@ class GunnsFluidDistributedIf : public GunnsFluidLink
         double*                     mTempTcMoleFractions;    /**< ** (--)       trick_chkpnt_io(**) Scratch array for trace compound mole fraction adjustments. */
         std::vector<GunnsFluidDistributedIf*> mOtherIfs;     /**< ** (--)       trick_chkpnt_io(**) Vector of other similar links to avoid capacitance interference with. */
         PolyFluid                   mFluidState;             /**<    (--)       trick_chkpnt_io(**) Fluid state of the interface volume, for sensors. */
+        bool                        mPredictorOption;        /**<    (--)       trick_chkpnt_io(**) Extrapolate incoming Supply state over the loop lag in Demand mode. */
+        GunnsDistributedIfPredictor mPressurePredictor;      /**<    (--)                           Predictor for the incoming Supply pressure. */
+        GunnsDistributedIfPredictor mEnergyPredictor;        /**<    (--)                           Predictor for the incoming Supply energy. */
         static const double         mNetworkCapacitanceFlux; /**< ** (kg*mol/s) trick_chkpnt_io(**) Flux value to use in network node capacitance calculations. */
         /// @brief Validates the initialization of this Gunns Fluid Distributed Interface.
         void validate() const;
@@ -285,7 +298,7 @@ class GunnsFluidDistributedIf : public GunnsFluidLink
         /// @brief Special processing of Demand mode data input.
         void processInputsDemand();
         /// @brief Copies incoming fluid state from the interface to the given fluid object.
-        double inputFluid(const double pressure, PolyFluid* fluid);
+        double inputFluid(const double pressure, const double energy, PolyFluid* fluid);
         /// @brief Copies the given fluid object state to the outgoing interface.
         double outputFluid(PolyFluid* fluid);
         /// @brief Handles several mode flip cases based on input data.
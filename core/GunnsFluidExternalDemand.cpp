@@ -165,6 +165,8 @@ GunnsFluidExternalDemand::GunnsFluidExternalDemand()
     mEstimatedCapacitance (0.0),
     mFilterCapacitanceGain(0.0),
     mSupplyCapacitance    (0.0),
+    mSupplyAdmittance     (0.0),
+    mSupplySource         (0.0),
     mSupplyPressure       (0.0),
     mSupplyTemperature    (0.0),
     mSupplyMassFractions  (0),
@@ -269,6 +271,8 @@ void GunnsFluidExternalDemand::initialize(const GunnsFluidExternalDemandConfigDa
     } else {
         mSupplyCapacitance = 0.0;
     }
+    mSupplyAdmittance  = 0.0;
+    mSupplySource      = 0.0;
     if (inputData.mSupplyTemperature > DBL_EPSILON) {
         mSupplyTemperature = inputData.mSupplyTemperature;
     } else {
@@ -346,8 +350,14 @@ void GunnsFluidExternalDemand::processInputs()
     }
 
     /// - If the link is fully blocked, it should isolate this network from the supply network.
+    ///   With a valid supply network Norton equivalent, the source pressure is the Norton
+    ///   equivalent pressure, otherwise it is the supply node pressure.
     if (mEffectiveConductivity > DBL_EPSILON) {
-        setSourcePressure(mSupplyPressure);
+        if (mSupplyAdmittance > DBL_EPSILON) {
+            setSourcePressure(mSupplySource / mSupplyAdmittance);
+        } else {
+            setSourcePressure(mSupplyPressure);
+        }
         try {
             GunnsFluidUtils::transformState(mNodes[1]->getContent(), mSupplyPressure,
                     mSupplyTemperature, mSupplyMassFractions, mTransformMap,
@@ -428,9 +438,11 @@ void GunnsFluidExternalDemand::updateState(const double dt)
     }
 
     /// - Filter our effective conductivity towards the supply capacitance when our demand is
-    ///   increasing:  G = C/dt.  Prefer the supply network's given capacitance over the internal
-    ///   estimated capacitance when it is available.
-    if (dt > DBL_EPSILON) {
+    ///   increasing:  G = C/dt.  Prefer the supply network's Norton admittance, then its given
+    ///   capacitance, over the internal estimated capacitance when they are available.
+    if (mSupplyAdmittance > DBL_EPSILON) {
+        mEffectiveConductivity = mSupplyAdmittance;
+    } else if (dt > DBL_EPSILON) {
         if (mSupplyCapacitance > DBL_EPSILON) {
             mEffectiveConductivity = mSupplyCapacitance / dt;
         } else {
@@ -133,6 +133,12 @@ class GunnsFluidExternalDemandInputData : public GunnsFluidPotentialInputData
 ///
 ///                                                 |
 ///           \endverbatim
+///
+///           When the supply link outputs a valid Norton equivalent of the supply network at its
+///           node, this link uses the Norton admittance as its conductance and the Norton source
+///           over admittance as its source pressure, so the flux into the demand node responds to
+///           the supply network's actual admittance.  Otherwise it falls back to conductance from
+///           the supply network capacitance, or its own estimate of it.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsFluidExternalDemand : public GunnsFluidPotential
 {
@@ -171,6 +177,8 @@ class GunnsFluidExternalDemand : public GunnsFluidPotential
         double  mEstimatedCapacitance;  /**<    (kg*mol/kPa)                     Estimate of supply effective capacitance */
         double  mFilterCapacitanceGain; /**<    (--)         trick_chkpnt_io(**) Gain for estimated capacitance filter (0-1) */
         double  mSupplyCapacitance;     /**<    (kg*mol/kPa)                     Supply network capacitance input from sim bus */
+        double  mSupplyAdmittance;      /**<    (kg*mol/kPa/s)                   Supply network Norton admittance input from sim bus */
+        double  mSupplySource;          /**<    (kg*mol/s)                       Supply network Norton source input from sim bus */
         double  mSupplyPressure;        /**<    (kPa)                            Supply pressure input from sim bus */
         double  mSupplyTemperature;     /**<    (K)                              Supply temperature input from sim bus */
         double* mSupplyMassFractions;   /**<    (--)         trick_chkpnt_io(**) Supply mass fractions input from sim bus */
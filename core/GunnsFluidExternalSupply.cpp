@@ -20,6 +20,7 @@ ASSUMPTIONS AND LIMITATIONS:
 LIBRARY DEPENDENCY:
    (
     (GunnsFluidSource.o)
+    (GunnsPortReduction.o)
    )
 
  PROGRAMMERS:
@@ -141,9 +142,12 @@ GunnsFluidExternalSupplyInputData::~GunnsFluidExternalSupplyInputData()
 GunnsFluidExternalSupply::GunnsFluidExternalSupply()
     :
     GunnsFluidSource      (),
+    mReduction            (),
     mUseNetworkCapacitance(0.0),
     mTransformMap         (0),
     mSupplyCapacitance    (0.0),
+    mSupplyAdmittance     (0.0),
+    mSupplySource         (0.0),
     mSupplyPressure       (0.0),
     mSupplyTemperature    (0.0),
     mSupplyMassFractions  (0),
@@ -222,8 +226,13 @@ void GunnsFluidExternalSupply::initialize(const GunnsFluidExternalSupplyConfigDa
         mSupplyTcMoleFractions = mNodes[0]->getContent()->getTraceCompounds()->getMoleFractions();
     }
 
+    /// - Initialize the port reduction on the supply node.
+    mReduction.initialize(mName + ".mReduction", 1, mNodeMap);
+
     /// - Initialize the output supply terms.
     mSupplyCapacitance = 0.0;
+    mSupplyAdmittance  = 0.0;
+    mSupplySource      = 0.0;
     mSupplyPressure    = mNodes[0]->getContent()->getPressure();
     mSupplyTemperature = mNodes[0]->getContent()->getTemperature();
     for (int i=0; i<mNodes[0]->getFluidConfig()->mNTypes; ++i) {
@@ -312,11 +321,21 @@ void GunnsFluidExternalSupply::processInputs()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Handles data written to the external network's demand link, via the simbus.  Data is
-///          moved from the supply node's content into the storage terms for output to simbus.
+///          moved from the supply node's content into the storage terms for output to simbus.  The
+///          supply network's Norton equivalent is output when the port reduction is valid on this
+///          pass, otherwise zero admittance is output so the demand link falls back to coupling by
+///          capacitance.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidExternalSupply::processOutputs()
 {
     mSupplyCapacitance = mNodes[0]->getNetworkCapacitance();
+    if (mReduction.isValid()) {
+        mSupplyAdmittance = mReduction.getAdmittance()[0];
+        mSupplySource     = mReduction.getSource()[0];
+    } else {
+        mSupplyAdmittance = 0.0;
+        mSupplySource     = 0.0;
+    }
     mSupplyPressure    = mNodes[0]->getPotential();
     mSupplyTemperature = mNodes[0]->getContent()->getTemperature();
     for (int i = 0; i < mInternalFluid->getNConstituents(); ++i) {
@@ -368,8 +387,10 @@ void GunnsFluidExternalSupply::step(const double dt __attribute__((unused)))
         mFlux     = 0.0;
     }
 
-    /// - Build the system source vector.
+    /// - Build the system source vector.  The demand flux is excluded from the supply network's
+    ///   equivalent, since the demand link models it.
     buildSource();
+    mReduction.setExcludedContributions(0, mSourceVector);
 
     /// - Flag the node to have its network capacitance calculated by the solver for output to
     ///   external demands.
@@ -31,6 +31,7 @@ PROGRAMMERS:
 */
 
 #include "GunnsFluidSource.hh"
+#include "GunnsPortReduction.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,12 +126,21 @@ class GunnsFluidExternalSupplyInputData : public GunnsFluidSourceInputData
 ///
 ///                                                 |
 ///           \endverbatim
+///
+///           This link also owns a single-port GunnsPortReduction on the supply node, which can be
+///           registered with the supply network with Gunns::addPortReduction.  When registered,
+///           the supply network's Norton equivalent at the supply node (admittance & source, less
+///           this link's own demand flux) is output to the demand link, so it can couple to the
+///           supply network through its actual admittance rather than a lagged capacitance
+///           estimate.  Multi-port coupling between the same two networks is not supported by this
+///           link pair; use GunnsBasicReducedIf for that.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsFluidExternalSupply : public GunnsFluidSource
 {
     TS_MAKE_SIM_COMPATIBLE(GunnsFluidExternalSupply);
 
     public:
+        GunnsPortReduction mReduction; /**< (--) Supply network equivalent at the supply node. */
         /// @brief Default Constructor
         GunnsFluidExternalSupply();
 
@@ -160,6 +170,8 @@ class GunnsFluidExternalSupply : public GunnsFluidSource
         bool    mUseNetworkCapacitance; /**<    (--)         trick_chkpnt_io(**) Causes mSupplyCapacitance to be available for external demands */
         int*    mTransformMap;          /**< ** (--)         trick_chkpnt_io(**) Map to convert the external fluid to this config */
         double  mSupplyCapacitance;     /**<    (kg*mol/kPa)                     Local network effective capacitance output to sim bus */
+        double  mSupplyAdmittance;      /**<    (kg*mol/kPa/s)                   Supply network Norton admittance output to sim bus */
+        double  mSupplySource;          /**<    (kg*mol/s)                       Supply network Norton source output to sim bus */
         double  mSupplyPressure;        /**<    (kPa)                            Supply pressure output to sim bus */
         double  mSupplyTemperature;     /**<    (K)                              Supply temperature output to sim bus */
         double* mSupplyMassFractions;   /**<    (--)         trick_chkpnt_io(**) Supply mass fractions output to sim bus */
@@ -66,7 +66,8 @@ GunnsFluidFlowIntegrator::GunnsFluidFlowIntegrator(const GunnsFluidLink& link)
     mNumFluidConstituents    (0),
     mMassFractionsPort0      (0),
     mMassFractionsPort1      (0),
-    mIntegratedMasses        (0)
+    mIntegratedMasses        (0),
+    mIntegrationErrors       (0)
 {
     // nothing to do
 }
@@ -84,6 +85,7 @@ GunnsFluidFlowIntegrator::~GunnsFluidFlowIntegrator()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidFlowIntegrator::cleanup()
 {
+    TS_DELETE_ARRAY(mIntegrationErrors);
     TS_DELETE_ARRAY(mIntegratedMasses);
     TS_DELETE_ARRAY(mMassFractionsPort1);
     TS_DELETE_ARRAY(mMassFractionsPort0);
@@ -115,12 +117,14 @@ void GunnsFluidFlowIntegrator::initialize(const GunnsNetworkSpotterConfigData* c
     TS_NEW_PRIM_ARRAY_EXT(mMassFractionsPort0,      mNumFluidConstituents, double, configData->mName + ".mMassFractionsPort0");
     TS_NEW_PRIM_ARRAY_EXT(mMassFractionsPort1,      mNumFluidConstituents, double, configData->mName + ".mMassFractionsPort1");
     TS_NEW_PRIM_ARRAY_EXT(mIntegratedMasses,        mNumFluidConstituents, double, configData->mName + ".mIntegratedMasses");
+    TS_NEW_PRIM_ARRAY_EXT(mIntegrationErrors,       mNumFluidConstituents, double, configData->mName + ".mIntegrationErrors");
 
     // Initialize the arrays out to keep Valgrind happy.
     for (int fluidIndex = 0; fluidIndex < mNumFluidConstituents; ++fluidIndex) {
         mMassFractionsPort0[fluidIndex] = 0.0;
         mMassFractionsPort1[fluidIndex] = 0.0;
         mIntegratedMasses[fluidIndex] = 0.0;
+        mIntegrationErrors[fluidIndex] = 0.0;
     }
 
     /// - Set the init flag.
@@ -211,11 +215,17 @@ void GunnsFluidFlowIntegrator::collectMassFractions()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Helper method to assign the mass fractions that are used in the integration of the
-///          flow rate. Called in the stepPostSolver method.
+///          flow rate. Called in the stepPostSolver method.  The masses are accumulated with Kahan
+///          compensated summation: the round-off lost from each addition is kept in
+///          mIntegrationErrors and fed back into the next one.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidFlowIntegrator::performIntegration(double* fractionsToUse, double flowRate, double dt)
 {
+    const double mass = flowRate * dt;
     for(int fluidIndex = 0; fluidIndex < mNumFluidConstituents; fluidIndex++){
-        mIntegratedMasses[fluidIndex] += fractionsToUse[fluidIndex] * flowRate * dt;
+        const double increment = fractionsToUse[fluidIndex] * mass - mIntegrationErrors[fluidIndex];
+        const double total     = mIntegratedMasses[fluidIndex] + increment;
+        mIntegrationErrors[fluidIndex] = (total - mIntegratedMasses[fluidIndex]) - increment;
+        mIntegratedMasses[fluidIndex]  = total;
     }
 }
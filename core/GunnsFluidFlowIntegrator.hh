@@ -86,6 +86,9 @@ class GunnsFluidLink;
 /// @details  This spotter is used to integrate flows through a link within a GUNNS network. It
 ///           can be useful for finding total mass flown through a given link.
 ///
+///           The masses are accumulated with compensated (Kahan) summation, so that the totals don't
+///           lose the small per-step increments to round-off over long runs.
+///
 /// @note     This should only be used on links that meet these criteria:
 ///           - they do not change the mixture of the fluid passing through it,
 ///           - they update their mFlowRate as positive values flowing from their port 0 to port 1.
@@ -116,6 +119,7 @@ class GunnsFluidFlowIntegrator : public GunnsNetworkSpotter
         double*  mMassFractionsPort1;        /**< *o (--) trick_chkpnt_io(**) Mass fractions of the fluid at port one. */
         double*  mIntegratedMasses;          /**< *o (--) trick_chkpnt_io(**) Accumulated masses that have flown through the link. This is flow rate
                                                                               sign sensitive. Flow rate is positive from port 0 to 1. */
+        double*  mIntegrationErrors;         /**< *o (--) trick_chkpnt_io(**) Compensation terms for the round-off error of the accumulated masses. */
 
         /// @brief   Validates the supplied configuration data.
         const GunnsFluidFlowIntegratorConfigData* validateConfig(const GunnsNetworkSpotterConfigData* config);
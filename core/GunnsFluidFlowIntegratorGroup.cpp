@@ -0,0 +1,305 @@
+/**
+@file
+@brief     GUNNS Fluid Flow Integrator Group Spotter implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((GunnsNetworkSpotter.o)
+   (core/GunnsFluidLink.o)
+   (simulation/hs/TsHsMsg.o)
+   (software/exceptions/TsInitializationException.o))
+*/
+
+#include "GunnsFluidFlowIntegratorGroup.hh"
+#include "GunnsFluidLink.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Instance name for self-identification in messages.
+///
+/// @details  Default constructs this GUNNS Fluid Flow Integrator Group Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidFlowIntegratorGroupConfigData::GunnsFluidFlowIntegratorGroupConfigData(const std::string& name)
+    :
+    GunnsNetworkSpotterConfigData(name)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Flow Integrator Group Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidFlowIntegratorGroupConfigData::~GunnsFluidFlowIntegratorGroupConfigData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Fluid Flow Integrator Group Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidFlowIntegratorGroupInputData::GunnsFluidFlowIntegratorGroupInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Flow Integrator Group Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidFlowIntegratorGroupInputData::~GunnsFluidFlowIntegratorGroupInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Default constructs this GUNNS Fluid Flow Integrator Group Spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidFlowIntegratorGroup::GunnsFluidFlowIntegratorGroup()
+    :
+    GunnsNetworkSpotter  (),
+    mLinks               (),
+    mNodeContents        (),
+    mNumFluidConstituents(0),
+    mPortNodes           (0),
+    mMassFractions       (0),
+    mIntegratedMasses    (0),
+    mIntegrationErrors   (0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Flow Integrator Group Spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidFlowIntegratorGroup::~GunnsFluidFlowIntegratorGroup()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes allocated memory objects
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowIntegratorGroup::cleanup()
+{
+    TS_DELETE_ARRAY(mIntegrationErrors);
+    TS_DELETE_ARRAY(mIntegratedMasses);
+    TS_DELETE_ARRAY(mMassFractions);
+    TS_DELETE_ARRAY(mPortNodes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  link  (--)  The link to register with this group.
+///
+/// @details  Adds the given link to this group, unless it is already registered.  This must be
+///           called before this group is initialized.  Links are indexed in the order registered.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowIntegratorGroup::addLink(const GunnsFluidLink& link)
+{
+    for (unsigned int i = 0; i < mLinks.size(); ++i) {
+        if (&link == mLinks[i]) {
+            return;
+        }
+    }
+    mLinks.push_back(&link);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+/// @param[in]  inputData   (--)  Instance input data.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Fluid Flow Integrator Group Spotter with its configuration and
+///           input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowIntegratorGroup::initialize(const GunnsNetworkSpotterConfigData* configData,
+                                               const GunnsNetworkSpotterInputData*  inputData)
+{
+    /// - Initialize the base class.
+    GunnsNetworkSpotter::initialize(configData, inputData);
+
+    /// - Reset the init flag.
+    mInitFlag = false;
+
+    /// - Validate config & input data.
+    validateConfig(configData);
+    validateInput(inputData);
+
+    /// - Throw an exception if there are no links, or any aren't initialized, have less than two
+    ///   ports or don't match the number of fluid constituents of the first.
+    if (mLinks.empty()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "no links have been added.");
+    }
+    for (unsigned int i = 0; i < mLinks.size(); ++i) {
+        if (not mLinks[i]->isInitialized()) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "a link is not initialized.");
+        }
+        if (mLinks[i]->getNumberPorts() < 2) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "a link has less than 2 ports.");
+        }
+    }
+    mNumFluidConstituents = mLinks[0]->getNodeContent(0)->getNConstituents();
+    for (unsigned int i = 0; i < mLinks.size(); ++i) {
+        if (mNumFluidConstituents != mLinks[i]->getNodeContent(0)->getNConstituents()) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "links have different numbers of fluid constituents.");
+        }
+    }
+
+    /// - Allocate dynamic memory.  The node arrays are sized for the most nodes the links can
+    ///   attach to, so they needn't be resized when links move to other nodes.
+    cleanup();
+    const int numLinks = getNumLinks();
+    const int size     = numLinks * mNumFluidConstituents;
+    TS_NEW_PRIM_ARRAY_EXT(mPortNodes,         2 * numLinks, int,    mName + ".mPortNodes");
+    TS_NEW_PRIM_ARRAY_EXT(mMassFractions,     2 * size,     double, mName + ".mMassFractions");
+    TS_NEW_PRIM_ARRAY_EXT(mIntegratedMasses,  size,         double, mName + ".mIntegratedMasses");
+    TS_NEW_PRIM_ARRAY_EXT(mIntegrationErrors, size,         double, mName + ".mIntegrationErrors");
+    for (int i = 0; i < 2 * size; ++i) {
+        mMassFractions[i] = 0.0;
+    }
+    resetIntegration();
+    mapPortNodes();
+
+    /// - Set the init flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+///
+/// @returns  GunnsFluidFlowIntegratorGroupConfigData (--) Type-casted and validated config data
+///                                                        pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base config data class pointer to this spotter's config data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsFluidFlowIntegratorGroupConfigData* GunnsFluidFlowIntegratorGroup::validateConfig(
+        const GunnsNetworkSpotterConfigData* config)
+{
+    const GunnsFluidFlowIntegratorGroupConfigData* result =
+            dynamic_cast<const GunnsFluidFlowIntegratorGroupConfigData*>(config);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "Bad config data pointer type.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  inputData  (--)  Instance input data.
+///
+/// @returns  GunnsFluidFlowIntegratorGroupInputData (--) Type-casted and validated input data
+///                                                       pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base input data class pointer to this spotter's input data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsFluidFlowIntegratorGroupInputData* GunnsFluidFlowIntegratorGroup::validateInput(
+        const GunnsNetworkSpotterInputData* input)
+{
+    const GunnsFluidFlowIntegratorGroupInputData* result =
+            dynamic_cast<const GunnsFluidFlowIntegratorGroupInputData*>(input);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
+                    "Bad input data pointer type.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Finds the distinct node contents attached to the ports 0 and 1 of all links, and maps
+///           each link port to its node's index in mNodeContents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowIntegratorGroup::mapPortNodes()
+{
+    mNodeContents.clear();
+    const int numLinks = getNumLinks();
+    for (int i = 0; i < 2 * numLinks; ++i) {
+        const PolyFluid* content = mLinks[i / 2]->getNodeContent(i % 2);
+        int node = 0;
+        const int numNodes = static_cast<int>(mNodeContents.size());
+        while (node < numNodes and content != mNodeContents[node]) {
+            ++node;
+        }
+        if (node == numNodes) {
+            mNodeContents.push_back(content);
+        }
+        mPortNodes[i] = node;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step (not used).
+///
+/// @details  Stores the mass fractions of the nodes attached to the links for integrating
+///           post-solution.  Like GunnsFluidFlowIntegrator, we integrate based on the supplying
+///           node's contents, and we must store both port's nodes because we don't yet know which
+///           direction each link will flow.  If any link has moved to a different node since the
+///           last step, the link ports are mapped to the nodes again first.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowIntegratorGroup::stepPreSolver(const double dt __attribute__((unused)))
+{
+    const int numLinks = getNumLinks();
+    for (int i = 0; i < 2 * numLinks; ++i) {
+        if (mLinks[i / 2]->getNodeContent(i % 2) != mNodeContents[mPortNodes[i]]) {
+            mapPortNodes();
+            break;
+        }
+    }
+
+    const int numNodes = static_cast<int>(mNodeContents.size());
+    for (int node = 0; node < numNodes; ++node) {
+        const PolyFluid* content   = mNodeContents[node];
+        double*          fractions = &mMassFractions[node * mNumFluidConstituents];
+        for (int k = 0; k < mNumFluidConstituents; ++k) {
+            fractions[k] = content->getMassFraction(k);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step.
+///
+/// @details  Integrates the constituent masses flowed through all links in one pass.  Each link's
+///           flowed mass is split by the mass fractions of its port 0 node for positive flow, or
+///           its port 1 node otherwise, and added to its totals with Kahan compensated summation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowIntegratorGroup::stepPostSolver(const double dt)
+{
+    const int numLinks = getNumLinks();
+    for (int link = 0; link < numLinks; ++link) {
+        const double  flowRate  = mLinks[link]->getFlowRate();
+        const double  mass      = flowRate * dt;
+        const int     node      = mPortNodes[2 * link + ((flowRate > 0.0) ? 0 : 1)];
+        const double* fractions = &mMassFractions[node * mNumFluidConstituents];
+        double*       totals    = &mIntegratedMasses[link * mNumFluidConstituents];
+        double*       errors    = &mIntegrationErrors[link * mNumFluidConstituents];
+        for (int k = 0; k < mNumFluidConstituents; ++k) {
+            const double increment = fractions[k] * mass - errors[k];
+            const double total     = totals[k] + increment;
+            errors[k] = (total - totals[k]) - increment;
+            totals[k] = total;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Zeroes the integrated masses and their compensation terms for all links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowIntegratorGroup::resetIntegration()
+{
+    const int size = getNumLinks() * mNumFluidConstituents;
+    for (int i = 0; i < size; ++i) {
+        mIntegratedMasses[i]  = 0.0;
+        mIntegrationErrors[i] = 0.0;
+    }
+}
@@ -0,0 +1,180 @@
+#ifndef GunnsFluidFlowIntegratorGroup_EXISTS
+#define GunnsFluidFlowIntegratorGroup_EXISTS
+
+/**
+@file
+@brief     GUNNS Fluid Flow Integrator Group Spotter declarations
+
+@defgroup  TSM_GUNNS_CORE_FLUID_FLOW_INTEGRATOR_GROUP   GUNNS Fluid Flow Integrator Group Spotter
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:  (Provides the classes for the GUNNS Fluid Flow Integrator Group Spotter.  This spotter
+           integrates the constituent masses flowed through a registered set of links together in
+           one batch, such as for monitoring consumables usage over many links.)
+
+@details
+REFERENCE:
+- (Kahan, W., "Further Remarks on Reducing Truncation Errors", Communications of the ACM, 8(1),
+   1965.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (All registered links must be in networks with the same number of fluid constituents.)
+- (Links must be registered and initialized before this group is initialized.)
+- (The same limitations on the links apply as for GunnsFluidFlowIntegrator.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsFluidFlowIntegratorGroup.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "GunnsNetworkSpotter.hh"
+#include <vector>
+
+class GunnsFluidLink;
+class PolyFluid;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Flow Integrator Group Spotter Configuration Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the GUNNS Fluid
+///           Flow Integrator Group Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidFlowIntegratorGroupConfigData : public GunnsNetworkSpotterConfigData
+{
+    public:
+        /// @brief  Default constructs this GUNNS Fluid Flow Integrator Group Spotter configuration data.
+        GunnsFluidFlowIntegratorGroupConfigData(const std::string& name);
+        /// @brief  Default destructs this GUNNS Fluid Flow Integrator Group Spotter configuration data.
+        virtual ~GunnsFluidFlowIntegratorGroupConfigData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidFlowIntegratorGroupConfigData(const GunnsFluidFlowIntegratorGroupConfigData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidFlowIntegratorGroupConfigData& operator =(const GunnsFluidFlowIntegratorGroupConfigData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Flow Integrator Group Spotter Input Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the GUNNS Fluid
+///           Flow Integrator Group Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidFlowIntegratorGroupInputData : public GunnsNetworkSpotterInputData
+{
+    public:
+        /// @brief  Default constructs this GUNNS Fluid Flow Integrator Group Spotter input data.
+        GunnsFluidFlowIntegratorGroupInputData();
+        /// @brief  Default destructs this GUNNS Fluid Flow Integrator Group Spotter input data.
+        virtual ~GunnsFluidFlowIntegratorGroupInputData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidFlowIntegratorGroupInputData(const GunnsFluidFlowIntegratorGroupInputData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidFlowIntegratorGroupInputData& operator =(const GunnsFluidFlowIntegratorGroupInputData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Flow Integrator Group Spotter Class.
+///
+/// @details  This spotter does the same job as a GunnsFluidFlowIntegrator for each of a set of
+///           links, but with all of the links' data in flat arrays so each step is a few tight
+///           loops rather than a spotter call per link.  Links are registered with addLink before
+///           initialization.
+///
+///           Before the solver, the mass fractions of the nodes attached to the links are gathered
+///           into one array.  Nodes are gathered once each no matter how many registered links
+///           attach to them, and links map their ports to the gathered nodes.  After the solver,
+///           each link's flowed mass is split by the mass fractions of its upstream node and added
+///           to its per-constituent totals, for all links in one pass.
+///
+///           The totals are accumulated with Kahan compensated summation, which keeps the
+///           round-off lost from each addition and feeds it back into the next one.  For long runs
+///           where the totals grow much larger than the per-step increments, this keeps the totals
+///           from drifting the way a plain sum does.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidFlowIntegratorGroup : public GunnsNetworkSpotter
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidFlowIntegratorGroup);
+    public:
+        /// @brief   Default Constructor
+        GunnsFluidFlowIntegratorGroup();
+        /// @brief   Default destructor.
+        virtual     ~GunnsFluidFlowIntegratorGroup();
+        /// @brief   Registers a link with this group.
+        void         addLink(const GunnsFluidLink& link);
+        /// @brief   Initializes the GUNNS Fluid Flow Integrator Group Spotter with configuration and
+        ///          input data.
+        virtual void initialize(const GunnsNetworkSpotterConfigData* configData,
+                                const GunnsNetworkSpotterInputData*  inputData);
+        /// @brief   Steps the GUNNS Fluid Flow Integrator Group Spotter prior to the GUNNS solver step.
+        virtual void stepPreSolver(const double dt);
+        /// @brief   Steps the GUNNS Fluid Flow Integrator Group Spotter after the GUNNS solver step.
+        virtual void stepPostSolver(const double dt);
+        /// @brief   Zeroes the integrated masses of all links.
+        void         resetIntegration();
+        /// @brief   Returns the number of registered links.
+        int          getNumLinks() const;
+        /// @brief   Gets the integrated mass of the specified constituent index through the specified link.
+        double       getIntegratedMass(const int link, const int index) const;
+
+    protected:
+        std::vector<const GunnsFluidLink*> mLinks;   /**< ** (--)  trick_chkpnt_io(**) Registered links. */
+        std::vector<const PolyFluid*> mNodeContents; /**< ** (--)  trick_chkpnt_io(**) Distinct contents of the nodes attached to the links. */
+        int      mNumFluidConstituents;              /**< *o (--)  trick_chkpnt_io(**) Number of fluid constituents in the networks. */
+        int*     mPortNodes;                         /**< *o (--)  trick_chkpnt_io(**) Index in mNodeContents of each link's port 0 and 1 nodes, by link then port. */
+        double*  mMassFractions;                     /**< *o (--)  trick_chkpnt_io(**) Gathered mass fractions of the nodes, by node then constituent. */
+        double*  mIntegratedMasses;                  /**< *o (kg)  trick_chkpnt_io(**) Accumulated masses that have flown through the links, by link then constituent.  Positive from port 0 to 1. */
+        double*  mIntegrationErrors;                 /**< *o (kg)  trick_chkpnt_io(**) Compensation terms for the round-off error of the accumulated masses. */
+        /// @brief   Validates the supplied configuration data.
+        const GunnsFluidFlowIntegratorGroupConfigData* validateConfig(const GunnsNetworkSpotterConfigData* config);
+        /// @brief   Validates the supplied input data.
+        const GunnsFluidFlowIntegratorGroupInputData*  validateInput (const GunnsNetworkSpotterInputData* input);
+        /// @brief   Maps the links' ports to the distinct node contents and sizes the node arrays.
+        void         mapPortNodes();
+
+    private:
+        /// @brief   Deletes dynamic memory.
+        void         cleanup();
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidFlowIntegratorGroup(const GunnsFluidFlowIntegratorGroup& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidFlowIntegratorGroup& operator =(const GunnsFluidFlowIntegratorGroup& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of registered links.
+///
+/// @details  Returns the number of links registered with this group.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsFluidFlowIntegratorGroup::getNumLinks() const
+{
+    return static_cast<int>(mLinks.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  link   (--)  Index of the link in the order registered.
+/// @param[in]  index  (--)  Index of the fluid constituent to get the mass of.
+///
+/// @returns  double  (kg)  Integrated mass of the specified constituent flowed through the link.
+///
+/// @details  Returns the total mass of the specified fluid constituent that has flowed through the
+///           specified link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsFluidFlowIntegratorGroup::getIntegratedMass(const int link, const int index) const
+{
+    return mIntegratedMasses[link * mNumFluidConstituents + index];
+}
+
+#endif
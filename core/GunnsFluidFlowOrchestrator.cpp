@@ -100,7 +100,9 @@ void GunnsFluidFlowOrchestrator::update(const double dt)
     ///   flow directions relative to the nodes, and schedule outflows with their source nodes.
     /// - Initially flag all links as incomplete.
     for (int link = 0; link < mNumLinks; ++link) {
+        const uint64_t start = startProfile();
         mLinks[link]->computeFlows(dt);
+        stopProfile(link, GunnsLinkProfiler::COMPUTE_FLOWS, start);
         mLinkStates[link] = false;
     }
     mNumIncompleteLinks = mNumLinks;
@@ -128,7 +130,9 @@ void GunnsFluidFlowOrchestrator::update(const double dt)
             ///   non-overflowing.
             for (int link = 0; link < mNumLinks; ++link) {
                 if (not mLinkStates[link] and linkSourceNodesReady(link)) {
+                    const uint64_t start = startProfile();
                     mLinks[link]->transportFlows(dt);
+                    stopProfile(link, GunnsLinkProfiler::TRANSPORT_FLOWS, start);
                     mLinkStates[link] = true;
                     if (mVerbose) printf("Link %s complete\n", mLinks[link]->getName());
                 }
@@ -186,7 +190,9 @@ bool GunnsFluidFlowOrchestrator::checkAllComplete(const double dt)
     ///   whatever reason there are some nodes that are stuck not completing.
     if (incompleteLinks >= mNumIncompleteLinks) {
         const unsigned int link = getFirstIncompleteLink();
+        const uint64_t start = startProfile();
         mLinks[link]->transportFlows(dt);
+        stopProfile(link, GunnsLinkProfiler::TRANSPORT_FLOWS, start);
         mLinkStates[link] = true;
         GUNNS_WARNING("early overflow transport in link " << mLinks[link]->getName() <<
                       ", conservation errors may result.");
@@ -0,0 +1,363 @@
+/**
+@file
+@brief     GUNNS Fluid Implicit Flow Orchestrator implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((core/GunnsBasicFlowOrchestrator.o)
+   (core/GunnsBasicLink.o)
+   (core/GunnsFluidLink.o)
+   (core/GunnsFluidNode.o)
+   (software/exceptions/TsInitializationException.o))
+*/
+
+#include "GunnsFluidImplicitFlowOrchestrator.hh"
+#include "core/GunnsBasicLink.hh"
+#include "core/GunnsFluidLink.hh"
+#include "core/GunnsFluidNode.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  numLinks  (--)  The number of links in the network.
+/// @param[in]  numNodes  (--)  The number of nodes in the network, including the Ground node.
+///
+/// @details  Default constructs this GUNNS Fluid Implicit Flow Orchestrator.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidImplicitFlowOrchestrator::GunnsFluidImplicitFlowOrchestrator(const int& numLinks,
+                                                                       const int& numNodes)
+    :
+    GunnsBasicFlowOrchestrator(numLinks, numNodes),
+    mFluidNodes(0),
+    mNumFluidTypes(0),
+    mSize(0),
+    mMatrix(0),
+    mSource(0),
+    mMoles(0),
+    mMoleFractions(0),
+    mMolarEnthalpy(0),
+    mMWeights(0),
+    mBoundaryInflows(0),
+    mNumImplicitLinks(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Implicit Flow Orchestrator.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidImplicitFlowOrchestrator::~GunnsFluidImplicitFlowOrchestrator()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes dynamic memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::cleanup()
+{
+    delete [] mBoundaryInflows;
+    mBoundaryInflows = 0;
+    delete [] mMWeights;
+    mMWeights = 0;
+    delete [] mMolarEnthalpy;
+    mMolarEnthalpy = 0;
+    delete [] mMoleFractions;
+    mMoleFractions = 0;
+    delete [] mMoles;
+    mMoles = 0;
+    delete [] mSource;
+    mSource = 0;
+    delete [] mMatrix;
+    mMatrix = 0;
+    delete [] mFluidNodes;
+    mFluidNodes = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name   (--)  Instance name for messages.
+/// @param[in]  links  (--)  Pointer to the network links.
+/// @param[in]  nodes  (--)  Pointer to the network nodes.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this Fluid Implicit Flow Orchestrator.  All nodes must be fluid nodes, with
+///           initialized contents, and all links must be fluid links with two ports.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::initialize(const std::string& name, GunnsBasicLink** links,
+                                                    GunnsBasicNode** nodes)
+{
+    /// - Initialize the base class.
+    GunnsBasicFlowOrchestrator::initialize(name, links, nodes);
+
+    /// - Reset the initialization complete flag.
+    mInitFlag = false;
+
+    /// - Throw on any node that isn't a fluid node.  Only fluid nodes have content.
+    for (int node = 0; node < mNumNodes; ++node) {
+        if (not mNodes[node]->getContent()) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "network nodes are not fluid nodes.");
+        }
+    }
+
+    /// - Throw on any link that isn't a fluid link, or doesn't have two ports.  Other links don't
+    ///   tell us how their flux divides among their ports, so their flows can't be included in the
+    ///   implicit solution.
+    for (int link = 0; link < mNumLinks; ++link) {
+        if (not dynamic_cast<GunnsFluidLink*>(mLinks[link])) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "network links are not fluid links.");
+        }
+        if (2 != mLinks[link]->getNumberPorts()) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "network has a link that doesn't have two ports.");
+        }
+    }
+
+    /// - Allocate arrays and initialize state.
+    cleanup();
+    mSize          = mNumNodes - 1;
+    mNumFluidTypes = mNodes[0]->getContent()->getNConstituents();
+    mFluidNodes    = new GunnsFluidNode*[mNumNodes];
+    for (int node = 0; node < mNumNodes; ++node) {
+        mFluidNodes[node] = static_cast<GunnsFluidNode*>(mNodes[node]);
+    }
+    mMatrix        = new double[mSize * mSize];
+    mSource        = new double[mSize];
+    mMoles         = new double[mSize];
+    mMoleFractions = new double[mSize * mNumFluidTypes];
+    mMolarEnthalpy = new double[mSize];
+    mMWeights      = new double[mNumFluidTypes];
+    mBoundaryInflows = new double[mSize * (mNumFluidTypes + 1)];
+    for (int i = 0; i < mSize * mSize; ++i) {
+        mMatrix[i] = 0.0;
+    }
+    for (int i = 0; i < mSize; ++i) {
+        mSource[i]        = 0.0;
+        mMoles[i]         = 0.0;
+        mMolarEnthalpy[i] = 0.0;
+    }
+    for (int i = 0; i < mSize * mNumFluidTypes; ++i) {
+        mMoleFractions[i] = 0.0;
+    }
+    for (int i = 0; i < mSize * (mNumFluidTypes + 1); ++i) {
+        mBoundaryInflows[i] = 0.0;
+    }
+    const PolyFluid* fluid = mNodes[0]->getContent();
+    for (int k = 0; k < mNumFluidTypes; ++k) {
+        mMWeights[k] = fluid->getProperties(fluid->getType(k))->getMWeight();
+    }
+    mNumImplicitLinks = 0;
+
+    /// - Set the initialization complete flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Integration time step.
+///
+/// @details  See the class details.  The links compute their flows and schedule outflows with their
+///           source nodes, then the implicit transport system is built from these flows and the node
+///           contents, and solved for the new node mole fractions and molar enthalpy.  These become
+///           the node outflow states.  Since the outflow states are then all known, the links
+///           transport and the nodes integrate without any sequencing.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::update(const double dt)
+{
+    for (int link = 0; link < mNumLinks; ++link) {
+        const uint64_t start = startProfile();
+        mLinks[link]->computeFlows(dt);
+        stopProfile(link, GunnsLinkProfiler::COMPUTE_FLOWS, start);
+    }
+
+    /// - Decompose the transport system once, then solve it for each constituent's moles and for
+    ///   the enthalpy.  Known inflows from the Ground node add to the source vector.
+    buildSystem(dt);
+    decompose();
+    const int stride = mNumFluidTypes + 1;
+    for (int k = 0; k < mNumFluidTypes; ++k) {
+        for (int i = 0; i < mSize; ++i) {
+            mSource[i] = mMoles[i] * mFluidNodes[i]->getContent()->getMoleFraction(k)
+                       + mBoundaryInflows[i * stride + k];
+        }
+        solve(mSource);
+        for (int i = 0; i < mSize; ++i) {
+            mMoleFractions[i * mNumFluidTypes + k] = mSource[i];
+        }
+    }
+    for (int i = 0; i < mSize; ++i) {
+        const PolyFluid* content = mFluidNodes[i]->getContent();
+        mSource[i] = mMoles[i] * content->getSpecificEnthalpy() * content->getMWeight()
+                   + mBoundaryInflows[i * stride + mNumFluidTypes];
+    }
+    solve(mSource);
+    for (int i = 0; i < mSize; ++i) {
+        mMolarEnthalpy[i] = mSource[i];
+    }
+    setNodeOutflows();
+
+    for (int link = 0; link < mNumLinks; ++link) {
+        const uint64_t start = startProfile();
+        mLinks[link]->transportFlows(dt);
+        stopProfile(link, GunnsLinkProfiler::TRANSPORT_FLOWS, start);
+    }
+    for (int node = 0; node < mSize; ++node) {
+        mNodes[node]->integrateFlows(dt);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Integration time step.
+///
+/// @details  Builds the transport system matrix.  Each node's row has its moles at the start of the
+///           step on the diagonal, plus the moles flowing in from other nodes this step, which also
+///           go in the off-diagonal of the source node's column with opposite sign.  Node moles are
+///           limited above zero so that every row, including non-capacitive nodes, is strictly
+///           diagonally dominant.  Flows are taken from the links that have set their port
+///           directions for a flow between two different nodes.  Inflows from the Ground node
+///           through links with an internal fluid are known, so they only add to the diagonal and
+///           to the boundary inflows for the source vector.  Inflows from the Ground node through
+///           other links carry the receiving node's own state, and outflows to the Ground node
+///           leave at the source node's state, so neither adds anything to the system.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::buildSystem(const double dt)
+{
+    for (int i = 0; i < mSize * mSize; ++i) {
+        mMatrix[i] = 0.0;
+    }
+    for (int i = 0; i < mSize; ++i) {
+        mMoles[i] = std::max(mFluidNodes[i]->getContent()->getMole(), DBL_EPSILON);
+        mMatrix[i * mSize + i] = mMoles[i];
+    }
+    for (int i = 0; i < mSize * (mNumFluidTypes + 1); ++i) {
+        mBoundaryInflows[i] = 0.0;
+    }
+
+    mNumImplicitLinks = 0;
+    for (int link = 0; link < mNumLinks; ++link) {
+        const int*                           map  = mLinks[link]->getNodeMap();
+        const GunnsBasicLink::PortDirection* dirs = mLinks[link]->getPortDirections();
+        int from = 0;
+        int to   = 1;
+        if (GunnsBasicLink::SOURCE == dirs[1] and GunnsBasicLink::SINK == dirs[0]) {
+            from = 1;
+            to   = 0;
+        } else if (GunnsBasicLink::SOURCE != dirs[0] or GunnsBasicLink::SINK != dirs[1]) {
+            continue;
+        }
+        from = map[from];
+        to   = map[to];
+        if (from == to) {
+            continue;
+        }
+        const double moles = std::fabs(mLinks[link]->getFlux()) * dt;
+        if (from < mSize and to < mSize) {
+            mMatrix[to * mSize + to]   += moles;
+            mMatrix[to * mSize + from] -= moles;
+        } else if (to < mSize) {
+            const PolyFluid* fluid = static_cast<GunnsFluidLink*>(mLinks[link])->getInternalFluid();
+            if (fluid) {
+                addBoundaryInflow(to, moles, fluid);
+            }
+        }
+        ++mNumImplicitLinks;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node   (--)    Index of the node receiving the inflow.
+/// @param[in]  moles  (kmol)  Moles flowing into the node this step.
+/// @param[in]  fluid  (--)    Pointer to the fluid state of the inflow.
+///
+/// @details  Adds a known inflow from the Ground node to the node's diagonal in the transport system
+///           matrix, and its constituent moles and enthalpy to the node's boundary inflows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::addBoundaryInflow(const int node, const double moles,
+                                                           const PolyFluid* fluid)
+{
+    mMatrix[node * mSize + node] += moles;
+    double* inflows = &mBoundaryInflows[node * (mNumFluidTypes + 1)];
+    for (int k = 0; k < mNumFluidTypes; ++k) {
+        inflows[k] += moles * fluid->getMoleFraction(k);
+    }
+    inflows[mNumFluidTypes] += moles * fluid->getSpecificEnthalpy() * fluid->getMWeight();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Decomposes the transport system matrix into lower and upper triangular factors in
+///           place, with unit diagonal on the lower factor.  Pivoting isn't needed because the
+///           matrix is strictly diagonally dominant, and stays so through the elimination.  The
+///           matrix is usually sparse, so elimination is skipped for zero terms below the diagonal.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::decompose()
+{
+    for (int k = 0; k < mSize; ++k) {
+        const double  pivot = mMatrix[k * mSize + k];
+        const double* rowK  = &mMatrix[k * mSize];
+        for (int i = k + 1; i < mSize; ++i) {
+            double* rowI = &mMatrix[i * mSize];
+            if (0.0 != rowI[k]) {
+                rowI[k] /= pivot;
+                for (int j = k + 1; j < mSize; ++j) {
+                    rowI[j] -= rowI[k] * rowK[j];
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  x  (--)  The source vector on input, and the solution vector on output.
+///
+/// @details  Solves the decomposed transport system in place by forward and back substitution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::solve(double* x) const
+{
+    for (int i = 1; i < mSize; ++i) {
+        const double* rowI = &mMatrix[i * mSize];
+        for (int j = 0; j < i; ++j) {
+            x[i] -= rowI[j] * x[j];
+        }
+    }
+    for (int i = mSize - 1; i >= 0; --i) {
+        const double* rowI = &mMatrix[i * mSize];
+        for (int j = i + 1; j < mSize; ++j) {
+            x[i] -= rowI[j] * x[j];
+        }
+        x[i] /= rowI[i];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Gives the solved node states to the nodes as their outflow states.  The solution is
+///           positive and normalized to within round-off, and we clean up the round-off before
+///           converting molar enthalpy to specific enthalpy with the new molecular weight.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidImplicitFlowOrchestrator::setNodeOutflows()
+{
+    for (int i = 0; i < mSize; ++i) {
+        double* fractions = &mMoleFractions[i * mNumFluidTypes];
+        double  sum       = 0.0;
+        for (int k = 0; k < mNumFluidTypes; ++k) {
+            fractions[k] = std::max(0.0, fractions[k]);
+            sum += fractions[k];
+        }
+
+        /// - Skip nodes with no solution, such as a node with no contents and no inflows.
+        if (sum < DBL_EPSILON) {
+            continue;
+        }
+        double mWeight = 0.0;
+        for (int k = 0; k < mNumFluidTypes; ++k) {
+            fractions[k] /= sum;
+            mWeight += fractions[k] * mMWeights[k];
+        }
+        mFluidNodes[i]->setImplicitOutflow(fractions, mMolarEnthalpy[i] / mWeight);
+    }
+}
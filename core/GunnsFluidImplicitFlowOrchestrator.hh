@@ -0,0 +1,140 @@
+#ifndef GunnsFluidImplicitFlowOrchestrator_EXISTS
+#define GunnsFluidImplicitFlowOrchestrator_EXISTS
+
+/**
+@file
+@brief     GUNNS Fluid Implicit Flow Orchestrator declarations
+
+@defgroup  TSM_GUNNS_CORE_FLUID_IMPLICIT_FLOW_ORCH    GUNNS Fluid Implicit Flow Orchestrator
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:   (Provides the classes for the GUNNS Fluid Implicit Flow Orchestrator.)
+
+@details
+REFERENCE:
+- (Implicit (backward Euler) first-order upwind transport.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Only two-port links are supported, since other links don't say how their flow divides among
+   their ports.  Initialization throws on any other link.)
+- (Inflows from the Ground node through links with an internal fluid enter the implicit solution as
+   known inflows at the link's internal fluid state as of the start of the step.  Inflows from the
+   Ground node through other links carry the receiving node's own state, as in
+   GunnsFluidLink::determineSourcePort, so they don't change the solution.)
+- (Links that modify the fluid passing through them are treated as passing the source node outflow
+   state unchanged in the implicit solution.)
+- (Trace compounds are transported at their node contents state, not implicitly.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsFluidImplicitFlowOrchestrator.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "core/GunnsBasicFlowOrchestrator.hh"
+
+class GunnsFluidNode;
+class PolyFluid;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Implicit Flow Orchestrator Class.
+///
+/// @details  This orchestrates the flow transport between nodes through the links of a GUNNS fluid
+///           network, as an alternative to GunnsFluidFlowOrchestrator.  That class transports
+///           explicitly: the fluid leaving a node is the node's contents at the start of the step,
+///           so when more mass flows out of a node in a step than it contains (the node is
+///           'overflowing'), the nodes and links must be sequenced so that the overflow carries the
+///           node's inflow mixture.  Loops of overflowing nodes can't be sequenced, and don't
+///           conserve.
+///
+///           This class instead solves for the fluid leaving each node implicitly, as the node's
+///           new state at the end of the step.  After the links compute their flows, the new mole
+///           fractions y of each node i are the solution of:
+///
+///               (N_i + dt * sum_j n_ji) * y_i - dt * sum_j n_ji * y_j = N_i * y_i,old
+///
+///           where N_i is the node's moles at the start of the step, and n_ji is the molar flow
+///           rate from node j to node i.  Inflows from the Ground node j through a link's internal
+///           fluid are known, so their terms move to the right-hand side as dt * n_ji * y_j.  The
+///           matrix is the same for every constituent and for the molar enthalpy, so it is
+///           decomposed once and solved for each.  It is strictly row
+///           diagonally dominant with non-positive off-diagonals, so the solution is a weighted
+///           average of the old states and the boundary inflow states: positive and normalized for
+///           any time step.
+///
+///           The solution is given to the nodes as their outflow state, then all links transport
+///           their flows and all nodes integrate, in any order.  The nodes mix their inflows into
+///           their contents and remove their outflows at the outflow state, so they neither
+///           overflow nor need sequencing.
+///
+///           To use this, create it with the network's number of links and nodes, and pass it to
+///           the network solver with Gunns::setFlowOrchestrator after Gunns::initializeFluidNodes
+///           and before Gunns::initialize.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidImplicitFlowOrchestrator : public GunnsBasicFlowOrchestrator
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidImplicitFlowOrchestrator);
+    public:
+        /// @brief  Default constructor.
+        GunnsFluidImplicitFlowOrchestrator(const int& numLinks, const int& numNodes);
+        /// @brief  Default destructor.
+        virtual     ~GunnsFluidImplicitFlowOrchestrator();
+        /// @brief  Initializes the GUNNS Fluid Implicit Flow Orchestrator.
+        virtual void initialize(const std::string& name, GunnsBasicLink** links, GunnsBasicNode** nodes);
+        /// @brief  Updates the flow transport through the links and integration in the nodes.
+        virtual void update(const double dt);
+        /// @brief  Returns the number of links included in the last implicit solution.
+        int          getNumImplicitLinks() const;
+
+    protected:
+        GunnsFluidNode** mFluidNodes;       /**< ** (--) trick_chkpnt_io(**) The network nodes as fluid nodes. */
+        int              mNumFluidTypes;    /**<    (--) trick_chkpnt_io(**) Number of fluid constituents in the network. */
+        int              mSize;             /**<    (--) trick_chkpnt_io(**) Size of the system, the number of non-Ground nodes. */
+        double*          mMatrix;           /**<    (--) trick_chkpnt_io(**) Transport system matrix, decomposed in place. */
+        double*          mSource;           /**<    (--) trick_chkpnt_io(**) Transport system source vector, solved in place. */
+        double*          mMoles;            /**<    (kmol) trick_chkpnt_io(**) Node moles at the start of the step, limited above zero. */
+        double*          mMoleFractions;    /**<    (--) trick_chkpnt_io(**) Solved node mole fractions, by node then constituent. */
+        double*          mMolarEnthalpy;    /**<    (J/kmol) trick_chkpnt_io(**) Solved node molar enthalpy. */
+        double*          mMWeights;         /**<    (1/mol) trick_chkpnt_io(**) Constituent molecular weights. */
+        double*          mBoundaryInflows;  /**<    (--) trick_chkpnt_io(**) Known inflows from the Ground node, by node then constituent moles (kmol) and enthalpy (J). */
+        int              mNumImplicitLinks; /**<    (--) trick_chkpnt_io(**) Number of links included in the last implicit solution. */
+        /// @brief  Builds the transport system matrix from the link flows and node contents.
+        void buildSystem(const double dt);
+        /// @brief  Adds a known inflow from the Ground node to the transport system.
+        void addBoundaryInflow(const int node, const double moles, const PolyFluid* fluid);
+        /// @brief  Decomposes the transport system matrix in place.
+        void decompose();
+        /// @brief  Solves the decomposed transport system in place.
+        void solve(double* x) const;
+        /// @brief  Gives the solved outflow states to the nodes.
+        void setNodeOutflows();
+        /// @brief  Deletes dynamic memory.
+        void cleanup();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidImplicitFlowOrchestrator(const GunnsFluidImplicitFlowOrchestrator& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidImplicitFlowOrchestrator& operator =(const GunnsFluidImplicitFlowOrchestrator& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of links included in the last implicit solution.
+///
+/// @details  Returns the number of links whose flows were included in the last implicit solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsFluidImplicitFlowOrchestrator::getNumImplicitLinks() const
+{
+    return mNumImplicitLinks;
+}
+
+#endif
@@ -69,7 +69,8 @@ GunnsFluidNode::GunnsFluidNode()
     mPreviousTemperature (0.0),
     mMassError           (0.0),
     mPressureCorrection  (0.0),
-    mCorrectGain         (1.0)
+    mCorrectGain         (1.0),
+    mImplicitOutflow     (false)
 {
     // nothing to do
 }
@@ -386,6 +387,7 @@ void GunnsFluidNode::resetFlows()
     GunnsBasicNode::resetFlows();
     mInflow.resetState();
     mInflowHeatFlux   = 0.0;
+    mImplicitOutflow  = false;
     updatePreviousPressure();
     mOutflow.setState(&mContent);
     const GunnsFluidTraceCompounds* traceCompounds = mContent.getTraceCompounds();
@@ -534,6 +536,13 @@ void GunnsFluidNode::collectTc(const int tcIndex, const double rate)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidNode::integrateFlows(const double dt)
 {
+    /// - Capacitive nodes whose outflow state was set by an implicit transport solution integrate
+    ///   differently, since their outflows all leave at that state.
+    if (mImplicitOutflow and mVolume > 0.0) {
+        integrateImplicitFlows(dt);
+        return;
+    }
+
     mExpansionDeltaT    = 0.0;
     mThermalDampingHeat = 0.0;
     GunnsFluidTraceCompounds* traceCompounds = mContent.getTraceCompounds();
@@ -652,52 +661,7 @@ void GunnsFluidNode::integrateFlows(const double dt)
             traceCompounds->flowIn(mTcInflow.mState, dt);
         }
 
-        /// - Calculate the new node specific enthalpy, and update the fluid's enthalpy,
-        ///   temperature and specific heat.
-        ///
-        /// - In the overflow case, if there is any incoming mass, the node contents take the
-        ///   incoming mass fluid properties, otherwise hold the temperature constant.
-        double newT = mContent.getTemperature();
-
-        /// - The new enthalpy is a mix of the old and inflow enthalpy.  Because we haven't
-        ///   called setTemperature yet, getSpecificiEnthalpy still represents the last mass.
-        double newEnthalpy = lastMass * mContent.getSpecificEnthalpy() + mNetHeatFlux * dt;
-        if (newEnthalpy < DBL_EPSILON) {
-            newEnthalpy = mContent.getSpecificEnthalpy();
-        } else {
-            newEnthalpy /= newMass;
-        }
-
-        /// - Thermal damping mass represents the mass of a container shell or solid contents
-        ///   that remain in thermal equilibrium with the fluid, and thus act to dampen changes
-        ///   in fluid temperature due to hotter or colder flows coming in.  But it must not
-        ///   damp the change in specific enthalpy caused by a mixture change at the same
-        ///   temperature.  We can also specify an additional portion of heat to omit from the
-        ///   damping.  Start with the specific enthalpy of the new mixture at the old
-        ///   temperature, and ramp that towards the above-calculated new specific enthalpy as
-        ///   thermal damping mass goes down from infinity to zero.
-        if (mThermalDampingMass > 0.0) {
-
-            const double mixtureEnthalpy =
-                    mContent.computeSpecificEnthalpy(mContent.getTemperature())
-                  + mUndampedHeatFlux * dt / newMass;
-            const double dampedEnthalpy = (newEnthalpy - mixtureEnthalpy)
-                    * newMass / (newMass + mThermalDampingMass);
-            if (dt > DBL_EPSILON) {
-                mThermalDampingHeat = (newEnthalpy - mixtureEnthalpy - dampedEnthalpy)
-                                    * newMass / dt;
-            }
-            newEnthalpy = mixtureEnthalpy + dampedEnthalpy;
-        }
-
-        /// - Update the new fluid temperature due to damping and isentropic
-        ///   expansion/compression.  Because we haven't called setTemperature yet,
-        ///   getSpecificEnthalpy still represents the old mass.
-        newEnthalpy += oldMass * mExpansionDeltaT * mContent.getSpecificHeat() / newMass;
-        newT = mContent.computeTemperature(newEnthalpy);
-
-        /// - Update the final thermal parameters and density.
-        mContent.setTemperature(newT);
+        updateContentTemperature(lastMass, oldMass, newMass, dt);
 
     /// - Non-capacitive nodes have no volume, and their fluid properties represent an infinitesimal
     ///   amount of mass.  As such, the node's fluid properties are completely replaced by those of
@@ -754,6 +718,161 @@ void GunnsFluidNode::integrateFlows(const double dt)
     mFluxThrough = std::min(mInfluxRate, outFlow);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] moleFractions    (--)   Outflow constituent mole fractions, in this node's order.
+/// @param[in] specificEnthalpy (J/kg) Outflow specific enthalpy.
+///
+/// @details  Sets the outflow fluid state this pass to the node's new state as solved by an implicit
+///           transport solution, such as GunnsFluidImplicitFlowOrchestrator.  This must be called
+///           after resetFlows and before the links transport their flows, so that the links carry
+///           this state out of the node.  The outflow trace compounds are left at the contents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidNode::setImplicitOutflow(double* moleFractions, const double specificEnthalpy)
+{
+    mOutflow.setMoleAndMoleFractions(mOutflow.getMole(), moleFractions);
+    mOutflow.setTemperature(mOutflow.computeTemperature(specificEnthalpy));
+    mImplicitOutflow = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step.
+///
+/// @details  Integrates flows in a capacitive node whose outflow state has been set by an implicit
+///           transport solution.  All of the scheduled outflow leaves at the outflow state, so
+///           there is no overflow to track: the inflows are mixed into the contents, and then the
+///           outflow is removed from the mixture.  Because the implicit solution already includes
+///           these outflows in its new state, the mixture is unchanged by their removal, and no
+///           constituent mass goes negative regardless of the time step.  Inflows that the implicit
+///           solution didn't include are still conserved, but move the final contents away from the
+///           outflow state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidNode::integrateImplicitFlows(const double dt)
+{
+    mExpansionDeltaT    = 0.0;
+    mThermalDampingHeat = 0.0;
+    GunnsFluidTraceCompounds* traceCompounds = mContent.getTraceCompounds();
+
+    /// - Mass (kg) of inflow, outflow and contents this step.  Note that mInfluxRate is mass rate.
+    const double inMass   = mInfluxRate * dt;
+    const double outMass  = mScheduledOutflux * dt * mOutflow.getMWeight();
+    const double lastMass = mContent.getMass();
+    const double oldMass  = std::max(0.0, lastMass - outMass);
+    const double newMass  = std::max(DBL_EPSILON, lastMass + inMass - outMass);
+
+    /// - Mass flow rate (kg/s) of fluid out of the node, and net heat flux into the node.
+    double outFlow = 0.0;
+    if (dt > 0.0) {
+        outFlow = outMass / dt;
+    }
+    mNetHeatFlux = mInflowHeatFlux - outFlow * mOutflow.getSpecificEnthalpy();
+
+    /// - Calculate the change in temperature of the original mass due to thermal expansion.
+    mExpansionDeltaT = GunnsFluidUtils::computeIsentropicTemperature(mExpansionScaleFactor,
+                                                                     mPreviousPressure,
+                                                                     mContent.getPressure(),
+                                                                     &mContent)
+                     - mContent.getTemperature();
+
+    /// - Mix in the inflows, then remove the outflows.  Trace compounds flow out at the outflow
+    ///   trace compound state, which is the contents at the start of the step.
+    if (lastMass + inMass - outMass >= DBL_EPSILON) {
+        if (fabs(inMass) > DBL_EPSILON) {
+            GunnsFluidUtils::mixFluidMasses(&mContent, lastMass, &mInflow, inMass, mNumFluidTypes);
+        }
+        if (outMass > DBL_EPSILON) {
+            GunnsFluidUtils::mixFluidMasses(&mContent, lastMass + inMass, &mOutflow, -outMass,
+                                            mNumFluidTypes);
+        }
+    } else {
+        mContent.setMass(newMass);
+        GUNNS_WARNING("zero node mass after implicit outflow, conservation errors may result.");
+    }
+
+    /// - Add standalone trace compound flows, separate from the bulk fluid flows, into or out of the
+    ///   node contents.
+    if (traceCompounds and mContent.getMWeight() > DBL_EPSILON) {
+        traceCompounds->flowIn(mTcInflow.mState, dt);
+    }
+
+    updateContentTemperature(lastMass, oldMass, newMass, dt);
+
+    /// - Prevent negative trace compound masses & mole fractions.
+    if (traceCompounds) {
+        traceCompounds->limitPositive();
+    }
+
+    /// - Calculate mass discrepancy between the solution density and the actual mass / volume.
+    computeMassError();
+
+    /// - The outflow state was already transported by the links, so just update its flow rate and
+    ///   pressure.  Copy the in, out & throughput mass flow rates to display terms.
+    mOutflow.setFlowRate(outFlow);
+    mOutflow.setPressure(mContent.getPressure());
+    mNetFlux     = mInfluxRate - outFlow;
+    mFluxThrough = std::min(mInfluxRate, outFlow);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] lastMass (kg) Contents mass before flows are applied.
+/// @param[in] oldMass  (kg) Contents mass remaining in the node after outflows.
+/// @param[in] newMass  (kg) Final contents mass in the node after outflows and inflows.
+/// @param[in] dt       (s)  Integration time step.
+///
+/// @details  Calculates the new node specific enthalpy from the net heat flux, thermal damping and
+///           isentropic expansion, and updates the content temperature.  The content mixture must
+///           already be updated, but not its temperature.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidNode::updateContentTemperature(const double lastMass, const double oldMass,
+                                              const double newMass,  const double dt)
+{
+    /// - Calculate the new node specific enthalpy, and update the fluid's enthalpy,
+    ///   temperature and specific heat.
+    ///
+    /// - In the overflow case, if there is any incoming mass, the node contents take the
+    ///   incoming mass fluid properties, otherwise hold the temperature constant.
+    double newT = mContent.getTemperature();
+
+    /// - The new enthalpy is a mix of the old and inflow enthalpy.  Because we haven't
+    ///   called setTemperature yet, getSpecificiEnthalpy still represents the last mass.
+    double newEnthalpy = lastMass * mContent.getSpecificEnthalpy() + mNetHeatFlux * dt;
+    if (newEnthalpy < DBL_EPSILON) {
+        newEnthalpy = mContent.getSpecificEnthalpy();
+    } else {
+        newEnthalpy /= newMass;
+    }
+
+    /// - Thermal damping mass represents the mass of a container shell or solid contents
+    ///   that remain in thermal equilibrium with the fluid, and thus act to dampen changes
+    ///   in fluid temperature due to hotter or colder flows coming in.  But it must not
+    ///   damp the change in specific enthalpy caused by a mixture change at the same
+    ///   temperature.  We can also specify an additional portion of heat to omit from the
+    ///   damping.  Start with the specific enthalpy of the new mixture at the old
+    ///   temperature, and ramp that towards the above-calculated new specific enthalpy as
+    ///   thermal damping mass goes down from infinity to zero.
+    if (mThermalDampingMass > 0.0) {
+
+        const double mixtureEnthalpy =
+                mContent.computeSpecificEnthalpy(mContent.getTemperature())
+              + mUndampedHeatFlux * dt / newMass;
+        const double dampedEnthalpy = (newEnthalpy - mixtureEnthalpy)
+                * newMass / (newMass + mThermalDampingMass);
+        if (dt > DBL_EPSILON) {
+            mThermalDampingHeat = (newEnthalpy - mixtureEnthalpy - dampedEnthalpy)
+                                * newMass / dt;
+        }
+        newEnthalpy = mixtureEnthalpy + dampedEnthalpy;
+    }
+
+    /// - Update the new fluid temperature due to damping and isentropic
+    ///   expansion/compression.  Because we haven't called setTemperature yet,
+    ///   getSpecificEnthalpy still represents the old mass.
+    newEnthalpy += oldMass * mExpansionDeltaT * mContent.getSpecificHeat() / newMass;
+    newT = mContent.computeTemperature(newEnthalpy);
+
+    /// - Update the final thermal parameters and density.
+    mContent.setTemperature(newT);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   (kPa) Pressure correction
 ///
@@ -151,6 +151,12 @@ class GunnsFluidNode : public GunnsBasicNode
         /// @brief Returns whether this node is currently overflowing
         virtual bool isOverflowing(const double dt) const;
 
+        /// @brief Sets the outflow state this pass from an implicit transport solution
+        void setImplicitOutflow(double* moleFractions, const double specificEnthalpy);
+
+        /// @brief Returns whether the outflow state this pass is from an implicit transport solution
+        bool isImplicitOutflow() const;
+
     protected:
         const PolyFluidConfigData* mFluidConfig;          /**< *o (--)       trick_chkpnt_io(**) Available fluid types in this node */
         int                        mNumFluidTypes;        /**< *o (--)       trick_chkpnt_io(**) The number of fluid types in this node */
@@ -175,10 +181,18 @@ class GunnsFluidNode : public GunnsBasicNode
         double                     mPressureCorrection;   /**<    (kPa)                          Filtered pressure correction to wash out mMassError */
         double                     mCorrectGain;          /**<    (--)                           Pressure correction filter gain */
         static const double        mErrorThreshold;       /**< ** (kPa)                          Error threshold for pressure correction */
+        bool                       mImplicitOutflow;      /**<    (--)       trick_chkpnt_io(**) The outflow state this pass is from an implicit transport solution */
 
         /// @brief Calculates mass error in the node
         void   computeMassError();
 
+        /// @brief Integrates flows with the outflow state from an implicit transport solution
+        void   integrateImplicitFlows(const double dt);
+
+        /// @brief Updates the content temperature from the net heat flux and mixture change
+        void   updateContentTemperature(const double lastMass, const double oldMass,
+                                        const double newMass,  const double dt);
+
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
         GunnsFluidNode(const GunnsFluidNode& that);
@@ -339,4 +353,15 @@ inline bool GunnsFluidNode::isOverflowing(const double dt) const
     return mScheduledOutflux * dt > mContent.getMole();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if the outflow state this pass is from an implicit transport solution.
+///
+/// @details  Returns whether the outflow state this pass has been set by an implicit transport
+///           solution, rather than being the node contents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidNode::isImplicitOutflow() const
+{
+    return mImplicitOutflow;
+}
+
 #endif
@@ -1008,7 +1008,7 @@ double GunnsFluidUtils::computeRelativeHumidityH2O(const PolyFluid* fluid)
 {
     double result = 0.0;
     const double ppH2o    = fluid->getPartialPressure(FluidProperties::GUNNS_H2O);
-    const double ppH2oSat = fluid->getProperties(FluidProperties::GUNNS_H2O)->getSaturationPressure(fluid->getTemperature());
+    const double ppH2oSat = fluid->getProperties(FluidProperties::GUNNS_H2O)->lookupSaturationPressure(fluid->getTemperature());
 
     if (ppH2oSat > DBL_EPSILON) {
         result = ppH2o / ppH2oSat;
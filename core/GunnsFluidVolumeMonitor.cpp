@@ -39,13 +39,17 @@ GunnsFluidVolumeMonitorConfigData::~GunnsFluidVolumeMonitorConfigData()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  linkPort (--) Which of the link's port nodes to monitor.
+/// @param[in]  linkPort   (--) Which of the link's port nodes to monitor.
+/// @param[in]  decimation (--) Number of post-solver steps between output refreshes, or 0 to
+///                             never refresh in the step.
 ///
 /// @details  Default constructs this GUNNS Fluid Volume Monitor Spotter input data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-GunnsFluidVolumeMonitorInputData::GunnsFluidVolumeMonitorInputData(const int linkPort)
+GunnsFluidVolumeMonitorInputData::GunnsFluidVolumeMonitorInputData(const int linkPort,
+                                                                   const int decimation)
     :
-    mLinkPort(linkPort)
+    mLinkPort(linkPort),
+    mDecimation(decimation)
 {
     // nothing to do
 }
@@ -75,7 +79,11 @@ GunnsFluidVolumeMonitor::GunnsFluidVolumeMonitor(const GunnsNodeList&  nodeList,
     mNodeMass            (0.0),
     mNodeMassFractions   (0),
     mNodeMoleFractions   (0),
-    mNodeVolume          (0.0)
+    mNodeTcMoleFractions (0),
+    mNodeVolume          (0.0),
+    mDecimation          (1),
+    mStepCount           (0),
+    mStale               (false)
 {
     // nothing to do
 }
@@ -118,15 +126,19 @@ void GunnsFluidVolumeMonitor::initialize(const GunnsNetworkSpotterConfigData* co
     /// - Validate & initialize from config & input data.
     validateConfig(configData);
     const GunnsFluidVolumeMonitorInputData* input = validateInput(inputData);
-    mLinkPort = input->mLinkPort;
+    mLinkPort   = input->mLinkPort;
+    mDecimation = input->mDecimation;
+    mStepCount  = 0;
 
     /// - Allocate dynamic memory.
+    cleanup();
     mNumFluidConstituents = mLink.getNodeContent(0)->getNConstituents();
     TS_NEW_PRIM_ARRAY_EXT(mNodeMassFractions, mNumFluidConstituents, double, configData->mName + ".mNodeMassFractions");
     TS_NEW_PRIM_ARRAY_EXT(mNodeMoleFractions, mNumFluidConstituents, double, configData->mName + ".mNodeMoleFractions");
 
-    /// - Step to initialize the outputs.
-    stepPostSolver(0.0);
+    /// - Initialize the outputs.
+    mLinkPort = MsMath::limitRange(0, mLinkPort, mLink.getNumberPorts()-1);
+    update();
 
     /// - Set the init flag.
     mInitFlag = true;
@@ -169,6 +181,12 @@ const GunnsFluidVolumeMonitorInputData* GunnsFluidVolumeMonitor::validateInput(c
         GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
                     "Bad input data pointer type.");
     }
+
+    /// - Throw an exception on negative decimation.
+    if (result->mDecimation < 0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
+                    "decimation < 0.");
+    }
     return result;
 }
 
@@ -186,24 +204,46 @@ void GunnsFluidVolumeMonitor::stepPreSolver(const double dt __attribute__((unuse
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt  (s)  Execution time step (not used).
 ///
-/// @details  Copies desired properties from the node.  This is done post-solution so we'll see the
-///           most recent balanced node properties.
+/// @details  Marks the outputs stale after the network solution, and refreshes them from the node
+///           every mDecimation steps.  This is done post-solution so we'll see the most recent
+///           balanced node properties.  On other steps, the getters read the node directly.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidVolumeMonitor::stepPostSolver(const double dt __attribute__((unused)))
 {
     /// - Limit the user-supplied link port number to the link's valid range.
     mLinkPort = MsMath::limitRange(0, mLinkPort, mLink.getNumberPorts()-1);
+    mStale    = true;
 
+    if (mDecimation > 0 and ++mStepCount >= mDecimation) {
+        mStepCount = 0;
+        update();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  GunnsFluidNode* (--) Pointer to the node attached to the monitored link port.
+///
+/// @details  Returns the node currently attached to the monitored link port.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidNode* GunnsFluidVolumeMonitor::getNode() const
+{
+    GunnsFluidNode* nodes = static_cast<GunnsFluidNode*>(mNodeList.mNodes);
+    return &nodes[mLink.getNodeMap()[mLinkPort]];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Copies desired properties from the node and clears the stale flag.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidVolumeMonitor::update()
+{
     /// - Set up pointers for speed.
-    GunnsFluidNode*  nodes = static_cast<GunnsFluidNode*>(mNodeList.mNodes);
-    GunnsFluidNode*  node  = &nodes[mLink.getNodeMap()[mLinkPort]];
+    GunnsFluidNode*  node  = getNode();
     const PolyFluid* fluid = node->getContent();
 
     /// - Copy the node properties.
     for (int i = 0; i < mNumFluidConstituents; ++i) {
-        const FluidProperties::FluidType type = fluid->getType(i);
-        mNodeMassFractions[i] = fluid->getMassFraction(type);
-        mNodeMoleFractions[i] = fluid->getMoleFraction(type);
+        mNodeMassFractions[i] = fluid->getMassFraction(i);
+        mNodeMoleFractions[i] = fluid->getMoleFraction(i);
     }
     mNodeMass = node->getMass();
     mNodeVolume = node->getVolume();
@@ -211,4 +251,24 @@ void GunnsFluidVolumeMonitor::stepPostSolver(const double dt __attribute__((unus
     if (fluid->getTraceCompounds()) {
         mNodeTcMoleFractions = fluid->getTraceCompounds()->getMoleFractions();
     }
+    mStale = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  that  (--)  A monitor of the same node, that has just been refreshed.
+///
+/// @details  Copies the outputs of the given monitor of the same node and clears the stale flag.
+///           This skips the constituent fraction lookups in the node contents, for when several
+///           monitors watch the same node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidVolumeMonitor::update(const GunnsFluidVolumeMonitor& that)
+{
+    for (int i = 0; i < mNumFluidConstituents; ++i) {
+        mNodeMassFractions[i] = that.mNodeMassFractions[i];
+        mNodeMoleFractions[i] = that.mNodeMoleFractions[i];
+    }
+    mNodeMass            = that.mNodeMass;
+    mNodeVolume          = that.mNodeVolume;
+    mNodeTcMoleFractions = that.mNodeTcMoleFractions;
+    mStale               = false;
 }
@@ -22,7 +22,9 @@ REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (The outputs are only refreshed on the configured decimation of post-solver steps.  Between
+   refreshes, the output terms seen by telemetry hold their last refreshed values, while the getter
+   methods read the node directly.)
 
 LIBRARY DEPENDENCY:
 - ((GunnsFluidVolumeMonitor.o))
@@ -35,6 +37,7 @@ PROGRAMMERS:
 
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "GunnsNetworkSpotter.hh"
+#include "GunnsFluidNode.hh"
 #include "math/MsMath.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,8 +71,9 @@ class GunnsFluidVolumeMonitorInputData : public GunnsNetworkSpotterInputData
 {
     public:
         int mLinkPort;   /**< (--) trick_chkpnt_io(**) Which of the link's port nodes to monitor. */
+        int mDecimation; /**< (--) trick_chkpnt_io(**) Number of post-solver steps between output refreshes, or 0 to never refresh in the step. */
         /// @brief  Default constructs this GUNNS Fluid Volume Monitor Spotter input data.
-        GunnsFluidVolumeMonitorInputData(const int linkPort = 0);
+        GunnsFluidVolumeMonitorInputData(const int linkPort = 0, const int decimation = 1);
         /// @brief  Default destructs this GUNNS Fluid Volume Monitor Spotter input data.
         virtual ~GunnsFluidVolumeMonitorInputData();
 
@@ -91,10 +95,18 @@ class GunnsFluidLink;
 ///           volume, total mass, partial masses & moles.  This spotter attaches to a link and looks
 ///           at the node attached at the designated link's port.  This allows the spotter to keep
 ///           monitoring the link's attached node when the link changes nodes in the network.
+///
+///           The outputs are refreshed from the node every mDecimation post-solver steps.  On the
+///           steps in between they are only marked stale, and the getter methods read the node
+///           directly while they are stale.  A decimation of zero never refreshes them in the step,
+///           so a monitor that is only read through its getters costs nothing.  Many monitors can
+///           instead be refreshed together by a GunnsFluidVolumeMonitorGroup.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsFluidVolumeMonitor : public GunnsNetworkSpotter
 {
     TS_MAKE_SIM_COMPATIBLE(GunnsFluidVolumeMonitor);
+    /// @brief  The group takes over the output refresh of its monitors.
+    friend class GunnsFluidVolumeMonitorGroup;
     public:
         /// @brief  Default Constructor
         GunnsFluidVolumeMonitor(const GunnsNodeList&  nodeList,
@@ -109,6 +121,10 @@ class GunnsFluidVolumeMonitor : public GunnsNetworkSpotter
         virtual void stepPreSolver(const double dt);
         /// @brief   Steps the GUNNS Fluid Volume Monitor Spotter after the GUNNS solver step.
         virtual void stepPostSolver(const double dt);
+        /// @brief   Refreshes the outputs from the monitored node.
+        void         update();
+        /// @brief   Returns whether the outputs are out of date with the monitored node.
+        bool         isStale() const;
         /// @brief   Gets the total mass of the node contents.
         double       getMass() const;
         /// @brief   Gets the mass fraction of the specified constituent index in the node contents.
@@ -128,10 +144,17 @@ class GunnsFluidVolumeMonitor : public GunnsNetworkSpotter
         double*               mNodeMoleFractions;    /**< *o (--) trick_chkpnt_io(**) Mole fractions of the node contents. */
         double*               mNodeTcMoleFractions;  /**< *o (--) trick_chkpnt_io(**) Mole fractions of the node trace compounds contents. */
         double                mNodeVolume;           /**< *o (m3) trick_chkpnt_io(**) Total volume of the node. */
+        int                   mDecimation;           /**<    (--)                     Number of post-solver steps between output refreshes, or 0 to never refresh in the step. */
+        int                   mStepCount;            /**< *o (--) trick_chkpnt_io(**) Post-solver steps since the last decimated refresh. */
+        bool                  mStale;                /**< *o (--) trick_chkpnt_io(**) The outputs are out of date with the node. */
         /// @brief   Validates the supplied configuration data.
         const GunnsFluidVolumeMonitorConfigData* validateConfig(const GunnsNetworkSpotterConfigData* config);
         /// @brief   Validates the supplied input data.
         const GunnsFluidVolumeMonitorInputData*  validateInput (const GunnsNetworkSpotterInputData* input);
+        /// @brief   Returns the node currently attached to the monitored link port.
+        GunnsFluidNode*      getNode() const;
+        /// @brief   Refreshes the outputs from another monitor's outputs of the same node.
+        void                 update(const GunnsFluidVolumeMonitor& that);
 
     private:
         /// @brief   Deletes dynamic memory.
@@ -144,13 +167,27 @@ class GunnsFluidVolumeMonitor : public GunnsNetworkSpotter
 
 /// @}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the outputs are out of date with the monitored node.
+///
+/// @details  Returns whether the outputs have not been refreshed since the last network solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidVolumeMonitor::isStale() const
+{
+    return mStale;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  double (kg) Total mass of all fluid in the node contents.
 ///
-/// @details  Returns the total mass of all fluid in the node contents.
+/// @details  Returns the total mass of all fluid in the node contents, from the node itself if the
+///           outputs are stale.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double GunnsFluidVolumeMonitor::getMass() const
 {
+    if (mStale) {
+        return getNode()->getMass();
+    }
     return mNodeMass;
 }
 
@@ -160,11 +197,16 @@ inline double GunnsFluidVolumeMonitor::getMass() const
 /// @returns  double (--) Mass fraction (0-1) of the specified constituent in the node contents.
 ///
 /// @details  Returns the mass fraction (0-1) of the specified fluid constituent in the node
-///           contents.  The given index is limited to the valid range of fluid constituents.
+///           contents, from the node itself if the outputs are stale.  The given index is limited to
+///           the valid range of fluid constituents.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double GunnsFluidVolumeMonitor::getMassFraction(const int index) const
 {
-    return mNodeMassFractions[MsMath::limitRange(0, index, mNumFluidConstituents-1)];
+    const int i = MsMath::limitRange(0, index, mNumFluidConstituents-1);
+    if (mStale) {
+        return getNode()->getContent()->getMassFraction(i);
+    }
+    return mNodeMassFractions[i];
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,20 +215,28 @@ inline double GunnsFluidVolumeMonitor::getMassFraction(const int index) const
 /// @returns  double (--) Mole fraction (0-1) of the specified constituent in the node contents.
 ///
 /// @details  Returns the mole fraction (0-1) of the specified fluid constituent in the node
-///           contents.  The given index is limited to the valid range of fluid constituents.
+///           contents, from the node itself if the outputs are stale.  The given index is limited to
+///           the valid range of fluid constituents.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double GunnsFluidVolumeMonitor::getMoleFraction(const int index) const
 {
-    return mNodeMoleFractions[MsMath::limitRange(0, index, mNumFluidConstituents-1)];
+    const int i = MsMath::limitRange(0, index, mNumFluidConstituents-1);
+    if (mStale) {
+        return getNode()->getContent()->getMoleFraction(i);
+    }
+    return mNodeMoleFractions[i];
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  double (m3) Total volume of the node.
 ///
-/// @details  Returns the total volume of the node.
+/// @details  Returns the total volume of the node, from the node itself if the outputs are stale.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double GunnsFluidVolumeMonitor::getVolume() const
 {
+    if (mStale) {
+        return getNode()->getVolume();
+    }
     return mNodeVolume;
 }
 
@@ -0,0 +1,249 @@
+/**
+@file
+@brief     GUNNS Fluid Volume Monitor Group Spotter implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((GunnsNetworkSpotter.o)
+   (core/GunnsFluidVolumeMonitor.o)
+   (simulation/hs/TsHsMsg.o)
+   (software/exceptions/TsInitializationException.o))
+*/
+
+#include "GunnsFluidVolumeMonitorGroup.hh"
+#include "GunnsFluidVolumeMonitor.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Instance name for self-identification in messages.
+///
+/// @details  Default constructs this GUNNS Fluid Volume Monitor Group Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidVolumeMonitorGroupConfigData::GunnsFluidVolumeMonitorGroupConfigData(const std::string& name)
+    :
+    GunnsNetworkSpotterConfigData(name)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Volume Monitor Group Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidVolumeMonitorGroupConfigData::~GunnsFluidVolumeMonitorGroupConfigData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  decimation (--) Number of post-solver steps between batch refreshes, or 0 to never
+///                             refresh in the step.
+///
+/// @details  Default constructs this GUNNS Fluid Volume Monitor Group Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidVolumeMonitorGroupInputData::GunnsFluidVolumeMonitorGroupInputData(const int decimation)
+    :
+    mDecimation(decimation)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Volume Monitor Group Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidVolumeMonitorGroupInputData::~GunnsFluidVolumeMonitorGroupInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Default constructs this GUNNS Fluid Volume Monitor Group Spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidVolumeMonitorGroup::GunnsFluidVolumeMonitorGroup()
+    :
+    GunnsNetworkSpotter  (),
+    mMonitors            (),
+    mDecimation          (1),
+    mStepCount           (0),
+    mSharedIndex         ()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Fluid Volume Monitor Group Spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidVolumeMonitorGroup::~GunnsFluidVolumeMonitorGroup()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  monitor  (--)  The monitor to register with this group.
+///
+/// @details  Adds the given monitor to this group, unless it is already registered.  This must be
+///           called before this group is initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidVolumeMonitorGroup::addMonitor(GunnsFluidVolumeMonitor& monitor)
+{
+    for (unsigned int i = 0; i < mMonitors.size(); ++i) {
+        if (&monitor == mMonitors[i]) {
+            return;
+        }
+    }
+    mMonitors.push_back(&monitor);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+/// @param[in]  inputData   (--)  Instance input data.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Fluid Volume Monitor Group Spotter with its configuration and
+///           input data, and takes over the output refresh of the registered monitors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidVolumeMonitorGroup::initialize(const GunnsNetworkSpotterConfigData* configData,
+                                              const GunnsNetworkSpotterInputData*  inputData)
+{
+    /// - Initialize the base class.
+    GunnsNetworkSpotter::initialize(configData, inputData);
+
+    /// - Reset the init flag.
+    mInitFlag = false;
+
+    /// - Validate & initialize from config & input data.
+    validateConfig(configData);
+    const GunnsFluidVolumeMonitorGroupInputData* input = validateInput(inputData);
+    mDecimation = input->mDecimation;
+    mStepCount  = 0;
+
+    /// - Throw an exception if there are no monitors, or any aren't initialized.
+    if (mMonitors.empty()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "no monitors have been added.");
+    }
+    for (unsigned int i = 0; i < mMonitors.size(); ++i) {
+        if (not mMonitors[i]->isInitialized()) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "a monitor is not initialized.");
+        }
+    }
+
+    /// - Find the first monitor of each monitor's node, which the others of that node will copy.
+    mSharedIndex.assign(mMonitors.size(), 0);
+    for (unsigned int i = 0; i < mMonitors.size(); ++i) {
+        const GunnsFluidNode* node = mMonitors[i]->getNode();
+        unsigned int shared = 0;
+        while (node != mMonitors[shared]->getNode()) {
+            ++shared;
+        }
+        mSharedIndex[i] = shared;
+    }
+
+    /// - Take over the refresh of the monitors and initialize the outputs.
+    for (unsigned int i = 0; i < mMonitors.size(); ++i) {
+        mMonitors[i]->mDecimation = 0;
+    }
+    update();
+
+    /// - Set the init flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+///
+/// @returns  GunnsFluidVolumeMonitorGroupConfigData (--) Type-casted and validated config data
+///                                                       pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base config data class pointer to this spotter's config data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsFluidVolumeMonitorGroupConfigData* GunnsFluidVolumeMonitorGroup::validateConfig(
+        const GunnsNetworkSpotterConfigData* config)
+{
+    const GunnsFluidVolumeMonitorGroupConfigData* result =
+            dynamic_cast<const GunnsFluidVolumeMonitorGroupConfigData*>(config);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "Bad config data pointer type.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  inputData  (--)  Instance input data.
+///
+/// @returns  GunnsFluidVolumeMonitorGroupInputData (--) Type-casted and validated input data
+///                                                      pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base input data class pointer to this spotter's input data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsFluidVolumeMonitorGroupInputData* GunnsFluidVolumeMonitorGroup::validateInput(
+        const GunnsNetworkSpotterInputData* input)
+{
+    const GunnsFluidVolumeMonitorGroupInputData* result =
+            dynamic_cast<const GunnsFluidVolumeMonitorGroupInputData*>(input);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
+                    "Bad input data pointer type.");
+    }
+
+    /// - Throw an exception on negative decimation.
+    if (result->mDecimation < 0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
+                    "decimation < 0.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step (not used).
+///
+/// @details  This method does nothing because this spotter has no function prior to the network
+///           solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidVolumeMonitorGroup::stepPreSolver(const double dt __attribute__((unused)))
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step (not used).
+///
+/// @details  Refreshes all monitors' outputs every mDecimation steps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidVolumeMonitorGroup::stepPostSolver(const double dt __attribute__((unused)))
+{
+    if (mDecimation > 0 and ++mStepCount >= mDecimation) {
+        mStepCount = 0;
+        update();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Refreshes the outputs of all monitors from their nodes, clearing their stale flags.
+///           The first monitor of each node reads the node content's mass and mole fractions, and
+///           the other monitors of that node copy its outputs rather than reading the node contents
+///           again.  Since the monitored links can move to other nodes, a monitor only copies while
+///           it still shares its node with that first monitor, and otherwise reads its own node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidVolumeMonitorGroup::update()
+{
+    for (unsigned int i = 0; i < mMonitors.size(); ++i) {
+        const GunnsFluidVolumeMonitor* shared =
+                (i < mSharedIndex.size()) ? mMonitors[mSharedIndex[i]] : mMonitors[i];
+        if (shared != mMonitors[i] and shared->getNode() == mMonitors[i]->getNode()) {
+            mMonitors[i]->update(*shared);
+        } else {
+            mMonitors[i]->update();
+        }
+    }
+}
@@ -0,0 +1,151 @@
+#ifndef GunnsFluidVolumeMonitorGroup_EXISTS
+#define GunnsFluidVolumeMonitorGroup_EXISTS
+
+/**
+@file
+@brief     GUNNS Fluid Volume Monitor Group Spotter declarations
+
+@defgroup  TSM_GUNNS_CORE_FLUID_VOLUME_MONITOR_GROUP   GUNNS Fluid Volume Monitor Group Spotter
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:  (Provides the classes for the GUNNS Fluid Volume Monitor Group Spotter.  This spotter
+           refreshes the outputs of a registered set of GUNNS Fluid Volume Monitor spotters together
+           in one batch, on a configurable decimation of network steps.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Monitors must be registered and initialized before this group is initialized.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsFluidVolumeMonitorGroup.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "GunnsNetworkSpotter.hh"
+#include <vector>
+
+class GunnsFluidVolumeMonitor;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Volume Monitor Group Spotter Configuration Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the GUNNS Fluid
+///           Volume Monitor Group Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidVolumeMonitorGroupConfigData : public GunnsNetworkSpotterConfigData
+{
+    public:
+        /// @brief  Default constructs this GUNNS Fluid Volume Monitor Group Spotter configuration data.
+        GunnsFluidVolumeMonitorGroupConfigData(const std::string& name);
+        /// @brief  Default destructs this GUNNS Fluid Volume Monitor Group Spotter configuration data.
+        virtual ~GunnsFluidVolumeMonitorGroupConfigData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidVolumeMonitorGroupConfigData(const GunnsFluidVolumeMonitorGroupConfigData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidVolumeMonitorGroupConfigData& operator =(const GunnsFluidVolumeMonitorGroupConfigData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Volume Monitor Group Spotter Input Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the GUNNS Fluid
+///           Volume Monitor Group Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidVolumeMonitorGroupInputData : public GunnsNetworkSpotterInputData
+{
+    public:
+        int mDecimation; /**< (--) trick_chkpnt_io(**) Number of post-solver steps between batch refreshes, or 0 to never refresh in the step. */
+        /// @brief  Default constructs this GUNNS Fluid Volume Monitor Group Spotter input data.
+        GunnsFluidVolumeMonitorGroupInputData(const int decimation = 1);
+        /// @brief  Default destructs this GUNNS Fluid Volume Monitor Group Spotter input data.
+        virtual ~GunnsFluidVolumeMonitorGroupInputData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidVolumeMonitorGroupInputData(const GunnsFluidVolumeMonitorGroupInputData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidVolumeMonitorGroupInputData& operator =(const GunnsFluidVolumeMonitorGroupInputData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Volume Monitor Group Spotter Class.
+///
+/// @details  This spotter takes over the output refresh of a set of GUNNS Fluid Volume Monitors,
+///           such as all of the monitors in a network.  The monitors are registered with addMonitor
+///           before initialization, and this sets their own decimation to zero so they no longer
+///           refresh themselves.  Every mDecimation post-solver steps, this refreshes all of the
+///           monitors together, copying the node properties as stored in the node contents.  When
+///           several monitors watch the same node, only the first of them reads the node contents,
+///           and the others copy its outputs.
+///           Between batch refreshes, a monitor's getters still read its node directly, so
+///           telemetry-only monitors cost nothing on frames where nobody samples them.
+///
+///           This spotter should be stepped after the monitors in the network's spotter list, so
+///           that its refresh clears the monitors' stale flags on the same step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidVolumeMonitorGroup : public GunnsNetworkSpotter
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidVolumeMonitorGroup);
+    public:
+        /// @brief   Default Constructor
+        GunnsFluidVolumeMonitorGroup();
+        /// @brief   Default destructor.
+        virtual     ~GunnsFluidVolumeMonitorGroup();
+        /// @brief   Registers a monitor with this group.
+        void         addMonitor(GunnsFluidVolumeMonitor& monitor);
+        /// @brief   Initializes the GUNNS Fluid Volume Monitor Group Spotter with configuration and
+        ///          input data.
+        virtual void initialize(const GunnsNetworkSpotterConfigData* configData,
+                                const GunnsNetworkSpotterInputData*  inputData);
+        /// @brief   Steps the GUNNS Fluid Volume Monitor Group Spotter prior to the GUNNS solver step.
+        virtual void stepPreSolver(const double dt);
+        /// @brief   Steps the GUNNS Fluid Volume Monitor Group Spotter after the GUNNS solver step.
+        virtual void stepPostSolver(const double dt);
+        /// @brief   Refreshes the outputs of all registered monitors.
+        void         update();
+        /// @brief   Returns the number of registered monitors.
+        int          getNumMonitors() const;
+
+    protected:
+        std::vector<GunnsFluidVolumeMonitor*> mMonitors;     /**< ** (--) trick_chkpnt_io(**) Registered monitors. */
+        int                       mDecimation;               /**<    (--)                     Number of post-solver steps between batch refreshes, or 0 to never refresh in the step. */
+        int                       mStepCount;                /**< *o (--) trick_chkpnt_io(**) Post-solver steps since the last batch refresh. */
+        std::vector<int>          mSharedIndex;              /**< ** (--) trick_chkpnt_io(**) Index of the first registered monitor of each monitor's node at initialization. */
+        /// @brief   Validates the supplied configuration data.
+        const GunnsFluidVolumeMonitorGroupConfigData* validateConfig(const GunnsNetworkSpotterConfigData* config);
+        /// @brief   Validates the supplied input data.
+        const GunnsFluidVolumeMonitorGroupInputData*  validateInput (const GunnsNetworkSpotterInputData* input);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidVolumeMonitorGroup(const GunnsFluidVolumeMonitorGroup& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidVolumeMonitorGroup& operator =(const GunnsFluidVolumeMonitorGroup& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of registered monitors.
+///
+/// @details  Returns the number of monitors registered with this group.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsFluidVolumeMonitorGroup::getNumMonitors() const
+{
+    return static_cast<int>(mMonitors.size());
+}
+
+#endif
@@ -0,0 +1,331 @@
+/**
+@file
+@brief     GUNNS Link Profiler implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((core/GunnsBasicLink.o)
+   (simulation/hs/TsHsMsg.o)
+   (simulation/timer/TsTimingService.o)
+   (software/exceptions/TsInitializationException.o))
+*/
+
+#include "GunnsLinkProfiler.hh"
+#include "core/GunnsBasicLink.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <algorithm>
+#include <iomanip>
+#include <typeinfo>
+#ifdef __GNUG__
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Link Profiler.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsLinkProfiler::GunnsLinkProfiler()
+    :
+    mName(),
+    mNumLinks(0),
+    mLinks(0),
+    mEnabled(false),
+    mSamplePeriod(1),
+    mStepCounter(0),
+    mSampling(false),
+    mSampledSteps(0),
+    mClassNames(),
+    mLinkClasses(),
+    mTicks(),
+    mCounts()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Link Profiler.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsLinkProfiler::~GunnsLinkProfiler()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name     (--) Instance name for self-identification in outputs.
+/// @param[in] numLinks (--) Number of links in the network.
+/// @param[in] links    (--) Array of pointers to the network links.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Link Profiler with the network links, maps each link to its
+///           class, and clears the profile.  The enabled state and sample period are kept.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLinkProfiler::initialize(const std::string& name, const int numLinks, GunnsBasicLink** links)
+{
+    mName = name;
+
+    /// - Throw on missing links.
+    if (numLinks > 0 and not links) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "missing links array.");
+    }
+    mNumLinks = std::max(0, numLinks);
+    mLinks    = links;
+
+    /// - Map each link to its class, adding each class the first time it's found.
+    mClassNames.clear();
+    mLinkClasses.clear();
+    for (int link = 0; link < mNumLinks; ++link) {
+        const std::string className = findClassName(mLinks[link]);
+        const std::vector<std::string>::const_iterator it =
+                std::find(mClassNames.begin(), mClassNames.end(), className);
+        if (it == mClassNames.end()) {
+            mLinkClasses.push_back(static_cast<int>(mClassNames.size()));
+            mClassNames.push_back(className);
+        } else {
+            mLinkClasses.push_back(static_cast<int>(it - mClassNames.begin()));
+        }
+    }
+
+    mTicks.assign (mNumLinks * NUM_CALLS, 0);
+    mCounts.assign(mNumLinks * NUM_CALLS, 0);
+    reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] enabled      (--) Profiling is enabled when true.
+/// @param[in] samplePeriod (--) Number of major steps per sampled step (> 0).
+///
+/// @details  Enables or disables profiling.  When enabled, the next major step is sampled, and
+///           every samplePeriod major steps after that.  An invalid sample period is rejected with
+///           an H&S warning and profiling disabled.  Disabling keeps the accumulated profile.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLinkProfiler::setEnabled(const bool enabled, const int samplePeriod)
+{
+    if (enabled and samplePeriod < 1) {
+        mEnabled = false;
+        GUNNS_WARNING("profiling rejected because of invalid sample period.");
+    } else {
+        mEnabled      = enabled;
+        mSamplePeriod = samplePeriod;
+    }
+    mStepCounter = 0;
+    mSampling    = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Begins a network major step, deciding whether it is sampled.  Every samplePeriod-th
+///           major step is sampled while enabled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLinkProfiler::beginMajorStep()
+{
+    mSampling = false;
+    if (mEnabled) {
+        if (0 == mStepCounter) {
+            mSampling = true;
+            ++mSampledSteps;
+        }
+        if (++mStepCounter >= mSamplePeriod) {
+            mStepCounter = 0;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Clears the accumulated profile and the sampled step count.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLinkProfiler::reset()
+{
+    std::fill(mTicks.begin(),  mTicks.end(),  0);
+    std::fill(mCounts.begin(), mCounts.end(), 0);
+    mSampledSteps = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] linkClass (--) Index of the link class.
+/// @param[in] call      (--) The link method called.
+///
+/// @returns  double (s) Total time of the sampled calls.
+///
+/// @details  Returns the total time of the sampled calls of the given type to all links of the
+///           given class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsLinkProfiler::getClassTime(const int linkClass, const CallType call) const
+{
+    uint64_t ticks = 0;
+    for (int link = 0; link < mNumLinks; ++link) {
+        if (linkClass == mLinkClasses[link]) {
+            ticks += mTicks[link * NUM_CALLS + call];
+        }
+    }
+    return TsTimingService::ticksToSeconds(ticks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] linkClass (--) Index of the link class.
+///
+/// @returns  double (s) Total time of the sampled calls.
+///
+/// @details  Returns the total time of all sampled calls to all links of the given class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsLinkProfiler::getClassTotalTime(const int linkClass) const
+{
+    double total = 0.0;
+    for (int call = 0; call < NUM_CALLS; ++call) {
+        total += getClassTime(linkClass, static_cast<CallType>(call));
+    }
+    return total;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link (--) Index of the link in the network links array.
+///
+/// @returns  double (s) Total time of the sampled calls.
+///
+/// @details  Returns the total time of all sampled calls to the given link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsLinkProfiler::getLinkTotalTime(const int link) const
+{
+    uint64_t ticks = 0;
+    for (int call = 0; call < NUM_CALLS; ++call) {
+        ticks += mTicks[link * NUM_CALLS + call];
+    }
+    return TsTimingService::ticksToSeconds(ticks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] stream   (--) Stream to write to.
+/// @param[in] maxLinks (--) Maximum number of link instances to list.
+///
+/// @details  Writes a ranking of the link classes by their total time, with their times in each
+///           call type and share of the total, followed by the most expensive link instances.
+///           Times are the totals over all sampled major steps, in microseconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLinkProfiler::report(std::ostream& stream, const int maxLinks) const
+{
+    /// - Rank the classes and links by their total times.  Sorting the negated times ranks them
+    ///   from highest, with ties in index order.
+    std::vector<std::pair<double, int> > classRanks;
+    double total = 0.0;
+    for (int linkClass = 0; linkClass < getNumClasses(); ++linkClass) {
+        const double classTime = getClassTotalTime(linkClass);
+        classRanks.push_back(std::make_pair(-classTime, linkClass));
+        total += classTime;
+    }
+    std::sort(classRanks.begin(), classRanks.end());
+    std::vector<std::pair<double, int> > linkRanks;
+    for (int link = 0; link < mNumLinks; ++link) {
+        linkRanks.push_back(std::make_pair(-getLinkTotalTime(link), link));
+    }
+    std::sort(linkRanks.begin(), linkRanks.end());
+    const double share = (total > 0.0) ? 100.0 / total : 0.0;
+
+    const std::ios_base::fmtflags flags = stream.flags();
+    stream << mName << " link profile over " << mSampledSteps << " sampled major steps:" << std::endl;
+    stream << std::setw(5) << "rank" << "  " << std::left << std::setw(40) << "class" << std::right
+           << std::setw(7)  << "links";
+    for (int call = 0; call < NUM_CALLS; ++call) {
+        stream << std::setw(16) << (std::string(getCallName(static_cast<CallType>(call))) + " (us)");
+    }
+    stream << std::setw(14) << "total (us)" << std::setw(9) << "share %" << std::endl;
+    stream << std::fixed << std::setprecision(3);
+    for (unsigned int rank = 0; rank < classRanks.size(); ++rank) {
+        const int linkClass = classRanks[rank].second;
+        const int numLinks  = static_cast<int>(std::count(mLinkClasses.begin(), mLinkClasses.end(),
+                                                          linkClass));
+        stream << std::setw(5) << rank + 1 << "  " << std::left << std::setw(40)
+               << mClassNames[linkClass] << std::right << std::setw(7) << numLinks;
+        for (int call = 0; call < NUM_CALLS; ++call) {
+            stream << std::setw(16) << getClassTime(linkClass, static_cast<CallType>(call)) * 1.0e6;
+        }
+        stream << std::setw(14) << -classRanks[rank].first * 1.0e6
+               << std::setw(9)  << -classRanks[rank].first * share << std::endl;
+    }
+
+    stream << std::setw(5) << "rank" << "  " << std::left << std::setw(40) << "link"
+           << std::setw(40) << "class" << std::right << std::setw(14) << "total (us)"
+           << std::setw(9) << "share %" << std::endl;
+    const int numRanked = std::min(std::max(0, maxLinks), mNumLinks);
+    for (int rank = 0; rank < numRanked; ++rank) {
+        const int link = linkRanks[rank].second;
+        stream << std::setw(5) << rank + 1 << "  " << std::left << std::setw(40)
+               << mLinks[link]->getName() << std::setw(40) << mClassNames[mLinkClasses[link]]
+               << std::right << std::setw(14) << -linkRanks[rank].first * 1.0e6
+               << std::setw(9) << -linkRanks[rank].first * share << std::endl;
+    }
+    stream.flags(flags);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] stream (--) Stream to write to.
+///
+/// @details  Writes a header row and one row for each link and call type that has been sampled, as
+///           comma-separated values: link index, link name, class name, call type, number of calls,
+///           and total time in seconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLinkProfiler::writeTable(std::ostream& stream) const
+{
+    const std::ios_base::fmtflags flags = stream.flags();
+    const std::streamsize   precision = stream.precision();
+    stream << "index,link,class,call,count,seconds" << std::endl;
+    stream << std::scientific << std::setprecision(9);
+    for (int link = 0; link < mNumLinks; ++link) {
+        for (int call = 0; call < NUM_CALLS; ++call) {
+            const int index = link * NUM_CALLS + call;
+            if (mCounts[index] > 0) {
+                stream << link << "," << mLinks[link]->getName() << ","
+                       << mClassNames[mLinkClasses[link]] << ","
+                       << getCallName(static_cast<CallType>(call)) << "," << mCounts[index] << ","
+                       << TsTimingService::ticksToSeconds(mTicks[index]) << std::endl;
+            }
+        }
+    }
+    stream.precision(precision);
+    stream.flags(flags);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] call (--) The link method called.
+///
+/// @returns  const char* (--) Name of the call type.
+///
+/// @details  Returns the name of the link method of the given call type.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char* GunnsLinkProfiler::getCallName(const CallType call)
+{
+    switch (call) {
+        case STEP:            return "step";
+        case MINOR_STEP:      return "minorStep";
+        case COMPUTE_FLOWS:   return "computeFlows";
+        case TRANSPORT_FLOWS: return "transportFlows";
+        default:              return "unknown";
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link (--) Pointer to the link.
+///
+/// @returns  std::string (--) Class name of the link.
+///
+/// @details  Returns the class name of the link's dynamic type, demangled when the GNU C++ ABI is
+///           available, else as given by the compiler's type information.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string GunnsLinkProfiler::findClassName(const GunnsBasicLink* link)
+{
+    if (not link) {
+        return "null";
+    }
+    std::string result = typeid(*link).name();
+#ifdef __GNUG__
+    int   status    = 0;
+    char* demangled = abi::__cxa_demangle(result.c_str(), 0, 0, &status);
+    if (0 == status and demangled) {
+        result = demangled;
+    }
+    free(demangled);
+#endif
+    return result;
+}
@@ -0,0 +1,254 @@
+#ifndef GunnsLinkProfiler_EXISTS
+#define GunnsLinkProfiler_EXISTS
+
+/**
+@file
+@brief     GUNNS Link Profiler declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_PROFILER    GUNNS Link Profiler
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:   (Provides the class for the GUNNS Link Profiler.  This attributes the time spent in the
+            network's calls to the links' step, minorStep, computeFlows and transportFlows methods
+            to each link and link class, to find which link models dominate a network's run time.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Link class names are found from run-time type information, and are demangled with the GNU C++
+   ABI when available.)
+- (The time of composite links' calls to their child links is attributed to the parent link, unless
+   the child links are also in the network's links list.)
+- (Profiling is single-threaded, as are the solver and orchestrators that call it.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsLinkProfiler.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "simulation/timer/TsTimingService.hh"
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Forward-declare pointer types
+class GunnsBasicLink;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Link Profiler Class.
+///
+/// @details  The network solver owns one of these, and the solver and its flow orchestrator wrap
+///           their calls to the link methods with start and stop.  When enabled, every Nth major
+///           step is sampled: each wrapped call's duration, from the TsTimingService clock, is
+///           accumulated to the link and call type.  When disabled or between samples, start and
+///           stop cost only a flag test.
+///
+///           On initialization, each link is mapped to its class by its dynamic type, so the link
+///           totals can be summed by class on demand.  The report method writes a human-readable
+///           ranking of the link classes and the most expensive link instances, and writeTable
+///           writes all link totals as comma-separated values for other tools.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsLinkProfiler
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsLinkProfiler);
+    public:
+        /// @brief   Enumeration of the profiled link method calls.
+        enum CallType {
+            STEP            = 0, ///< GunnsBasicLink::step.
+            MINOR_STEP      = 1, ///< GunnsBasicLink::minorStep.
+            COMPUTE_FLOWS   = 2, ///< GunnsBasicLink::computeFlows.
+            TRANSPORT_FLOWS = 3, ///< GunnsBasicLink::transportFlows.
+            NUM_CALLS       = 4  ///< Number of call types - keep this last!
+        };
+        /// @brief   Default constructs this GUNNS Link Profiler.
+        GunnsLinkProfiler();
+        /// @brief   Default destructs this GUNNS Link Profiler.
+        virtual ~GunnsLinkProfiler();
+        /// @brief   Initializes this GUNNS Link Profiler with the network links.
+        void        initialize(const std::string& name, const int numLinks, GunnsBasicLink** links);
+        /// @brief   Enables or disables profiling, sampling every given number of major steps.
+        void        setEnabled(const bool enabled, const int samplePeriod = 1);
+        /// @brief   Begins a network major step, deciding whether it is sampled.
+        void        beginMajorStep();
+        /// @brief   Returns whether the current major step is being sampled.
+        bool        isSampling() const;
+        /// @brief   Returns the start time of a link call, if sampling.
+        uint64_t    start() const;
+        /// @brief   Accumulates the duration of a link call since the given start time, if sampling.
+        void        stop(const int link, const CallType call, const uint64_t startTime);
+        /// @brief   Clears the accumulated profile.
+        void        reset();
+        /// @brief   Returns the number of sampled major steps.
+        int         getSampledSteps() const;
+        /// @brief   Returns the number of link classes.
+        int         getNumClasses() const;
+        /// @brief   Returns the name of the given link class.
+        const std::string& getClassName(const int linkClass) const;
+        /// @brief   Returns the class index of the given link.
+        int         getLinkClass(const int link) const;
+        /// @brief   Returns the number of calls of the given type to the given link.
+        uint64_t    getLinkCount(const int link, const CallType call) const;
+        /// @brief   Returns the total time of the calls of the given type to the given link.
+        double      getLinkTime(const int link, const CallType call) const;
+        /// @brief   Returns the total time of the calls of the given type to the links of a class.
+        double      getClassTime(const int linkClass, const CallType call) const;
+        /// @brief   Returns the total time of all calls to the links of a class.
+        double      getClassTotalTime(const int linkClass) const;
+        /// @brief   Writes a ranking of link classes and the most expensive links to the stream.
+        void        report(std::ostream& stream, const int maxLinks = 10) const;
+        /// @brief   Writes all link totals to the stream as comma-separated values.
+        void        writeTable(std::ostream& stream) const;
+        /// @brief   Returns the name of the given call type.
+        static const char* getCallName(const CallType call);
+
+    protected:
+        std::string              mName;         /**< *o (--) trick_chkpnt_io(**) Instance name for self-identification in outputs. */
+        int                      mNumLinks;     /**< *o (--) trick_chkpnt_io(**) Number of links in the network. */
+        GunnsBasicLink**         mLinks;        /**< ** (--) trick_chkpnt_io(**) Array of pointers to the network links. */
+        bool                     mEnabled;      /**<    (--)                     Profiling is enabled. */
+        int                      mSamplePeriod; /**<    (--)                     Number of major steps per sampled step. */
+        int                      mStepCounter;  /**<    (--) trick_chkpnt_io(**) Major steps since the last sampled step. */
+        bool                     mSampling;     /**<    (--) trick_chkpnt_io(**) The current major step is being sampled. */
+        int                      mSampledSteps; /**<    (--) trick_chkpnt_io(**) Number of sampled major steps. */
+        std::vector<std::string> mClassNames;   /**< ** (--) trick_chkpnt_io(**) Names of the link classes. */
+        std::vector<int>         mLinkClasses;  /**< ** (--) trick_chkpnt_io(**) Class index of each link. */
+        std::vector<uint64_t>    mTicks;        /**< ** (--) trick_chkpnt_io(**) Total clock ticks of each link and call type, by link then call. */
+        std::vector<uint64_t>    mCounts;       /**< ** (--) trick_chkpnt_io(**) Number of calls to each link of each call type, by link then call. */
+        /// @brief   Returns the class name of the given link.
+        static std::string findClassName(const GunnsBasicLink* link);
+        /// @brief   Returns the total time of all calls to the given link.
+        double      getLinkTotalTime(const int link) const;
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsLinkProfiler(const GunnsLinkProfiler& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsLinkProfiler& operator =(const GunnsLinkProfiler& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the current major step is being sampled.
+///
+/// @details  Returns whether the current major step is being sampled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsLinkProfiler::isSampling() const
+{
+    return mSampling;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  uint64_t (--) Start time in TsTimingService clock ticks, or zero if not sampling.
+///
+/// @details  Returns the start time of a link call, to be passed to stop after the call.  This
+///           doesn't read the clock when not sampling.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint64_t GunnsLinkProfiler::start() const
+{
+    if (mSampling) {
+        return TsTimingService::now();
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link      (--) Index of the link in the network links array.
+/// @param[in] call      (--) The link method called.
+/// @param[in] startTime (--) Start time of the call from the start method.
+///
+/// @details  Accumulates the duration of a link call since the given start time to the link and
+///           call type.  This does nothing when not sampling.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsLinkProfiler::stop(const int link, const CallType call, const uint64_t startTime)
+{
+    if (mSampling) {
+        const int index = link * NUM_CALLS + call;
+        mTicks[index]  += TsTimingService::now() - startTime;
+        ++mCounts[index];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of sampled major steps.
+///
+/// @details  Returns the number of major steps sampled since initialization or the last reset.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsLinkProfiler::getSampledSteps() const
+{
+    return mSampledSteps;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of link classes.
+///
+/// @details  Returns the number of distinct link classes in the network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsLinkProfiler::getNumClasses() const
+{
+    return static_cast<int>(mClassNames.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] linkClass (--) Index of the link class.
+///
+/// @returns  const std::string& (--) Name of the link class.
+///
+/// @details  Returns the name of the given link class.  The index is not checked.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const std::string& GunnsLinkProfiler::getClassName(const int linkClass) const
+{
+    return mClassNames[linkClass];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link (--) Index of the link in the network links array.
+///
+/// @returns  int (--) Index of the link's class.
+///
+/// @details  Returns the class index of the given link.  The index is not checked.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsLinkProfiler::getLinkClass(const int link) const
+{
+    return mLinkClasses[link];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link (--) Index of the link in the network links array.
+/// @param[in] call (--) The link method called.
+///
+/// @returns  uint64_t (--) Number of sampled calls.
+///
+/// @details  Returns the number of sampled calls of the given type to the given link.  The index is
+///           not checked.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint64_t GunnsLinkProfiler::getLinkCount(const int link, const CallType call) const
+{
+    return mCounts[link * NUM_CALLS + call];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link (--) Index of the link in the network links array.
+/// @param[in] call (--) The link method called.
+///
+/// @returns  double (s) Total time of the sampled calls.
+///
+/// @details  Returns the total time of the sampled calls of the given type to the given link.  The
+///           index is not checked.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsLinkProfiler::getLinkTime(const int link, const CallType call) const
+{
+    return TsTimingService::ticksToSeconds(mTicks[link * NUM_CALLS + call]);
+}
+
+#endif
@@ -0,0 +1,198 @@
+/**
+@file
+@brief    GUNNS Network Port Reduction implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (math/linear_algebra/CholeskyLdu.o)
+    (software/exceptions/TsInitializationException.o)
+    (software/exceptions/TsNumericalException.o)
+   )
+*/
+
+#include "GunnsPortReduction.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsNumericalException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Network Port Reduction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsPortReduction::GunnsPortReduction()
+    :
+    mName(),
+    mNumPorts(0),
+    mNodeMap(0),
+    mImpedance(0),
+    mAdmittance(0),
+    mSource(0),
+    mExcludedAdmittance(0),
+    mExcludedSource(0),
+    mWorkMatrix(0),
+    mSolver(),
+    mValid(false),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Network Port Reduction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsPortReduction::~GunnsPortReduction()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes dynamic memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPortReduction::cleanup()
+{
+    TS_DELETE_ARRAY(mWorkMatrix);
+    TS_DELETE_ARRAY(mExcludedSource);
+    TS_DELETE_ARRAY(mExcludedAdmittance);
+    TS_DELETE_ARRAY(mSource);
+    TS_DELETE_ARRAY(mAdmittance);
+    TS_DELETE_ARRAY(mImpedance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name     (--) Instance name for messages and dynamic array names.
+/// @param[in] numPorts (--) Number of port nodes.
+/// @param[in] nodeMap  (--) Pointer to the owner's port to network node map, of size numPorts.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Network Port Reduction.  The node map is kept by pointer so that
+///           the reduction follows the owner's port assignments as they change in run-time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPortReduction::initialize(const std::string& name, const int numPorts, const int* nodeMap)
+{
+    /// - Reset the init flag.
+    mInitFlag = false;
+
+    /// - Initialize & validate the instance name.
+    GUNNS_NAME_ERREX("GunnsPortReduction", name);
+
+    /// - Throw an exception on number of ports < 1.
+    if (numPorts < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "number of ports < 1.");
+    }
+
+    /// - Throw an exception on null node map.
+    if (not nodeMap) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "null node map.");
+    }
+
+    mNumPorts = numPorts;
+    mNodeMap  = nodeMap;
+
+    /// - Allocate & zero the matrices & vectors.
+    cleanup();
+    TS_NEW_PRIM_ARRAY_EXT(mImpedance,          mNumPorts * mNumPorts, double, mName + ".mImpedance");
+    TS_NEW_PRIM_ARRAY_EXT(mAdmittance,         mNumPorts * mNumPorts, double, mName + ".mAdmittance");
+    TS_NEW_PRIM_ARRAY_EXT(mSource,             mNumPorts,             double, mName + ".mSource");
+    TS_NEW_PRIM_ARRAY_EXT(mExcludedAdmittance, mNumPorts * mNumPorts, double, mName + ".mExcludedAdmittance");
+    TS_NEW_PRIM_ARRAY_EXT(mExcludedSource,     mNumPorts,             double, mName + ".mExcludedSource");
+    TS_NEW_PRIM_ARRAY_EXT(mWorkMatrix,         mNumPorts * mNumPorts, double, mName + ".mWorkMatrix");
+    for (int i = 0; i < mNumPorts; ++i) {
+        mSource[i]         = 0.0;
+        mExcludedSource[i] = 0.0;
+        for (int j = 0; j < mNumPorts; ++j) {
+            mImpedance[i*mNumPorts + j]          = 0.0;
+            mAdmittance[i*mNumPorts + j]         = 0.0;
+            mExcludedAdmittance[i*mNumPorts + j] = 0.0;
+            mWorkMatrix[i*mNumPorts + j]         = 0.0;
+        }
+    }
+    mValid = false;
+
+    /// - Set the init flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] admittance (--) Row-major k x k admittance contributions to exclude, or null for none.
+/// @param[in] source     (--) Size k source vector contributions to exclude, or null for none.
+///
+/// @details  Sets the port admittance & source contributions, that are included in the network's
+///           solution, to be excluded from the equivalent.  Owning interface links call this with
+///           their own stamps, so that the equivalent they export doesn't include the effects of the
+///           partner network that they are already modeling.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPortReduction::setExcludedContributions(const double* admittance, const double* source)
+{
+    for (int i = 0; i < mNumPorts; ++i) {
+        mExcludedSource[i] = source ? source[i] : 0.0;
+        for (int j = 0; j < mNumPorts; ++j) {
+            mExcludedAdmittance[i*mNumPorts + j] = admittance ? admittance[i*mNumPorts + j] : 0.0;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] port     (--) Port index of the unit flux.
+/// @param[in] solution (--) Network potential vector solved for a unit flux source at the port's node.
+///
+/// @details  Stores one column of the Thevenin impedance matrix: the potential of each port node in
+///           response to a unit flux into the given port's node, with no other sources.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPortReduction::loadImpedanceColumn(const int port, const double* solution)
+{
+    for (int i = 0; i < mNumPorts; ++i) {
+        mImpedance[i*mNumPorts + port] = solution[mNodeMap[i]];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] potential (--) Network potential vector solved without perturbation.
+///
+/// @details  Computes the Norton equivalent admittance & source from the loaded Thevenin impedance
+///           matrix and the solved port node potentials.  The impedance matrix is symmetrized to
+///           remove round-off before inversion.  If the impedance matrix is singular, such as when
+///           two ports map to the same node, or a port node is the Ground node, the equivalent is
+///           flagged invalid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPortReduction::computeNorton(const double* potential)
+{
+    /// - Symmetrize the impedance matrix and copy it to the work matrix for inversion.
+    for (int i = 0; i < mNumPorts; ++i) {
+        mWorkMatrix[i*mNumPorts + i] = mImpedance[i*mNumPorts + i];
+        for (int j = i + 1; j < mNumPorts; ++j) {
+            const double z = 0.5 * (mImpedance[i*mNumPorts + j] + mImpedance[j*mNumPorts + i]);
+            mImpedance[i*mNumPorts + j]  = z;
+            mImpedance[j*mNumPorts + i]  = z;
+            mWorkMatrix[i*mNumPorts + j] = z;
+            mWorkMatrix[j*mNumPorts + i] = z;
+        }
+    }
+
+    /// - Invert the impedance matrix in place in the work matrix.  The decomposition throws if the
+    ///   matrix isn't positive-definite, in which case there is no valid equivalent.
+    try {
+        mSolver.Decompose(mWorkMatrix, mNumPorts);
+        mSolver.Invert(mWorkMatrix, mNumPorts);
+    } catch (TsNumericalException&) {
+        mValid = false;
+        return;
+    }
+
+    /// - Norton admittance is the Schur complement less the excluded admittance, and the Norton
+    ///   source is the flux that the Schur complement would draw from the solved port potentials,
+    ///   less the excluded source.
+    for (int i = 0; i < mNumPorts; ++i) {
+        mSource[i] = -mExcludedSource[i];
+        for (int j = 0; j < mNumPorts; ++j) {
+            const double y = mWorkMatrix[i*mNumPorts + j];
+            mAdmittance[i*mNumPorts + j] = y - mExcludedAdmittance[i*mNumPorts + j];
+            mSource[i] += y * potential[mNodeMap[j]];
+        }
+    }
+    mValid = true;
+}
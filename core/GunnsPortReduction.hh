@@ -0,0 +1,195 @@
+#ifndef GunnsPortReduction_EXISTS
+#define GunnsPortReduction_EXISTS
+
+/**
+@file
+@brief    GUNNS Network Port Reduction declarations
+
+@defgroup  TSM_GUNNS_CORE_PORT_REDUCTION    GUNNS Network Port Reduction
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Reduces a GUNNS network to its Thevenin and Norton equivalents at a set of interface nodes, so
+   the equivalent can be exported to a partner network as an implicit multi-port boundary.)
+
+REFERENCE:
+- (Schur complement reduction of the admittance matrix onto a subset of nodes.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The network must be in NORMAL solver mode and solved by Cholesky decomposition, since the
+   reduction re-uses the network's own matrix decomposition.)
+- (The interface nodes must not be the Ground node.)
+- (Contributions to be excluded from the equivalent, such as the partner's boundary effects
+   applied by the interface links themselves, must only involve the interface nodes.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsPortReduction.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "math/linear_algebra/CholeskyLdu.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Network Port Reduction
+///
+/// @details  This holds the reduction of a network onto k interface (port) nodes.  After the
+///           network solves, Gunns fills in the k x k Thevenin impedance matrix [Z] among the port
+///           nodes by solving [A]{z} = {e_i} for a unit flux source {e_i} at each port node, with
+///           one back-substitution of its existing matrix decomposition per port.  Each solution
+///           {z} is a column of the inverse admittance matrix, and [Z] is their port node rows.
+///           The inverse of [Z] is the Schur complement of the admittance matrix on the port nodes,
+///           i.e. the Norton admittance [Y] seen looking into the network at those nodes.  The Norton source {J} follows from the solved port potentials {p}:
+///
+///               [Y] = [Z]^-1 - [Ye]
+///               {J} = [Z]^-1 {p} - {we}
+///
+///           where [Ye] and {we} are the admittance & source contributions to the port nodes that
+///           are to be left out of the equivalent, set by the owner with setExcludedContributions.
+///           The network then obeys {q} = [Y]{p} - {J} at its ports, where {q} is the flux into the
+///           network from outside, and this holds for any {p}, including all of the cross-coupling
+///           between ports through the network.
+///
+///           Register this with the network solver with Gunns::addPortReduction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsPortReduction
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsPortReduction);
+    public:
+        /// @brief  Default constructs this GUNNS Network Port Reduction.
+        GunnsPortReduction();
+        /// @brief  Default destructs this GUNNS Network Port Reduction.
+        virtual ~GunnsPortReduction();
+        /// @brief  Initializes this GUNNS Network Port Reduction.
+        void          initialize(const std::string& name, const int numPorts, const int* nodeMap);
+        /// @brief  Sets the port contributions to be excluded from the equivalent.
+        void          setExcludedContributions(const double* admittance, const double* source);
+        /// @brief  Stores one column of the Thevenin impedance matrix from a unit flux solution.
+        void          loadImpedanceColumn(const int port, const double* solution);
+        /// @brief  Computes the Norton equivalent from the loaded impedance matrix.
+        void          computeNorton(const double* potential);
+        /// @brief  Flags the equivalent as unavailable this pass.
+        void          invalidate();
+        /// @brief  Returns whether the equivalent is valid.
+        bool          isValid() const;
+        /// @brief  Returns the number of ports.
+        int           getNumPorts() const;
+        /// @brief  Returns the network node index of the given port.
+        int           getNode(const int port) const;
+        /// @brief  Returns the Thevenin impedance matrix.
+        const double* getImpedance() const;
+        /// @brief  Returns the Norton admittance matrix.
+        const double* getAdmittance() const;
+        /// @brief  Returns the Norton source vector.
+        const double* getSource() const;
+
+    protected:
+        std::string mName;               /**< *o (--) trick_chkpnt_io(**) Instance name for messages. */
+        int         mNumPorts;           /**< *o (--) trick_chkpnt_io(**) Number of port nodes. */
+        const int*  mNodeMap;            /**< ** (--) trick_chkpnt_io(**) Network node index of each port. */
+        double*     mImpedance;          /**<    (--) trick_chkpnt_io(**) Thevenin impedance matrix among the ports. */
+        double*     mAdmittance;         /**<    (--) trick_chkpnt_io(**) Norton admittance matrix among the ports. */
+        double*     mSource;             /**<    (--) trick_chkpnt_io(**) Norton source vector at the ports. */
+        double*     mExcludedAdmittance; /**<    (--) trick_chkpnt_io(**) Port admittance contributions excluded from the equivalent. */
+        double*     mExcludedSource;     /**<    (--) trick_chkpnt_io(**) Port source contributions excluded from the equivalent. */
+        double*     mWorkMatrix;         /**< ** (--) trick_chkpnt_io(**) Working matrix for the impedance inversion. */
+        CholeskyLdu mSolver;             /**< ** (--) trick_chkpnt_io(**) Solver for the impedance inversion. */
+        bool        mValid;              /**<    (--) trick_chkpnt_io(**) The equivalent is valid this pass. */
+        bool        mInitFlag;           /**< *o (--) trick_chkpnt_io(**) Initialization complete flag. */
+        /// @brief  Deletes dynamic memory.
+        void cleanup();
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsPortReduction(const GunnsPortReduction&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        GunnsPortReduction& operator =(const GunnsPortReduction&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Flags the equivalent as unavailable, such as when the network didn't converge or isn't
+///           solved by matrix decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsPortReduction::invalidate()
+{
+    mValid = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the equivalent was computed on the last network pass.
+///
+/// @details  Returns whether the equivalent is valid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsPortReduction::isValid() const
+{
+    return mValid;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of ports.
+///
+/// @details  Returns the number of ports.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsPortReduction::getNumPorts() const
+{
+    return mNumPorts;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] port (--) Port index.
+///
+/// @returns  int (--) Network node index of the port.
+///
+/// @details  Returns the network node index that the given port is currently mapped to.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsPortReduction::getNode(const int port) const
+{
+    return mNodeMap[port];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  const double* (--) Thevenin impedance matrix, row-major k x k.
+///
+/// @details  Returns the Thevenin impedance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* GunnsPortReduction::getImpedance() const
+{
+    return mImpedance;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  const double* (--) Norton admittance matrix, row-major k x k.
+///
+/// @details  Returns the Norton admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* GunnsPortReduction::getAdmittance() const
+{
+    return mAdmittance;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  const double* (--) Norton source vector, size k.
+///
+/// @details  Returns the Norton source vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* GunnsPortReduction::getSource() const
+{
+    return mSource;
+}
+
+#endif
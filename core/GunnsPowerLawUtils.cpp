@@ -0,0 +1,90 @@
+/**
+@file
+@brief     GUNNS Power Law Utilities implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+    ()
+*/
+
+#include "GunnsPowerLawUtils.hh"
+#include "math/MsMath.hh"
+#include <algorithm>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] deltaPotential (--) Potential drop across the link.
+/// @param[in] conductance    (--) Conductance G of the power law.
+/// @param[in] exponent       (--) Exponent X of the power law, limited away from zero.
+///
+/// @returns  double (--) Flux through the link, with the sign of the potential drop.
+///
+/// @details  Returns w = (G*|dP|)^(1/X), with the sign of dP.  Zero conductance or potential drop
+///           gives zero flux.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsPowerLawUtils::computeFlux(const double deltaPotential,
+                                       const double conductance,
+                                       const double exponent)
+{
+    const double product = conductance * std::fabs(deltaPotential);
+    if (product <= 0.0) {
+        return 0.0;
+    }
+    const double flux = std::pow(product, 1.0 / MsMath::innerLimit(-0.001, exponent, 0.001));
+    return (deltaPotential < 0.0) ? -flux : flux;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] admittance                (--) Linearized admittance A.
+/// @param[out] source                    (--) Linearized source flux S, positive in the direction of
+///                                            positive potential drop.
+/// @param[in]  deltaPotential            (--) Potential drop across the link to linearize at.
+/// @param[in]  conductance               (--) Conductance G of the power law.
+/// @param[in]  exponent                  (--) Exponent X of the power law, limited away from zero.
+/// @param[in]  minLinearizationPotential (--) Minimum potential drop magnitude to linearize at.
+/// @param[in]  type                      (--) The linearization type.
+///
+/// @details  Linearizes the power law as w = A*dP + S at the given potential drop.  Potential drops
+///           smaller in magnitude than the minimum, and any case where the tangent slope isn't
+///           positive, use the secant at the minimum so the admittance stays positive.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPowerLawUtils::linearize(double&             admittance,
+                                   double&             source,
+                                   const double        deltaPotential,
+                                   const double        conductance,
+                                   const double        exponent,
+                                   const double        minLinearizationPotential,
+                                   const Linearization type)
+{
+    const double dP = std::max(std::fabs(deltaPotential), minLinearizationPotential);
+    if (dP <= 0.0) {
+        admittance = 0.0;
+        source     = 0.0;
+        return;
+    }
+    const double flux = computeFlux(dP, conductance, exponent);
+
+    /// - Tangent line at the actual potential drop, for the Newton-Raphson companion model:
+    ///     w     = (G*dP)^(1/X)
+    ///     dw/dP = (1/X)*G*(G*dP)^(1/X - 1) = w/(X*dP) = A
+    ///     S     = w - A*dP = w*(1 - 1/X),
+    ///   with the sign of the source following the potential drop.
+    if (NEWTON == type and std::fabs(deltaPotential) >= minLinearizationPotential) {
+        const double expInv  = 1.0 / MsMath::innerLimit(-0.001, exponent, 0.001);
+        const double tangent = flux * expInv / dP;
+        if (tangent > 0.0) {
+            admittance = tangent;
+            source     = flux * (1.0 - expInv);
+            if (deltaPotential < 0.0) {
+                source = -source;
+            }
+            return;
+        }
+    }
+
+    /// - Secant through the origin.
+    admittance = flux / dP;
+    source     = 0.0;
+}
@@ -0,0 +1,86 @@
+#ifndef GunnsPowerLawUtils_EXISTS
+#define GunnsPowerLawUtils_EXISTS
+
+/**
+@file
+@brief     GUNNS Power Law Utilities declarations
+
+@defgroup  TSM_GUNNS_CORE_POWER_LAW_UTILS    GUNNS Power Law Utilities
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (This class contains utility methods for links whose flux is a power function of the potential
+   drop across them, for linearizing the power law into the network system of equations.  These
+   are independent of the link aspect, so electrical, thermal and fluid links can share them.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The power law is symmetric: reversing the potential drop reverses the flux.)
+
+LIBRARY_DEPENDENCY:
+- ((GunnsPowerLawUtils.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Power Law Utilities
+///
+/// @details  The power law relates the potential drop dP across a link to its flux w by:
+///
+///             dP = w^X / G,   or   w = (G*dP)^(1/X),
+///
+///           with conductance G and exponent X.  A link stamps the law into the network as a
+///           linear admittance A and source flux S, so that w = A*dP + S, relinearizing each minor
+///           step of a non-linear network.  Two linearizations are offered:
+///
+///           - SECANT: the line through the origin and the curve at the current dP, with no
+///             source.  This always gives a positive admittance and is stable in transients, but
+///             the network converges linearly, slowly for X far from 1.
+///           - NEWTON: the tangent line to the curve at the current dP, as the Newton-Raphson
+///             companion model, with the analytic slope A = w/(X*dP) and source S = w*(1 - 1/X).
+///             The network converges quadratically near the solution.
+///
+///           Both linearizations are limited to the secant at a minimum potential drop near zero,
+///           where the tangent slope is infinite for X > 1 or zero for X < 1.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsPowerLawUtils
+{
+    public:
+        /// @brief Enumeration of the power law linearization types.
+        enum Linearization {SECANT = 0,  ///< Secant through the origin, no source.
+                            NEWTON = 1}; ///< Newton-Raphson companion tangent line and source.
+        /// @brief Computes the flux of the power law at the given potential drop.
+        static double computeFlux(const double deltaPotential,
+                                  const double conductance,
+                                  const double exponent);
+        /// @brief Linearizes the power law at the given potential drop.
+        static void   linearize(double&             admittance,
+                                double&             source,
+                                const double        deltaPotential,
+                                const double        conductance,
+                                const double        exponent,
+                                const double        minLinearizationPotential,
+                                const Linearization type);
+
+    private:
+        /// @brief Default constructor unavailable since declared private and not implemented.
+        GunnsPowerLawUtils();
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsPowerLawUtils(const GunnsPowerLawUtils& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsPowerLawUtils& operator =(const GunnsPowerLawUtils& that);
+};
+
+/// @}
+
+#endif
@@ -0,0 +1,596 @@
+/**
+@file
+@brief     GUNNS Spotter Scheduler implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((GunnsNetworkSpotter.o)
+   (simulation/hs/TsHsMsg.o)
+   (software/exceptions/TsInitializationException.o)
+   (software/exceptions/TsUnknownException.o))
+*/
+
+#include "GunnsSpotterScheduler.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsUnknownException.hh"
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name        (--)  Instance name for self-identification in messages.
+/// @param[in]  numThreads  (--)  Number of threads to step each phase on, including the caller's.
+///
+/// @details  Default constructs this GUNNS Spotter Scheduler configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSpotterSchedulerConfigData::GunnsSpotterSchedulerConfigData(const std::string& name,
+                                                                 const int          numThreads)
+    :
+    GunnsNetworkSpotterConfigData(name),
+    mNumThreads(numThreads)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Spotter Scheduler configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSpotterSchedulerConfigData::~GunnsSpotterSchedulerConfigData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Spotter Scheduler input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSpotterSchedulerInputData::GunnsSpotterSchedulerInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Spotter Scheduler input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSpotterSchedulerInputData::~GunnsSpotterSchedulerInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Default constructs this GUNNS Spotter Scheduler.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSpotterScheduler::GunnsSpotterScheduler()
+    :
+    GunnsNetworkSpotter(),
+    mEntries(),
+    mDependencies(),
+    mPhases(),
+    mNumThreads(1),
+    mWorkers(),
+    mMutex(),
+    mWorkReady(),
+    mWorkDone(),
+    mGeneration(0),
+    mStopping(false),
+    mWorkPhase(0),
+    mWorkType(PRE_SOLVER),
+    mWorkDt(0.0),
+    mWorkNext(0),
+    mWorkFinished(0),
+    mWorkFailed(-1)
+{
+    pthread_mutex_init(&mMutex, NULL);
+    pthread_cond_init(&mWorkReady, NULL);
+    pthread_cond_init(&mWorkDone, NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Spotter Scheduler, stopping the worker threads.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSpotterScheduler::~GunnsSpotterScheduler()
+{
+    stopWorkers();
+    pthread_cond_destroy(&mWorkDone);
+    pthread_cond_destroy(&mWorkReady);
+    pthread_mutex_destroy(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  spotter  (--)  The spotter to register with this scheduler.
+///
+/// @details  Adds the given spotter to this scheduler, unless it is already registered.  This must
+///           be called before this scheduler is initialized.  Registration order is the order the
+///           spotters are stepped in when their declarations conflict and there is no explicit
+///           dependency between them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::addSpotter(GunnsNetworkSpotter& spotter)
+{
+    if (findEntry(&spotter) < 0) {
+        Entry entry;
+        entry.mSpotter = &spotter;
+        entry.mPhase   = 0;
+        mEntries.push_back(entry);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  spotter  (--)  The registered spotter that reads the object.
+/// @param[in]  object   (--)  Address of the object read, such as a node or link.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Declares that the given spotter reads the given object in its step methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::addRead(const GunnsNetworkSpotter& spotter, const void* object)
+{
+    const int index = findEntry(&spotter);
+    if (index < 0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "spotter " + spotter.getName() + " is not registered.");
+    }
+    mEntries[index].mReads.push_back(object);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  spotter  (--)  The registered spotter that writes the object.
+/// @param[in]  object   (--)  Address of the object written, such as a node or link.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Declares that the given spotter writes the given object in its step methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::addWrite(const GunnsNetworkSpotter& spotter, const void* object)
+{
+    const int index = findEntry(&spotter);
+    if (index < 0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "spotter " + spotter.getName() + " is not registered.");
+    }
+    mEntries[index].mWrites.push_back(object);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  first   (--)  The spotter to step first.
+/// @param[in]  second  (--)  The spotter to step after the first.
+///
+/// @details  Declares that the second spotter must be stepped in a later phase than the first,
+///           whether or not their data accesses conflict.  This overrides registration order.  The
+///           spotters are checked for registration when this scheduler is initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::addDependency(const GunnsNetworkSpotter& first,
+                                          const GunnsNetworkSpotter& second)
+{
+    mDependencies.push_back(&first);
+    mDependencies.push_back(&second);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+/// @param[in]  inputData   (--)  Instance input data.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Spotter Scheduler with its configuration and input data, sorts
+///           the registered spotters into phases and starts the worker threads.  This doesn't
+///           initialize the scheduled spotters, which the network does as usual.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::initialize(const GunnsNetworkSpotterConfigData* configData,
+                                       const GunnsNetworkSpotterInputData*  inputData)
+{
+    /// - Initialize the base class.
+    GunnsNetworkSpotter::initialize(configData, inputData);
+
+    /// - Reset the init flag.
+    mInitFlag = false;
+
+    /// - Validate config & input data.
+    const GunnsSpotterSchedulerConfigData* config = validateConfig(configData);
+    validateInput(inputData);
+
+    /// - Throw an exception if there are no spotters.
+    if (mEntries.empty()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "no spotters have been added.");
+    }
+
+    /// - Stop any workers from a previous initialization, then sort the spotters into phases and
+    ///   start the workers.
+    stopWorkers();
+    mPhases.clear();
+    buildPhases();
+    mNumThreads = config->mNumThreads;
+    startWorkers();
+
+    /// - Set the init flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+///
+/// @returns  GunnsSpotterSchedulerConfigData (--) Type-casted and validated config data pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base config data class pointer to this spotter's config data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsSpotterSchedulerConfigData* GunnsSpotterScheduler::validateConfig(
+        const GunnsNetworkSpotterConfigData* config)
+{
+    const GunnsSpotterSchedulerConfigData* result =
+            dynamic_cast<const GunnsSpotterSchedulerConfigData*>(config);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "Bad config data pointer type.");
+    }
+
+    /// - Throw an exception if the number of threads < 1.
+    if (result->mNumThreads < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "number of threads < 1.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  inputData  (--)  Instance input data.
+///
+/// @returns  GunnsSpotterSchedulerInputData (--) Type-casted and validated input data pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base input data class pointer to this spotter's input data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsSpotterSchedulerInputData* GunnsSpotterScheduler::validateInput(
+        const GunnsNetworkSpotterInputData* input)
+{
+    const GunnsSpotterSchedulerInputData* result =
+            dynamic_cast<const GunnsSpotterSchedulerInputData*>(input);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
+                    "Bad input data pointer type.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  spotter  (--)  The spotter to find.
+///
+/// @returns  int (--) Index of the spotter in mEntries, or -1 if it isn't registered.
+///
+/// @details  Returns the index of the given spotter in the registered spotters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int GunnsSpotterScheduler::findEntry(const GunnsNetworkSpotter* spotter) const
+{
+    for (unsigned int i = 0; i < mEntries.size(); ++i) {
+        if (spotter == mEntries[i].mSpotter) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  spotter  (--)  The spotter to get the phase of.
+///
+/// @returns  int (--) Phase the spotter is stepped in, or -1 if it isn't registered.
+///
+/// @details  Returns the index of the phase the given spotter is stepped in.  This is only valid
+///           after this scheduler is initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int GunnsSpotterScheduler::getPhase(const GunnsNetworkSpotter& spotter) const
+{
+    const int index = findEntry(&spotter);
+    if (index < 0) {
+        return -1;
+    }
+    return mEntries[index].mPhase;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  a  (--)  The first spotter entry.
+/// @param[in]  b  (--)  The second spotter entry.
+///
+/// @returns  bool (--) True if the spotters can't be stepped at the same time.
+///
+/// @details  Returns whether either spotter writes an object the other reads or writes.  A spotter
+///           that declares no objects conflicts with every other spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsSpotterScheduler::isConflict(const Entry& a, const Entry& b) const
+{
+    if ((a.mReads.empty() and a.mWrites.empty()) or (b.mReads.empty() and b.mWrites.empty())) {
+        return true;
+    }
+    for (unsigned int i = 0; i < a.mWrites.size(); ++i) {
+        if (b.mReads.end()  != std::find(b.mReads.begin(),  b.mReads.end(),  a.mWrites[i]) or
+            b.mWrites.end() != std::find(b.mWrites.begin(), b.mWrites.end(), a.mWrites[i])) {
+            return true;
+        }
+    }
+    for (unsigned int i = 0; i < a.mReads.size(); ++i) {
+        if (b.mWrites.end() != std::find(b.mWrites.begin(), b.mWrites.end(), a.mReads[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Sorts the spotters into phases.  First the spotters are put in a stepping order that
+///           honors the explicit dependencies, taking the earliest registered of the spotters that
+///           are free to go next, so without dependencies this is registration order.  Then, in
+///           that order, each spotter goes in the phase after the latest phase of the spotters
+///           before it that it depends on or conflicts with.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::buildPhases()
+{
+    const int numSpotters = static_cast<int>(mEntries.size());
+
+    /// - Map the explicit dependencies to the spotter indexes.
+    std::vector<std::vector<int> > successors(numSpotters);
+    std::vector<int>               numPredecessors(numSpotters, 0);
+    for (unsigned int i = 0; i < mDependencies.size(); i += 2) {
+        const int first  = findEntry(mDependencies[i]);
+        const int second = findEntry(mDependencies[i + 1]);
+        if (first < 0 or second < 0) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "a dependency has a spotter that is not registered.");
+        }
+        if (first == second) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "spotter " + mEntries[first].mSpotter->getName() + " depends on itself.");
+        }
+        successors[first].push_back(second);
+        ++numPredecessors[second];
+    }
+
+    /// - Find the stepping order, throwing an exception if the dependencies are circular.
+    std::vector<int>  order;
+    std::vector<bool> ordered(numSpotters, false);
+    while (static_cast<int>(order.size()) < numSpotters) {
+        int next = 0;
+        while (next < numSpotters and (ordered[next] or numPredecessors[next] > 0)) {
+            ++next;
+        }
+        if (next == numSpotters) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "spotter dependencies are circular.");
+        }
+        order.push_back(next);
+        ordered[next] = true;
+        for (unsigned int i = 0; i < successors[next].size(); ++i) {
+            --numPredecessors[successors[next][i]];
+        }
+    }
+
+    /// - Assign the phases in stepping order.
+    int numPhases = 0;
+    for (int i = 0; i < numSpotters; ++i) {
+        Entry& entry = mEntries[order[i]];
+        entry.mPhase = 0;
+        for (int j = 0; j < i; ++j) {
+            const Entry& before    = mEntries[order[j]];
+            const bool   dependent = successors[order[j]].end() != std::find(
+                    successors[order[j]].begin(), successors[order[j]].end(), order[i]);
+            if (dependent or isConflict(before, entry)) {
+                entry.mPhase = std::max(entry.mPhase, before.mPhase + 1);
+            }
+        }
+        numPhases = std::max(numPhases, entry.mPhase + 1);
+    }
+
+    /// - List the spotters in each phase in registration order.
+    mPhases.resize(numPhases);
+    for (int i = 0; i < numSpotters; ++i) {
+        mPhases[mEntries[i].mPhase].push_back(i);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Starts enough worker threads to step the largest phase with the caller's thread, up to
+///           the configured number of threads.  If a thread can't be created, the phases are shared
+///           among the workers that were.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::startWorkers()
+{
+    unsigned int maxPhaseSize = 0;
+    for (unsigned int i = 0; i < mPhases.size(); ++i) {
+        maxPhaseSize = std::max(maxPhaseSize, static_cast<unsigned int>(mPhases[i].size()));
+    }
+    const unsigned int numWorkers =
+            std::min(static_cast<unsigned int>(mNumThreads), maxPhaseSize) - 1;
+
+    mStopping = false;
+    for (unsigned int i = 0; i < numWorkers; ++i) {
+        pthread_t thread;
+        if (0 != pthread_create(&thread, NULL, workerEntry, this)) {
+            GUNNS_WARNING("could only start " << i << " of " << numWorkers << " worker threads.");
+            break;
+        }
+        mWorkers.push_back(thread);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tells the worker threads to exit and waits for them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::stopWorkers()
+{
+    if (mWorkers.empty()) {
+        return;
+    }
+    pthread_mutex_lock(&mMutex);
+    mStopping = true;
+    pthread_cond_broadcast(&mWorkReady);
+    pthread_mutex_unlock(&mMutex);
+
+    for (unsigned int i = 0; i < mWorkers.size(); ++i) {
+        pthread_join(mWorkers[i], NULL);
+    }
+    mWorkers.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step.
+///
+/// @details  Steps the scheduled spotters' stepPreSolver methods, phase by phase.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::stepPreSolver(const double dt)
+{
+    stepPhases(PRE_SOLVER, dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step.
+///
+/// @details  Steps the scheduled spotters' stepPostSolver methods, phase by phase.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::stepPostSolver(const double dt)
+{
+    stepPhases(POST_SOLVER, dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  type  (--)  Which step method to call.
+/// @param[in]  dt    (s)   Execution time step.
+///
+/// @throws   TsUnknownException
+///
+/// @details  Steps the phases in order.  Phases with one spotter are stepped directly on this
+///           thread, so any exceptions pass straight through to the caller.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::stepPhases(const StepType type, const double dt)
+{
+    for (unsigned int phase = 0; phase < mPhases.size(); ++phase) {
+        if (mWorkers.empty() or mPhases[phase].size() < 2) {
+            for (unsigned int i = 0; i < mPhases[phase].size(); ++i) {
+                stepSpotter(mPhases[phase][i], type, dt);
+            }
+        } else {
+            stepPhaseParallel(mPhases[phase], type, dt);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  phase  (--)  Indexes of the spotters in the phase.
+/// @param[in]  type   (--)  Which step method to call.
+/// @param[in]  dt     (s)   Execution time step.
+///
+/// @throws   TsUnknownException
+///
+/// @details  Hands the phase to the worker threads, helps step it on this thread, and waits for all
+///           of its spotters to finish.  Throws if any of the spotters threw.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::stepPhaseParallel(const std::vector<int>& phase, const StepType type,
+                                              const double dt)
+{
+    pthread_mutex_lock(&mMutex);
+    mWorkPhase    = &phase;
+    mWorkType     = type;
+    mWorkDt       = dt;
+    mWorkNext     = 0;
+    mWorkFinished = 0;
+    mWorkFailed   = -1;
+    ++mGeneration;
+    pthread_cond_broadcast(&mWorkReady);
+
+    stepPhaseShare();
+    while (mWorkFinished < phase.size()) {
+        pthread_cond_wait(&mWorkDone, &mMutex);
+    }
+    mWorkPhase = 0;
+    const int failed = mWorkFailed;
+    pthread_mutex_unlock(&mMutex);
+
+    if (failed >= 0) {
+        GUNNS_ERROR(TsUnknownException, "Unexpected Exception",
+                    "spotter " + mEntries[failed].mSpotter->getName() + " threw an exception.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Takes the next spotter of the current phase and steps it, until none are left.  The
+///           mutex must be locked on entry, and is locked on exit, but is released while stepping.
+///           Exceptions from the spotter are caught and recorded for the caller to report.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::stepPhaseShare()
+{
+    while (mWorkPhase and mWorkNext < mWorkPhase->size()) {
+        const unsigned int size  = static_cast<unsigned int>(mWorkPhase->size());
+        const int          index = (*mWorkPhase)[mWorkNext++];
+        const StepType     type  = mWorkType;
+        const double       dt    = mWorkDt;
+        pthread_mutex_unlock(&mMutex);
+
+        bool failed = false;
+        try {
+            stepSpotter(index, type, dt);
+        } catch (...) {
+            failed = true;
+        }
+
+        pthread_mutex_lock(&mMutex);
+        if (failed and mWorkFailed < 0) {
+            mWorkFailed = index;
+        }
+        if (++mWorkFinished == size) {
+            pthread_cond_signal(&mWorkDone);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  index  (--)  Index of the spotter in mEntries.
+/// @param[in]  type   (--)  Which step method to call.
+/// @param[in]  dt     (s)   Execution time step.
+///
+/// @details  Calls the given spotter's step method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::stepSpotter(const int index, const StepType type, const double dt)
+{
+    if (PRE_SOLVER == type) {
+        mEntries[index].mSpotter->stepPreSolver(dt);
+    } else {
+        mEntries[index].mSpotter->stepPostSolver(dt);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Worker thread main loop.  Waits for each new phase and helps step it, until told to
+///           stop.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSpotterScheduler::runWorker()
+{
+    pthread_mutex_lock(&mMutex);
+    unsigned int generation = mGeneration;
+    for (;;) {
+        while (not mStopping and generation == mGeneration) {
+            pthread_cond_wait(&mWorkReady, &mMutex);
+        }
+        if (mStopping) {
+            break;
+        }
+        generation = mGeneration;
+        stepPhaseShare();
+    }
+    pthread_mutex_unlock(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  scheduler  (--)  Pointer to the GunnsSpotterScheduler.
+///
+/// @returns  void* (--) Always NULL.
+///
+/// @details  Worker thread entry point, runs the worker main loop.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* GunnsSpotterScheduler::workerEntry(void* scheduler)
+{
+    static_cast<GunnsSpotterScheduler*>(scheduler)->runWorker();
+    return NULL;
+}
@@ -0,0 +1,228 @@
+#ifndef GunnsSpotterScheduler_EXISTS
+#define GunnsSpotterScheduler_EXISTS
+
+/**
+@file
+@brief     GUNNS Spotter Scheduler declarations
+
+@defgroup  TSM_GUNNS_CORE_SPOTTER_SCHEDULER   GUNNS Spotter Scheduler
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:  (Provides the classes for the GUNNS Spotter Scheduler.  This spotter steps a set of other
+           spotters in phases ordered by the network data they declare they read and write, and
+           steps the spotters within each phase in parallel on a pool of worker threads.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The scheduled spotters must declare all of the network objects they read or write that any
+   other scheduled spotter writes.  Spotters that declare nothing are treated as accessing
+   everything, and are stepped alone in registration order.)
+- (Scheduled spotters must be thread-safe with respect to each other when their declarations
+   don't conflict, i.e. they mustn't share undeclared state such as static data.)
+- (The network must step only this scheduler, and not the scheduled spotters directly.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsSpotterScheduler.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "GunnsNetworkSpotter.hh"
+#include <pthread.h>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Spotter Scheduler Configuration Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the GUNNS Spotter
+///           Scheduler configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsSpotterSchedulerConfigData : public GunnsNetworkSpotterConfigData
+{
+    public:
+        int mNumThreads; /**< (--) trick_chkpnt_io(**) Number of threads to step each phase on, including the caller's thread. */
+        /// @brief  Default constructs this GUNNS Spotter Scheduler configuration data.
+        GunnsSpotterSchedulerConfigData(const std::string& name, const int numThreads = 1);
+        /// @brief  Default destructs this GUNNS Spotter Scheduler configuration data.
+        virtual ~GunnsSpotterSchedulerConfigData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsSpotterSchedulerConfigData(const GunnsSpotterSchedulerConfigData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsSpotterSchedulerConfigData& operator =(const GunnsSpotterSchedulerConfigData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Spotter Scheduler Input Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the GUNNS Spotter
+///           Scheduler input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsSpotterSchedulerInputData : public GunnsNetworkSpotterInputData
+{
+    public:
+        /// @brief  Default constructs this GUNNS Spotter Scheduler input data.
+        GunnsSpotterSchedulerInputData();
+        /// @brief  Default destructs this GUNNS Spotter Scheduler input data.
+        virtual ~GunnsSpotterSchedulerInputData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsSpotterSchedulerInputData(const GunnsSpotterSchedulerInputData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsSpotterSchedulerInputData& operator =(const GunnsSpotterSchedulerInputData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Spotter Scheduler Class.
+///
+/// @details  This spotter steps other spotters for the network.  The network registers its spotters
+///           with addSpotter, and steps this scheduler in place of them.  Each spotter declares the
+///           network objects (nodes, links, or any other data) it reads and writes with addRead and
+///           addWrite, and extra ordering constraints between spotters can be given with
+///           addDependency.
+///
+///           On initialization the spotters are sorted into phases.  Two spotters conflict if one
+///           writes an object the other reads or writes.  Conflicting spotters are ordered by the
+///           explicit dependencies where given, else by registration order, and each spotter goes in
+///           the phase after the last phase holding a spotter it must follow.  So spotters in the
+///           same phase never conflict, and can be stepped at the same time.
+///
+///           Each of stepPreSolver and stepPostSolver steps the phases in order.  Phases with more
+///           than one spotter are shared out to a pool of worker threads and the caller's thread,
+///           and the caller waits for the whole phase to finish before starting the next.  Phases
+///           with one spotter, or all phases when configured for one thread, are stepped on the
+///           caller's thread with no thread overhead.
+///
+///           Exceptions thrown by a spotter on a worker thread can't be passed back to the caller
+///           as-is.  Instead, the rest of the phase is finished and a TsUnknownException naming the
+///           spotter is thrown from the step method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsSpotterScheduler : public GunnsNetworkSpotter
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsSpotterScheduler);
+    public:
+        /// @brief   Default Constructor
+        GunnsSpotterScheduler();
+        /// @brief   Default destructor.
+        virtual     ~GunnsSpotterScheduler();
+        /// @brief   Registers a spotter to be stepped by this scheduler.
+        void         addSpotter(GunnsNetworkSpotter& spotter);
+        /// @brief   Declares that the spotter reads the given object.
+        void         addRead(const GunnsNetworkSpotter& spotter, const void* object);
+        /// @brief   Declares that the spotter writes the given object.
+        void         addWrite(const GunnsNetworkSpotter& spotter, const void* object);
+        /// @brief   Declares that the second spotter must be stepped after the first.
+        void         addDependency(const GunnsNetworkSpotter& first, const GunnsNetworkSpotter& second);
+        /// @brief   Initializes the GUNNS Spotter Scheduler with configuration and input data.
+        virtual void initialize(const GunnsNetworkSpotterConfigData* configData,
+                                const GunnsNetworkSpotterInputData*  inputData);
+        /// @brief   Steps the scheduled spotters prior to the GUNNS solver step.
+        virtual void stepPreSolver(const double dt);
+        /// @brief   Steps the scheduled spotters after the GUNNS solver step.
+        virtual void stepPostSolver(const double dt);
+        /// @brief   Returns the number of phases the spotters are stepped in.
+        int          getNumPhases() const;
+        /// @brief   Returns the phase the given spotter is stepped in.
+        int          getPhase(const GunnsNetworkSpotter& spotter) const;
+        /// @brief   Returns the number of worker threads.
+        int          getNumWorkers() const;
+
+    protected:
+        /// @brief   Enumeration of the spotter step methods.
+        enum StepType {
+            PRE_SOLVER  = 0, ///< stepPreSolver.
+            POST_SOLVER = 1  ///< stepPostSolver.
+        };
+        /// @brief   A scheduled spotter and its declared data accesses.
+        struct Entry {
+            GunnsNetworkSpotter*     mSpotter; /**< (--) The spotter. */
+            std::vector<const void*> mReads;   /**< (--) Objects the spotter reads. */
+            std::vector<const void*> mWrites;  /**< (--) Objects the spotter writes. */
+            int                      mPhase;   /**< (--) Phase the spotter is stepped in. */
+        };
+        std::vector<Entry>                       mEntries;      /**< ** (--) trick_chkpnt_io(**) Scheduled spotters, in registration order. */
+        std::vector<const GunnsNetworkSpotter*>  mDependencies; /**< ** (--) trick_chkpnt_io(**) Explicit dependencies, as pairs of first then second spotter. */
+        std::vector<std::vector<int> >           mPhases;       /**< ** (--) trick_chkpnt_io(**) Indexes in mEntries of the spotters in each phase. */
+        int                                      mNumThreads;   /**< *o (--) trick_chkpnt_io(**) Configured number of threads, including the caller's. */
+        std::vector<pthread_t>                   mWorkers;      /**< ** (--) trick_chkpnt_io(**) Worker threads. */
+        pthread_mutex_t                          mMutex;        /**< ** (--) trick_chkpnt_io(**) Guards the work state below. */
+        pthread_cond_t                           mWorkReady;    /**< ** (--) trick_chkpnt_io(**) Signals the workers that a phase is ready. */
+        pthread_cond_t                           mWorkDone;     /**< ** (--) trick_chkpnt_io(**) Signals the caller that a phase is done. */
+        unsigned int                             mGeneration;   /**< ** (--) trick_chkpnt_io(**) Count of phases handed to the workers. */
+        bool                                     mStopping;     /**< ** (--) trick_chkpnt_io(**) Tells the workers to exit. */
+        const std::vector<int>*                  mWorkPhase;    /**< ** (--) trick_chkpnt_io(**) The phase being stepped. */
+        StepType                                 mWorkType;     /**< ** (--) trick_chkpnt_io(**) The step method being called. */
+        double                                   mWorkDt;       /**< ** (s)  trick_chkpnt_io(**) The time step being passed. */
+        unsigned int                             mWorkNext;     /**< ** (--) trick_chkpnt_io(**) Index in the phase of the next spotter to step. */
+        unsigned int                             mWorkFinished; /**< ** (--) trick_chkpnt_io(**) Number of spotters in the phase finished stepping. */
+        int                                      mWorkFailed;   /**< ** (--) trick_chkpnt_io(**) Index in mEntries of a spotter that threw, or -1. */
+        /// @brief   Validates the supplied configuration data.
+        const GunnsSpotterSchedulerConfigData* validateConfig(const GunnsNetworkSpotterConfigData* config);
+        /// @brief   Validates the supplied input data.
+        const GunnsSpotterSchedulerInputData*  validateInput (const GunnsNetworkSpotterInputData* input);
+        /// @brief   Returns the index of the given spotter in mEntries, or -1 if not registered.
+        int          findEntry(const GunnsNetworkSpotter* spotter) const;
+        /// @brief   Returns whether the two spotters conflict in their data accesses.
+        bool         isConflict(const Entry& a, const Entry& b) const;
+        /// @brief   Sorts the spotters into phases.
+        void         buildPhases();
+        /// @brief   Starts the worker threads.
+        void         startWorkers();
+        /// @brief   Stops the worker threads.
+        void         stopWorkers();
+        /// @brief   Steps all phases of spotters with the given step method.
+        void         stepPhases(const StepType type, const double dt);
+        /// @brief   Steps the spotters of one phase across the worker threads.
+        void         stepPhaseParallel(const std::vector<int>& phase, const StepType type, const double dt);
+        /// @brief   Steps phase spotters until none are left, with the mutex locked on entry and exit.
+        void         stepPhaseShare();
+        /// @brief   Steps one spotter with the given step method.
+        void         stepSpotter(const int index, const StepType type, const double dt);
+        /// @brief   Worker thread main loop.
+        void         runWorker();
+        /// @brief   Worker thread entry point.
+        static void* workerEntry(void* scheduler);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsSpotterScheduler(const GunnsSpotterScheduler& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsSpotterScheduler& operator =(const GunnsSpotterScheduler& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of phases.
+///
+/// @details  Returns the number of phases the spotters are stepped in.  This is zero until this
+///           scheduler is initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsSpotterScheduler::getNumPhases() const
+{
+    return static_cast<int>(mPhases.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of worker threads.
+///
+/// @details  Returns the number of worker threads running, not counting the caller's thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsSpotterScheduler::getNumWorkers() const
+{
+    return static_cast<int>(mWorkers.size());
+}
+
+#endif
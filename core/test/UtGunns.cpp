@@ -10,6 +10,7 @@
 #include "UtGunns.hh"
 #include "UtGunnsMinorStepLog.hh"
 #include "core/GunnsBasicFlowOrchestrator.hh"
+#include "core/GunnsPortReduction.hh"
 
 //TODO catch-up for line coverage:
 //     - line 591, try to make a link throw during restart
@@ -380,11 +381,14 @@ void UtGunns::testDefaultConstruction()
     CPPUNIT_ASSERT(0             == tNetwork.mSolverGpuSparse);
     if (tNetwork.isGpuEnabled()) {
         CPPUNIT_ASSERT(true      == tNetwork.mGpuEnabled);
+        CPPUNIT_ASSERT(false     == tNetwork.mGpuFallbackEnabled);
     } else {
         CPPUNIT_ASSERT(false     == tNetwork.mGpuEnabled);
+        CPPUNIT_ASSERT(true      == tNetwork.mGpuFallbackEnabled);
     }
     CPPUNIT_ASSERT(Gunns::NO_GPU == tNetwork.mGpuMode);
     CPPUNIT_ASSERT(9999999       == tNetwork.mGpuSizeThreshold);
+    CPPUNIT_ASSERT(1             == tNetwork.mGpuNumThreads);
     CPPUNIT_ASSERT(1.0           == tNetwork.mConvergenceTolerance);
     CPPUNIT_ASSERT(0             == tNetwork.mNetworkSize);
     CPPUNIT_ASSERT(1             == tNetwork.mMinorStepLimit);
@@ -554,7 +558,7 @@ void UtGunns::testNominalInitialization()
     CPPUNIT_ASSERT(tNetwork.mRebuild       == true);
 
     /// - Check remaining state data.
-    if (tNetwork.isGpuEnabled()) {
+    if (tNetwork.isGpuEnabled() or tNetwork.isGpuFallbackEnabled()) {
         CPPUNIT_ASSERT(0         != tNetwork.mSolverCpu);
         CPPUNIT_ASSERT(0         != tNetwork.mSolverGpuDense);
         CPPUNIT_ASSERT(0         != tNetwork.mSolverGpuSparse);
@@ -1823,11 +1827,16 @@ void UtGunns::testAccessMethods()
 
     tNetwork.setGpuOptions(Gunns::GPU_SPARSE, 10);
     CPPUNIT_ASSERT(10 == tNetwork.mGpuSizeThreshold);
-    if (tNetwork.isGpuEnabled()) {
+    if (tNetwork.isGpuEnabled() or tNetwork.isGpuFallbackEnabled()) {
         CPPUNIT_ASSERT(Gunns::GPU_SPARSE == tNetwork.mGpuMode);
     } else {
         CPPUNIT_ASSERT(Gunns::NO_GPU     == tNetwork.mGpuMode);
     }
+    CPPUNIT_ASSERT(1  == tNetwork.mGpuNumThreads);
+
+    tNetwork.setGpuOptions(Gunns::GPU_DENSE, 20, 2);
+    CPPUNIT_ASSERT(20 == tNetwork.mGpuSizeThreshold);
+    CPPUNIT_ASSERT(2  == tNetwork.mGpuNumThreads);
 
     tNetwork.setWorstCaseTiming(true);
     CPPUNIT_ASSERT(true == tNetwork.mWorstCaseTiming);
@@ -2244,7 +2253,7 @@ void UtGunns::testCheckStepInputs()
     CPPUNIT_ASSERT(Gunns::PAUSE  == tNetwork.mLastRunMode);
     CPPUNIT_ASSERT(Gunns::NO_GPU == tNetwork.mGpuMode);
 
-    if (tNetwork.isGpuEnabled()) {
+    if (tNetwork.isGpuEnabled() or tNetwork.isGpuFallbackEnabled()) {
         tNetwork.mGpuMode          = Gunns::GPU_SPARSE;
         tNetwork.mGpuSizeThreshold = 0;
         tNetwork.step(tDeltaTime);
@@ -2261,7 +2270,7 @@ void UtGunns::testGpuSparse()
 {
     std::cout << "\n UtGunns ................ 32: testGpuSparse .........................";
 
-    if (tNetwork.isGpuEnabled()) {
+    if (tNetwork.isGpuEnabled() or tNetwork.isGpuFallbackEnabled()) {
         setupNominalNonLinearNetwork(true);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverCpu);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverGpuDense);
@@ -2345,7 +2354,7 @@ void UtGunns::testGpuDense()
 {
     std::cout << "\n UtGunns ................ 33: testGpuDense ..........................";
 
-    if (tNetwork.isGpuEnabled()) {
+    if (tNetwork.isGpuEnabled() or tNetwork.isGpuFallbackEnabled()) {
         setupNominalNonLinearNetwork(true);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverCpu);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverGpuDense);
@@ -2430,7 +2439,7 @@ void UtGunns::testGpuSparseIslands()
     std::cout << "\n UtGunns ................ 34: testGpuSparseIslands ..................";
 
     setupIslandNetwork();
-    if (tNetwork.isGpuEnabled()) {
+    if (tNetwork.isGpuEnabled() or tNetwork.isGpuFallbackEnabled()) {
         CPPUNIT_ASSERT(0 != tNetwork.mSolverCpu);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverGpuDense);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverGpuSparse);
@@ -2472,7 +2481,7 @@ void UtGunns::testGpuDenseIslands()
     std::cout << "\n UtGunns ................ 35: testGpuDenseIslands ...................";
 
     setupIslandNetwork();
-    if (tNetwork.isGpuEnabled()) {
+    if (tNetwork.isGpuEnabled() or tNetwork.isGpuFallbackEnabled()) {
         CPPUNIT_ASSERT(0 != tNetwork.mSolverCpu);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverGpuDense);
         CPPUNIT_ASSERT(0 != tNetwork.mSolverGpuSparse);
@@ -2506,6 +2515,255 @@ void UtGunns::testGpuDenseIslands()
     std::cout << "... Pass";
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the Gunns class adaptive sub-stepping in a basic RC network charging from a
+///           potential source.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testAdaptiveStepping()
+{
+    std::cout << "\n UtGunns ................ 36: testAdaptiveStepping ..................";
+
+    /// - Initialize the basic nodes.
+    tBasicNodes[0].initialize("BasicNode1", 0.0);
+    tBasicNodes[1].initialize("BasicNode2");
+    tNodeList.mNumNodes = 2;
+    tNodeList.mNodes    = tBasicNodes;
+    tNetwork.initializeNodes(tNodeList);
+
+    /// - Set up a 100 V potential source charging a 1 F capacitor through 1 S, so RC = 1 s.
+    tPotentialConfig.mName                = "Potential";
+    tPotentialConfig.mNodeList            = &tNodeList;
+    tPotentialConfig.mDefaultConductivity = 1.0;
+    tCapacitorConfig.mName                = "Capacitor";
+    tCapacitorConfig.mNodeList            = &tNodeList;
+
+    GunnsBasicPotentialInputData tPotentialInput(false, 0.0, 100.0);
+    GunnsBasicCapacitorInputData tCapacitorInput(false, 0.0, 1.0, 0.0);
+
+    tPotential.initialize(tPotentialConfig, tPotentialInput, tLinks, 1, 0);
+    tCapacitor.initialize(tCapacitorConfig, tCapacitorInput, tLinks, 0, 1);
+
+    tNetwork.initialize(tNetworkConfig, tLinks);
+
+    /// - Verify adaptive sub-stepping is off by default, and invalid options are rejected.
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveStepping);
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.getAdaptiveSubSteps());
+    tNetwork.setAdaptiveStepOptions(true, 0.0, 20);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveStepping);
+    tNetwork.setAdaptiveStepOptions(true, 0.1, 0);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveStepping);
+    tNetwork.setAdaptiveStepOptions(true, 0.1, 20);
+    CPPUNIT_ASSERT(tNetwork.mAdaptiveStepping);
+    CPPUNIT_ASSERT_EQUAL(0.1, tNetwork.mAdaptiveTolerance);
+    CPPUNIT_ASSERT_EQUAL(20,  tNetwork.mAdaptiveMaxSubSteps);
+
+    /// - The first major step has no error history, so takes one backward Euler step.
+    const double dt = 1.0;
+    tNetwork.step(dt);
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.getAdaptiveSubSteps());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(50.0, tBasicNodes[0].getPotential(), DBL_EPSILON);
+
+    /// - The second major step estimates a large error, and plans more sub-steps for the next.
+    tNetwork.step(dt);
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.getAdaptiveSubSteps());
+    CPPUNIT_ASSERT(tNetwork.getAdaptiveErrorRatio() > 1.0);
+    CPPUNIT_ASSERT(tNetwork.mAdaptiveSubSteps > 1);
+
+    /// - Sub-stepping brings the solution closer to the exact charging curve than the fixed step
+    ///   solution, 87.5 V at t = 3 s.
+    const double startPotential = tBasicNodes[0].getPotential();
+    tNetwork.step(dt);
+    CPPUNIT_ASSERT(tNetwork.getAdaptiveSubSteps() > 1);
+    const double exact = 100.0 * (1.0 - std::exp(-3.0));
+    CPPUNIT_ASSERT(std::fabs(exact - tBasicNodes[0].getPotential()) < std::fabs(exact - 87.5));
+
+    /// - Node fluxes are averaged over the major step, so the charge delivered over the major step
+    ///   equals the charge stored in the capacitor.
+    const double stored = tCapacitorInput.mCapacitance
+                        * (tBasicNodes[0].getPotential() - startPotential);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(stored, tBasicNodes[0].getInflux()  * dt, 1.0E-8);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(stored, tBasicNodes[0].getOutflux() * dt, 1.0E-8);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,    tBasicNodes[0].getNetFlux(),      1.0E-8);
+
+    /// - Port reductions aren't valid from a sub-stepped solution.
+    GunnsPortReduction reduction;
+    const int ports[1] = {0};
+    reduction.initialize("reduction", 1, ports);
+    tNetwork.addPortReduction(&reduction);
+    tNetwork.step(dt);
+    CPPUNIT_ASSERT(tNetwork.getAdaptiveSubSteps() > 1);
+    CPPUNIT_ASSERT(not reduction.isValid());
+
+    /// - Sub-steps decay back to one as the network settles.
+    for (int i = 0; i < 40; ++i) {
+        tNetwork.step(dt);
+    }
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.getAdaptiveSubSteps());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, tBasicNodes[0].getPotential(), 1.0E-6);
+
+    /// - Sub-stepping isn't done outside of NORMAL mode, and the history is reset on restart.
+    tPotential.setSourcePotential(0.0);
+    tNetwork.step(dt);
+    tNetwork.step(dt);
+    CPPUNIT_ASSERT(tNetwork.mAdaptiveSubSteps > 1);
+    tNetwork.restart();
+    CPPUNIT_ASSERT_EQUAL(1,   tNetwork.mAdaptiveSubSteps);
+    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mAdaptiveLastSubStep);
+    tNetwork.setDummyMode();
+    tNetwork.step(dt);
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.getAdaptiveSubSteps());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the admittance matrix equilibration and condition monitor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testConditioning()
+{
+    std::cout << "\n UtGunns ................ 37: testConditioning ......................";
+
+    /// - The nominal network mixes a 1E14 potential source conductance with 1E-4 conductors.
+    setupNominalNonLinearNetwork(true);
+
+    /// - Verify equilibration is off by default, and invalid condition limits are rejected.
+    CPPUNIT_ASSERT(not tNetwork.mEquilibrate);
+    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mConditionLimit);
+    tNetwork.setConditioningOptions(false, 1.0);
+    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mConditionLimit);
+    tNetwork.setConditioningOptions(false, 1.0E6);
+    CPPUNIT_ASSERT_EQUAL(1.0E6, tNetwork.mConditionLimit);
+
+    /// - Step without equilibration and verify the condition estimate and warning, with the
+    ///   largest admittance at the potential source node.
+    tNetwork.step(tDeltaTime);
+    double expectedP[4];
+    double expectedW[4];
+    for (int i = 0; i < 4; ++i) {
+        expectedP[i] = tNetwork.mPotentialVector[i];
+        expectedW[i] = tNetwork.mSourceVector[i];
+    }
+    CPPUNIT_ASSERT(not tNetwork.mEquilibrated);
+    CPPUNIT_ASSERT(tNetwork.getConditionEstimate() > 1.0E6);
+    CPPUNIT_ASSERT(tNetwork.mConditionWarned);
+    CPPUNIT_ASSERT_EQUAL(0, tNetwork.mConditionStiffNode);
+    CPPUNIT_ASSERT(0 <= tNetwork.mConditionPivotNode and 4 > tNetwork.mConditionPivotNode);
+    const double unscaledEstimate = tNetwork.getConditionEstimate();
+
+    /// - Step again with equilibration, and verify the same solution, to within the convergence
+    ///   tolerance of the non-linear network, with a much better conditioned decomposition, and
+    ///   the warning is reset.
+    tNetwork.setConditioningOptions(true, 1.0E6);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(tNetwork.mEquilibrated);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedP[i], tNetwork.mPotentialVector[i],
+                                     tNetworkConfig.mConvergenceTolerance);
+    }
+    CPPUNIT_ASSERT(tNetwork.getConditionEstimate() < 1.0E-6 * unscaledEstimate);
+    CPPUNIT_ASSERT(tNetwork.getConditionEstimate() < 1.0E6);
+    CPPUNIT_ASSERT(not tNetwork.mConditionWarned);
+    CPPUNIT_ASSERT(unscaledEstimate <= tNetwork.getMaxConditionEstimate());
+    CPPUNIT_ASSERT(tNetwork.mEquilibrationScale[0] < 1.0E-6);
+
+    /// - Verify the source vector is left unscaled after the scaled solution.
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedW[i], tNetwork.mSourceVector[i],
+                                     1.0E-3 * std::fabs(expectedW[i]));
+    }
+
+    /// - Verify restart resets the monitor.
+    tNetwork.restart();
+    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.getConditionEstimate());
+    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.getMaxConditionEstimate());
+    CPPUNIT_ASSERT_EQUAL(-1,  tNetwork.mConditionPivotNode);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the mixed-precision decomposition with iterative refinement, and its fall-back to
+///           double precision.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testMixedPrecision()
+{
+    std::cout << "\n UtGunns ................ 38: testMixedPrecision ....................";
+
+    /// - The island network mixes a 1E14 potential source conductance with 1E-4 conductors, in an
+    ///   island of 5 nodes and an island of 1 node.
+    setupIslandNetwork();
+    tNetwork.setIslandMode(Gunns::SOLVE);
+
+    /// - Verify mixed precision is off by default, and invalid options are rejected.
+    CPPUNIT_ASSERT(not tNetwork.mMixedPrecision);
+    tNetwork.setMixedPrecisionOptions(true, 0, 4);
+    CPPUNIT_ASSERT(not tNetwork.mMixedPrecision);
+    tNetwork.setMixedPrecisionOptions(true, 1, 0);
+    CPPUNIT_ASSERT(not tNetwork.mMixedPrecision);
+
+    /// - Step in double precision for the expected solution.
+    tNetwork.setConditioningOptions(true, 0.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(not tNetwork.isMixedDecomposed());
+    double expectedP[6];
+    for (int i = 0; i < 6; ++i) {
+        expectedP[i] = tNetwork.mPotentialVector[i];
+    }
+
+    /// - Verify no mixed precision for networks smaller than the size threshold.
+    tNetwork.setMixedPrecisionOptions(true, 7, 4);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(not tNetwork.isMixedDecomposed());
+
+    /// - Verify the single-precision arrays aren't allocated until mixed precision is used.
+    CPPUNIT_ASSERT(0 == tNetwork.mMixedLdu);
+    CPPUNIT_ASSERT(0 == tNetwork.mMixedLduIsland);
+
+    /// - Step in mixed precision of the equilibrated matrix, and verify the same solution refined
+    ///   to double precision.
+    tNetwork.setMixedPrecisionOptions(true, 6, 4);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(tNetwork.isMixedDecomposed());
+    CPPUNIT_ASSERT(0 != tNetwork.mMixedLdu);
+    CPPUNIT_ASSERT(0 != tNetwork.mMixedLduIsland);
+    CPPUNIT_ASSERT_EQUAL(0, tNetwork.getMixedFallbackCount());
+    CPPUNIT_ASSERT(0 < tNetwork.getMixedRefinements() and 4 >= tNetwork.getMixedRefinements());
+    for (int i = 0; i < 6; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedP[i], tNetwork.mPotentialVector[i],
+                                     1.0E-12 * std::fabs(expectedP[i]));
+    }
+
+    /// - Verify the componentwise backward error of the refined solution, against the undecomposed
+    ///   equilibrated matrix, is within double-precision round-off.
+    CPPUNIT_ASSERT(tNetwork.mMixedBackwardError <= std::sqrt(6.0) * DBL_EPSILON);
+
+    /// - Corrupt a pivot of the single-precision decomposition so the next solution fails, and
+    ///   verify it falls back to the double-precision decomposition, with the same solution.  The
+    ///   fall-back decomposition is counted, in total and in the step.
+    const int decompositions = tNetwork.mDecompositionCount;
+    tNetwork.mMixedLdu[7] = 0.0F;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(not tNetwork.isMixedDecomposed());
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.getMixedFallbackCount());
+    CPPUNIT_ASSERT_EQUAL(decompositions + 1, tNetwork.mDecompositionCount);
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.mLastDecomposition);
+    for (int i = 0; i < 6; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedP[i], tNetwork.mPotentialVector[i],
+                                     1.0E-12 * std::fabs(expectedP[i]));
+    }
+
+    /// - Verify restart resets the fall-back history.
+    tNetwork.restart();
+    CPPUNIT_ASSERT(not tNetwork.isMixedDecomposed());
+    CPPUNIT_ASSERT_EQUAL(0, tNetwork.getMixedFallbackCount());
+    CPPUNIT_ASSERT_EQUAL(0, tNetwork.getMixedRefinements());
+
+    std::cout << "... Pass";
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] converging (--) When true, network set up to be converging, otherwise non-converging.
 ///
@@ -0,0 +1,594 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsBasicDistributedIf.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cfloat>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsBasicDistributedIf class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsBasicDistributedIf::UtGunnsBasicDistributedIf()
+    :
+    tConfigData(),
+    tInputData(),
+    tArticle(),
+    tLinkName(),
+    tIsPairMaster(),
+    tDemandOption(),
+    tMalfBlockageFlag(),
+    tMalfBlockageValue(),
+    tNodes(),
+    tNodeList(),
+    tLinks(),
+    tPort0(),
+    tTimeStep(),
+    tCapacitorLink()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsBasicDistributedIf class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsBasicDistributedIf::~UtGunnsBasicDistributedIf()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+    delete tInputData;
+    delete tConfigData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::setUp()
+{
+    tLinkName           = "Test Basic Distributed Interface";
+    tNodeList.mNumNodes = 2;
+    tNodeList.mNodes    = tNodes;
+    tIsPairMaster       = true;
+    tDemandOption       = true;
+    tMalfBlockageFlag   = false;
+    tMalfBlockageValue  = 1.0;
+    tPort0              = 0;
+    tTimeStep           = 0.1;
+
+    tNodes[0].initialize("UtTestNode0", 300.0);
+    tNodes[1].initialize("UtTestNode1", 0.0);
+
+    /// - Initialize the node capacitor link
+    GunnsBasicCapacitorConfigData capConfig("tCapacitorLink", &tNodeList);
+    GunnsBasicCapacitorInputData  capInput(false, 0.0, 10.0, 300.0);
+    tCapacitorLink.initialize(capConfig, capInput, tLinks, 0, 1);
+
+    /// - Define nominal configuration data
+    tConfigData = new GunnsBasicDistributedIfConfigData(tLinkName,
+                                                        &tNodeList,
+                                                        tIsPairMaster,
+                                                        tDemandOption,
+                                                        &tCapacitorLink);
+
+    /// - Define nominal input data
+    tInputData = new GunnsBasicDistributedIfInputData(tMalfBlockageFlag,
+                                                      tMalfBlockageValue);
+
+    tArticle = new FriendlyGunnsBasicDistributedIf;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction of config and input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testConfigAndInput()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsBasicDistributedIf 01: testConfigAndInput ...................";
+
+    /// @test nominal config construction.
+    CPPUNIT_ASSERT(tLinkName       == tConfigData->mName);
+    CPPUNIT_ASSERT(tNodes          == tConfigData->mNodeList->mNodes);
+    CPPUNIT_ASSERT(tIsPairMaster   == tConfigData->mIsPairMaster);
+    CPPUNIT_ASSERT(tDemandOption   == tConfigData->mDemandOption);
+    CPPUNIT_ASSERT(&tCapacitorLink == tConfigData->mCapacitorLink);
+    CPPUNIT_ASSERT(1.25            == tConfigData->mModingCapacitanceRatio);
+    CPPUNIT_ASSERT(1.5             == tConfigData->mDemandFilterConstA);
+    CPPUNIT_ASSERT(0.75            == tConfigData->mDemandFilterConstB);
+
+    /// @test default config construction.
+    GunnsBasicDistributedIfConfigData defaultConfig;
+    CPPUNIT_ASSERT(""    == defaultConfig.mName);
+    CPPUNIT_ASSERT(0     == defaultConfig.mNodeList);
+    CPPUNIT_ASSERT(false == defaultConfig.mIsPairMaster);
+    CPPUNIT_ASSERT(false == defaultConfig.mDemandOption);
+    CPPUNIT_ASSERT(0     == defaultConfig.mCapacitorLink);
+
+    /// @test nominal and default input construction.
+    CPPUNIT_ASSERT(tMalfBlockageFlag  == tInputData->mMalfBlockageFlag);
+    CPPUNIT_ASSERT(tMalfBlockageValue == tInputData->mMalfBlockageValue);
+    CPPUNIT_ASSERT(false              == tInputData->mForceDemandMode);
+    CPPUNIT_ASSERT(false              == tInputData->mForceSupplyMode);
+    GunnsBasicDistributedIfInputData forcedInput(false, 0.0, true, false);
+    CPPUNIT_ASSERT(true  == forcedInput.mForceDemandMode);
+    CPPUNIT_ASSERT(false == forcedInput.mForceSupplyMode);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction of the link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testDefaultConstruction()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 02: testDefaultConstruction ..............";
+
+    CPPUNIT_ASSERT(0     == tArticle->mInData.mFrameCount);
+    CPPUNIT_ASSERT(0     == tArticle->mOutData.mFrameLoopback);
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(false == tArticle->mIsPairMaster);
+    CPPUNIT_ASSERT(false == tArticle->mDemandOption);
+    CPPUNIT_ASSERT(0     == tArticle->mCapacitorLink);
+    CPPUNIT_ASSERT(0.0   == tArticle->mModingCapacitanceRatio);
+    CPPUNIT_ASSERT(0.0   == tArticle->mSupplyCapacitance);
+    CPPUNIT_ASSERT(0.0   == tArticle->mEffectiveConductivity);
+    CPPUNIT_ASSERT(0.0   == tArticle->mSourcePotential);
+    CPPUNIT_ASSERT(0.0   == tArticle->mDemandFlux);
+    CPPUNIT_ASSERT(0     == tArticle->mLoopLatency);
+    CPPUNIT_ASSERT(0.0   == tArticle->mSuppliedCapacitance);
+    CPPUNIT_ASSERT(0     == tArticle->mOtherIfs.size());
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test new/delete for code coverage.
+    GunnsBasicDistributedIf* article = new GunnsBasicDistributedIf();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests nominal initialization of the link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testNominalInitialization()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 03: testNominalInitialization ............";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+
+    CPPUNIT_ASSERT(tLinkName       == tArticle->getName());
+    CPPUNIT_ASSERT(&tNodes[0]      == tArticle->mNodes[0]);
+    CPPUNIT_ASSERT(tIsPairMaster   == tArticle->mIsPairMaster);
+    CPPUNIT_ASSERT(tDemandOption   == tArticle->mDemandOption);
+    CPPUNIT_ASSERT(&tCapacitorLink == tArticle->mCapacitorLink);
+    CPPUNIT_ASSERT(1.25            == tArticle->mModingCapacitanceRatio);
+    CPPUNIT_ASSERT(1.5             == tArticle->mDemandFilterConstA);
+    CPPUNIT_ASSERT(0.75            == tArticle->mDemandFilterConstB);
+    CPPUNIT_ASSERT(false           == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(1.0             == tArticle->mDemandFluxGain);
+    CPPUNIT_ASSERT(true            == tArticle->mInitFlag);
+
+    /// @test registering other interfaces ignores duplicates and this.
+    FriendlyGunnsBasicDistributedIf otherIf;
+    tArticle->addOtherIf(&otherIf);
+    tArticle->addOtherIf(&otherIf);
+    tArticle->addOtherIf(tArticle);
+    CPPUNIT_ASSERT(1        == tArticle->mOtherIfs.size());
+    CPPUNIT_ASSERT(&otherIf == tArticle->mOtherIfs[0]);
+
+    /// @test restart resets non-checkpointed state.
+    tArticle->mEffectiveConductivity = 1.0;
+    tArticle->mSourcePotential       = 1.0;
+    tArticle->mDemandFlux            = 1.0;
+    tArticle->mLoopLatency           = 1;
+    tArticle->mDemandFluxGain        = 0.5;
+    tArticle->mSuppliedCapacitance   = 1.0;
+    tArticle->restart();
+    CPPUNIT_ASSERT(0.0 == tArticle->mEffectiveConductivity);
+    CPPUNIT_ASSERT(0.0 == tArticle->mSourcePotential);
+    CPPUNIT_ASSERT(0.0 == tArticle->mDemandFlux);
+    CPPUNIT_ASSERT(0   == tArticle->mLoopLatency);
+    CPPUNIT_ASSERT(1.0 == tArticle->mDemandFluxGain);
+    CPPUNIT_ASSERT(0.0 == tArticle->mSuppliedCapacitance);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 04: testInitializationExceptions .........";
+
+    /// @test exception on missing capacitor link.
+    tConfigData->mCapacitorLink = 0;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0),
+                         TsInitializationException);
+    tConfigData->mCapacitorLink = &tCapacitorLink;
+
+    /// @test exception on moding capacitance ratio <= 1.
+    tConfigData->mModingCapacitanceRatio = 1.0;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0),
+                         TsInitializationException);
+    tConfigData->mModingCapacitanceRatio = 1.25;
+
+    /// @test exception on both mode force flags set.
+    tInputData->mForceDemandMode = true;
+    tInputData->mForceSupplyMode = true;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test port 0 can't be mapped to the ground node.
+    tInputData->mForceDemandMode = false;
+    tInputData->mForceSupplyMode = false;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+    CPPUNIT_ASSERT(false == tArticle->checkSpecificPortRules(0, 1));
+    CPPUNIT_ASSERT(true  == tArticle->checkSpecificPortRules(0, 0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the processInputs method, including mode flips.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testProcessInputs()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 05: testProcessInputs ....................";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+
+    /// @test no inputs when incoming data isn't valid yet.
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(0.0   == tArticle->mDemandFlux);
+    CPPUNIT_ASSERT(1     == tArticle->mOutData.mFrameCount);
+    CPPUNIT_ASSERT(1     == tArticle->mLoopLatency);
+
+    /// @test stays in supply mode when the other side is supply with smaller capacitance.
+    tArticle->mOutData.mCapacitance = 10.0;
+    tArticle->mInData.mFrameCount   = 5;
+    tArticle->mInData.mFrameLoopback = 1;
+    tArticle->mInData.mCapacitance  = 5.0;
+    tArticle->mInData.mSource       = 200.0;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(0.0   == tArticle->mDemandFlux);
+    CPPUNIT_ASSERT(5     == tArticle->mOutData.mFrameLoopback);
+    CPPUNIT_ASSERT(1     == tArticle->mLoopLatency);
+
+    /// @test supply mode takes the demand flux from the demand side.
+    tArticle->mInData.mDemandMode = true;
+    tArticle->mInData.mSource     = 2.0;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(-2.0  == tArticle->mDemandFlux);
+    CPPUNIT_ASSERT(0.0   == tArticle->mSourcePotential);
+
+    /// @test flip to demand mode when the other side is supply with larger capacitance, and the
+    ///       capacitor link is edited to zero capacitance.
+    tArticle->mInData.mDemandMode  = false;
+    tArticle->mInData.mCapacitance = 20.0;
+    tArticle->mInData.mSource      = 250.0;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(true  == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(10.0  == tArticle->mSupplyCapacitance);
+    CPPUNIT_ASSERT(250.0 == tArticle->mSourcePotential);
+    CPPUNIT_ASSERT(0.0   == tArticle->mDemandFlux);
+    tCapacitorLink.step(tTimeStep);
+    CPPUNIT_ASSERT(0.0   == tCapacitorLink.getCapacitance());
+
+    /// @test flip back to supply mode when the other side initiates the swap, and the capacitor
+    ///       link capacitance is restored.
+    tArticle->mInData.mDemandMode = true;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    tCapacitorLink.step(tTimeStep);
+    CPPUNIT_ASSERT(10.0  == tCapacitorLink.getCapacitance());
+
+    /// @test demand mode holds the node potential before receiving supply data.
+    tArticle->mForceDemandMode      = true;
+    tArticle->mInData.mFrameCount   = 0;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(true  == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(300.0 == tArticle->mSourcePotential);
+
+    /// @test forced demand mode doesn't flip back to supply.
+    tArticle->flipToSupplyMode();
+    CPPUNIT_ASSERT(true  == tArticle->mOutData.mDemandMode);
+
+    /// @test forced supply mode.
+    tArticle->mForceDemandMode = false;
+    tArticle->mForceSupplyMode = true;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    tArticle->flipToDemandMode();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the processOutputs method, including the capacitance output.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testProcessOutputs()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 06: testProcessOutputs ...................";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+
+    /// @test outputs in demand mode.
+    tArticle->mOutData.mDemandMode = true;
+    tArticle->mSuppliedCapacitance = 1.0;
+    tArticle->mFlux                = 0.5;
+    tNodes[0].setNetworkCapacitance(3.0);
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tArticle->mOutData.mCapacitance, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, tArticle->mOutData.mSource,      DBL_EPSILON);
+
+    /// @test capacitance output subtracts other interfaces' supplied capacitance.
+    FriendlyGunnsBasicDistributedIf otherIf;
+    otherIf.mSuppliedCapacitance = 0.5;
+    otherIf.mNodeMap             = new int[1];
+    otherIf.mNodeMap[0]          = 1;
+    const double netCapDp[2]     = {2.0, 1.0};
+    tNodes[0].setNetCapDeltaPotential(netCapDp);
+    tArticle->addOtherIf(&otherIf);
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.75, tArticle->mOutData.mCapacitance, DBL_EPSILON);
+    tArticle->mOtherIfs.clear();
+    delete [] otherIf.mNodeMap;
+    otherIf.mNodeMap = 0;
+
+    /// @test outputs in supply mode, without flipping to demand mode.
+    tArticle->mOutData.mDemandMode = false;
+    tArticle->mSuppliedCapacitance = 0.0;
+    tArticle->mInData.mCapacitance = 3.5;
+    tArticle->mFramesSinceFlip     = 4;
+    tArticle->mLoopLatency         = 4;
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0,   tArticle->mOutData.mCapacitance, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(300.0, tArticle->mOutData.mSource,      DBL_EPSILON);
+
+    /// @test not flipping when the capacitance ratio is within the moding ratio.
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+
+    /// @test flip to demand mode due to low capacitance.
+    tArticle->mInData.mCapacitance = 4.0;
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT(true == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mOutData.mSource, DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the step method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testStep()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 07: testStep .............................";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+
+    /// @test outputs in demand mode, with demand option on.
+    tArticle->mOutData.mDemandMode  = true;
+    tArticle->mOutData.mCapacitance = 0.5;
+    tArticle->mInData.mCapacitance  = 1.0;
+    tArticle->mLoopLatency          = 4;
+    tArticle->mDemandFlux           = 0.001;
+    tArticle->mSourcePotential      = 100.0;
+    double csOverCd     = 1.25;
+    double gainLimit    = 1.5 * powf(0.75, 4);
+    double expectedGain = gainLimit + (1.0 - gainLimit) * (csOverCd - 1.0) * 4.0;
+    double expectedG    = expectedGain * 1.0 / tTimeStep;
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedGain,               tArticle->mDemandFluxGain,          DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG,                  tArticle->mAdmittanceMatrix[0],     DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG * 100.0 + 0.001,  tArticle->mSourceVector[0],         DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG * tTimeStep,      tArticle->getSuppliedCapacitance(), DBL_EPSILON);
+    CPPUNIT_ASSERT(true   == tArticle->needAdmittanceUpdate());
+    CPPUNIT_ASSERT(1.0e-6 == tNodes[0].getNetworkCapacitanceRequest());
+
+    /// @test demand mode with the demand option off and the blockage malfunction.
+    tArticle->mDemandOption      = false;
+    tArticle->mMalfBlockageFlag  = true;
+    tArticle->mMalfBlockageValue = 0.5;
+    const double conductance     = expectedGain * 1.0 / tTimeStep;
+    expectedG = 0.5 / (1.0 / conductance + tTimeStep / 0.5);
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG, tArticle->mEffectiveConductivity, DBL_EPSILON);
+
+    /// @test demand mode without a valid outgoing capacitance.
+    tArticle->mMalfBlockageFlag     = false;
+    tArticle->mOutData.mCapacitance = 0.0;
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,             tArticle->mDemandFluxGain,        DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0 / tTimeStep, tArticle->mEffectiveConductivity, DBL_EPSILON);
+
+    /// @test supply mode has only the demand flux source.
+    tArticle->mOutData.mDemandMode = false;
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,   tArticle->mAdmittanceMatrix[0], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.001, tArticle->mSourceVector[0],     DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,   tArticle->mSuppliedCapacitance, DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the computeFlows and transportFlux methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testComputeAndTransportFlows()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 08: testComputeAndTransportFlows .........";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+
+    /// @test flux out of the node in demand mode.
+    tArticle->mOutData.mDemandMode  = true;
+    tArticle->mAdmittanceMatrix[0]  = 2.0;
+    tArticle->mSourceVector[0]      = 500.0;
+    tArticle->mPotentialVector[0]   = 260.0;
+    double expectedFlux = 2.0 * -260.0 + 500.0;
+    tArticle->computeFlows(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux,         tArticle->mFlux,                     DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux * 260.0, tArticle->mPower,                    DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedFlux,        tNodes[0].getScheduledOutflux(),     DBL_EPSILON);
+    CPPUNIT_ASSERT(GunnsBasicLink::SOURCE == tArticle->mPortDirections[0]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedFlux,        tNodes[0].getOutflux(),              DBL_EPSILON);
+
+    /// @test flux out of the node in supply mode.
+    tNodes[0].resetFlows();
+    tArticle->mOutData.mDemandMode = false;
+    tArticle->computeFlows(tTimeStep);
+    CPPUNIT_ASSERT(GunnsBasicLink::SINK == tArticle->mPortDirections[0]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tNodes[0].getScheduledOutflux(), DBL_EPSILON);
+
+    /// @test flux into the node.
+    tNodes[0].resetFlows();
+    tArticle->mSourceVector[0] = 600.0;
+    tArticle->computeFlows(tTimeStep);
+    CPPUNIT_ASSERT(GunnsBasicLink::SINK == tArticle->mPortDirections[0]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(80.0, tNodes[0].getInflux(), DBL_EPSILON);
+
+    /// @test the flux is only transported by computeFlows, so a transportFlows call doesn't
+    ///       collect it again.
+    tNodes[0].resetFlows();
+    tArticle->transportFlows(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tNodes[0].getInflux(), DBL_EPSILON);
+
+    /// @test no flux.
+    tArticle->mSourceVector[0] = 520.0;
+    tArticle->computeFlows(tTimeStep);
+    CPPUNIT_ASSERT(GunnsBasicLink::NONE == tArticle->mPortDirections[0]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the interface data class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testData()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 09: testData .............................";
+
+    GunnsBasicDistributedIfData data;
+    CPPUNIT_ASSERT(false == data.hasValidData());
+    data.mFrameCount = 1;
+    CPPUNIT_ASSERT(true  == data.hasValidData());
+    data.mSource = -1.0;
+    CPPUNIT_ASSERT(true  == data.hasValidData());
+    data.mCapacitance = -1.0;
+    CPPUNIT_ASSERT(false == data.hasValidData());
+
+    /// @test assignment operator.
+    data.mFrameLoopback = 2;
+    data.mDemandMode    = true;
+    GunnsBasicDistributedIfData data2;
+    data2 = data;
+    CPPUNIT_ASSERT(1    == data2.mFrameCount);
+    CPPUNIT_ASSERT(2    == data2.mFrameLoopback);
+    CPPUNIT_ASSERT(true == data2.mDemandMode);
+    CPPUNIT_ASSERT(-1.0 == data2.mCapacitance);
+    CPPUNIT_ASSERT(-1.0 == data2.mSource);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a pair of interfaces between two single-node networks exchanging data with a
+///           one-frame lag in each direction.  Each network's one-node system of equations is
+///           solved here in place of the GUNNS solver.  The smaller-capacitance side should take
+///           the Demand role, follow the Supply side potential, and pass its load flux through to
+///           the Supply side stably.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicDistributedIf::testPairedInterface()
+{
+    std::cout << "\n UtGunnsBasicDistributedIf 10: testPairedInterface ..................";
+
+    /// - Side A is the nominal test article & nodes, with a larger capacitance.
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+
+    /// - Side B is a separate network with smaller capacitance and a constant flux load.
+    GunnsBasicNode nodesB[2];
+    GunnsNodeList  nodeListB;
+    nodeListB.mNumNodes = 2;
+    nodeListB.mNodes    = nodesB;
+    nodesB[0].initialize("nodeB0", 200.0);
+    nodesB[1].initialize("nodeB1", 0.0);
+    std::vector<GunnsBasicLink*> linksB;
+    GunnsBasicCapacitor capB;
+    GunnsBasicCapacitorConfigData capConfigB("capB", &nodeListB);
+    GunnsBasicCapacitorInputData  capInputB(false, 0.0, 5.0, 200.0);
+    capB.initialize(capConfigB, capInputB, linksB, 0, 1);
+    FriendlyGunnsBasicDistributedIf articleB;
+    GunnsBasicDistributedIfConfigData configB("articleB", &nodeListB, false, tDemandOption, &capB);
+    articleB.initialize(configB, *tInputData, linksB, 0);
+    const double load = 2.0;
+
+    GunnsBasicCapacitor*             caps[2]  = {&tCapacitorLink, &capB};
+    FriendlyGunnsBasicDistributedIf* ifs[2]   = {tArticle, &articleB};
+    GunnsBasicNode*                  nodes[2] = {&tNodes[0], &nodesB[0]};
+    const double                     loads[2] = {0.0, -load};
+
+    double lastPotentialA = tNodes[0].getPotential();
+    double lastDeltaA     = 0.0;
+    const int frames = 200;
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int side = 0; side < 2; ++side) {
+            /// - Network step: inputs, link contributions, solve, flows & outputs.
+            ifs[side]->processInputs();
+            caps[side]->step(tTimeStep);
+            ifs[side]->step(tTimeStep);
+            const double a = caps[side]->getAdmittanceMatrix()[0] + ifs[side]->getAdmittanceMatrix()[0];
+            const double w = caps[side]->getSourceVector()[0]     + ifs[side]->getSourceVector()[0]
+                           + loads[side];
+            const double p = w / a;
+            nodes[side]->setPotential(p);
+            nodes[side]->setNetworkCapacitance(a * tTimeStep);
+            caps[side]->getPotentialVector()[0] = p;
+            ifs[side]->getPotentialVector()[0]  = p;
+            ifs[side]->computeFlows(tTimeStep);
+            ifs[side]->processOutputs();
+        }
+
+        /// - Exchange interface data with a one-frame lag in each direction.
+        tArticle->mInData = articleB.mOutData;
+        articleB.mInData  = tArticle->mOutData;
+
+        /// - Supply side potential never increases, since it only ever supplies the load.
+        if (frame > 2) {
+            CPPUNIT_ASSERT(tNodes[0].getPotential() <= lastPotentialA + FLT_EPSILON);
+        }
+        lastDeltaA     = lastPotentialA - tNodes[0].getPotential();
+        lastPotentialA = tNodes[0].getPotential();
+    }
+
+    /// @test the smaller-capacitance side took the Demand role and its capacitance was zeroed.
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(true  == articleB.mOutData.mDemandMode);
+    CPPUNIT_ASSERT(0.0   == capB.getCapacitance());
+    CPPUNIT_ASSERT(2     == tArticle->mLoopLatency);
+
+    /// @test the Demand side passes its load flux to the Supply side, the Supply side potential
+    ///       drains at the load rate over its capacitance, and the Demand side tracks it.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(load,  articleB.mFlux,          1.0e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-load, tArticle->mFlux,         1.0e-6);
+    const double drainRate = load / 10.0;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(drainRate * tTimeStep, lastDeltaA, 1.0e-6);
+    CPPUNIT_ASSERT(fabs(nodesB[0].getPotential() - tNodes[0].getPotential()) < 1.0);
+
+    std::cout << "... Pass";
+}
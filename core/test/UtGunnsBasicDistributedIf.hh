@@ -0,0 +1,102 @@
+#ifndef UtGunnsBasicDistributedIf_EXISTS
+#define UtGunnsBasicDistributedIf_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_BASIC_DISTRIBUTED_IF    Gunns Basic Distributed Interface Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Basic Distributed Interface
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/GunnsBasicDistributedIf.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicNode.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsBasicDistributedIf and befriend UtGunnsBasicDistributedIf.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsBasicDistributedIf : public GunnsBasicDistributedIf
+{
+    public:
+        FriendlyGunnsBasicDistributedIf();
+        virtual ~FriendlyGunnsBasicDistributedIf();
+        friend class UtGunnsBasicDistributedIf;
+};
+inline FriendlyGunnsBasicDistributedIf::FriendlyGunnsBasicDistributedIf()
+    : GunnsBasicDistributedIf() {};
+inline FriendlyGunnsBasicDistributedIf::~FriendlyGunnsBasicDistributedIf() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Basic Distributed Interface unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsBasicDistributedIf class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsBasicDistributedIf: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsBasicDistributedIf(const UtGunnsBasicDistributedIf& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsBasicDistributedIf& operator =(const UtGunnsBasicDistributedIf& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsBasicDistributedIf);
+        CPPUNIT_TEST(testConfigAndInput);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testNominalInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testProcessInputs);
+        CPPUNIT_TEST(testProcessOutputs);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testComputeAndTransportFlows);
+        CPPUNIT_TEST(testData);
+        CPPUNIT_TEST(testPairedInterface);
+        CPPUNIT_TEST_SUITE_END();
+
+        GunnsBasicDistributedIfConfigData* tConfigData;        /**< (--) Nominal config data */
+        GunnsBasicDistributedIfInputData*  tInputData;         /**< (--) Nominal input data */
+        FriendlyGunnsBasicDistributedIf*   tArticle;           /**< (--) Article under test */
+        std::string                        tLinkName;          /**< (--) Nominal config data */
+        bool                               tIsPairMaster;      /**< (--) Nominal config data */
+        bool                               tDemandOption;      /**< (--) Nominal config data */
+        bool                               tMalfBlockageFlag;  /**< (--) Nominal input data */
+        double                             tMalfBlockageValue; /**< (--) Nominal input data */
+        GunnsBasicNode                     tNodes[2];          /**< (--) Test nodes */
+        GunnsNodeList                      tNodeList;          /**< (--) Test node list */
+        std::vector<GunnsBasicLink*>       tLinks;             /**< (--) Test links vector */
+        int                                tPort0;             /**< (--) Nominal init data */
+        double                             tTimeStep;          /**< (s)  Test time step */
+        GunnsBasicCapacitor                tCapacitorLink;     /**< (--) Node capacitor link */
+
+    public:
+        UtGunnsBasicDistributedIf();
+        virtual ~UtGunnsBasicDistributedIf();
+        void tearDown();
+        void setUp();
+        void testConfigAndInput();
+        void testDefaultConstruction();
+        void testNominalInitialization();
+        void testInitializationExceptions();
+        void testProcessInputs();
+        void testProcessOutputs();
+        void testStep();
+        void testComputeAndTransportFlows();
+        void testData();
+        void testPairedInterface();
+};
+
+///@}
+
+#endif
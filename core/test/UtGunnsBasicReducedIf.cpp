@@ -0,0 +1,575 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsBasicReducedIf.hh"
+#include "core/Gunns.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cfloat>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsBasicReducedIf class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsBasicReducedIf::UtGunnsBasicReducedIf()
+    :
+    tConfigData(),
+    tInputData(),
+    tArticle(),
+    tLinkName(),
+    tIsSupply(),
+    tNodes(),
+    tNodeList(),
+    tLinks(),
+    tPorts(),
+    tTimeStep()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsBasicReducedIf class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsBasicReducedIf::~UtGunnsBasicReducedIf()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+    delete tInputData;
+    delete tConfigData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::setUp()
+{
+    tLinkName           = "Test Basic Reduced Interface";
+    tNodeList.mNumNodes = 4;
+    tNodeList.mNodes    = tNodes;
+    tIsSupply           = true;
+    tTimeStep           = 0.1;
+    tPorts.clear();
+    tPorts.push_back(0);
+    tPorts.push_back(2);
+
+    tNodes[0].initialize("UtTestNode0", 100.0);
+    tNodes[1].initialize("UtTestNode1", 110.0);
+    tNodes[2].initialize("UtTestNode2", 120.0);
+    tNodes[3].initialize("UtTestNode3",   0.0);
+
+    /// - Define nominal configuration & input data
+    tConfigData = new GunnsBasicReducedIfConfigData(tLinkName, &tNodeList, tIsSupply);
+    tInputData  = new GunnsBasicLinkInputData(false, 0.0);
+
+    /// - Create the test article
+    tArticle = new FriendlyGunnsBasicReducedIf;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests construction of the configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testConfig()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsBasicReducedIf 01: testConfig ..............................";
+
+    /// @test nominal config data construction.
+    CPPUNIT_ASSERT(tLinkName  == tConfigData->mName);
+    CPPUNIT_ASSERT(tNodes     == tConfigData->mNodeList->mNodes);
+    CPPUNIT_ASSERT(tIsSupply  == tConfigData->mIsSupply);
+
+    /// @test default config data construction.
+    GunnsBasicReducedIfConfigData defaultConfig;
+    CPPUNIT_ASSERT(""    == defaultConfig.mName);
+    CPPUNIT_ASSERT(0     == defaultConfig.mNodeList);
+    CPPUNIT_ASSERT(false == defaultConfig.mIsSupply);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testDefaultConstruction()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 02: testDefaultConstruction .................";
+
+    /// @test default values.
+    CPPUNIT_ASSERT(0     == tArticle->mNumPorts);
+    CPPUNIT_ASSERT(false == tArticle->mIsSupply);
+    CPPUNIT_ASSERT(0     == tArticle->mPortFlux);
+    CPPUNIT_ASSERT(0     == tArticle->mInData.getNumPorts());
+    CPPUNIT_ASSERT(0     == tArticle->mOutData.mAdmittance);
+    CPPUNIT_ASSERT(false == tArticle->mReduction.isValid());
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test new/delete for code coverage.
+    GunnsBasicReducedIf* article = new GunnsBasicReducedIf();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests nominal initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testNominalInitialization()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 03: testNominalInitialization ...............";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, &tPorts);
+
+    /// @test base class & config data.
+    CPPUNIT_ASSERT(tLinkName == tArticle->getName());
+    CPPUNIT_ASSERT(2         == tArticle->mNumPorts);
+    CPPUNIT_ASSERT(0         == tArticle->getNodeMap()[0]);
+    CPPUNIT_ASSERT(2         == tArticle->getNodeMap()[1]);
+    CPPUNIT_ASSERT(true      == tArticle->isSupply());
+
+    /// @test port fluxes, interface data and port reduction.
+    CPPUNIT_ASSERT(0.0 == tArticle->getPortFlux()[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle->getPortFlux()[1]);
+    CPPUNIT_ASSERT(2   == tArticle->mInData.getNumPorts());
+    CPPUNIT_ASSERT(2   == tArticle->mOutData.getNumPorts());
+    CPPUNIT_ASSERT(0.0 == tArticle->mOutData.mAdmittance[3]);
+    CPPUNIT_ASSERT(0.0 == tArticle->mOutData.mSource[1]);
+    CPPUNIT_ASSERT(0.0 == tArticle->mOutData.mFlux[1]);
+    CPPUNIT_ASSERT(2   == tArticle->mReduction.getNumPorts());
+    CPPUNIT_ASSERT(2   == tArticle->mReduction.getNode(1));
+    CPPUNIT_ASSERT(true == tArticle->mInitFlag);
+
+    /// @test restart invalidates the port reduction.
+    const double potential[3] = {100.0, 110.0, 120.0};
+    const double column0[3]   = {1.0, 0.0, 0.0};
+    const double column1[3]   = {0.0, 0.0, 2.0};
+    tArticle->mReduction.loadImpedanceColumn(0, column0);
+    tArticle->mReduction.loadImpedanceColumn(1, column1);
+    tArticle->mReduction.computeNorton(potential);
+    CPPUNIT_ASSERT(true  == tArticle->mReduction.isValid());
+    tArticle->restart();
+    CPPUNIT_ASSERT(false == tArticle->mReduction.isValid());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 04: testInitializationExceptions ............";
+
+    /// @test exception on null ports vector.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, 0),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test exception on empty ports vector.
+    std::vector<int> ports;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, &ports),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test exception on duplicate port nodes.
+    ports.push_back(1);
+    ports.push_back(1);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, &ports),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test exception on a port on the ground node.
+    ports[1] = 3;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, &ports),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the interface data class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testData()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 05: testData ................................";
+
+    /// @test uninitialized data is invalid.
+    GunnsBasicReducedIfData data1;
+    data1.mFrameCount = 1;
+    CPPUNIT_ASSERT(false == data1.hasValidData());
+
+    /// @test initialization.
+    data1.initialize("data1", 2);
+    CPPUNIT_ASSERT(2   == data1.getNumPorts());
+    CPPUNIT_ASSERT(0.0 == data1.mAdmittance[3]);
+    CPPUNIT_ASSERT(0.0 == data1.mSource[1]);
+    CPPUNIT_ASSERT(0.0 == data1.mFlux[1]);
+
+    /// @test validity checks.
+    CPPUNIT_ASSERT(true  == data1.hasValidData());
+    data1.mFrameCount = 0;
+    CPPUNIT_ASSERT(false == data1.hasValidData());
+    data1.mFrameCount = 1;
+    data1.mAdmittance[3] = -1.0;
+    CPPUNIT_ASSERT(false == data1.hasValidData());
+    data1.mAdmittance[3] = 1.0;
+
+    /// @test assignment operator.
+    data1.mFrameLoopback = 3;
+    data1.mAdmittance[1] = -0.5;
+    data1.mSource[1]     = 2.0;
+    data1.mFlux[0]       = 4.0;
+    GunnsBasicReducedIfData data2;
+    data2.initialize("data2", 2);
+    data2 = data1;
+    CPPUNIT_ASSERT(1    == data2.mFrameCount);
+    CPPUNIT_ASSERT(3    == data2.mFrameLoopback);
+    CPPUNIT_ASSERT(-0.5 == data2.mAdmittance[1]);
+    CPPUNIT_ASSERT(1.0  == data2.mAdmittance[3]);
+    CPPUNIT_ASSERT(2.0  == data2.mSource[1]);
+    CPPUNIT_ASSERT(4.0  == data2.mFlux[0]);
+
+    /// @test self-assignment.
+    data2 = data2;
+    CPPUNIT_ASSERT(3 == data2.mFrameLoopback);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the step method in the Supply role.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testStepSupply()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 06: testStepSupply ..........................";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, &tPorts);
+
+    /// @test no source until valid data is received.
+    tArticle->mInData.mFlux[0] = 1.0;
+    tArticle->mInData.mFlux[1] = 2.0;
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT(0.0 == tArticle->mSourceVector[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle->mSourceVector[1]);
+
+    /// @test demanded fluxes are applied out of the nodes, with no admittance, and excluded from
+    ///       the port reduction.
+    tArticle->mInData.mFrameCount = 1;
+    tArticle->mAdmittanceMatrix[2] = 1.0;
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT(-1.0 == tArticle->mSourceVector[0]);
+    CPPUNIT_ASSERT(-2.0 == tArticle->mSourceVector[1]);
+    CPPUNIT_ASSERT( 0.0 == tArticle->mAdmittanceMatrix[2]);
+    CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
+
+    /// - With unit port impedances and zero potentials, the Norton source is the negative of the
+    ///   excluded source and the Norton admittance is the unexcluded identity.
+    const double potential[3] = {0.0, 0.0, 0.0};
+    const double column0[3]   = {1.0, 0.0, 0.0};
+    const double column1[3]   = {0.0, 0.0, 1.0};
+    tArticle->mReduction.loadImpedanceColumn(0, column0);
+    tArticle->mReduction.loadImpedanceColumn(1, column1);
+    tArticle->mReduction.computeNorton(potential);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tArticle->mReduction.getSource()[0],     DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tArticle->mReduction.getSource()[1],     DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tArticle->mReduction.getAdmittance()[0], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mReduction.getAdmittance()[1], DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the step method in the Demand role.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testStepDemand()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 07: testStepDemand ..........................";
+
+    tConfigData->mIsSupply = false;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, &tPorts);
+    tArticle->mInData.mAdmittance[0] =  2.0;
+    tArticle->mInData.mAdmittance[1] = -1.0;
+    tArticle->mInData.mAdmittance[2] = -1.0;
+    tArticle->mInData.mAdmittance[3] =  3.0;
+    tArticle->mInData.mSource[0]     = 10.0;
+    tArticle->mInData.mSource[1]     = 20.0;
+
+    /// @test no contributions until valid data is received.
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT(0.0   == tArticle->mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(0.0   == tArticle->mSourceVector[1]);
+    CPPUNIT_ASSERT(false == tArticle->needAdmittanceUpdate());
+
+    /// @test the Supply side equivalent is stamped onto the nodes.
+    tArticle->mInData.mFrameCount = 1;
+    tArticle->step(tTimeStep);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(tArticle->mInData.mAdmittance[i] == tArticle->mAdmittanceMatrix[i]);
+    }
+    CPPUNIT_ASSERT(10.0 == tArticle->mSourceVector[0]);
+    CPPUNIT_ASSERT(20.0 == tArticle->mSourceVector[1]);
+    CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
+
+    /// @test no admittance update when the equivalent doesn't change.
+    tArticle->mAdmittanceUpdate = false;
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT(false == tArticle->needAdmittanceUpdate());
+
+    /// @test contributions are removed on invalid data.
+    tArticle->mInData.mAdmittance[0] = -1.0;
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT(0.0  == tArticle->mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(0.0  == tArticle->mAdmittanceMatrix[1]);
+    CPPUNIT_ASSERT(0.0  == tArticle->mSourceVector[0]);
+    CPPUNIT_ASSERT(true == tArticle->needAdmittanceUpdate());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the computeFlows and transportFlows methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testComputeFlows()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 08: testComputeFlows ........................";
+
+    tConfigData->mIsSupply = false;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, &tPorts);
+    tArticle->mAdmittanceMatrix[0] =  2.0;
+    tArticle->mAdmittanceMatrix[1] = -1.0;
+    tArticle->mAdmittanceMatrix[2] = -1.0;
+    tArticle->mAdmittanceMatrix[3] =  3.0;
+    tArticle->mSourceVector[0]     = 90.0;
+    tArticle->mSourceVector[1]     = 200.0;
+    tArticle->mPotentialVector[0]  = 100.0;
+    tArticle->mPotentialVector[1]  = 120.0;
+
+    /// @test port fluxes are the equivalent source less the admittance times potentials.
+    const double expectedFlux0 = 90.0  - 2.0 * 100.0 + 1.0 * 120.0;
+    const double expectedFlux1 = 200.0 + 1.0 * 100.0 - 3.0 * 120.0;
+    tArticle->computeFlows(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux0, tArticle->getPortFlux()[0], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux1, tArticle->getPortFlux()[1], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux0 + expectedFlux1, tArticle->mFlux, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux0 * 100.0 + expectedFlux1 * 120.0,
+                                 tArticle->mPower, DBL_EPSILON);
+
+    /// @test fluxes are transported to the port nodes.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedFlux0,  tNodes[0].getInflux(),  DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-expectedFlux1, tNodes[2].getOutflux(), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,            tNodes[1].getInflux(),  DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the processOutputs method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testProcessOutputs()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 09: testProcessOutputs ......................";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, &tPorts);
+    tArticle->mInData.mFrameCount = 7;
+
+    /// @test Supply role outputs the valid port reduction, with impedances of 1 & 2 at the ports.
+    const double potential[3] = {100.0, 110.0, 120.0};
+    const double column0[3]   = {1.0, 0.0, 0.0};
+    const double column1[3]   = {0.0, 0.0, 2.0};
+    tArticle->mReduction.loadImpedanceColumn(0, column0);
+    tArticle->mReduction.loadImpedanceColumn(1, column1);
+    tArticle->mReduction.computeNorton(potential);
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT(1 == tArticle->mOutData.mFrameCount);
+    CPPUNIT_ASSERT(7 == tArticle->mOutData.mFrameLoopback);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,   tArticle->mOutData.mAdmittance[0], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,   tArticle->mOutData.mAdmittance[1], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5,   tArticle->mOutData.mAdmittance[3], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, tArticle->mOutData.mSource[0],     DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(60.0,  tArticle->mOutData.mSource[1],     DBL_EPSILON);
+
+    /// @test Supply role holds the last valid equivalent when the reduction is invalid.
+    tArticle->mReduction.invalidate();
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT(2 == tArticle->mOutData.mFrameCount);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(60.0,  tArticle->mOutData.mSource[1],     DBL_EPSILON);
+
+    /// @test Demand role outputs the port fluxes.
+    tArticle->mIsSupply    = false;
+    tArticle->mPortFlux[0] = 3.0;
+    tArticle->mPortFlux[1] = -4.0;
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT(3    == tArticle->mOutData.mFrameCount);
+    CPPUNIT_ASSERT(3.0  == tArticle->mOutData.mFlux[0]);
+    CPPUNIT_ASSERT(-4.0 == tArticle->mOutData.mFlux[1]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the specific port rules.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testPortRules()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 10: testPortRules ...........................";
+
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, &tPorts);
+
+    /// @test no port can be mapped to the ground node.
+    CPPUNIT_ASSERT(false == tArticle->checkSpecificPortRules(0, 3));
+    CPPUNIT_ASSERT(false == tArticle->checkSpecificPortRules(1, 3));
+    CPPUNIT_ASSERT(true  == tArticle->checkSpecificPortRules(1, 1));
+
+    /// @test the port reduction follows port re-mapping.
+    CPPUNIT_ASSERT(true == tArticle->setPort(1, 1));
+    CPPUNIT_ASSERT(1    == tArticle->mReduction.getNode(1));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a pair of interfaces coupling two networks across two cross-coupled paths,
+///           against the monolithic solution of the combined network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsBasicReducedIf::testCoupledNetworks()
+{
+    std::cout << "\n UtGunnsBasicReducedIf 11: testCoupledNetworks .....................";
+
+    GunnsConfigData              netConfig("net", 1.0E-12, 1.0, 1, 1);
+    GunnsBasicLinkInputData      linkInput;
+    GunnsBasicConductorInputData condInput;
+
+    /// - Supply network: nodes 0 & 1 are the interface, node 2 is held at 100 by a potential
+    ///   source and conducts to both interface nodes, and the interface nodes conduct to each other.
+    GunnsBasicNode               sNodes[4];
+    GunnsNodeList                sNodeList(4, sNodes);
+    std::vector<GunnsBasicLink*> sLinks;
+    Gunns                        sNetwork;
+    sNodes[0].initialize("sNode0", 0.0);
+    sNodes[1].initialize("sNode1", 0.0);
+    sNodes[2].initialize("sNode2", 0.0);
+    sNodes[3].initialize("sNode3", 0.0);
+    sNetwork.initializeNodes(sNodeList);
+    GunnsBasicPotentialConfigData sSourceConfig("sSource", &sNodeList, 10.0);
+    GunnsBasicPotentialInputData  sSourceInput(false, 0.0, 100.0);
+    GunnsBasicPotential           sSource;
+    sSource.initialize(sSourceConfig, sSourceInput, sLinks, 3, 2);
+    GunnsBasicConductorConfigData sCond20Config("sCond20", &sNodeList, 2.0);
+    GunnsBasicConductorConfigData sCond21Config("sCond21", &sNodeList, 3.0);
+    GunnsBasicConductorConfigData sCond01Config("sCond01", &sNodeList, 1.0);
+    GunnsBasicConductor           sCond20;
+    GunnsBasicConductor           sCond21;
+    GunnsBasicConductor           sCond01;
+    sCond20.initialize(sCond20Config, condInput, sLinks, 2, 0);
+    sCond21.initialize(sCond21Config, condInput, sLinks, 2, 1);
+    sCond01.initialize(sCond01Config, condInput, sLinks, 0, 1);
+    std::vector<int> ports;
+    ports.push_back(0);
+    ports.push_back(1);
+    GunnsBasicReducedIfConfigData supplyConfig("supply", &sNodeList, true);
+    GunnsBasicReducedIf           supply;
+    supply.initialize(supplyConfig, linkInput, sLinks, &ports);
+    netConfig.mName = "sNetwork";
+    sNetwork.initialize(netConfig, sLinks);
+    sNetwork.addPortReduction(&supply.mReduction);
+    sNetwork.addPortReduction(&supply.mReduction);
+    sNetwork.addPortReduction(0);
+
+    /// - Demand network: nodes 0 & 1 are the interface, with loads to ground and each other.
+    GunnsBasicNode               dNodes[3];
+    GunnsNodeList                dNodeList(3, dNodes);
+    std::vector<GunnsBasicLink*> dLinks;
+    Gunns                        dNetwork;
+    dNodes[0].initialize("dNode0", 0.0);
+    dNodes[1].initialize("dNode1", 0.0);
+    dNodes[2].initialize("dNode2", 0.0);
+    dNetwork.initializeNodes(dNodeList);
+    GunnsBasicConductorConfigData dLoad0Config("dLoad0", &dNodeList, 0.5);
+    GunnsBasicConductorConfigData dLoad1Config("dLoad1", &dNodeList, 4.0);
+    GunnsBasicConductorConfigData dCond01Config("dCond01", &dNodeList, 0.2);
+    GunnsBasicConductor           dLoad0;
+    GunnsBasicConductor           dLoad1;
+    GunnsBasicConductor           dCond01;
+    dLoad0.initialize(dLoad0Config, condInput, dLinks, 0, 2);
+    dLoad1.initialize(dLoad1Config, condInput, dLinks, 1, 2);
+    dCond01.initialize(dCond01Config, condInput, dLinks, 0, 1);
+    GunnsBasicReducedIfConfigData demandConfig("demand", &dNodeList, false);
+    GunnsBasicReducedIf           demand;
+    demand.initialize(demandConfig, linkInput, dLinks, &ports);
+    netConfig.mName = "dNetwork";
+    dNetwork.initialize(netConfig, dLinks);
+
+    /// - Monolithic network combining both.
+    GunnsBasicNode               mNodes[4];
+    GunnsNodeList                mNodeList(4, mNodes);
+    std::vector<GunnsBasicLink*> mLinks;
+    Gunns                        mNetwork;
+    mNodes[0].initialize("mNode0", 0.0);
+    mNodes[1].initialize("mNode1", 0.0);
+    mNodes[2].initialize("mNode2", 0.0);
+    mNodes[3].initialize("mNode3", 0.0);
+    mNetwork.initializeNodes(mNodeList);
+    GunnsBasicPotentialConfigData mSourceConfig("mSource", &mNodeList, 10.0);
+    GunnsBasicPotential           mSource;
+    mSource.initialize(mSourceConfig, sSourceInput, mLinks, 3, 2);
+    GunnsBasicConductorConfigData mCond20Config("mCond20", &mNodeList, 2.0);
+    GunnsBasicConductorConfigData mCond21Config("mCond21", &mNodeList, 3.0);
+    GunnsBasicConductorConfigData mCond01Config("mCond01", &mNodeList, 1.2);
+    GunnsBasicConductorConfigData mLoad0Config ("mLoad0",  &mNodeList, 0.5);
+    GunnsBasicConductorConfigData mLoad1Config ("mLoad1",  &mNodeList, 4.0);
+    GunnsBasicConductor           mCond20;
+    GunnsBasicConductor           mCond21;
+    GunnsBasicConductor           mCond01;
+    GunnsBasicConductor           mLoad0;
+    GunnsBasicConductor           mLoad1;
+    mCond20.initialize(mCond20Config, condInput, mLinks, 2, 0);
+    mCond21.initialize(mCond21Config, condInput, mLinks, 2, 1);
+    mCond01.initialize(mCond01Config, condInput, mLinks, 0, 1);
+    mLoad0.initialize (mLoad0Config,  condInput, mLinks, 0, 3);
+    mLoad1.initialize (mLoad1Config,  condInput, mLinks, 1, 3);
+    netConfig.mName = "mNetwork";
+    mNetwork.initialize(netConfig, mLinks);
+
+    /// - Run the networks with a one-frame interface data lag in each direction.
+    for (int frame = 0; frame < 5; ++frame) {
+        sNetwork.step(tTimeStep);
+        dNetwork.step(tTimeStep);
+        mNetwork.step(tTimeStep);
+        demand.mInData = supply.mOutData;
+        supply.mInData = demand.mOutData;
+    }
+
+    /// @test the Supply network equivalent is the Schur complement of its admittance matrix onto
+    ///       the interface nodes, and its Norton source excludes the demanded fluxes.
+    CPPUNIT_ASSERT(true == supply.mReduction.isValid());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 3.0 - 4.0/15.0, supply.mOutData.mAdmittance[0], 1.0E-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0 - 6.0/15.0, supply.mOutData.mAdmittance[1], 1.0E-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0 - 6.0/15.0, supply.mOutData.mAdmittance[2], 1.0E-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 4.0 - 9.0/15.0, supply.mOutData.mAdmittance[3], 1.0E-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2000.0/15.0,     supply.mOutData.mSource[0],     1.0E-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3000.0/15.0,     supply.mOutData.mSource[1],     1.0E-9);
+
+    /// @test both sides match the monolithic solution, including the cross-coupling.
+    for (int node = 0; node < 2; ++node) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(mNodes[node].getPotential(), sNodes[node].getPotential(), 1.0E-9);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(mNodes[node].getPotential(), dNodes[node].getPotential(), 1.0E-9);
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mNodes[2].getPotential(), sNodes[2].getPotential(), 1.0E-9);
+
+    /// @test flux is conserved across the interface.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-demand.getPortFlux()[0], supply.getPortFlux()[0], 1.0E-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-demand.getPortFlux()[1], supply.getPortFlux()[1], 1.0E-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mLoad0.getFlux() + mLoad1.getFlux(), demand.getFlux(), 1.0E-9);
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,98 @@
+#ifndef UtGunnsBasicReducedIf_EXISTS
+#define UtGunnsBasicReducedIf_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_BASIC_REDUCED_IF    Gunns Basic Reduced Interface Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Basic Reduced Interface
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/GunnsBasicReducedIf.hh"
+#include "core/GunnsBasicNode.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsBasicReducedIf and befriend UtGunnsBasicReducedIf.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsBasicReducedIf : public GunnsBasicReducedIf
+{
+    public:
+        FriendlyGunnsBasicReducedIf();
+        virtual ~FriendlyGunnsBasicReducedIf();
+        friend class UtGunnsBasicReducedIf;
+};
+inline FriendlyGunnsBasicReducedIf::FriendlyGunnsBasicReducedIf() : GunnsBasicReducedIf() {};
+inline FriendlyGunnsBasicReducedIf::~FriendlyGunnsBasicReducedIf() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Basic Reduced Interface unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsBasicReducedIf class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsBasicReducedIf: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsBasicReducedIf(const UtGunnsBasicReducedIf& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsBasicReducedIf& operator =(const UtGunnsBasicReducedIf& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsBasicReducedIf);
+        CPPUNIT_TEST(testConfig);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testNominalInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testData);
+        CPPUNIT_TEST(testStepSupply);
+        CPPUNIT_TEST(testStepDemand);
+        CPPUNIT_TEST(testComputeFlows);
+        CPPUNIT_TEST(testProcessOutputs);
+        CPPUNIT_TEST(testPortRules);
+        CPPUNIT_TEST(testCoupledNetworks);
+        CPPUNIT_TEST_SUITE_END();
+
+        GunnsBasicReducedIfConfigData* tConfigData; /**< (--) Nominal config data */
+        GunnsBasicLinkInputData*       tInputData;  /**< (--) Nominal input data */
+        FriendlyGunnsBasicReducedIf*   tArticle;    /**< (--) Article under test */
+        std::string                    tLinkName;   /**< (--) Nominal config data */
+        bool                           tIsSupply;   /**< (--) Nominal config data */
+        GunnsBasicNode                 tNodes[4];   /**< (--) Test nodes */
+        GunnsNodeList                  tNodeList;   /**< (--) Test node list */
+        std::vector<GunnsBasicLink*>   tLinks;      /**< (--) Test links vector */
+        std::vector<int>               tPorts;      /**< (--) Nominal init data */
+        double                         tTimeStep;   /**< (s)  Test time step */
+
+    public:
+        UtGunnsBasicReducedIf();
+        virtual ~UtGunnsBasicReducedIf();
+        void tearDown();
+        void setUp();
+        void testConfig();
+        void testDefaultConstruction();
+        void testNominalInitialization();
+        void testInitializationExceptions();
+        void testData();
+        void testStepSupply();
+        void testStepDemand();
+        void testComputeFlows();
+        void testProcessOutputs();
+        void testPortRules();
+        void testCoupledNetworks();
+};
+
+///@}
+
+#endif
@@ -0,0 +1,314 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsDistributedIfPredictor.hh"
+#include "GunnsFluidDistributedIfLagBuffer.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cfloat>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsDistributedIfPredictor class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsDistributedIfPredictor::UtGunnsDistributedIfPredictor()
+    :
+    tArticle(),
+    tName(),
+    tMaxHorizon(),
+    tMaxDeltaFraction()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsDistributedIfPredictor class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsDistributedIfPredictor::~UtGunnsDistributedIfPredictor()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::setUp()
+{
+    tName             = "tArticle";
+    tMaxHorizon       = 10.0;
+    tMaxDeltaFraction = 0.5;
+    tArticle          = new FriendlyGunnsDistributedIfPredictor();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsDistributedIfPredictor 01: testDefaultConstruction .............";
+
+    /// @test default values.
+    CPPUNIT_ASSERT(""    == tArticle->mName);
+    CPPUNIT_ASSERT(0.0   == tArticle->mMaxHorizon);
+    CPPUNIT_ASSERT(0.0   == tArticle->mMaxDeltaFraction);
+    CPPUNIT_ASSERT(0     == tArticle->mNumSamples);
+    for (unsigned int i = 0; i < GunnsDistributedIfPredictor::NSAMPLES; ++i) {
+        CPPUNIT_ASSERT(0   == tArticle->mSampleFrame[i]);
+        CPPUNIT_ASSERT(0.0 == tArticle->mSampleValue[i]);
+    }
+    CPPUNIT_ASSERT(0.0   == tArticle->getRate());
+    CPPUNIT_ASSERT(0     == tArticle->mFramesSinceSample);
+    CPPUNIT_ASSERT(0.0   == tArticle->mHorizon);
+    CPPUNIT_ASSERT(0.0   == tArticle->getPrediction());
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+    CPPUNIT_ASSERT(0     == tArticle->getFallbackCount());
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test an uninitialized predictor holds the received value.
+    tArticle->predict(1, 100.0, 1.0);
+    tArticle->predict(2, 110.0, 1.0);
+    CPPUNIT_ASSERT(120.0 == tArticle->predict(3, 120.0, 1.0));
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+
+    /// @test new/delete for code coverage.
+    GunnsDistributedIfPredictor* article = new GunnsDistributedIfPredictor();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests nominal initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::testNominalInitialization()
+{
+    std::cout << "\n UtGunnsDistributedIfPredictor 02: testNominalInitialization ...........";
+
+    /// @test nominal initialization.
+    tArticle->mNumSamples    = 2;
+    tArticle->mRate          = 1.0;
+    tArticle->mFallbackCount = 3;
+    tArticle->initialize(tName, tMaxHorizon, tMaxDeltaFraction);
+    CPPUNIT_ASSERT(tName             == tArticle->mName);
+    CPPUNIT_ASSERT(tMaxHorizon       == tArticle->mMaxHorizon);
+    CPPUNIT_ASSERT(tMaxDeltaFraction == tArticle->mMaxDeltaFraction);
+    CPPUNIT_ASSERT(0                 == tArticle->mNumSamples);
+    CPPUNIT_ASSERT(0.0               == tArticle->getRate());
+    CPPUNIT_ASSERT(0                 == tArticle->getFallbackCount());
+    CPPUNIT_ASSERT(false             == tArticle->isPredicting());
+    CPPUNIT_ASSERT(true              == tArticle->mInitFlag);
+
+    /// @test zero limits are allowed.
+    tArticle->initialize(tName, 0.0, 0.0);
+    CPPUNIT_ASSERT(true == tArticle->mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsDistributedIfPredictor 03: testInitializationExceptions ........";
+
+    /// @test exception on empty name.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize("", tMaxHorizon, tMaxDeltaFraction),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test exception on maximum horizon < 0.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, -DBL_EPSILON, tMaxDeltaFraction),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test exception on maximum delta fraction not in [0, 1).
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, tMaxHorizon, -DBL_EPSILON),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, tMaxHorizon, 1.0),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests extrapolation of a ramp signal.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::testRamp()
+{
+    std::cout << "\n UtGunnsDistributedIfPredictor 04: testRamp ............................";
+
+    tArticle->initialize(tName, tMaxHorizon, tMaxDeltaFraction);
+
+    /// @test the received value is held until there is a full history, and repeated sender
+    ///       frames aren't added to the history.
+    CPPUNIT_ASSERT(102.0 == tArticle->predict(1, 102.0, 1.0));
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+    CPPUNIT_ASSERT(102.0 == tArticle->predict(1, 102.0, 1.0));
+    CPPUNIT_ASSERT(1     == tArticle->mNumSamples);
+    CPPUNIT_ASSERT(1     == tArticle->mFramesSinceSample);
+    CPPUNIT_ASSERT(104.0 == tArticle->predict(2, 104.0, 1.0));
+    CPPUNIT_ASSERT(2     == tArticle->mNumSamples);
+    CPPUNIT_ASSERT(0     == tArticle->mFramesSinceSample);
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tArticle->getRate(), DBL_EPSILON);
+
+    /// @test extrapolation over the lag with a full history.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(108.0, tArticle->predict(3, 106.0, 1.0), DBL_EPSILON);
+    CPPUNIT_ASSERT(true  == tArticle->isPredicting());
+    CPPUNIT_ASSERT(1.0   == tArticle->mHorizon);
+
+    /// @test frames since the last new sample add to the horizon.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(110.0, tArticle->predict(3, 106.0, 1.0), DBL_EPSILON);
+    CPPUNIT_ASSERT(2.0   == tArticle->mHorizon);
+
+    /// @test skipped sender frames are handled in the slope, and fractional lag.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(113.0, tArticle->predict(5, 110.0, 1.5), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tArticle->getRate(), DBL_EPSILON);
+    CPPUNIT_ASSERT(0     == tArticle->getFallbackCount());
+
+    /// @test reset discards the history.
+    tArticle->reset();
+    CPPUNIT_ASSERT(0     == tArticle->mNumSamples);
+    CPPUNIT_ASSERT(0.0   == tArticle->getRate());
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+    CPPUNIT_ASSERT(112.0 == tArticle->predict(6, 112.0, 1.0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the extrapolation limits.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::testLimits()
+{
+    std::cout << "\n UtGunnsDistributedIfPredictor 05: testLimits ..........................";
+
+    /// @test horizon is limited to the maximum.
+    tArticle->initialize(tName, 2.0, tMaxDeltaFraction);
+    tArticle->predict(1, 100.0, 5.0);
+    tArticle->predict(2, 110.0, 5.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(140.0, tArticle->predict(3, 120.0, 5.0), DBL_EPSILON);
+    CPPUNIT_ASSERT(2.0 == tArticle->mHorizon);
+
+    /// @test horizon is limited to >= 0.
+    CPPUNIT_ASSERT(120.0 == tArticle->predict(3, 120.0, -3.0));
+    CPPUNIT_ASSERT(0.0   == tArticle->mHorizon);
+
+    /// @test extrapolated change is limited to the fraction of the received value, increasing.
+    tArticle->initialize(tName, tMaxHorizon, 0.1);
+    tArticle->predict(1, 100.0, 5.0);
+    tArticle->predict(2, 110.0, 5.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(132.0, tArticle->predict(3, 120.0, 5.0), DBL_EPSILON);
+
+    /// @test extrapolated change is limited to the fraction of the received value, decreasing.
+    tArticle->reset();
+    tArticle->predict(4, 100.0, 5.0);
+    tArticle->predict(5,  90.0, 5.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(72.0, tArticle->predict(6, 80.0, 5.0), DBL_EPSILON);
+
+    /// @test the prediction never changes sign from the received value.
+    tArticle->initialize(tName, tMaxHorizon, 0.9);
+    tArticle->predict(1, 20.0, 9.0);
+    tArticle->predict(2, 15.0, 9.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tArticle->predict(3, 10.0, 9.0), DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the fallback to holding the received value when predictions diverge.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::testFallback()
+{
+    std::cout << "\n UtGunnsDistributedIfPredictor 06: testFallback ........................";
+
+    tArticle->initialize(tName, tMaxHorizon, tMaxDeltaFraction);
+    tArticle->predict(1, 100.0, 1.0);
+    tArticle->predict(2, 110.0, 1.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(130.0, tArticle->predict(3, 120.0, 1.0), DBL_EPSILON);
+
+    /// @test a ramp that stops is worse predicted than held, so the history is discarded and the
+    ///       received value is held.
+    CPPUNIT_ASSERT(120.0 == tArticle->predict(4, 120.0, 1.0));
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+    CPPUNIT_ASSERT(1     == tArticle->mNumSamples);
+    CPPUNIT_ASSERT(1     == tArticle->getFallbackCount());
+
+    /// @test prediction resumes once the history is rebuilt.
+    CPPUNIT_ASSERT(120.0 == tArticle->predict(5, 120.0, 1.0));
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+    CPPUNIT_ASSERT(120.0 == tArticle->predict(6, 120.0, 1.0));
+    CPPUNIT_ASSERT(true  == tArticle->isPredicting());
+
+    /// @test a change no worse predicted than held keeps the history.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(135.0, tArticle->predict(7, 130.0, 1.0), DBL_EPSILON);
+    CPPUNIT_ASSERT(1     == tArticle->getFallbackCount());
+    CPPUNIT_ASSERT(true  == tArticle->isPredicting());
+
+    /// @test an oscillation diverges.
+    CPPUNIT_ASSERT(120.0 == tArticle->predict(8, 120.0, 1.0));
+    CPPUNIT_ASSERT(false == tArticle->isPredicting());
+    CPPUNIT_ASSERT(2     == tArticle->getFallbackCount());
+
+    /// @test a sender frame count going backwards discards the history without counting it as a
+    ///       divergence.
+    tArticle->predict(9, 120.0, 1.0);
+    tArticle->predict(2, 100.0, 1.0);
+    CPPUNIT_ASSERT(1     == tArticle->mNumSamples);
+    CPPUNIT_ASSERT(2     == tArticle->mSampleFrame[0]);
+    CPPUNIT_ASSERT(2     == tArticle->getFallbackCount());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests prediction of a ramp sent through an interface data lag buffer recovers the
+///           sender's current value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsDistributedIfPredictor::testLagBuffer()
+{
+    std::cout << "\n UtGunnsDistributedIfPredictor 07: testLagBuffer .......................";
+
+    tArticle->initialize(tName, tMaxHorizon, tMaxDeltaFraction);
+
+    GunnsFluidDistributedIfLagBuffer buffer;
+    buffer.mDelayFrames = 4;
+    buffer.initialize();
+
+    /// @test the received pressure lags the sender by the buffer delay, and the prediction over
+    ///       the one-way lag matches the sender's current pressure once the history is full.
+    unsigned int numPredicted = 0;
+    for (unsigned int frame = 1; frame < 30; ++frame) {
+        const double sent = 1.0e5 + 10.0 * frame;
+        buffer.mHead1->mFrameCount = frame;
+        buffer.mHead1->mSource     = sent;
+        if (buffer.mTail1->mFrameCount > 0) {
+            const double received  = buffer.mTail1->mSource;
+            const double predicted = tArticle->predict(buffer.mTail1->mFrameCount, received,
+                                                       buffer.mDelayFrames);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(sent - 40.0, received, DBL_EPSILON);
+            if (tArticle->isPredicting()) {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(sent, predicted, 1.0e-9);
+                ++numPredicted;
+            }
+        }
+        buffer.step();
+    }
+    CPPUNIT_ASSERT(numPredicted > 20);
+    CPPUNIT_ASSERT(0 == tArticle->getFallbackCount());
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,84 @@
+#ifndef UtGunnsDistributedIfPredictor_EXISTS
+#define UtGunnsDistributedIfPredictor_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_DISTRIBUTED_IF_PREDICTOR    Gunns Distributed Interface Lag Predictor Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Distributed Interface Lag Predictor
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/GunnsDistributedIfPredictor.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsDistributedIfPredictor and befriend UtGunnsDistributedIfPredictor.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsDistributedIfPredictor : public GunnsDistributedIfPredictor
+{
+    public:
+        FriendlyGunnsDistributedIfPredictor();
+        virtual ~FriendlyGunnsDistributedIfPredictor();
+        friend class UtGunnsDistributedIfPredictor;
+};
+inline FriendlyGunnsDistributedIfPredictor::FriendlyGunnsDistributedIfPredictor()
+    : GunnsDistributedIfPredictor() {};
+inline FriendlyGunnsDistributedIfPredictor::~FriendlyGunnsDistributedIfPredictor() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Distributed Interface Lag Predictor unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsDistributedIfPredictor class within
+///           the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsDistributedIfPredictor: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsDistributedIfPredictor(const UtGunnsDistributedIfPredictor& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsDistributedIfPredictor& operator =(const UtGunnsDistributedIfPredictor& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsDistributedIfPredictor);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testNominalInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testRamp);
+        CPPUNIT_TEST(testLimits);
+        CPPUNIT_TEST(testFallback);
+        CPPUNIT_TEST(testLagBuffer);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyGunnsDistributedIfPredictor* tArticle;          /**< (--) Article under test */
+        std::string                          tName;             /**< (--) Nominal initialization data */
+        double                               tMaxHorizon;       /**< (--) Nominal initialization data */
+        double                               tMaxDeltaFraction; /**< (--) Nominal initialization data */
+
+    public:
+        UtGunnsDistributedIfPredictor();
+        virtual ~UtGunnsDistributedIfPredictor();
+        void tearDown();
+        void setUp();
+        void testDefaultConstruction();
+        void testNominalInitialization();
+        void testInitializationExceptions();
+        void testRamp();
+        void testLimits();
+        void testFallback();
+        void testLagBuffer();
+};
+
+///@}
+
+#endif
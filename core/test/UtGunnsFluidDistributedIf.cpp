@@ -139,6 +139,9 @@ void UtGunnsFluidDistributedIf::testConfig()
     CPPUNIT_ASSERT(false           == tConfigData->mFluidSizesOverride);
     CPPUNIT_ASSERT(0               == tConfigData->mNumFluidOverride);
     CPPUNIT_ASSERT(0               == tConfigData->mNumTcOverride);
+    CPPUNIT_ASSERT(false           == tConfigData->mPredictorOption);
+    CPPUNIT_ASSERT(10.0            == tConfigData->mPredictorMaxHorizon);
+    CPPUNIT_ASSERT(0.05            == tConfigData->mPredictorMaxFraction);
 
     /// - Check default config construction
     GunnsFluidDistributedIfConfigData defaultConfig;
@@ -228,6 +231,9 @@ void UtGunnsFluidDistributedIf::testDefaultConstruction()
     CPPUNIT_ASSERT(0     == tArticle->mTempMassFractions);
     CPPUNIT_ASSERT(0     == tArticle->mOtherIfs.size());
     CPPUNIT_ASSERT(0.0   == tArticle->mFluidState.getTemperature());
+    CPPUNIT_ASSERT(false == tArticle->mPredictorOption);
+    CPPUNIT_ASSERT(false == tArticle->mPressurePredictor.isPredicting());
+    CPPUNIT_ASSERT(false == tArticle->mEnergyPredictor.isPredicting());
 
     /// @test init flag
     CPPUNIT_ASSERT(!tArticle->mInitFlag);
@@ -389,6 +395,16 @@ void UtGunnsFluidDistributedIf::testInitializationExceptions()
     tInputData->mForceDemandMode = false;
     tInputData->mForceSupplyMode = false;
 
+    /// @test Exception on invalid predictor limits.
+    tConfigData->mPredictorMaxHorizon = -1.0;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0),
+                         TsInitializationException);
+    tConfigData->mPredictorMaxHorizon = 10.0;
+    tConfigData->mPredictorMaxFraction = 1.0;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0),
+                         TsInitializationException);
+    tConfigData->mPredictorMaxFraction = 0.05;
+
     std::cout << "... Pass";
 }
 
@@ -1302,3 +1318,78 @@ void UtGunnsFluidDistributedIf::testForceModes()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for the incoming Supply state predictor option in Demand mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIf::testPredictor()
+{
+    std::cout << "\n UtGunnsFluidDistributedIf 15: testPredictor ........................";
+
+    tConfigData->mPredictorOption = true;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+    CPPUNIT_ASSERT(true == tArticle->mPredictorOption);
+
+    /// - Incoming Supply data ramping in pressure & enthalpy.  We are the pair master with equal
+    ///   capacitances, so we flip to Demand mode on the first frame.
+    tArticle->mInData.mDemandMode       = false;
+    tArticle->mInData.mCapacitance      = 1.0;
+    tArticle->mInData.mMoleFractions[0] = 0.7;
+    tArticle->mInData.mMoleFractions[1] = 0.3;
+    tArticle->mOutData.mCapacitance     = 1.0;
+    tNodes[0].setVolume(1.0);
+
+    /// @test the incoming state is held until the predictors have a full history.
+    for (unsigned int frame = 1; frame < 3; ++frame) {
+        tArticle->mInData.mFrameCount = frame;
+        tArticle->mInData.mSource     = 1.0e5 + 1000.0 * frame;
+        tArticle->mInData.mEnergy     = 3.0e5 + 1000.0 * frame;
+        tArticle->processInputs();
+        CPPUNIT_ASSERT(true == tArticle->mOutData.mDemandMode);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0 + frame, tArticle->mSourcePressure, DBL_EPSILON);
+        CPPUNIT_ASSERT(false == tArticle->mPressurePredictor.isPredicting());
+    }
+    CPPUNIT_ASSERT(2 == tArticle->mLoopLatency);
+
+    /// @test the incoming pressure & enthalpy are extrapolated over half the loop lag, and the
+    ///       node & interface fluid state take the predicted values.
+    tArticle->mInData.mFrameCount = 3;
+    tArticle->mInData.mSource     = 1.03e5;
+    tArticle->mInData.mEnergy     = 3.03e5;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(true == tArticle->mPressurePredictor.isPredicting());
+    CPPUNIT_ASSERT(true == tArticle->mEnergyPredictor.isPredicting());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(104.0,  tArticle->mSourcePressure,                    1.0e-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(104.0,  tNodes[0].getContent()->getPressure(),         1.0e-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.04e5, tNodes[0].getContent()->getSpecificEnthalpy(), 1.0e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(104.0,  tArticle->mFluidState.getPressure(),           1.0e-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.7,    tNodes[0].getContent()->getMoleFraction(0),    DBL_EPSILON);
+
+    /// @test the predictors are reset on restart.
+    tArticle->restart();
+    CPPUNIT_ASSERT(false == tArticle->mPressurePredictor.isPredicting());
+    tArticle->mInData.mFrameCount = 4;
+    tArticle->mInData.mSource     = 1.04e5;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(104.0, tArticle->mSourcePressure, DBL_EPSILON);
+    tArticle->mInData.mFrameCount = 5;
+    tArticle->mInData.mSource     = 1.05e5;
+    tArticle->processInputs();
+    tArticle->mInData.mFrameCount = 6;
+    tArticle->mInData.mSource     = 1.06e5;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(true == tArticle->mPressurePredictor.isPredicting());
+
+    /// @test the predictors are reset on the flip to Supply mode, and the incoming demand flux is
+    ///       applied as received so that mass is conserved across the interface.
+    tArticle->mInData.mFrameCount = 7;
+    tArticle->mInData.mDemandMode = true;
+    tArticle->mInData.mSource     = -1.0;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(false == tArticle->mPressurePredictor.isPredicting());
+    CPPUNIT_ASSERT(false == tArticle->mEnergyPredictor.isPredicting());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0e-3, tArticle->mDemandFlux, 1.0e-14);
+
+    std::cout << "... Pass";
+}
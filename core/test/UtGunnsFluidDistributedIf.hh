@@ -84,6 +84,7 @@ class UtGunnsFluidDistributedIf: public CppUnit::TestFixture
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST(testData);
         CPPUNIT_TEST(testForceModes);
+        CPPUNIT_TEST(testPredictor);
         CPPUNIT_TEST_SUITE_END();
 
         GunnsFluidDistributedIfConfigData*  tConfigData;            /**< (--)   Nominal config data */
@@ -127,6 +128,7 @@ class UtGunnsFluidDistributedIf: public CppUnit::TestFixture
         void testRestart();
         void testData();
         void testForceModes();
+        void testPredictor();
 };
 
 ///@}
@@ -538,3 +538,38 @@ void UtGunnsFluidExternalDemand::testRestart()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for coupling to the supply network's Norton equivalent.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidExternalDemand::testNortonEquivalent()
+{
+    std::cout << "\n UtGunnsFluidExternalDemand 09: testNortonEquivalent ................";
+
+    /// - Initialize default test article with nominal initialization data.
+    tInputData->mMalfBlockageFlag = false;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+
+    /// @test The Norton admittance is used as the conductance and the Norton pressure as the
+    ///       source pressure, in preference to the supply capacitance and pressure.
+    tArticle->mSupplyPressure     = 500.0;
+    tArticle->mSupplyCapacitance  = 1.0;
+    tArticle->mSupplyAdmittance   = 100.0;
+    tArticle->mSupplySource       = 70000.0;
+    tArticle->processInputs();
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(700.0,   tArticle->mSourcePressure,        DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0,   tArticle->mEffectiveConductivity, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0,   tArticle->mAdmittanceMatrix[0],   DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(70000.0, tArticle->mSourceVector[1],       FLT_EPSILON);
+
+    /// @test Falls back to the supply capacitance and pressure without a Norton equivalent.
+    tArticle->mSupplyAdmittance   = 0.0;
+    tArticle->mSupplySource       = 0.0;
+    tArticle->processInputs();
+    tArticle->step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(500.0,   tArticle->mSourcePressure,        DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0 / tTimeStep, tArticle->mEffectiveConductivity, DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
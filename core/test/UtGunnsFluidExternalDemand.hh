@@ -59,6 +59,7 @@ class UtGunnsFluidExternalDemand: public CppUnit::TestFixture
         CPPUNIT_TEST(testIoMethods);
         CPPUNIT_TEST(testStep);
         CPPUNIT_TEST(testRestart);
+        CPPUNIT_TEST(testNortonEquivalent);
         CPPUNIT_TEST_SUITE_END();
 
         GunnsFluidExternalDemandConfigData* tConfigData;            /**< (--)  Nominal config data */
@@ -106,6 +107,7 @@ class UtGunnsFluidExternalDemand: public CppUnit::TestFixture
         void testIoMethods();
         void testStep();
         void testRestart();
+        void testNortonEquivalent();
 };
 
 ///@}
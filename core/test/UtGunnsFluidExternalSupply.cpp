@@ -547,3 +547,43 @@ void UtGunnsFluidExternalSupply::testRestart()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for the supply node port reduction output.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidExternalSupply::testPortReduction()
+{
+    std::cout << "\n UtGunnsFluidExternalSupply 10: testPortReduction ...................";
+
+    /// - Initialize default test article with nominal initialization data
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+
+    /// @test The port reduction is on the supply node and not valid until computed.
+    CPPUNIT_ASSERT(1      == tArticle->mReduction.getNumPorts());
+    CPPUNIT_ASSERT(tPort0 == tArticle->mReduction.getNode(0));
+    CPPUNIT_ASSERT(false  == tArticle->mReduction.isValid());
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mSupplyAdmittance, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mSupplySource,     0.0);
+
+    /// @test The demand flux is excluded from the equivalent output, with an impedance of 0.01 at
+    ///       the supply node.
+    tArticle->mFlux     = 0.5;
+    tArticle->mFlowRate = 0.0;
+    tArticle->step(tTimeStep);
+    const double potential[3] = {700.0, 689.0, 0.0};
+    const double column[3]    = {0.01,  0.0,   0.0};
+    tArticle->mReduction.loadImpedanceColumn(0, column);
+    tArticle->mReduction.computeNorton(potential);
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0,   tArticle->mSupplyAdmittance, FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(70000.5, tArticle->mSupplySource,     FLT_EPSILON);
+
+    /// @test Zero admittance is output when the reduction is invalid.
+    tArticle->mReduction.invalidate();
+    tArticle->processOutputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mSupplyAdmittance, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mSupplySource,     0.0);
+
+    std::cout << "... Pass";
+}
@@ -60,6 +60,7 @@ class UtGunnsFluidExternalSupply: public CppUnit::TestFixture
         CPPUNIT_TEST(testStep);
         CPPUNIT_TEST(testComputeFlows);
         CPPUNIT_TEST(testRestart);
+        CPPUNIT_TEST(testPortReduction);
         CPPUNIT_TEST_SUITE_END();
 
         GunnsFluidExternalSupplyConfigData* tConfigData;            /**< (--)   Nominal config data */
@@ -101,6 +102,7 @@ class UtGunnsFluidExternalSupply: public CppUnit::TestFixture
         void testStep();
         void testComputeFlows();
         void testRestart();
+        void testPortReduction();
 };
 
 ///@}
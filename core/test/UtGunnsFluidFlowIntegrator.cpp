@@ -193,6 +193,10 @@ void UtGunnsFluidFlowIntegrator::testInitialize()
     /// @test should have two fluid consituents in this test network.
     CPPUNIT_ASSERT(2          ==  tArticle.mNumFluidConstituents);
 
+    /// @test integration compensation terms are zeroed.
+    CPPUNIT_ASSERT(0.0        ==  tArticle.mIntegrationErrors[0]);
+    CPPUNIT_ASSERT(0.0        ==  tArticle.mIntegrationErrors[1]);
+
     /// - Test exception thrown from missing name.
     tConfig.mName = "";
     CPPUNIT_ASSERT_THROW(tArticle.initialize(&tConfig, &tInput), TsInitializationException);
@@ -0,0 +1,376 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+ ((core/GunnsFluidFlowIntegratorGroup.o))
+***************************************************************************************************/
+
+#include "UtGunnsFluidFlowIntegratorGroup.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsFluidFlowIntegratorGroup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidFlowIntegratorGroup::UtGunnsFluidFlowIntegratorGroup()
+    :
+    tArticle(0),
+    tNodes(),
+    tNodeList(),
+    tName("test article"),
+    tConfig(0),
+    tInput(0),
+    tFluidProperties(0),
+    tFluidConfig(0),
+    tFluidInput(),
+    tMassFractions(),
+    tLinks(),
+    tConductors(),
+    tConductorConfig(0),
+    tConductorInput(0),
+    tTimeStep(0.0),
+    tTolerance(0.0)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsFluidFlowIntegratorGroup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidFlowIntegratorGroup::~UtGunnsFluidFlowIntegratorGroup()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+    delete tConductorInput;
+    delete tConductorConfig;
+    for (int i = 0; i < 3; ++i) {
+        delete tFluidInput[i];
+    }
+    delete tFluidConfig;
+    delete tFluidProperties;
+    delete tInput;
+    delete tConfig;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.  Sets up 3 fluid nodes with different mixtures plus
+///           Ground, and 3 conductors connecting the non-ground nodes in a loop.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::setUp()
+{
+    tConfig = new GunnsFluidFlowIntegratorGroupConfigData(tName);
+    tInput  = new GunnsFluidFlowIntegratorGroupInputData();
+
+    /// - Setup some test fluid nodes.
+    tFluidProperties = new DefinedFluidProperties();
+    FluidProperties::FluidType types[2];
+    types[0] = FluidProperties::GUNNS_N2;
+    types[1] = FluidProperties::GUNNS_O2;
+    tFluidConfig = new PolyFluidConfigData(tFluidProperties, types, 2);
+    tMassFractions[0][0] = 0.5;
+    tMassFractions[0][1] = 0.5;
+    tMassFractions[1][0] = 0.8;
+    tMassFractions[1][1] = 0.2;
+    tMassFractions[2][0] = 0.3;
+    tMassFractions[2][1] = 0.7;
+    for (int i = 0; i < 3; ++i) {
+        tFluidInput[i] = new PolyFluidInputData(290.0, 700.0 - i, 0.0, 0.0, tMassFractions[i]);
+    }
+    tNodes[0].initialize("UtTestNode0", tFluidConfig);
+    tNodes[1].initialize("UtTestNode1", tFluidConfig);
+    tNodes[2].initialize("UtTestNode2", tFluidConfig);
+    tNodes[3].initialize("UtTestNode3", tFluidConfig);
+    for (int i = 0; i < 3; ++i) {
+        tNodes[i].getContent()->initialize(*tFluidConfig, *tFluidInput[i]);
+        tNodes[i].setPotential(tFluidInput[i]->mPressure);
+        tNodes[i].initVolume(1.0);
+    }
+    tNodeList.mNumNodes = 4;
+    tNodeList.mNodes    = tNodes;
+    tTimeStep           = 0.1;
+    tTolerance          = 1.0E-12;
+
+    /// - Initialize the conductors: 0->1, 1->2, 2->0.
+    tConductorConfig = new GunnsFluidConductorConfigData("Test Fluid Conductor", &tNodeList, 0.5, 0.4);
+    tConductorInput  = new GunnsFluidConductorInputData(true, 0.5);
+    tConductors[0].initialize(*tConductorConfig, *tConductorInput, tLinks, 0, 1);
+    tConductors[1].initialize(*tConductorConfig, *tConductorInput, tLinks, 1, 2);
+    tConductors[2].initialize(*tConductorConfig, *tConductorInput, tLinks, 2, 0);
+
+    /// - Create the test article and register the links.
+    tArticle = new FriendlyGunnsFluidFlowIntegratorGroup();
+    for (int i = 0; i < 3; ++i) {
+        tArticle->addLink(tConductors[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  conductor  (--)  The conductor to set the flow of.
+/// @param[in]  p0         (kPa) Port 0 potential.
+/// @param[in]  p1         (kPa) Port 1 potential.
+///
+/// @details  Sets the potentials across a conductor and computes and transports its flow.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::setFlow(GunnsFluidConductor& conductor, const double p0,
+                                              const double p1)
+{
+    double* potentials = conductor.getPotentialVector();
+    potentials[0] = p0;
+    potentials[1] = p1;
+    conductor.getAdmittanceMatrix()[0] = 1.0e-6;
+    conductor.computeFlows(tTimeStep);
+    conductor.transportFlows(tTimeStep);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the config and input data classes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::testConfigAndInput()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsFluidFlowIntegratorGroup 01: testConfigAndInput .............";
+
+    /// @test nominal config data construction.
+    CPPUNIT_ASSERT(tName == tConfig->mName);
+
+    /// @test new/delete for code coverage.
+    GunnsFluidFlowIntegratorGroupConfigData* config = new GunnsFluidFlowIntegratorGroupConfigData(tName);
+    delete config;
+    GunnsFluidFlowIntegratorGroupInputData* input = new GunnsFluidFlowIntegratorGroupInputData();
+    delete input;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the default constructor and link registration.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::testDefaultConstruction()
+{
+    std::cout << "\n UtGunnsFluidFlowIntegratorGroup 02: testDefaultConstruction ........";
+
+    /// @test default state data.
+    FriendlyGunnsFluidFlowIntegratorGroup article;
+    CPPUNIT_ASSERT(""    == article.mName);
+    CPPUNIT_ASSERT(0     == article.getNumLinks());
+    CPPUNIT_ASSERT(0     == article.mNumFluidConstituents);
+    CPPUNIT_ASSERT(0     == article.mPortNodes);
+    CPPUNIT_ASSERT(0     == article.mMassFractions);
+    CPPUNIT_ASSERT(0     == article.mIntegratedMasses);
+    CPPUNIT_ASSERT(0     == article.mIntegrationErrors);
+    CPPUNIT_ASSERT(false == article.isInitialized());
+
+    /// @test links are registered once each.
+    CPPUNIT_ASSERT(3 == tArticle->getNumLinks());
+    tArticle->addLink(tConductors[1]);
+    CPPUNIT_ASSERT(3 == tArticle->getNumLinks());
+    CPPUNIT_ASSERT(&tConductors[1] == tArticle->mLinks[1]);
+
+    /// @test new/delete for code coverage.
+    GunnsFluidFlowIntegratorGroup* article2 = new GunnsFluidFlowIntegratorGroup();
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::testInitialize()
+{
+    std::cout << "\n UtGunnsFluidFlowIntegratorGroup 03: testInitialize .................";
+
+    tArticle->initialize(tConfig, tInput);
+
+    /// @test nominal initialization.
+    CPPUNIT_ASSERT(tName == tArticle->mName);
+    CPPUNIT_ASSERT(2     == tArticle->mNumFluidConstituents);
+    CPPUNIT_ASSERT(true  == tArticle->isInitialized());
+
+    /// @test the link ports map to the 3 distinct nodes.
+    CPPUNIT_ASSERT(3 == static_cast<int>(tArticle->mNodeContents.size()));
+    const int expectedPortNodes[6] = {0, 1, 1, 2, 2, 0};
+    for (int i = 0; i < 6; ++i) {
+        CPPUNIT_ASSERT(expectedPortNodes[i] == tArticle->mPortNodes[i]);
+    }
+    CPPUNIT_ASSERT(tNodes[2].getContent() == tArticle->mNodeContents[2]);
+
+    /// @test totals are zeroed.
+    for (int link = 0; link < 3; ++link) {
+        for (int k = 0; k < 2; ++k) {
+            CPPUNIT_ASSERT(0.0 == tArticle->getIntegratedMass(link, k));
+        }
+    }
+
+    /// @test re-initialization.
+    tArticle->initialize(tConfig, tInput);
+    CPPUNIT_ASSERT(true == tArticle->isInitialized());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::testInitializeExceptions()
+{
+    std::cout << "\n UtGunnsFluidFlowIntegratorGroup 04: testInitializeExceptions .......";
+
+    /// @test exception thrown from missing name.
+    tConfig->mName = "";
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->isInitialized());
+    tConfig->mName = tName;
+
+    /// @test exception thrown from null config & input data.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(0, tInput), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, 0), TsInitializationException);
+
+    /// @test exception thrown on bad config & input data pointer types.
+    GunnsFluidFlowIntegratorConfigData badConfig(tName);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(&badConfig, tInput), TsInitializationException);
+    GunnsFluidFlowIntegratorInputData badInput;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, &badInput), TsInitializationException);
+
+    /// @test exception thrown on no links.
+    FriendlyGunnsFluidFlowIntegratorGroup article;
+    CPPUNIT_ASSERT_THROW(article.initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == article.isInitialized());
+
+    /// @test exception thrown on an uninitialized link.
+    GunnsFluidConductor conductor;
+    article.addLink(conductor);
+    CPPUNIT_ASSERT_THROW(article.initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == article.isInitialized());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the step methods, comparing the group's results with individual
+///           flow integrator spotters on the same links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::testStep()
+{
+    std::cout << "\n UtGunnsFluidFlowIntegratorGroup 05: testStep .......................";
+
+    tArticle->initialize(tConfig, tInput);
+    GunnsFluidFlowIntegratorConfigData singleConfig("single");
+    GunnsFluidFlowIntegratorInputData  singleInput;
+    GunnsFluidFlowIntegrator* singles[3];
+    for (int i = 0; i < 3; ++i) {
+        singles[i] = new GunnsFluidFlowIntegrator(tConductors[i]);
+        singles[i]->initialize(&singleConfig, &singleInput);
+    }
+
+    /// - Step with forward, reverse and zero flows in the links, in alternating directions.
+    const double dp[4][3] = {{1.0, -1.0, 0.5}, {-2.0, 1.0, 0.0}, {0.5, 0.5, -0.5}, {1.0, 1.0, 1.0}};
+    for (int step = 0; step < 4; ++step) {
+        tArticle->stepPreSolver(tTimeStep);
+        for (int i = 0; i < 3; ++i) {
+            singles[i]->stepPreSolver(tTimeStep);
+            setFlow(tConductors[i], 100.0 + dp[step][i], 100.0);
+            singles[i]->stepPostSolver(tTimeStep);
+        }
+        tArticle->stepPostSolver(tTimeStep);
+    }
+
+    /// @test group totals match the individual integrators, and use the upstream node mixture.
+    for (int i = 0; i < 3; ++i) {
+        for (int k = 0; k < 2; ++k) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(singles[i]->getIntegratedMass(k),
+                                         tArticle->getIntegratedMass(i, k), tTolerance);
+        }
+        CPPUNIT_ASSERT(0.0 != tArticle->getIntegratedMass(i, 0));
+    }
+    const double mass = tConductors[2].getFlowRate() * tTimeStep;
+    CPPUNIT_ASSERT(mass > 0.0);
+
+    /// @test reset.
+    tArticle->resetIntegration();
+    for (int i = 0; i < 3; ++i) {
+        for (int k = 0; k < 2; ++k) {
+            CPPUNIT_ASSERT(0.0 == tArticle->getIntegratedMass(i, k));
+        }
+    }
+
+    /// @test last link's forward flow uses its port 0 node (node 2) mixture.
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mass * tMassFractions[2][0], tArticle->getIntegratedMass(2, 0), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mass * tMassFractions[2][1], tArticle->getIntegratedMass(2, 1), tTolerance);
+
+    for (int i = 0; i < 3; ++i) {
+        delete singles[i];
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests that links moving to different nodes are re-mapped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::testNodeChange()
+{
+    std::cout << "\n UtGunnsFluidFlowIntegratorGroup 06: testNodeChange .................";
+
+    tArticle->initialize(tConfig, tInput);
+
+    /// - Move link 0's port 1 from node 1 to node 2.
+    CPPUNIT_ASSERT(tConductors[0].setPort(1, 2));
+    tArticle->stepPreSolver(tTimeStep);
+
+    /// @test port 1 of link 0 now maps to node 2's contents.
+    CPPUNIT_ASSERT(tNodes[2].getContent() == tArticle->mNodeContents[tArticle->mPortNodes[1]]);
+    CPPUNIT_ASSERT(3 == static_cast<int>(tArticle->mNodeContents.size()));
+
+    /// @test reverse flow in link 0 uses node 2's mixture.
+    setFlow(tConductors[0], 99.0, 100.0);
+    const double mass = tConductors[0].getFlowRate() * tTimeStep;
+    CPPUNIT_ASSERT(mass < 0.0);
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mass * tMassFractions[2][0], tArticle->getIntegratedMass(0, 0), tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mass * tMassFractions[2][1], tArticle->getIntegratedMass(0, 1), tTolerance);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests that many small increments to a large total aren't lost to
+///           round-off, as they are with a plain sum.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowIntegratorGroup::testCompensatedSum()
+{
+    std::cout << "\n UtGunnsFluidFlowIntegratorGroup 07: testCompensatedSum .............";
+
+    tArticle->initialize(tConfig, tInput);
+    tArticle->stepPreSolver(tTimeStep);
+    setFlow(tConductors[0], 101.0, 100.0);
+
+    /// - Choose the time step so each step adds about 1e-9 kg, which is less than half the spacing
+    ///   of doubles near the 1e8 kg starting total, so a plain sum would never change.
+    const double dt     = 2.0e-9 / tConductors[0].getFlowRate();
+    const double start  = 1.0e8;
+    const int    steps  = 100000;
+    tArticle->mIntegratedMasses[0] = start;
+    double plain = start;
+    for (int step = 0; step < steps; ++step) {
+        tArticle->stepPostSolver(dt);
+        plain += tMassFractions[0][0] * tConductors[0].getFlowRate() * dt;
+    }
+
+    /// @test the plain sum has lost all of the increments, but the compensated sum hasn't.
+    const double expected = steps * tMassFractions[0][0] * tConductors[0].getFlowRate() * dt;
+    CPPUNIT_ASSERT(start == plain);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, tArticle->getIntegratedMass(0, 0) - start, 2.0e-8);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, tArticle->getIntegratedMass(0, 1), 1.0e-15);
+
+    std::cout << "... Pass";
+}
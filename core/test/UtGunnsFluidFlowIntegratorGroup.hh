@@ -0,0 +1,109 @@
+#ifndef UtGunnsFluidFlowIntegratorGroup_EXISTS
+#define UtGunnsFluidFlowIntegratorGroup_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_FLUID_FLOW_INTEGRATOR_GROUP    GUNNS Fluid Flow Integrator Group Spotter Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Fluid Flow Integrator Group Spotter class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/GunnsFluidFlowIntegratorGroup.hh"
+#include "core/GunnsFluidFlowIntegrator.hh"
+#include "core/GunnsFluidNode.hh"
+#include "core/GunnsFluidConductor.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidFlowIntegratorGroup and befriend UtGunnsFluidFlowIntegratorGroup.
+///
+/// @details  Class derived from the unit under test.  It has a default constructor and destructor,
+///           but it befriends the unit test case driver class to allow it access to protected data
+///           members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidFlowIntegratorGroup : public GunnsFluidFlowIntegratorGroup
+{
+    public:
+        FriendlyGunnsFluidFlowIntegratorGroup() : GunnsFluidFlowIntegratorGroup() {;}
+        virtual ~FriendlyGunnsFluidFlowIntegratorGroup() {;}
+        friend class UtGunnsFluidFlowIntegratorGroup;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Flow Integrator Group Spotter Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsFluidFlowIntegratorGroup class within
+///           the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidFlowIntegratorGroup : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsFluidFlowIntegratorGroup unit test.
+        UtGunnsFluidFlowIntegratorGroup();
+        /// @brief    Default destructs this GunnsFluidFlowIntegratorGroup unit test.
+        virtual ~UtGunnsFluidFlowIntegratorGroup();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the config and input data classes.
+        void testConfigAndInput();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests initialization.
+        void testInitialize();
+        /// @brief    Tests initialization exceptions.
+        void testInitializeExceptions();
+        /// @brief    Tests the step methods against individual flow integrators.
+        void testStep();
+        /// @brief    Tests re-mapping of links that move to different nodes.
+        void testNodeChange();
+        /// @brief    Tests compensated summation of small increments into large totals.
+        void testCompensatedSum();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsFluidFlowIntegratorGroup);
+        CPPUNIT_TEST(testConfigAndInput);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testNodeChange);
+        CPPUNIT_TEST(testCompensatedSum);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyGunnsFluidFlowIntegratorGroup*   tArticle;         /**< (--) Test article */
+        GunnsFluidNode                           tNodes[4];        /**< (--) Network nodes */
+        GunnsNodeList                            tNodeList;        /**< (--) Test node list */
+        std::string                              tName;            /**< (--) Instance name */
+        GunnsFluidFlowIntegratorGroupConfigData* tConfig;          /**< (--) Nominal config data */
+        GunnsFluidFlowIntegratorGroupInputData*  tInput;           /**< (--) Nominal input data */
+        DefinedFluidProperties*                  tFluidProperties; /**< (--) Pre-defined fluid properties */
+        PolyFluidConfigData*                     tFluidConfig;     /**< (--) Fluid config data */
+        PolyFluidInputData*                      tFluidInput[3];   /**< (--) Fluid input data for the non-ground nodes */
+        double                                   tMassFractions[3][2]; /**< (--) Fluid mass fractions of the non-ground nodes */
+        std::vector<GunnsBasicLink*>             tLinks;           /**< (--) Test basic link vector */
+        GunnsFluidConductor                      tConductors[3];   /**< (--) Test conductor links */
+        GunnsFluidConductorConfigData*           tConductorConfig; /**< (--) Test conductor config data */
+        GunnsFluidConductorInputData*            tConductorInput;  /**< (--) Test conductor input data */
+        double                                   tTimeStep;        /**< (s)  Time step size for this test */
+        double                                   tTolerance;       /**< (--) Comparison tolerance for floating pt tests */
+
+        /// @brief    Sets the potentials across a conductor and computes its flow.
+        void setFlow(GunnsFluidConductor& conductor, const double p0, const double p1);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidFlowIntegratorGroup(const UtGunnsFluidFlowIntegratorGroup& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidFlowIntegratorGroup& operator =(const UtGunnsFluidFlowIntegratorGroup& that);
+};
+
+///@}
+
+#endif
@@ -0,0 +1,437 @@
+/// Copyright 2026 United States Government as represented by the Administrator of the
+/// National Aeronautics and Space Administration.  All Rights Reserved.
+
+#include "UtGunnsFluidImplicitFlowOrchestrator.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cfloat>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsFluidImplicitFlowOrchestrator class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidImplicitFlowOrchestrator::UtGunnsFluidImplicitFlowOrchestrator()
+    :
+    tNumLinks(NUMLINKS),
+    tNumNodes(NUMNODES),
+    tArticle(tNumLinks, tNumNodes),
+    tLinksArray(0),
+    tNodesArray(0),
+    tSource1(),
+    tSource2(),
+    tSource3(),
+    tCapacitor1(),
+    tCapacitor2(),
+    tNodes(),
+    tName("test article"),
+    tNetNodeList(),
+    tNetLinks(),
+    tFluidProperties(0),
+    tFluidConfig(0),
+    tFluidInput(0),
+    tFractions(0),
+    tSourceConfig(0),
+    tSourceInput(0),
+    tCapacitorConfig(0),
+    tCapacitorInput(0)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsFluidImplicitFlowOrchestrator class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidImplicitFlowOrchestrator::~UtGunnsFluidImplicitFlowOrchestrator()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::tearDown()
+{
+    delete tCapacitorInput;
+    delete tCapacitorConfig;
+    delete tSourceInput;
+    delete tSourceConfig;
+    delete tFluidInput;
+    delete tFluidConfig;
+    delete [] tFractions;
+    delete tFluidProperties;
+    delete [] tNodesArray;
+    delete [] tLinksArray;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::setUp()
+{
+    /// - Build the link and node pointer arrays that the solver would pass to the orchestrator
+    ///   during initialization.
+    tLinksArray = new GunnsBasicLink*[NUMLINKS];
+    tLinksArray[0] = &tSource1;
+    tLinksArray[1] = &tSource2;
+    tLinksArray[2] = &tSource3;
+    tLinksArray[3] = &tCapacitor1;
+    tLinksArray[4] = &tCapacitor2;
+    tNodesArray = new GunnsBasicNode*[NUMNODES];
+    for (int i=0; i<NUMNODES; ++i) {
+        tNodesArray[i] = &tNodes[i];
+    }
+
+    tFluidProperties = new DefinedFluidProperties();
+    FluidProperties::FluidType types[2];
+    types[0]      = FluidProperties::GUNNS_N2;
+    types[1]      = FluidProperties::GUNNS_O2;
+    tFractions    = new double[2];
+    tFractions[0] = 0.5;
+    tFractions[1] = 0.5;
+    tFluidConfig = new PolyFluidConfigData(tFluidProperties, types, 2);
+    tFluidInput  = new PolyFluidInputData(283.15,                   //temperature
+                                          700.728,                  //pressure
+                                          0.0,                      //flowRate
+                                          0.0,                      //mass
+                                          tFractions);              //massFractions
+
+    for (int i=0; i<NUMNODES; ++i) {
+        tNodes[i].initialize("tNodes", tFluidConfig);
+        tNodes[i].getContent()->initialize(*tFluidConfig, *tFluidInput);
+        tNodes[i].resetFlows();
+    }
+    tNetNodeList.mNodes    = tNodes;
+    tNetNodeList.mNumNodes = tNumNodes;
+
+    /// - Create links config & input data.
+    tSourceConfig    = new GunnsFluidSourceConfigData("Source", &tNetNodeList);
+    tSourceInput     = new GunnsFluidSourceInputData(false, 0.0, 0.0);
+    tCapacitorConfig = new GunnsFluidCapacitorConfigData("Capacitor", &tNetNodeList, 0.0);
+    tCapacitorInput  = new GunnsFluidCapacitorInputData(false, 0.0, 1.0, tFluidInput);
+
+    /// - Initialize the source links to create a flow loop nodes 0-1-2-0.
+    tSource1.initialize(*tSourceConfig, *tSourceInput, tNetLinks, 0, 1);
+    tSource2.initialize(*tSourceConfig, *tSourceInput, tNetLinks, 1, 2);
+    tSource3.initialize(*tSourceConfig, *tSourceInput, tNetLinks, 2, 0);
+
+    /// - Initialize the capacitor links to make nodes 0, 1 capacitive, 2 is non-capacitive.
+    tCapacitor1.initialize(*tCapacitorConfig, *tCapacitorInput, tNetLinks, 0, 3);
+    tCapacitor2.initialize(*tCapacitorConfig, *tCapacitorInput, tNetLinks, 1, 3);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the default constructor of the GunnsFluidImplicitFlowOrchestrator
+///           class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsFluidImplicitFlowOrchestrator 01: testDefaultConstruction ...";
+
+    /// - Base class attributes.
+    CPPUNIT_ASSERT(tNumLinks == tArticle.mNumLinks);
+    CPPUNIT_ASSERT(tNumNodes == tArticle.mNumNodes);
+
+    /// - Test article attributes.
+    CPPUNIT_ASSERT(0         == tArticle.mFluidNodes);
+    CPPUNIT_ASSERT(0         == tArticle.mNumFluidTypes);
+    CPPUNIT_ASSERT(0         == tArticle.mSize);
+    CPPUNIT_ASSERT(0         == tArticle.mMatrix);
+    CPPUNIT_ASSERT(0         == tArticle.mSource);
+    CPPUNIT_ASSERT(0         == tArticle.mMoles);
+    CPPUNIT_ASSERT(0         == tArticle.mMoleFractions);
+    CPPUNIT_ASSERT(0         == tArticle.mMolarEnthalpy);
+    CPPUNIT_ASSERT(0         == tArticle.mMWeights);
+    CPPUNIT_ASSERT(0         == tArticle.mBoundaryInflows);
+    CPPUNIT_ASSERT(0         == tArticle.mNumImplicitLinks);
+
+    /// - Dynamic construction/deletion for code coverage.
+    GunnsFluidImplicitFlowOrchestrator* article =
+            new GunnsFluidImplicitFlowOrchestrator(tNumLinks, tNumNodes);
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the initialize method of the GunnsFluidImplicitFlowOrchestrator
+///           class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::testInitialize()
+{
+    std::cout << "\n UtGunnsFluidImplicitFlowOrchestrator 02: testInitialize ............";
+
+    CPPUNIT_ASSERT_NO_THROW(tArticle.initialize(tName, tLinksArray, tNodesArray));
+
+    /// - Test nominal initialization of base class.
+    CPPUNIT_ASSERT(tNumLinks   == tArticle.mNumLinks);
+    CPPUNIT_ASSERT(tNumNodes   == tArticle.mNumNodes);
+    CPPUNIT_ASSERT(tName       == tArticle.mName);
+    CPPUNIT_ASSERT(true        == tArticle.isInitialized());
+
+    /// - Test nominal initialization of test article.
+    const double expectedMW = tNodes[0].getContent()->getProperties(FluidProperties::GUNNS_O2)->getMWeight();
+    CPPUNIT_ASSERT(&tNodes[3]  == tArticle.mFluidNodes[3]);
+    CPPUNIT_ASSERT(2           == tArticle.mNumFluidTypes);
+    CPPUNIT_ASSERT(3           == tArticle.mSize);
+    CPPUNIT_ASSERT(0.0         == tArticle.mMatrix[8]);
+    CPPUNIT_ASSERT(0.0         == tArticle.mMoleFractions[5]);
+    CPPUNIT_ASSERT(expectedMW  == tArticle.mMWeights[1]);
+    CPPUNIT_ASSERT(0.0         == tArticle.mBoundaryInflows[8]);
+    CPPUNIT_ASSERT(0           == tArticle.getNumImplicitLinks());
+
+    /// - Test re-initialization for code coverage of the array cleanup.
+    CPPUNIT_ASSERT_NO_THROW(tArticle.initialize(tName, tLinksArray, tNodesArray));
+    CPPUNIT_ASSERT(true        == tArticle.isInitialized());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests errors during initialize of the GunnsFluidImplicitFlowOrchestrator
+///           class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::testInitializeExceptions()
+{
+    std::cout << "\n UtGunnsFluidImplicitFlowOrchestrator 03: testInitializeExceptions ..";
+
+    /// - Test exception thrown on basic nodes.
+    GunnsBasicNode basicNodes[NUMNODES];
+    GunnsBasicNode* basicNodesArray[NUMNODES];
+    for (int i=0; i<NUMNODES; ++i) {
+        basicNodesArray[i] = &basicNodes[i];
+    }
+    CPPUNIT_ASSERT_THROW(tArticle.initialize(tName, tLinksArray, basicNodesArray),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle.isInitialized());
+
+    /// - Test exception thrown on a link that doesn't have two ports.
+    UtGunnsFluidImplicitFlowOnePortLink onePortLink;
+    tLinksArray[2] = &onePortLink;
+    CPPUNIT_ASSERT_THROW(tArticle.initialize(tName, tLinksArray, tNodesArray),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle.isInitialized());
+    tLinksArray[2] = &tSource3;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the update method of the GunnsFluidImplicitFlowOrchestrator class
+///           when there are no link flows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::testUpdateNoFlow()
+{
+    std::cout << "\n UtGunnsFluidImplicitFlowOrchestrator 04: testUpdateNoFlow ..........";
+
+    tArticle.initialize(tName, tLinksArray, tNodesArray);
+
+    const double mass0 = tNodes[0].getContent()->getMass();
+    const double x0    = tNodes[0].getContent()->getMoleFraction(0);
+    const double dt    = 0.1;
+    tArticle.update(dt);
+
+    /// - Test no links are in the implicit solution, and the node outflows are unchanged.
+    CPPUNIT_ASSERT(0 == tArticle.getNumImplicitLinks());
+    CPPUNIT_ASSERT(true == tNodes[0].isImplicitOutflow());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(x0,    tNodes[0].getOutflow()->getMoleFraction(0), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mass0, tNodes[0].getContent()->getMass(),          DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the update method of the GunnsFluidImplicitFlowOrchestrator class
+///           with an overflow loop case.  All of the nodes are overflowing, which the explicit
+///           orchestrator can't sequence, but here the total mass in the loop is conserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::testUpdateOverflowLoop()
+{
+    std::cout << "\n UtGunnsFluidImplicitFlowOrchestrator 05: testUpdateOverflowLoop ....";
+
+    tArticle.initialize(tName, tLinksArray, tNodesArray);
+
+    const double dt = 0.1;
+
+    /// - Set mass flow rate around the loop that overflows nodes 0 and 1.
+    const double node0Mass = tNodes[0].getContent()->getMass();
+    const double node1Mass = tNodes[1].getContent()->getMass();
+    const double mdot = 2.0 * node0Mass / dt;
+
+    tSource1.setFlowDemand(mdot);
+    tSource2.setFlowDemand(mdot);
+    tSource3.setFlowDemand(mdot);
+
+    tSource1.step(dt);
+    tSource2.step(dt);
+    tSource3.step(dt);
+    tCapacitor1.step(dt);
+    tCapacitor2.step(dt);
+
+    tArticle.update(dt);
+
+    /// - Test the loop links are in the implicit solution, and the nodes were overflowing.
+    CPPUNIT_ASSERT(3    == tArticle.getNumImplicitLinks());
+    CPPUNIT_ASSERT(true == tNodes[0].isOverflowing(dt));
+    CPPUNIT_ASSERT(true == tNodes[1].isOverflowing(dt));
+
+    /// - Test the system matrix diagonal is the node moles plus the moles flowing in.
+    const double molesIn = tSource1.getFlux() * dt;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle.mMoles[1] + molesIn, tArticle.mMatrix[4], DBL_EPSILON);
+
+    /// - Test the total mass in the loop is conserved, with no negative masses.
+    const double tolerance = 1.0E-12 * node0Mass;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(node0Mass + node1Mass,
+                                 tNodes[0].getContent()->getMass() + tNodes[1].getContent()->getMass(),
+                                 tolerance);
+    CPPUNIT_ASSERT(tNodes[0].getContent()->getMass() > 0.0);
+    CPPUNIT_ASSERT(tNodes[1].getContent()->getMass() > 0.0);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the update method of the GunnsFluidImplicitFlowOrchestrator class
+///           with different node mixtures in an overflow loop.  The solved outflows stay positive
+///           and normalized, and bounded by the old node states.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::testUpdateMixtures()
+{
+    std::cout << "\n UtGunnsFluidImplicitFlowOrchestrator 06: testUpdateMixtures ........";
+
+    tArticle.initialize(tName, tLinksArray, tNodesArray);
+
+    /// - Make node 1 pure O2 at the same mass.
+    double fractions[2] = {0.0, 1.0};
+    const double node0Mass = tNodes[0].getContent()->getMass();
+    const double node1Mass = tNodes[1].getContent()->getMass();
+    tNodes[1].getContent()->setMassAndMassFractions(node1Mass, fractions);
+    tNodes[1].resetFlows();
+    const double oldY0     = tNodes[0].getContent()->getMassFraction(0);
+    const double oldX0     = tNodes[0].getContent()->getMoleFraction(0);
+
+    const double dt   = 0.1;
+    const double mdot = 10.0 * node0Mass / dt;
+
+    tSource1.setFlowDemand(mdot);
+    tSource2.setFlowDemand(mdot);
+    tSource3.setFlowDemand(mdot);
+
+    tSource1.step(dt);
+    tSource2.step(dt);
+    tSource3.step(dt);
+    tCapacitor1.step(dt);
+    tCapacitor2.step(dt);
+
+    tArticle.update(dt);
+
+    /// - Test the outflow mole fractions are positive, normalized and between the old node states.
+    for (int node = 0; node < 3; ++node) {
+        const PolyFluid* outflow = tNodes[node].getOutflow();
+        CPPUNIT_ASSERT(outflow->getMoleFraction(0) >= 0.0);
+        CPPUNIT_ASSERT(outflow->getMoleFraction(1) >= 0.0);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, outflow->getMoleFraction(0) + outflow->getMoleFraction(1),
+                                     DBL_EPSILON * 10.0);
+        CPPUNIT_ASSERT(outflow->getMoleFraction(0) <= oldX0 + DBL_EPSILON);
+        CPPUNIT_ASSERT(outflow->getTemperature() > 0.0);
+    }
+
+    /// - Test the node contents mixed without any negative constituent mass.  Node 1 received N2
+    ///   and node 0 lost some.
+    for (int node = 0; node < 2; ++node) {
+        const PolyFluid* content = tNodes[node].getContent();
+        CPPUNIT_ASSERT(content->getMass() > 0.0);
+        CPPUNIT_ASSERT(content->getMassFraction(0) >= 0.0);
+        CPPUNIT_ASSERT(content->getMassFraction(1) >= 0.0);
+        CPPUNIT_ASSERT(content->getMassFraction(0) <= oldY0 + DBL_EPSILON);
+    }
+    CPPUNIT_ASSERT(tNodes[1].getContent()->getMassFraction(0) > 0.0);
+    CPPUNIT_ASSERT(tNodes[0].getContent()->getMassFraction(0) < oldY0);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the update method of the GunnsFluidImplicitFlowOrchestrator class
+///           with an overflowing flow path from the Ground node, through nodes 0 and 1, and back to
+///           the Ground node.  The inflow from the Ground node is pure O2 from the link's internal
+///           fluid, and is included in the implicit solution at that state, so the nodes conserve
+///           mass and each constituent's mass, and stay positive.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidImplicitFlowOrchestrator::testUpdateBoundaryFlows()
+{
+    std::cout << "\n UtGunnsFluidImplicitFlowOrchestrator 07: testUpdateBoundaryFlows ...";
+
+    /// - Re-initialize the source links to flow Ground-0-1-Ground, with pure O2 from Ground.
+    tSource1.initialize(*tSourceConfig, *tSourceInput, tNetLinks, 3, 0);
+    tSource2.initialize(*tSourceConfig, *tSourceInput, tNetLinks, 0, 1);
+    tSource3.initialize(*tSourceConfig, *tSourceInput, tNetLinks, 1, 3);
+    double fractions[2] = {0.0, 1.0};
+    PolyFluidInputData o2Input(283.15, 700.728, 0.0, 0.0, fractions);
+    tSource1.createFlowState(o2Input);
+
+    tArticle.initialize(tName, tLinksArray, tNodesArray);
+
+    const double node0Mass = tNodes[0].getContent()->getMass();
+    const double node1Mass = tNodes[1].getContent()->getMass();
+    const double oldO2Mass = node0Mass * tNodes[0].getContent()->getMassFraction(1)
+                           + node1Mass * tNodes[1].getContent()->getMassFraction(1);
+    const double dt        = 0.1;
+    const double mdot      = 5.0 * node0Mass / dt;
+
+    tSource1.setFlowDemand(mdot);
+    tSource2.setFlowDemand(mdot);
+    tSource3.setFlowDemand(mdot);
+
+    tSource1.step(dt);
+    tSource2.step(dt);
+    tSource3.step(dt);
+    tCapacitor1.step(dt);
+    tCapacitor2.step(dt);
+
+    tArticle.update(dt);
+
+    /// - Test the boundary links are in the implicit solution, and the Ground inflow moles are in
+    ///   the node 0 diagonal and boundary inflows, all as O2.
+    const double molesIn = tSource1.getFlux() * dt;
+    CPPUNIT_ASSERT(3 == tArticle.getNumImplicitLinks());
+    CPPUNIT_ASSERT(true == tNodes[0].isOverflowing(dt));
+    CPPUNIT_ASSERT(0.0 == tArticle.mBoundaryInflows[0]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(molesIn, tArticle.mBoundaryInflows[1], DBL_EPSILON * molesIn);
+    CPPUNIT_ASSERT(0.0 == tArticle.mBoundaryInflows[4]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle.mMoles[0] + molesIn, tArticle.mMatrix[0],
+                                 DBL_EPSILON * molesIn);
+
+    /// - Test the outflow mole fractions are positive and normalized, and the outflows gained O2.
+    for (int node = 0; node < 2; ++node) {
+        const PolyFluid* outflow = tNodes[node].getOutflow();
+        CPPUNIT_ASSERT(outflow->getMoleFraction(0) >= 0.0);
+        CPPUNIT_ASSERT(outflow->getMoleFraction(1) >= 0.0);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, outflow->getMoleFraction(0) + outflow->getMoleFraction(1),
+                                     DBL_EPSILON * 10.0);
+        CPPUNIT_ASSERT(outflow->getMassFraction(1) > tFractions[1]);
+    }
+
+    /// - Test the total mass and the O2 mass of nodes 0 and 1 are conserved: the mass flowing in
+    ///   is pure O2 and the mass flowing out is at node 1's outflow state.
+    const PolyFluid* content0  = tNodes[0].getContent();
+    const PolyFluid* content1  = tNodes[1].getContent();
+    const double     tolerance = 1.0E-12 * node0Mass;
+    const double     massOut   = tSource3.getFlowRate() * dt;
+    const double     massIn    = tSource1.getFlowRate() * dt;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(node0Mass + node1Mass + massIn - massOut,
+                                 content0->getMass() + content1->getMass(), tolerance);
+    const double expectedO2Mass = oldO2Mass + massIn
+                                - massOut * tNodes[1].getOutflow()->getMassFraction(1);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedO2Mass,
+                                 content0->getMass() * content0->getMassFraction(1)
+                               + content1->getMass() * content1->getMassFraction(1), tolerance);
+
+    /// - Test the node contents stay positive and gained O2.
+    for (int node = 0; node < 2; ++node) {
+        const PolyFluid* content = tNodes[node].getContent();
+        CPPUNIT_ASSERT(content->getMass() > 0.0);
+        CPPUNIT_ASSERT(content->getMassFraction(0) >= 0.0);
+        CPPUNIT_ASSERT(content->getMassFraction(1) > tFractions[1]);
+    }
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,140 @@
+#ifndef UtGunnsFluidImplicitFlowOrchestrator_EXISTS
+#define UtGunnsFluidImplicitFlowOrchestrator_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_FLUID_IMPLICIT_FLOW_ORCH    GUNNS Fluid Implicit Flow Orchestrator Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Fluid Implicit Flow Orchestrator class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/GunnsFluidImplicitFlowOrchestrator.hh"
+#include "core/GunnsFluidSource.hh"
+#include "core/GunnsFluidCapacitor.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidImplicitFlowOrchestrator and befriend
+///           UtGunnsFluidImplicitFlowOrchestrator.
+///
+/// @details  Class derived from the unit under test.  It has a constructor with the same arguments
+///           as the parent and a default destructor, but it befriends the unit test case driver
+///           class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidImplicitFlowOrchestrator : public GunnsFluidImplicitFlowOrchestrator
+{
+    public:
+        FriendlyGunnsFluidImplicitFlowOrchestrator(const int& numLinks, const int& numNodes)
+            : GunnsFluidImplicitFlowOrchestrator(numLinks, numNodes) {};
+        virtual ~FriendlyGunnsFluidImplicitFlowOrchestrator() {;}
+        friend class UtGunnsFluidImplicitFlowOrchestrator;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Test one-port fluid link.
+///
+/// @details  Gives the unit test a fluid link that doesn't have two ports.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidImplicitFlowOnePortLink : public GunnsFluidLink
+{
+    public:
+        UtGunnsFluidImplicitFlowOnePortLink() : GunnsFluidLink(1) {};
+        virtual ~UtGunnsFluidImplicitFlowOnePortLink() {;}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidSource and give the unit test access to its internal fluid.
+///
+/// @details  Gives the unit test a fluid source link that can have an internal fluid, for flows
+///           from the Ground node with a known mixture.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidImplicitFlowSource : public GunnsFluidSource
+{
+    public:
+        FriendlyGunnsFluidImplicitFlowSource() : GunnsFluidSource() {};
+        virtual ~FriendlyGunnsFluidImplicitFlowSource() {;}
+        void createFlowState(const PolyFluidInputData& state) {createInternalFluid(state);}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief     GUNNS Fluid Implicit Flow Orchestrator Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsFluidImplicitFlowOrchestrator class
+///           within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidImplicitFlowOrchestrator : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsFluidImplicitFlowOrchestrator unit test.
+        UtGunnsFluidImplicitFlowOrchestrator();
+        /// @brief    Default destructs this GunnsFluidImplicitFlowOrchestrator unit test.
+        virtual ~UtGunnsFluidImplicitFlowOrchestrator();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default constructors.
+        void testDefaultConstruction();
+        /// @brief    Tests initialization.
+        void testInitialize();
+        /// @brief    Tests initialization exceptions.
+        void testInitializeExceptions();
+        /// @brief    Tests update method with no link flows.
+        void testUpdateNoFlow();
+        /// @brief    Tests update method with a overflow loop case.
+        void testUpdateOverflowLoop();
+        /// @brief    Tests update method with different mixtures in an overflow loop.
+        void testUpdateMixtures();
+        /// @brief    Tests update method with inflow from and outflow to the Ground node.
+        void testUpdateBoundaryFlows();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsFluidImplicitFlowOrchestrator);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testUpdateNoFlow);
+        CPPUNIT_TEST(testUpdateOverflowLoop);
+        CPPUNIT_TEST(testUpdateMixtures);
+        CPPUNIT_TEST(testUpdateBoundaryFlows);
+        CPPUNIT_TEST_SUITE_END();
+
+        enum {NUMLINKS = 5, NUMNODES = 4};                           /**< (--) Enumeration of numbers of objects */
+        int                                        tNumLinks;        /**< (--) Number of links */
+        int                                        tNumNodes;        /**< (--) Number of nodes */
+        FriendlyGunnsFluidImplicitFlowOrchestrator tArticle;         /**< (--) Test article */
+        GunnsBasicLink**                           tLinksArray;      /**< (--) Array of link pointers */
+        GunnsBasicNode**                           tNodesArray;      /**< (--) Array of node pointers */
+        FriendlyGunnsFluidImplicitFlowSource       tSource1;         /**< (--) Test referenced network link */
+        GunnsFluidSource                           tSource2;         /**< (--) Test referenced network link */
+        GunnsFluidSource                           tSource3;         /**< (--) Test referenced network link */
+        GunnsFluidCapacitor                        tCapacitor1;      /**< (--) Test referenced network link */
+        GunnsFluidCapacitor                        tCapacitor2;      /**< (--) Test referenced network link */
+        GunnsFluidNode                             tNodes[NUMNODES]; /**< (--) Test referenced network link */
+        std::string                                tName;            /**< (--) Instance name */
+        GunnsNodeList                              tNetNodeList;     /**< (--) Network nodes list */
+        std::vector<GunnsBasicLink*>               tNetLinks;        /**< (--) Network links vector */
+        DefinedFluidProperties*                    tFluidProperties; /**< (--) Fluid properties */
+        PolyFluidConfigData*                       tFluidConfig;     /**< (--) Fluid config data */
+        PolyFluidInputData*                        tFluidInput;      /**< (--) Fluid input data */
+        double*                                    tFractions;       /**< (--) Fluid mass fractions */
+        GunnsFluidSourceConfigData*                tSourceConfig;    /**< (--) Source links config data */
+        GunnsFluidSourceInputData*                 tSourceInput;     /**< (--) Source links input data */
+        GunnsFluidCapacitorConfigData*             tCapacitorConfig; /**< (--) Capacitor links config data */
+        GunnsFluidCapacitorInputData*              tCapacitorInput;  /**< (--) Capacitor links input data */
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidImplicitFlowOrchestrator(const UtGunnsFluidImplicitFlowOrchestrator& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidImplicitFlowOrchestrator& operator =(const UtGunnsFluidImplicitFlowOrchestrator& that);
+};
+
+///@}
+
+#endif
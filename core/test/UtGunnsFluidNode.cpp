@@ -1723,3 +1723,89 @@ void UtGunnsFluidNode::testTraceCompounds()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests integration of flows with an outflow state set by an implicit transport
+///           solution.  This is the same overflowing case as testOutflowOverflow, but the outflow
+///           leaves at the node's implicit new state, so there is no overflow correction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidNode::testImplicitOutflow()
+{
+    std::cout << "\n UtGunnsFluidNode ....... 28: testImplicitOutflow ...................";
+
+    const double initTemperature = 300.0;
+    const double initPressure    = 100.0;
+    const double volume          = 0.01;
+    const double dt              = 0.1;
+
+    /// - Set up our test fluid properties.
+    double initFractions[FluidProperties::NO_FLUID] = {0.2, 0.79, 0.01};
+    PolyFluidInputData fluidInit(initTemperature,           // temperature
+                                 initPressure,              // pressure
+                                 0.0,                       // flowrate
+                                 0.0,                       // mass
+                                 initFractions);            // massFraction
+
+    /// - Load the node with the initial test fluid and set the node physical properties.
+    PolyFluid tFluid(*tFluidConfig, fluidInit);
+    tNode.getContent()->setState(&tFluid);
+    tNode.initVolume(volume);
+    tNode.resetFlows();
+    const double initMass  = tNode.getMass();
+    const double initMoles = tNode.getContent()->getMole();
+
+    /// - Set up an incoming fluid.
+    double fractionsIn[FluidProperties::NO_FLUID] = {0.99, 0.0, 0.01};
+    PolyFluidInputData fluidInitIn(290.0,                  // temperature
+                                     1.0,                  // pressure
+                                     0.0,                  // flowrate
+                                     0.0,                  // mass
+                                   fractionsIn);           // massFraction
+    PolyFluid tFluidIn(*tFluidConfig, fluidInitIn);
+
+    /// - Add inflows and outflows that overflow the node.
+    const double thruFlux   = 0.033; // molar rate (kg*mol/s)
+    const double inFlowRate = thruFlux * tFluidIn.getMWeight();
+    tNode.scheduleOutflux(thruFlux);
+    CPPUNIT_ASSERT(tNode.isOverflowing(dt));
+    tNode.collectInflux(inFlowRate, &tFluidIn);
+
+    /// - Set the outflow to the implicit solution for this node, which is the mixture of the
+    ///   contents and the inflow.
+    const double inMoles = thruFlux * dt;
+    const int nTypes = tFluidConfig->mNTypes;
+    double outFractions[FluidProperties::NO_FLUID];
+    for (int i = 0; i < nTypes; ++i) {
+        outFractions[i] = (initMoles * tFluid.getMoleFraction(i) + inMoles * tFluidIn.getMoleFraction(i))
+                        / (initMoles + inMoles);
+    }
+    const double inMass       = inFlowRate * dt;
+    const double outEnthalpy  = (initMass * tFluid.getSpecificEnthalpy()
+                               + inMass   * tFluidIn.getSpecificEnthalpy()) / (initMass + inMass);
+    CPPUNIT_ASSERT(not tNode.isImplicitOutflow());
+    tNode.setImplicitOutflow(outFractions, outEnthalpy);
+    CPPUNIT_ASSERT(tNode.isImplicitOutflow());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(outFractions[0], tNode.getOutflow()->getMoleFraction(0), DBL_EPSILON);
+
+    /// - Call integrateFlows and verify the outflow leaves at the outflow state, and the contents
+    ///   are left at the outflow state without going negative.
+    const double outFlow      = thruFlux * tNode.getOutflow()->getMWeight();
+    const double expectedMass = initMass + (inFlowRate - outFlow) * dt;
+    tNode.integrateFlows(dt);
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedMass,         tNode.getMass(),    initMass * FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(inFlowRate - outFlow, tNode.mNetFlux,     FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(std::min(inFlowRate, outFlow), tNode.mFluxThrough, DBL_EPSILON);
+    for (int i = 0; i < nTypes; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(outFractions[i], tNode.mContent.getMoleFraction(i), FLT_EPSILON);
+    }
+    CPPUNIT_ASSERT(tNode.mContent.getTemperature() > 290.0);
+    CPPUNIT_ASSERT(tNode.mContent.getTemperature() < 300.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(outFlow, tNode.getOutflow()->getFlowRate(), DBL_EPSILON);
+
+    /// - Test the implicit outflow flag is cleared for the next pass.
+    tNode.resetFlows();
+    CPPUNIT_ASSERT(not tNode.isImplicitOutflow());
+
+    std::cout << "... Pass";
+}
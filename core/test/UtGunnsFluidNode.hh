@@ -77,6 +77,7 @@ class UtGunnsFluidNode : public CppUnit::TestFixture
         CPPUNIT_TEST(testResetContent);
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST(testTraceCompounds);
+        CPPUNIT_TEST(testImplicitOutflow);
 
         CPPUNIT_TEST_SUITE_END();
 
@@ -131,6 +132,7 @@ class UtGunnsFluidNode : public CppUnit::TestFixture
         void testResetContent();
         void testRestart();
         void testTraceCompounds();
+        void testImplicitOutflow();
 };
 
 ///@}
@@ -152,10 +152,12 @@ void UtGunnsFluidVolumeMonitor::testInput()
 
     /// - Test nominal input data construction.
     CPPUNIT_ASSERT(tLinkPort == tInput->mLinkPort);
+    CPPUNIT_ASSERT(1         == tInput->mDecimation);
 
     /// - Test default config data construction.
     GunnsFluidVolumeMonitorInputData defaultInput;
     CPPUNIT_ASSERT(0 == defaultInput.mLinkPort);
+    CPPUNIT_ASSERT(1 == defaultInput.mDecimation);
 
     std::cout << "... Pass";
 }
@@ -178,6 +180,9 @@ void UtGunnsFluidVolumeMonitor::testDefaultConstruction()
     CPPUNIT_ASSERT(0                        == tArticle->mNodeMassFractions);
     CPPUNIT_ASSERT(0                        == tArticle->mNodeMoleFractions);
     CPPUNIT_ASSERT(0.0                      == tArticle->mNodeVolume);
+    CPPUNIT_ASSERT(1                        == tArticle->mDecimation);
+    CPPUNIT_ASSERT(0                        == tArticle->mStepCount);
+    CPPUNIT_ASSERT(false                    == tArticle->mStale);
 
     /// @test init flag
     CPPUNIT_ASSERT(false                    ==  tArticle->mInitFlag);
@@ -211,6 +216,8 @@ void UtGunnsFluidVolumeMonitor::testInitialize()
                                          == tArticle->mNodeMoleFractions[1]);
     CPPUNIT_ASSERT(tNodes[1].getVolume() == tArticle->mNodeVolume);
     CPPUNIT_ASSERT(tArticle->mNodeTcMoleFractions[0] == 0.001);
+    CPPUNIT_ASSERT(1                     == tArticle->mDecimation);
+    CPPUNIT_ASSERT(false                 == tArticle->mStale);
 
     /// @test init flag
     CPPUNIT_ASSERT(true      == tArticle->mInitFlag);
@@ -253,6 +260,11 @@ void UtGunnsFluidVolumeMonitor::testInitializeExceptions()
     CPPUNIT_ASSERT(false == tArticle->mInitFlag);
     delete badInput;
 
+    /// - Test exception thrown on negative decimation.
+    tInput->mDecimation = -1;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
     std::cout << "... Pass";
 }
 
@@ -293,6 +305,30 @@ void UtGunnsFluidVolumeMonitor::testPostSolver()
 
     tArticle->mLinkPort = 0;
     CPPUNIT_ASSERT_NO_THROW(tArticle->stepPostSolver(tTimeStep));
+
+    /// - Test outputs are refreshed every decimation steps, and only marked stale in between.
+    tArticle->mLinkPort   = 1;
+    tArticle->mDecimation = 2;
+    tArticle->mStepCount  = 0;
+    tArticle->mNodeMass   = 0.0;
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT(1    == tArticle->mStepCount);
+    CPPUNIT_ASSERT(true == tArticle->isStale());
+    CPPUNIT_ASSERT(0.0  == tArticle->mNodeMass);
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT(0                   == tArticle->mStepCount);
+    CPPUNIT_ASSERT(false               == tArticle->isStale());
+    CPPUNIT_ASSERT(tNodes[1].getMass() == tArticle->mNodeMass);
+
+    /// - Test zero decimation never refreshes in the step.
+    tArticle->mDecimation = 0;
+    tArticle->mNodeMass   = 0.0;
+    tArticle->stepPostSolver(tTimeStep);
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT(0    == tArticle->mStepCount);
+    CPPUNIT_ASSERT(true == tArticle->isStale());
+    CPPUNIT_ASSERT(0.0  == tArticle->mNodeMass);
+
     std::cout << "... Pass";
 }
 
@@ -330,5 +366,19 @@ void UtGunnsFluidVolumeMonitor::testAccessors()
     CPPUNIT_ASSERT(tArticle->mNodeMoleFractions[0] == tArticle->getMoleFraction(-1));
     CPPUNIT_ASSERT(tArticle->mNodeMoleFractions[1] == tArticle->getMoleFraction(2));
 
+    /// - Test the getters read stale outputs from the node, without changing the outputs.
+    tArticle->mStale = true;
+    const FriendlyGunnsFluidVolumeMonitor* constArticle = tArticle;
+    CPPUNIT_ASSERT(tNodes[1].getMass()   == constArticle->getMass());
+    CPPUNIT_ASSERT(tNodes[1].getVolume() == constArticle->getVolume());
+    CPPUNIT_ASSERT(tNodes[1].getContent()->getMassFraction(FluidProperties::GUNNS_O2)
+                                         == constArticle->getMassFraction(1));
+    CPPUNIT_ASSERT(tNodes[1].getContent()->getMoleFraction(FluidProperties::GUNNS_O2)
+                                         == constArticle->getMoleFraction(1));
+    CPPUNIT_ASSERT(tNodes[1].getContent()->getMoleFraction(FluidProperties::GUNNS_N2)
+                                         == constArticle->getMoleFraction(-1));
+    CPPUNIT_ASSERT(true                  == tArticle->isStale());
+    CPPUNIT_ASSERT(5.0                   == tArticle->mNodeMass);
+
     std::cout << "... Pass";
 }
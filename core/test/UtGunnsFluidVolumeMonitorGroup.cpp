@@ -0,0 +1,334 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+ ((core/GunnsFluidVolumeMonitorGroup.o))
+*/
+
+#include "UtGunnsFluidVolumeMonitorGroup.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsFluidVolumeMonitorGroup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidVolumeMonitorGroup::UtGunnsFluidVolumeMonitorGroup()
+    :
+    tArticle(),
+    tMonitor0(),
+    tMonitor1(),
+    tNodes(),
+    tNodeList(),
+    tName(""),
+    tConfig(),
+    tInput(),
+    tMonitorConfig(),
+    tMonitor0Input(),
+    tMonitor1Input(),
+    tFluidProperties(),
+    tFluidConfig(),
+    tFluidInput0(),
+    tFluidInput1(),
+    tMassFractions0(),
+    tMassFractions1(),
+    tLinks(),
+    tConductorLink(),
+    tConductorLinkConfig(),
+    tConductorLinkInput(),
+    tTimeStep()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsFluidVolumeMonitorGroup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidVolumeMonitorGroup::~UtGunnsFluidVolumeMonitorGroup()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+    delete tMonitor1;
+    delete tMonitor0;
+    delete tMonitor1Input;
+    delete tMonitor0Input;
+    delete tMonitorConfig;
+    delete tInput;
+    delete tConfig;
+    delete tConductorLinkInput;
+    delete tConductorLinkConfig;
+    delete tFluidInput1;
+    delete tFluidInput0;
+    delete tFluidConfig;
+    delete tFluidProperties;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::setUp()
+{
+    /// - Setup some test fluid nodes with different mixtures.
+    tFluidProperties = new DefinedFluidProperties();
+    FluidProperties::FluidType types[2];
+    types[0] = FluidProperties::GUNNS_N2;
+    types[1] = FluidProperties::GUNNS_O2;
+    tMassFractions0[0] = 0.8;
+    tMassFractions0[1] = 0.2;
+    tMassFractions1[0] = 0.3;
+    tMassFractions1[1] = 0.7;
+    tFluidConfig = new PolyFluidConfigData(tFluidProperties, types, 2);
+    tFluidInput0 = new PolyFluidInputData(283.15, 700.728, 0.0, 0.0, tMassFractions0);
+    tFluidInput1 = new PolyFluidInputData(300.0,  101.325, 0.0, 0.0, tMassFractions1);
+
+    /// - Have to initialize the nodes with the fluid configs (normally done by GUNNS)
+    tNodes[0].initialize("tNodes_0", tFluidConfig);
+    tNodes[1].initialize("tNodes_1", tFluidConfig);
+    tNodes[0].getContent()->initialize(*tFluidConfig, *tFluidInput0);
+    tNodes[1].getContent()->initialize(*tFluidConfig, *tFluidInput1);
+    tNodes[0].setPotential(tFluidInput0->mPressure);
+    tNodes[1].setPotential(tFluidInput1->mPressure);
+    tNodes[0].initVolume(1.0);
+    tNodes[1].initVolume(2.0);
+    tNodeList.mNumNodes = 2;
+    tNodeList.mNodes    = tNodes;
+    tTimeStep           = 0.1;
+
+    /// - Initialize a conductor link between the nodes.
+    tConductorLinkConfig = new GunnsFluidConductorConfigData(
+            "Test Fluid Conductor", &tNodeList, 0.5, 0.4);
+    tConductorLinkInput  = new GunnsFluidConductorInputData(true, 0.5);
+    tConductorLink.initialize(*tConductorLinkConfig, *tConductorLinkInput, tLinks, 0, 1);
+
+    /// - Initialize monitors of each node.
+    tMonitorConfig = new GunnsFluidVolumeMonitorConfigData("tMonitor");
+    tMonitor0Input = new GunnsFluidVolumeMonitorInputData(0);
+    tMonitor1Input = new GunnsFluidVolumeMonitorInputData(1);
+    tMonitor0      = new FriendlyGunnsFluidVolumeMonitorForGroup(tNodeList, tConductorLink);
+    tMonitor1      = new FriendlyGunnsFluidVolumeMonitorForGroup(tNodeList, tConductorLink);
+    tMonitor0->initialize(tMonitorConfig, tMonitor0Input);
+    tMonitor1->initialize(tMonitorConfig, tMonitor1Input);
+
+    /// - Test spotter configuration.
+    tName   = "tArticle";
+    tConfig = new GunnsFluidVolumeMonitorGroupConfigData(tName);
+    tInput  = new GunnsFluidVolumeMonitorGroupInputData(2);
+
+    /// - Create the test article.
+    tArticle = new FriendlyGunnsFluidVolumeMonitorGroup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the GunnsFluidVolumeMonitorGroup config and input data classes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::testConfigAndInput()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsFluidVolumeMonitorGroup 01: testConfigAndInput ..............";
+
+    /// - Test nominal config & input data construction.
+    CPPUNIT_ASSERT(tName == tConfig->mName);
+    CPPUNIT_ASSERT(2     == tInput->mDecimation);
+
+    /// - Test default input data construction.
+    GunnsFluidVolumeMonitorGroupInputData defaultInput;
+    CPPUNIT_ASSERT(1 == defaultInput.mDecimation);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the default constructor of the GunnsFluidVolumeMonitorGroup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::testDefaultConstruction()
+{
+    std::cout << "\n UtGunnsFluidVolumeMonitorGroup 02: testDefaultConstruction .........";
+
+    /// @test state data
+    CPPUNIT_ASSERT(""    == tArticle->mName);
+    CPPUNIT_ASSERT(0     == tArticle->getNumMonitors());
+    CPPUNIT_ASSERT(1     == tArticle->mDecimation);
+    CPPUNIT_ASSERT(0     == tArticle->mStepCount);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test adding monitors, and duplicates are ignored.
+    tArticle->addMonitor(*tMonitor0);
+    tArticle->addMonitor(*tMonitor1);
+    tArticle->addMonitor(*tMonitor0);
+    CPPUNIT_ASSERT(2         == tArticle->getNumMonitors());
+    CPPUNIT_ASSERT(tMonitor0 == tArticle->mMonitors[0]);
+    CPPUNIT_ASSERT(tMonitor1 == tArticle->mMonitors[1]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the initialize method of the GunnsFluidVolumeMonitorGroup class,
+///           which also tests the batch update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::testInitialize()
+{
+    std::cout << "\n UtGunnsFluidVolumeMonitorGroup 03: testInitialize ..................";
+
+    tArticle->addMonitor(*tMonitor0);
+    tArticle->addMonitor(*tMonitor1);
+    tMonitor0->mStale = true;
+    tMonitor1->mStale = true;
+    tArticle->initialize(tConfig, tInput);
+
+    /// @test nominal initialization.
+    CPPUNIT_ASSERT(tName == tArticle->mName);
+    CPPUNIT_ASSERT(2     == tArticle->mDecimation);
+    CPPUNIT_ASSERT(0     == tMonitor0->mDecimation);
+    CPPUNIT_ASSERT(0     == tMonitor1->mDecimation);
+    CPPUNIT_ASSERT(true  == tArticle->mInitFlag);
+
+    /// @test the batch update gave each monitor its own node's outputs.
+    FriendlyGunnsFluidVolumeMonitorForGroup* monitors[2] = {tMonitor0, tMonitor1};
+    for (int m = 0; m < 2; ++m) {
+        const PolyFluid* fluid = tNodes[m].getContent();
+        CPPUNIT_ASSERT(false                == monitors[m]->mStale);
+        CPPUNIT_ASSERT(tNodes[m].getMass()   == monitors[m]->mNodeMass);
+        CPPUNIT_ASSERT(tNodes[m].getVolume() == monitors[m]->mNodeVolume);
+        for (int i = 0; i < 2; ++i) {
+            CPPUNIT_ASSERT(fluid->getMoleFraction(i) == monitors[m]->mNodeMoleFractions[i]);
+            CPPUNIT_ASSERT(fluid->getMassFraction(i) == monitors[m]->mNodeMassFractions[i]);
+        }
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the initialize method of the GunnsFluidVolumeMonitorGroup with
+///           errors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::testInitializeExceptions()
+{
+    std::cout << "\n UtGunnsFluidVolumeMonitorGroup 04: testInitializeExceptions ........";
+
+    /// - Test exception thrown from no monitors.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+    tArticle->addMonitor(*tMonitor0);
+    tArticle->addMonitor(*tMonitor1);
+
+    /// - Test exception thrown from bad config & input data.
+    GunnsFluidVolumeMonitorConfigData badConfig(tName);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(&badConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+    GunnsFluidVolumeMonitorInputData badInput;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, &badInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// - Test exception thrown on negative decimation.
+    tInput->mDecimation = -1;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+    tInput->mDecimation = 1;
+
+    /// - Test exception thrown on uninitialized monitor.
+    tMonitor1->mInitFlag = false;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the stepPreSolver and stepPostSolver methods of the
+///           GunnsFluidVolumeMonitorGroup class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::testStep()
+{
+    std::cout << "\n UtGunnsFluidVolumeMonitorGroup 05: testStep ........................";
+
+    tArticle->addMonitor(*tMonitor0);
+    tArticle->addMonitor(*tMonitor1);
+    tArticle->initialize(tConfig, tInput);
+    tArticle->stepPreSolver(tTimeStep);
+
+    /// @test monitors are marked stale and not refreshed by themselves or by the group between
+    ///       decimated steps.
+    tMonitor0->mNodeMass = 0.0;
+    tMonitor0->stepPostSolver(tTimeStep);
+    tMonitor1->stepPostSolver(tTimeStep);
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT(1    == tArticle->mStepCount);
+    CPPUNIT_ASSERT(true == tMonitor0->isStale());
+    CPPUNIT_ASSERT(true == tMonitor1->isStale());
+    CPPUNIT_ASSERT(0.0  == tMonitor0->mNodeMass);
+
+    /// @test a stale monitor's getters still read its node.
+    CPPUNIT_ASSERT(tNodes[0].getMass() == tMonitor0->getMass());
+    CPPUNIT_ASSERT(true                == tMonitor0->isStale());
+
+    /// @test monitors are refreshed together by the group on the decimated step.
+    tMonitor0->stepPostSolver(tTimeStep);
+    tMonitor1->stepPostSolver(tTimeStep);
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT(0                   == tArticle->mStepCount);
+    CPPUNIT_ASSERT(false               == tMonitor0->isStale());
+    CPPUNIT_ASSERT(false               == tMonitor1->isStale());
+    CPPUNIT_ASSERT(tNodes[0].getMass() == tMonitor0->mNodeMass);
+
+    /// @test zero decimation never refreshes in the step.
+    tArticle->mDecimation = 0;
+    tMonitor0->stepPostSolver(tTimeStep);
+    tArticle->stepPostSolver(tTimeStep);
+    tArticle->stepPostSolver(tTimeStep);
+    CPPUNIT_ASSERT(0    == tArticle->mStepCount);
+    CPPUNIT_ASSERT(true == tMonitor0->isStale());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the GunnsFluidVolumeMonitorGroup refresh of several monitors of the
+///           same node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidVolumeMonitorGroup::testSharedNode()
+{
+    std::cout << "\n UtGunnsFluidVolumeMonitorGroup 06: testSharedNode ..................";
+
+    /// - Add a second monitor of node 0.
+    FriendlyGunnsFluidVolumeMonitorForGroup monitor2(tNodeList, tConductorLink);
+    monitor2.initialize(tMonitorConfig, tMonitor0Input);
+    tArticle->addMonitor(*tMonitor0);
+    tArticle->addMonitor(*tMonitor1);
+    tArticle->addMonitor(monitor2);
+    tArticle->initialize(tConfig, tInput);
+
+    /// @test each monitor is mapped to the first monitor of its node.
+    CPPUNIT_ASSERT(0 == tArticle->mSharedIndex[0]);
+    CPPUNIT_ASSERT(1 == tArticle->mSharedIndex[1]);
+    CPPUNIT_ASSERT(0 == tArticle->mSharedIndex[2]);
+
+    /// @test the second monitor of node 0 copies the first monitor's outputs.
+    const PolyFluid* fluid = tNodes[0].getContent();
+    CPPUNIT_ASSERT(false                == monitor2.mStale);
+    CPPUNIT_ASSERT(tNodes[0].getMass()   == monitor2.mNodeMass);
+    CPPUNIT_ASSERT(tNodes[0].getVolume() == monitor2.mNodeVolume);
+    for (int i = 0; i < 2; ++i) {
+        CPPUNIT_ASSERT(fluid->getMoleFraction(i) == monitor2.mNodeMoleFractions[i]);
+        CPPUNIT_ASSERT(fluid->getMassFraction(i) == monitor2.mNodeMassFractions[i]);
+    }
+
+    /// @test a monitor that no longer shares the first monitor's node reads its own node.
+    monitor2.mLinkPort = 1;
+    monitor2.mStale    = true;
+    tArticle->update();
+    CPPUNIT_ASSERT(false                == monitor2.mStale);
+    CPPUNIT_ASSERT(tNodes[1].getMass()   == monitor2.mNodeMass);
+    CPPUNIT_ASSERT(tNodes[1].getVolume() == monitor2.mNodeVolume);
+
+    std::cout << "... Pass";
+}
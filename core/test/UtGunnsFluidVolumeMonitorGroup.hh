@@ -0,0 +1,124 @@
+#ifndef UtGunnsFluidVolumeMonitorGroup_EXISTS
+#define UtGunnsFluidVolumeMonitorGroup_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_FLUID_VOLUME_MONITOR_GROUP    GUNNS Fluid Volume Monitor Group Spotter Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Fluid Volume Monitor Group Spotter class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/GunnsFluidVolumeMonitorGroup.hh"
+#include "core/GunnsFluidVolumeMonitor.hh"
+#include "core/GunnsFluidNode.hh"
+#include "core/GunnsFluidConductor.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidVolumeMonitorGroup and befriend UtGunnsFluidVolumeMonitorGroup.
+///
+/// @details  Class derived from the unit under test.  It has a default constructor and destructor,
+///           but it befriends the unit test case driver class to allow it access to protected data
+///           members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidVolumeMonitorGroup : public GunnsFluidVolumeMonitorGroup
+{
+    public:
+        FriendlyGunnsFluidVolumeMonitorGroup() : GunnsFluidVolumeMonitorGroup() {;}
+        virtual ~FriendlyGunnsFluidVolumeMonitorGroup() {;}
+        friend class UtGunnsFluidVolumeMonitorGroup;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidVolumeMonitor and befriend UtGunnsFluidVolumeMonitorGroup.
+///
+/// @details  Class derived from the monitor class.  It befriends the unit test case driver class to
+///           allow it access to the monitor's protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidVolumeMonitorForGroup : public GunnsFluidVolumeMonitor
+{
+    public:
+        FriendlyGunnsFluidVolumeMonitorForGroup(const GunnsNodeList& nodeList, const GunnsFluidLink& link)
+            : GunnsFluidVolumeMonitor(nodeList, link) {;}
+        virtual ~FriendlyGunnsFluidVolumeMonitorForGroup() {;}
+        friend class UtGunnsFluidVolumeMonitorGroup;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Fluid Volume Monitor Group Spotter Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsFluidVolumeMonitorGroup class within
+///           the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidVolumeMonitorGroup : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsFluidVolumeMonitorGroup unit test.
+        UtGunnsFluidVolumeMonitorGroup();
+        /// @brief    Default destructs this GunnsFluidVolumeMonitorGroup unit test.
+        virtual ~UtGunnsFluidVolumeMonitorGroup();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the config and input data classes.
+        void testConfigAndInput();
+        /// @brief    Tests default constructors.
+        void testDefaultConstruction();
+        /// @brief    Tests initialization.
+        void testInitialize();
+        /// @brief    Tests initialization exceptions.
+        void testInitializeExceptions();
+        /// @brief    Tests the stepPreSolver and stepPostSolver methods.
+        void testStep();
+        /// @brief    Tests the refresh of several monitors of the same node.
+        void testSharedNode();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsFluidVolumeMonitorGroup);
+        CPPUNIT_TEST(testConfigAndInput);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testSharedNode);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyGunnsFluidVolumeMonitorGroup*    tArticle;             /**< (--) Test article */
+        FriendlyGunnsFluidVolumeMonitorForGroup* tMonitor0;            /**< (--) Test monitor of node 0 */
+        FriendlyGunnsFluidVolumeMonitorForGroup* tMonitor1;            /**< (--) Test monitor of node 1 */
+        GunnsFluidNode                           tNodes[3];            /**< (--) Network nodes */
+        GunnsNodeList                            tNodeList;            /**< (--) Test node list */
+        std::string                              tName;                /**< (--) Instance name */
+        GunnsFluidVolumeMonitorGroupConfigData*  tConfig;              /**< (--) Nominal config data */
+        GunnsFluidVolumeMonitorGroupInputData*   tInput;               /**< (--) Nominal input data */
+        GunnsFluidVolumeMonitorConfigData*       tMonitorConfig;       /**< (--) Monitor config data */
+        GunnsFluidVolumeMonitorInputData*        tMonitor0Input;       /**< (--) Monitor 0 input data */
+        GunnsFluidVolumeMonitorInputData*        tMonitor1Input;       /**< (--) Monitor 1 input data */
+        DefinedFluidProperties*                  tFluidProperties;     /**< (--) Pre-defined fluid properties */
+        PolyFluidConfigData*                     tFluidConfig;         /**< (--) Fluid config data */
+        PolyFluidInputData*                      tFluidInput0;         /**< (--) Node 0 fluid input data */
+        PolyFluidInputData*                      tFluidInput1;         /**< (--) Node 1 fluid input data */
+        double                                   tMassFractions0[2];   /**< (--) Node 0 fluid mass fractions. */
+        double                                   tMassFractions1[2];   /**< (--) Node 1 fluid mass fractions. */
+        std::vector<GunnsBasicLink*>             tLinks;               /**< (--) Test basic link vector. */
+        GunnsFluidConductor                      tConductorLink;       /**< (--) Test conductor link */
+        GunnsFluidConductorConfigData*           tConductorLinkConfig; /**< (--) Test conductor link */
+        GunnsFluidConductorInputData*            tConductorLinkInput;  /**< (--) Test conductor link */
+        double                                   tTimeStep;            /**< (--) Time step size for this test */
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidVolumeMonitorGroup(const UtGunnsFluidVolumeMonitorGroup& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidVolumeMonitorGroup& operator =(const UtGunnsFluidVolumeMonitorGroup& that);
+};
+
+///@}
+
+#endif
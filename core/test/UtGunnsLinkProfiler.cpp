@@ -0,0 +1,337 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsLinkProfiler.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsLinkProfiler class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsLinkProfiler::UtGunnsLinkProfiler()
+    :
+    tArticle(0),
+    tName(""),
+    tNetwork(0),
+    tNodes(),
+    tNodeList(),
+    tLinks(),
+    tPotential(),
+    tConductor1(),
+    tConductor2()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsLinkProfiler class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsLinkProfiler::~UtGunnsLinkProfiler()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::tearDown()
+{
+    delete tNetwork;
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::setUp()
+{
+    tName    = "tArticle";
+    tArticle = new FriendlyGunnsLinkProfiler;
+    tNetwork = new Gunns;
+    tLinks.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes the test network: a potential source from ground to node 0, a conductor
+///           from node 0 to node 1, and a conductor from node 1 to ground.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::initNetwork()
+{
+    tNodeList.mNumNodes = NUM_NODES;
+    tNodeList.mNodes    = tNodes;
+    tNetwork->initializeNodes(tNodeList);
+
+    const GunnsBasicPotentialConfigData potentialConfig("tPotential", &tNodeList, 1.0);
+    const GunnsBasicPotentialInputData  potentialInput(false, 0.0, 120.0);
+    tPotential.initialize(potentialConfig, potentialInput, tLinks, 2, 0);
+
+    const GunnsBasicConductorConfigData conductor1Config("tConductor1", &tNodeList, 0.5);
+    const GunnsBasicConductorConfigData conductor2Config("tConductor2", &tNodeList, 0.25);
+    const GunnsBasicConductorInputData  conductorInput(false, 0.0);
+    tConductor1.initialize(conductor1Config, conductorInput, tLinks, 0, 1);
+    tConductor2.initialize(conductor2Config, conductorInput, tLinks, 1, 2);
+
+    const GunnsConfigData networkConfig("tNetwork", 1.0, 1.0, 1, 1);
+    tNetwork->initialize(networkConfig, tLinks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsLinkProfiler 01: testDefaultConstruction ....................";
+
+    /// - Test default construction values.
+    CPPUNIT_ASSERT(""    == tArticle->mName);
+    CPPUNIT_ASSERT(0     == tArticle->mNumLinks);
+    CPPUNIT_ASSERT(0     == tArticle->mLinks);
+    CPPUNIT_ASSERT(false == tArticle->mEnabled);
+    CPPUNIT_ASSERT(1     == tArticle->mSamplePeriod);
+    CPPUNIT_ASSERT(0     == tArticle->mStepCounter);
+    CPPUNIT_ASSERT(false == tArticle->mSampling);
+    CPPUNIT_ASSERT(0     == tArticle->mSampledSteps);
+    CPPUNIT_ASSERT(tArticle->mClassNames.empty());
+    CPPUNIT_ASSERT(tArticle->mLinkClasses.empty());
+    CPPUNIT_ASSERT(tArticle->mTicks.empty());
+    CPPUNIT_ASSERT(tArticle->mCounts.empty());
+    CPPUNIT_ASSERT(0     == tArticle->getNumClasses());
+
+    /// - Test the network solver's default profiler is disabled.
+    CPPUNIT_ASSERT(false == tNetwork->mLinkProfiler.isSampling());
+
+    /// - Test new/delete for code coverage.
+    GunnsLinkProfiler* article = new GunnsLinkProfiler();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::testInitialize()
+{
+    std::cout << "\n UtGunnsLinkProfiler 02: testInitialize .............................";
+
+    /// - Initialize the network, which initializes its own profiler.
+    initNetwork();
+    CPPUNIT_ASSERT(2                        == tNetwork->mLinkProfiler.getNumClasses());
+
+    /// - Initialize the test article with the network links and verify the link classes.
+    tArticle->mSampledSteps = 5;
+    tArticle->initialize(tName, NUM_LINKS, tNetwork->getLinks());
+    CPPUNIT_ASSERT(tName                     == tArticle->mName);
+    CPPUNIT_ASSERT(NUM_LINKS                 == tArticle->mNumLinks);
+    CPPUNIT_ASSERT(tNetwork->getLinks()      == tArticle->mLinks);
+    CPPUNIT_ASSERT(2                         == tArticle->getNumClasses());
+    CPPUNIT_ASSERT("GunnsBasicPotential"     == tArticle->getClassName(0));
+    CPPUNIT_ASSERT("GunnsBasicConductor"     == tArticle->getClassName(1));
+    CPPUNIT_ASSERT(0                         == tArticle->getLinkClass(0));
+    CPPUNIT_ASSERT(1                         == tArticle->getLinkClass(1));
+    CPPUNIT_ASSERT(1                         == tArticle->getLinkClass(2));
+    CPPUNIT_ASSERT(NUM_LINKS * GunnsLinkProfiler::NUM_CALLS == static_cast<int>(tArticle->mTicks.size()));
+    CPPUNIT_ASSERT(NUM_LINKS * GunnsLinkProfiler::NUM_CALLS == static_cast<int>(tArticle->mCounts.size()));
+    CPPUNIT_ASSERT(0                         == tArticle->mSampledSteps);
+    for (int link = 0; link < NUM_LINKS; ++link) {
+        for (int call = 0; call < GunnsLinkProfiler::NUM_CALLS; ++call) {
+            const GunnsLinkProfiler::CallType type = static_cast<GunnsLinkProfiler::CallType>(call);
+            CPPUNIT_ASSERT(0   == tArticle->getLinkCount(link, type));
+            CPPUNIT_ASSERT(0.0 == tArticle->getLinkTime(link, type));
+        }
+    }
+
+    /// - Test re-initialization keeps the enabled state.
+    tArticle->setEnabled(true, 4);
+    tArticle->initialize(tName, NUM_LINKS, tNetwork->getLinks());
+    CPPUNIT_ASSERT(true == tArticle->mEnabled);
+    CPPUNIT_ASSERT(4    == tArticle->mSamplePeriod);
+
+    /// - Test an empty network.
+    tArticle->initialize(tName, 0, 0);
+    CPPUNIT_ASSERT(0 == tArticle->getNumClasses());
+    CPPUNIT_ASSERT(tArticle->mTicks.empty());
+
+    /// - Test the call names.
+    CPPUNIT_ASSERT(std::string("step")           == GunnsLinkProfiler::getCallName(GunnsLinkProfiler::STEP));
+    CPPUNIT_ASSERT(std::string("minorStep")      == GunnsLinkProfiler::getCallName(GunnsLinkProfiler::MINOR_STEP));
+    CPPUNIT_ASSERT(std::string("computeFlows")   == GunnsLinkProfiler::getCallName(GunnsLinkProfiler::COMPUTE_FLOWS));
+    CPPUNIT_ASSERT(std::string("transportFlows") == GunnsLinkProfiler::getCallName(GunnsLinkProfiler::TRANSPORT_FLOWS));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::testInitializeExceptions()
+{
+    std::cout << "\n UtGunnsLinkProfiler 03: testInitializeExceptions ...................";
+
+    /// - Test exception thrown on missing links array.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, NUM_LINKS, 0), TsInitializationException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests enabling and sampling major steps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::testSampling()
+{
+    std::cout << "\n UtGunnsLinkProfiler 04: testSampling ...............................";
+
+    initNetwork();
+    tArticle->initialize(tName, NUM_LINKS, tNetwork->getLinks());
+
+    /// - Test nothing is sampled or recorded while disabled.
+    tArticle->beginMajorStep();
+    CPPUNIT_ASSERT(false == tArticle->isSampling());
+    CPPUNIT_ASSERT(0     == tArticle->start());
+    tArticle->stop(0, GunnsLinkProfiler::STEP, 0);
+    CPPUNIT_ASSERT(0     == tArticle->getLinkCount(0, GunnsLinkProfiler::STEP));
+    CPPUNIT_ASSERT(0     == tArticle->getSampledSteps());
+
+    /// - Test sampling every 3rd major step, starting with the first.
+    tArticle->setEnabled(true, 3);
+    const bool expected[7] = {true, false, false, true, false, false, true};
+    for (int step = 0; step < 7; ++step) {
+        tArticle->beginMajorStep();
+        CPPUNIT_ASSERT(expected[step] == tArticle->isSampling());
+    }
+    CPPUNIT_ASSERT(3 == tArticle->getSampledSteps());
+
+    /// - Test a call is recorded while sampling.
+    const uint64_t start = tArticle->start();
+    CPPUNIT_ASSERT(0 < start);
+    tArticle->stop(1, GunnsLinkProfiler::MINOR_STEP, start);
+    CPPUNIT_ASSERT(1   == tArticle->getLinkCount(1, GunnsLinkProfiler::MINOR_STEP));
+    CPPUNIT_ASSERT(0   == tArticle->getLinkCount(1, GunnsLinkProfiler::STEP));
+    CPPUNIT_ASSERT(0.0 <= tArticle->getLinkTime(1, GunnsLinkProfiler::MINOR_STEP));
+
+    /// - Test reset clears the profile but keeps sampling settings.
+    tArticle->reset();
+    CPPUNIT_ASSERT(0    == tArticle->getLinkCount(1, GunnsLinkProfiler::MINOR_STEP));
+    CPPUNIT_ASSERT(0    == tArticle->getSampledSteps());
+    CPPUNIT_ASSERT(true == tArticle->mEnabled);
+    CPPUNIT_ASSERT(3    == tArticle->mSamplePeriod);
+
+    /// - Test an invalid sample period is rejected and disables profiling.
+    tArticle->setEnabled(true, 0);
+    CPPUNIT_ASSERT(false == tArticle->mEnabled);
+    tArticle->beginMajorStep();
+    CPPUNIT_ASSERT(false == tArticle->isSampling());
+
+    /// - Test disabling stops sampling right away.
+    tArticle->setEnabled(true);
+    tArticle->beginMajorStep();
+    CPPUNIT_ASSERT(true  == tArticle->isSampling());
+    tArticle->setEnabled(false);
+    CPPUNIT_ASSERT(false == tArticle->isSampling());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests profiling the links of a network by its solver and orchestrator.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::testNetwork()
+{
+    std::cout << "\n UtGunnsLinkProfiler 05: testNetwork ................................";
+
+    initNetwork();
+    GunnsLinkProfiler& profiler = tNetwork->mLinkProfiler;
+
+    /// - Test nothing is recorded while disabled.
+    tNetwork->step(0.1);
+    CPPUNIT_ASSERT(0 == profiler.getSampledSteps());
+    CPPUNIT_ASSERT(0 == profiler.getLinkCount(0, GunnsLinkProfiler::STEP));
+
+    /// - Step the network, sampling every other major step.
+    profiler.setEnabled(true, 2);
+    for (int step = 0; step < 4; ++step) {
+        tNetwork->step(0.1);
+    }
+    CPPUNIT_ASSERT(2 == profiler.getSampledSteps());
+
+    /// - Test the link calls are counted.  This linear network has no minor steps, and basic links
+    ///   transport their flows within computeFlows.
+    for (int link = 0; link < NUM_LINKS; ++link) {
+        CPPUNIT_ASSERT(2 == profiler.getLinkCount(link, GunnsLinkProfiler::STEP));
+        CPPUNIT_ASSERT(0 == profiler.getLinkCount(link, GunnsLinkProfiler::MINOR_STEP));
+        CPPUNIT_ASSERT(2 == profiler.getLinkCount(link, GunnsLinkProfiler::COMPUTE_FLOWS));
+        CPPUNIT_ASSERT(0 == profiler.getLinkCount(link, GunnsLinkProfiler::TRANSPORT_FLOWS));
+    }
+
+    /// - Test the class times sum the link times.
+    const double potentialTime = profiler.getLinkTime(0, GunnsLinkProfiler::STEP)
+                               + profiler.getLinkTime(0, GunnsLinkProfiler::COMPUTE_FLOWS);
+    const double conductorStep = profiler.getLinkTime(1, GunnsLinkProfiler::STEP)
+                               + profiler.getLinkTime(2, GunnsLinkProfiler::STEP);
+    const double conductorTime = conductorStep
+                               + profiler.getLinkTime(1, GunnsLinkProfiler::COMPUTE_FLOWS)
+                               + profiler.getLinkTime(2, GunnsLinkProfiler::COMPUTE_FLOWS);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(potentialTime, profiler.getClassTotalTime(0),            1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(conductorStep, profiler.getClassTime(1, GunnsLinkProfiler::STEP), 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(conductorTime, profiler.getClassTotalTime(1),            1.0e-12);
+    CPPUNIT_ASSERT(0.0 < potentialTime + conductorTime);
+
+    /// - Test the network solution is unaffected by profiling.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0 * 4.0 / 7.0, tNodes[1].getPotential(), 1.0e-12);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the report and table outputs.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLinkProfiler::testReport()
+{
+    std::cout << "\n UtGunnsLinkProfiler 06: testReport .................................";
+
+    initNetwork();
+    GunnsLinkProfiler& profiler = tNetwork->mLinkProfiler;
+    profiler.setEnabled(true);
+    for (int step = 0; step < 3; ++step) {
+        tNetwork->step(0.1);
+    }
+
+    /// - Test the report names the network, classes and links.
+    std::ostringstream report;
+    profiler.report(report);
+    const std::string reportText = report.str();
+    CPPUNIT_ASSERT(std::string::npos != reportText.find("tNetwork.mLinkProfiler link profile over 3 sampled major steps"));
+    CPPUNIT_ASSERT(std::string::npos != reportText.find("GunnsBasicPotential"));
+    CPPUNIT_ASSERT(std::string::npos != reportText.find("GunnsBasicConductor"));
+    CPPUNIT_ASSERT(std::string::npos != reportText.find("tPotential"));
+    CPPUNIT_ASSERT(std::string::npos != reportText.find("tConductor2"));
+
+    /// - Test the report limits the number of links listed.
+    std::ostringstream shortReport;
+    profiler.report(shortReport, 1);
+    const std::string shortText = shortReport.str();
+    const bool listed1 = std::string::npos != shortText.find("tConductor1");
+    const bool listed2 = std::string::npos != shortText.find("tConductor2");
+    const bool listed0 = std::string::npos != shortText.find("tPotential");
+    CPPUNIT_ASSERT(1 == int(listed0) + int(listed1) + int(listed2));
+
+    /// - Test the table has a header and a row for each link's recorded calls.
+    std::ostringstream table;
+    profiler.writeTable(table);
+    std::istringstream lines(table.str());
+    std::string line;
+    std::getline(lines, line);
+    CPPUNIT_ASSERT("index,link,class,call,count,seconds" == line);
+    int rows = 0;
+    while (std::getline(lines, line)) {
+        if (not line.empty()) {
+            ++rows;
+        }
+    }
+    CPPUNIT_ASSERT(NUM_LINKS * 2 == rows);
+
+    std::cout << "... Pass";
+}
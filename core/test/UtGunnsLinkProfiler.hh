@@ -0,0 +1,103 @@
+#ifndef UtGunnsLinkProfiler_EXISTS
+#define UtGunnsLinkProfiler_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_LINK_PROFILER GUNNS Link Profiler Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Link Profiler class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/Gunns.hh"
+#include "core/GunnsLinkProfiler.hh"
+#include "core/GunnsBasicNode.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsLinkProfiler and befriend UtGunnsLinkProfiler.
+///
+/// @details  Class derived from the unit under test.  It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsLinkProfiler : public GunnsLinkProfiler
+{
+    public:
+        FriendlyGunnsLinkProfiler() : GunnsLinkProfiler() {}
+        virtual ~FriendlyGunnsLinkProfiler() {}
+        friend class UtGunnsLinkProfiler;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Link Profiler unit tests.
+///
+/// @details  This class provides the unit tests for the GUNNS Link Profiler class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsLinkProfiler: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GUNNS Link Profiler unit test.
+        UtGunnsLinkProfiler();
+        /// @brief    Default destructs this GUNNS Link Profiler unit test.
+        virtual ~UtGunnsLinkProfiler();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests initialization.
+        void testInitialize();
+        /// @brief    Tests initialization exceptions.
+        void testInitializeExceptions();
+        /// @brief    Tests enabling and sampling major steps.
+        void testSampling();
+        /// @brief    Tests profiling the links of a network.
+        void testNetwork();
+        /// @brief    Tests the report and table outputs.
+        void testReport();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsLinkProfiler);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testSampling);
+        CPPUNIT_TEST(testNetwork);
+        CPPUNIT_TEST(testReport);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Enumeration of the number of test network nodes and links.
+        enum {NUM_NODES = 3, NUM_LINKS = 3};
+
+        FriendlyGunnsLinkProfiler*     tArticle;         /**< (--) Test article */
+        std::string                    tName;            /**< (--) Instance name */
+        Gunns*                         tNetwork;         /**< (--) Test network */
+        GunnsBasicNode                 tNodes[NUM_NODES];/**< (--) Test network nodes */
+        GunnsNodeList                  tNodeList;        /**< (--) Test network node list */
+        std::vector<GunnsBasicLink*>   tLinks;           /**< (--) Test network links vector */
+        GunnsBasicPotential            tPotential;       /**< (--) Test potential link */
+        GunnsBasicConductor            tConductor1;      /**< (--) Test conductor link */
+        GunnsBasicConductor            tConductor2;      /**< (--) Test conductor link */
+
+        /// @brief    Initializes the test network.
+        void initNetwork();
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsLinkProfiler(const UtGunnsLinkProfiler& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsLinkProfiler& operator =(const UtGunnsLinkProfiler& that);
+};
+
+///@}
+
+#endif
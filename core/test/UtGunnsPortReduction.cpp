@@ -0,0 +1,249 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsPortReduction.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cfloat>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsPortReduction class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsPortReduction::UtGunnsPortReduction()
+    :
+    tArticle(),
+    tName(),
+    tNumPorts(),
+    tNodeMap()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsPortReduction class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsPortReduction::~UtGunnsPortReduction()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::setUp()
+{
+    tName       = "tArticle";
+    tNumPorts   = 2;
+    tNodeMap[0] = 2;
+    tNodeMap[1] = 0;
+    tArticle    = new FriendlyGunnsPortReduction();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsPortReduction 01: testDefaultConstruction ......................";
+
+    /// @test default values.
+    CPPUNIT_ASSERT(""    == tArticle->mName);
+    CPPUNIT_ASSERT(0     == tArticle->mNumPorts);
+    CPPUNIT_ASSERT(0     == tArticle->mNodeMap);
+    CPPUNIT_ASSERT(0     == tArticle->mImpedance);
+    CPPUNIT_ASSERT(0     == tArticle->mAdmittance);
+    CPPUNIT_ASSERT(0     == tArticle->mSource);
+    CPPUNIT_ASSERT(0     == tArticle->mExcludedAdmittance);
+    CPPUNIT_ASSERT(0     == tArticle->mExcludedSource);
+    CPPUNIT_ASSERT(0     == tArticle->mWorkMatrix);
+    CPPUNIT_ASSERT(false == tArticle->mValid);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test new/delete for code coverage.
+    GunnsPortReduction* article = new GunnsPortReduction();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests nominal initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::testNominalInitialization()
+{
+    std::cout << "\n UtGunnsPortReduction 02: testNominalInitialization ....................";
+
+    /// @test nominal initialization.
+    tArticle->initialize(tName, tNumPorts, tNodeMap);
+    CPPUNIT_ASSERT(tName     == tArticle->mName);
+    CPPUNIT_ASSERT(tNumPorts == tArticle->getNumPorts());
+    CPPUNIT_ASSERT(tNodeMap  == tArticle->mNodeMap);
+    CPPUNIT_ASSERT(2         == tArticle->getNode(0));
+    CPPUNIT_ASSERT(0         == tArticle->getNode(1));
+    for (int i = 0; i < tNumPorts; ++i) {
+        CPPUNIT_ASSERT(0.0 == tArticle->getSource()[i]);
+        CPPUNIT_ASSERT(0.0 == tArticle->mExcludedSource[i]);
+        for (int j = 0; j < tNumPorts; ++j) {
+            CPPUNIT_ASSERT(0.0 == tArticle->getImpedance()[i*tNumPorts + j]);
+            CPPUNIT_ASSERT(0.0 == tArticle->getAdmittance()[i*tNumPorts + j]);
+            CPPUNIT_ASSERT(0.0 == tArticle->mExcludedAdmittance[i*tNumPorts + j]);
+        }
+    }
+    CPPUNIT_ASSERT(false == tArticle->isValid());
+    CPPUNIT_ASSERT(true  == tArticle->mInitFlag);
+
+    /// @test the node map follows changes in the owner's map.
+    tNodeMap[1] = 1;
+    CPPUNIT_ASSERT(1 == tArticle->getNode(1));
+
+    /// @test re-initialization with a different size.
+    tArticle->initialize(tName, 1, tNodeMap);
+    CPPUNIT_ASSERT(1    == tArticle->getNumPorts());
+    CPPUNIT_ASSERT(0.0  == tArticle->getAdmittance()[0]);
+    CPPUNIT_ASSERT(true == tArticle->mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsPortReduction 03: testInitializationExceptions .................";
+
+    /// @test exception on empty name.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize("", tNumPorts, tNodeMap), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test exception on # ports < 1.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, 0, tNodeMap), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    /// @test exception on null node map.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName, tNumPorts, 0), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the loadImpedanceColumn and setExcludedContributions methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::testImpedanceColumns()
+{
+    std::cout << "\n UtGunnsPortReduction 04: testImpedanceColumns .........................";
+
+    tArticle->initialize(tName, tNumPorts, tNodeMap);
+
+    /// @test impedance columns are the port node rows of the unit flux solutions.
+    const double column0[3]   = {1.0, 2.0, 2.0};
+    const double column1[3]   = {3.0, 4.0, 1.0};
+    tArticle->loadImpedanceColumn(0, column0);
+    tArticle->loadImpedanceColumn(1, column1);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tArticle->getImpedance()[0], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tArticle->getImpedance()[1], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tArticle->getImpedance()[2], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, tArticle->getImpedance()[3], DBL_EPSILON);
+
+    /// @test excluded contributions are stored, and null arguments zero them.
+    const double admittance[4] = {0.1, 0.0, 0.0, 0.2};
+    const double source[2]     = {1.0, 2.0};
+    tArticle->setExcludedContributions(admittance, source);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(admittance[i] == tArticle->mExcludedAdmittance[i]);
+    }
+    CPPUNIT_ASSERT(source[0] == tArticle->mExcludedSource[0]);
+    CPPUNIT_ASSERT(source[1] == tArticle->mExcludedSource[1]);
+    tArticle->setExcludedContributions(0, 0);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(0.0 == tArticle->mExcludedAdmittance[i]);
+    }
+    CPPUNIT_ASSERT(0.0 == tArticle->mExcludedSource[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle->mExcludedSource[1]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the computeNorton method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::testComputeNorton()
+{
+    std::cout << "\n UtGunnsPortReduction 05: testComputeNorton ............................";
+
+    tArticle->initialize(tName, tNumPorts, tNodeMap);
+
+    /// - Load an impedance matrix [2 1; 1 3] with round-off in the off-diagonals.
+    const double potential[3] = {10.0, 5.0, 20.0};
+    const double column0[3]   = {0.8, 0.0, 2.0};
+    const double column1[3]   = {3.0, 0.0, 1.2};
+    tArticle->loadImpedanceColumn(0, column0);
+    tArticle->loadImpedanceColumn(1, column1);
+
+    const double admittance[4] = {0.1, 0.0, 0.0, 0.2};
+    const double source[2]     = {1.0, 2.0};
+    tArticle->setExcludedContributions(admittance, source);
+
+    /// @test the impedance matrix is symmetrized, and the Norton admittance is the impedance
+    ///       inverse [0.6 -0.2; -0.2 0.4] less the excluded admittance.
+    tArticle->computeNorton(potential);
+    CPPUNIT_ASSERT(true == tArticle->isValid());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0, tArticle->getImpedance()[1], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0, tArticle->getImpedance()[2], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 0.5, tArticle->getAdmittance()[0], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-0.2, tArticle->getAdmittance()[1], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-0.2, tArticle->getAdmittance()[2], DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 0.2, tArticle->getAdmittance()[3], DBL_EPSILON);
+
+    /// @test the Norton source is the impedance inverse times the port potentials {20, 10}, less
+    ///       the excluded source.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 9.0, tArticle->getSource()[0], 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-2.0, tArticle->getSource()[1], 1.0e-12);
+
+    /// @test invalidate.
+    tArticle->invalidate();
+    CPPUNIT_ASSERT(false == tArticle->isValid());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the computeNorton method with a singular impedance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPortReduction::testSingularImpedance()
+{
+    std::cout << "\n UtGunnsPortReduction 06: testSingularImpedance ........................";
+
+    tArticle->initialize(tName, tNumPorts, tNodeMap);
+
+    /// - Load a valid equivalent to be replaced.
+    const double potential[3] = {10.0, 5.0, 20.0};
+    const double column0[3]   = {1.0, 0.0, 2.0};
+    const double column1[3]   = {3.0, 0.0, 1.0};
+    tArticle->loadImpedanceColumn(0, column0);
+    tArticle->loadImpedanceColumn(1, column1);
+    tArticle->computeNorton(potential);
+    CPPUNIT_ASSERT(true == tArticle->isValid());
+
+    /// @test a singular impedance matrix, as when both ports see the same node, gives an invalid
+    ///       equivalent.
+    const double singular[3] = {1.0, 0.0, 1.0};
+    tArticle->loadImpedanceColumn(0, singular);
+    tArticle->loadImpedanceColumn(1, singular);
+    tArticle->computeNorton(potential);
+    CPPUNIT_ASSERT(false == tArticle->isValid());
+
+    std::cout << "... Pass";
+}
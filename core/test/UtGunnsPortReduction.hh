@@ -0,0 +1,81 @@
+#ifndef UtGunnsPortReduction_EXISTS
+#define UtGunnsPortReduction_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_PORT_REDUCTION    Gunns Network Port Reduction Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Network Port Reduction
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/GunnsPortReduction.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsPortReduction and befriend UtGunnsPortReduction.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsPortReduction : public GunnsPortReduction
+{
+    public:
+        FriendlyGunnsPortReduction();
+        virtual ~FriendlyGunnsPortReduction();
+        friend class UtGunnsPortReduction;
+};
+inline FriendlyGunnsPortReduction::FriendlyGunnsPortReduction() : GunnsPortReduction() {};
+inline FriendlyGunnsPortReduction::~FriendlyGunnsPortReduction() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Network Port Reduction unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsPortReduction class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsPortReduction: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsPortReduction(const UtGunnsPortReduction& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsPortReduction& operator =(const UtGunnsPortReduction& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsPortReduction);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testNominalInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testImpedanceColumns);
+        CPPUNIT_TEST(testComputeNorton);
+        CPPUNIT_TEST(testSingularImpedance);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyGunnsPortReduction* tArticle;    /**< (--) Article under test */
+        std::string                 tName;       /**< (--) Nominal initialization data */
+        int                         tNumPorts;   /**< (--) Nominal initialization data */
+        int                         tNodeMap[2]; /**< (--) Nominal initialization data */
+
+    public:
+        UtGunnsPortReduction();
+        virtual ~UtGunnsPortReduction();
+        void tearDown();
+        void setUp();
+        void testDefaultConstruction();
+        void testNominalInitialization();
+        void testInitializationExceptions();
+        void testImpedanceColumns();
+        void testComputeNorton();
+        void testSingularImpedance();
+};
+
+///@}
+
+#endif
@@ -0,0 +1,209 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsPowerLawUtils.hh"
+#include <cmath>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsPowerLawUtils class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsPowerLawUtils::UtGunnsPowerLawUtils()
+    :
+    tConductance(0.0),
+    tMinP(0.0)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsPowerLawUtils class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsPowerLawUtils::~UtGunnsPowerLawUtils()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPowerLawUtils::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPowerLawUtils::setUp()
+{
+    tConductance = 0.05;
+    tMinP        = 0.001;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] potential (--) Converged potential of the middle node.
+/// @param[in]  exponent  (--) Power law exponent.
+/// @param[in]  type      (--) Linearization type.
+///
+/// @returns  int (--) Number of minor steps to converge, or 0 if not converged.
+///
+/// @details  Solves a circuit of a 100 potential source, a linear conductance of 0.2 to the middle
+///           node, and the power law from the middle node to ground, relinearizing the power law
+///           each minor step until the middle node potential converges.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int UtGunnsPowerLawUtils::solveCircuit(double& potential, const double exponent,
+                                       const GunnsPowerLawUtils::Linearization type)
+{
+    const double sourceP = 100.0;
+    const double g1      = 0.2;
+    potential = sourceP;
+    for (int minor = 1; minor <= 1000; ++minor) {
+        double admittance = 0.0;
+        double source     = 0.0;
+        GunnsPowerLawUtils::linearize(admittance, source, potential, tConductance, exponent,
+                                      tMinP, type);
+        const double newP  = (g1 * sourceP - source) / (g1 + admittance);
+        const double delta = std::fabs(newP - potential);
+        potential = newP;
+        if (delta < 1.0e-10) {
+            return minor;
+        }
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the computeFlux method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPowerLawUtils::testComputeFlux()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsPowerLawUtils 01: testComputeFlux ...........................";
+
+    /// - Test flux in both directions.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 2.0, GunnsPowerLawUtils::computeFlux( 80.0, tConductance, 2.0), 1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-2.0, GunnsPowerLawUtils::computeFlux(-80.0, tConductance, 2.0), 1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(16.0, GunnsPowerLawUtils::computeFlux( 80.0, tConductance, 0.5), 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 4.0, GunnsPowerLawUtils::computeFlux( 80.0, tConductance, 1.0), 1.0e-15);
+
+    /// - Test zero flux for zero potential drop or conductance.
+    CPPUNIT_ASSERT_EQUAL(0.0, GunnsPowerLawUtils::computeFlux( 0.0, tConductance, 2.0));
+    CPPUNIT_ASSERT_EQUAL(0.0, GunnsPowerLawUtils::computeFlux(80.0, 0.0,          2.0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the secant linearization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPowerLawUtils::testSecant()
+{
+    std::cout << "\n UtGunnsPowerLawUtils 02: testSecant ................................";
+
+    /// - Test the secant passes thru the origin and the curve, in both directions.
+    double admittance = 0.0;
+    double source     = 1.0;
+    GunnsPowerLawUtils::linearize(admittance, source, 80.0, tConductance, 2.0, tMinP,
+                                  GunnsPowerLawUtils::SECANT);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0 / 80.0, admittance, 1.0e-15);
+    CPPUNIT_ASSERT_EQUAL(0.0, source);
+    GunnsPowerLawUtils::linearize(admittance, source, -80.0, tConductance, 2.0, tMinP,
+                                  GunnsPowerLawUtils::SECANT);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0 / 80.0, admittance, 1.0e-15);
+    CPPUNIT_ASSERT_EQUAL(0.0, source);
+
+    /// - Test the secant is limited to the minimum potential drop.
+    GunnsPowerLawUtils::linearize(admittance, source, 0.0, tConductance, 2.0, tMinP,
+                                  GunnsPowerLawUtils::SECANT);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(std::sqrt(tMinP * tConductance) / tMinP, admittance, 1.0e-12);
+    CPPUNIT_ASSERT_EQUAL(0.0, source);
+
+    /// - Test zero admittance with no potential drop limit.
+    GunnsPowerLawUtils::linearize(admittance, source, 0.0, tConductance, 2.0, 0.0,
+                                  GunnsPowerLawUtils::SECANT);
+    CPPUNIT_ASSERT_EQUAL(0.0, admittance);
+    CPPUNIT_ASSERT_EQUAL(0.0, source);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the Newton linearization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPowerLawUtils::testNewton()
+{
+    std::cout << "\n UtGunnsPowerLawUtils 03: testNewton ................................";
+
+    /// - Test the tangent slope and source, which reproduce the flux at the linearization point.
+    double admittance = 0.0;
+    double source     = 0.0;
+    GunnsPowerLawUtils::linearize(admittance, source, 80.0, tConductance, 2.0, tMinP,
+                                  GunnsPowerLawUtils::NEWTON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0 / 160.0, admittance, 1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,         source,     1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, admittance * 80.0 + source, 1.0e-15);
+
+    /// - Test the source reverses with the potential drop.
+    GunnsPowerLawUtils::linearize(admittance, source, -80.0, tConductance, 2.0, tMinP,
+                                  GunnsPowerLawUtils::NEWTON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 2.0 / 160.0, admittance, 1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0,         source,     1.0e-15);
+
+    /// - Test an exponent below one gives a source opposing the potential drop.
+    GunnsPowerLawUtils::linearize(admittance, source, 80.0, tConductance, 0.5, tMinP,
+                                  GunnsPowerLawUtils::NEWTON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(  2.0 * 16.0 / 80.0, admittance, 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-16.0,               source,     1.0e-12);
+
+    /// - Test the linear case has no source.
+    GunnsPowerLawUtils::linearize(admittance, source, 80.0, tConductance, 1.0, tMinP,
+                                  GunnsPowerLawUtils::NEWTON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tConductance, admittance, 1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,          source,     1.0e-15);
+
+    /// - Test the secant is used below the minimum potential drop.
+    GunnsPowerLawUtils::linearize(admittance, source, 0.5 * tMinP, tConductance, 2.0, tMinP,
+                                  GunnsPowerLawUtils::NEWTON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(std::sqrt(tMinP * tConductance) / tMinP, admittance, 1.0e-12);
+    CPPUNIT_ASSERT_EQUAL(0.0, source);
+
+    /// - Test the secant is used when the tangent slope isn't positive.
+    GunnsPowerLawUtils::linearize(admittance, source, 80.0, tConductance, -2.0, tMinP,
+                                  GunnsPowerLawUtils::NEWTON);
+    CPPUNIT_ASSERT(0.0 < admittance);
+    CPPUNIT_ASSERT_EQUAL(0.0, source);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the convergence of a non-linear circuit with both linearizations.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsPowerLawUtils::testConvergence()
+{
+    std::cout << "\n UtGunnsPowerLawUtils 04: testConvergence ...........................";
+
+    const double exponents[3] = {2.0, 3.0, 0.5};
+    for (int i = 0; i < 3; ++i) {
+        double secantP = 0.0;
+        double newtonP = 0.0;
+        const int secantSteps = solveCircuit(secantP, exponents[i], GunnsPowerLawUtils::SECANT);
+        const int newtonSteps = solveCircuit(newtonP, exponents[i], GunnsPowerLawUtils::NEWTON);
+
+        /// - Test both converge to the same solution, where the fluxes balance.
+        CPPUNIT_ASSERT(0 < secantSteps);
+        CPPUNIT_ASSERT(0 < newtonSteps);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(secantP, newtonP, 1.0e-8);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.2 * (100.0 - newtonP),
+                GunnsPowerLawUtils::computeFlux(newtonP, tConductance, exponents[i]), 1.0e-8);
+
+        /// - Test Newton converges in fewer minor steps.
+        CPPUNIT_ASSERT(newtonSteps <= 8);
+        CPPUNIT_ASSERT(newtonSteps < secantSteps);
+    }
+
+    std::cout << "... Pass";
+}
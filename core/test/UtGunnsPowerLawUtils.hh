@@ -0,0 +1,69 @@
+#ifndef UtGunnsPowerLawUtils_EXISTS
+#define UtGunnsPowerLawUtils_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_POWER_LAW_UTILS GUNNS Power Law Utilities Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Power Law Utilities class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/GunnsPowerLawUtils.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Power Law Utilities unit tests.
+///
+/// @details  This class provides the unit tests for the GUNNS Power Law Utilities class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsPowerLawUtils: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GUNNS Power Law Utilities unit test.
+        UtGunnsPowerLawUtils();
+        /// @brief    Default destructs this GUNNS Power Law Utilities unit test.
+        virtual ~UtGunnsPowerLawUtils();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the computeFlux method.
+        void testComputeFlux();
+        /// @brief    Tests the secant linearization.
+        void testSecant();
+        /// @brief    Tests the Newton linearization.
+        void testNewton();
+        /// @brief    Tests convergence of a non-linear circuit with both linearizations.
+        void testConvergence();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsPowerLawUtils);
+        CPPUNIT_TEST(testComputeFlux);
+        CPPUNIT_TEST(testSecant);
+        CPPUNIT_TEST(testNewton);
+        CPPUNIT_TEST(testConvergence);
+        CPPUNIT_TEST_SUITE_END();
+
+        double tConductance; /**< (--) Nominal power law conductance */
+        double tMinP;        /**< (--) Nominal minimum linearization potential */
+
+        /// @brief    Solves the test circuit and returns the number of minor steps to converge.
+        int solveCircuit(double& potential, const double exponent,
+                         const GunnsPowerLawUtils::Linearization type);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsPowerLawUtils(const UtGunnsPowerLawUtils& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsPowerLawUtils& operator =(const UtGunnsPowerLawUtils& that);
+};
+
+///@}
+
+#endif
@@ -0,0 +1,463 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+ ((core/GunnsSpotterScheduler.o))
+***************************************************************************************************/
+
+#include "UtGunnsSpotterScheduler.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include "software/exceptions/TsUnknownException.hh"
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  log  (--)  The shared step log.
+///
+/// @details  Constructs the test spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SchedulerTestSpotter::SchedulerTestSpotter(SchedulerTestLog& log)
+    :
+    GunnsNetworkSpotter(),
+    mLog(&log),
+    mStart(0),
+    mFinish(0),
+    mNumSteps(0),
+    mWaitForPeer(false),
+    mOverlap(false),
+    mThrow(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step (not used).
+///
+/// @details  Logs the pre-solver step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SchedulerTestSpotter::stepPreSolver(const double dt __attribute__((unused)))
+{
+    step();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step (not used).
+///
+/// @details  Logs the post-solver step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SchedulerTestSpotter::stepPostSolver(const double dt __attribute__((unused)))
+{
+    step();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Logs the step start, optionally waits up to 2 seconds for another spotter to start
+///           stepping while this one is, optionally throws, and logs the step finish.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SchedulerTestSpotter::step()
+{
+    pthread_mutex_lock(&mLog->mMutex);
+    mStart   = ++mLog->mTick;
+    mOverlap = (mLog->mActive > 0);
+    const int joins = mLog->mJoins;
+    if (mOverlap) {
+        ++mLog->mJoins;
+    }
+    ++mLog->mActive;
+    pthread_mutex_unlock(&mLog->mMutex);
+
+    for (int i = 0; mWaitForPeer and not mOverlap and i < 2000; ++i) {
+        usleep(1000);
+        pthread_mutex_lock(&mLog->mMutex);
+        mOverlap = (mLog->mJoins > joins);
+        pthread_mutex_unlock(&mLog->mMutex);
+    }
+
+    pthread_mutex_lock(&mLog->mMutex);
+    mFinish = ++mLog->mTick;
+    --mLog->mActive;
+    ++mNumSteps;
+    pthread_mutex_unlock(&mLog->mMutex);
+
+    if (mThrow) {
+        GUNNS_ERROR(TsNumericalException, "Test Exception", "test spotter throw.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsSpotterScheduler class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsSpotterScheduler::UtGunnsSpotterScheduler()
+    :
+    tArticle(0),
+    tName("test article"),
+    tConfig(0),
+    tInput(0),
+    tLog(),
+    tSpotters(),
+    tSpotterConfig(0),
+    tSpotterInput(0),
+    tObjects(),
+    tTimeStep(0.0)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsSpotterScheduler class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsSpotterScheduler::~UtGunnsSpotterScheduler()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+    for (int i = 0; i < NUM_SPOTTERS; ++i) {
+        delete tSpotters[i];
+    }
+    delete tSpotterInput;
+    delete tSpotterConfig;
+    delete tInput;
+    delete tConfig;
+    pthread_mutex_destroy(&tLog.mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.  Registers 5 test spotters with the test article:
+///           spotter 0 writes object A, 1 reads A, 2 reads object B, 3 writes B, and 4 declares
+///           nothing.  This should give phases {0, 2}, {1, 3} and {4}.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::setUp()
+{
+    tConfig = new GunnsSpotterSchedulerConfigData(tName, 2);
+    tInput  = new GunnsSpotterSchedulerInputData();
+
+    /// - Initialize the test spotters.
+    pthread_mutex_init(&tLog.mMutex, NULL);
+    tLog.mTick     = 0;
+    tLog.mActive   = 0;
+    tLog.mJoins    = 0;
+    tSpotterConfig = new GunnsNetworkSpotterConfigData("test spotter");
+    tSpotterInput  = new GunnsNetworkSpotterInputData();
+    for (int i = 0; i < NUM_SPOTTERS; ++i) {
+        tSpotters[i] = new SchedulerTestSpotter(tLog);
+        tSpotters[i]->initialize(tSpotterConfig, tSpotterInput);
+    }
+    tTimeStep = 0.1;
+
+    /// - Create the test article, and register and declare the spotters.
+    tArticle = new FriendlyGunnsSpotterScheduler();
+    for (int i = 0; i < NUM_SPOTTERS; ++i) {
+        tArticle->addSpotter(*tSpotters[i]);
+    }
+    tArticle->addWrite(*tSpotters[0], &tObjects[0]);
+    tArticle->addRead (*tSpotters[1], &tObjects[0]);
+    tArticle->addRead (*tSpotters[2], &tObjects[1]);
+    tArticle->addWrite(*tSpotters[3], &tObjects[1]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the config and input data classes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testConfigAndInput()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsSpotterScheduler 01: testConfigAndInput .....................";
+
+    /// @test nominal config data construction.
+    CPPUNIT_ASSERT(tName == tConfig->mName);
+    CPPUNIT_ASSERT(2     == tConfig->mNumThreads);
+
+    /// @test default config data construction.
+    GunnsSpotterSchedulerConfigData defaultConfig(tName);
+    CPPUNIT_ASSERT(1 == defaultConfig.mNumThreads);
+
+    /// @test new/delete for code coverage.
+    GunnsSpotterSchedulerConfigData* config = new GunnsSpotterSchedulerConfigData(tName);
+    delete config;
+    GunnsSpotterSchedulerInputData* input = new GunnsSpotterSchedulerInputData();
+    delete input;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the default constructor and spotter registration.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testDefaultConstruction()
+{
+    std::cout << "\n UtGunnsSpotterScheduler 02: testDefaultConstruction ................";
+
+    /// @test default state data.
+    FriendlyGunnsSpotterScheduler article;
+    CPPUNIT_ASSERT(""    == article.mName);
+    CPPUNIT_ASSERT(article.mEntries.empty());
+    CPPUNIT_ASSERT(article.mDependencies.empty());
+    CPPUNIT_ASSERT(0     == article.getNumPhases());
+    CPPUNIT_ASSERT(0     == article.getNumWorkers());
+    CPPUNIT_ASSERT(1     == article.mNumThreads);
+    CPPUNIT_ASSERT(-1    == article.mWorkFailed);
+    CPPUNIT_ASSERT(false == article.isInitialized());
+
+    /// @test spotters are registered once each, with their declarations.
+    CPPUNIT_ASSERT(NUM_SPOTTERS == static_cast<int>(tArticle->mEntries.size()));
+    tArticle->addSpotter(*tSpotters[1]);
+    CPPUNIT_ASSERT(NUM_SPOTTERS == static_cast<int>(tArticle->mEntries.size()));
+    CPPUNIT_ASSERT(tSpotters[1] == tArticle->mEntries[1].mSpotter);
+    CPPUNIT_ASSERT(1 == static_cast<int>(tArticle->mEntries[0].mWrites.size()));
+    CPPUNIT_ASSERT(tArticle->mEntries[0].mReads.empty());
+    CPPUNIT_ASSERT(&tObjects[0] == tArticle->mEntries[1].mReads[0]);
+    CPPUNIT_ASSERT(-1 == article.getPhase(*tSpotters[0]));
+
+    /// @test new/delete for code coverage.
+    GunnsSpotterScheduler* article2 = new GunnsSpotterScheduler();
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization and the phases the spotters are sorted into.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testInitialize()
+{
+    std::cout << "\n UtGunnsSpotterScheduler 03: testInitialize .........................";
+
+    tArticle->initialize(tConfig, tInput);
+
+    /// @test nominal initialization.
+    CPPUNIT_ASSERT(tName == tArticle->mName);
+    CPPUNIT_ASSERT(2     == tArticle->mNumThreads);
+    CPPUNIT_ASSERT(true  == tArticle->isInitialized());
+
+    /// @test conflicting spotters are in later phases, and spotters that declare nothing are alone.
+    const int expectedPhases[NUM_SPOTTERS] = {0, 1, 0, 1, 2};
+    CPPUNIT_ASSERT(3 == tArticle->getNumPhases());
+    for (int i = 0; i < NUM_SPOTTERS; ++i) {
+        CPPUNIT_ASSERT(expectedPhases[i] == tArticle->getPhase(*tSpotters[i]));
+    }
+    CPPUNIT_ASSERT(2 == static_cast<int>(tArticle->mPhases[0].size()));
+    CPPUNIT_ASSERT(0 == tArticle->mPhases[0][0]);
+    CPPUNIT_ASSERT(2 == tArticle->mPhases[0][1]);
+    CPPUNIT_ASSERT(4 == tArticle->mPhases[2][0]);
+
+    /// @test one worker helps the caller's thread with the phases of 2.
+    CPPUNIT_ASSERT(1 == tArticle->getNumWorkers());
+
+    /// @test re-initialization with more threads than the largest phase needs.
+    tConfig->mNumThreads = 8;
+    tArticle->initialize(tConfig, tInput);
+    CPPUNIT_ASSERT(true == tArticle->isInitialized());
+    CPPUNIT_ASSERT(3    == tArticle->getNumPhases());
+    CPPUNIT_ASSERT(1    == tArticle->getNumWorkers());
+
+    /// @test re-initialization with one thread has no workers.
+    tConfig->mNumThreads = 1;
+    tArticle->initialize(tConfig, tInput);
+    CPPUNIT_ASSERT(0 == tArticle->getNumWorkers());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testInitializeExceptions()
+{
+    std::cout << "\n UtGunnsSpotterScheduler 04: testInitializeExceptions ...............";
+
+    /// @test exception thrown from missing name.
+    tConfig->mName = "";
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->isInitialized());
+    tConfig->mName = tName;
+
+    /// @test exception thrown from null config & input data.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(0, tInput), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, 0), TsInitializationException);
+
+    /// @test exception thrown on bad config & input data pointer types.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tSpotterConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tSpotterInput), TsInitializationException);
+
+    /// @test exception thrown on bad number of threads.
+    tConfig->mNumThreads = 0;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->isInitialized());
+    tConfig->mNumThreads = 2;
+
+    /// @test exception thrown on no spotters.
+    FriendlyGunnsSpotterScheduler article;
+    CPPUNIT_ASSERT_THROW(article.initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == article.isInitialized());
+
+    /// @test exception thrown on declarations for an unregistered spotter.
+    CPPUNIT_ASSERT_THROW(article.addRead (*tSpotters[0], &tObjects[0]), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(article.addWrite(*tSpotters[0], &tObjects[0]), TsInitializationException);
+
+    /// @test exception thrown on a dependency with an unregistered spotter.
+    article.addSpotter(*tSpotters[0]);
+    article.addDependency(*tSpotters[0], *tSpotters[1]);
+    CPPUNIT_ASSERT_THROW(article.initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == article.isInitialized());
+
+    /// @test exception thrown on a spotter depending on itself.
+    tArticle->addDependency(*tSpotters[2], *tSpotters[2]);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    tArticle->mDependencies.clear();
+
+    /// @test exception thrown on circular dependencies.
+    tArticle->addDependency(*tSpotters[0], *tSpotters[1]);
+    tArticle->addDependency(*tSpotters[1], *tSpotters[2]);
+    tArticle->addDependency(*tSpotters[2], *tSpotters[0]);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tConfig, tInput), TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle->isInitialized());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests that explicit dependencies override registration order and add
+///           ordering between spotters that don't conflict.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testDependencies()
+{
+    std::cout << "\n UtGunnsSpotterScheduler 05: testDependencies .......................";
+
+    /// - Spotter 1 before the conflicting spotter 0, and the independent spotter 2 after 0.
+    FriendlyGunnsSpotterScheduler article;
+    for (int i = 0; i < 3; ++i) {
+        article.addSpotter(*tSpotters[i]);
+    }
+    article.addWrite(*tSpotters[0], &tObjects[0]);
+    article.addRead (*tSpotters[1], &tObjects[0]);
+    article.addRead (*tSpotters[2], &tObjects[1]);
+    article.addDependency(*tSpotters[1], *tSpotters[0]);
+    article.addDependency(*tSpotters[0], *tSpotters[2]);
+    tConfig->mNumThreads = 1;
+    article.initialize(tConfig, tInput);
+
+    /// @test phases follow the dependencies.
+    CPPUNIT_ASSERT(3 == article.getNumPhases());
+    CPPUNIT_ASSERT(1 == article.getPhase(*tSpotters[0]));
+    CPPUNIT_ASSERT(0 == article.getPhase(*tSpotters[1]));
+    CPPUNIT_ASSERT(2 == article.getPhase(*tSpotters[2]));
+
+    /// @test stepping order follows the dependencies.
+    article.stepPreSolver(tTimeStep);
+    CPPUNIT_ASSERT(tSpotters[1]->mFinish < tSpotters[0]->mStart);
+    CPPUNIT_ASSERT(tSpotters[0]->mFinish < tSpotters[2]->mStart);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests stepping all phases on the caller's thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testStepSequential()
+{
+    std::cout << "\n UtGunnsSpotterScheduler 06: testStepSequential .....................";
+
+    /// @test steps do nothing before initialization.
+    tArticle->stepPreSolver(tTimeStep);
+    CPPUNIT_ASSERT(0 == tSpotters[0]->mNumSteps);
+
+    tConfig->mNumThreads = 1;
+    tArticle->initialize(tConfig, tInput);
+
+    /// @test each spotter is stepped once per step, phase by phase, in registration order within
+    ///       each phase.
+    tArticle->stepPreSolver(tTimeStep);
+    const int expectedOrder[NUM_SPOTTERS] = {0, 2, 1, 3, 4};
+    for (int i = 0; i < NUM_SPOTTERS; ++i) {
+        CPPUNIT_ASSERT(1 == tSpotters[i]->mNumSteps);
+        CPPUNIT_ASSERT(2 * i + 1 == tSpotters[expectedOrder[i]]->mStart);
+        CPPUNIT_ASSERT(false == tSpotters[i]->mOverlap);
+    }
+
+    tArticle->stepPostSolver(tTimeStep);
+    for (int i = 0; i < NUM_SPOTTERS; ++i) {
+        CPPUNIT_ASSERT(2 == tSpotters[i]->mNumSteps);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests stepping the spotters within a phase in parallel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testStepParallel()
+{
+    std::cout << "\n UtGunnsSpotterScheduler 07: testStepParallel .......................";
+
+    tArticle->initialize(tConfig, tInput);
+    for (int i = 0; i < 4; ++i) {
+        tSpotters[i]->mWaitForPeer = true;
+    }
+
+    for (int step = 1; step <= 3; ++step) {
+        tArticle->stepPreSolver(tTimeStep);
+        tArticle->stepPostSolver(tTimeStep);
+
+        /// @test spotters in the same phase step at the same time.
+        for (int i = 0; i < 4; ++i) {
+            CPPUNIT_ASSERT(true == tSpotters[i]->mOverlap);
+        }
+        CPPUNIT_ASSERT(false == tSpotters[4]->mOverlap);
+
+        /// @test phases step in order.
+        CPPUNIT_ASSERT(tSpotters[0]->mFinish < tSpotters[1]->mStart);
+        CPPUNIT_ASSERT(tSpotters[0]->mFinish < tSpotters[3]->mStart);
+        CPPUNIT_ASSERT(tSpotters[2]->mFinish < tSpotters[1]->mStart);
+        CPPUNIT_ASSERT(tSpotters[2]->mFinish < tSpotters[3]->mStart);
+        CPPUNIT_ASSERT(tSpotters[1]->mFinish < tSpotters[4]->mStart);
+        CPPUNIT_ASSERT(tSpotters[3]->mFinish < tSpotters[4]->mStart);
+
+        /// @test each spotter is stepped once per step.
+        for (int i = 0; i < NUM_SPOTTERS; ++i) {
+            CPPUNIT_ASSERT(2 * step == tSpotters[i]->mNumSteps);
+        }
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests exceptions thrown by the stepped spotters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSpotterScheduler::testStepExceptions()
+{
+    std::cout << "\n UtGunnsSpotterScheduler 08: testStepExceptions .....................";
+
+    tArticle->initialize(tConfig, tInput);
+
+    /// @test an exception from a parallel phase is thrown as unknown after the phase finishes, and
+    ///       later phases aren't stepped.
+    tSpotters[0]->mThrow = true;
+    CPPUNIT_ASSERT_THROW(tArticle->stepPreSolver(tTimeStep), TsUnknownException);
+    CPPUNIT_ASSERT(1 == tSpotters[0]->mNumSteps);
+    CPPUNIT_ASSERT(1 == tSpotters[2]->mNumSteps);
+    CPPUNIT_ASSERT(0 == tSpotters[1]->mNumSteps);
+    CPPUNIT_ASSERT(0 == tSpotters[4]->mNumSteps);
+
+    /// @test the scheduler still works after an exception.
+    tSpotters[0]->mThrow = false;
+    tArticle->stepPreSolver(tTimeStep);
+    CPPUNIT_ASSERT(2 == tSpotters[0]->mNumSteps);
+    CPPUNIT_ASSERT(1 == tSpotters[4]->mNumSteps);
+
+    /// @test an exception from a spotter stepped alone passes through as-is.
+    tSpotters[4]->mThrow = true;
+    CPPUNIT_ASSERT_THROW(tArticle->stepPostSolver(tTimeStep), TsNumericalException);
+    CPPUNIT_ASSERT(2 == tSpotters[4]->mNumSteps);
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,137 @@
+#ifndef UtGunnsSpotterScheduler_EXISTS
+#define UtGunnsSpotterScheduler_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_SPOTTER_SCHEDULER    GUNNS Spotter Scheduler Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Spotter Scheduler class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/GunnsSpotterScheduler.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Shared step log for the scheduler test spotters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct SchedulerTestLog
+{
+    pthread_mutex_t mMutex;  /**< (--) Guards the log. */
+    int             mTick;   /**< (--) Count of step starts and finishes. */
+    int             mActive; /**< (--) Number of spotters currently stepping. */
+    int             mJoins;  /**< (--) Count of steps started while another spotter was stepping. */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Test spotter that logs when its steps start and finish.
+///
+/// @details  When mWaitForPeer is set, each step waits a while for another spotter to be stepping
+///           at the same time, to detect parallel stepping.  When mThrow is set, each step throws.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class SchedulerTestSpotter : public GunnsNetworkSpotter
+{
+    public:
+        SchedulerTestLog* mLog;         /**< (--) The shared step log. */
+        int               mStart;       /**< (--) Log tick when the last step started. */
+        int               mFinish;      /**< (--) Log tick when the last step finished. */
+        int               mNumSteps;    /**< (--) Number of steps. */
+        bool              mWaitForPeer; /**< (--) Wait for another spotter to step at the same time. */
+        bool              mOverlap;     /**< (--) Another spotter stepped at the same time. */
+        bool              mThrow;       /**< (--) Throw an exception when stepped. */
+        SchedulerTestSpotter(SchedulerTestLog& log);
+        virtual ~SchedulerTestSpotter() {;}
+        virtual void stepPreSolver(const double dt);
+        virtual void stepPostSolver(const double dt);
+        void         step();
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsSpotterScheduler and befriend UtGunnsSpotterScheduler.
+///
+/// @details  Class derived from the unit under test.  It has a default constructor and destructor,
+///           but it befriends the unit test case driver class to allow it access to protected data
+///           members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsSpotterScheduler : public GunnsSpotterScheduler
+{
+    public:
+        FriendlyGunnsSpotterScheduler() : GunnsSpotterScheduler() {;}
+        virtual ~FriendlyGunnsSpotterScheduler() {;}
+        friend class UtGunnsSpotterScheduler;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Spotter Scheduler Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsSpotterScheduler class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsSpotterScheduler : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsSpotterScheduler unit test.
+        UtGunnsSpotterScheduler();
+        /// @brief    Default destructs this GunnsSpotterScheduler unit test.
+        virtual ~UtGunnsSpotterScheduler();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the config and input data classes.
+        void testConfigAndInput();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests initialization and phase assignment.
+        void testInitialize();
+        /// @brief    Tests initialization exceptions.
+        void testInitializeExceptions();
+        /// @brief    Tests explicit dependencies.
+        void testDependencies();
+        /// @brief    Tests stepping on one thread.
+        void testStepSequential();
+        /// @brief    Tests stepping phases in parallel.
+        void testStepParallel();
+        /// @brief    Tests exceptions thrown by stepped spotters.
+        void testStepExceptions();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsSpotterScheduler);
+        CPPUNIT_TEST(testConfigAndInput);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testDependencies);
+        CPPUNIT_TEST(testStepSequential);
+        CPPUNIT_TEST(testStepParallel);
+        CPPUNIT_TEST(testStepExceptions);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Enumeration of the number of test spotters.
+        enum {NUM_SPOTTERS = 5};
+
+        FriendlyGunnsSpotterScheduler*   tArticle;                  /**< (--) Test article */
+        std::string                      tName;                     /**< (--) Instance name */
+        GunnsSpotterSchedulerConfigData* tConfig;                   /**< (--) Nominal config data */
+        GunnsSpotterSchedulerInputData*  tInput;                    /**< (--) Nominal input data */
+        SchedulerTestLog                 tLog;                      /**< (--) Test spotters step log */
+        SchedulerTestSpotter*            tSpotters[NUM_SPOTTERS];   /**< (--) Test spotters */
+        GunnsNetworkSpotterConfigData*   tSpotterConfig;            /**< (--) Test spotters config data */
+        GunnsNetworkSpotterInputData*    tSpotterInput;             /**< (--) Test spotters input data */
+        int                              tObjects[2];               /**< (--) Test objects for spotters to access */
+        double                           tTimeStep;                 /**< (s)  Time step size for this test */
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsSpotterScheduler(const UtGunnsSpotterScheduler& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsSpotterScheduler& operator =(const UtGunnsSpotterScheduler& that);
+};
+
+///@}
+
+#endif
@@ -30,12 +30,16 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsBasicJumperPlug.hh"
 #include "UtGunnsBasicExternalSupply.hh"
 #include "UtGunnsBasicExternalDemand.hh"
+#include "UtGunnsBasicDistributedIf.hh"
+#include "UtGunnsDistributedIfPredictor.hh"
+#include "UtGunnsBasicReducedIf.hh"
 #include "UtGunnsBasicFlowController.hh"
 #include "UtGunnsBasicIslandAnalyzer.hh"
 #include "UtGunnsFluidUtils.hh"
 #include "UtGunnsFluidNode.hh"
 #include "UtGunnsFluidLink.hh"
 #include "UtGunnsFluidFlowOrchestrator.hh"
+#include "UtGunnsFluidImplicitFlowOrchestrator.hh"
 #include "UtGunnsFluidConductor.hh"
 #include "UtGunnsFluidPotential.hh"
 #include "UtGunnsFluidCapacitor.hh"
@@ -50,9 +54,15 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsFluidFlowController.hh"
 #include "UtGunnsFluidIslandAnalyzer.hh"
 #include "UtGunnsNetworkSpotter.hh"
+#include "UtGunnsSpotterScheduler.hh"
 #include "UtGunnsMinorStepLog.hh"
+#include "UtGunnsLinkProfiler.hh"
+#include "UtGunnsPowerLawUtils.hh"
+#include "UtGunnsPortReduction.hh"
 #include "UtGunnsFluidFlowIntegrator.hh"
+#include "UtGunnsFluidFlowIntegratorGroup.hh"
 #include "UtGunnsFluidVolumeMonitor.hh"
+#include "UtGunnsFluidVolumeMonitorGroup.hh"
 #include "UtGunnsSensorAnalogWrapper.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,12 +89,16 @@ int main(int argc, char** argv) {
     runner.addTest( UtGunnsBasicJumperPlug::suite() );
     runner.addTest( UtGunnsBasicExternalSupply::suite() );
     runner.addTest( UtGunnsBasicExternalDemand::suite() );
+    runner.addTest( UtGunnsBasicDistributedIf::suite() );
+    runner.addTest( UtGunnsDistributedIfPredictor::suite() );
+    runner.addTest( UtGunnsBasicReducedIf::suite() );
     runner.addTest( UtGunnsBasicFlowController::suite());
     runner.addTest( UtGunnsBasicIslandAnalyzer::suite() );
     runner.addTest( UtGunnsFluidUtils::suite() );
     runner.addTest( UtGunnsFluidNode::suite() );
     runner.addTest( UtGunnsFluidLink::suite() );
     runner.addTest( UtGunnsFluidFlowOrchestrator::suite() );
+    runner.addTest( UtGunnsFluidImplicitFlowOrchestrator::suite() );
     runner.addTest( UtGunnsFluidConductor::suite() );
     runner.addTest( UtGunnsFluidPotential::suite() );
     runner.addTest( UtGunnsFluidCapacitor::suite() );
@@ -99,9 +113,15 @@ int main(int argc, char** argv) {
     runner.addTest( UtGunnsFluidFlowController::suite());
     runner.addTest( UtGunnsFluidIslandAnalyzer::suite() );
     runner.addTest( UtGunnsNetworkSpotter::suite() );
+    runner.addTest( UtGunnsSpotterScheduler::suite() );
     runner.addTest( UtGunnsMinorStepLog::suite() );
+    runner.addTest( UtGunnsLinkProfiler::suite() );
+    runner.addTest( UtGunnsPowerLawUtils::suite() );
+    runner.addTest( UtGunnsPortReduction::suite() );
     runner.addTest( UtGunnsFluidFlowIntegrator::suite() );
+    runner.addTest( UtGunnsFluidFlowIntegratorGroup::suite() );
     runner.addTest( UtGunnsFluidVolumeMonitor::suite() );
+    runner.addTest( UtGunnsFluidVolumeMonitorGroup::suite() );
     runner.addTest( UtGunnsSensorAnalogWrapper::suite() );
 
     runner.run();
@@ -97,7 +97,7 @@ DrawFluid::DrawFluid(const std::string& name)
     netNodes(),
     netConfig(name, this),
     netInput(this),
-    netFluidProperties(),
+    netFluidProperties(*DefinedFluidProperties::getInstance()),
     netInternalFluidConfig(&netFluidProperties, netConfig.netInternalFluidTypes, DrawFluidConfigData::N_INTERNAL_FLUIDS),
     // Data Tables 
     // Spotters
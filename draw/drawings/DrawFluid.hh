@@ -145,7 +145,7 @@ class DrawFluid : public GunnsNetworkBase
         GunnsFluidNode netNodes[DrawFluid::N_NODES];    /**< (--) Network nodes array. */
         DrawFluidConfigData netConfig;    /**< (--) trick_chkpnt_io(**) Network config data. */
         DrawFluidInputData netInput;    /**< (--) trick_chkpnt_io(**) Network input data. */
-        const DefinedFluidProperties netFluidProperties;        /**< (--) trick_chkpnt_io(**) Network defined fluid properties. */
+        const DefinedFluidProperties& netFluidProperties;       /**< (--) trick_chkpnt_io(**) Shared defined fluid properties. */
         PolyFluidConfigData          netInternalFluidConfig;    /**< (--) trick_chkpnt_io(**) Network internal fluid config. */
         // Data Tables
         // Spotters
@@ -72,8 +72,8 @@ ChemicalCompound::Type DrawFluidExtrasConfigData::reactorCompounds[DrawFluidExtr
 DrawFluidExtrasConfigData::DrawFluidExtrasConfigData(const std::string& name, DrawFluidExtras* network)
     :
     netTcConfig(netTcConfigTypes, DrawFluidExtrasConfigData::N_NETTCCONFIG, name + ".netTcConfig"),
-    netReactions(),
-    netCompounds(),
+    netReactions(*DefinedChemicalReactions::getInstance()),
+    netCompounds(*DefinedChemicalCompounds::getInstance()),
     netSolver(name + ".netSolver", 0.001, 1.0e-6, 1, 1),
     // Spotter Config Data
     tankVolumeMonitor(name + ".tankVolumeMonitor"),
@@ -146,7 +146,7 @@ DrawFluidExtras::DrawFluidExtras(const std::string& name)
     netNodes(),
     netConfig(name, this),
     netInput(this),
-    netFluidProperties(),
+    netFluidProperties(*DefinedFluidProperties::getInstance()),
     netInternalFluidConfig(&netFluidProperties, netConfig.netInternalFluidTypes, DrawFluidExtrasConfigData::N_INTERNAL_FLUIDS, &netConfig.netTcConfig),
     // Data Tables 
     // Spotters
@@ -199,9 +199,9 @@ class DrawFluidExtrasConfigData
         static ChemicalCompound::Type netTcConfigTypes[DrawFluidExtrasConfigData::N_NETTCCONFIG];    /**< (--) trick_chkpnt_io(**) netTcConfig chemical compounds list. */
         GunnsFluidTraceCompoundsConfigData netTcConfig;    /**< (--) trick_chkpnt_io(**) netTcConfig config data. */
         // Chemical reactions properties
-        DefinedChemicalReactions netReactions;    /**< (--) trick_chkpnt_io(**) Network defined chemical reactions */
+        const DefinedChemicalReactions& netReactions;    /**< (--) trick_chkpnt_io(**) Shared defined chemical reactions */
         // Chemical compounds properties
-        DefinedChemicalCompounds netCompounds;    /**< (--) trick_chkpnt_io(**) Network defined chemical compounds */
+        const DefinedChemicalCompounds& netCompounds;    /**< (--) trick_chkpnt_io(**) Shared defined chemical compounds */
         static ChemicalReaction::Type reactorReactions[DrawFluidExtrasConfigData::N_REACTORREACTIONS];    /**< (--) trick_chkpnt_io(**) reactorReactions chemical reactions list. */
         static ChemicalCompound::Type reactorCompounds[DrawFluidExtrasConfigData::N_REACTORCOMPOUNDS];    /**< (--) trick_chkpnt_io(**) reactorCompounds chemical compounds list. */
         // Solver configuration data
@@ -293,7 +293,7 @@ class DrawFluidExtras : public GunnsNetworkBase
         GunnsFluidNode netNodes[DrawFluidExtras::N_NODES];    /**< (--) Network nodes array. */
         DrawFluidExtrasConfigData netConfig;    /**< (--) trick_chkpnt_io(**) Network config data. */
         DrawFluidExtrasInputData netInput;    /**< (--) trick_chkpnt_io(**) Network input data. */
-        const DefinedFluidProperties netFluidProperties;        /**< (--) trick_chkpnt_io(**) Network defined fluid properties. */
+        const DefinedFluidProperties& netFluidProperties;       /**< (--) trick_chkpnt_io(**) Shared defined fluid properties. */
         PolyFluidConfigData          netInternalFluidConfig;    /**< (--) trick_chkpnt_io(**) Network internal fluid config. */
         // Data Tables
         // Spotters
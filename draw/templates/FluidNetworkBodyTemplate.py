@@ -94,14 +94,14 @@ class FluidNetworkBodyTemplate(BasicNetworkBodyTemplate):
   def blockConfigPreSolver(self):
     r = ''
     for extConfig in self.data['extFluidConfigs']:
-      r = r+('    ' + extConfig[0] + '(&network->netFluidProperties, ' + extConfig[0] + 'FluidTypes, ' + self.data['networkName'] + 'ConfigData::N_' + extConfig[0].upper() + '_FLUIDS),\n')
+      r = r+('    ' + extConfig[0] + '(DefinedFluidProperties::getInstance(), ' + extConfig[0] + 'FluidTypes, ' + self.data['networkName'] + 'ConfigData::N_' + extConfig[0].upper() + '_FLUIDS),\n')
     if len(self.data['intTcConfig']) > 0:
       r = r + (
         '    ' + self.data['intTcConfig'][0] + '(' + self.data['intTcConfig'][0] + 'Types, ' + self.data['networkName'] + 'ConfigData::N_' + self.data['intTcConfig'][0].upper() + ', name + ".' + self.data['intTcConfig'][0] + '"),\n')
     if len(self.data['reactions']) > 0:
-      r = r + ('    netReactions(),\n')
+      r = r + ('    netReactions(*DefinedChemicalReactions::getInstance()),\n')
     if len(self.data['compounds']) > 0:
-      r = r + ('    netCompounds(),\n')
+      r = r + ('    netCompounds(*DefinedChemicalCompounds::getInstance()),\n')
     return r
 
   def blockInputPreSpotter(self):
@@ -119,7 +119,7 @@ class FluidNetworkBodyTemplate(BasicNetworkBodyTemplate):
     return r
 
   def blockConstructorPreSpotter(self):
-    r = ('    netFluidProperties(),\n')
+    r = ('    netFluidProperties(*DefinedFluidProperties::getInstance()),\n')
     internalTcConfigName = ''
     if len(self.data['intTcConfig']) > 0:
       internalTcConfigName = ', &netConfig.' + self.data['intTcConfig'][0]
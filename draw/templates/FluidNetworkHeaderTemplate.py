@@ -131,11 +131,11 @@ class FluidNetworkHeaderTemplate(BasicNetworkHeaderTemplate):
     if len(self.data['reactions']) > 0:
       r = r + (
         '        // Chemical reactions properties\n'
-        '        DefinedChemicalReactions netReactions;    /**< (--) trick_chkpnt_io(**) Network defined chemical reactions */\n')
+        '        const DefinedChemicalReactions& netReactions;    /**< (--) trick_chkpnt_io(**) Shared defined chemical reactions */\n')
     if len(self.data['compounds']) > 0:
       r = r + (
         '        // Chemical compounds properties\n'
-        '        DefinedChemicalCompounds netCompounds;    /**< (--) trick_chkpnt_io(**) Network defined chemical compounds */\n')
+        '        const DefinedChemicalCompounds& netCompounds;    /**< (--) trick_chkpnt_io(**) Shared defined chemical compounds */\n')
     for rxnReactions in self.data['reactions']:
       r = r + (
         '        static ChemicalReaction::Type ' + rxnReactions[0] + '[' + self.data['networkNamespace'] + self.data['networkName'] + 'ConfigData::N_' + rxnReactions[0].upper() + '];    /**< (--) trick_chkpnt_io(**) ' + rxnReactions[0] + ' chemical reactions list. */\n')
@@ -166,7 +166,7 @@ class FluidNetworkHeaderTemplate(BasicNetworkHeaderTemplate):
     return r
 
   def blockDeclarationsPreSpotters(self):
-    r = ('        const DefinedFluidProperties netFluidProperties;        /**< (--) trick_chkpnt_io(**) Network defined fluid properties. */\n'
+    r = ('        const DefinedFluidProperties& netFluidProperties;       /**< (--) trick_chkpnt_io(**) Shared defined fluid properties. */\n'
         '        PolyFluidConfigData          netInternalFluidConfig;    /**< (--) trick_chkpnt_io(**) Network internal fluid config. */\n')
     return r
 
@@ -48,7 +48,8 @@ const std::string XmlFileSearch::NO_FILE_MSG = "Xml File Search: There were no f
 /// @param[in]  fileDirectory    (--) File directory to search for regular xml files.
 /// @param[in]  maxNumberOfFiles (--) Max number of files to search for.
 /// @details  Method to search directory. Stores found xml files in vector, ignores hidden files and
-///           subdirectories.
+///           subdirectories.  The files are sorted by name, since the directory entry order isn't
+///           defined, so users that load the files in list order do so the same way every run.
 /// @throws TsInitializationException If input data is set incorrectly.
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void XmlFileSearch::searchDirectory(
@@ -97,6 +98,9 @@ void XmlFileSearch::searchDirectory(
 
     closedir(dir);
 
+    /// - Sort the files so the list order doesn't depend on the file system.
+    std::sort(fileList.begin(), fileList.end());
+
     /// - Throw an exception if no files were found.
     if(fileList.empty())
     {
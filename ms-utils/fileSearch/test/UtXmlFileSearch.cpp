@@ -140,6 +140,10 @@ void UtXmlFileSearch::TestNumberOfFilesFound()
 
     CPPUNIT_ASSERT(2 == myFiles.size());
 
+    //Files are sorted by name.
+    CPPUNIT_ASSERT_EQUAL(std::string("fileFive.xml"), myFiles[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("fileSix.xml"),  myFiles[1]);
+
     std::cout << "\t... Pass";
 }
 
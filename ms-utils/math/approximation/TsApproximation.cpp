@@ -14,6 +14,18 @@
 
 #include "TsApproximation.hh"
 
+/// @brief  Saved table search indices of one approximation, for one thread.
+struct TsApproximationSearchHint {
+    const TsApproximation* mTable;    /**< (--) Approximation the indices belong to. */
+    int                    mIndex[2]; /**< (--) Saved search indices of the table. */
+};
+
+/// @brief  Number of approximations whose search indices each thread saves at once.
+static const unsigned long TS_APPROXIMATION_NUM_HINTS = 256;
+
+/// @brief  Each thread's saved table search indices, slotted by approximation address.
+static __thread TsApproximationSearchHint tsApproximationSearchHints[TS_APPROXIMATION_NUM_HINTS];
+
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this curve fit/interpolator approximation.
@@ -101,6 +113,32 @@ void TsApproximation::init(const double minX, const double maxX,
     mInitFlag = true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    sizeX  (--)  Number of points in the table's first independent variable scale.
+/// @param[in]    sizeY  (--)  Number of points in the table's second independent variable scale.
+///
+/// @return   Pointer to this thread's saved search indices for this approximation's table, in
+///           order of the first and second independent variables.
+///
+/// @details  Interpolators start their table searches from the cells of their last look-up, and
+///           save the new cells back here.  Keeping these indices per thread instead of in the
+///           object lets concurrent callers share one table without racing on them.  Each thread
+///           holds the indices of a fixed number of tables, slotted by table address.  When another
+///           table has taken this table's slot, or the saved indices are beyond the table's scales,
+///           the indices start over at zero as for a new table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int* TsApproximation::getSearchHint(const int sizeX, const int sizeY) const
+{
+    TsApproximationSearchHint& hint = tsApproximationSearchHints[
+            (reinterpret_cast<unsigned long>(this) >> 4) % TS_APPROXIMATION_NUM_HINTS];
+    if (hint.mTable != this or hint.mIndex[0] > sizeX - 2 or hint.mIndex[1] > sizeY - 2) {
+        hint.mTable    = this;
+        hint.mIndex[0] = 0;
+        hint.mIndex[1] = 0;
+    }
+    return hint.mIndex;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    x  (--)  First independent variable for curve fit/interpolation.
 /// @param[in]    y  (--)  Second independent variable for curve fit/interpolation.
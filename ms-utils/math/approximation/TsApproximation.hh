@@ -49,6 +49,10 @@ class TsApproximation {
         double getExceptional(const double x, const double y = 0);
         /// @brief   Returns initialization flag.
         bool isInitialized() const;
+        /// @brief   Returns the valid range lower limit for the first variable.
+        double getMinX() const;
+        /// @brief   Returns the valid range upper limit for the first variable.
+        double getMaxX() const;
     protected:
         double mMinX;      /**<    (--) trick_chkpnt_io(**) Approximation valid range lower limit for first variable.  */
         double mMaxX;      /**<    (--) trick_chkpnt_io(**) Approximation valid range upper limit for first variable.  */
@@ -70,6 +74,8 @@ class TsApproximation {
         /// @details  Returns this approximation for the specified variables.
         ////////////////////////////////////////////////////////////////////////////////////////////
         virtual double evaluate(const double x, const double y = 0.0) = 0;
+        /// @brief    Returns this thread's saved table search indices for this approximation.
+        int* getSearchHint(const int sizeX, const int sizeY = 2) const;
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -97,4 +103,22 @@ inline double TsApproximation::get(const double x, const double y) {
     return evaluate(z, w);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   The valid range lower limit for the first variable.
+///
+/// @details  Returns the valid range lower limit for the first variable.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsApproximation::getMinX() const {
+    return mMinX;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   The valid range upper limit for the first variable.
+///
+/// @details  Returns the valid range upper limit for the first variable.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsApproximation::getMaxX() const {
+    return mMaxX;
+}
+
 #endif
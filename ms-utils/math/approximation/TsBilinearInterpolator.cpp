@@ -20,9 +20,7 @@ TsBilinearInterpolator::TsBilinearInterpolator()
     mY(0),
     mZ(0),
     mM(0),
-    mN(0),
-    mI(0),
-    mJ(0)
+    mN(0)
 {
     // nothing to do
 }
@@ -56,9 +54,7 @@ TsBilinearInterpolator::TsBilinearInterpolator(const double* x,    const double*
         mY(0),
         mZ(0),
         mM(m),
-        mN(n),
-        mI(0),
-        mJ(0)
+        mN(n)
 {
     init(x, y, z, m, n, minX, maxX, minY, maxY, name);
 }
@@ -257,8 +253,6 @@ void TsBilinearInterpolator::init(const double* x,    const double* y, const dou
 
     mM = m;
     mN = n;
-    mI = 0;
-    mJ = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,55 +262,64 @@ void TsBilinearInterpolator::init(const double* x,    const double* y, const dou
 /// @return   bilinear interpolated dependent variable value at specified input.
 ///
 /// @details  Returns this bilinear interpolated for the specified variable.
-///           Saves previous indices mI and mJ.
+///           Starts the searches from, and saves, this thread's previous indices for this table.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double TsBilinearInterpolator::evaluate(const double x, const double y)
 {
-    /// - Find index i such that mX[i] <= x < mX[i+1] starting at mI from previous call.
+    /// - Start the searches from this thread's indices of the previous call on this table.
+    int* hint = getSearchHint(mM, mN);
+    int  i    = hint[0];
+    int  j    = hint[1];
+
+    /// - Find index i such that mX[i] <= x < mX[i+1] starting at i from previous call.
     ///   Note that constructor guarantees mX is in strictly ascending order.
-    if (x >= mX[mI+1]) {
+    if (x >= mX[i+1]) {
         // If x increased enough, search up.
-        for (int i = mI + 1; i < mM; ++i) {
-            if (mX[i] >= x) {
-                mI = i - 1;
+        for (int k = i + 1; k < mM; ++k) {
+            if (mX[k] >= x) {
+                i = k - 1;
                 break;
             }
         }
-    } else if (x < mX[mI]) {
+    } else if (x < mX[i]) {
         // If x decreased enough, search down.
-        for (int i = mI - 1; i >= 0; --i) {
-            if (mX[i] <= x) {
-                mI = i;
+        for (int k = i - 1; k >= 0; --k) {
+            if (mX[k] <= x) {
+                i = k;
                 break;
             }
         }
     }
 
-    /// - Find index i such that mY[i] <= y < mY[i+1] starting at mJ from previous call.
+    /// - Find index j such that mY[j] <= y < mY[j+1] starting at j from previous call.
     ///   Note that constructor guarantees mY is in strictly ascending order.
-    if (y >= mY[mJ+1]) {
+    if (y >= mY[j+1]) {
         // If y increased enough, search up.
-        for (int i = mJ + 1; i < mN; ++i) {
-            if (mY[i] >= y) {
-                mJ = i - 1;
+        for (int k = j + 1; k < mN; ++k) {
+            if (mY[k] >= y) {
+                j = k - 1;
                 break;
             }
         }
-    } else if (y < mY[mJ]) {
+    } else if (y < mY[j]) {
         // If y decreased enough, search down.
-        for (int i = mJ - 1; i >= 0; --i) {
-            if (mY[i] <= y) {
-                mJ = i;
+        for (int k = j - 1; k >= 0; --k) {
+            if (mY[k] <= y) {
+                j = k;
                 break;
             }
         }
     }
 
+    /// - Save the indices for the next call.
+    hint[0] = i;
+    hint[1] = j;
+
     /// - Return the bilinearly interpolated value
     // No threat of division by zero since constructor guarantees mX[i+1] > mX[i] and mY[j+1] > mY[j]
-    const double XDifInv = 1.0 / (mX[mI+1] - mX[mI]);
-    const double Z1      = ((mX[mI+1] - x) * mZ[mI][mJ]   + (x - mX[mI]) * mZ[mI+1][mJ]);
-    const double Z2      = ((mX[mI+1] - x) * mZ[mI][mJ+1] + (x - mX[mI]) * mZ[mI+1][mJ+1]);
-    return (Z1 * (mY[mJ+1] - y) + Z2 * (y - mY[mJ])) * XDifInv / (mY[mJ+1] - mY[mJ]);
+    const double XDifInv = 1.0 / (mX[i+1] - mX[i]);
+    const double Z1      = ((mX[i+1] - x) * mZ[i][j]   + (x - mX[i]) * mZ[i+1][j]);
+    const double Z2      = ((mX[i+1] - x) * mZ[i][j+1] + (x - mX[i]) * mZ[i+1][j+1]);
+    return (Z1 * (mY[j+1] - y) + Z2 * (y - mY[j])) * XDifInv / (mY[j+1] - mY[j]);
 }
 
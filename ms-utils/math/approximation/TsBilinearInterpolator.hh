@@ -61,8 +61,6 @@ class TsBilinearInterpolator : public TsApproximation {
         double** mZ; /**< ** (--) trick_chkpnt_io(**) Array of values for the dependent array. */
         int      mM; /**<    (--) trick_chkpnt_io(**) Length of the first independent variable array. */
         int      mN; /**<    (--) trick_chkpnt_io(**) Length of the second independent variable array. */
-        int      mI; /**<    (--)                     Previous interpolation index (mX[mI] <= x < mX[mI+1]). */
-        int      mJ; /**<    (--)                     Previous interpolation index (mY[mJ] <= y < mY[mJ+1]). */
         /// @brief    Returns the bilinear interpolated value for the specified variables.
         virtual double evaluate(const double x, const double y) ;
         /// @brief    Deletes dynamic memory
@@ -94,10 +94,10 @@ void TsBilinearInterpolatorReverse::init()
 /// @return   Bilinear interpolated dependent variable y value at specified input x & z.
 ///
 /// @details  Using the same type of table for z = f(x, y) as in the TsBilinearInterpolator class,
-///           this returns the value y given x and z.  It searches the y axis starting from the
-///           previous y result.  If there are multiple solutions for y, this returns the first one
-///           it finds.  If there are no solutions for y, this returns the y that would result in
-///           z = f(x,y) being closest to the given z.
+///           this returns the value y given x and z.  It searches the y axis starting from this
+///           thread's previous y result in this table.  If there are multiple solutions for y, this
+///           returns the first one it finds.  If there are no solutions for y, this returns the y
+///           that would result in z = f(x,y) being closest to the given z.
 ///
 /// @note     If there are multiple solutions for y at the given x & z, this is not guaranteed to
 ///           return the one you want.  This class is best used for tables that have unique
@@ -105,21 +105,26 @@ void TsBilinearInterpolatorReverse::init()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 double TsBilinearInterpolatorReverse::evaluate(const double x, const double z)
 {
-    /// - Find index i such that mX[i] <= x < mX[i+1] starting at mI from previous call.
+    /// - Start the searches from this thread's indices of the previous call on this table.
+    int* hint = getSearchHint(mM, mN);
+    int  i    = hint[0];
+    int  j    = hint[1];
+
+    /// - Find index i such that mX[i] <= x < mX[i+1] starting at i from previous call.
     ///   Note that constructor guarantees mX is in strictly ascending order.
-    if (x >= mX[mI+1]) {
+    if (x >= mX[i+1]) {
         // If x increased enough, search up.
-        for (int i = mI + 1; i < mM; ++i) {
-            if (mX[i] >= x) {
-                mI = i - 1;
+        for (int k = i + 1; k < mM; ++k) {
+            if (mX[k] >= x) {
+                i = k - 1;
                 break;
             }
         }
-    } else if (x < mX[mI]) {
+    } else if (x < mX[i]) {
         // If x decreased enough, search down.
-        for (int i = mI - 1; i >= 0; --i) {
-            if (mX[i] <= x) {
-                mI = i;
+        for (int k = i - 1; k >= 0; --k) {
+            if (mX[k] <= x) {
+                i = k;
                 break;
             }
         }
@@ -127,10 +132,10 @@ double TsBilinearInterpolatorReverse::evaluate(const double x, const double z)
 
     /// - Store the fractional distance of the x argument across the bounding x scale points.
     //    No threat of division by zero since constructor guarantees mX[i+1] > mX[i].
-    const double xFrac = (x - mX[mI]) / (mX[mI+1] - mX[mI]);
+    const double xFrac = (x - mX[i]) / (mX[i+1] - mX[i]);
 
     /// - Initialize a return value of y.
-    double y = mY[mJ];
+    double y = mY[j];
 
     /// - Loop over adjacent pairs of y rows, and interpolate for values of z on the y scale values
     ///   at the given x.  Find a pair of these z values that bound the input argument z.  Start
@@ -140,21 +145,21 @@ double TsBilinearInterpolatorReverse::evaluate(const double x, const double z)
     ///   bounding set is found.
     int direction = 0;
     double zDelta = 1.0E16;
-    double zTail  = mZ[mI][mJ]   + xFrac * (mZ[mI+1][mJ]   - mZ[mI][mJ]);
-    double zHead  = mZ[mI][mJ+1] + xFrac * (mZ[mI+1][mJ+1] - mZ[mI][mJ+1]);
-    for (int i=0; i<mN-1; ++i) {
+    double zTail  = mZ[i][j]   + xFrac * (mZ[i+1][j]   - mZ[i][j]);
+    double zHead  = mZ[i][j+1] + xFrac * (mZ[i+1][j+1] - mZ[i][j+1]);
+    for (int k=0; k<mN-1; ++k) {
 
         /// - Determine if z is between the interpolated z values at the current y bounds.  Note
         ///   that zTail can be either greater or less than zHead, order doesn't matter.
         if (isBetween(zTail, z, zHead)) {
             if (zHead != zTail) {
                 /// - Interpolate between the bounding z values.
-                y = mY[mJ] + (mY[mJ+1] - mY[mJ]) * (z - zTail) / (zHead - zTail);
+                y = mY[j] + (mY[j+1] - mY[j]) * (z - zTail) / (zHead - zTail);
             } else {
                 /// - If the bounding z values are exactly equal, then there are an infinite number
                 ///   of solutions for y = f(x, z) in this range, so the best we can do is pick the
                 ///   middle of the range.
-                y = 0.5 * (mY[mJ] + mY[mJ+1]);
+                y = 0.5 * (mY[j] + mY[j+1]);
             }
             break;
         } else {
@@ -162,11 +167,11 @@ double TsBilinearInterpolatorReverse::evaluate(const double x, const double z)
             const double zHeadD = fabs(z - zHead);
             const double zTailD = fabs(z - zTail);
             if (zHeadD < zDelta) {
-                y = mY[mJ+1];
+                y = mY[j+1];
                 zDelta = zHeadD;
             }
             if (zTailD < zDelta) {
-                y = mY[mJ];
+                y = mY[j];
                 zDelta = zTailD;
             }
 
@@ -182,30 +187,34 @@ double TsBilinearInterpolatorReverse::evaluate(const double x, const double z)
             }
 
             /// - Increment the y scale points in the search direction and interpolate for new
-            ///   bounding z values.  Wrap mJ around to the other end of the scale when an end is
+            ///   bounding z values.  Wrap j around to the other end of the scale when an end is
             ///   passed.
-            mJ += direction;
-            if (mJ < 0) {
+            j += direction;
+            if (j < 0) {
                 // Searching backwards past the beginning, reset to the end.
-                mJ = mN-2;
-                zTail = mZ[mI][mJ]   + xFrac * (mZ[mI+1][mJ]   - mZ[mI][mJ]);
-                zHead = mZ[mI][mJ+1] + xFrac * (mZ[mI+1][mJ+1] - mZ[mI][mJ+1]);
-            } else if (mJ > mN-2) {
+                j = mN-2;
+                zTail = mZ[i][j]   + xFrac * (mZ[i+1][j]   - mZ[i][j]);
+                zHead = mZ[i][j+1] + xFrac * (mZ[i+1][j+1] - mZ[i][j+1]);
+            } else if (j > mN-2) {
                 // Searching forwards past the end, reset to the beginning.
-                mJ = 0;
-                zTail = mZ[mI][mJ]   + xFrac * (mZ[mI+1][mJ]   - mZ[mI][mJ]);
-                zHead = mZ[mI][mJ+1] + xFrac * (mZ[mI+1][mJ+1] - mZ[mI][mJ+1]);
+                j = 0;
+                zTail = mZ[i][j]   + xFrac * (mZ[i+1][j]   - mZ[i][j]);
+                zHead = mZ[i][j+1] + xFrac * (mZ[i+1][j+1] - mZ[i][j+1]);
             } else if (direction > 0) {
                 // Searching forward.
                 zTail = zHead;
-                zHead = mZ[mI][mJ+1] + xFrac * (mZ[mI+1][mJ+1] - mZ[mI][mJ+1]);
+                zHead = mZ[i][j+1] + xFrac * (mZ[i+1][j+1] - mZ[i][j+1]);
             } else {
                 // Searching backward.
                 zHead = zTail;
-                zTail = mZ[mI][mJ]   + xFrac * (mZ[mI+1][mJ]   - mZ[mI][mJ]);
+                zTail = mZ[i][j]   + xFrac * (mZ[i+1][j]   - mZ[i][j]);
             }
         }
     }
+
+    /// - Save the indices for the next call.
+    hint[0] = i;
+    hint[1] = j;
     return y;
 }
 
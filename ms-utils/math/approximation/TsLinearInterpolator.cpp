@@ -18,8 +18,7 @@ TsLinearInterpolator::TsLinearInterpolator()
     TsApproximation(),
     mX(0),
     mZ(0),
-    mM(0),
-    mI(0)
+    mM(0)
 {
     // nothing to do
 }
@@ -45,8 +44,7 @@ TsLinearInterpolator::TsLinearInterpolator(const double* x,   const double* z,
         TsApproximation(),
         mX(0),
         mZ(0),
-        mM(n),
-        mI(0)
+        mM(n)
 {
     init(x, z, n, minX, maxX, name);
 }
@@ -227,14 +225,15 @@ inline int  TsLinearInterpolator::selectCell(const double x, const double mX[],
 ///
 /// @details  Returns this linear interpolator model for the specified variable.
 ///           The user of this method is responsible for ensuring initialization has occurred.
-///           Saves previous index mI.
+///           Starts the search from, and saves, this thread's previous index for this table.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double TsLinearInterpolator::evaluate(const double x, const double y __attribute__((unused)))
 {
-
-    mI = selectCell(x, mX, mM, mI);
+    int& hintI = getSearchHint(mM)[0];
+    const int i = selectCell(x, mX, mM, hintI);
+    hintI = i;
     /// - Return the linearly interpolated value.
-    return mZ[mI] + (mZ[mI+1] - mZ[mI]) * (x - mX[mI]) / (mX[mI+1] - mX[mI]);
+    return mZ[i] + (mZ[i+1] - mZ[i]) * (x - mX[i]) / (mX[i+1] - mX[i]);
 }
 
 
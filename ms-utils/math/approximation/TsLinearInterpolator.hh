@@ -47,7 +47,6 @@ class TsLinearInterpolator: public TsApproximation {
         double* mX; /**< ** (--) trick_chkpnt_io(**) Array of values for the independent variable. */
         double* mZ; /**< ** (--) trick_chkpnt_io(**) Array of values for the dependent variable. */
         int     mM; /**<    (--) trick_chkpnt_io(**) Length of the independent and dependent variable arrays. */
-        int     mI; /**<    (--)                     Previous interpolation index (mX[mI] <= x < mX[mI+1]). */
         /// @brief    Returns the linear interpolated value for the specified variables.
         virtual double evaluate(const double x, const double = 0.0);
         /// @brief    returns index to use in interpolation
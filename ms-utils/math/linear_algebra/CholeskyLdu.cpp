@@ -373,3 +373,104 @@ void CholeskyLdu::SolveUnitUpperTriangular(double *U, double B[], double x[], in
         }
     }
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] A (--) On input, the pointer to the first element of the matrix A[n][n].  On
+///                       output, the matrix A is replaced by the lower triangular, diagonal, and
+///                       upper triangular matrices of the Cholesky LDL' factorization of A.
+/// @param[in]     n (--) The number of rows and/or columns of the matrix A.
+///
+/// @throws  TsNumericalException
+///
+/// @details  This is the same decomposition as the double-precision Decompose, in single precision.
+///           It moves half the memory and fits twice the elements per SIMD register, for use as the
+///           inner solver of a mixed-precision iterative refinement, where the caller recovers
+///           double-precision accuracy with residuals of the double-precision matrix.  The
+///           underflow limit is scaled down for the smaller single-precision range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLdu::DecomposeSingle(float *A, int n)
+{
+    float *p_i = A + n;                    // pointer to L[i][0]
+    for (int i = 1; i < n; p_i += n, i++) {
+
+        /// - Calculate elements given by the product L[i][j]*D[j].
+        float *p_j = A;                    // pointer to L[j][0]
+        for (int j = 0; j < i; j++, p_j += n) {
+            const float limit = -1.0E-30F;
+            for (int k = 0; k < j; k++) {
+                /// - Skip operations on zero to save time.
+                if (limit > *(p_i + k) and limit > *(p_j + k)) {
+                    *(p_i + j) -= *(p_i + k) * *(p_j + k);
+                }
+            }
+            /// - Protect for underflow, the same as the double-precision Decompose.
+            if ( (*(p_i + j) > limit) and (*(p_i + j) < -limit) ) {
+                *(p_i + j) = 0.0F;
+            }
+        }
+
+        /// - Calculate the diagonal element D[i] and L[i][j].  Store the transpose L[k][i];
+        float *p_k = A;                    // pointer to L[k][0]
+        for (int k = 0; k < i; p_k += n, k++) {
+            float ld = *(p_i + k) / *(p_k + k);    // temp storage
+            *(p_i + i) -= *(p_i + k) * ld;
+            *(p_i + k) = ld;
+            *(p_k + i) = ld;
+        }
+
+        /// - Return the failing row number to aid debugging.
+        if ( *(p_i + i) <= 0.0F ) {
+            std::ostringstream msg;
+            msg << "failed at row " << i;
+            throw(TsNumericalException("", "CholeskyLdu::DecomposeSingle", msg.str()));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  LDU (--) Pointer to the first element of the single-precision matrix whose elements
+///                      form the unit lower triangular, diagonal, and unit upper triangular matrix
+///                      factors of A.
+/// @param[in]  B   (--) Pointer to the column vector, (n x 1) matrix, B.
+/// @param[out] x   (--) Solution to the equation Ax = B.
+/// @param[in]  n   (--) The number of rows or columns of the matrix LDU.
+///
+/// @throws  TsNumericalException
+///
+/// @details  This is the same solution as the double-precision Solve, in single precision, after
+///           the matrix A has been decomposed by DecomposeSingle.  The forward substitution, the
+///           diagonal and the back substitution are done in one method since there are no
+///           single-precision versions of the triangular solvers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLdu::SolveSingle(const float *LDU, const float B[], float x[], int n)
+{
+    /// - Solve the linear equation Ly = B for y, where L is a unit lower triangular matrix.
+    x[0] = B[0];
+    const float *p_k = LDU + n;
+    for (int k = 1; k < n; p_k += n, k++) {
+        x[k] = B[k];
+        for (int i = 0; i < k; i++) {
+            x[k] -= x[i] * *(p_k + i);
+        }
+    }
+
+    /// - Solve the linear equation Dz = y for z, where D is the diagonal matrix.
+    p_k = LDU;
+    for (int k = 0; k < n; k++, p_k += n) {
+        /// - Return the failing row number to aid debugging.
+        if ( *(p_k + k) == 0.0F ) {
+            std::ostringstream msg;
+            msg << "failed at row " << k;
+            throw(TsNumericalException("", "CholeskyLdu::SolveSingle", msg.str()));
+        }
+        x[k] /= *(p_k + k);
+    }
+
+    /// - Solve the linear equation Ux = z, where U is a unit upper triangular matrix.
+    p_k = LDU + n * (n - 2);
+    for (int k = n - 2; k >= 0; p_k -= n, k--) {
+        for (int i = k + 1; i < n; i++) {
+            x[k] -= x[i] * *(p_k + i);
+        }
+    }
+}
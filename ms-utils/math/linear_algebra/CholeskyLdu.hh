@@ -69,6 +69,12 @@ class CholeskyLdu
         /// @brief Solves [U]{x} = {b} where [U] is a n x n unit upper triangular matrix.
         virtual void SolveUnitUpperTriangular(double *U, double B[], double x[], int n);
 
+        /// @brief Decomposes the single-precision admittance matrix [A].
+        virtual void DecomposeSingle(float *A, int n);
+
+        /// @brief Uses the decomposed single-precision matrix to solve [A]{x} = {b} for {x}.
+        virtual void SolveSingle(const float *LDU, const float B[], float x[], int n);
+
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
         CholeskyLdu(const CholeskyLdu& that);
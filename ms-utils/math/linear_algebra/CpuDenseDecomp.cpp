@@ -0,0 +1,196 @@
+/**
+@file
+@brief    CPU Dense Decomposition implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+     ((math/linear_algebra/CpuParallelLdu.o)
+      (software/exceptions/TsNumericalException.o))
+*/
+
+#include "CpuDenseDecomp.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <algorithm>
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numThreads (--) Number of threads to use including the caller's, or < 1 for the
+///                            number of online processors.
+///
+/// @details  Default constructs this CPU Dense Decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CpuDenseDecomp::CpuDenseDecomp(const int numThreads)
+    :
+    CpuParallelLdu(numThreads),
+    mA(0),
+    mN(0),
+    mBlockBegin(0),
+    mBlockEnd(0),
+    mInverseD()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this CPU Dense Decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CpuDenseDecomp::~CpuDenseDecomp()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] A (--) On input, the pointer to the first element of the matrix A[n][n].  On
+///                       output, the matrix A is replaced by the lower triangular, diagonal, and
+///                       upper triangular matrices of the Cholesky LDL' factorization of A.
+/// @param[in]     n (--) The number of rows and/or columns of the matrix A.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Decomposes [A] into the same factors as CholeskyLdu::Decompose, one block of columns
+///           at a time.  Only the lower triangle of [A] is read.  While a block's panel is being
+///           solved and applied, its entries hold the products L[i][k]*D[k], and are scaled to
+///           L[i][k] once the trailing matrix has been updated.  Finally the upper triangle is set
+///           to the transpose of L.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuDenseDecomp::Decompose(double *A, int n)
+{
+    mA = A;
+    mN = n;
+    mInverseD.resize(n);
+
+    for (mBlockBegin = 0; mBlockBegin < n; mBlockBegin = mBlockEnd) {
+        mBlockEnd = std::min(mBlockBegin + BLOCK_SIZE, n);
+        factorBlock();
+        if (mBlockEnd < n) {
+            parallelRows(PANEL,  mBlockEnd, n);
+            parallelRows(UPDATE, mBlockEnd, n);
+
+            /// - Scale the panel from L*D to L now that the trailing matrix is done with it.
+            for (int i = mBlockEnd; i < n; ++i) {
+                double* row = A + i * n;
+                for (int k = mBlockBegin; k < mBlockEnd; ++k) {
+                    row[k] *= mInverseD[k];
+                }
+            }
+        }
+    }
+
+    /// - Store the transpose of L in the upper triangle.
+    for (int i = 1; i < n; ++i) {
+        for (int k = 0; k < i; ++k) {
+            A[k * n + i] = A[i * n + k];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws  TsNumericalException
+///
+/// @details  Factors the current diagonal block into L and D, which has already been updated from
+///           all of the blocks to its left.  Throws an exception with the failing row if a
+///           diagonal factor isn't positive.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuDenseDecomp::factorBlock()
+{
+    for (int k = mBlockBegin; k < mBlockEnd; ++k) {
+        const double d = mA[k * mN + k];
+        if (not (d > 0.0)) {
+            std::ostringstream msg;
+            msg << "failed at row " << k;
+            throw(TsNumericalException("", "CpuDenseDecomp::Decompose", msg.str()));
+        }
+        mInverseD[k] = 1.0 / d;
+
+        /// - Update the rest of the block with column k, while it still holds L[j][k]*D[k].
+        for (int i = k + 1; i < mBlockEnd; ++i) {
+            double* rowI = mA + i * mN;
+            if (0.0 != rowI[k]) {
+                const double l = rowI[k] * mInverseD[k];
+                for (int j = k + 1; j <= i; ++j) {
+                    rowI[j] -= l * mA[j * mN + k];
+                }
+            }
+        }
+        for (int i = k + 1; i < mBlockEnd; ++i) {
+            mA[i * mN + k] *= mInverseD[k];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] task  (--) The task to run.
+/// @param[in] begin (--) First row to process.
+/// @param[in] end   (--) One past the last row to process.
+///
+/// @details  Runs the given task on the given rows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuDenseDecomp::runRows(const int task, const int begin, const int end)
+{
+    if (PANEL == task) {
+        solvePanel(begin, end);
+    } else {
+        updateTrailing(begin, end);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] begin (--) First row to process.
+/// @param[in] end   (--) One past the last row to process.
+///
+/// @details  Solves the given rows of the panel below the diagonal block for L[i][j]*D[j], by
+///           forward substitution with the block's L.  The rows are independent of each other.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuDenseDecomp::solvePanel(const int begin, const int end)
+{
+    for (int i = begin; i < end; ++i) {
+        double* rowI = mA + i * mN;
+        for (int j = mBlockBegin; j < mBlockEnd; ++j) {
+            const double* rowJ = mA + j * mN;
+            double sum = rowI[j];
+            for (int k = mBlockBegin; k < j; ++k) {
+                sum -= rowI[k] * rowJ[k];
+            }
+            rowI[j] = sum;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] begin (--) First row to process.
+/// @param[in] end   (--) One past the last row to process.
+///
+/// @details  Subtracts the panel's contribution from the given rows of the lower triangle of the
+///           trailing matrix.  Each row only writes to itself and only reads the panel, so the rows
+///           are independent of each other.  Only the nonzero entries of a row's panel are applied,
+///           and rows with none are skipped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuDenseDecomp::updateTrailing(const int begin, const int end)
+{
+    double l[BLOCK_SIZE];
+    int    col[BLOCK_SIZE];
+    for (int i = begin; i < end; ++i) {
+        double* rowI = mA + i * mN;
+        int nonzero = 0;
+        for (int k = mBlockBegin; k < mBlockEnd; ++k) {
+            if (0.0 != rowI[k]) {
+                l[nonzero]   = rowI[k] * mInverseD[k];
+                col[nonzero] = k;
+                ++nonzero;
+            }
+        }
+        if (0 == nonzero) {
+            continue;
+        }
+        for (int j = mBlockEnd; j <= i; ++j) {
+            const double* rowJ = mA + j * mN;
+            double sum = 0.0;
+            for (int k = 0; k < nonzero; ++k) {
+                sum += l[k] * rowJ[col[k]];
+            }
+            rowI[j] -= sum;
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef CpuDenseDecomp_EXISTS
+#define CpuDenseDecomp_EXISTS
+
+/**
+@file
+@brief    CPU Dense Decomposition declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_CPU_DENSE CPU Dense Decomposition
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (This class decomposes a dense symmetric positive definite matrix into its Cholesky LDU factors
+   on multiple CPU threads.  It is the CPU stand-in for CudaDenseDecomp when GUNNS is built without
+   CUDA.)
+
+REFERENCE:
+- (Golub, G. H. & Van Loan, C. F., "Matrix Computations", 4th ed., section 4.2, block LDL')
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The matrix is symmetric and positive definite.)
+
+LIBRARY_DEPENDENCY:
+- ((CpuDenseDecomp.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "math/linear_algebra/CpuParallelLdu.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    CPU Dense Decomposition
+///
+/// @details  This gives the same LDU factors in place of [A] as CholeskyLdu::Decompose, so the
+///           result can be used with CholeskyLdu::Solve, but is computed by a blocked right-looking
+///           method whose work is mostly shared among threads.  For each block of columns, the
+///           diagonal block is factored on the caller's thread, then the rows of the panel below it
+///           are solved in parallel, then the rows of the trailing matrix are updated from the panel
+///           in parallel.  Rows with no entries in the panel, common in network admittance matrices,
+///           are skipped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class CpuDenseDecomp : public CpuParallelLdu
+{
+    public:
+        /// @brief Default constructor.
+        CpuDenseDecomp(const int numThreads = 1);
+        /// @brief Default destructor.
+        virtual ~CpuDenseDecomp();
+        /// @brief Decomposes the admittance matrix [A] on multiple threads.
+        virtual void Decompose(double *A, int n);
+
+    protected:
+        /// @brief Enumeration of the parallel tasks.
+        enum Task {
+            PANEL  = 0, ///< Solve the panel rows below the diagonal block.
+            UPDATE = 1  ///< Update the trailing matrix rows from the panel.
+        };
+        static const int    BLOCK_SIZE = 32; /**< (--) Number of columns in each block. */
+        double*             mA;              /**< (--) The matrix being decomposed. */
+        int                 mN;              /**< (--) Size of the matrix being decomposed. */
+        int                 mBlockBegin;     /**< (--) First column of the current block. */
+        int                 mBlockEnd;       /**< (--) One past the last column of the current block. */
+        std::vector<double> mInverseD;       /**< (--) Inverses of the diagonal factors. */
+        /// @brief Factors the diagonal block on the caller's thread.
+        void         factorBlock();
+        /// @brief Runs the given task on the given rows.
+        virtual void runRows(const int task, const int begin, const int end);
+        /// @brief Solves the given panel rows.
+        void         solvePanel(const int begin, const int end);
+        /// @brief Updates the given trailing matrix rows.
+        void         updateTrailing(const int begin, const int end);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        CpuDenseDecomp(const CpuDenseDecomp& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        CpuDenseDecomp& operator =(const CpuDenseDecomp&);
+};
+
+/// @}
+
+#endif
@@ -0,0 +1,209 @@
+/**
+@file
+@brief    CPU Parallel LDU Decomposition implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+     ((math/linear_algebra/CholeskyLdu.o)
+      (simulation/hs/TsHsMsg.o))
+*/
+
+#include "CpuParallelLdu.hh"
+#include "simulation/hs/TsHsMsg.hh"
+#include <algorithm>
+#include <sstream>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numThreads (--) Number of threads to use including the caller's, or < 1 for the
+///                            number of online processors.
+///
+/// @details  Default constructs this CPU Parallel LDU Decomposition.  No threads are started yet.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CpuParallelLdu::CpuParallelLdu(const int numThreads)
+    :
+    CholeskyLdu(),
+    mNumThreads(1),
+    mWorkers(),
+    mMutex(),
+    mWorkReady(),
+    mWorkDone(),
+    mGeneration(0),
+    mStopping(false),
+    mWorking(false),
+    mWorkTask(0),
+    mWorkNext(0),
+    mWorkEnd(0),
+    mWorkChunk(1),
+    mWorkPending(0)
+{
+    pthread_mutex_init(&mMutex, NULL);
+    pthread_cond_init(&mWorkReady, NULL);
+    pthread_cond_init(&mWorkDone, NULL);
+    setNumThreads(numThreads);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this CPU Parallel LDU Decomposition, stopping the worker threads.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CpuParallelLdu::~CpuParallelLdu()
+{
+    stopWorkers();
+    pthread_cond_destroy(&mWorkDone);
+    pthread_cond_destroy(&mWorkReady);
+    pthread_mutex_destroy(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numThreads (--) Number of threads to use including the caller's, or < 1 for the
+///                            number of online processors.
+///
+/// @details  Sets the number of threads to use.  Any running worker threads are stopped, and the new
+///           number is started on the next parallel call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuParallelLdu::setNumThreads(const int numThreads)
+{
+    stopWorkers();
+    if (numThreads > 0) {
+        mNumThreads = numThreads;
+    } else {
+        mNumThreads = std::max(1, static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN)));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Starts the worker threads to go with the caller's thread.  If a thread can't be
+///           created, the work is shared among the workers that were.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuParallelLdu::startWorkers()
+{
+    mStopping = false;
+    for (int i = 0; i < mNumThreads - 1; ++i) {
+        pthread_t thread;
+        if (0 != pthread_create(&thread, NULL, workerEntry, this)) {
+            std::ostringstream msg;
+            msg << "could only start " << i << " of " << mNumThreads - 1 << " worker threads.";
+            TsHsMsg(TS_HS_WARNING, "Utilities", msg.str());
+            mNumThreads = i + 1;
+            break;
+        }
+        mWorkers.push_back(thread);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tells the worker threads to exit and waits for them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuParallelLdu::stopWorkers()
+{
+    if (mWorkers.empty()) {
+        return;
+    }
+    pthread_mutex_lock(&mMutex);
+    mStopping = true;
+    pthread_cond_broadcast(&mWorkReady);
+    pthread_mutex_unlock(&mMutex);
+
+    for (unsigned int i = 0; i < mWorkers.size(); ++i) {
+        pthread_join(mWorkers[i], NULL);
+    }
+    mWorkers.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] task  (--) Identifies the work to the derived class runRows method.
+/// @param[in] begin (--) First row to process.
+/// @param[in] end   (--) One past the last row to process.
+///
+/// @details  Hands the rows to the worker threads, helps process them on this thread, and waits for
+///           all of them to finish.  The rows are taken in chunks of about a quarter of each thread's
+///           share, so threads that finish early take more of the rows left.  The runRows method
+///           must not throw when called from here, since the worker threads have no one to catch it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuParallelLdu::parallelRows(const int task, const int begin, const int end)
+{
+    const int count = end - begin;
+    if (mNumThreads < 2 or count < 2 * mNumThreads) {
+        runRows(task, begin, end);
+        return;
+    }
+    if (mWorkers.empty()) {
+        startWorkers();
+    }
+
+    pthread_mutex_lock(&mMutex);
+    mWorking     = true;
+    mWorkTask    = task;
+    mWorkNext    = begin;
+    mWorkEnd     = end;
+    mWorkChunk   = std::max(1, count / (4 * mNumThreads));
+    mWorkPending = count;
+    ++mGeneration;
+    pthread_cond_broadcast(&mWorkReady);
+
+    runShare();
+    while (mWorkPending > 0) {
+        pthread_cond_wait(&mWorkDone, &mMutex);
+    }
+    mWorking = false;
+    pthread_mutex_unlock(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Takes the next chunk of rows of the current work and runs it, until none are left.
+///           The mutex must be locked on entry, and is locked on exit, but is released while
+///           running.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuParallelLdu::runShare()
+{
+    while (mWorking and mWorkNext < mWorkEnd) {
+        const int task  = mWorkTask;
+        const int begin = mWorkNext;
+        const int end   = std::min(mWorkEnd, begin + mWorkChunk);
+        mWorkNext = end;
+        pthread_mutex_unlock(&mMutex);
+
+        runRows(task, begin, end);
+
+        pthread_mutex_lock(&mMutex);
+        mWorkPending -= end - begin;
+        if (0 == mWorkPending) {
+            pthread_cond_signal(&mWorkDone);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Worker thread main loop.  Waits for each new work and helps run it, until told to stop.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuParallelLdu::runWorker()
+{
+    pthread_mutex_lock(&mMutex);
+    unsigned int generation = mGeneration;
+    for (;;) {
+        while (not mStopping and generation == mGeneration) {
+            pthread_cond_wait(&mWorkReady, &mMutex);
+        }
+        if (mStopping) {
+            break;
+        }
+        generation = mGeneration;
+        runShare();
+    }
+    pthread_mutex_unlock(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] ldu (--) Pointer to the CpuParallelLdu.
+///
+/// @returns  void* (--) Always NULL.
+///
+/// @details  Worker thread entry point, runs the worker main loop.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* CpuParallelLdu::workerEntry(void* ldu)
+{
+    static_cast<CpuParallelLdu*>(ldu)->runWorker();
+    return NULL;
+}
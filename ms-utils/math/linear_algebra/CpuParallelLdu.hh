@@ -0,0 +1,121 @@
+#ifndef CpuParallelLdu_EXISTS
+#define CpuParallelLdu_EXISTS
+
+/**
+@file
+@brief    CPU Parallel LDU Decomposition declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_CPU_PARALLEL CPU Parallel LDU Decomposition
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (This is the base class for the CPU decompositions that stand in for the CUDA GPU solvers when
+   GUNNS is built without CUDA.  It keeps a pool of worker threads that share ranges of matrix rows
+   with the caller's thread.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Only one thread calls the decomposition methods at a time.)
+
+LIBRARY_DEPENDENCY:
+- ((CpuParallelLdu.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "math/linear_algebra/CholeskyLdu.hh"
+#include <pthread.h>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    CPU Parallel LDU Decomposition base class
+///
+/// @details  Derived classes call parallelRows to have a range of rows processed by their runRows
+///           method, split into chunks that the worker threads and the caller's thread take in turn
+///           until none are left.  Worker threads are started on the first parallel call and kept
+///           waiting between calls.  Ranges too small to be worth sharing are run on the caller's
+///           thread alone.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class CpuParallelLdu : public CholeskyLdu
+{
+    public:
+        /// @brief Default constructor.
+        CpuParallelLdu(const int numThreads = 1);
+        /// @brief Default destructor.
+        virtual ~CpuParallelLdu();
+        /// @brief Sets the number of threads to use, including the caller's thread.
+        void setNumThreads(const int numThreads);
+        /// @brief Returns the number of threads to use, including the caller's thread.
+        int  getNumThreads() const;
+        /// @brief Returns the number of worker threads running.
+        int  getNumWorkers() const;
+
+    protected:
+        /// @brief Processes the given rows for the given task, called from any of the threads.
+        virtual void runRows(const int task, const int begin, const int end) = 0;
+        /// @brief Processes the rows in [begin, end) for the given task, shared among the threads.
+        void parallelRows(const int task, const int begin, const int end);
+
+    private:
+        int                    mNumThreads;   /**< (--) Number of threads to use, including the caller's. */
+        std::vector<pthread_t> mWorkers;      /**< (--) Worker threads. */
+        pthread_mutex_t        mMutex;        /**< (--) Guards the work state below. */
+        pthread_cond_t         mWorkReady;    /**< (--) Signals the workers that work is ready. */
+        pthread_cond_t         mWorkDone;     /**< (--) Signals the caller that the work is done. */
+        unsigned int           mGeneration;   /**< (--) Count of work handed to the workers. */
+        bool                   mStopping;     /**< (--) Tells the workers to exit. */
+        bool                   mWorking;      /**< (--) Work is being shared. */
+        int                    mWorkTask;     /**< (--) The task being run. */
+        int                    mWorkNext;     /**< (--) Next row to be taken. */
+        int                    mWorkEnd;      /**< (--) End of the row range. */
+        int                    mWorkChunk;    /**< (--) Number of rows taken at a time. */
+        int                    mWorkPending;  /**< (--) Number of rows not finished yet. */
+        /// @brief Starts the worker threads.
+        void         startWorkers();
+        /// @brief Tells the worker threads to exit and waits for them.
+        void         stopWorkers();
+        /// @brief Takes chunks of the current work and runs them until none are left.
+        void         runShare();
+        /// @brief Worker thread main loop.
+        void         runWorker();
+        /// @brief Worker thread entry point.
+        static void* workerEntry(void* ldu);
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        CpuParallelLdu(const CpuParallelLdu& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        CpuParallelLdu& operator =(const CpuParallelLdu&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of threads to use, including the caller's thread.
+///
+/// @details  Returns the number of threads to use, including the caller's thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int CpuParallelLdu::getNumThreads() const
+{
+    return mNumThreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of worker threads running.
+///
+/// @details  Returns the number of worker threads running, which is zero until the first parallel
+///           call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int CpuParallelLdu::getNumWorkers() const
+{
+    return static_cast<int>(mWorkers.size());
+}
+
+#endif
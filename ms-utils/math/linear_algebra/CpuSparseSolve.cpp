@@ -0,0 +1,273 @@
+/**
+@file
+@brief    CPU Sparse System Solution implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+     ((math/linear_algebra/CholeskyLdu.o)
+      (software/exceptions/TsNumericalException.o))
+*/
+
+#include "CpuSparseSolve.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <algorithm>
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this CPU Sparse System Solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CpuSparseSolve::CpuSparseSolve()
+    :
+    CholeskyLdu(),
+    mN(0),
+    mRowStart(),
+    mColumns(),
+    mScanStart(),
+    mScanColumns(),
+    mOrder(),
+    mPosition(),
+    mFirst(),
+    mEnvStart(),
+    mEnvelope(),
+    mInverseD(),
+    mWork()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this CPU Sparse System Solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CpuSparseSolve::~CpuSparseSolve()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) Pointer to the first element of the matrix A[n][n].
+/// @param[in] n (--) The number of rows and/or columns of the matrix A.
+///
+/// @details  Copies the lower triangle of [A] into the reordered envelope, recomputing the order
+///           first if the size or pattern of nonzeros has changed since the last call.  [A] itself
+///           is not changed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuSparseSolve::Decompose(double *A, int n)
+{
+    scanPattern(A, n);
+    if (n != mN or mScanStart != mRowStart or mScanColumns != mColumns) {
+        mN = n;
+        mRowStart.swap(mScanStart);
+        mColumns.swap(mScanColumns);
+        computeOrder();
+    }
+
+    std::fill(mEnvelope.begin(), mEnvelope.end(), 0.0);
+    for (int i = 0; i < n; ++i) {
+        const int     row    = mPosition[i];
+        const double* rowA   = A + i * n;
+        mEnvelope[mEnvStart[row] + row - mFirst[row]] = rowA[i];
+        for (int k = mRowStart[i]; k < mRowStart[i + 1]; ++k) {
+            const int col = mPosition[mColumns[k]];
+            const int r   = std::max(row, col);
+            const int c   = std::min(row, col);
+            mEnvelope[mEnvStart[r] + c - mFirst[r]] = rowA[mColumns[k]];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  LDU (--) Not used, the envelope from the last Decompose call is used instead.
+/// @param[in]  B   (--) The {b} vector.
+/// @param[out] x   (--) The solution {x} vector.
+/// @param[in]  n   (--) The number of rows and/or columns of the matrix.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Decomposes the envelope by Cholesky's LDU method, row by row, then solves for {x} by
+///           forward and back substitution in the reordered rows.  Throws an exception with the
+///           failing original row if a diagonal factor isn't positive.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuSparseSolve::Solve(double *LDU __attribute__((unused)), double B[], double x[], int n)
+{
+    if (n != mN) {
+        throw(TsNumericalException("", "CpuSparseSolve::Solve", "matrix size differs from Decompose"));
+    }
+
+    if (n < 1) {
+        return;
+    }
+
+    /// - Decompose the envelope.  Each row i first holds L[i][j]*D[j], then is scaled to L[i][j]
+    ///   once its diagonal is found.  Only the overlap of two rows' envelopes contributes to their
+    ///   product.  Entry [i][j] of the envelope is at env[row + j], with row offset by the row's
+    ///   first column.
+    double* env = &mEnvelope[0];
+    for (int i = 0; i < n; ++i) {
+        const int first = mFirst[i];
+        const int rowI  = mEnvStart[i] - first;
+        for (int j = first; j < i; ++j) {
+            const int rowJ = mEnvStart[j] - mFirst[j];
+            double sum = env[rowI + j];
+            for (int k = std::max(first, mFirst[j]); k < j; ++k) {
+                sum -= env[rowI + k] * env[rowJ + k];
+            }
+            env[rowI + j] = sum;
+        }
+        double d = env[rowI + i];
+        for (int k = first; k < i; ++k) {
+            const double l = env[rowI + k] * mInverseD[k];
+            d            -= env[rowI + k] * l;
+            env[rowI + k] = l;
+        }
+        if (not (d > 0.0)) {
+            std::ostringstream msg;
+            msg << "failed at row " << mOrder[i];
+            throw(TsNumericalException("", "CpuSparseSolve::Solve", msg.str()));
+        }
+        env[rowI + i] = d;
+        mInverseD[i]  = 1.0 / d;
+    }
+
+    /// - Solve [L]{y} = {b} in the reordered rows, then divide by [D].
+    for (int i = 0; i < n; ++i) {
+        const int rowI = mEnvStart[i] - mFirst[i];
+        double sum = B[mOrder[i]];
+        for (int k = mFirst[i]; k < i; ++k) {
+            sum -= env[rowI + k] * mWork[k];
+        }
+        mWork[i] = sum;
+    }
+    for (int i = 0; i < n; ++i) {
+        mWork[i] *= mInverseD[i];
+    }
+
+    /// - Solve [U]{x} = {y} going up the rows, where [U] is the transpose of [L], so each row of [L]
+    ///   is applied as a column of [U].
+    for (int i = n - 1; i > 0; --i) {
+        const int rowI = mEnvStart[i] - mFirst[i];
+        for (int k = mFirst[i]; k < i; ++k) {
+            mWork[k] -= env[rowI + k] * mWork[i];
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        x[mOrder[i]] = mWork[i];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) Pointer to the first element of the matrix A[n][n].
+/// @param[in] n (--) The number of rows and/or columns of the matrix A.
+///
+/// @details  Finds the columns of the nonzero off-diagonal entries in each row of the lower triangle
+///           of [A], in compressed row form.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuSparseSolve::scanPattern(const double *A, const int n)
+{
+    mScanStart.resize(n + 1);
+    mScanColumns.clear();
+    for (int i = 0; i < n; ++i) {
+        mScanStart[i] = static_cast<int>(mScanColumns.size());
+        const double* rowA = A + i * n;
+        for (int j = 0; j < i; ++j) {
+            if (0.0 != rowA[j]) {
+                mScanColumns.push_back(j);
+            }
+        }
+    }
+    mScanStart[n] = static_cast<int>(mScanColumns.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Computes the reverse Cuthill-McKee order of the rows from the pattern of nonzeros, then
+///           the envelope of the reordered lower triangle.  Each connected group of rows is ordered
+///           by a breadth-first search starting from its row with the fewest neighbors, visiting
+///           each row's neighbors in order of increasing number of neighbors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CpuSparseSolve::computeOrder()
+{
+    const int n = mN;
+
+    /// - Build the symmetric neighbor lists from the lower triangle.
+    std::vector<int> degree(n, 0);
+    for (int i = 0; i < n; ++i) {
+        for (int k = mRowStart[i]; k < mRowStart[i + 1]; ++k) {
+            ++degree[i];
+            ++degree[mColumns[k]];
+        }
+    }
+    std::vector<int> adjStart(n + 1, 0);
+    for (int i = 0; i < n; ++i) {
+        adjStart[i + 1] = adjStart[i] + degree[i];
+    }
+    std::vector<int> adjacent(adjStart[n]);
+    std::vector<int> fill(adjStart.begin(), adjStart.end() - 1);
+    for (int i = 0; i < n; ++i) {
+        for (int k = mRowStart[i]; k < mRowStart[i + 1]; ++k) {
+            const int j = mColumns[k];
+            adjacent[fill[i]++] = j;
+            adjacent[fill[j]++] = i;
+        }
+    }
+
+    /// - Cuthill-McKee breadth-first search over each connected group.
+    mOrder.clear();
+    mOrder.reserve(n);
+    std::vector<bool> visited(n, false);
+    std::vector<std::pair<int, int> > neighbors;
+    while (static_cast<int>(mOrder.size()) < n) {
+        int start = -1;
+        for (int i = 0; i < n; ++i) {
+            if (not visited[i] and (start < 0 or degree[i] < degree[start])) {
+                start = i;
+            }
+        }
+        visited[start] = true;
+        unsigned int head = static_cast<unsigned int>(mOrder.size());
+        mOrder.push_back(start);
+        for (; head < mOrder.size(); ++head) {
+            const int row = mOrder[head];
+            neighbors.clear();
+            for (int k = adjStart[row]; k < adjStart[row + 1]; ++k) {
+                if (not visited[adjacent[k]]) {
+                    visited[adjacent[k]] = true;
+                    neighbors.push_back(std::make_pair(degree[adjacent[k]], adjacent[k]));
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            for (unsigned int k = 0; k < neighbors.size(); ++k) {
+                mOrder.push_back(neighbors[k].second);
+            }
+        }
+    }
+
+    /// - Reverse the order, which gives a smaller envelope.
+    std::reverse(mOrder.begin(), mOrder.end());
+    mPosition.resize(n);
+    for (int i = 0; i < n; ++i) {
+        mPosition[mOrder[i]] = i;
+    }
+
+    /// - Find the first column of each reordered row and size the envelope.
+    mFirst.resize(n);
+    for (int i = 0; i < n; ++i) {
+        mFirst[i] = i;
+    }
+    for (int i = 0; i < n; ++i) {
+        for (int k = mRowStart[i]; k < mRowStart[i + 1]; ++k) {
+            const int row = mPosition[i];
+            const int col = mPosition[mColumns[k]];
+            const int r   = std::max(row, col);
+            mFirst[r] = std::min(mFirst[r], std::min(row, col));
+        }
+    }
+    mEnvStart.resize(n + 1);
+    mEnvStart[0] = 0;
+    for (int i = 0; i < n; ++i) {
+        mEnvStart[i + 1] = mEnvStart[i] + i - mFirst[i] + 1;
+    }
+    mEnvelope.resize(mEnvStart[n]);
+    mInverseD.resize(n);
+    mWork.resize(n);
+}
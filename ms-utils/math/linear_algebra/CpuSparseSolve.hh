@@ -0,0 +1,105 @@
+#ifndef CpuSparseSolve_EXISTS
+#define CpuSparseSolve_EXISTS
+
+/**
+@file
+@brief    CPU Sparse System Solution declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_CPU_SPARSE CPU Sparse System Solution
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (This class solves a sparse symmetric positive definite system of linear algebraic equations on
+   the CPU, by an envelope Cholesky LDU factorization after a reverse Cuthill-McKee reordering.  It
+   is the CPU stand-in for CudaSparseSolve when GUNNS is built without CUDA.)
+
+REFERENCE:
+- (George, A. & Liu, J. W., "Computer Solution of Large Sparse Positive Definite Systems",
+   Prentice-Hall, 1981, chapter 4)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The matrix is symmetric and positive definite.)
+- (Each row of the envelope factorization depends on the rows before it, so this runs on the
+   caller's thread.)
+
+LIBRARY_DEPENDENCY:
+- ((CpuSparseSolve.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "math/linear_algebra/CholeskyLdu.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    CPU Sparse System Solution
+///
+/// @details  Like CudaSparseSolve, Decompose only changes [A] into sparse form, and Solve decomposes
+///           the sparse form and solves [A]{x} = {b} for {x}.  The rows are reordered by reverse
+///           Cuthill-McKee to bring the nonzeros of each row close to the diagonal, and the lower
+///           triangle is stored from each row's first nonzero to the diagonal.  The factorization
+///           fills in only within this envelope, so its cost goes with the square of the envelope
+///           width rather than the cube of the matrix size.  The ordering is only recomputed when the
+///           matrix size or pattern of nonzeros changes, which for a network is when its links
+///           connect to different nodes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class CpuSparseSolve : public CholeskyLdu
+{
+    public:
+        /// @brief Default constructor.
+        CpuSparseSolve();
+        /// @brief Default destructor.
+        virtual ~CpuSparseSolve();
+        /// @brief Changes matrix [A] into envelope form but does not decompose it.
+        virtual void Decompose(double *A, int n);
+        /// @brief Decomposes the envelope form of [A] and solves [A]{x} = {b} for {x}.
+        virtual void Solve(double *LDU, double B[], double x[], int n);
+        /// @brief Returns the number of entries in the envelope of the reordered matrix.
+        int          getEnvelopeSize() const;
+
+    protected:
+        int                 mN;           /**< (--) Size of the matrix. */
+        std::vector<int>    mRowStart;    /**< (--) Start of each row's nonzero columns in mColumns. */
+        std::vector<int>    mColumns;     /**< (--) Nonzero columns of the lower triangle of [A]. */
+        std::vector<int>    mScanStart;   /**< (--) Start of each row's columns in the latest scan. */
+        std::vector<int>    mScanColumns; /**< (--) Nonzero columns of the latest scan. */
+        std::vector<int>    mOrder;       /**< (--) Original row of each reordered row. */
+        std::vector<int>    mPosition;    /**< (--) Reordered row of each original row. */
+        std::vector<int>    mFirst;       /**< (--) First column in the envelope of each reordered row. */
+        std::vector<int>    mEnvStart;    /**< (--) Start of each reordered row in mEnvelope. */
+        std::vector<double> mEnvelope;    /**< (--) Envelope of the reordered lower triangle. */
+        std::vector<double> mInverseD;    /**< (--) Inverses of the diagonal factors. */
+        std::vector<double> mWork;        /**< (--) Reordered solution work vector. */
+        /// @brief Finds the pattern of nonzeros in the lower triangle of [A].
+        void scanPattern(const double *A, const int n);
+        /// @brief Computes the reverse Cuthill-McKee order and the envelope.
+        void computeOrder();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        CpuSparseSolve(const CpuSparseSolve& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        CpuSparseSolve& operator =(const CpuSparseSolve&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of entries in the envelope of the reordered matrix.
+///
+/// @details  Returns the number of lower triangle entries, including the diagonal, stored and
+///           factored for the reordered matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int CpuSparseSolve::getEnvelopeSize() const
+{
+    return static_cast<int>(mEnvelope.size());
+}
+
+#endif
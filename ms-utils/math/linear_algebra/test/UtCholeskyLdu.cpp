@@ -5,6 +5,8 @@
 
 #include "UtCholeskyLdu.hh"
 #include "software/exceptions/TsNumericalException.hh"
+#include <cfloat>
+#include <cmath>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this Cholesky Ldu Decomposition unit test.
@@ -480,3 +482,57 @@ void UtCholeskyLdu::testPosOffDiagSolution()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the single-precision decomposition and solution of [A]{x} = {b}, against the
+///           double-precision solution and within single-precision tolerance, and the exceptions for
+///           a non-positive definite matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLdu::testSingleSolution()
+{
+    std::cout << "\n UtCholeskyLdu ..... 08: testSingleSolution .........................";
+
+    const double tolerance = 1.0E-5;
+
+    /// - Solve the same system in double and single precision.
+    double A[16] = { 4.0, -1.0,  0.0, -1.0,
+                    -1.0,  4.0, -1.0,  0.0,
+                     0.0, -1.0,  4.0, -1.0,
+                    -1.0,  0.0, -1.0,  4.0};
+    double b[4]  = { 1.0,  2.0,  3.0,  4.0};
+    double x[4]  = { 0.0,  0.0,  0.0,  0.0};
+    float  As[16];
+    float  bs[4];
+    float  xs[4] = { 0.0F, 0.0F, 0.0F, 0.0F};
+    for (int i = 0; i < 16; ++i) {
+        As[i] = static_cast<float>(A[i]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        bs[i] = static_cast<float>(b[i]);
+    }
+
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(A, 4));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Solve(A, b, x, 4));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.DecomposeSingle(As, 4));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.SolveSingle(As, bs, xs, 4));
+
+    /// - The factors and solution match the double-precision ones within single precision.
+    for (int i = 0; i < 16; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(A[i], As[i], std::max(std::fabs(A[i]) * tolerance, tolerance));
+    }
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(x[i], xs[i], x[i] * tolerance);
+    }
+
+    /// - Test exception thrown from decomposition of a non-positive definite matrix.
+    float Bs[4] = { 1.0F, 2.0F,
+                    2.0F, 1.0F};
+    CPPUNIT_ASSERT_THROW(tArticle.DecomposeSingle(Bs, 2), TsNumericalException);
+
+    /// - Test exception thrown from solution with a zero diagonal.
+    float Cs[4] = { 0.0F, 0.0F,
+                    0.0F, 1.0F};
+    CPPUNIT_ASSERT_THROW(tArticle.SolveSingle(Cs, bs, xs, 2), TsNumericalException);
+
+    std::cout << "... Pass";
+}
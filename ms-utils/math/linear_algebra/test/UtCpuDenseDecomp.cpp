@@ -0,0 +1,237 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((math/linear_algebra/CpuDenseDecomp.o))
+***************************************************************************************************/
+
+#include "UtCpuDenseDecomp.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this CPU Dense Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCpuDenseDecomp::UtCpuDenseDecomp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this CPU Dense Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCpuDenseDecomp::~UtCpuDenseDecomp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuDenseDecomp::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuDenseDecomp::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] A    (--) The matrix to fill, resized to n x n.
+/// @param[in]  rows (--) Number of rows of nodes in the grid.
+/// @param[in]  cols (--) Number of columns of nodes in the grid.
+///
+/// @details  Fills the admittance matrix of a grid of nodes conducting to their neighbors, with some
+///           nodes also conducting to ground.  The nodes are numbered in a scrambled order, so the
+///           nonzeros are scattered as in a network whose nodes aren't numbered by location.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuDenseDecomp::makeNetworkMatrix(std::vector<double>& A, const int rows, const int cols)
+{
+    const int n = rows * cols;
+    A.assign(n * n, 0.0);
+    std::vector<int> node(n);
+    for (int k = 0; k < n; ++k) {
+        node[k] = (k * 37) % n;
+    }
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            const int i = node[r * cols + c];
+            if (0 == (r * cols + c) % 7) {
+                A[i * n + i] += 0.5;
+            }
+            const int neighbors[2][2] = {{r + 1, c}, {r, c + 1}};
+            for (int k = 0; k < 2; ++k) {
+                if (neighbors[k][0] < rows and neighbors[k][1] < cols) {
+                    const int    j = node[neighbors[k][0] * cols + neighbors[k][1]];
+                    const double g = 1.0 + 0.1 * ((r * 31 + c * 17 + k) % 10);
+                    A[i * n + i] += g;
+                    A[j * n + j] += g;
+                    A[i * n + j] -= g;
+                    A[j * n + i] -= g;
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the decomposition of a small matrix gives the same LDU as CholeskyLdu, and
+///           can be used with its Solve.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuDenseDecomp::testDecompose()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtCpuDenseDecomp .. 01: testDecompose ..............................";
+
+    double A[16] = {10.0,     -0.001,    -0.002,    0.0,
+                    -0.001,    8.0,      -0.003,   -0.001,
+                    -0.002,   -0.003,    12.0,      0.0,
+                     0.0,     -0.001,     0.0,      9.0};
+    double C[16];
+    double E[16];
+    for (int i = 0; i < 16; ++i) {
+        C[i] = A[i];
+        E[i] = A[i];
+    }
+    double b[4] = {27.0, 0.03, 0.0, -1.5};
+    double x[4] = { 0.0, 0.0,  0.0,  0.0};
+
+    CholeskyLdu    expected;
+    CpuDenseDecomp article(1);
+    CPPUNIT_ASSERT_NO_THROW(expected.Decompose(E, 4));
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(A, 4));
+    for (int i = 0; i < 16; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(E[i], A[i], 1.0E-15 * std::max(1.0, std::fabs(E[i])));
+    }
+
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(A, b, x, 4));
+    for (int i = 0; i < 4; ++i) {
+        double result = 0.0;
+        for (int j = 0; j < 4; ++j) {
+            result += C[i * 4 + j] * x[j];
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], result, 1.0E-13);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the decomposition of a network matrix spanning several blocks, shared among
+///           threads, gives the same LDU as CholeskyLdu and solves the system.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuDenseDecomp::testParallelDecompose()
+{
+    std::cout << "\n UtCpuDenseDecomp .. 02: testParallelDecompose ......................";
+
+    std::vector<double> A;
+    makeNetworkMatrix(A, 12, 9);
+    const int n = 108;
+    std::vector<double> C(A);
+    std::vector<double> E(A);
+
+    CholeskyLdu    expected;
+    CpuDenseDecomp article(3);
+    CPPUNIT_ASSERT_EQUAL(0, article.getNumWorkers());
+    CPPUNIT_ASSERT_NO_THROW(expected.Decompose(&E[0], n));
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], n));
+    CPPUNIT_ASSERT_EQUAL(2, article.getNumWorkers());
+    for (int i = 0; i < n * n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(E[i], A[i], 1.0E-12 * std::max(1.0, std::fabs(E[i])));
+    }
+
+    /// - Solve with the decomposition and check the residual.
+    std::vector<double> b(n);
+    std::vector<double> x(n, 0.0);
+    for (int i = 0; i < n; ++i) {
+        b[i] = std::sin(0.1 * i);
+    }
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(&A[0], &b[0], &x[0], n));
+    for (int i = 0; i < n; ++i) {
+        double result = 0.0;
+        for (int j = 0; j < n; ++j) {
+            result += C[i * n + j] * x[j];
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], result, 1.0E-10);
+    }
+
+    /// - Decompose again with the same threads.
+    A = C;
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], n));
+    CPPUNIT_ASSERT_EQUAL(2, article.getNumWorkers());
+    for (int i = 0; i < n * n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(E[i], A[i], 1.0E-12 * std::max(1.0, std::fabs(E[i])));
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that an exception is thrown for a matrix that isn't positive definite, in the
+///           first block and in a later block.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuDenseDecomp::testNotPositiveDefinite()
+{
+    std::cout << "\n UtCpuDenseDecomp .. 03: testNotPositiveDefinite ....................";
+
+    CpuDenseDecomp article(2);
+
+    double A[9] = {1.0, -0.1,  0.0,
+                  -0.1,  1.0,  0.0,
+                   0.0,  0.0,  0.0};
+    CPPUNIT_ASSERT_THROW(article.Decompose(A, 3), TsNumericalException);
+
+    /// - Isolate a node with no conductance to ground in a later block.
+    std::vector<double> B;
+    makeNetworkMatrix(B, 8, 6);
+    const int n = 48;
+    const int i = 40;
+    for (int j = 0; j < n; ++j) {
+        B[i * n + j] = 0.0;
+        B[j * n + i] = 0.0;
+    }
+    CPPUNIT_ASSERT_THROW(article.Decompose(&B[0], n), TsNumericalException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests setting the number of threads, and that one thread doesn't start any workers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuDenseDecomp::testNumThreads()
+{
+    std::cout << "\n UtCpuDenseDecomp .. 04: testNumThreads .............................";
+
+    CpuDenseDecomp article(4);
+    CPPUNIT_ASSERT_EQUAL(4, article.getNumThreads());
+
+    /// - Zero threads defaults to the number of processors.
+    article.setNumThreads(0);
+    CPPUNIT_ASSERT(article.getNumThreads() >= 1);
+
+    /// - One thread decomposes on the caller's thread alone.
+    article.setNumThreads(1);
+    CPPUNIT_ASSERT_EQUAL(1, article.getNumThreads());
+    std::vector<double> A;
+    makeNetworkMatrix(A, 12, 9);
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], 108));
+    CPPUNIT_ASSERT_EQUAL(0, article.getNumWorkers());
+
+    /// - Changing the number of threads stops the running workers.
+    article.setNumThreads(2);
+    makeNetworkMatrix(A, 12, 9);
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], 108));
+    CPPUNIT_ASSERT_EQUAL(1, article.getNumWorkers());
+    article.setNumThreads(3);
+    CPPUNIT_ASSERT_EQUAL(0, article.getNumWorkers());
+
+    std::cout << "... Pass";
+}
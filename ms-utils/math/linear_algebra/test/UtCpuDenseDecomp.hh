@@ -0,0 +1,66 @@
+#ifndef UtCpuDenseDecomp_EXISTS
+#define UtCpuDenseDecomp_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILITIES_MATH_LINEAR_ALGEBRA_CPU_DENSE CPU Dense Decomposition Unit Tests
+/// @ingroup  UT_UTILITIES_MATH_LINEAR_ALGEBRA
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the CpuDenseDecomp class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+#include <vector>
+
+#include "math/linear_algebra/CpuDenseDecomp.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Utilities unit tests.
+////
+/// @details  This class provides the unit tests for the CpuDenseDecomp class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtCpuDenseDecomp : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Utilities unit test.
+        UtCpuDenseDecomp();
+        /// @brief    Default destructs this Utilities unit test.
+        virtual ~UtCpuDenseDecomp();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the decomposition matches CholeskyLdu.
+        void testDecompose();
+        /// @brief    Tests the decomposition of a network matrix on multiple threads.
+        void testParallelDecompose();
+        /// @brief    Tests a matrix that isn't positive definite.
+        void testNotPositiveDefinite();
+        /// @brief    Tests setting the number of threads.
+        void testNumThreads();
+    private:
+        CPPUNIT_TEST_SUITE(UtCpuDenseDecomp);
+        CPPUNIT_TEST(testDecompose);
+        CPPUNIT_TEST(testParallelDecompose);
+        CPPUNIT_TEST(testNotPositiveDefinite);
+        CPPUNIT_TEST(testNumThreads);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Fills a network admittance matrix of nodes in a scrambled grid.
+        static void makeNetworkMatrix(std::vector<double>& A, const int rows, const int cols);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtCpuDenseDecomp(const UtCpuDenseDecomp& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtCpuDenseDecomp& operator =(const UtCpuDenseDecomp& that);
+};
+
+///@}
+
+#endif
@@ -0,0 +1,277 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((math/linear_algebra/CpuSparseSolve.o))
+***************************************************************************************************/
+
+#include "UtCpuSparseSolve.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this CPU Sparse System Solution unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCpuSparseSolve::UtCpuSparseSolve()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this CPU Sparse System Solution unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCpuSparseSolve::~UtCpuSparseSolve()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuSparseSolve::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuSparseSolve::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] A    (--) The matrix to fill, resized to n x n.
+/// @param[in]  rows (--) Number of rows of nodes in the grid.
+/// @param[in]  cols (--) Number of columns of nodes in the grid.
+///
+/// @details  Fills the admittance matrix of a grid of nodes conducting to their neighbors, with some
+///           nodes also conducting to ground.  The nodes are numbered in a scrambled order, so the
+///           nonzeros are scattered as in a network whose nodes aren't numbered by location.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuSparseSolve::makeNetworkMatrix(std::vector<double>& A, const int rows, const int cols)
+{
+    const int n = rows * cols;
+    A.assign(n * n, 0.0);
+    std::vector<int> node(n);
+    for (int k = 0; k < n; ++k) {
+        node[k] = (k * 37) % n;
+    }
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            const int i = node[r * cols + c];
+            if (0 == (r * cols + c) % 7) {
+                A[i * n + i] += 0.5;
+            }
+            const int neighbors[2][2] = {{r + 1, c}, {r, c + 1}};
+            for (int k = 0; k < 2; ++k) {
+                if (neighbors[k][0] < rows and neighbors[k][1] < cols) {
+                    const int    j = node[neighbors[k][0] * cols + neighbors[k][1]];
+                    const double g = 1.0 + 0.1 * ((r * 31 + c * 17 + k) % 10);
+                    A[i * n + i] += g;
+                    A[j * n + j] += g;
+                    A[i * n + j] -= g;
+                    A[j * n + i] -= g;
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) The original matrix.
+/// @param[in] x (--) The solution vector.
+/// @param[in] b (--) The right-hand side vector.
+/// @param[in] n (--) The size of the system.
+///
+/// @returns  double (--) The largest residual of [A]{x} - {b}.
+///
+/// @details  Returns the largest residual of the solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static double maxResidual(const std::vector<double>& A, const std::vector<double>& x,
+                          const std::vector<double>& b, const int n)
+{
+    double result = 0.0;
+    for (int i = 0; i < n; ++i) {
+        double sum = -b[i];
+        for (int j = 0; j < n; ++j) {
+            sum += A[i * n + j] * x[j];
+        }
+        result = std::max(result, std::fabs(sum));
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the solution of a small system matches CholeskyLdu.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuSparseSolve::testSolve()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtCpuSparseSolve .. 01: testSolve ..................................";
+
+    double A[16] = {10.0,     -0.001,    -0.002,    0.0,
+                    -0.001,    8.0,      -0.003,   -0.001,
+                    -0.002,   -0.003,    12.0,      0.0,
+                     0.0,     -0.001,     0.0,      9.0};
+    double C[16];
+    for (int i = 0; i < 16; ++i) {
+        C[i] = A[i];
+    }
+    double b[4]        = {27.0, 0.03, 0.0, -1.5};
+    double x[4]        = { 0.0, 0.0,  0.0,  0.0};
+    double expectedX[4] = { 0.0, 0.0,  0.0,  0.0};
+
+    CholeskyLdu    expected;
+    CpuSparseSolve article;
+    CPPUNIT_ASSERT_NO_THROW(expected.Decompose(C, 4));
+    CPPUNIT_ASSERT_NO_THROW(expected.Solve(C, b, expectedX, 4));
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(A, 4));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(A, b, x, 4));
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedX[i], x[i], 1.0E-14 * std::max(1.0, std::fabs(x[i])));
+    }
+
+    /// - Decompose leaves [A] alone.
+    CPPUNIT_ASSERT_EQUAL(10.0,   A[0]);
+    CPPUNIT_ASSERT_EQUAL(-0.001, A[1]);
+    CPPUNIT_ASSERT_EQUAL(9.0,    A[15]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a network matrix is reordered into a small envelope, and its solution
+///           matches CholeskyLdu.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuSparseSolve::testNetworkSolve()
+{
+    std::cout << "\n UtCpuSparseSolve .. 02: testNetworkSolve ...........................";
+
+    std::vector<double> A;
+    makeNetworkMatrix(A, 12, 9);
+    const int n = 108;
+    std::vector<double> C(A);
+    std::vector<double> b(n);
+    std::vector<double> x(n, 0.0);
+    std::vector<double> expectedX(n, 0.0);
+    for (int i = 0; i < n; ++i) {
+        b[i] = std::sin(0.1 * i);
+    }
+
+    CholeskyLdu    expected;
+    CpuSparseSolve article;
+    CPPUNIT_ASSERT_NO_THROW(expected.Decompose(&C[0], n));
+    CPPUNIT_ASSERT_NO_THROW(expected.Solve(&C[0], &b[0], &expectedX[0], n));
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], n));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(&A[0], &b[0], &x[0], n));
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedX[i], x[i], 1.0E-10 * std::max(1.0, std::fabs(x[i])));
+    }
+    CPPUNIT_ASSERT(maxResidual(A, x, b, n) < 1.0E-10);
+
+    /// - The grid is 9 nodes wide, so the reordered envelope is about that wide, much smaller than
+    ///   the full lower triangle.
+    CPPUNIT_ASSERT(article.getEnvelopeSize() < 12 * n);
+    CPPUNIT_ASSERT(article.getEnvelopeSize() < n * (n + 1) / 8);
+
+    /// - Solve again with the same pattern, and verify the second solution is the same.
+    std::vector<double> x2(n, 0.0);
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], n));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(&A[0], &b[0], &x2[0], n));
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_EQUAL(x[i], x2[i]);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that changes in the values and pattern of nonzeros are solved correctly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuSparseSolve::testPatternChange()
+{
+    std::cout << "\n UtCpuSparseSolve .. 03: testPatternChange ..........................";
+
+    std::vector<double> A;
+    makeNetworkMatrix(A, 8, 6);
+    const int n = 48;
+    std::vector<double> b(n);
+    std::vector<double> x(n, 0.0);
+    for (int i = 0; i < n; ++i) {
+        b[i] = 1.0 + 0.01 * i;
+    }
+
+    CpuSparseSolve article;
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], n));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(&A[0], &b[0], &x[0], n));
+    CPPUNIT_ASSERT(maxResidual(A, x, b, n) < 1.0E-11);
+
+    /// - Same pattern with new values.
+    for (int i = 0; i < n * n; ++i) {
+        A[i] *= 2.0;
+    }
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], n));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(&A[0], &b[0], &x[0], n));
+    CPPUNIT_ASSERT(maxResidual(A, x, b, n) < 1.0E-11);
+
+    /// - Disconnect two nodes and connect two others that weren't.
+    int i = 0;
+    int j = 1;
+    while (0.0 == A[i * n + j]) {
+        ++j;
+    }
+    A[i * n + i] += A[i * n + j];
+    A[j * n + j] += A[i * n + j];
+    A[i * n + j]  = 0.0;
+    A[j * n + i]  = 0.0;
+    int k = n - 1;
+    while (0.0 != A[i * n + k]) {
+        --k;
+    }
+    A[i * n + i] += 3.0;
+    A[k * n + k] += 3.0;
+    A[i * n + k]  = -3.0;
+    A[k * n + i]  = -3.0;
+    const int envelope = article.getEnvelopeSize();
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], n));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(&A[0], &b[0], &x[0], n));
+    CPPUNIT_ASSERT(maxResidual(A, x, b, n) < 1.0E-11);
+    CPPUNIT_ASSERT(envelope != article.getEnvelopeSize());
+
+    /// - A smaller matrix.
+    makeNetworkMatrix(A, 5, 3);
+    b.resize(15);
+    x.resize(15);
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&A[0], 15));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(&A[0], &b[0], &x[0], 15));
+    CPPUNIT_ASSERT(maxResidual(A, x, b, 15) < 1.0E-12);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that an exception is thrown for a matrix that isn't positive definite, or a
+///           solution of a different size than was decomposed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCpuSparseSolve::testNotPositiveDefinite()
+{
+    std::cout << "\n UtCpuSparseSolve .. 04: testNotPositiveDefinite ....................";
+
+    CpuSparseSolve article;
+
+    double A[9] = {1.0, -0.1,  0.0,
+                  -0.1,  1.0,  0.0,
+                   0.0,  0.0,  0.0};
+    double b[3] = {9.3, -3.2,  4.5};
+    double x[3] = {0.0,  0.0,  0.0};
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(A, 3));
+    CPPUNIT_ASSERT_THROW(article.Solve(A, b, x, 3), TsNumericalException);
+    CPPUNIT_ASSERT_THROW(article.Solve(A, b, x, 2), TsNumericalException);
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,66 @@
+#ifndef UtCpuSparseSolve_EXISTS
+#define UtCpuSparseSolve_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILITIES_MATH_LINEAR_ALGEBRA_CPU_SPARSE CPU Sparse System Solution Unit Tests
+/// @ingroup  UT_UTILITIES_MATH_LINEAR_ALGEBRA
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the CpuSparseSolve class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+#include <vector>
+
+#include "math/linear_algebra/CpuSparseSolve.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Utilities unit tests.
+////
+/// @details  This class provides the unit tests for the CpuSparseSolve class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtCpuSparseSolve : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Utilities unit test.
+        UtCpuSparseSolve();
+        /// @brief    Default destructs this Utilities unit test.
+        virtual ~UtCpuSparseSolve();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests [A]{x} = {b} matches CholeskyLdu.
+        void testSolve();
+        /// @brief    Tests the reordering and envelope of a network matrix.
+        void testNetworkSolve();
+        /// @brief    Tests a change in the pattern of nonzeros.
+        void testPatternChange();
+        /// @brief    Tests a matrix that isn't positive definite.
+        void testNotPositiveDefinite();
+    private:
+        CPPUNIT_TEST_SUITE(UtCpuSparseSolve);
+        CPPUNIT_TEST(testSolve);
+        CPPUNIT_TEST(testNetworkSolve);
+        CPPUNIT_TEST(testPatternChange);
+        CPPUNIT_TEST(testNotPositiveDefinite);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Fills a network admittance matrix of nodes in a scrambled grid.
+        static void makeNetworkMatrix(std::vector<double>& A, const int rows, const int cols);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtCpuSparseSolve(const UtCpuSparseSolve& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtCpuSparseSolve& operator =(const UtCpuSparseSolve& that);
+};
+
+///@}
+
+#endif
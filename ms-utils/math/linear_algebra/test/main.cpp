@@ -14,6 +14,8 @@ LIBRARY DEPENDENCY:
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "UtCholeskyLdu.hh"
+#include "UtCpuDenseDecomp.hh"
+#include "UtCpuSparseSolve.hh"
 #include "UtSor.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +45,8 @@ int main(int argc, char** argv) {
     CppUnit::TextTestRunner runner;
 
     runner.addTest( UtCholeskyLdu::suite() );
+    runner.addTest( UtCpuDenseDecomp::suite() );
+    runner.addTest( UtCpuSparseSolve::suite() );
     runner.addTest( UtSor::suite() );
 
     runner.run(testresult);
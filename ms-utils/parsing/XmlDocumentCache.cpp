@@ -0,0 +1,321 @@
+/************************************** TRICK HEADER **********************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+   (Provides a cache of parsed TinyXML documents, keyed by file path.  A set of files can be loaded
+    together, in which case the files that need parsing are parsed in parallel on worker threads.
+    Files that are unchanged since they were last loaded are not parsed again.)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   (64-bit FNV-1a hash: http://www.isthe.com/chongo/tech/comp/fnv/)
+
+ASSUMPTIONS AND LIMITATIONS:
+   ()
+
+LIBRARY DEPENDENCY:
+    ((parsing/tinyxml/tinyxml.o))
+
+PROGRAMMERS:
+   ((CACI) (Install) (2026-10))
+***************************************************************************************************/
+#include "XmlDocumentCache.hh"
+#include <algorithm>
+#include <cstdio>
+#include <pthread.h>
+#include <sys/stat.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  maxThreads  (--)  Maximum number of worker threads for loading a list of files.
+///
+/// @details  Default constructs this XML Document Cache.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+XmlDocumentCache::XmlDocumentCache(const unsigned maxThreads)
+    :
+    mMaxThreads(maxThreads),
+    mEntries(),
+    mParseCount(0),
+    mSkipCount(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this XML Document Cache, deleting all cached documents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+XmlDocumentCache::~XmlDocumentCache()
+{
+    clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes all cached documents and entries.  Documents previously returned by find() are
+///           no longer valid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlDocumentCache::clear()
+{
+    for (EntryMap::iterator it = mEntries.begin(); it != mEntries.end(); ++it) {
+        delete it->second->mDoc;
+        delete it->second;
+    }
+    mEntries.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileName  (--)  Path and name of the XML file.
+///
+/// @return     bool  (--)  True if the file was loaded and is a valid XML document.
+///
+/// @details    Loads the given file into the cache on the caller's thread, parsing it only if it has
+///             changed since it was last loaded.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool XmlDocumentCache::load(const std::string& fileName)
+{
+    Entry* entry = getEntry(fileName);
+    refresh(entry);
+    countRefresh(entry);
+    return 0 != entry->mDoc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileNames  (--)  Paths and names of the XML files.
+///
+/// @return     unsigned  (--)  The number of files that were loaded and are valid XML documents.
+///
+/// @details    Loads the given files into the cache, parsing only the files that have changed since
+///             they were last loaded.  Duplicate and empty file names are ignored.  The files are
+///             refreshed in parallel by up to the maximum number of worker threads.  If a worker
+///             thread can't be created, its files are refreshed on the caller's thread instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned XmlDocumentCache::load(const std::vector<std::string>& fileNames)
+{
+    /// - Create the entries up front, on this thread, so the workers don't modify the map.
+    std::vector<Entry*> entries;
+    for (unsigned i = 0; i < fileNames.size(); ++i) {
+        if (fileNames[i].empty()) {
+            continue;
+        }
+        Entry* entry = getEntry(fileNames[i]);
+        bool duplicate = false;
+        for (unsigned j = 0; j < entries.size(); ++j) {
+            duplicate = duplicate or (entries[j] == entry);
+        }
+        if (not duplicate) {
+            entries.push_back(entry);
+        }
+    }
+    if (entries.empty()) {
+        return 0;
+    }
+
+    /// - Start the workers, each with every Nth entry.  The last share is done on this thread.
+    const unsigned count   = static_cast<unsigned>(entries.size());
+    const unsigned workers = std::min(count, std::max(mMaxThreads, 1u));
+    std::vector<Work>      work(workers);
+    std::vector<pthread_t> threads(workers);
+    std::vector<bool>      started(workers, false);
+    for (unsigned i = 0; i < workers; ++i) {
+        work[i].mEntries = &entries[0];
+        work[i].mCount   = count;
+        work[i].mStart   = i;
+        work[i].mStride  = workers;
+    }
+    for (unsigned i = 0; i + 1 < workers; ++i) {
+        started[i] = (0 == pthread_create(&threads[i], NULL, refreshWorker, &work[i]));
+    }
+    for (unsigned i = 0; i < workers; ++i) {
+        if (not started[i]) {
+            refreshWorker(&work[i]);
+        }
+    }
+    for (unsigned i = 0; i < workers; ++i) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    /// - Tally the results in the given order.
+    unsigned valid = 0;
+    for (unsigned i = 0; i < count; ++i) {
+        const Entry* entry = entries[i];
+        countRefresh(entry);
+        if (entry->mDoc) {
+            ++valid;
+        }
+    }
+    return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileName  (--)  Path and name of the XML file.
+///
+/// @return     const TiXmlDocument*  (--)  The parsed document, or null if not loaded or invalid.
+///
+/// @details    Returns the document parsed from the given file when it was last loaded.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const TiXmlDocument* XmlDocumentCache::find(const std::string& fileName) const
+{
+    EntryMap::const_iterator it = mEntries.find(fileName);
+    if (it == mEntries.end()) {
+        return 0;
+    }
+    return it->second->mDoc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  data    (--)  Data to hash.
+/// @param[in]  length  (--)  Number of bytes of data.
+///
+/// @return     uint64_t  (--)  The 64-bit FNV-1a hash of the data.
+///
+/// @details    Returns the 64-bit FNV-1a hash of the given data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t XmlDocumentCache::hash(const char* data, const size_t length)
+{
+    uint64_t result = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; ++i) {
+        result ^= static_cast<unsigned char>(data[i]);
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileName  (--)  Path and name of the XML file.
+///
+/// @return     Entry*  (--)  The cache entry for the file.
+///
+/// @details    Returns the entry for the given file, creating an empty entry if there isn't one.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+XmlDocumentCache::Entry* XmlDocumentCache::getEntry(const std::string& fileName)
+{
+    EntryMap::iterator it = mEntries.find(fileName);
+    if (it != mEntries.end()) {
+        return it->second;
+    }
+    Entry* entry     = new Entry;
+    entry->mFileName = fileName;
+    entry->mModTime  = 0;
+    entry->mSize     = 0;
+    entry->mHash     = 0;
+    entry->mDoc      = 0;
+    entry->mParsed   = false;
+    entry->mSkipped  = false;
+    mEntries[fileName] = entry;
+    return entry;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  entry  (--)  The refreshed cache entry.
+///
+/// @details    Adds the results of the entry's last refresh to the parse and skip counters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlDocumentCache::countRefresh(const Entry* entry)
+{
+    if (entry->mParsed) {
+        ++mParseCount;
+    }
+    if (entry->mSkipped) {
+        ++mSkipCount;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  entry  (--)  The cache entry to refresh.
+///
+/// @details    Refreshes the entry from its file.  If the file's modification time and size are
+///             unchanged, the file isn't read.  Otherwise the file is read and hashed, and if the
+///             hash is unchanged the file isn't parsed.  Otherwise the file is parsed into a new
+///             document, with new lines normalized the same way as TiXmlDocument::LoadFile.  If the
+///             file can't be read or isn't valid XML, the entry is left with no document.  This only
+///             touches the given entry, so it is safe to call from multiple threads on different
+///             entries.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlDocumentCache::refresh(Entry* entry)
+{
+    entry->mParsed  = false;
+    entry->mSkipped = false;
+
+    /// - Invalidate the entry if the file is missing.
+    struct stat status;
+    if (0 != stat(entry->mFileName.c_str(), &status) or not S_ISREG(status.st_mode)) {
+        delete entry->mDoc;
+        entry->mDoc = 0;
+        return;
+    }
+
+    /// - Skip unchanged files without reading them.
+    if (entry->mDoc and status.st_mtime == entry->mModTime and status.st_size == entry->mSize) {
+        entry->mSkipped = true;
+        return;
+    }
+
+    /// - Read the whole file.
+    std::vector<char> buffer(static_cast<size_t>(status.st_size) + 1, 0);
+    FILE* file = fopen(entry->mFileName.c_str(), "rb");
+    size_t length = 0;
+    if (file) {
+        length = fread(&buffer[0], 1, static_cast<size_t>(status.st_size), file);
+        fclose(file);
+    }
+    if (not file or length != static_cast<size_t>(status.st_size)) {
+        delete entry->mDoc;
+        entry->mDoc = 0;
+        return;
+    }
+
+    /// - Skip parsing files whose contents are unchanged, such as files that have been touched.
+    const uint64_t contentHash = hash(&buffer[0], length);
+    entry->mModTime = status.st_mtime;
+    entry->mSize    = status.st_size;
+    if (entry->mDoc and contentHash == entry->mHash) {
+        entry->mSkipped = true;
+        return;
+    }
+    entry->mHash = contentHash;
+
+    /// - Normalize CR and CR+LF new lines to LF, then parse.
+    const char* p = &buffer[0];
+    char*       q = &buffer[0];
+    while (*p) {
+        if ('\r' == *p) {
+            *q++ = '\n';
+            if ('\n' == *++p) {
+                ++p;
+            }
+        } else {
+            *q++ = *p++;
+        }
+    }
+    *q = 0;
+
+    TiXmlDocument* doc = new TiXmlDocument(entry->mFileName);
+    doc->Parse(&buffer[0], 0, TIXML_DEFAULT_ENCODING);
+    entry->mParsed = true;
+    delete entry->mDoc;
+    entry->mDoc = 0;
+    if (doc->Error()) {
+        delete doc;
+    } else {
+        entry->mDoc = doc;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  arg  (--)  Pointer to the worker's Work.
+///
+/// @return     void*  (--)  Always null.
+///
+/// @details    Worker thread entry point.  Refreshes every stride'th entry from the start index.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* XmlDocumentCache::refreshWorker(void* arg)
+{
+    const Work* work = static_cast<const Work*>(arg);
+    for (unsigned i = work->mStart; i < work->mCount; i += work->mStride) {
+        refresh(work->mEntries[i]);
+    }
+    return 0;
+}
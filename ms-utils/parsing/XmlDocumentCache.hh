@@ -0,0 +1,155 @@
+#ifndef XmlDocumentCache_EXISTS
+#define XmlDocumentCache_EXISTS
+/**
+@defgroup TSM_UTILITIES_PARSING_XmlDocumentCache XML document cache
+@ingroup  TSM_UTILITIES_PARSING
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+   (Provides a cache of parsed TinyXML documents, keyed by file path.  A set of files can be loaded
+    together, in which case the files that need parsing are parsed in parallel on worker threads.
+    Files that are unchanged since they were last loaded are not parsed again.)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   (A file is considered unchanged if its modification time and size are the same as when it was
+    last loaded, or if its contents hash to the same value.  The cache is held in memory only, so
+    it saves repeated parsing of the same files within a run, but not across runs.
+    The cached documents must not be modified by users.)
+
+LIBRARY DEPENDENCY:
+   (parsing/XmlDocumentCache.o)
+
+PROGRAMMERS:
+   ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "parsing/tinyxml/tinyxml.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <sys/types.h>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief
+/// Caches parsed XML documents, and parses sets of files in parallel.
+///
+/// @details
+/// Each file path has a cache entry holding the parsed document, and the file modification time,
+/// size and contents hash it was parsed from.  On load, each entry is refreshed: the file is not
+/// read at all if its modification time and size are unchanged, and it is read but not parsed if
+/// its contents hash is unchanged.  Otherwise the document is parsed again and replaces the old
+/// one.
+///
+/// When loading a list of files, entries are created for all of them first, then the entries are
+/// refreshed by a pool of worker threads.  Each worker only touches its own entries, so no locking
+/// is needed.  The resulting documents don't depend on the thread scheduling, so users that walk
+/// the documents in a fixed order get the same results every time.
+///
+/// Documents are returned as const pointers, and remain valid until the next load of the same file
+/// or until the cache is cleared or destroyed.  The caller reports errors, by checking for a null
+/// document return.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class XmlDocumentCache
+{
+    TS_MAKE_SIM_COMPATIBLE(XmlDocumentCache);
+
+    public:
+        /// @brief  Default maximum number of worker threads for loading a list of files.
+        static const unsigned MAX_THREADS = 8;
+        /// @brief  Default constructor.
+        XmlDocumentCache(const unsigned maxThreads = MAX_THREADS);
+        /// @brief  Default destructor.
+        virtual ~XmlDocumentCache();
+        /// @brief  Loads the given file into the cache, parsing it if it has changed.
+        bool load(const std::string& fileName);
+        /// @brief  Loads the given files into the cache, parsing the changed files in parallel.
+        unsigned load(const std::vector<std::string>& fileNames);
+        /// @brief  Returns the parsed document for the given file, or null if not loaded or invalid.
+        const TiXmlDocument* find(const std::string& fileName) const;
+        /// @brief  Deletes all cached documents.
+        void clear();
+        /// @brief  Returns the number of times a file has been parsed.
+        unsigned getParseCount() const;
+        /// @brief  Returns the number of times parsing a file was skipped because it was unchanged.
+        unsigned getSkipCount() const;
+        /// @brief  Returns the 64-bit FNV-1a hash of the given data.
+        static uint64_t hash(const char* data, const size_t length);
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief  A cache entry for one file.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        struct Entry {
+            std::string    mFileName; /**< (--) Path and name of the file. */
+            time_t         mModTime;  /**< (s)  File modification time when last loaded. */
+            off_t          mSize;     /**< (--) File size in bytes when last loaded. */
+            uint64_t       mHash;     /**< (--) Hash of the file contents when last loaded. */
+            TiXmlDocument* mDoc;      /**< (--) Parsed document, or null if the file is invalid. */
+            bool           mParsed;   /**< (--) The last refresh parsed the file. */
+            bool           mSkipped;  /**< (--) The last refresh found the file unchanged. */
+        };
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief  Worker thread arguments: the worker refreshes entries start, start + stride, etc.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        struct Work {
+            Entry**  mEntries; /**< (--) Entries to refresh. */
+            unsigned mCount;   /**< (--) Number of entries. */
+            unsigned mStart;   /**< (--) Index of this worker's first entry. */
+            unsigned mStride;  /**< (--) Number of workers. */
+        };
+        typedef std::map<std::string, Entry*> EntryMap;
+        unsigned mMaxThreads; /**< (--) trick_chkpnt_io(**) Maximum number of worker threads. */
+        EntryMap mEntries;    /**< ** (--) trick_chkpnt_io(**) Cache entries by file name. */
+        unsigned mParseCount; /**< (--) trick_chkpnt_io(**) Number of times a file has been parsed. */
+        unsigned mSkipCount;  /**< (--) trick_chkpnt_io(**) Number of unchanged file loads. */
+        /// @brief  Returns the entry for the given file, creating it if needed.
+        Entry* getEntry(const std::string& fileName);
+        /// @brief  Adds the results of an entry's last refresh to the counters.
+        void countRefresh(const Entry* entry);
+        /// @brief  Refreshes an entry from its file, parsing the file if it has changed.
+        static void refresh(Entry* entry);
+        /// @brief  Worker thread entry point.
+        static void* refreshWorker(void* arg);
+
+    private:
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        XmlDocumentCache(const XmlDocumentCache&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        XmlDocumentCache& operator =(const XmlDocumentCache&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   unsigned  (--)  Number of times a file has been parsed.
+///
+/// @details  Returns the number of times a file has been parsed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned XmlDocumentCache::getParseCount() const
+{
+    return mParseCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   unsigned  (--)  Number of times parsing a file was skipped because it was unchanged.
+///
+/// @details  Returns the number of times parsing a file was skipped because it was unchanged.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned XmlDocumentCache::getSkipCount() const
+{
+    return mSkipCount;
+}
+
+#endif
@@ -0,0 +1,215 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((parsing/XmlDocumentCache.o))
+***************************************************************************************************/
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <utime.h>
+#include "parsing/XmlDocumentCache.hh"
+#include "UtXmlDocumentCache.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this XmlDocumentCache unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtXmlDocumentCache::UtXmlDocumentCache()
+    :
+    CppUnit::TestFixture(),
+    tFiles()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this XmlDocumentCache unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtXmlDocumentCache::~UtXmlDocumentCache()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlDocumentCache::setUp()
+{
+    tFiles.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.  Deletes the test
+///           files.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlDocumentCache::tearDown()
+{
+    for (unsigned i = 0; i < tFiles.size(); ++i) {
+        remove(tFiles[i].c_str());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileName  (--)  Name of the test file.
+/// @param[in]  contents  (--)  Contents of the test file.
+/// @param[in]  modTime   (s)   Modification time to give the file.
+///
+/// @details  Writes a test file and sets its modification time, so that tests don't depend on the
+///           file system time resolution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlDocumentCache::writeFile(const std::string& fileName, const std::string& contents,
+                                   const long modTime)
+{
+    FILE* file = fopen(fileName.c_str(), "wb");
+    CPPUNIT_ASSERT(0 != file);
+    fwrite(contents.c_str(), 1, contents.size(), file);
+    fclose(file);
+    struct utimbuf times;
+    times.actime  = modTime;
+    times.modtime = modTime;
+    utime(fileName.c_str(), &times);
+    tFiles.push_back(fileName);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests loading valid, invalid and missing files.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlDocumentCache::testLoad()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n XmlDocumentCache 01: Testing load of valid & invalid files .............";
+
+    XmlDocumentCache article;
+    writeFile("UtXmlDocumentCache_valid.xml", "<?xml version=\"1.0\" ?>\r\n<list>\r\n<a>1</a>\r<a>2</a>\n</list>\n", 1000);
+    writeFile("UtXmlDocumentCache_invalid.xml", "<list><a>1</b></list>", 1000);
+    writeFile("UtXmlDocumentCache_empty.xml", "", 1000);
+
+    /// @test  A valid file is parsed and its document found, with new lines normalized.
+    CPPUNIT_ASSERT(article.load("UtXmlDocumentCache_valid.xml"));
+    const TiXmlDocument* doc = article.find("UtXmlDocumentCache_valid.xml");
+    CPPUNIT_ASSERT(0 != doc);
+    const TiXmlElement* elem = doc->FirstChildElement("list")->FirstChildElement("a");
+    CPPUNIT_ASSERT_EQUAL(std::string("1"), std::string(elem->GetText()));
+    CPPUNIT_ASSERT_EQUAL(std::string("2"), std::string(elem->NextSiblingElement("a")->GetText()));
+    CPPUNIT_ASSERT_EQUAL(std::string("UtXmlDocumentCache_valid.xml"), std::string(doc->Value()));
+    CPPUNIT_ASSERT_EQUAL(1u, article.getParseCount());
+
+    /// @test  Ill-formed, empty and missing files have no document.
+    CPPUNIT_ASSERT(not article.load("UtXmlDocumentCache_invalid.xml"));
+    CPPUNIT_ASSERT(0 == article.find("UtXmlDocumentCache_invalid.xml"));
+    CPPUNIT_ASSERT(not article.load("UtXmlDocumentCache_empty.xml"));
+    CPPUNIT_ASSERT(0 == article.find("UtXmlDocumentCache_empty.xml"));
+    CPPUNIT_ASSERT(not article.load("UtXmlDocumentCache_missing.xml"));
+    CPPUNIT_ASSERT(0 == article.find("UtXmlDocumentCache_missing.xml"));
+    CPPUNIT_ASSERT(0 == article.find("UtXmlDocumentCache_never_loaded.xml"));
+
+    /// @test  Clear removes the documents.
+    article.clear();
+    CPPUNIT_ASSERT(0 == article.find("UtXmlDocumentCache_valid.xml"));
+
+    /// @test  Hash of known data.
+    CPPUNIT_ASSERT(14695981039346656037ULL == XmlDocumentCache::hash("", 0));
+    CPPUNIT_ASSERT(0xaf63dc4c8601ec8cULL   == XmlDocumentCache::hash("a", 1));
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that unchanged files aren't parsed again, and changed files are.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlDocumentCache::testChangeDetection()
+{
+    std::cout << "\n XmlDocumentCache 02: Testing change detection .........................";
+
+    XmlDocumentCache article;
+    const std::string fileName = "UtXmlDocumentCache_change.xml";
+    writeFile(fileName, "<list><a>1</a></list>", 1000);
+    CPPUNIT_ASSERT(article.load(fileName));
+    const TiXmlDocument* doc = article.find(fileName);
+
+    /// @test  Same time and size isn't parsed again, and keeps the same document.
+    CPPUNIT_ASSERT(article.load(fileName));
+    CPPUNIT_ASSERT_EQUAL(1u, article.getParseCount());
+    CPPUNIT_ASSERT_EQUAL(1u, article.getSkipCount());
+    CPPUNIT_ASSERT(doc == article.find(fileName));
+
+    /// @test  A touched file with the same contents isn't parsed again.
+    writeFile(fileName, "<list><a>1</a></list>", 2000);
+    CPPUNIT_ASSERT(article.load(fileName));
+    CPPUNIT_ASSERT_EQUAL(1u, article.getParseCount());
+    CPPUNIT_ASSERT_EQUAL(2u, article.getSkipCount());
+    CPPUNIT_ASSERT(doc == article.find(fileName));
+
+    /// @test  Changed contents of the same size are parsed again.
+    writeFile(fileName, "<list><a>2</a></list>", 3000);
+    CPPUNIT_ASSERT(article.load(fileName));
+    CPPUNIT_ASSERT_EQUAL(2u, article.getParseCount());
+    doc = article.find(fileName);
+    CPPUNIT_ASSERT_EQUAL(std::string("2"),
+                         std::string(doc->FirstChildElement("list")->FirstChildElement("a")->GetText()));
+
+    /// @test  A file changed to ill-formed loses its document, and gets it back when fixed.
+    writeFile(fileName, "<list><a>2</a></lis>", 3000);
+    CPPUNIT_ASSERT(not article.load(fileName));
+    CPPUNIT_ASSERT(0 == article.find(fileName));
+    writeFile(fileName, "<list><a>2</a></list>", 3000);
+    CPPUNIT_ASSERT(article.load(fileName));
+    CPPUNIT_ASSERT(0 != article.find(fileName));
+
+    /// @test  A deleted file loses its document.
+    remove(fileName.c_str());
+    CPPUNIT_ASSERT(not article.load(fileName));
+    CPPUNIT_ASSERT(0 == article.find(fileName));
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests loading a list of files in parallel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlDocumentCache::testParallelLoad()
+{
+    std::cout << "\n XmlDocumentCache 03: Testing parallel load of a file list .............";
+
+    /// - Make more files than worker threads, with one invalid file and a duplicate.
+    XmlDocumentCache article(3);
+    std::vector<std::string> fileNames;
+    const unsigned numFiles = 10;
+    for (unsigned i = 0; i < numFiles; ++i) {
+        std::ostringstream name;
+        name << "UtXmlDocumentCache_list" << i << ".xml";
+        std::ostringstream contents;
+        contents << "<list><a>" << i << "</a></list>";
+        writeFile(name.str(), (5 == i) ? "<list>" : contents.str(), 1000);
+        fileNames.push_back(name.str());
+    }
+    fileNames.push_back(fileNames[0]);
+    fileNames.push_back("");
+
+    /// @test  All files are parsed once, and each has its own contents.
+    CPPUNIT_ASSERT_EQUAL(numFiles - 1, article.load(fileNames));
+    CPPUNIT_ASSERT_EQUAL(numFiles, article.getParseCount());
+    for (unsigned i = 0; i < numFiles; ++i) {
+        const TiXmlDocument* doc = article.find(fileNames[i]);
+        if (5 == i) {
+            CPPUNIT_ASSERT(0 == doc);
+        } else {
+            std::ostringstream text;
+            text << i;
+            CPPUNIT_ASSERT(0 != doc);
+            CPPUNIT_ASSERT_EQUAL(text.str(),
+                    std::string(doc->FirstChildElement("list")->FirstChildElement("a")->GetText()));
+        }
+    }
+
+    /// @test  Loading again skips the valid files and retries the invalid one.
+    CPPUNIT_ASSERT_EQUAL(numFiles - 1, article.load(fileNames));
+    CPPUNIT_ASSERT_EQUAL(numFiles + 1, article.getParseCount());
+    CPPUNIT_ASSERT_EQUAL(numFiles - 1, article.getSkipCount());
+
+    /// @test  Empty list.
+    CPPUNIT_ASSERT_EQUAL(0u, article.load(std::vector<std::string>()));
+
+    std::cout << " Pass";
+}
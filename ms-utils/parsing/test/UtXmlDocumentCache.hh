@@ -0,0 +1,65 @@
+#ifndef UtXmlDocumentCache_EXISTS
+#define UtXmlDocumentCache_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup  UT_TSM_UTILITIES_PARSING_XmlDocumentCache    XmlDocumentCache Unit Tests
+/// @ingroup   UT_TSM_UTILITIES_PARSING
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details   Unit Tests for the XmlDocumentCache class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    XmlDocumentCache unit tests.
+///
+/// @details  This class provides the unit tests for the XmlDocumentCache class within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtXmlDocumentCache : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this XmlDocumentCache unit test.
+        UtXmlDocumentCache();
+        /// @brief    Default destructs this XmlDocumentCache unit test.
+        virtual ~UtXmlDocumentCache();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief  Tests loading valid, invalid and missing files.
+        void testLoad();
+        /// @brief  Tests that unchanged files aren't parsed again, and changed files are.
+        void testChangeDetection();
+        /// @brief  Tests loading a list of files in parallel.
+        void testParallelLoad();
+    private:
+        CPPUNIT_TEST_SUITE(UtXmlDocumentCache);
+        CPPUNIT_TEST(testLoad);
+        CPPUNIT_TEST(testChangeDetection);
+        CPPUNIT_TEST(testParallelLoad);
+        CPPUNIT_TEST_SUITE_END();
+
+        std::vector<std::string> tFiles; /**< (--) Names of the test files written by the tests */
+
+        /// @brief  Writes a test file and sets its modification time.
+        void writeFile(const std::string& fileName, const std::string& contents, const long modTime);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtXmlDocumentCache(const UtXmlDocumentCache&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtXmlDocumentCache& operator =(const UtXmlDocumentCache&);
+};
+
+///@}
+
+#endif
@@ -9,6 +9,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "UtParseTool.hh"
+#include "UtXmlDocumentCache.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  not used
@@ -37,6 +38,7 @@ int main(int argc, char** argv) {
     CppUnit::TextTestRunner runner;
 
     runner.addTest(UtParseTool::suite());
+    runner.addTest(UtXmlDocumentCache::suite());
 
     runner.run(testresult);
     // Output results in compiler format
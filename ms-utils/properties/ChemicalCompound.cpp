@@ -22,6 +22,7 @@
  **************************************************************************************************/
 
 #include "ChemicalCompound.hh"
+#include <pthread.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  type                (--)     Type of Chemical Compound
@@ -170,3 +171,27 @@ DefinedChemicalCompounds::~DefinedChemicalCompounds()
 {
     // nothing to do
 }
+
+/// - The shared Defined Chemical Compounds and its one-time construction control.
+static pthread_once_t            sharedChemicalCompoundsOnce = PTHREAD_ONCE_INIT;
+static DefinedChemicalCompounds* sharedChemicalCompounds     = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Constructs the shared Defined Chemical Compounds, called only once by getInstance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void createSharedChemicalCompounds()
+{
+    sharedChemicalCompounds = new DefinedChemicalCompounds();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   const DefinedChemicalCompounds* (--) Pointer to the shared Defined Chemical Compounds.
+///
+/// @details  Returns the Defined Chemical Compounds shared across the process, constructing it
+///           on the first call, the same way as DefinedFluidProperties::getInstance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const DefinedChemicalCompounds* DefinedChemicalCompounds::getInstance()
+{
+    pthread_once(&sharedChemicalCompoundsOnce, createSharedChemicalCompounds);
+    return sharedChemicalCompounds;
+}
@@ -124,6 +124,8 @@ public:
     DefinedChemicalCompounds();
     /// @brief    Default destructs this Defined Chemical Compounds.
     virtual ~DefinedChemicalCompounds();
+    /// @brief    Returns the shared Defined Chemical Compounds, constructed on first use.
+    static const DefinedChemicalCompounds* getInstance();
     /// @brief    Returns a pointer to the specified Chemical Compound.
     const ChemicalCompound* getCompound(const ChemicalCompound::Type& type) const;
     static const int mNThermoCoeff = 7;              /**< (--) Number of Thermodynamic Coefficients. */
@@ -22,6 +22,7 @@
  **************************************************************************************************/
 
 #include "ChemicalReaction.hh"
+#include <pthread.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  type               --      Type of Chemical Reaction
@@ -136,3 +137,27 @@ DefinedChemicalReactions::~DefinedChemicalReactions()
 {
     // nothing to do
 }
+
+/// - The shared Defined Chemical Reactions and its one-time construction control.
+static pthread_once_t            sharedChemicalReactionsOnce = PTHREAD_ONCE_INIT;
+static DefinedChemicalReactions* sharedChemicalReactions     = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Constructs the shared Defined Chemical Reactions, called only once by getInstance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void createSharedChemicalReactions()
+{
+    sharedChemicalReactions = new DefinedChemicalReactions();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   const DefinedChemicalReactions* (--) Pointer to the shared Defined Chemical Reactions.
+///
+/// @details  Returns the Defined Chemical Reactions shared across the process, constructing it
+///           on the first call, the same way as DefinedFluidProperties::getInstance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const DefinedChemicalReactions* DefinedChemicalReactions::getInstance()
+{
+    pthread_once(&sharedChemicalReactionsOnce, createSharedChemicalReactions);
+    return sharedChemicalReactions;
+}
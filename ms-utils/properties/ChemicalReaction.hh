@@ -113,6 +113,8 @@ class DefinedChemicalReactions {
         DefinedChemicalReactions();
         /// @brief    Default destructs this Defined Chemical Reactions.
         virtual ~DefinedChemicalReactions();
+        /// @brief    Returns the shared Defined Chemical Reactions, constructed on first use.
+        static const DefinedChemicalReactions* getInstance();
         /// @brief    Returns a pointer to the specified Chemical Reaction.
         const ChemicalReaction* getReaction(const ChemicalReaction::Type& type) const;
     protected:
@@ -36,7 +36,7 @@ Combust::Combust(int nCompounds, double testTempStep, int maxItEquil, int maxItC
         int maxCombustLoops, double  minErrorEquil)
     :
     mConstantProperty(Combust::S),
-    mCompoundsDefined(),
+    mCompoundsDefined(DefinedChemicalCompounds::getInstance()),
     mCompounds(),
     mNCompounds(nCompounds),
     mWarningCountEquil(0),
@@ -118,7 +118,7 @@ class Combust
                 double  minErrorEquil   =   1.0E-6);
 
         Combust::Property   mConstantProperty;     /**< (--)       trick_chkpnt_io(**)     Enumeration to determine whether to hold mixture at constant S or H. */
-        DefinedChemicalCompounds mCompoundsDefined;/**< ** (--)    trick_chkpnt_io(**)     Defined chemical compounds. */
+        const DefinedChemicalCompounds* mCompoundsDefined; /**< ** (--) trick_chkpnt_io(**) Shared defined chemical compounds. */
         const ChemicalCompound**  mCompounds;      /**< ** (--)    trick_chkpnt_io(**)     Array of combustion Compounds. */
         int                 mNCompounds;           /**< (--)       trick_chkpnt_io(**)     Number of compounds in reaction. */
         int                 mWarningCountEquil;    /**< (--)       trick_chkpnt_io(**)     Counter of how many times solveEquilibrium method reached the max iterations. */
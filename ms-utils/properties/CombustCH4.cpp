@@ -46,16 +46,16 @@ mEnt2(0.0)
     mCompounds = const_cast<const ChemicalCompound**>(new ChemicalCompound* [CombustCH4::NCompounds]);
 
     /// - Set each compound in the array mCompounds to its correct compound type
-    mCompounds[CombustCH4::O2]  = mCompoundsDefined.getCompound(ChemicalCompound::O2);
-    mCompounds[CombustCH4::CH4] = mCompoundsDefined.getCompound(ChemicalCompound::CH4);
-    mCompounds[CombustCH4::H2O] = mCompoundsDefined.getCompound(ChemicalCompound::H2O);
-    mCompounds[CombustCH4::CO2] = mCompoundsDefined.getCompound(ChemicalCompound::CO2);
-    mCompounds[CombustCH4::OH]  = mCompoundsDefined.getCompound(ChemicalCompound::OH);
-    mCompounds[CombustCH4::CO]  = mCompoundsDefined.getCompound(ChemicalCompound::CO);
-    mCompounds[CombustCH4::O]   = mCompoundsDefined.getCompound(ChemicalCompound::O);
-    mCompounds[CombustCH4::H2]  = mCompoundsDefined.getCompound(ChemicalCompound::H2);
-    mCompounds[CombustCH4::H]   = mCompoundsDefined.getCompound(ChemicalCompound::H);
-    mCompounds[CombustCH4::He]  = mCompoundsDefined.getCompound(ChemicalCompound::He);
+    mCompounds[CombustCH4::O2]  = mCompoundsDefined->getCompound(ChemicalCompound::O2);
+    mCompounds[CombustCH4::CH4] = mCompoundsDefined->getCompound(ChemicalCompound::CH4);
+    mCompounds[CombustCH4::H2O] = mCompoundsDefined->getCompound(ChemicalCompound::H2O);
+    mCompounds[CombustCH4::CO2] = mCompoundsDefined->getCompound(ChemicalCompound::CO2);
+    mCompounds[CombustCH4::OH]  = mCompoundsDefined->getCompound(ChemicalCompound::OH);
+    mCompounds[CombustCH4::CO]  = mCompoundsDefined->getCompound(ChemicalCompound::CO);
+    mCompounds[CombustCH4::O]   = mCompoundsDefined->getCompound(ChemicalCompound::O);
+    mCompounds[CombustCH4::H2]  = mCompoundsDefined->getCompound(ChemicalCompound::H2);
+    mCompounds[CombustCH4::H]   = mCompoundsDefined->getCompound(ChemicalCompound::H);
+    mCompounds[CombustCH4::He]  = mCompoundsDefined->getCompound(ChemicalCompound::He);
 
 
 }
@@ -33,6 +33,7 @@
       (properties/FluidTsatFit.o)
       (properties/FluidHvapFit.o)
       (properties/FluidPropertiesDataWaterPvt.o)
+      (properties/FluidSaturationTable.o)
       (math/UnitConversion.o)
      )
 
@@ -41,6 +42,7 @@
 */
 
 #include "FluidProperties.hh"
+#include <pthread.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] type                  Type of fluid (from FluidType enum)
@@ -92,7 +94,8 @@ FluidProperties::FluidProperties(const FluidProperties::FluidType&  type,
     mTemperature(temperature),
     mSaturationPressure(saturationPressure),
     mSaturationTemperature(saturationTemperature),
-    mHeatOfVaporization(heatOfVaporization)
+    mHeatOfVaporization(heatOfVaporization),
+    mSaturationTable()
 {
     // nothing left to do
 };
@@ -105,6 +108,46 @@ FluidProperties::~FluidProperties()
     // nothing to do
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]   slope        (kPa/K) Slope of the saturation pressure curve at the temperature
+/// @param[in]    temperature  (K)     Temperature to evaluate saturation pressure at
+///
+/// @return   The saturation pressure (kPa) of this Fluid at the specified temperature
+///
+/// @details  Returns the saturation pressure and its slope vs. temperature from this Fluid's
+///           pre-computed saturation table.  If the table hasn't been built, this falls back to
+///           getSaturationPressure and a central difference of it for the slope.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double FluidProperties::lookupSaturationPressure(double& slope, const double temperature) const
+{
+    if (mSaturationTable.isInitialized()) {
+        return mSaturationTable.getSaturationPressure(slope, temperature);
+    }
+    const double dT = 0.01;
+    slope = (getSaturationPressure(temperature + dT) - getSaturationPressure(temperature - dT))
+          / (2.0 * dT);
+    return getSaturationPressure(temperature);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Builds this Fluid's saturation table over the valid ranges of its saturation pressure
+///           and temperature curve fits.  The saturation pressure fit's independent variable is the
+///           ratio of critical temperature to temperature, so its range is inverted to get the
+///           temperature range.  Fluids without both saturation curve fits get no table, and their
+///           lookups use the curve fits.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void FluidProperties::initializeSaturationTable()
+{
+    if (mSaturationPressure and mSaturationTemperature
+            and mSaturationPressure->getMinX() > DBL_EPSILON) {
+        mSaturationTable.initialize(this,
+                                    getCriticalTemperature() / mSaturationPressure->getMaxX(),
+                                    getCriticalTemperature() / mSaturationPressure->getMinX(),
+                                    mSaturationTemperature->getMinX(),
+                                    mSaturationTemperature->getMaxX());
+    }
+}
+
 /// @details  Reference: NIST Chemistry Webbook.
 const double DefinedFluidProperties::mMWeightCO         = 28.0101;
 /// @details  Reference: NIST Chemistry Webbook.
@@ -1201,6 +1244,11 @@ DefinedFluidProperties::DefinedFluidProperties()
     mProperties[FluidProperties::GUNNS_WATER_PVT]   = &mPropertiesWATERPVT;
     mProperties[FluidProperties::GUNNS_NTO]         = &mPropertiesNTO;
     mProperties[FluidProperties::GUNNS_MMH]         = &mPropertiesMMH;
+
+    /// - Build the saturation property tables now that all the curve fits are constructed.
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        mProperties[i]->initializeSaturationTable();
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1210,3 +1258,31 @@ DefinedFluidProperties::~DefinedFluidProperties()
 {
     // nothing to do
 }
+
+/// - The shared Defined Fluid Properties and its one-time construction control.
+static pthread_once_t          sharedFluidPropertiesOnce = PTHREAD_ONCE_INIT;
+static DefinedFluidProperties* sharedFluidProperties     = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Constructs the shared Defined Fluid Properties, called only once by getInstance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void createSharedFluidProperties()
+{
+    sharedFluidProperties = new DefinedFluidProperties();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   const DefinedFluidProperties* (--) Pointer to the shared Defined Fluid Properties.
+///
+/// @details  Returns the Defined Fluid Properties shared by all networks and links in the process,
+///           constructing it on the first call.  Construction is guarded by pthread_once, so
+///           concurrent first calls construct it only once and all wait for it to complete.  The
+///           shared instance is never modified after construction; its table interpolators save
+///           their last search indices per thread, not in the table, so concurrent lookups are
+///           safe.  It is never deleted, so that it outlives its users.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const DefinedFluidProperties* DefinedFluidProperties::getInstance()
+{
+    pthread_once(&sharedFluidPropertiesOnce, createSharedFluidProperties);
+    return sharedFluidProperties;
+}
@@ -50,6 +50,7 @@ ASSUMPTIONS AND LIMITATIONS:
 #include "math/approximation/TsBilinearInterpolatorReverse.hh"
 #include "properties/FluidTsatFit.hh"
 #include "properties/FluidHvapFit.hh"
+#include "properties/FluidSaturationTable.hh"
 #include "FluidPropertiesDataWaterPvt.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +177,10 @@ class FluidProperties {
         double getSaturationTemperature(const double pressure) const;
         /// @brief Returns the latent heat of vaporization (kJ/kg) of this Fluid.
         double getHeatOfVaporization(const double temperature) const;
+        /// @brief Returns the tabulated saturation pressure (kPa) of this Fluid.
+        double lookupSaturationPressure(const double temperature) const;
+        /// @brief Returns the tabulated saturation pressure (kPa) and slope (kPa/K) of this Fluid.
+        double lookupSaturationPressure(double& slope, const double temperature) const;
     protected:
         const FluidProperties::FluidType  mType;        /**< (--)    Type of this Fluid */
         const FluidProperties::FluidPhase mPhase;       /**< (--)    Phase of this Fluid */
@@ -195,6 +200,9 @@ class FluidProperties {
         TsApproximation*        mSaturationPressure;    /**< (--)    Curve fit for saturation pressure of this Fluid */
         TsApproximation*        mSaturationTemperature; /**< (--)    Curve fit for saturation temperature of this Fluid */
         TsApproximation*        mHeatOfVaporization;    /**< (--)    Curve fit for heat of vaporization of this Fluid */
+        FluidSaturationTable    mSaturationTable;       /**< (--)    trick_chkpnt_io(**) Tabulated saturation pressure & temperature of this Fluid */
+        /// @brief Builds the saturation property table of this Fluid from its curve fits.
+        void initializeSaturationTable();
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -209,7 +217,9 @@ class FluidProperties {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Class for the Defined Fluid Properties.
 ///
-/// @details  Provides the Fluid Properties for a set of liquids and gases.
+/// @details  Provides the Fluid Properties for a set of liquids and gases.  These never change after
+///           construction, so networks and links should normally share the one instance returned
+///           by getInstance rather than constructing their own.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class DefinedFluidProperties {
     TS_MAKE_SIM_COMPATIBLE(DefinedFluidProperties);
@@ -218,6 +228,8 @@ class DefinedFluidProperties {
         DefinedFluidProperties();
         /// @brief Default destructs a Fluid Properties.
         virtual ~DefinedFluidProperties();
+        /// @brief    Returns the shared Defined Fluid Properties, constructed on first use.
+        static const DefinedFluidProperties* getInstance();
         /// @brief returns a pointer to the properties of the specified fluid type.
         FluidProperties* getProperties(const FluidProperties::FluidType& type) const;
     protected:
@@ -888,6 +900,23 @@ inline double FluidProperties::getHeatOfVaporization(const double temperature) c
     return mHeatOfVaporization->get(temperature / getCriticalTemperature());
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    temperature  (K) Temperature to evaluate saturation pressure at
+///
+/// @return   The saturation pressure (kPa) of this Fluid at the specified temperature
+///
+/// @details  Returns the saturation pressure from this Fluid's pre-computed saturation table,
+///           which is faster than, and agrees closely with, getSaturationPressure.  If the table
+///           hasn't been built, this falls back to getSaturationPressure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double FluidProperties::lookupSaturationPressure(const double temperature) const
+{
+    if (mSaturationTable.isInitialized()) {
+        return mSaturationTable.getSaturationPressure(temperature);
+    }
+    return getSaturationPressure(temperature);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  type   Type of Fluid
 ///
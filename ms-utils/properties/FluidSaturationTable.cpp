@@ -0,0 +1,248 @@
+/**
+@file
+@brief    Fluid Saturation Property Table implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((properties/FluidProperties.o))
+*/
+
+#include "FluidSaturationTable.hh"
+
+#include <cfloat>
+#include <cmath>
+
+#include "properties/FluidProperties.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Fluid Saturation Property Table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+FluidSaturationTable::FluidSaturationTable()
+    :
+    mNumPoints(0),
+    mMinTemperature(0.0),
+    mMaxTemperature(0.0),
+    mTemperatureStep(0.0),
+    mMinLogPressure(0.0),
+    mMaxLogPressure(0.0),
+    mLogPressureStep(0.0),
+    mPressure(0),
+    mPressureSlope(0),
+    mTemperature(0),
+    mTemperatureSlope(0),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Fluid Saturation Property Table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+FluidSaturationTable::~FluidSaturationTable()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes the dynamic table arrays, if they exist.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void FluidSaturationTable::cleanup()
+{
+    TS_DELETE_ARRAY(mTemperatureSlope);
+    TS_DELETE_ARRAY(mTemperature);
+    TS_DELETE_ARRAY(mPressureSlope);
+    TS_DELETE_ARRAY(mPressure);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] properties     (--)  Pointer to the fluid properties to sample.
+/// @param[in] minTemperature (K)   Temperature of the first saturation pressure point.
+/// @param[in] maxTemperature (K)   Temperature of the last saturation pressure point.
+/// @param[in] minPressure    (kPa) Pressure of the first saturation temperature point.
+/// @param[in] maxPressure    (kPa) Pressure of the last saturation temperature point.
+/// @param[in] numPoints      (--)  Number of points in each table.
+/// @param[in] name           (--)  Name of this table for memory allocation.
+///
+/// @details  Samples the given fluid's saturation pressure and temperature curve fits over the
+///           given ranges.  The slope at each point is found by a finite difference of the curve fit
+///           over a small fraction of the table spacing, one-sided at the table ends so that it
+///           doesn't reach into the curve fit's clamped region.  If the arguments are invalid, then
+///           the table is left uninitialized, and the owner should use its curve fits instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void FluidSaturationTable::initialize(const FluidProperties* properties,
+                                      const double           minTemperature,
+                                      const double           maxTemperature,
+                                      const double           minPressure,
+                                      const double           maxPressure,
+                                      const int              numPoints,
+                                      const std::string&     name)
+{
+    /// - Reset the init flag.
+    mInitFlag = false;
+    cleanup();
+
+    /// - Leave the table uninitialized on invalid arguments.
+    if (not properties or numPoints < 2 or maxTemperature - minTemperature < DBL_EPSILON
+            or minPressure < DBL_EPSILON or maxPressure - minPressure < DBL_EPSILON) {
+        return;
+    }
+
+    mNumPoints       = numPoints;
+    mMinTemperature  = minTemperature;
+    mMaxTemperature  = maxTemperature;
+    mTemperatureStep = (maxTemperature - minTemperature) / (numPoints - 1);
+    mMinLogPressure  = log10(minPressure);
+    mMaxLogPressure  = log10(maxPressure);
+    mLogPressureStep = (mMaxLogPressure - mMinLogPressure) / (numPoints - 1);
+
+    TS_NEW_PRIM_ARRAY_EXT(mPressure,         numPoints, double, name + ".mPressure");
+    TS_NEW_PRIM_ARRAY_EXT(mPressureSlope,    numPoints, double, name + ".mPressureSlope");
+    TS_NEW_PRIM_ARRAY_EXT(mTemperature,      numPoints, double, name + ".mTemperature");
+    TS_NEW_PRIM_ARRAY_EXT(mTemperatureSlope, numPoints, double, name + ".mTemperatureSlope");
+
+    /// - Sample the saturation pressure curve.
+    const double dT = 0.01 * mTemperatureStep;
+    for (int i = 0; i < numPoints; ++i) {
+        const double t = (i < numPoints - 1) ? minTemperature + i * mTemperatureStep : maxTemperature;
+        mPressure[i]   = properties->getSaturationPressure(t);
+        if (0 == i) {
+            mPressureSlope[i] = (-3.0 * mPressure[i] + 4.0 * properties->getSaturationPressure(t + dT)
+                                 - properties->getSaturationPressure(t + 2.0 * dT)) / (2.0 * dT);
+        } else if (numPoints - 1 == i) {
+            mPressureSlope[i] = ( 3.0 * mPressure[i] - 4.0 * properties->getSaturationPressure(t - dT)
+                                 + properties->getSaturationPressure(t - 2.0 * dT)) / (2.0 * dT);
+        } else {
+            mPressureSlope[i] = (properties->getSaturationPressure(t + dT)
+                               - properties->getSaturationPressure(t - dT)) / (2.0 * dT);
+        }
+    }
+
+    /// - Sample the saturation temperature curve vs. log10 of pressure.
+    const double dY = 0.01 * mLogPressureStep;
+    for (int i = 0; i < numPoints; ++i) {
+        const double y    = (i < numPoints - 1) ? mMinLogPressure + i * mLogPressureStep : mMaxLogPressure;
+        mTemperature[i]   = properties->getSaturationTemperature(pow(10.0, y));
+        if (0 == i) {
+            mTemperatureSlope[i] = (-3.0 * mTemperature[i]
+                                  + 4.0 * properties->getSaturationTemperature(pow(10.0, y + dY))
+                                  - properties->getSaturationTemperature(pow(10.0, y + 2.0 * dY)))
+                                 / (2.0 * dY);
+        } else if (numPoints - 1 == i) {
+            mTemperatureSlope[i] = ( 3.0 * mTemperature[i]
+                                  - 4.0 * properties->getSaturationTemperature(pow(10.0, y - dY))
+                                  + properties->getSaturationTemperature(pow(10.0, y - 2.0 * dY)))
+                                 / (2.0 * dY);
+        } else {
+            mTemperatureSlope[i] = (properties->getSaturationTemperature(pow(10.0, y + dY))
+                                  - properties->getSaturationTemperature(pow(10.0, y - dY)))
+                                 / (2.0 * dY);
+        }
+    }
+
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] slope  (--) Derivative of the interpolated value with respect to x.
+/// @param[in]  values (--) Table values.
+/// @param[in]  slopes (--) Table slopes with respect to x.
+/// @param[in]  minX   (--) Coordinate of the first table point.
+/// @param[in]  step   (--) Uniform spacing between table points.
+/// @param[in]  x      (--) Coordinate to evaluate at.
+///
+/// @returns  double (--) The interpolated value.
+///
+/// @details  Finds the table interval containing x directly from the uniform spacing, and evaluates
+///           the cubic Hermite polynomial matching the values and slopes at the interval ends.
+///           Coordinates outside of the table are clamped to the table ends, where the slope output
+///           is zero, consistent with the clamped value being constant there.  A non-finite
+///           coordinate can't be placed in an interval, so it returns the first table value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double FluidSaturationTable::interpolate(double&       slope,
+                                         const double* values,
+                                         const double* slopes,
+                                         const double  minX,
+                                         const double  step,
+                                         const double  x) const
+{
+    const double position = (x - minX) / step;
+    if (not std::isfinite(position)) {
+        slope = 0.0;
+        return values[0];
+    } else if (position <= 0.0) {
+        slope = (position < 0.0) ? 0.0 : slopes[0];
+        return values[0];
+    } else if (position >= mNumPoints - 1) {
+        slope = (position > mNumPoints - 1) ? 0.0 : slopes[mNumPoints - 1];
+        return values[mNumPoints - 1];
+    }
+
+    const int    i   = static_cast<int>(position);
+    const double t   = position - i;
+    const double t2  = t * t;
+    const double t3  = t2 * t;
+    const double v0  = values[i];
+    const double v1  = values[i + 1];
+    const double m0  = slopes[i];
+    const double m1  = slopes[i + 1];
+    slope = 6.0 * (t2 - t) * (v0 - v1) / step + (3.0 * t2 - 4.0 * t + 1.0) * m0 + (3.0 * t2 - 2.0 * t) * m1;
+    return (2.0 * t3 - 3.0 * t2 + 1.0) * v0 + (t3 - 2.0 * t2 + t) * step * m0
+         + (3.0 * t2 - 2.0 * t3)       * v1 + (t3 - t2)           * step * m1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] temperature (K) Temperature to look up.
+///
+/// @returns  double (kPa) Saturation pressure at the given temperature, or zero if the table isn't
+///                        initialized.
+///
+/// @details  Returns the interpolated saturation pressure at the given temperature.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double FluidSaturationTable::getSaturationPressure(const double temperature) const
+{
+    double slope = 0.0;
+    return getSaturationPressure(slope, temperature);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] slope       (kPa/K) Slope of the saturation pressure curve at the given temperature.
+/// @param[in]  temperature (K)     Temperature to look up.
+///
+/// @returns  double (kPa) Saturation pressure at the given temperature, or zero if the table isn't
+///                        initialized.
+///
+/// @details  Returns the interpolated saturation pressure and its slope at the given temperature.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double FluidSaturationTable::getSaturationPressure(double& slope, const double temperature) const
+{
+    if (not mInitFlag) {
+        slope = 0.0;
+        return 0.0;
+    }
+    return interpolate(slope, mPressure, mPressureSlope, mMinTemperature, mTemperatureStep,
+                       temperature);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] pressure (kPa) Pressure to look up.
+///
+/// @returns  double (K) Saturation temperature at the given pressure, or zero if the table isn't
+///                      initialized.
+///
+/// @details  Returns the interpolated saturation temperature at the given pressure.  Pressures at
+///           or below zero return the temperature at the minimum table pressure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double FluidSaturationTable::getSaturationTemperature(const double pressure) const
+{
+    if (not mInitFlag) {
+        return 0.0;
+    }
+    if (pressure <= 0.0) {
+        return mTemperature[0];
+    }
+    double slope = 0.0;
+    return interpolate(slope, mTemperature, mTemperatureSlope, mMinLogPressure, mLogPressureStep,
+                       log10(pressure));
+}
@@ -0,0 +1,130 @@
+#ifndef FluidSaturationTable_EXISTS
+#define FluidSaturationTable_EXISTS
+
+/**
+@file
+@brief    Fluid Saturation Property Table declarations
+
+@defgroup  TSM_UTILITIES_PROPERTIES_FLUID_SATURATION_TABLE Fluid Saturation Property Table
+@ingroup   TSM_UTILITIES_PROPERTIES
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Provides pre-computed tables of a fluid's saturation pressure vs. temperature and saturation
+   temperature vs. pressure, for constant-time lookups in place of the saturation curve fits.)
+
+REFERENCE:
+- (Cubic Hermite spline interpolation.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The tables are sampled from the fluid's own saturation curve fits, so they are only as accurate
+   as those fits, plus the interpolation error between table points.)
+- (Lookups outside of the table range are clamped to the table range, consistent with the curve
+   fits clamping to their valid range.  Non-finite lookups return the lower table end.)
+
+ LIBRARY DEPENDENCY:
+- ((FluidSaturationTable.o))
+
+ PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+class FluidProperties;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Saturation Property Table.
+///
+/// @details  Holds the saturation pressure of a fluid tabulated on uniformly-spaced temperatures,
+///           and the saturation temperature tabulated on uniformly-spaced log10 of pressure, along
+///           with the slope of each curve at each table point.  Because the table points are
+///           uniformly spaced, a lookup finds its table interval directly without searching, then
+///           evaluates a cubic Hermite polynomial through the interval end points.  Saturation
+///           pressure lookups need no transcendental functions at all, and saturation temperature
+///           lookups need a single log10, versus the pow, log10 and sqrt of the curve fits.  The
+///           Hermite polynomial also gives the saturation pressure slope (dPsat/dT) for free.
+///
+///           The table is filled once by the owning FluidProperties and is not modified after, so
+///           it can be shared by any number of links and threads.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FluidSaturationTable
+{
+    TS_MAKE_SIM_COMPATIBLE(FluidSaturationTable);
+    public:
+        /// @brief  Default number of points in each table.
+        static const int DEFAULT_POINTS = 512;
+        /// @brief  Default constructs this Fluid Saturation Property Table.
+        FluidSaturationTable();
+        /// @brief  Default destructs this Fluid Saturation Property Table.
+        virtual ~FluidSaturationTable();
+        /// @brief  Fills the tables from the given fluid's saturation curve fits.
+        void   initialize(const FluidProperties* properties,
+                          const double           minTemperature,
+                          const double           maxTemperature,
+                          const double           minPressure,
+                          const double           maxPressure,
+                          const int              numPoints = DEFAULT_POINTS,
+                          const std::string&     name      = "FluidSaturationTable");
+        /// @brief  Returns the saturation pressure (kPa) at the given temperature.
+        double getSaturationPressure(const double temperature) const;
+        /// @brief  Returns the saturation pressure (kPa) and its slope (kPa/K) at the given temperature.
+        double getSaturationPressure(double& slope, const double temperature) const;
+        /// @brief  Returns the saturation temperature (K) at the given pressure.
+        double getSaturationTemperature(const double pressure) const;
+        /// @brief  Returns whether this table has been successfully initialized.
+        bool   isInitialized() const;
+
+    protected:
+        int     mNumPoints;         /**< (--)    trick_chkpnt_io(**) Number of points in each table. */
+        double  mMinTemperature;    /**< (K)     trick_chkpnt_io(**) Temperature of the first saturation pressure point. */
+        double  mMaxTemperature;    /**< (K)     trick_chkpnt_io(**) Temperature of the last saturation pressure point. */
+        double  mTemperatureStep;   /**< (K)     trick_chkpnt_io(**) Temperature spacing between saturation pressure points. */
+        double  mMinLogPressure;    /**< (--)    trick_chkpnt_io(**) Log10 of pressure (kPa) of the first saturation temperature point. */
+        double  mMaxLogPressure;    /**< (--)    trick_chkpnt_io(**) Log10 of pressure (kPa) of the last saturation temperature point. */
+        double  mLogPressureStep;   /**< (--)    trick_chkpnt_io(**) Log10 of pressure spacing between saturation temperature points. */
+        double* mPressure;          /**< (kPa)   trick_chkpnt_io(**) Saturation pressure at each temperature point. */
+        double* mPressureSlope;     /**< (kPa/K) trick_chkpnt_io(**) Saturation pressure slope at each temperature point. */
+        double* mTemperature;       /**< (K)     trick_chkpnt_io(**) Saturation temperature at each log10 pressure point. */
+        double* mTemperatureSlope;  /**< (K)     trick_chkpnt_io(**) Saturation temperature slope vs. log10 pressure at each point. */
+        bool    mInitFlag;          /**< (--)    trick_chkpnt_io(**) Initialization complete flag. */
+        /// @brief  Deletes dynamic memory.
+        void   cleanup();
+        /// @brief  Evaluates the Hermite polynomial of the given table at the given coordinate.
+        double interpolate(double&       slope,
+                           const double* values,
+                           const double* slopes,
+                           const double  minX,
+                           const double  step,
+                           const double  x) const;
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        FluidSaturationTable(const FluidSaturationTable&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        FluidSaturationTable& operator =(const FluidSaturationTable&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this table has been successfully initialized.
+///
+/// @details  Returns the initialization complete flag.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool FluidSaturationTable::isInitialized() const
+{
+    return mInitFlag;
+}
+
+#endif
@@ -30,21 +30,35 @@
 /// @param[in]    specificHeat         Specific heat of this Solid
 /// @param[in]    thermalConductivity  Thermal conductivity of this Solid
 /// @param[in]    roughness            Roughness of this Solid
+/// @param[in]    numTablePoints       Number of points in the property table
+/// @param[in]    tableTemperatures    Property table temperatures, ascending
+/// @param[in]    tableSpecificHeats   Property table specific heats
+/// @param[in]    tableConductivities  Property table thermal conductivities
 ///
 /// @details  Constructs this Solid Properties by specifying values for each attribute. Also serves
-///           as the default constructor since a default value is specified for each argument.
+///           as the default constructor since a default value is specified for each argument.  The
+///           property table arrays are not copied, so they must persist for the life of this
+///           object.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 SolidProperties::SolidProperties(const SolidProperties::SolidType type,
                                  const double                     density,
                                  const double                     specificHeat,
                                  const double                     thermalConductivity,
-                                 const double                     roughness)
+                                 const double                     roughness,
+                                 const int                        numTablePoints,
+                                 const double*                    tableTemperatures,
+                                 const double*                    tableSpecificHeats,
+                                 const double*                    tableConductivities)
     :
     mType(type),
     mDensity(density),
     mSpecificHeat(specificHeat),
     mThermalConductivity(thermalConductivity),
-    mRoughness(roughness)
+    mRoughness(roughness),
+    mNumTablePoints(numTablePoints),
+    mTableTemperatures(tableTemperatures),
+    mTableSpecificHeats(tableSpecificHeats),
+    mTableConductivities(tableConductivities)
 {
     // nothing left to do
 };
@@ -57,6 +71,41 @@ SolidProperties::~SolidProperties()
     // nothing to do
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    values       Property table values
+/// @param[in]    temperature  (K)  Temperature of this Solid
+///
+/// @return   The property value interpolated at the temperature.
+///
+/// @details  Linearly interpolates the given property table values at the temperature, holding the
+///           end values outside of the table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double SolidProperties::interpolate(const double* values, const double temperature) const
+{
+    const int bin = getTableBin(temperature);
+    if (0 == bin) {
+        return values[0];
+    } else if (mNumTablePoints == bin) {
+        return values[mNumTablePoints - 1];
+    }
+    const double fraction = (temperature               - mTableTemperatures[bin - 1])
+                          / (mTableTemperatures[bin] - mTableTemperatures[bin - 1]);
+    return values[bin - 1] + fraction * (values[bin] - values[bin - 1]);
+}
+
+/// @details  Number of points in the Steel 304 property table.
+static const int    STEEL_304_TABLE_POINTS = 8;
+/// @details  Steel 304 property table temperatures (K), from Incropera & DeWitt, Fundamentals of
+///           Heat and Mass Transfer, Table A.1 (AISI 304).
+static const double STEEL_304_TABLE_T[STEEL_304_TABLE_POINTS]  = {
+        100.0,  200.0,  300.0,  400.0,  600.0,  800.0, 1000.0, 1200.0};
+/// @details  Steel 304 property table specific heats (J/kg/K).
+static const double STEEL_304_TABLE_CP[STEEL_304_TABLE_POINTS] = {
+        272.0,  402.0,  477.0,  515.0,  557.0,  582.0,  611.0,  640.0};
+/// @details  Steel 304 property table thermal conductivities (W/m/K).
+static const double STEEL_304_TABLE_K[STEEL_304_TABLE_POINTS]  = {
+          9.2,   12.6,   14.9,   16.6,   19.8,   22.6,   25.4,   28.0};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this Predefined Solid Properties. Initializes the array of solid
 ///           properties, indexed by solid type, specifying:
@@ -65,6 +114,7 @@ SolidProperties::~SolidProperties()
 ///           - Specific heat (J/kg/K)
 ///           - Thermal conductivity (W/m/K)
 ///           - Roughness (m)
+///           - Optional table of specific heat and thermal conductivity versus temperature
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 DefinedSolidProperties::DefinedSolidProperties()
     :
@@ -72,7 +122,11 @@ DefinedSolidProperties::DefinedSolidProperties()
                         7910.0,
                         490.0,
                         14.75,
-                        2.13360E-06),
+                        2.13360E-06,
+                        STEEL_304_TABLE_POINTS,
+                        STEEL_304_TABLE_T,
+                        STEEL_304_TABLE_CP,
+                        STEEL_304_TABLE_K),
     mPropertiesAluminum6061(SolidProperties::ALUMINUM_6061,
                             2712.55219,
                             879.249,
@@ -20,6 +20,8 @@ REFERENCE:
 ASSUMPTIONS AND LIMITATIONS:
 - (The constructors are protected, so only those Solid Properties objects in its friend,
    the Predefined Solid Properties class are available.)
+- (Temperature-dependent specific heat and thermal conductivity are linearly interpolated between
+   table points, and are held constant at the end values outside of the table.)
 
  CLASS:
 - ()
@@ -34,12 +36,18 @@ ASSUMPTIONS AND LIMITATIONS:
 */
 
 #include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <algorithm>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Solid Properties.
 ///
 /// @details  The Solid Properties Model provides the properties of a solid: type, density,
 ///           specific heat, thermal conductivity and roughness.
+///
+///           A solid may also have a table of specific heat and thermal conductivity versus
+///           temperature.  The table is divided into bins by its temperatures, so that users can
+///           tell when a temperature change moves onto a different segment of the curves.  Solids
+///           without a table return their constant properties at all temperatures.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class SolidProperties {
     TS_MAKE_SIM_COMPATIBLE(SolidProperties);
@@ -63,7 +71,11 @@ class SolidProperties {
                         const double       density             = 0.0,
                         const double       specificHeat        = 0.0,
                         const double       thermalConductivity = 0.0,
-                        const double       roughness           = 0.0);
+                        const double       roughness           = 0.0,
+                        const int          numTablePoints      = 0,
+                        const double*      tableTemperatures   = 0,
+                        const double*      tableSpecificHeats  = 0,
+                        const double*      tableConductivities = 0);
         /// @brief    Default destructs a Solid Properties.
         virtual ~SolidProperties();
         /// @brief    Returns the type of this Solid.
@@ -76,6 +88,14 @@ class SolidProperties {
         double getThermalConductivity() const;
         /// @brief    Returns the roughness (m) of this Solid.
         double getRoughness() const;
+        /// @brief    Returns whether this Solid has temperature-dependent properties.
+        bool   isTemperatureDependent() const;
+        /// @brief    Returns the property table bin containing the given temperature (K).
+        int    getTableBin(const double temperature) const;
+        /// @brief    Returns the specific heat (J/kg/K) of this Solid at the given temperature (K).
+        double getSpecificHeat(const double temperature) const;
+        /// @brief    Returns the thermal conductivity (W/m/K) of this Solid at the given temperature (K).
+        double getThermalConductivity(const double temperature) const;
     protected:
         /// @brief    --       Type of this Solid.
         const SolidProperties::SolidType  mType;                // --       type
@@ -87,6 +107,16 @@ class SolidProperties {
         const double                      mThermalConductivity; // (W/m/K)  thermal conductivity
         /// @brief    (m)      Roughness of this Solid.
         const double                      mRoughness;           // (m)      roughness
+        /// @brief    --       Number of points in the property table.
+        const int                         mNumTablePoints;      // --       number of table points
+        /// @brief    (K)      Property table temperatures, ascending.
+        const double*                     mTableTemperatures;   // (K)      table temperatures
+        /// @brief    (J/kg/K) Property table specific heats.
+        const double*                     mTableSpecificHeats;  // (J/kg/K) table specific heats
+        /// @brief    (W/m/K)  Property table thermal conductivities.
+        const double*                     mTableConductivities; // (W/m/K)  table conductivities
+        /// @brief    Returns the table value interpolated at the given temperature.
+        double interpolate(const double* values, const double temperature) const;
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -102,7 +132,8 @@ class SolidProperties {
 /// @brief    Defined Solid Properties.
 ///
 /// @details  The Defined Solid Properties model defines the Solid Properties for a set of solids:
-///           Stainless Steel 304 and Aluminum 6061.
+///           Stainless Steel 304 and Aluminum 6061.  Stainless Steel 304 has a table of specific
+///           heat and thermal conductivity from 100 to 1200 K.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class DefinedSolidProperties {
     TS_MAKE_SIM_COMPATIBLE(DefinedSolidProperties);
@@ -183,6 +214,66 @@ inline double SolidProperties::getRoughness() const
     return mRoughness;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   True if this Solid has a property table.
+///
+/// @details  Returns whether this Solid has temperature-dependent specific heat and thermal
+///           conductivity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool SolidProperties::isTemperatureDependent() const
+{
+    return mNumTablePoints > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    temperature  (K)  Temperature of this Solid.
+///
+/// @return   The property table bin (--) containing the temperature, from zero below the first
+///           table temperature to the number of table points above the last.
+///
+/// @details  Returns the index of the property table bin containing the given temperature.  Bin i
+///           is from table temperature i-1 up to table temperature i.  Solids without a table have
+///           only bin zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int SolidProperties::getTableBin(const double temperature) const
+{
+    return static_cast<int>(std::upper_bound(mTableTemperatures,
+                                             mTableTemperatures + mNumTablePoints,
+                                             temperature) - mTableTemperatures);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    temperature  (K)  Temperature of this Solid.
+///
+/// @return   The specific heat (J/kg/K) of this Solid at the given temperature.
+///
+/// @details  Returns the specific heat of this Solid interpolated from its property table, or the
+///           constant specific heat if it has no table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double SolidProperties::getSpecificHeat(const double temperature) const
+{
+    if (mNumTablePoints > 0) {
+        return interpolate(mTableSpecificHeats, temperature);
+    }
+    return mSpecificHeat;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    temperature  (K)  Temperature of this Solid.
+///
+/// @return   The thermal conductivity (W/m/K) of this Solid at the given temperature.
+///
+/// @details  Returns the thermal conductivity of this Solid interpolated from its property table,
+///           or the constant thermal conductivity if it has no table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double SolidProperties::getThermalConductivity(const double temperature) const
+{
+    if (mNumTablePoints > 0) {
+        return interpolate(mTableConductivities, temperature);
+    }
+    return mThermalConductivity;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    type   Type of Solid
 ///
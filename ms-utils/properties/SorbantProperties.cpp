@@ -179,7 +179,7 @@ SorbantProperties::SorbantProperties(const SorbantProperties::Type type,
     mPorosity(porosity),
     mCp(cp),
     mSorbates(),
-    mDefinedCompounds()
+    mDefinedCompounds(DefinedChemicalCompounds::getInstance())
 {
     /// - Validate constructud values.
     if (density < DBL_EPSILON) {
@@ -213,7 +213,7 @@ SorbantProperties::SorbantProperties(const SorbantProperties& that)
     mPorosity(that.mPorosity),
     mCp(that.mCp),
     mSorbates(that.mSorbates),
-    mDefinedCompounds()
+    mDefinedCompounds(DefinedChemicalCompounds::getInstance())
 {
     // nothing to do
 }
@@ -258,7 +258,7 @@ void SorbantProperties::addSorbate(const ChemicalCompound::Type
                                    const double                                    dh,
                                    const double                                    km)
 {
-    const ChemicalCompound* properties = mDefinedCompounds.getCompound(compound);
+    const ChemicalCompound* properties = mDefinedCompounds->getCompound(compound);
     SorbateProperties newSorbate(properties, blockingCompounds, offgasCompounds,
                                  tothA0, tothB0, tothE, tothT0, tothC0, dh, km);
     mSorbates.push_back(newSorbate);
@@ -166,9 +166,9 @@ class SorbantProperties {
         const double                   mPorosity;         /**<    (1)      trick_chkpnt_io(**) Fraction of the packed sorbant enclosure volume that is voids. */
         const double                   mCp;               /**<    (J/kg/K) trick_chkpnt_io(**) Specific heat of the sorbant material. */
         std::vector<SorbateProperties> mSorbates;         /**< ** (1)      trick_chkpnt_io(**) List of sorbate properties for this sorbant. */
-        /// - A DefinedChemicalCompounds is defined here, rather than in DefinedSorbantProperties,
+        /// - The DefinedChemicalCompounds is referenced here, rather than in DefinedSorbantProperties,
         ///   so that models may create custom sorbants independent of DefinedSorbantProperties.
-        const DefinedChemicalCompounds mDefinedCompounds; /**<    (1)      trick_chkpnt_io(**) Defined chemical compounds data. */
+        const DefinedChemicalCompounds* mDefinedCompounds; /**<   (1)      trick_chkpnt_io(**) Shared defined chemical compounds data. */
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
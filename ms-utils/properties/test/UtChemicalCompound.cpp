@@ -73,6 +73,16 @@ void UtChemicalCompound::testConstruction()
             CPPUNIT_ASSERT(expected == returned);
         }
         TS_DELETE_OBJECT(compounds);
+    } {
+        /// @test shared instance is the same on every call, with properties for each compound type.
+        const DefinedChemicalCompounds* compounds = DefinedChemicalCompounds::getInstance();
+        CPPUNIT_ASSERT(0 != compounds);
+        CPPUNIT_ASSERT(compounds == DefinedChemicalCompounds::getInstance());
+        for (int i = 0; i < ChemicalCompound::NO_COMPOUND; i++) {
+            const ChemicalCompound::Type expected = static_cast<ChemicalCompound::Type>(i);
+            const ChemicalCompound::Type returned = compounds->getCompound(expected)->mType;
+            CPPUNIT_ASSERT(expected == returned);
+        }
     }
 
     std::cout << "... Pass";
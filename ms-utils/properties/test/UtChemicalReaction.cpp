@@ -73,6 +73,16 @@ void UtChemicalReaction::testConstruction()
             CPPUNIT_ASSERT(expected == returned);
         }
         TS_DELETE_OBJECT(reactions);
+    } {
+        /// @test shared instance is the same on every call, with properties for each reaction type.
+        const DefinedChemicalReactions* reactions = DefinedChemicalReactions::getInstance();
+        CPPUNIT_ASSERT(0 != reactions);
+        CPPUNIT_ASSERT(reactions == DefinedChemicalReactions::getInstance());
+        for (int i = 0; i < ChemicalReaction::NO_REACTION; i++) {
+            const ChemicalReaction::Type expected = static_cast<ChemicalReaction::Type>(i);
+            const ChemicalReaction::Type returned = reactions->getReaction(expected)->mType;
+            CPPUNIT_ASSERT(expected == returned);
+        }
     }
 
     std::cout << "... Pass";
@@ -4,6 +4,7 @@
 */
 
 #include <iostream>
+#include <pthread.h>
 
 #include "math/approximation/LinearFit.hh"
 
@@ -1063,5 +1064,75 @@ void UtFluidProperties::testSaturationCurveConsistency()
         CPPUNIT_ASSERT_DOUBLES_EQUAL(temperature[i], Ts, FLT_EPSILON);
     }
 
+    std::cout << "... Pass";
+}
+
+/// - Number of real-gas table lookups made by each thread in testSharedInstance.
+static const int SHARED_LOOKUPS = 200;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] results (--) Array of SHARED_LOOKUPS lookup results, cast to void*.
+///
+/// @returns  void* (--) Always null.
+///
+/// @details  Thread function for testSharedInstance.  Gets the shared Defined Fluid Properties and
+///           sweeps lookups up and down the nitrogen real-gas density and pressure tables, so that
+///           concurrent threads move the tables' saved indices in different directions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* sharedLookups(void* results)
+{
+    double* density = static_cast<double*>(results);
+    FluidProperties* n2 = DefinedFluidProperties::getInstance()->getProperties(
+            FluidProperties::GUNNS_N2_REAL_GAS);
+    for (int i = 0; i < SHARED_LOOKUPS; ++i) {
+        const double temperature = 80.0 + 5.0 * (i % 40);
+        const double pressure    = 100.0 + 250.0 * ((SHARED_LOOKUPS - i) % 37);
+        const double rho         = n2->getDensity(temperature, pressure);
+        density[i] = rho + n2->getPressure(temperature, rho);
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the shared instance returned by getInstance is the same on every call, and that
+///           concurrent lookups from several threads match the lookups from a private instance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidProperties::testSharedInstance()
+{
+    std::cout << "\n Fluid Properties 15: Shared Instance                                   ";
+
+    /// - Test the same instance is returned on every call, and has the same properties.
+    const DefinedFluidProperties* shared = DefinedFluidProperties::getInstance();
+    CPPUNIT_ASSERT(0 != shared);
+    CPPUNIT_ASSERT(shared == DefinedFluidProperties::getInstance());
+    for (int i = 0; i < FluidProperties::NO_FLUID; i++) {
+        FluidProperties::FluidType type = static_cast<FluidProperties::FluidType>(i);
+        CPPUNIT_ASSERT_EQUAL(mArticle->getProperties(type)->getMWeight(),
+                             shared->getProperties(type)->getMWeight());
+        CPPUNIT_ASSERT_EQUAL(mArticle->getProperties(type)->getDensity(300.0, 101.325),
+                             shared->getProperties(type)->getDensity(300.0, 101.325));
+    }
+
+    /// - Test concurrent lookups in the shared tables match the private instance.
+    static const int NUM_THREADS = 4;
+    double    results[NUM_THREADS][SHARED_LOOKUPS];
+    pthread_t threads[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        CPPUNIT_ASSERT(0 == pthread_create(&threads[t], 0, sharedLookups, results[t]));
+    }
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        CPPUNIT_ASSERT(0 == pthread_join(threads[t], 0));
+    }
+    FluidProperties* n2 = mArticle->getProperties(FluidProperties::GUNNS_N2_REAL_GAS);
+    for (int i = 0; i < SHARED_LOOKUPS; ++i) {
+        const double temperature = 80.0 + 5.0 * (i % 40);
+        const double pressure    = 100.0 + 250.0 * ((SHARED_LOOKUPS - i) % 37);
+        const double density     = n2->getDensity(temperature, pressure);
+        const double expected    = density + n2->getPressure(temperature, density);
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, results[t][i], expected * DBL_EPSILON);
+        }
+    }
+
     std::cout << "... Pass" << std::endl;
 }
@@ -0,0 +1,181 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include <iostream>
+#include <cmath>
+#include <limits>
+
+#include "UtFluidSaturationTable.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Fluid Saturation Property Table unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtFluidSaturationTable::UtFluidSaturationTable()
+    :
+    CppUnit::TestFixture(),
+    mProperties(0),
+    mArticle(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Fluid Saturation Property Table unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtFluidSaturationTable::~UtFluidSaturationTable()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidSaturationTable::setUp()
+{
+    mProperties = new DefinedFluidProperties();
+    mArticle    = new FriendlyFluidSaturationTable();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidSaturationTable::tearDown()
+{
+    delete mArticle;
+    delete mProperties;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction and lookups before initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidSaturationTable::testDefaultConstruction()
+{
+    std::cout << '\n';
+    std::cout << "--------------------------------------------------------------------------------";
+    std::cout << "\n Fluid Saturation Table 01: Default Constructor Test                    ";
+
+    CPPUNIT_ASSERT(0     == mArticle->mNumPoints);
+    CPPUNIT_ASSERT(0     == mArticle->mPressure);
+    CPPUNIT_ASSERT(0     == mArticle->mPressureSlope);
+    CPPUNIT_ASSERT(0     == mArticle->mTemperature);
+    CPPUNIT_ASSERT(0     == mArticle->mTemperatureSlope);
+    CPPUNIT_ASSERT(false == mArticle->isInitialized());
+
+    /// @test lookups return zero before initialization.
+    double slope = 1.0;
+    CPPUNIT_ASSERT(0.0 == mArticle->getSaturationPressure(300.0));
+    CPPUNIT_ASSERT(0.0 == mArticle->getSaturationPressure(slope, 300.0));
+    CPPUNIT_ASSERT(0.0 == slope);
+    CPPUNIT_ASSERT(0.0 == mArticle->getSaturationTemperature(1.0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization with valid and invalid arguments.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidSaturationTable::testInitialization()
+{
+    std::cout << "\n Fluid Saturation Table 02: Initialization Test                         ";
+
+    const FluidProperties* water = mProperties->getProperties(FluidProperties::GUNNS_WATER);
+
+    /// @test nominal initialization.
+    mArticle->initialize(water, 273.15, 373.15, 0.1, 1000.0, 101);
+    CPPUNIT_ASSERT(mArticle->isInitialized());
+    CPPUNIT_ASSERT(101 == mArticle->mNumPoints);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, mArticle->mTemperatureStep, DBL_EPSILON * 1000.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, mArticle->mMinLogPressure, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 3.0, mArticle->mMaxLogPressure, DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.04, mArticle->mLogPressureStep, DBL_EPSILON);
+    CPPUNIT_ASSERT(water->getSaturationPressure(273.15) == mArticle->mPressure[0]);
+    CPPUNIT_ASSERT(water->getSaturationPressure(373.15) == mArticle->mPressure[100]);
+    CPPUNIT_ASSERT(water->getSaturationTemperature(1000.0) == mArticle->mTemperature[100]);
+
+    /// @test invalid arguments leave the table uninitialized and de-allocated.
+    mArticle->initialize(0, 273.15, 373.15, 0.1, 1000.0, 101);
+    CPPUNIT_ASSERT(not mArticle->isInitialized());
+    CPPUNIT_ASSERT(0 == mArticle->mPressure);
+    mArticle->initialize(water, 273.15, 373.15, 0.1, 1000.0, 1);
+    CPPUNIT_ASSERT(not mArticle->isInitialized());
+    mArticle->initialize(water, 373.15, 273.15, 0.1, 1000.0, 101);
+    CPPUNIT_ASSERT(not mArticle->isInitialized());
+    mArticle->initialize(water, 273.15, 373.15, 0.0, 1000.0, 101);
+    CPPUNIT_ASSERT(not mArticle->isInitialized());
+    mArticle->initialize(water, 273.15, 373.15, 0.1, 0.1, 101);
+    CPPUNIT_ASSERT(not mArticle->isInitialized());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests lookups within and outside the table range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidSaturationTable::testLookups()
+{
+    std::cout << "\n Fluid Saturation Table 03: Lookups Test                                ";
+
+    const FluidProperties* water = mProperties->getProperties(FluidProperties::GUNNS_WATER);
+    mArticle->initialize(water, 273.15, 373.15, 0.1, 1000.0, 101);
+
+    /// @test values at the table points match the curve fits exactly.
+    CPPUNIT_ASSERT(water->getSaturationPressure(273.15 + 50.0 * mArticle->mTemperatureStep)
+                   == mArticle->getSaturationPressure(273.15 + 50.0 * mArticle->mTemperatureStep));
+
+    /// @test values and slope between table points agree closely with the curve fits.
+    double slope = 0.0;
+    const double pSat     = mArticle->getSaturationPressure(slope, 310.37);
+    const double expectedP = water->getSaturationPressure(310.37);
+    const double expectedS = (water->getSaturationPressure(310.38)
+                            - water->getSaturationPressure(310.36)) / 0.02;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedP, pSat,  expectedP * 1.0e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedS, slope, expectedS * 1.0e-4);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(water->getSaturationTemperature(6.543),
+                                 mArticle->getSaturationTemperature(6.543), 1.0e-6);
+
+    /// @test values outside the table are clamped, with zero slope.
+    CPPUNIT_ASSERT(mArticle->mPressure[0]   == mArticle->getSaturationPressure(slope, 200.0));
+    CPPUNIT_ASSERT(0.0 == slope);
+    CPPUNIT_ASSERT(mArticle->mPressure[100] == mArticle->getSaturationPressure(slope, 400.0));
+    CPPUNIT_ASSERT(0.0 == slope);
+    CPPUNIT_ASSERT(mArticle->mTemperature[0]   == mArticle->getSaturationTemperature(0.01));
+    CPPUNIT_ASSERT(mArticle->mTemperature[0]   == mArticle->getSaturationTemperature(0.0));
+    CPPUNIT_ASSERT(mArticle->mTemperature[0]   == mArticle->getSaturationTemperature(-1.0));
+    CPPUNIT_ASSERT(mArticle->mTemperature[100] == mArticle->getSaturationTemperature(1.0e4));
+
+    /// @test non-finite lookups return the lower table end.
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    slope = 1.0;
+    CPPUNIT_ASSERT(mArticle->mPressure[0]    == mArticle->getSaturationPressure(slope, nan));
+    CPPUNIT_ASSERT(0.0 == slope);
+    CPPUNIT_ASSERT(mArticle->mTemperature[0] == mArticle->getSaturationTemperature(nan));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the tables built by the defined fluid properties agree with the curve fits
+///           for all fluids across the upper part of their liquid range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidSaturationTable::testAllFluids()
+{
+    std::cout << "\n Fluid Saturation Table 04: All Fluids Test                             ";
+
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        const FluidProperties* props = mProperties->getProperties(static_cast<FluidProperties::FluidType>(i));
+
+        /// @test saturation pressure over the upper part of the liquid range, below which saturation
+        ///       pressures are negligibly small.
+        const double tCrit = props->getCriticalTemperature();
+        for (int j = 0; j < 97; ++j) {
+            const double t        = tCrit * (0.6 + 0.39 * j / 97.0);
+            const double expected = props->getSaturationPressure(t);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, props->lookupSaturationPressure(t),
+                                         expected * 1.0e-5);
+        }
+    }
+
+    std::cout << "... Pass" << std::endl;
+}
@@ -0,0 +1,80 @@
+#ifndef UtFluidSaturationTable_EXISTS
+#define UtFluidSaturationTable_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_TSM_PROPERTIES_FLUID_SATURATION_TABLE     Fluid Saturation Property Table Unit Tests
+/// @ingroup  UT_TSM_PROPERTIES
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Fluid Saturation Property Table.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "properties/FluidProperties.hh"
+#include "properties/FluidSaturationTable.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from FluidSaturationTable and befriend UtFluidSaturationTable.
+///
+/// @details  Class derived from the unit under test. It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyFluidSaturationTable : public FluidSaturationTable
+{
+    public:
+        FriendlyFluidSaturationTable() {};
+        virtual ~FriendlyFluidSaturationTable() {}
+        friend class UtFluidSaturationTable;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Saturation Property Table unit tests.
+///
+/// @details  This class provides the unit tests for the Fluid Saturation Property Table within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtFluidSaturationTable: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Fluid Saturation Property Table unit test.
+        UtFluidSaturationTable();
+        /// @brief    Default destructs this Fluid Saturation Property Table unit test.
+        virtual ~UtFluidSaturationTable();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        void testDefaultConstruction();
+        void testInitialization();
+        void testLookups();
+        void testAllFluids();
+    private:
+        CPPUNIT_TEST_SUITE(UtFluidSaturationTable);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testLookups);
+        CPPUNIT_TEST(testAllFluids);
+        CPPUNIT_TEST_SUITE_END();
+        /// --  Defined fluid properties to sample
+        DefinedFluidProperties*       mProperties;
+        /// --  Pointer to the friendly test article
+        FriendlyFluidSaturationTable* mArticle;
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtFluidSaturationTable(const UtFluidSaturationTable&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtFluidSaturationTable& operator =(const UtFluidSaturationTable&);
+};
+
+/// @}
+
+#endif
@@ -149,6 +149,42 @@ void UtSolidProperties::testPropertyAccessors()
     UT_PASS;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for Solid Properties temperature-dependent properties.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSolidProperties::testTemperatureDependence()
+{
+    UT_RESULT;
+
+    /// @test    Constant properties are returned at any temperature without a table.
+    CPPUNIT_ASSERT(!mArticle->isTemperatureDependent());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mSpecificHeat,        mArticle->getSpecificHeat(1000.0),        mTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(mThermalConductivity, mArticle->getThermalConductivity(1000.0), mTolerance);
+    CPPUNIT_ASSERT_EQUAL(0, mArticle->getTableBin(1000.0));
+    const SolidProperties* aluminum = mDefined->getProperties(SolidProperties::ALUMINUM_6061);
+    CPPUNIT_ASSERT(!aluminum->isTemperatureDependent());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(aluminum->getSpecificHeat(), aluminum->getSpecificHeat(100.0), mTolerance);
+
+    /// @test    Steel 304 table values, interpolation and bins.
+    const SolidProperties* steel = mDefined->getProperties(SolidProperties::STEEL_304);
+    CPPUNIT_ASSERT(steel->isTemperatureDependent());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(477.0, steel->getSpecificHeat(300.0),        mTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(439.5, steel->getSpecificHeat(250.0),        mTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 14.9, steel->getThermalConductivity(300.0), mTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(13.75, steel->getThermalConductivity(250.0), mTolerance);
+    CPPUNIT_ASSERT_EQUAL(0, steel->getTableBin(  50.0));
+    CPPUNIT_ASSERT_EQUAL(3, steel->getTableBin( 300.0));
+    CPPUNIT_ASSERT_EQUAL(8, steel->getTableBin(1500.0));
+
+    /// @test    Steel 304 properties are clamped to the table ends.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(272.0, steel->getSpecificHeat(  50.0),        mTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(640.0, steel->getSpecificHeat(1500.0),        mTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(  9.2, steel->getThermalConductivity(  50.0), mTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 28.0, steel->getThermalConductivity(1500.0), mTolerance);
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Test for Defined Solid Properties model.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,8 @@ class UtSolidProperties: public CppUnit::TestFixture
         void testPropertyConstruction();
         /// @brief    Test properties accessors.
         void testPropertyAccessors();
+        /// @brief    Test temperature-dependent properties.
+        void testTemperatureDependence();
         /// @brief    Test defined properties default construction.
         void testDefined();
     private:
@@ -76,6 +78,7 @@ class UtSolidProperties: public CppUnit::TestFixture
         CPPUNIT_TEST(testPropertyDefaultConstruction);
         CPPUNIT_TEST(testPropertyConstruction);
         CPPUNIT_TEST(testPropertyAccessors);
+        CPPUNIT_TEST(testTemperatureDependence);
         CPPUNIT_TEST(testDefined);
         CPPUNIT_TEST_SUITE_END();
         /// --       Type of this Solid.
@@ -11,6 +11,7 @@
 #include "UtChemicalCompound.hh"
 #include "UtChemicalReaction.hh"
 #include "UtFluidProperties.hh"
+#include "UtFluidSaturationTable.hh"
 #include "UtMaterialProperties.hh"
 #include "UtSolidProperties.hh"
 #include "UtFluidCurveFit.hh"
@@ -38,6 +39,7 @@ int main(int, char**)
     CppUnit::TextTestRunner runner;
 
     runner.addTest( UtFluidProperties::suite() );
+    runner.addTest( UtFluidSaturationTable::suite() );
     runner.addTest( UtMaterialProperties::suite() );
     runner.addTest( UtSolidProperties::suite() );
     runner.addTest( UtChemicalCompound::suite() );
@@ -0,0 +1,234 @@
+/****************************************** TRICK HEADER ******************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Background batched line writer for health & status message framework - code)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   ()
+
+LIBRARY DEPENDENCY:
+    ((TsHsAsyncWriter.o))
+
+PROGRAMMERS:
+   (
+     ((CACI) (Install) (2026-10))
+   )
+**************************************************************************************************/
+
+#include "TsHsAsyncWriter.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Constructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsAsyncWriter::TsHsAsyncWriter() :
+    mStream(0),
+    mCapacity(0),
+    mLineSize(0),
+    mSlots(0),
+    mBatch(),
+    mHead(0),
+    mCount(0),
+    mDropCount(0),
+    mBatchCount(0),
+    mRunning(false),
+    mStopping(false),
+    mThread(),
+    mMutex(),
+    mNotEmpty(),
+    mNotFull()
+{
+    pthread_mutex_init(&mMutex, NULL);
+    pthread_cond_init(&mNotEmpty, NULL);
+    pthread_cond_init(&mNotFull, NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Destructor.  Stops the writer thread, writing any queued lines.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsAsyncWriter::~TsHsAsyncWriter()
+{
+    stop();
+    cleanup();
+    pthread_cond_destroy(&mNotFull);
+    pthread_cond_destroy(&mNotEmpty);
+    pthread_mutex_destroy(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Deletes the queue memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsAsyncWriter::cleanup(void)
+{
+    delete [] mSlots;
+    mSlots = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Allocates the queue and starts the writer thread on the given stream.  If the thread
+///          can't be created, lines are written directly to the stream instead.
+///
+/// @param[in] stream    (--) The output stream.
+/// @param[in] capacity  (--) Number of line slots in the queue.
+/// @param[in] lineSize  (--) Initial size of each line slot, including the newline.
+///
+/// @return  True if the writer thread was started, else false.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsAsyncWriter::start(FILE* stream, unsigned capacity, unsigned lineSize)
+{
+    stop();
+    cleanup();
+
+    mStream   = stream;
+    mCapacity = (capacity > 0) ? capacity : 1;
+    mLineSize = (lineSize > 1) ? lineSize : 2;
+    mSlots    = new std::string[mCapacity];
+    for (unsigned i = 0; i < mCapacity; ++i)
+    {
+        mSlots[i].reserve(mLineSize);
+    }
+    mBatch.clear();
+    mBatch.reserve(mCapacity * mLineSize);
+    mHead     = 0;
+    mCount    = 0;
+    mStopping = false;
+
+    if (!mStream)
+    {
+        return false;
+    }
+
+    mRunning = (0 == pthread_create(&mThread, NULL, threadEntry, this));
+    return mRunning;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Tells the writer thread to stop, and waits for it to write any queued lines and exit.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsAsyncWriter::stop(void)
+{
+    if (!mRunning)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&mMutex);
+    mStopping = true;
+    pthread_cond_signal(&mNotEmpty);
+    pthread_mutex_unlock(&mMutex);
+
+    pthread_join(mThread, NULL);
+
+    // Release any writers still waiting for room, they'll now write directly.
+    pthread_mutex_lock(&mMutex);
+    mRunning = false;
+    pthread_cond_broadcast(&mNotFull);
+    pthread_mutex_unlock(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Copies the line into the next free queue slot and wakes the writer thread.  A line
+///          longer than the slot grows the slot rather than being truncated.
+///
+/// @param[in] line      (--) The line to write, without a newline.
+/// @param[in] length    (--) Length of the line.
+/// @param[in] blocking  (--) Wait for room if the queue is full, else drop the line.
+///
+/// @return  True if the line was queued or written, false if it was dropped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsAsyncWriter::write(const char* line, unsigned length, bool blocking)
+{
+    pthread_mutex_lock(&mMutex);
+
+    // Backpressure: wait for the writer thread to empty the queue, or drop the line.
+    while (mRunning && !mStopping && mCount == mCapacity)
+    {
+        if (!blocking)
+        {
+            mDropCount++;
+            pthread_mutex_unlock(&mMutex);
+            return false;
+        }
+        pthread_cond_wait(&mNotFull, &mMutex);
+    }
+
+    bool result = true;
+    if (mRunning && !mStopping)
+    {
+        const unsigned slot = (mHead + mCount) % mCapacity;
+        mSlots[slot].assign(line, length);
+        mSlots[slot] += '\n';
+        mCount++;
+        pthread_cond_signal(&mNotEmpty);
+    }
+    else if (mStream)
+    {
+        // No writer thread, write directly.
+        fwrite(line, 1, length, mStream);
+        fputc('\n', mStream);
+        fflush(mStream);
+    }
+    else
+    {
+        result = false;
+    }
+
+    pthread_mutex_unlock(&mMutex);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Thread entry point, runs the writer main loop.
+///
+/// @param[in] writer  (--) Pointer to the TsHsAsyncWriter.
+///
+/// @return  Always NULL.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* TsHsAsyncWriter::threadEntry(void* writer)
+{
+    static_cast<TsHsAsyncWriter*>(writer)->run();
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Waits for queued lines, moves them all into the batch buffer under the lock, then
+///          writes the batch outside of the lock so callers aren't held up by the I/O.  Exits once
+///          told to stop and the queue is empty.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsAsyncWriter::run(void)
+{
+    for (;;)
+    {
+        pthread_mutex_lock(&mMutex);
+        while (0 == mCount && !mStopping)
+        {
+            pthread_cond_wait(&mNotEmpty, &mMutex);
+        }
+        if (0 == mCount && mStopping)
+        {
+            pthread_mutex_unlock(&mMutex);
+            break;
+        }
+
+        mBatch.clear();
+        while (mCount > 0)
+        {
+            mBatch.append(mSlots[mHead]);
+            mHead = (mHead + 1) % mCapacity;
+            mCount--;
+        }
+        pthread_cond_broadcast(&mNotFull);
+        pthread_mutex_unlock(&mMutex);
+
+        fwrite(mBatch.data(), 1, mBatch.length(), mStream);
+        fflush(mStream);
+        mBatchCount++;
+    }
+}
@@ -0,0 +1,121 @@
+#ifndef TsHsAsyncWriter_EXISTS
+#define TsHsAsyncWriter_EXISTS
+
+/**
+@defgroup  TSM_UTILITIES_SIMULATION_HS_ASYNC_WRITER Asynchronous Writer
+@ingroup   TSM_UTILITIES_SIMULATION_HS
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Component of the Health & Status message framework. Writes rendered log lines to an output
+   stream in batches from a background thread, so output plugins don't do I/O on the caller's
+   thread.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Lines longer than the line slot size grow their slot and the batch buffer, which allocates
+   memory.)
+- (The writer doesn't own the output stream; the owner closes it after stopping the writer.)
+
+LIBRARY DEPENDENCY:
+- (
+   (TsHsAsyncWriter.o)
+  )
+
+PROGRAMMERS:
+- (
+    ((CACI) (Install) (2026-10))
+  )
+
+@{
+*/
+
+#include <cstdio>
+#include <string>
+#include <pthread.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Batches log lines through a bounded queue to a background writer thread.
+///
+/// @details Lines are copied into a fixed number of preallocated slots.  Each slot and the batch
+///          buffer keep their size once grown, so only a line longer than any before it allocates.  The writer thread waits
+///          for lines, moves everything queued into its own batch buffer, and writes the batch with
+///          a single fwrite and flush, so a burst of messages costs one write instead of one per
+///          message.
+///
+///          The queue is bounded.  When it is full, a blocking write waits for the writer thread to
+///          make room (backpressure), and a non-blocking write drops the line and counts it.
+///
+///          If the writer thread isn't running, lines are written directly to the stream on the
+///          caller's thread, so nothing is lost before start or after stop.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class TsHsAsyncWriter
+{
+public:
+
+    /// @brief Constructor
+    TsHsAsyncWriter();
+
+    /// @brief Destructor
+    virtual ~TsHsAsyncWriter();
+
+    /// @brief Allocates the queue and starts the writer thread on the given stream.
+    bool start(FILE* stream, unsigned capacity, unsigned lineSize);
+
+    /// @brief Writes all queued lines and stops the writer thread.
+    void stop(void);
+
+    /// @brief Queues a line for output, with a newline appended.
+    bool write(const char* line, unsigned length, bool blocking);
+
+    /// @brief Returns true if the writer thread is running.
+    bool isRunning(void) const { return mRunning; }
+
+    /// @brief Returns the number of lines dropped on a full queue.
+    unsigned getDropCount(void) const { return mDropCount; }
+
+    /// @brief Returns the number of batches written by the writer thread.
+    unsigned getBatchCount(void) const { return mBatchCount; }
+
+protected:
+
+    /// @brief Thread entry point.
+    static void* threadEntry(void* writer);
+
+    /// @brief Writer thread main loop.
+    void run(void);
+
+    /// @brief Deletes the queue memory.
+    void cleanup(void);
+
+    FILE*           mStream;     // ** (--) Output stream
+    unsigned        mCapacity;   // ** (--) Number of line slots in the queue
+    unsigned        mLineSize;   // ** (--) Initial size of each line slot, including the newline
+    std::string*    mSlots;      // ** (--) Queued line slots
+    std::string     mBatch;      // ** (--) Writer thread batch buffer
+    unsigned        mHead;       // ** (--) Index of the oldest queued line
+    unsigned        mCount;      // ** (--) Number of queued lines
+    unsigned        mDropCount;  // ** (--) Number of lines dropped on a full queue
+    unsigned        mBatchCount; // ** (--) Number of batches written by the writer thread
+    bool            mRunning;    // ** (--) The writer thread is running
+    bool            mStopping;   // ** (--) The writer thread has been told to stop
+    pthread_t       mThread;     // ** (--) Writer thread
+    pthread_mutex_t mMutex;      // ** (--) Protects the queue
+    pthread_cond_t  mNotEmpty;   // ** (--) Signaled when lines are queued or on stop
+    pthread_cond_t  mNotFull;    // ** (--) Signaled when the writer thread empties the queue
+
+private:
+
+    // Don't define these; assignment or copy of a writer is an error
+    TsHsAsyncWriter(const TsHsAsyncWriter&);
+    TsHsAsyncWriter& operator=(const TsHsAsyncWriter&);
+};
+
+/// @}
+
+#endif /* TsHsAsyncWriter_EXISTS */
@@ -15,7 +15,9 @@ ASSUMPTIONS AND LIMITATIONS:
    ()
 
 LIBRARY DEPENDENCY:
-    ((TsHsOutputPlugin.o))
+    ((TsHsOutputPlugin.o)
+     (TsHsMsgRenderer.o)
+     (TsHsAsyncWriter.o))
 
 PROGRAMMERS:
    (
@@ -24,42 +26,12 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include <iostream>
-#include <sstream>
 #include <fstream>
-#include <iomanip>
 #include "sim_services/Message/include/message_proto.h"
 #include "simulation/timer/TS_timer.h"
 #include "TS_hs_msg_types.h"
 #include "TsHsConsolePlugin.hh"
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details A local function which returns an ISO-8601 compliant timestamp.
-///
-/// @param[in] unix_time  (--) A Unix time_t value produced by calling the time() function.
-///
-/// @return  The timestamp as a std::string.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-static std::string message_timestamp(time_t* unix_time)
-{
-   using std::setw;
-   using std::setfill;
-
-   // An ISO-8601 compliant timestamp:
-   //   YYYY-MM-DDThh:mm:ssTZD (eg 1997-07-16T19:20:30+01:00)
-
-   struct tm* t = gmtime(unix_time);
-
-   std::ostringstream timestamp;
-   timestamp << std::right << setw(4) << setfill('0') << t->tm_year+1900 << "-";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_mon+1     << "-";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_mday      << "T";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_hour      << ":";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_min       << ":";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_sec       << "Z";
-
-   return timestamp.str();
-}
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Constructor
 ///
@@ -68,7 +40,9 @@ TsHsConsolePlugin::TsHsConsolePlugin(int id) :
     TsHsOutputPlugin(id),
     mTryLockFailures(0),
     mResourceLock(),
-    mBlocking(false)
+    mBlocking(false),
+    mRenderer(),
+    mWriter()
 {
     pthread_mutex_init(&mResourceLock, NULL);
 }
@@ -78,7 +52,7 @@ TsHsConsolePlugin::TsHsConsolePlugin(int id) :
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsConsolePlugin::~TsHsConsolePlugin()
 {
-    // nothing to do
+    mWriter.stop();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,6 +73,11 @@ void TsHsConsolePlugin::configure(const TsHsPluginConfig& configData)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool TsHsConsolePlugin::init(void)
 {
+    if (mEnabled && !mWriter.isRunning())
+    {
+        std::cout.flush();
+        mWriter.start(stdout, QUEUE_CAPACITY, TsHsMsgRenderer::LINE_SIZE);
+    }
     return true;
 }
 
@@ -126,8 +105,8 @@ bool TsHsConsolePlugin::restart(void)
 ///
 /// @return  True if successful, or false on failure.
 ///
-/// @note    This method opens and closes the log file each time it logs a message. Not very
-///          efficient, but perhaps more robust in multi-threaded sims - TBD?
+/// @note    The message is rendered and queued under the resource lock, so the renderer's buffer
+///          is protected, but the I/O is done later by the background writer thread.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool TsHsConsolePlugin::msg(
    const std::string&   file,
@@ -144,59 +123,13 @@ bool TsHsConsolePlugin::msg(
         return true;
     }
 
-    // Use some std things to make the code more readable
-    using std::setw;
-    using std::setfill;
-
-    std::ostringstream logentry;
-
-    // Print string for type of message
-    switch (type)
-    {
-        case TS_HS_DEBUG:   logentry << "DBG "; break;
-        case TS_HS_INFO:    logentry << "INFO"; break;
-        case TS_HS_WARNING: logentry << "WARN"; break;
-        case TS_HS_ERROR:   logentry << "ERR "; break;
-        case TS_HS_FATAL:   logentry << "FAT "; break;
-        default:            logentry << "NA  ";
-    }
-
-    // Print subsystem
-    logentry << " | " << std::left << setw(12) << subsys << " | ";
-
-    // Print MET
-    char sign = met.pre < 0 ? '-' : '+';
-
-    logentry << sign;
-    logentry << std::right << setw(3) << setfill('0') << met.day  << " ";
-    logentry << std::right << setw(2) << setfill('0') << met.hour << ":";
-    logentry << std::right << setw(2) << setfill('0') << met.min  << ":";
-    logentry << std::right << setw(2) << setfill('0') << met.sec  << " | ";
-
-    // Print Unix GMT time (a.k.a Zulu time, UTC)
-    time_t tp = timestamp;
-    std::string zulu = message_timestamp(&tp);
-    logentry << std::right << zulu << " | ";
-
-    // Print filename and line number
-    std::ostringstream location;
-    location << file << ":" << line << " ";
-    if (function.length() > 0)
-    {
-       location << function << "() ";
-    }
-
-    logentry << std::left << setw(45) << setfill(' ') << location.str() << " | ";
-
-    // Print user message
-    logentry << mtext; // << std::endl;
-
     if (mBlocking)
     {
         // We will wait if necessary, no messages will be lost.
         if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
         {
-            insertMessage(logentry.str());
+            mRenderer.render(file, line, function, type, subsys, met, timestamp, mtext);
+            insertMessage(mRenderer.getLine(), mRenderer.getLength());
             pthread_mutex_unlock(&mResourceLock);
         }
     }
@@ -205,7 +138,8 @@ bool TsHsConsolePlugin::msg(
         // Don't wait. Discard message if resource conflict.
         if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
         {
-            insertMessage(logentry.str());
+            mRenderer.render(file, line, function, type, subsys, met, timestamp, mtext);
+            insertMessage(mRenderer.getLine(), mRenderer.getLength());
             pthread_mutex_unlock(&mResourceLock);
         }
         else
@@ -218,22 +152,39 @@ bool TsHsConsolePlugin::msg(
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Shutdown the text plugin
+/// @details Queues a rendered message to the background writer.  If the writer isn't running, such
+///          as before init, the message is written directly.
+///
+/// @param[in] message  (--) The rendered message, without a newline.
+/// @param[in] length   (--) Length of the message.
+///
+/// @return  True if successful, or false if the message was dropped.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-bool TsHsConsolePlugin::insertMessage(const std::string& message)
+bool TsHsConsolePlugin::insertMessage(const char* message, unsigned length)
 {
-    std::cout << message << std::endl;
+    if (mWriter.isRunning())
+    {
+        return mWriter.write(message, length, mBlocking);
+    }
+
+    std::cout.write(message, length);
+    std::cout << std::endl;
     return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Shutdown the text plugin
+/// @details Shutdown the console plugin.  Writes all queued messages.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsConsolePlugin::shutdown(void)
 {
+    mWriter.stop();
+
     if (mTryLockFailures > 0)
     {
         message_publish(MSG_WARNING, "TsHsConsolePlugin skipped %d messages due to mutex conflicts\n", mTryLockFailures);
     }
+    if (mWriter.getDropCount() > 0)
+    {
+        message_publish(MSG_WARNING, "TsHsConsolePlugin skipped %u messages due to a full output queue\n", mWriter.getDropCount());
+    }
 }
-
@@ -15,11 +15,14 @@ REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (After init, messages are written to stdout by a background thread, so they may appear shortly
+   after they are logged.  All queued messages are written by shutdown.)
 
 LIBRARY DEPENDENCY:
 - (
    (TsHsConsolePlugin.o)
+   (TsHsMsgRenderer.o)
+   (TsHsAsyncWriter.o)
   )
 
 PROGRAMMERS:
@@ -31,16 +34,24 @@ PROGRAMMERS:
 */
 
 #include <string>
+#include "TsHsAsyncWriter.hh"
+#include "TsHsMsgRenderer.hh"
 #include "TsHsOutputPlugin.hh"
 #include "TsHsPluginConfig.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @brief An output plugin used to log messages to a text file.
+/// @brief An output plugin used to log messages to the console.
+///
+/// @details Messages are rendered into a preallocated line buffer and queued to a background
+///          writer thread, which writes them to stdout in batches.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class TsHsConsolePlugin: public TsHsOutputPlugin
 {
 public:
 
+    /// @brief Writer queue size, in messages.
+    enum {QUEUE_CAPACITY = 256};
+
     /// @brief Constructor
     TsHsConsolePlugin(int id);
 
@@ -64,11 +75,13 @@ public:
 
 protected:
 
-    bool insertMessage(const std::string& message);
+    bool insertMessage(const char* message, unsigned length);
 
     int             mTryLockFailures; // ** (--) Number of times trylock failed to get the lock (== number of dropped messages)
     pthread_mutex_t mResourceLock;    // ** (--) Mutex which controls access to database files
     bool            mBlocking;        // ** (--) Wait on mutex if true, else skip message
+    TsHsMsgRenderer mRenderer;        // ** (--) Formats messages into log lines
+    TsHsAsyncWriter mWriter;          // ** (--) Writes log lines to stdout in the background
 
 private:
 
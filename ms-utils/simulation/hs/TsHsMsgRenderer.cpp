@@ -0,0 +1,231 @@
+/****************************************** TRICK HEADER ******************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Fixed layout message renderer for health & status message framework - code)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   ()
+
+LIBRARY DEPENDENCY:
+    ((TsHsMsgRenderer.o))
+
+PROGRAMMERS:
+   (
+     ((CACI) (Install) (2026-10))
+   )
+**************************************************************************************************/
+
+#include <ctime>
+#include "TsHsMsgRenderer.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Constructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRenderer::TsHsMsgRenderer() :
+    mLine(),
+    mZuluTime(0),
+    mZuluValid(false),
+    mZulu(),
+    mZuluUpdates(0)
+{
+    mLine.reserve(LINE_SIZE - 1);
+    mZulu[0] = '\0';
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Destructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRenderer::~TsHsMsgRenderer()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Renders a health and status message into the line buffer, in the same layout that the
+///          text and console plugins previously built with formatted streams.
+///
+/// @param   [in] file      (--) name of file which initiated logging the message.
+/// @param   [in] line      (--) line of file which initiated logging the message.
+/// @param   [in] function  (--) The name of the function logging the message.
+/// @param   [in] type      (--) the type of message (e.g. info, warning, etc.).
+/// @param   [in] subsys    (--) the subsystem from which the message originated.
+/// @param   [in] met       (--) the mission-elapsed time that the message was sent.
+/// @param   [in] timestamp (--) the unix timestamp that the message was sent.
+/// @param   [in] mtext     (--) the message text.
+///
+/// @return  The length of the rendered line, not including the null terminator.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned TsHsMsgRenderer::render(
+   const std::string&   file,
+   const int            line,
+   const std::string&   function,
+   TS_HS_MSG_TYPE       type,
+   const std::string&   subsys,
+   const TS_TIMER_TYPE& met,
+   unsigned long        timestamp,
+   const std::string&   mtext)
+{
+    mLine.clear();
+
+    // Print string for type of message
+    switch (type)
+    {
+        case TS_HS_DEBUG:   append("DBG ", 4); break;
+        case TS_HS_INFO:    append("INFO", 4); break;
+        case TS_HS_WARNING: append("WARN", 4); break;
+        case TS_HS_ERROR:   append("ERR ", 4); break;
+        case TS_HS_FATAL:   append("FAT ", 4); break;
+        default:            append("NA  ", 4);
+    }
+
+    // Print subsystem
+    append(" | ", 3);
+    unsigned start = getLength();
+    append(subsys.c_str(), subsys.length());
+    padField(start, 12);
+    append(" | ", 3);
+
+    // Print MET
+    append(met.pre < 0 ? "-" : "+", 1);
+    appendInt(met.day,  3, '0');
+    append(" ", 1);
+    appendInt(met.hour, 2, '0');
+    append(":", 1);
+    appendInt(met.min,  2, '0');
+    append(":", 1);
+    appendInt(met.sec,  2, '0');
+    append(" | ", 3);
+
+    // Print Unix GMT time (a.k.a Zulu time, UTC)
+    append(zulu(timestamp), 20);
+    append(" | ", 3);
+
+    // Print filename and line number
+    start = getLength();
+    append(file.c_str(), file.length());
+    append(":", 1);
+    appendInt(line, 0, ' ');
+    append(" ", 1);
+    if (function.length() > 0)
+    {
+        append(function.c_str(), function.length());
+        append("() ", 3);
+    }
+    padField(start, 45);
+    append(" | ", 3);
+
+    // Print user message
+    append(mtext.c_str(), mtext.length());
+
+    return getLength();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns an ISO-8601 compliant timestamp of the form YYYY-MM-DDThh:mm:ssZ.  The string
+///          is cached, and only rebuilt when the time changes.
+///
+/// @param[in] timestamp  (--) A Unix time value produced by calling the time() function.
+///
+/// @return  The timestamp as a null-terminated string of 20 characters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char* TsHsMsgRenderer::zulu(unsigned long timestamp)
+{
+    if (!mZuluValid || timestamp != mZuluTime)
+    {
+        time_t    unix_time = timestamp;
+        struct tm t;
+        gmtime_r(&unix_time, &t);
+
+        // Build the fields in place, in the fixed layout YYYY-MM-DDThh:mm:ssZ.
+        const int fields[6] = {t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec};
+        const char separators[6] = {'-', '-', 'T', ':', ':', 'Z'};
+        unsigned  pos = 0;
+        for (int i = 0; i < 6; ++i)
+        {
+            unsigned value = static_cast<unsigned>(fields[i]);
+            const unsigned digits = (0 == i) ? 4 : 2;
+            for (unsigned d = digits; d > 0; --d)
+            {
+                mZulu[pos + d - 1] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+            pos += digits;
+            mZulu[pos++] = separators[i];
+        }
+        mZulu[pos] = '\0';
+
+        mZuluTime  = timestamp;
+        mZuluValid = true;
+        mZuluUpdates++;
+    }
+
+    return mZulu;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Appends characters to the line.  The line buffer keeps its size between messages, so
+///          this only grows it when the line is longer than any rendered before.
+///
+/// @param[in] str     (--) Characters to append.
+/// @param[in] length  (--) Number of characters to append.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgRenderer::append(const char* str, unsigned length)
+{
+    mLine.append(str, length);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Pads the field starting at the given line position with spaces on the right, so that
+///          it is at least the given width.  This matches std::left with std::setw.
+///
+/// @param[in] start  (--) Position in the line of the start of the field.
+/// @param[in] width  (--) Minimum width of the field.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgRenderer::padField(unsigned start, unsigned width)
+{
+    static const char spaces[] = "                                                ";
+    if (getLength() - start < width)
+    {
+        append(spaces, width - (getLength() - start));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Appends an integer in decimal, padded on the left with the fill character so that it
+///          is at least the given width.  This matches std::right with std::setw and std::setfill.
+///
+/// @param[in] value  (--) The value to append.
+/// @param[in] width  (--) Minimum width of the field.
+/// @param[in] fill   (--) Fill character.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgRenderer::appendInt(int value, unsigned width, char fill)
+{
+    // Convert from the least significant digit backwards into a scratch buffer.
+    char     digits[16];
+    unsigned pos       = sizeof(digits);
+    unsigned magnitude = (value < 0) ? 0u - static_cast<unsigned>(value) : static_cast<unsigned>(value);
+    do
+    {
+        digits[--pos] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0)
+    {
+        digits[--pos] = '-';
+    }
+
+    const unsigned length = sizeof(digits) - pos;
+    for (unsigned i = length; i < width; ++i)
+    {
+        append(&fill, 1);
+    }
+    append(&digits[pos], length);
+}
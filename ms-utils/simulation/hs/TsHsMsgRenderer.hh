@@ -0,0 +1,110 @@
+#ifndef TsHsMsgRenderer_EXISTS
+#define TsHsMsgRenderer_EXISTS
+
+/**
+@defgroup  TSM_UTILITIES_SIMULATION_HS_MSG_RENDERER Message Renderer
+@ingroup   TSM_UTILITIES_SIMULATION_HS
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Component of the Health & Status message framework. Formats messages into the fixed layout log
+   line used by the text and console output plugins, without dynamic memory allocation for lines
+   that fit in the initial line buffer size.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Rendered lines longer than the line buffer grow it, which allocates memory.)
+- (Not thread-safe; owners must serialize calls to render.)
+
+LIBRARY DEPENDENCY:
+- (
+   (TsHsMsgRenderer.o)
+  )
+
+PROGRAMMERS:
+- (
+    ((CACI) (Install) (2026-10))
+  )
+
+@{
+*/
+
+#include <string>
+
+#include "simulation/timer/TS_timer.h"
+#include "TS_hs_msg_types.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Renders health & status messages into a reused line buffer.
+///
+/// @details The line layout is the same one the text and console plugins have always written:
+///
+///          TYPE | subsystem    | +DDD HH:MM:SS | YYYY-MM-DDThh:mm:ssZ | file:line function() | text
+///
+///          Each field is copied or converted directly into the line buffer, rather than through
+///          formatted stream operations.  The buffer is reserved at construction and reused, so it
+///          only allocates when a line is longer than any before it.  The ISO-8601 zulu timestamp string is cached and only
+///          rebuilt when the message timestamp changes to a new second, so a burst of messages in
+///          the same second doesn't repeat the calendar conversion.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class TsHsMsgRenderer
+{
+public:
+
+    /// @brief Initial size of the line buffer, including the null terminator.
+    enum {LINE_SIZE = 2048};
+
+    /// @brief Constructor
+    TsHsMsgRenderer();
+
+    /// @brief Destructor
+    virtual ~TsHsMsgRenderer();
+
+    /// @brief Renders a message into the line buffer and returns the line length.
+    unsigned render(const std::string& file, const int line, const std::string& function, TS_HS_MSG_TYPE type,
+                    const std::string& subsys, const TS_TIMER_TYPE& met, unsigned long timestamp, const std::string& mtext);
+
+    /// @brief Returns the last rendered line, null-terminated.
+    const char* getLine() const { return mLine.c_str(); }
+
+    /// @brief Returns the length of the last rendered line.
+    unsigned getLength() const { return static_cast<unsigned>(mLine.length()); }
+
+    /// @brief Returns the number of times the zulu timestamp string has been rebuilt.
+    unsigned getTimestampUpdates() const { return mZuluUpdates; }
+
+protected:
+
+    /// @brief Returns the zulu timestamp string for the given Unix time, rebuilding it if needed.
+    const char* zulu(unsigned long timestamp);
+
+    /// @brief Appends characters to the line.
+    void append(const char* str, unsigned length);
+
+    /// @brief Pads the line with spaces on the right, to a minimum width of the field at the given start.
+    void padField(unsigned start, unsigned width);
+
+    /// @brief Appends an integer to the line, padded with a fill character on the left to a minimum width.
+    void appendInt(int value, unsigned width, char fill);
+
+    std::string   mLine;                // ** (--) Rendered line buffer
+    unsigned long mZuluTime;            // ** (--) Unix time of the cached zulu timestamp string
+    bool          mZuluValid;           // ** (--) The cached zulu timestamp string is valid
+    char          mZulu[32];            // ** (--) Cached zulu timestamp string
+    unsigned      mZuluUpdates;         // ** (--) Number of times the zulu timestamp string has been rebuilt
+
+private:
+
+    // Don't define these; assignment or copy of a renderer is an error
+    TsHsMsgRenderer(const TsHsMsgRenderer&);
+    TsHsMsgRenderer& operator=(const TsHsMsgRenderer&);
+};
+
+/// @}
+
+#endif /* TsHsMsgRenderer_EXISTS */
@@ -15,7 +15,9 @@ ASSUMPTIONS AND LIMITATIONS:
    ()
 
 LIBRARY DEPENDENCY:
-    ((TsHsOutputPlugin.o))
+    ((TsHsOutputPlugin.o)
+     (TsHsMsgRenderer.o)
+     (TsHsAsyncWriter.o))
 
 PROGRAMMERS:
    (
@@ -25,42 +27,12 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include <iostream>
-#include <sstream>
 #include <fstream>
-#include <iomanip>
 #include "sim_services/Message/include/message_proto.h"
 #include "simulation/timer/TS_timer.h"
 #include "TS_hs_msg_types.h"
 #include "TsHsTextPlugin.hh"
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details A local function which returns an ISO-8601 compliant timestamp.
-///
-/// @param[in] unix_time  (--) A Unix time_t value produced by calling the time() function.
-///
-/// @return  The timestamp as a std::string.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-static std::string message_timestamp(time_t* unix_time)
-{
-   using std::setw;
-   using std::setfill;
-
-   // An ISO-8601 compliant timestamp:
-   //   YYYY-MM-DDThh:mm:ssTZD (eg 1997-07-16T19:20:30+01:00)
-
-   struct tm* t = gmtime(unix_time);
-
-   std::ostringstream timestamp;
-   timestamp << std::right << setw(4) << setfill('0') << t->tm_year+1900 << "-";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_mon+1     << "-";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_mday      << "T";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_hour      << ":";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_min       << ":";
-   timestamp << std::right << setw(2) << setfill('0') << t->tm_sec       << "Z";
-
-   return timestamp.str();
-}
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Constructor
 ///
@@ -73,7 +45,10 @@ TsHsTextPlugin::TsHsTextPlugin(int id) :
     mOverwrite(true),
     mTryLockFailures(0),
     mResourceLock(),
-    mBlocking(false)
+    mBlocking(false),
+    mFile(0),
+    mRenderer(),
+    mWriter()
 {
     pthread_mutex_init(&mResourceLock, NULL);
 }
@@ -83,7 +58,11 @@ TsHsTextPlugin::TsHsTextPlugin(int id) :
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsTextPlugin::~TsHsTextPlugin()
 {
-    // nothing to do
+    mWriter.stop();
+    if (mFile)
+    {
+        fclose(mFile);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +115,16 @@ bool TsHsTextPlugin::init(void)
         }
     }
 
+    // Keep the file open for appending by the background writer.
+    if (!mWriter.isRunning())
+    {
+        mFile = fopen(mFilename.c_str(), "a");
+        if (mFile)
+        {
+            mWriter.start(mFile, QUEUE_CAPACITY, TsHsMsgRenderer::LINE_SIZE);
+        }
+    }
+
     return true;
 }
 
@@ -169,8 +158,8 @@ bool TsHsTextPlugin::restart(void)
 ///
 /// @return  True if successful, or false on failure.
 ///
-/// @note    This method opens and closes the log file each time it logs a message. Not very
-///          efficient, but perhaps more robust in multi-threaded sims - TBD?
+/// @note    The message is rendered and queued under the resource lock, so the renderer's buffer
+///          is protected, but the I/O is done later by the background writer thread.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool TsHsTextPlugin::msg(
    const std::string&   file,
@@ -187,59 +176,13 @@ bool TsHsTextPlugin::msg(
         return true;
     }
 
-    // Use some std things to make the code more readable
-    using std::setw;
-    using std::setfill;
-
-    std::ostringstream logentry;
-
-    // Print string for type of message
-    switch (type)
-    {
-        case TS_HS_DEBUG:   logentry << "DBG "; break;
-        case TS_HS_INFO:    logentry << "INFO"; break;
-        case TS_HS_WARNING: logentry << "WARN"; break;
-        case TS_HS_ERROR:   logentry << "ERR "; break;
-        case TS_HS_FATAL:   logentry << "FAT "; break;
-        default:            logentry << "NA  ";
-    }
-
-    // Print subsystem
-    logentry << " | " << std::left << setw(12) << subsys << " | ";
-
-    // Print MET
-    char sign = met.pre < 0 ? '-' : '+';
-
-    logentry << sign;
-    logentry << std::right << setw(3) << setfill('0') << met.day  << " ";
-    logentry << std::right << setw(2) << setfill('0') << met.hour << ":";
-    logentry << std::right << setw(2) << setfill('0') << met.min  << ":";
-    logentry << std::right << setw(2) << setfill('0') << met.sec  << " | ";
-
-    // Print Unix GMT time (a.k.a Zulu time, UTC)
-    time_t tp = timestamp;
-    std::string zulu = message_timestamp(&tp);
-    logentry << std::right << zulu << " | ";
-
-    // Print filename and line number
-    std::ostringstream location;
-    location << file << ":" << line << " ";
-    if (function.length() > 0)
-    {
-       location << function << "() ";
-    }
-
-    logentry << std::left << setw(45) << setfill(' ') << location.str() << " | ";
-
-    // Print user message
-    logentry << mtext; // << std::endl;
-
     if (mBlocking)
     {
         // We will wait if necessary, no messages will be lost.
         if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
         {
-            insertMessage(logentry.str());
+            mRenderer.render(file, line, function, type, subsys, met, timestamp, mtext);
+            insertMessage(mRenderer.getLine(), mRenderer.getLength());
             pthread_mutex_unlock(&mResourceLock);
         }
     }
@@ -248,7 +191,8 @@ bool TsHsTextPlugin::msg(
         // Don't wait. Discard message if resource conflict.
         if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
         {
-            insertMessage(logentry.str());
+            mRenderer.render(file, line, function, type, subsys, met, timestamp, mtext);
+            insertMessage(mRenderer.getLine(), mRenderer.getLength());
             pthread_mutex_unlock(&mResourceLock);
         }
         else
@@ -261,10 +205,21 @@ bool TsHsTextPlugin::msg(
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Shutdown the text plugin
+/// @details Queues a rendered message to the background writer.  If the writer isn't running, such
+///          as before init, the file is opened and the message appended directly.
+///
+/// @param[in] message  (--) The rendered message, without a newline.
+/// @param[in] length   (--) Length of the message.
+///
+/// @return  True if successful, or false if the message was dropped.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-bool TsHsTextPlugin::insertMessage(const std::string& message)
+bool TsHsTextPlugin::insertMessage(const char* message, unsigned length)
 {
+    if (mWriter.isRunning())
+    {
+        return mWriter.write(message, length, mBlocking);
+    }
+
     // Open the file in append mode
     std::ofstream logfile(mFilename.c_str(), std::ios::out | std::ios::app);
 
@@ -275,7 +230,8 @@ bool TsHsTextPlugin::insertMessage(const std::string& message)
         return false;
     }
 
-    logfile << message << std::endl;
+    logfile.write(message, length);
+    logfile << std::endl;
 
     // Close logfile
     logfile.close();
@@ -284,13 +240,23 @@ bool TsHsTextPlugin::insertMessage(const std::string& message)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Shutdown the text plugin
+/// @details Shutdown the text plugin.  Writes all queued messages and closes the file.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsTextPlugin::shutdown(void)
 {
+    mWriter.stop();
+    if (mFile)
+    {
+        fclose(mFile);
+        mFile = 0;
+    }
+
     if (mTryLockFailures > 0)
     {
         message_publish(MSG_WARNING, "TsHsTextPlugin skipped %d messages due to mutex conflicts\n", mTryLockFailures);
     }
+    if (mWriter.getDropCount() > 0)
+    {
+        message_publish(MSG_WARNING, "TsHsTextPlugin skipped %u messages due to a full output queue\n", mWriter.getDropCount());
+    }
 }
-
@@ -16,11 +16,14 @@ REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (Messages are written to the file by a background thread, so a message may not be in the file
+   until shortly after it is logged.  All queued messages are written by shutdown.)
 
 LIBRARY DEPENDENCY:
 - (
    (TsHsTextPlugin.o)
+   (TsHsMsgRenderer.o)
+   (TsHsAsyncWriter.o)
   )
 
 PROGRAMMERS:
@@ -32,17 +35,27 @@ PROGRAMMERS:
 @{
 */
 
+#include <cstdio>
 #include <string>
+#include "TsHsAsyncWriter.hh"
+#include "TsHsMsgRenderer.hh"
 #include "TsHsOutputPlugin.hh"
 #include "TsHsPluginConfig.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief An output plugin used to log messages to a text file.
+///
+/// @details Messages are rendered into a preallocated line buffer and queued to a background
+///          writer thread, which appends them to the file in batches.  The file is kept open from
+///          init to shutdown.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class TsHsTextPlugin: public TsHsOutputPlugin
 {
 public:
 
+    /// @brief Writer queue size, in messages.
+    enum {QUEUE_CAPACITY = 256};
+
     /// @brief Constructor
     TsHsTextPlugin(int id);
 
@@ -66,7 +79,7 @@ public:
 
 protected:
 
-    bool insertMessage(const std::string& message);
+    bool insertMessage(const char* message, unsigned length);
 
     std::string     mFilename;        // ** (--) Output file name
     bool            mFirstpass;       // ** (--) Used to determine when to create a new file
@@ -74,6 +87,9 @@ protected:
     int             mTryLockFailures; // ** (--) Number of times trylock failed to get the lock (== number of dropped messages)
     pthread_mutex_t mResourceLock;    // ** (--) Mutex which controls access to database files
     bool            mBlocking;        // ** (--) Wait on mutex if true, else skip message
+    FILE*           mFile;            // ** (--) Output file, open while the writer is running
+    TsHsMsgRenderer mRenderer;        // ** (--) Formats messages into log lines
+    TsHsAsyncWriter mWriter;          // ** (--) Writes log lines to the file in the background
 
 private:
 
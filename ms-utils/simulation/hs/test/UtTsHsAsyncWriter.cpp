@@ -0,0 +1,160 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsAsyncWriter class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsAsyncWriter.o)
+)
+
+PROGRAMMERS:
+(
+    ((CACI) (Install) (2026-10))
+)
+*******************************************************************************/
+
+#include <sstream>
+#include "UtTsHsAsyncWriter.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the beginning of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsAsyncWriter::setUp()
+{
+    writer = new TsHsAsyncWriter();
+    stream = tmpfile();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the end of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsAsyncWriter::tearDown()
+{
+    delete writer;
+    fclose(stream);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns everything written to the temporary stream so far.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string UtTsHsAsyncWriter::contents()
+{
+    fflush(stream);
+    rewind(stream);
+    std::string result;
+    char buffer[256];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), stream)) > 0)
+    {
+        result.append(buffer, n);
+    }
+    fseek(stream, 0, SEEK_END);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test construction and starting of the writer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsAsyncWriter::testConstructors()
+{
+    CPPUNIT_ASSERT_EQUAL(false, writer->isRunning());
+    CPPUNIT_ASSERT_EQUAL(0u,    writer->getDropCount());
+    CPPUNIT_ASSERT_EQUAL(0u,    writer->getBatchCount());
+
+    // Nothing to write to before start.
+    CPPUNIT_ASSERT_EQUAL(false, writer->write("x", 1, true));
+
+    // Can't start without a stream.
+    CPPUNIT_ASSERT_EQUAL(false, writer->start(0, 4, 16));
+    CPPUNIT_ASSERT_EQUAL(false, writer->isRunning());
+
+    CPPUNIT_ASSERT_EQUAL(true,  writer->start(stream, 4, 16));
+    CPPUNIT_ASSERT_EQUAL(true,  writer->isRunning());
+    writer->stop();
+    CPPUNIT_ASSERT_EQUAL(false, writer->isRunning());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test lines are all written in order by the writer thread, with newlines appended and
+///          lines longer than the slot size written whole.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsAsyncWriter::testWrite()
+{
+    writer->start(stream, 4, 16);
+
+    std::ostringstream expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        std::ostringstream line;
+        line << "line " << i;
+        CPPUNIT_ASSERT_EQUAL(true, writer->write(line.str().c_str(), line.str().length(), true));
+        expected << line.str() << "\n";
+    }
+    CPPUNIT_ASSERT_EQUAL(true, writer->write("0123456789abcdefghij", 20, true));
+    expected << "0123456789abcdefghij\n";
+    CPPUNIT_ASSERT_EQUAL(true, writer->write("short", 5, true));
+    expected << "short\n";
+
+    writer->stop();
+    CPPUNIT_ASSERT_EQUAL(expected.str(), contents());
+    CPPUNIT_ASSERT_EQUAL(0u, writer->getDropCount());
+    CPPUNIT_ASSERT(writer->getBatchCount() > 0);
+    CPPUNIT_ASSERT(writer->getBatchCount() <= 102);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test lines are written directly to the stream after the writer is stopped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsAsyncWriter::testDirectWrite()
+{
+    writer->start(stream, 4, 16);
+    writer->write("queued", 6, false);
+    writer->stop();
+
+    CPPUNIT_ASSERT_EQUAL(true, writer->write("direct", 6, false));
+    CPPUNIT_ASSERT_EQUAL(std::string("queued\ndirect\n"), contents());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test a full queue drops non-blocking lines, and blocking lines wait for room.  The
+///          writer thread can't empty the queue while this thread holds the stream lock.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsAsyncWriter::testBackpressure()
+{
+    writer->start(stream, 2, 16);
+
+    // Hold the stream so the writer thread blocks in its first batch write, then fill the queue.
+    flockfile(stream);
+    writer->write("a", 1, false);
+    unsigned written = 1;
+    unsigned dropped = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (writer->write("b", 1, false))
+        {
+            written++;
+        }
+        else
+        {
+            dropped++;
+        }
+    }
+    funlockfile(stream);
+
+    CPPUNIT_ASSERT(dropped > 0);
+    CPPUNIT_ASSERT_EQUAL(dropped, writer->getDropCount());
+
+    // Blocking writes never drop.
+    for (int i = 0; i < 100; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(true, writer->write("c", 1, true));
+        written++;
+    }
+    writer->stop();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2 * written), contents().length());
+    CPPUNIT_ASSERT_EQUAL(dropped, writer->getDropCount());
+}
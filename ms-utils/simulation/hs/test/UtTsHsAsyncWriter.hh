@@ -0,0 +1,67 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsAsyncWriter class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsAsyncWriter.o)
+)
+
+PROGRAMMERS:
+(
+    ((CACI) (Install) (2026-10))
+)
+*******************************************************************************/
+#ifndef UtTsHsAsyncWriter_EXISTS
+#define UtTsHsAsyncWriter_EXISTS
+
+#include <cstdio>
+#include <string>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "TsHsAsyncWriter.hh"
+
+/// @brief Unit test for TsHsAsyncWriter, i.e. the health and status background line writer
+class UtTsHsAsyncWriter: public CppUnit::TestFixture
+{
+public:
+
+    // Ctor not really needed here, but gets rid of some compiler warnings
+    UtTsHsAsyncWriter() : CppUnit::TestFixture(), writer(0), stream(0) {}
+
+    void setUp();
+    void tearDown();
+
+    void testConstructors();
+    void testWrite();
+    void testDirectWrite();
+    void testBackpressure();
+
+private:
+
+    CPPUNIT_TEST_SUITE(UtTsHsAsyncWriter);
+
+    CPPUNIT_TEST(testConstructors);
+    CPPUNIT_TEST(testWrite);
+    CPPUNIT_TEST(testDirectWrite);
+    CPPUNIT_TEST(testBackpressure);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // Returns everything written to the stream so far.
+    std::string contents();
+
+    // Data members
+    TsHsAsyncWriter* writer;
+    FILE*            stream;
+
+    // Disable these to prevent compiler warnings about them being not implemented
+    UtTsHsAsyncWriter(const UtTsHsAsyncWriter&);
+    const UtTsHsAsyncWriter& operator=(const UtTsHsAsyncWriter&);
+};
+
+#endif /* UtTsHsAsyncWriter_EXISTS */
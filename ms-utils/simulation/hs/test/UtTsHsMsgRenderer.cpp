@@ -0,0 +1,168 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsMsgRenderer class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsMsgRenderer.o)
+)
+
+PROGRAMMERS:
+(
+    ((CACI) (Install) (2026-10))
+)
+*******************************************************************************/
+
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include "UtTsHsMsgRenderer.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the beginning of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRenderer::setUp()
+{
+    renderer = new TsHsMsgRenderer();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the end of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRenderer::tearDown()
+{
+    delete renderer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Reference formatting, copied from the text & console plugins before they used the
+///          renderer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string UtTsHsMsgRenderer::streamFormat(
+   const std::string&   file,
+   const int            line,
+   const std::string&   function,
+   TS_HS_MSG_TYPE       type,
+   const std::string&   subsys,
+   const TS_TIMER_TYPE& met,
+   unsigned long        timestamp,
+   const std::string&   mtext)
+{
+    using std::setw;
+    using std::setfill;
+
+    std::ostringstream logentry;
+    switch (type)
+    {
+        case TS_HS_DEBUG:   logentry << "DBG "; break;
+        case TS_HS_INFO:    logentry << "INFO"; break;
+        case TS_HS_WARNING: logentry << "WARN"; break;
+        case TS_HS_ERROR:   logentry << "ERR "; break;
+        case TS_HS_FATAL:   logentry << "FAT "; break;
+        default:            logentry << "NA  ";
+    }
+    logentry << " | " << std::left << setw(12) << subsys << " | ";
+
+    char sign = met.pre < 0 ? '-' : '+';
+    logentry << sign;
+    logentry << std::right << setw(3) << setfill('0') << met.day  << " ";
+    logentry << std::right << setw(2) << setfill('0') << met.hour << ":";
+    logentry << std::right << setw(2) << setfill('0') << met.min  << ":";
+    logentry << std::right << setw(2) << setfill('0') << met.sec  << " | ";
+
+    time_t tp = timestamp;
+    struct tm* t = gmtime(&tp);
+    std::ostringstream zulu;
+    zulu << std::right << setw(4) << setfill('0') << t->tm_year+1900 << "-";
+    zulu << std::right << setw(2) << setfill('0') << t->tm_mon+1     << "-";
+    zulu << std::right << setw(2) << setfill('0') << t->tm_mday      << "T";
+    zulu << std::right << setw(2) << setfill('0') << t->tm_hour      << ":";
+    zulu << std::right << setw(2) << setfill('0') << t->tm_min       << ":";
+    zulu << std::right << setw(2) << setfill('0') << t->tm_sec       << "Z";
+    logentry << std::right << zulu.str() << " | ";
+
+    std::ostringstream location;
+    location << file << ":" << line << " ";
+    if (function.length() > 0)
+    {
+       location << function << "() ";
+    }
+    logentry << std::left << setw(45) << setfill(' ') << location.str() << " | ";
+    logentry << mtext;
+    return logentry.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the rendered line matches the stream formatted line for each message type, with
+///          short and long fields, with and without a function name.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRenderer::testLayout()
+{
+    TS_TIMER_TYPE met = {1, 7, 3, 45, 9, 0.0, 0};
+    const TS_HS_MSG_TYPE types[6] = {TS_HS_DEBUG, TS_HS_INFO, TS_HS_WARNING, TS_HS_ERROR, TS_HS_FATAL,
+                                     static_cast<TS_HS_MSG_TYPE>(99)};
+
+    for (int i = 0; i < 6; ++i)
+    {
+        const std::string expected = streamFormat("file.cpp", 42, "func", types[i], "GUNNS", met,
+                                                  1234567890UL, "a message");
+        CPPUNIT_ASSERT_EQUAL(static_cast<unsigned>(expected.length()),
+                             renderer->render("file.cpp", 42, "func", types[i], "GUNNS", met,
+                                              1234567890UL, "a message"));
+        CPPUNIT_ASSERT_EQUAL(expected, std::string(renderer->getLine()));
+    }
+
+    // Negative MET, no function, fields longer than their widths.
+    met.pre = -1;
+    met.day = 1234;
+    const std::string longFile(60, 'f');
+    const std::string longSubsys("A_LONG_SUBSYSTEM_NAME");
+    std::string expected = streamFormat(longFile, -7, "", TS_HS_WARNING, longSubsys, met, 0UL, "");
+    renderer->render(longFile, -7, "", TS_HS_WARNING, longSubsys, met, 0UL, "");
+    CPPUNIT_ASSERT_EQUAL(expected, std::string(renderer->getLine()));
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned>(expected.length()), renderer->getLength());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the zulu timestamp string is only rebuilt when the timestamp changes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRenderer::testTimestampCache()
+{
+    TS_TIMER_TYPE met = {1, 0, 0, 0, 0, 0.0, 0};
+    CPPUNIT_ASSERT_EQUAL(0u, renderer->getTimestampUpdates());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        renderer->render("file.cpp", i, "func", TS_HS_INFO, "GUNNS", met, 1000000000UL, "burst");
+    }
+    CPPUNIT_ASSERT_EQUAL(1u, renderer->getTimestampUpdates());
+
+    const std::string expected = streamFormat("file.cpp", 1, "func", TS_HS_INFO, "GUNNS", met,
+                                              1000000001UL, "next second");
+    renderer->render("file.cpp", 1, "func", TS_HS_INFO, "GUNNS", met, 1000000001UL, "next second");
+    CPPUNIT_ASSERT_EQUAL(2u, renderer->getTimestampUpdates());
+    CPPUNIT_ASSERT_EQUAL(expected, std::string(renderer->getLine()));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test a message text longer than the initial line buffer is rendered whole and
+///          null-terminated, and a following short message still renders correctly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRenderer::testLongMessage()
+{
+    TS_TIMER_TYPE met = {1, 0, 0, 0, 0, 0.0, 0};
+    const std::string longText(3 * TsHsMsgRenderer::LINE_SIZE, 'x');
+
+    std::string expected = streamFormat("file.cpp", 1, "func", TS_HS_INFO, "GUNNS", met, 0UL, longText);
+    const unsigned length = renderer->render("file.cpp", 1, "func", TS_HS_INFO, "GUNNS", met, 0UL, longText);
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned>(expected.length()), length);
+    CPPUNIT_ASSERT_EQUAL(expected, std::string(renderer->getLine()));
+
+    expected = streamFormat("file.cpp", 2, "func", TS_HS_INFO, "GUNNS", met, 0UL, "short");
+    renderer->render("file.cpp", 2, "func", TS_HS_INFO, "GUNNS", met, 0UL, "short");
+    CPPUNIT_ASSERT_EQUAL(expected, std::string(renderer->getLine()));
+}
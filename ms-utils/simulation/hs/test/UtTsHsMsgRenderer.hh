@@ -0,0 +1,64 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsMsgRenderer class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsMsgRenderer.o)
+)
+
+PROGRAMMERS:
+(
+    ((CACI) (Install) (2026-10))
+)
+*******************************************************************************/
+#ifndef UtTsHsMsgRenderer_EXISTS
+#define UtTsHsMsgRenderer_EXISTS
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "TsHsMsgRenderer.hh"
+
+/// @brief Unit test for TsHsMsgRenderer, i.e. the health and status message line formatter
+class UtTsHsMsgRenderer: public CppUnit::TestFixture
+{
+public:
+
+    // Ctor not really needed here, but gets rid of some compiler warnings
+    UtTsHsMsgRenderer() : CppUnit::TestFixture(), renderer(0) {}
+
+    void setUp();
+    void tearDown();
+
+    void testLayout();
+    void testTimestampCache();
+    void testLongMessage();
+
+private:
+
+    CPPUNIT_TEST_SUITE(UtTsHsMsgRenderer);
+
+    CPPUNIT_TEST(testLayout);
+    CPPUNIT_TEST(testTimestampCache);
+    CPPUNIT_TEST(testLongMessage);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // Returns the line as the plugins formerly built it with formatted streams.
+    static std::string streamFormat(const std::string& file, const int line, const std::string& function,
+                                    TS_HS_MSG_TYPE type, const std::string& subsys, const TS_TIMER_TYPE& met,
+                                    unsigned long timestamp, const std::string& mtext);
+
+    // Data members
+    TsHsMsgRenderer* renderer;
+
+    // Disable these to prevent compiler warnings about them being not implemented
+    UtTsHsMsgRenderer(const UtTsHsMsgRenderer&);
+    const UtTsHsMsgRenderer& operator=(const UtTsHsMsgRenderer&);
+};
+
+#endif /* UtTsHsMsgRenderer_EXISTS */
@@ -0,0 +1,373 @@
+/**
+@file
+@brief     High-Resolution Timing Service implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+    (())
+*/
+
+#include "TsTimingService.hh"
+
+#include <cstring>
+#include <iomanip>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  The recorded durations of all regions by a single thread.  Only the owning thread
+///           writes to this.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct TsTimingThreadData
+{
+    uint64_t     mCount[TsTimingService::MAX_REGIONS];                           /**< (--) Number of durations of each region. */
+    uint64_t     mTotal[TsTimingService::MAX_REGIONS];                           /**< (--) Sum of durations of each region, in ticks. */
+    uint64_t     mMax[TsTimingService::MAX_REGIONS];                             /**< (--) Largest duration of each region, in ticks. */
+    unsigned int mHistogram[TsTimingService::MAX_REGIONS][TsTimingService::NUM_BUCKETS]; /**< (--) Duration histogram of each region. */
+};
+
+/// @details  The calling thread's accumulators, or null until its first record.
+static __thread TsTimingThreadData* tsTimingThisThread = 0;
+
+pthread_mutex_t             TsTimingService::sMutex = PTHREAD_MUTEX_INITIALIZER;
+char                        TsTimingService::sRegionNames[MAX_REGIONS][NAME_LENGTH];
+int                         TsTimingService::sNumRegions = 0;
+TsTimingService::Backend    TsTimingService::sBackend = TsTimingService::MONOTONIC;
+double                      TsTimingService::sSecondsPerTick = 1.0e-9;
+TsTimingThreadData*         TsTimingService::sThreadData[MAX_THREADS];
+int                         TsTimingService::sNumThreads = 0;
+uint64_t                    TsTimingService::sDropped = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this High-Resolution Timing Service Region Statistics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsTimingStats::TsTimingStats()
+    :
+    mCount(0),
+    mTotal(0.0),
+    mMean(0.0),
+    mP50(0.0),
+    mP99(0.0),
+    mMax(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Although never instantiated, Trick 10 requires a public destructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsTimingService::~TsTimingService()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--) Name of the region, truncated to NAME_LENGTH - 1 characters.
+///
+/// @returns  int (--) Id of the region, or -1 if there are already MAX_REGIONS regions.
+///
+/// @details  Adds a region with the given name, or returns the id of the existing region with that
+///           name.  This is safe to call from static initializers, since the registration data is
+///           constant-initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int TsTimingService::addRegion(const char* name)
+{
+    pthread_mutex_lock(&sMutex);
+    int result = -1;
+    for (int i = 0; i < sNumRegions; ++i) {
+        if (0 == strncmp(name, sRegionNames[i], NAME_LENGTH - 1)) {
+            result = i;
+            break;
+        }
+    }
+    if (result < 0 and sNumRegions < MAX_REGIONS) {
+        strncpy(sRegionNames[sNumRegions], name, NAME_LENGTH - 1);
+        sRegionNames[sNumRegions][NAME_LENGTH - 1] = '\0';
+        result = sNumRegions++;
+    }
+    pthread_mutex_unlock(&sMutex);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of regions.
+///
+/// @details  Returns the number of regions that have been added.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int TsTimingService::getNumRegions()
+{
+    return sNumRegions;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  region  (--) Region id.
+///
+/// @returns  const char* (--) Name of the region, or an empty string for an invalid id.
+///
+/// @details  Returns the name of the given region.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char* TsTimingService::getRegionName(const int region)
+{
+    if (region < 0 or region >= sNumRegions) {
+        return "";
+    }
+    return sRegionNames[region];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  backend  (--) The clock backend to select.
+///
+/// @returns  bool (--) True if the backend was selected, false if it isn't available here.
+///
+/// @details  Selects the clock backend and resets all accumulators, since their ticks are no longer
+///           comparable.  Selecting the TSC measures its rate against the monotonic clock for about
+///           10 milliseconds.  This should not be called while any scopes are open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsTimingService::setBackend(const Backend backend)
+{
+    bool result = true;
+    if (TSC == backend) {
+#if defined(__x86_64__) || defined(__i386__)
+        const uint64_t ns0  = monotonicNs();
+        const uint64_t tsc0 = __rdtsc();
+        uint64_t ns1 = ns0;
+        while (ns1 - ns0 < 10000000ULL) {
+            ns1 = monotonicNs();
+        }
+        const uint64_t tsc1 = __rdtsc();
+        if (tsc1 > tsc0) {
+            sSecondsPerTick = 1.0e-9 * static_cast<double>(ns1 - ns0) / static_cast<double>(tsc1 - tsc0);
+            sBackend        = TSC;
+        } else {
+            result = false;
+        }
+#else
+        result = false;
+#endif
+    } else {
+        sSecondsPerTick = 1.0e-9;
+        sBackend        = MONOTONIC;
+    }
+    reset();
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  Backend (--) The selected clock backend.
+///
+/// @details  Returns the selected clock backend.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsTimingService::Backend TsTimingService::getBackend()
+{
+    return sBackend;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (s) The monotonic clock time.
+///
+/// @details  Returns the POSIX monotonic clock time in seconds, regardless of the backend.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double TsTimingService::getSeconds()
+{
+    return 1.0e-9 * static_cast<double>(monotonicNs());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  TsTimingThreadData* (--) The calling thread's accumulators, or null if there are too
+///                                    many threads.
+///
+/// @details  Returns the calling thread's accumulators, allocating and registering them on the
+///           thread's first call.  The accumulators live for the life of the process, so that their
+///           statistics remain available after the thread exits.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsTimingThreadData* TsTimingService::getThreadData()
+{
+    if (not tsTimingThisThread) {
+        pthread_mutex_lock(&sMutex);
+        if (sNumThreads < MAX_THREADS) {
+            tsTimingThisThread = new TsTimingThreadData();
+            memset(tsTimingThisThread, 0, sizeof(TsTimingThreadData));
+            sThreadData[sNumThreads++] = tsTimingThisThread;
+        }
+        pthread_mutex_unlock(&sMutex);
+    }
+    return tsTimingThisThread;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  ticks  (--) Duration in backend ticks.
+///
+/// @returns  int (--) The histogram bucket index.
+///
+/// @details  Durations below SUB_BUCKETS ticks get their own buckets.  Above that, each power of 2
+///           is divided into SUB_BUCKETS buckets, using the two bits below the most significant bit.
+///           Durations past the last bucket are clamped into it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int TsTimingService::getBucket(const uint64_t ticks)
+{
+    if (ticks < static_cast<uint64_t>(SUB_BUCKETS)) {
+        return static_cast<int>(ticks);
+    }
+    const int msb    = 63 - __builtin_clzll(ticks);
+    const int bucket = SUB_BUCKETS * (msb - 1) + static_cast<int>((ticks >> (msb - 2)) & 3);
+    return (bucket < NUM_BUCKETS) ? bucket : NUM_BUCKETS - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  bucket  (--) The histogram bucket index.
+///
+/// @returns  uint64_t (--) The smallest duration in the bucket, in backend ticks.
+///
+/// @details  Returns the inverse of getBucket for the smallest duration in the bucket.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t TsTimingService::getBucketFloor(const int bucket)
+{
+    if (bucket < SUB_BUCKETS) {
+        return static_cast<uint64_t>(bucket);
+    }
+    const int msb = bucket / SUB_BUCKETS + 1;
+    return static_cast<uint64_t>(SUB_BUCKETS + bucket % SUB_BUCKETS) << (msb - 2);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  region  (--) Region id from addRegion.
+/// @param[in]  ticks   (--) Duration in backend ticks.
+///
+/// @details  Adds the duration to the calling thread's accumulators of the region.  This takes no
+///           locks after the thread's first call.  Invalid region ids are ignored.  A duration that
+///           wrapped below zero, which can happen if the TSC isn't synchronized across cores and
+///           the thread migrated, is recorded as zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsTimingService::record(const int region, const uint64_t ticks)
+{
+    if (region < 0 or region >= MAX_REGIONS) {
+        return;
+    }
+    TsTimingThreadData* data = getThreadData();
+    if (not data) {
+        __sync_fetch_and_add(&sDropped, 1);
+        return;
+    }
+    const uint64_t duration = (ticks >> 63) ? 0 : ticks;
+    data->mCount[region] += 1;
+    data->mTotal[region] += duration;
+    if (duration > data->mMax[region]) {
+        data->mMax[region] = duration;
+    }
+    data->mHistogram[region][getBucket(duration)] += 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] stats   (--) The statistics of the region.
+/// @param[in]  region  (--) Region id from addRegion.
+///
+/// @details  Merges the accumulators of all threads for the region, and estimates the percentiles
+///           as the middle of the histogram bucket containing them, limited to the maximum.
+///           Outputs are zero for an invalid region id or a region with no durations.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsTimingService::getStats(TsTimingStats& stats, const int region)
+{
+    stats = TsTimingStats();
+    if (region < 0 or region >= MAX_REGIONS) {
+        return;
+    }
+
+    /// - Merge all threads' accumulators.
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t max   = 0;
+    uint64_t histogram[NUM_BUCKETS];
+    memset(histogram, 0, sizeof(histogram));
+    const int numThreads = sNumThreads;
+    for (int t = 0; t < numThreads; ++t) {
+        const TsTimingThreadData* data = sThreadData[t];
+        count += data->mCount[region];
+        total += data->mTotal[region];
+        if (data->mMax[region] > max) {
+            max = data->mMax[region];
+        }
+        for (int b = 0; b < NUM_BUCKETS; ++b) {
+            histogram[b] += data->mHistogram[region][b];
+        }
+    }
+    if (0 == count) {
+        return;
+    }
+
+    /// - Find the buckets containing the percentiles.
+    const uint64_t rank50 = (count * 50 + 99) / 100;
+    const uint64_t rank99 = (count * 99 + 99) / 100;
+    uint64_t p50   = max;
+    uint64_t p99   = max;
+    uint64_t cumulative = 0;
+    bool     found50 = false;
+    for (int b = 0; b < NUM_BUCKETS; ++b) {
+        cumulative += histogram[b];
+        const uint64_t middle = (b + 1 < NUM_BUCKETS)
+                              ? (getBucketFloor(b) + getBucketFloor(b + 1)) / 2 : getBucketFloor(b);
+        if (not found50 and cumulative >= rank50) {
+            p50     = (middle < max) ? middle : max;
+            found50 = true;
+        }
+        if (cumulative >= rank99) {
+            p99 = (middle < max) ? middle : max;
+            break;
+        }
+    }
+
+    stats.mCount = count;
+    stats.mTotal = ticksToSeconds(total);
+    stats.mMean  = stats.mTotal / static_cast<double>(count);
+    stats.mP50   = ticksToSeconds(p50);
+    stats.mP99   = ticksToSeconds(p99);
+    stats.mMax   = ticksToSeconds(max);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  stream  (--) The stream to write to.
+///
+/// @details  Writes one line per region with its count and its total, mean, p50, p99 and maximum
+///           durations in microseconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsTimingService::report(std::ostream& stream)
+{
+    const std::ios_base::fmtflags flags = stream.flags();
+    stream << std::left << std::setw(NAME_LENGTH) << "region" << std::right
+           << std::setw(12) << "count"
+           << std::setw(14) << "total (us)"
+           << std::setw(12) << "mean (us)"
+           << std::setw(12) << "p50 (us)"
+           << std::setw(12) << "p99 (us)"
+           << std::setw(12) << "max (us)" << std::endl;
+    stream << std::fixed << std::setprecision(3);
+    const int numRegions = sNumRegions;
+    for (int i = 0; i < numRegions; ++i) {
+        TsTimingStats stats;
+        getStats(stats, i);
+        stream << std::left << std::setw(NAME_LENGTH) << sRegionNames[i] << std::right
+               << std::setw(12) << stats.mCount
+               << std::setw(14) << stats.mTotal * 1.0e6
+               << std::setw(12) << stats.mMean  * 1.0e6
+               << std::setw(12) << stats.mP50   * 1.0e6
+               << std::setw(12) << stats.mP99   * 1.0e6
+               << std::setw(12) << stats.mMax   * 1.0e6 << std::endl;
+    }
+    if (sDropped > 0) {
+        stream << sDropped << " durations dropped from threads past " << MAX_THREADS << std::endl;
+    }
+    stream.flags(flags);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Clears all threads' accumulators.  Regions are kept.  Durations recorded by other
+///           threads during the reset may be partially lost.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsTimingService::reset()
+{
+    pthread_mutex_lock(&sMutex);
+    for (int t = 0; t < sNumThreads; ++t) {
+        memset(sThreadData[t], 0, sizeof(TsTimingThreadData));
+    }
+    sDropped = 0;
+    pthread_mutex_unlock(&sMutex);
+}
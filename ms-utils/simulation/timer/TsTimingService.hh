@@ -0,0 +1,269 @@
+#ifndef TsTimingService_EXISTS
+#define TsTimingService_EXISTS
+
+/**
+@file
+@brief     High-Resolution Timing Service declarations
+
+@defgroup  TSM_UTILITIES_SIMULATION_TIMER_TIMING_SERVICE  High-Resolution Timing Service
+@ingroup   TSM_UTILITIES_SIMULATION_TIMER
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Provides low-overhead wall-clock timing of named code regions, with per-thread accumulation and
+   duration histograms, for frame-overrun diagnostics that can stay enabled in production.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Regions should be added during initialization, before the threads that record them start.)
+- (The TSC backend is only available on x86 and assumes an invariant TSC, synchronized across
+   cores, as on all recent x86 processors.)
+- (Statistics read while other threads are recording may be slightly inconsistent with each other,
+   since recording takes no locks.)
+- (Percentiles are estimated from log-scale histogram buckets, with about 20% resolution.)
+- (Defining TS_TIMING_DISABLED at compile time removes all TS_TIMING_SCOPE instrumentation.)
+
+LIBRARY DEPENDENCY:
+- ((TsTimingService.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+#include <iostream>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    High-Resolution Timing Service Region Statistics
+///
+/// @details  Statistics of the recorded durations of one timing region, merged across all threads.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct TsTimingStats
+{
+    public:
+        uint64_t mCount; /**< (--) Number of recorded durations. */
+        double   mTotal; /**< (s)  Sum of the recorded durations. */
+        double   mMean;  /**< (s)  Mean of the recorded durations. */
+        double   mP50;   /**< (s)  Estimated median of the recorded durations. */
+        double   mP99;   /**< (s)  Estimated 99th percentile of the recorded durations. */
+        double   mMax;   /**< (s)  Largest recorded duration. */
+        /// @brief  Default constructs this High-Resolution Timing Service Region Statistics.
+        TsTimingStats();
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    High-Resolution Timing Service Per-Thread Accumulators
+///
+/// @details  The recorded durations of all regions by a single thread.  Only the owning thread
+///           writes to this, so recording needs no locks or atomic operations.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct TsTimingThreadData;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    High-Resolution Timing Service
+///
+/// @details  A collection of static methods for timing named code regions.  Regions are added once
+///           by name, returning an id that is then passed to record, usually through a
+///           TsTimingScope.  Each thread records into its own accumulators, allocated on its first
+///           record, holding the count, total and maximum of the durations in each region and a
+///           histogram of them in log-scale buckets.  Reading the statistics merges all threads'
+///           accumulators, and is only done on demand.
+///
+///           Timestamps are in ticks of the selected backend: either nanoseconds of the POSIX
+///           monotonic clock (clock_gettime), or the x86 time-stamp counter, which is cheaper to
+///           read and is calibrated against the monotonic clock when selected.  Switching backends
+///           resets the accumulators.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class TsTimingService
+{
+    public:
+        /// @brief  Enumeration of the clock backends.
+        enum Backend {
+            MONOTONIC = 0, ///< POSIX monotonic clock, in nanoseconds.
+            TSC       = 1  ///< x86 time-stamp counter.
+        };
+        /// @brief  Maximum number of regions.
+        static const int MAX_REGIONS  = 64;
+        /// @brief  Maximum number of recording threads.
+        static const int MAX_THREADS  = 64;
+        /// @brief  Maximum length of region names, including the terminating null.
+        static const int NAME_LENGTH  = 64;
+        /// @brief  Number of histogram sub-buckets per power of 2.
+        static const int SUB_BUCKETS  = 4;
+        /// @brief  Number of histogram buckets, spanning durations up to 2^33 ticks.
+        static const int NUM_BUCKETS  = 4 * 32;
+        /// @brief  Adds a region with the given name, or finds the existing region of that name.
+        static int         addRegion(const char* name);
+        /// @brief  Returns the number of regions.
+        static int         getNumRegions();
+        /// @brief  Returns the name of the given region.
+        static const char* getRegionName(const int region);
+        /// @brief  Selects the clock backend.
+        static bool        setBackend(const Backend backend);
+        /// @brief  Returns the selected clock backend.
+        static Backend     getBackend();
+        /// @brief  Returns the current time in backend ticks.
+        static uint64_t    now();
+        /// @brief  Returns the current monotonic clock time in seconds.
+        static double      getSeconds();
+        /// @brief  Converts a duration in backend ticks to seconds.
+        static double      ticksToSeconds(const uint64_t ticks);
+        /// @brief  Records a duration of the given region by the calling thread.
+        static void        record(const int region, const uint64_t ticks);
+        /// @brief  Gets the statistics of the given region, merged across all threads.
+        static void        getStats(TsTimingStats& stats, const int region);
+        /// @brief  Writes a table of all regions' statistics to the given stream.
+        static void        report(std::ostream& stream);
+        /// @brief  Clears all threads' accumulators.
+        static void        reset();
+        /// @brief  Returns the histogram bucket of the given duration.
+        static int         getBucket(const uint64_t ticks);
+        /// @brief  Returns the smallest duration in the given histogram bucket.
+        static uint64_t    getBucketFloor(const int bucket);
+        /// @brief  Although never instantiated, Trick 10 requires a public destructor.
+        virtual ~TsTimingService();
+
+    protected:
+        static pthread_mutex_t     sMutex;                              /**< ** (--)   Guards region & thread registration. */
+        static char                sRegionNames[MAX_REGIONS][NAME_LENGTH]; /**< ** (--) Region names. */
+        static int                 sNumRegions;                         /**< ** (--)   Number of regions. */
+        static Backend             sBackend;                            /**< ** (--)   Selected clock backend. */
+        static double              sSecondsPerTick;                     /**< ** (s)    Duration of one backend tick. */
+        static TsTimingThreadData* sThreadData[MAX_THREADS];            /**< ** (--)   Accumulators of each recording thread. */
+        static int                 sNumThreads;                         /**< ** (--)   Number of recording threads. */
+        static uint64_t            sDropped;                            /**< ** (--)   Durations not recorded due to too many threads. */
+        /// @brief  Returns the calling thread's accumulators, allocating them on first use.
+        static TsTimingThreadData* getThreadData();
+        /// @brief  Returns the monotonic clock time in nanoseconds.
+        static uint64_t            monotonicNs();
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Default constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        TsTimingService();
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        TsTimingService(const TsTimingService&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        TsTimingService& operator =(const TsTimingService&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    High-Resolution Timing Service Scope
+///
+/// @details  Records the duration of its own lifetime to the given region.  Scopes may be nested,
+///           in which case the outer region's durations include the inner regions'.  Use the
+///           TS_TIMING_SCOPE macro instead of this class directly, so that the instrumentation can
+///           be compiled out.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class TsTimingScope
+{
+    public:
+        /// @brief  Constructs this scope, starting its timer.
+        explicit TsTimingScope(const int region);
+        /// @brief  Destructs this scope, recording its duration.
+        ~TsTimingScope();
+
+    private:
+        const int      mRegion; /**< (--) Region to record to. */
+        const uint64_t mStart;  /**< (--) Start time in backend ticks. */
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        TsTimingScope(const TsTimingScope&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        TsTimingScope& operator =(const TsTimingScope&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Times the rest of the enclosing block to the given region id, or does nothing when
+///           TS_TIMING_DISABLED is defined.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TS_TIMING_DISABLED
+#define TS_TIMING_SCOPE(name, region) \
+TsTimingScope name(region)
+#else
+#define TS_TIMING_SCOPE(name, region)
+#endif
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  uint64_t (ns) The monotonic clock time.
+///
+/// @details  Returns the POSIX monotonic clock time in nanoseconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint64_t TsTimingService::monotonicNs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  uint64_t (--) The current time in backend ticks.
+///
+/// @details  Reads the selected backend's clock.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint64_t TsTimingService::now()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (TSC == sBackend) {
+        return __rdtsc();
+    }
+#endif
+    return monotonicNs();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  ticks  (--) Duration in backend ticks.
+///
+/// @returns  double (s) The duration in seconds.
+///
+/// @details  Converts a duration in backend ticks to seconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsTimingService::ticksToSeconds(const uint64_t ticks)
+{
+    return static_cast<double>(ticks) * sSecondsPerTick;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  region  (--) Region id from TsTimingService::addRegion.
+///
+/// @details  Starts this scope's timer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline TsTimingScope::TsTimingScope(const int region)
+    :
+    mRegion(region),
+    mStart(TsTimingService::now())
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Records the duration since construction to this scope's region.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline TsTimingScope::~TsTimingScope()
+{
+    TsTimingService::record(mRegion, TsTimingService::now() - mStart);
+}
+
+#endif
@@ -0,0 +1,308 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+    ((simulation/timer/TsTimingService.o))
+*/
+
+#include "UtTsTimingService.hh"
+
+#include <sstream>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this High-Resolution Timing Service unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtTsTimingService::UtTsTimingService()
+    :
+    CppUnit::TestFixture()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this High-Resolution Timing Service unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtTsTimingService::~UtTsTimingService()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::setUp()
+{
+    TsTimingService::setBackend(TsTimingService::MONOTONIC);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::tearDown()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests adding regions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::testRegions()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtTsTimingService 01: testRegions ....................................";
+
+    /// @test new regions get new ids, and existing names return their existing id.
+    const int numRegions = TsTimingService::getNumRegions();
+    const int regionA    = TsTimingService::addRegion("testRegions A");
+    const int regionB    = TsTimingService::addRegion("testRegions B");
+    CPPUNIT_ASSERT(numRegions     == regionA);
+    CPPUNIT_ASSERT(numRegions + 1 == regionB);
+    CPPUNIT_ASSERT(regionA        == TsTimingService::addRegion("testRegions A"));
+    CPPUNIT_ASSERT(numRegions + 2 == TsTimingService::getNumRegions());
+    CPPUNIT_ASSERT(std::string("testRegions B") == TsTimingService::getRegionName(regionB));
+
+    /// @test invalid region ids have empty names and are ignored by record.
+    CPPUNIT_ASSERT(std::string("") == TsTimingService::getRegionName(-1));
+    CPPUNIT_ASSERT(std::string("") == TsTimingService::getRegionName(TsTimingService::MAX_REGIONS));
+    CPPUNIT_ASSERT_NO_THROW(TsTimingService::record(-1, 1));
+    CPPUNIT_ASSERT_NO_THROW(TsTimingService::record(TsTimingService::MAX_REGIONS, 1));
+
+    /// @test long names are truncated.
+    const std::string longName(100, 'x');
+    const int regionC = TsTimingService::addRegion(longName.c_str());
+    CPPUNIT_ASSERT(longName.substr(0, TsTimingService::NAME_LENGTH - 1)
+                   == TsTimingService::getRegionName(regionC));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the histogram buckets.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::testBuckets()
+{
+    std::cout << "\n UtTsTimingService 02: testBuckets ....................................";
+
+    /// @test small durations get their own buckets.
+    for (uint64_t ticks = 0; ticks < 8; ++ticks) {
+        CPPUNIT_ASSERT(static_cast<int>(ticks) == TsTimingService::getBucket(ticks));
+        CPPUNIT_ASSERT(ticks == TsTimingService::getBucketFloor(static_cast<int>(ticks)));
+    }
+
+    /// @test each bucket's floor is in that bucket, and the tick before it is in the bucket before.
+    for (int bucket = 1; bucket < TsTimingService::NUM_BUCKETS; ++bucket) {
+        const uint64_t floor = TsTimingService::getBucketFloor(bucket);
+        CPPUNIT_ASSERT(bucket     == TsTimingService::getBucket(floor));
+        CPPUNIT_ASSERT(bucket - 1 == TsTimingService::getBucket(floor - 1));
+    }
+    CPPUNIT_ASSERT(12 == TsTimingService::getBucket(16));
+    CPPUNIT_ASSERT(15 == TsTimingService::getBucket(31));
+
+    /// @test huge durations are clamped into the last bucket.
+    CPPUNIT_ASSERT(TsTimingService::NUM_BUCKETS - 1 == TsTimingService::getBucket(~0ULL >> 1));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests recording and statistics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::testStats()
+{
+    std::cout << "\n UtTsTimingService 03: testStats ......................................";
+
+    const int region = TsTimingService::addRegion("testStats");
+
+    /// @test a region with no durations has zero statistics.
+    TsTimingStats stats;
+    TsTimingService::getStats(stats, region);
+    CPPUNIT_ASSERT(0   == stats.mCount);
+    CPPUNIT_ASSERT(0.0 == stats.mMax);
+
+    /// @test 98 durations of 1000 ns, 1 of 2000 ns and 1 of 1000000 ns.
+    for (int i = 0; i < 98; ++i) {
+        TsTimingService::record(region, 1000);
+    }
+    TsTimingService::record(region, 2000);
+    TsTimingService::record(region, 1000000);
+    TsTimingService::getStats(stats, region);
+    CPPUNIT_ASSERT(100 == stats.mCount);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.1000e-3,  stats.mTotal, 1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.1000e-5,  stats.mMean,  1.0e-17);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0e-6,     stats.mP50,   0.2e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0e-6,     stats.mP99,   0.4e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0e-3,     stats.mMax,   1.0e-15);
+
+    /// @test a wrapped negative duration is recorded as zero.
+    TsTimingService::record(region, ~0ULL);
+    TsTimingService::getStats(stats, region);
+    CPPUNIT_ASSERT(101 == stats.mCount);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0e-3, stats.mMax, 1.0e-15);
+
+    /// @test reset clears the statistics but keeps the region.
+    TsTimingService::reset();
+    TsTimingService::getStats(stats, region);
+    CPPUNIT_ASSERT(0 == stats.mCount);
+    CPPUNIT_ASSERT(std::string("testStats") == TsTimingService::getRegionName(region));
+
+    /// @test an invalid region has zero statistics.
+    TsTimingService::getStats(stats, -1);
+    CPPUNIT_ASSERT(0 == stats.mCount);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests timing scopes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::testScope()
+{
+    std::cout << "\n UtTsTimingService 04: testScope ......................................";
+
+    const int outer = TsTimingService::addRegion("testScope outer");
+    const int inner = TsTimingService::addRegion("testScope inner");
+
+    /// @test nested scopes each record one duration, and the outer includes the inner.
+    const double start = TsTimingService::getSeconds();
+    {
+        TS_TIMING_SCOPE(outerScope, outer);
+        for (int i = 0; i < 3; ++i) {
+            TS_TIMING_SCOPE(innerScope, inner);
+            const double innerStart = TsTimingService::getSeconds();
+            while (TsTimingService::getSeconds() - innerStart < 1.0e-4) {
+                // busy wait
+            }
+        }
+    }
+    const double elapsed = TsTimingService::getSeconds() - start;
+
+    TsTimingStats outerStats;
+    TsTimingStats innerStats;
+    TsTimingService::getStats(outerStats, outer);
+    TsTimingService::getStats(innerStats, inner);
+    CPPUNIT_ASSERT(1 == outerStats.mCount);
+    CPPUNIT_ASSERT(3 == innerStats.mCount);
+    CPPUNIT_ASSERT(innerStats.mMax   >= 1.0e-4);
+    CPPUNIT_ASSERT(outerStats.mTotal >= innerStats.mTotal);
+    CPPUNIT_ASSERT(outerStats.mTotal <= elapsed);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Thread function for testThreads, records 1000 durations of 100 ns to the region.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* recordThread(void* region)
+{
+    for (int i = 0; i < 1000; ++i) {
+        TsTimingService::record(*static_cast<int*>(region), 100);
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests merging of multiple threads' accumulators.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::testThreads()
+{
+    std::cout << "\n UtTsTimingService 05: testThreads ....................................";
+
+    int region = TsTimingService::addRegion("testThreads");
+
+    /// @test all threads' durations are merged.
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i) {
+        pthread_create(&threads[i], 0, recordThread, &region);
+    }
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], 0);
+    }
+    TsTimingService::record(region, 200);
+
+    TsTimingStats stats;
+    TsTimingService::getStats(stats, region);
+    CPPUNIT_ASSERT(4001 == stats.mCount);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(400200.0e-9, stats.mTotal, 1.0e-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(200.0e-9,    stats.mMax,   1.0e-18);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0e-9,    stats.mP50,   20.0e-9);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the clock backends.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::testBackends()
+{
+    std::cout << "\n UtTsTimingService 06: testBackends ...................................";
+
+    const int region = TsTimingService::addRegion("testBackends");
+
+    /// @test the monotonic backend is in nanoseconds and never goes backwards.
+    CPPUNIT_ASSERT(TsTimingService::MONOTONIC == TsTimingService::getBackend());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0e-9, TsTimingService::ticksToSeconds(1), 0.0);
+    const uint64_t t0 = TsTimingService::now();
+    CPPUNIT_ASSERT(TsTimingService::now() >= t0);
+
+    /// @test the TSC backend, where available, times a known wait to within 10%.
+    TsTimingService::record(region, 1);
+    if (TsTimingService::setBackend(TsTimingService::TSC)) {
+        CPPUNIT_ASSERT(TsTimingService::TSC == TsTimingService::getBackend());
+
+        /// @test switching backends resets the accumulators.
+        TsTimingStats stats;
+        TsTimingService::getStats(stats, region);
+        CPPUNIT_ASSERT(0 == stats.mCount);
+
+        {
+            TS_TIMING_SCOPE(scope, region);
+            const double start = TsTimingService::getSeconds();
+            while (TsTimingService::getSeconds() - start < 0.02) {
+                // busy wait
+            }
+        }
+        TsTimingService::getStats(stats, region);
+        CPPUNIT_ASSERT(1 == stats.mCount);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.02, stats.mMax, 0.002);
+    } else {
+        CPPUNIT_ASSERT(TsTimingService::MONOTONIC == TsTimingService::getBackend());
+    }
+
+    /// @test switching back to the monotonic backend.
+    CPPUNIT_ASSERT(TsTimingService::setBackend(TsTimingService::MONOTONIC));
+    CPPUNIT_ASSERT(TsTimingService::MONOTONIC == TsTimingService::getBackend());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0e-9, TsTimingService::ticksToSeconds(1), 0.0);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the report.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsTimingService::testReport()
+{
+    std::cout << "\n UtTsTimingService 07: testReport .....................................";
+
+    const int region = TsTimingService::addRegion("testReport");
+    TsTimingService::record(region, 5000);
+
+    /// @test the report has a header line and a line for each region, including this one.
+    std::ostringstream stream;
+    TsTimingService::report(stream);
+    const std::string report = stream.str();
+    CPPUNIT_ASSERT(std::string::npos != report.find("p99 (us)"));
+    const size_t line = report.find("testReport");
+    CPPUNIT_ASSERT(std::string::npos != line);
+    CPPUNIT_ASSERT(std::string::npos != report.find("5.000", line));
+    int lines = 0;
+    for (size_t i = 0; i < report.size(); ++i) {
+        if ('\n' == report[i]) {
+            ++lines;
+        }
+    }
+    CPPUNIT_ASSERT(TsTimingService::getNumRegions() + 1 == lines);
+
+    std::cout << "... Pass" << std::endl;
+}
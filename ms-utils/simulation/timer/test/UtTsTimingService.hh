@@ -0,0 +1,73 @@
+#ifndef UtTsTimingService_EXISTS
+#define UtTsTimingService_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_TSM_SIMULATION_TIMER_TIMING_SERVICE  High-Resolution Timing Service Unit Tests
+/// @ingroup  UT_TSM_SIMULATION_TIMER
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the High-Resolution Timing Service.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "simulation/timer/TsTimingService.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    High-Resolution Timing Service unit tests.
+///
+/// @details  This class provides the unit tests for the High-Resolution Timing Service within the
+///           CPPUnit framework.  Since the service is static, each test uses its own regions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtTsTimingService: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this High-Resolution Timing Service unit test.
+        UtTsTimingService();
+        /// @brief    Default destructs this High-Resolution Timing Service unit test.
+        virtual ~UtTsTimingService();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests adding regions.
+        void testRegions();
+        /// @brief    Tests the histogram buckets.
+        void testBuckets();
+        /// @brief    Tests recording and statistics.
+        void testStats();
+        /// @brief    Tests timing scopes.
+        void testScope();
+        /// @brief    Tests merging of multiple threads' accumulators.
+        void testThreads();
+        /// @brief    Tests the clock backends.
+        void testBackends();
+        /// @brief    Tests the report.
+        void testReport();
+    private:
+        CPPUNIT_TEST_SUITE(UtTsTimingService);
+        CPPUNIT_TEST(testRegions);
+        CPPUNIT_TEST(testBuckets);
+        CPPUNIT_TEST(testStats);
+        CPPUNIT_TEST(testScope);
+        CPPUNIT_TEST(testThreads);
+        CPPUNIT_TEST(testBackends);
+        CPPUNIT_TEST(testReport);
+        CPPUNIT_TEST_SUITE_END();
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtTsTimingService(const UtTsTimingService&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtTsTimingService& operator =(const UtTsTimingService&);
+};
+
+/// @}
+
+#endif
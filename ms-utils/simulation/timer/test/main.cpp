@@ -0,0 +1,38 @@
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+#include <cppunit/ui/text/TestRunner.h>
+
+#include "UtTsTimingService.hh"
+
+#include <cppunit/XmlOutputter.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+int main() {
+    // Informs test-listener about testresults
+    CPPUNIT_NS::TestResult testresult;
+
+    // Register listener for collecting the test-results
+    CPPUNIT_NS::TestResultCollector collectedResults;
+    testresult.addListener(&collectedResults);
+
+    // Register listener for per-test progress output
+    CPPUNIT_NS::BriefTestProgressListener progress;
+    testresult.addListener(&progress);
+
+    CppUnit::TextTestRunner runner;
+    runner.addTest(UtTsTimingService::suite());
+    runner.run(testresult);
+    // Output results in compiler format
+    CPPUNIT_NS::CompilerOutputter compilerOutputter(&collectedResults, std::cout);
+    compilerOutputter.write();
+
+    // Output results in XML for Jenkins xUnit Plugin
+    std::ofstream xmlFileOut("ts-models_ms-utils_simulation_timerTestResults.xml");
+    CppUnit::XmlOutputter xmlOut(&collectedResults, xmlFileOut);
+    xmlOut.write();
+
+    return 0;
+}
+
@@ -0,0 +1,173 @@
+/***************************************** TRICK HEADER ********************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ PURPOSE:
+     (Running statistics and rate conversion of the samples arriving on a Sim Bus queued input.)
+
+ REQUIREMENTS:
+     ()
+
+ REFERENCE:
+     ()
+
+ ASSUMPTIONS AND LIMITATIONS:
+     ()
+
+LIBRARY DEPENDENCY:
+     ((simulation/hs/TsHsMsg.o)
+      (software/exceptions/TsInitializationException.o)
+      (software/exceptions/TsOutOfBoundsException.o))
+
+ PROGRAMMERS:
+     ((CACI) (Install) (2026-10))
+ **************************************************************************************************/
+
+#include "SimBusQueueAdapter.hh"
+#include "simulation/hs/TsHsMsg.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsOutOfBoundsException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Sim Bus Queue Adapter, with zero-order hold conversion.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SimBusQueueAdapter::SimBusQueueAdapter()
+    :
+    mConversion(ZERO_ORDER_HOLD),
+    mProducerPeriod(1),
+    mCount(0),
+    mSum(0.0),
+    mMin(0.0),
+    mMax(0.0),
+    mPulse(false),
+    mRisingEdges(0),
+    mLastPulse(false),
+    mHasSample(false),
+    mLatest(0.0),
+    mPrevious(0.0),
+    mFramesSinceSample(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Sim Bus Queue Adapter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SimBusQueueAdapter::~SimBusQueueAdapter()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param    conversion      --  Input The rate conversion method
+/// @param    producerPeriod  --  Input The number of consumer frames per producer sample
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes the rate conversion and resets all statistics and held samples.  Throws an
+///           exception if the producer period is not > 0.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SimBusQueueAdapter::initialize(const ConversionType conversion, const int producerPeriod)
+{
+    if (producerPeriod < 1) {
+        TsHsMsg(TS_HS_ERROR, "Utilities", "producerPeriod argument is not > 0.");
+        throw TsInitializationException("Invalid Initialization Data",
+                "SimBusQueueAdapter::initialize", "producerPeriod argument is not > 0.");
+    }
+    mConversion     = conversion;
+    mProducerPeriod = producerPeriod;
+    reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Begins a consumer frame.  The frame statistics are cleared, and the held samples and
+///           pulse state are kept for the rate conversion and edge detection.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SimBusQueueAdapter::beginFrame()
+{
+    mCount       = 0;
+    mSum         = 0.0;
+    mMin         = 0.0;
+    mMax         = 0.0;
+    mPulse       = false;
+    mRisingEdges = 0;
+    if (mFramesSinceSample < mProducerPeriod) {
+        ++mFramesSinceSample;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param    queueValues  --  Input A pointer to the queue values array
+/// @param    queueSize    --  Input The most recent number of values to add
+///
+/// @details  Adds the queueSize'd most recent values in the queue array, in the order they arrived.
+///           The queue array has the most recent value first.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SimBusQueueAdapter::pushQueue(const double* queueValues, const int queueSize)
+{
+    for (int i = queueSize - 1; i >= 0; --i) {
+        push(queueValues[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param    queueValues  --  Input A pointer to the queue boolean array
+/// @param    queueSize    --  Input The most recent number of values to add
+///
+/// @details  Adds the queueSize'd most recent pulses in the queue array, in the order they arrived.
+///           The queue array has the most recent value first.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SimBusQueueAdapter::pushPulseQueue(const bool* queueValues, const int queueSize)
+{
+    for (int i = queueSize - 1; i >= 0; --i) {
+        pushPulse(queueValues[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Resets all statistics, held samples and pulse state, as if no samples had arrived.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SimBusQueueAdapter::reset()
+{
+    beginFrame();
+    mLastPulse         = false;
+    mHasSample         = false;
+    mLatest            = 0.0;
+    mPrevious          = 0.0;
+    mFramesSinceSample = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  --  The average of the samples this frame
+///
+/// @throws   TsOutOfBoundsException
+///
+/// @details  Returns the average of the samples pushed since the start of the frame.  Throws an
+///           exception if there are no samples this frame, like SimBusQutils::getAverage.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double SimBusQueueAdapter::getAverage() const
+{
+    if (mCount < 1) {
+        TsHsMsg(TS_HS_ERROR, "Utilities", "no samples this frame.");
+        throw TsOutOfBoundsException("Invalid Calling Arguments", "SimBusQueueAdapter::getAverage",
+                "no samples this frame.");
+    }
+    return mSum / mCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  --  The sample converted to the consumer rate
+///
+/// @details  Returns the most recent sample for zero-order hold.  For linear conversion, returns the
+///           interpolation from the previous sample to the most recent sample by the fraction of the
+///           producer period elapsed since the most recent sample arrived, reaching the most recent
+///           sample one producer period after it arrived.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double SimBusQueueAdapter::getValue() const
+{
+    if (LINEAR == mConversion) {
+        const double fraction = static_cast<double>(mFramesSinceSample) / mProducerPeriod;
+        return mPrevious + fraction * (mLatest - mPrevious);
+    }
+    return mLatest;
+}
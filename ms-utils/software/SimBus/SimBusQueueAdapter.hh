@@ -0,0 +1,234 @@
+#ifndef SimBusQueueAdapter_EXISTS
+#define SimBusQueueAdapter_EXISTS
+/**
+@defgroup  TSM_UTILITIES_SOFTWARE_SIMBUS_QUEUE_ADAPTER    Sim Bus Queue Adapter
+@ingroup   TSM_UTILITIES_SOFTWARE_SIMBUS
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (This class keeps running statistics of the samples arriving on a Sim Bus queued input, and
+   converts them between the producer and consumer rates.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Sim Bus queues are ordered with the most recent value first, as in SimBusQutils.)
+- (Linear rate conversion interpolates between the last two samples over the producer period, so
+   it lags the producer by one sample.)
+
+LIBRARY_DEPENDENCY:
+- ((SimBusQueueAdapter.o))
+
+PROGRAMMERS:
+- ((CACI) (Install) (2026-10))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Sim Bus Queue Adapter
+///
+/// @details  The SimBusQutils methods rescan the queue array on every call.  This instead updates
+///           the sum, minimum, maximum and pulse edges of the consumer frame as each sample is
+///           pushed, so every query afterwards costs the same regardless of the queue size.  The
+///           owning model calls beginFrame at the start of each of its frames, then pushes the
+///           frame's new samples, either one at a time or as a whole Sim Bus queue.
+///
+///           When the producer is faster than the consumer, getAverage and getLatest give the
+///           decimated and held values.  When the producer is slower, getValue converts the
+///           samples to the consumer rate by zero-order hold or by linear interpolation over the
+///           producer period, given as a number of consumer frames.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class SimBusQueueAdapter
+{
+    TS_MAKE_SIM_COMPATIBLE(SimBusQueueAdapter);
+    public:
+        /// @brief    Enumeration of the rate conversion methods.
+        enum ConversionType {
+            ZERO_ORDER_HOLD = 0, ///< Hold the latest sample.
+            LINEAR          = 1  ///< Interpolate between the last two samples.
+        };
+        /// @brief    Default constructs this Sim Bus Queue Adapter.
+        SimBusQueueAdapter();
+        /// @brief    Default destructs this Sim Bus Queue Adapter.
+        virtual ~SimBusQueueAdapter();
+        /// @brief    Initializes this Sim Bus Queue Adapter with the rate conversion.
+        void   initialize(const ConversionType conversion = ZERO_ORDER_HOLD,
+                          const int            producerPeriod = 1);
+        /// @brief    Begins a consumer frame, clearing the frame statistics.
+        void   beginFrame();
+        /// @brief    Adds a sample to the frame statistics.
+        void   push(const double value);
+        /// @brief    Adds a pulse sample to the frame statistics and pulse edges.
+        void   pushPulse(const bool value);
+        /// @brief    Adds the queueSize most recent values in a queue, oldest first.
+        void   pushQueue(const double* queueValues, const int queueSize);
+        /// @brief    Adds the queueSize most recent pulses in a queue, oldest first.
+        void   pushPulseQueue(const bool* queueValues, const int queueSize);
+        /// @brief    Resets all statistics and held samples.
+        void   reset();
+        /// @brief    Returns the number of samples this frame.
+        int    getCount() const;
+        /// @brief    Returns the most recent sample.
+        double getLatest() const;
+        /// @brief    Returns the sum of the samples this frame.
+        double getSum() const;
+        /// @brief    Returns the average of the samples this frame.
+        double getAverage() const;
+        /// @brief    Returns the minimum sample this frame.
+        double getMin() const;
+        /// @brief    Returns the maximum sample this frame.
+        double getMax() const;
+        /// @brief    Returns whether any pulse sample this frame was high.
+        bool   isPulseHigh() const;
+        /// @brief    Returns the number of pulse rising edges this frame.
+        int    getRisingEdges() const;
+        /// @brief    Returns the sample converted to the consumer rate.
+        double getValue() const;
+
+    protected:
+        ConversionType mConversion;        /**< (--)                     Rate conversion method. */
+        int            mProducerPeriod;    /**< (--)                     Consumer frames per producer sample. */
+        int            mCount;             /**< (--) trick_chkpnt_io(**) Number of samples this frame. */
+        double         mSum;               /**< (--) trick_chkpnt_io(**) Sum of the samples this frame. */
+        double         mMin;               /**< (--) trick_chkpnt_io(**) Minimum sample this frame. */
+        double         mMax;               /**< (--) trick_chkpnt_io(**) Maximum sample this frame. */
+        bool           mPulse;             /**< (--) trick_chkpnt_io(**) A pulse sample this frame was high. */
+        int            mRisingEdges;       /**< (--) trick_chkpnt_io(**) Number of pulse rising edges this frame. */
+        bool           mLastPulse;         /**< (--) trick_chkpnt_io(**) The most recent pulse sample. */
+        bool           mHasSample;         /**< (--) trick_chkpnt_io(**) A sample has been received. */
+        double         mLatest;            /**< (--) trick_chkpnt_io(**) The most recent sample. */
+        double         mPrevious;          /**< (--) trick_chkpnt_io(**) The sample before the most recent. */
+        int            mFramesSinceSample; /**< (--) trick_chkpnt_io(**) Consumer frames since the most recent sample. */
+
+    private:
+        /// @brief    Copy constructor unavailable since declared private and not implemented.
+        SimBusQueueAdapter(const SimBusQueueAdapter& that);
+        /// @brief    Assignment operator unavailable since declared private and not implemented.
+        SimBusQueueAdapter& operator =(const SimBusQueueAdapter& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param    value  --  Input The sample value
+///
+/// @details  Adds a sample to the frame statistics and makes it the most recent sample.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void SimBusQueueAdapter::push(const double value)
+{
+    if (0 == mCount) {
+        mMin = value;
+        mMax = value;
+    } else if (value < mMin) {
+        mMin = value;
+    } else if (value > mMax) {
+        mMax = value;
+    }
+    mSum += value;
+    ++mCount;
+
+    mPrevious          = mHasSample ? mLatest : value;
+    mLatest            = value;
+    mHasSample         = true;
+    mFramesSinceSample = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param    value  --  Input The pulse sample
+///
+/// @details  Counts a rising edge if the pulse goes high from the most recent pulse sample, and adds
+///           the pulse to the frame statistics as 1 for high or 0 for low.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void SimBusQueueAdapter::pushPulse(const bool value)
+{
+    if (value) {
+        mPulse = true;
+        if (not mLastPulse) {
+            ++mRisingEdges;
+        }
+    }
+    mLastPulse = value;
+    push(value ? 1.0 : 0.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  --  The number of samples this frame
+///
+/// @details  Returns the number of samples pushed since the start of the frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int SimBusQueueAdapter::getCount() const
+{
+    return mCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  --  The most recent sample
+///
+/// @details  Returns the most recent sample, held from earlier frames if none arrived this frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double SimBusQueueAdapter::getLatest() const
+{
+    return mLatest;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  --  The sum of the samples this frame
+///
+/// @details  Returns the sum of the samples pushed since the start of the frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double SimBusQueueAdapter::getSum() const
+{
+    return mSum;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  --  The minimum sample this frame
+///
+/// @details  Returns the minimum sample this frame, or the most recent sample if none arrived this
+///           frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double SimBusQueueAdapter::getMin() const
+{
+    return (mCount > 0) ? mMin : mLatest;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  --  The maximum sample this frame
+///
+/// @details  Returns the maximum sample this frame, or the most recent sample if none arrived this
+///           frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double SimBusQueueAdapter::getMax() const
+{
+    return (mCount > 0) ? mMax : mLatest;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  --  Indicates if any pulse sample this frame was high
+///
+/// @details  Returns whether any pulse sample pushed since the start of the frame was high.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool SimBusQueueAdapter::isPulseHigh() const
+{
+    return mPulse;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  --  The number of pulse rising edges this frame
+///
+/// @details  Returns the number of times the pulse went high since the start of the frame,
+///           including from the last pulse sample of the previous frames.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int SimBusQueueAdapter::getRisingEdges() const
+{
+    return mRisingEdges;
+}
+
+#endif
@@ -30,7 +30,9 @@ PROGRAMMERS:
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Sim Bus Queue Utilities
 ///
-/// @details  A collection of methods commonly used to extract data from a sim bus data queue.
+/// @details  A collection of methods commonly used to extract data from a sim bus data queue.  These
+///           rescan the queue on each call; models making several queries of a queue each frame, or
+///           converting between producer and consumer rates, can use a SimBusQueueAdapter instead.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class SimBusQutils
 {
@@ -0,0 +1,237 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((software/SimBus/SimBusQueueAdapter.o)
+     (software/SimBus/SimBusQutils.o))
+***************************************************************************************************/
+
+#include <algorithm>
+#include <cfloat>
+
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsOutOfBoundsException.hh"
+#include "software/SimBus/SimBusQutils.hh"
+
+#include "UtSimBusQueueAdapter.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Sim Bus Queue Adapter unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtSimBusQueueAdapter::UtSimBusQueueAdapter()
+    :
+    tQueueDouble(0),
+    tQueueBool(0),
+    tQueueSize(0),
+    tExtractionSize(0),
+    tArticle(0)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Sim Bus Queue Adapter unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtSimBusQueueAdapter::~UtSimBusQueueAdapter()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSimBusQueueAdapter::setUp()
+{
+    /// - Allocate the queue arrays and initialize the values.
+    tQueueSize      = 10;
+    tExtractionSize = 5;
+    tQueueDouble    = new double[tQueueSize];
+    tQueueBool      = new bool[tQueueSize];
+
+    for (int i = 0; i < tQueueSize; ++i) {
+        tQueueDouble[i] = (i % 3) - i + 1.1;
+        tQueueBool[i]   = false;
+    }
+
+    tArticle = new FriendlySimBusQueueAdapter();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSimBusQueueAdapter::tearDown()
+{
+    delete tArticle;
+    delete [] tQueueBool;
+    delete [] tQueueDouble;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the default constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSimBusQueueAdapter::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtSimBusQueueAdapter 01: testDefaultConstruction ...................";
+
+    CPPUNIT_ASSERT(SimBusQueueAdapter::ZERO_ORDER_HOLD == tArticle->mConversion);
+    CPPUNIT_ASSERT_EQUAL(1, tArticle->mProducerPeriod);
+    CPPUNIT_ASSERT_EQUAL(0, tArticle->getCount());
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getSum());
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getLatest());
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getValue());
+    CPPUNIT_ASSERT(!tArticle->isPulseHigh());
+    CPPUNIT_ASSERT_EQUAL(0, tArticle->getRisingEdges());
+    CPPUNIT_ASSERT(!tArticle->mHasSample);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the initialize method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSimBusQueueAdapter::testInitialize()
+{
+    std::cout << "\n UtSimBusQueueAdapter 02: testInitialize ............................";
+
+    /// - Test nominal initialization resets the held samples.
+    tArticle->push(3.0);
+    tArticle->initialize(SimBusQueueAdapter::LINEAR, 4);
+    CPPUNIT_ASSERT(SimBusQueueAdapter::LINEAR == tArticle->mConversion);
+    CPPUNIT_ASSERT_EQUAL(4,   tArticle->mProducerPeriod);
+    CPPUNIT_ASSERT_EQUAL(0,   tArticle->getCount());
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getLatest());
+    CPPUNIT_ASSERT(!tArticle->mHasSample);
+
+    /// - Test for exception thrown for zero producer period.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(SimBusQueueAdapter::LINEAR, 0),
+                         TsInitializationException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the running statistics against the SimBusQutils methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSimBusQueueAdapter::testStatistics()
+{
+    std::cout << "\n UtSimBusQueueAdapter 03: testStatistics ............................";
+
+    /// - Test a queue agrees with the SimBusQutils methods.
+    tArticle->beginFrame();
+    tArticle->pushQueue(tQueueDouble, tExtractionSize);
+    CPPUNIT_ASSERT_EQUAL(tExtractionSize, tArticle->getCount());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(SimBusQutils::getLatest(tQueueDouble),
+                                 tArticle->getLatest(), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(SimBusQutils::getSum(tQueueDouble, tExtractionSize),
+                                 tArticle->getSum(), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(SimBusQutils::getAverage(tQueueDouble, tExtractionSize),
+                                 tArticle->getAverage(), DBL_EPSILON);
+
+    double expectedMin = tQueueDouble[0];
+    double expectedMax = tQueueDouble[0];
+    for (int i = 1; i < tExtractionSize; ++i) {
+        expectedMin = std::min(expectedMin, tQueueDouble[i]);
+        expectedMax = std::max(expectedMax, tQueueDouble[i]);
+    }
+    CPPUNIT_ASSERT_EQUAL(expectedMin, tArticle->getMin());
+    CPPUNIT_ASSERT_EQUAL(expectedMax, tArticle->getMax());
+
+    /// - Test samples pushed one at a time accumulate in the frame.
+    tArticle->push(100.0);
+    CPPUNIT_ASSERT_EQUAL(tExtractionSize + 1, tArticle->getCount());
+    CPPUNIT_ASSERT_EQUAL(100.0, tArticle->getMax());
+    CPPUNIT_ASSERT_EQUAL(100.0, tArticle->getLatest());
+
+    /// - Test a new frame clears the statistics and holds the latest sample.
+    tArticle->beginFrame();
+    CPPUNIT_ASSERT_EQUAL(0,     tArticle->getCount());
+    CPPUNIT_ASSERT_EQUAL(0.0,   tArticle->getSum());
+    CPPUNIT_ASSERT_EQUAL(100.0, tArticle->getLatest());
+    CPPUNIT_ASSERT_EQUAL(100.0, tArticle->getMin());
+    CPPUNIT_ASSERT_EQUAL(100.0, tArticle->getMax());
+
+    /// - Test for exception thrown for average with no samples this frame.
+    CPPUNIT_ASSERT_THROW(tArticle->getAverage(), TsOutOfBoundsException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the pulse methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSimBusQueueAdapter::testPulses()
+{
+    std::cout << "\n UtSimBusQueueAdapter 04: testPulses ................................";
+
+    /// - Test an all-low queue.
+    tArticle->beginFrame();
+    tArticle->pushPulseQueue(tQueueBool, tExtractionSize);
+    CPPUNIT_ASSERT_EQUAL(SimBusQutils::isPulseHigh(tQueueBool, tExtractionSize),
+                         tArticle->isPulseHigh());
+    CPPUNIT_ASSERT_EQUAL(0, tArticle->getRisingEdges());
+
+    /// - Test two separate pulses in the queue, the oldest being the last element.
+    tQueueBool[tExtractionSize - 1] = true;
+    tQueueBool[1]                   = true;
+    tQueueBool[0]                   = true;
+    tArticle->beginFrame();
+    tArticle->pushPulseQueue(tQueueBool, tExtractionSize);
+    CPPUNIT_ASSERT_EQUAL(SimBusQutils::isPulseHigh(tQueueBool, tExtractionSize),
+                         tArticle->isPulseHigh());
+    CPPUNIT_ASSERT_EQUAL(2,   tArticle->getRisingEdges());
+    CPPUNIT_ASSERT_EQUAL(3.0, tArticle->getSum());
+
+    /// - Test a pulse held high across frames isn't a new rising edge.
+    tArticle->beginFrame();
+    CPPUNIT_ASSERT(!tArticle->isPulseHigh());
+    tArticle->pushPulse(true);
+    CPPUNIT_ASSERT(tArticle->isPulseHigh());
+    CPPUNIT_ASSERT_EQUAL(0, tArticle->getRisingEdges());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the rate conversion methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSimBusQueueAdapter::testRateConversion()
+{
+    std::cout << "\n UtSimBusQueueAdapter 05: testRateConversion ........................";
+
+    /// - Test zero-order hold of a producer at 1/4 the consumer rate.
+    tArticle->initialize(SimBusQueueAdapter::ZERO_ORDER_HOLD, 4);
+    tArticle->beginFrame();
+    tArticle->push(2.0);
+    CPPUNIT_ASSERT_EQUAL(2.0, tArticle->getValue());
+    tArticle->beginFrame();
+    tArticle->push(6.0);
+    for (int i = 0; i < 3; ++i) {
+        tArticle->beginFrame();
+        CPPUNIT_ASSERT_EQUAL(6.0, tArticle->getValue());
+    }
+
+    /// - Test the first sample is held with linear conversion.
+    tArticle->initialize(SimBusQueueAdapter::LINEAR, 4);
+    tArticle->beginFrame();
+    tArticle->push(2.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tArticle->getValue(), DBL_EPSILON);
+
+    /// - Test linear interpolation towards the next sample over the producer period, and held
+    ///   after it.
+    for (int i = 1; i < 4; ++i) {
+        tArticle->beginFrame();
+    }
+    tArticle->beginFrame();
+    tArticle->push(6.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tArticle->getValue(), DBL_EPSILON);
+    for (int i = 1; i <= 4; ++i) {
+        tArticle->beginFrame();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0 + i, tArticle->getValue(), DBL_EPSILON);
+    }
+    tArticle->beginFrame();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(6.0, tArticle->getValue(), DBL_EPSILON);
+
+    std::cout << "... Pass";
+}
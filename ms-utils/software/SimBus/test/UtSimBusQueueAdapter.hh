@@ -0,0 +1,88 @@
+#ifndef UtSimBusQueueAdapter_EXISTS
+#define UtSimBusQueueAdapter_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILITIES_SOFTWARE_SIM_BUS_ADAPTER    Sim Bus Queue Adapter Unit Tests
+/// @ingroup  UT_UTILITIES_SOFTWARE
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Sim Bus Queue Adapter.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "software/SimBus/SimBusQueueAdapter.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from SimBusQueueAdapter and befriend UtSimBusQueueAdapter.
+///
+/// @details  Class derived from the unit under test. It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlySimBusQueueAdapter : public SimBusQueueAdapter
+{
+    public:
+        FriendlySimBusQueueAdapter();
+        virtual ~FriendlySimBusQueueAdapter();
+        friend class UtSimBusQueueAdapter;
+};
+inline FriendlySimBusQueueAdapter::FriendlySimBusQueueAdapter() : SimBusQueueAdapter() {};
+inline FriendlySimBusQueueAdapter::~FriendlySimBusQueueAdapter() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Sim Bus Queue Adapter unit tests.
+////
+/// @details  This class provides the unit tests for the SimBusQueueAdapter class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtSimBusQueueAdapter : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Sim Bus Queue Adapter unit test.
+        UtSimBusQueueAdapter();
+        /// @brief    Default destructs this Sim Bus Queue Adapter unit test.
+        virtual ~UtSimBusQueueAdapter();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        void testDefaultConstruction();
+        void testInitialize();
+        void testStatistics();
+        void testPulses();
+        void testRateConversion();
+    private:
+        CPPUNIT_TEST_SUITE(UtSimBusQueueAdapter);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testStatistics);
+        CPPUNIT_TEST(testPulses);
+        CPPUNIT_TEST(testRateConversion);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief  --  Array of type double for the test queue values
+        double* tQueueDouble;
+        /// @brief  --  Array of type boolean for the test queue values
+        bool*   tQueueBool;
+        /// @brief  --  Test queue size
+        int     tQueueSize;
+        /// @brief  --  Test queue extraction size
+        int     tExtractionSize;
+        /// @brief  --  Test article
+        FriendlySimBusQueueAdapter* tArticle;
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtSimBusQueueAdapter(const UtSimBusQueueAdapter& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtSimBusQueueAdapter& operator =(const UtSimBusQueueAdapter& that);
+};
+
+///@}
+
+#endif
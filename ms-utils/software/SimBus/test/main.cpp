@@ -18,6 +18,7 @@ LIBRARY DEPENDENCY:
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "UtSimBusQutils.hh"
+#include "UtSimBusQueueAdapter.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  not used
@@ -46,6 +47,7 @@ int main(int argc, char** argv) {
     CppUnit::TextTestRunner runner;
 
     runner.addTest( UtSimBusQutils::suite() );
+    runner.addTest( UtSimBusQueueAdapter::suite() );
 
     runner.run(testresult);
     // Output results in compiler format